@@ -13,6 +13,7 @@
 
 namespace duckdb {
 struct BenchmarkFileReader;
+struct InterpretedBenchmarkState;
 class MaterializedQueryResult;
 
 const string DEFAULT_DB_PATH = "duckdb_benchmark_db.db";
@@ -56,6 +57,8 @@ public:
 
 private:
 	string VerifyInternal(BenchmarkState *state_p, MaterializedQueryResult &result);
+	//! Runs the query from "concurrency" client threads and reports latency percentiles and throughput
+	void RunConcurrent(InterpretedBenchmarkState &state);
 
 	void ReadResultFromFile(BenchmarkFileReader &reader, const string &file);
 	void ReadResultFromReader(BenchmarkFileReader &reader, const string &file);
@@ -80,6 +83,10 @@ private:
 
 	bool in_memory = true;
 	bool require_reinit = false;
+	//! The number of client threads that concurrently issue the run query (1 = regular single-query benchmark)
+	size_t concurrency = 1;
+	//! The number of times each client thread issues the run query in a concurrent run
+	size_t iterations = 5;
 };
 
 } // namespace duckdb
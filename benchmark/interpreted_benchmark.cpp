@@ -2,14 +2,17 @@
 
 #include "benchmark_runner.hpp"
 #include "duckdb.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "test_helpers.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 namespace duckdb {
 
@@ -192,6 +195,22 @@ void InterpretedBenchmark::LoadBenchmark() {
 			} else {
 				throw std::runtime_error(reader.FormatException("Invalid argument for storage"));
 			}
+		} else if (splits[0] == "concurrency") {
+			if (splits.size() != 2) {
+				throw std::runtime_error(reader.FormatException("concurrency requires a single parameter"));
+			}
+			concurrency = std::stoull(splits[1]);
+			if (concurrency == 0) {
+				throw std::runtime_error(reader.FormatException("concurrency must be at least 1"));
+			}
+		} else if (splits[0] == "iterations") {
+			if (splits.size() != 2) {
+				throw std::runtime_error(reader.FormatException("iterations requires a single parameter"));
+			}
+			iterations = std::stoull(splits[1]);
+			if (iterations == 0) {
+				throw std::runtime_error(reader.FormatException("iterations must be at least 1"));
+			}
 		} else if (splits[0] == "require_reinit") {
 			if (splits.size() != 1) {
 				throw std::runtime_error(reader.FormatException("require_reinit does not take any parameters"));
@@ -390,8 +409,65 @@ string InterpretedBenchmark::GetQuery() {
 	return run_query;
 }
 
+//! Returns the given percentile (0-100) of a sorted set of timings
+static double TimingPercentile(const vector<double> &sorted_timings, idx_t percentile) {
+	D_ASSERT(!sorted_timings.empty());
+	idx_t index = (percentile * sorted_timings.size()) / 100;
+	return sorted_timings[MinValue<idx_t>(index, sorted_timings.size() - 1)];
+}
+
+void InterpretedBenchmark::RunConcurrent(InterpretedBenchmarkState &state) {
+	// issue the run query from "concurrency" client threads, each on its own connection, "iterations" times per
+	// thread, and report the latency distribution and aggregate throughput over all issued queries
+	vector<std::thread> threads;
+	vector<vector<double>> timings(concurrency);
+	vector<unique_ptr<MaterializedQueryResult>> results(concurrency);
+	Profiler total;
+	total.Start();
+	for (idx_t thread_idx = 0; thread_idx < concurrency; thread_idx++) {
+		threads.emplace_back([&, thread_idx]() {
+			Connection con(state.db);
+			for (idx_t i = 0; i < iterations; i++) {
+				Profiler profiler;
+				profiler.Start();
+				auto result = con.Query(run_query);
+				profiler.End();
+				timings[thread_idx].push_back(profiler.Elapsed());
+				bool has_error = result->HasError();
+				results[thread_idx] = std::move(result);
+				if (has_error) {
+					break;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	total.End();
+
+	// the verified result is the first failed query, if any, and the first thread's last result otherwise
+	state.result = std::move(results[0]);
+	vector<double> all_timings;
+	for (idx_t thread_idx = 0; thread_idx < concurrency; thread_idx++) {
+		if (results[thread_idx] && results[thread_idx]->HasError()) {
+			state.result = std::move(results[thread_idx]);
+		}
+		all_timings.insert(all_timings.end(), timings[thread_idx].begin(), timings[thread_idx].end());
+	}
+	std::sort(all_timings.begin(), all_timings.end());
+	BenchmarkRunner::GetInstance().LogLine(StringUtil::Format(
+	    "concurrency=%lld queries=%lld qps=%.2f p50=%.6f p95=%.6f p99=%.6f", (int64_t)concurrency,
+	    (int64_t)all_timings.size(), double(all_timings.size()) / total.Elapsed(), TimingPercentile(all_timings, 50),
+	    TimingPercentile(all_timings, 95), TimingPercentile(all_timings, 99)));
+}
+
 void InterpretedBenchmark::Run(BenchmarkState *state_p) {
 	auto &state = (InterpretedBenchmarkState &)*state_p;
+	if (concurrency > 1) {
+		RunConcurrent(state);
+		return;
+	}
 	state.result = state.con.Query(run_query);
 }
 
@@ -0,0 +1,350 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/row_data_collection.hpp"
+#include "duckdb/common/types/row_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+using namespace duckdb;
+
+//! These benchmarks time individual vectorized kernels (hashing, comparison, row scatter, bitpacking) over controlled
+//! vector layouts, so regressions in the kernels themselves show up directly instead of being diluted by the rest of
+//! the pipeline. Every benchmark runs a kernel over one vector of KERNEL_ROW_COUNT values, KERNEL_ITERATIONS times.
+#define KERNEL_ROW_COUNT STANDARD_VECTOR_SIZE
+#define KERNEL_ITERATIONS 200000
+
+//! Base class for the state of a kernel benchmark; derived states hold the prepared vectors
+struct VectorKernelState : public BenchmarkState {
+	//! The wall-clock time of the last run, used to derive the throughput metrics
+	double elapsed = 0;
+};
+
+class VectorKernelBenchmark : public Benchmark {
+public:
+	VectorKernelBenchmark(bool register_benchmark, string name)
+	    : Benchmark(register_benchmark, name, "[vector_kernels]") {
+	}
+
+	//! Prepare the vectors the kernel runs over
+	virtual unique_ptr<VectorKernelState> InitializeKernel() = 0;
+	//! Run the kernel once over the prepared vectors
+	virtual void RunKernel(VectorKernelState &state) = 0;
+	//! The number of bytes the kernel reads and writes per invocation, for the throughput metric
+	virtual idx_t BytesPerIteration(VectorKernelState &state) = 0;
+
+	unique_ptr<BenchmarkState> Initialize(BenchmarkConfiguration &config) override {
+		return InitializeKernel();
+	}
+	void Run(BenchmarkState *state_p) override {
+		auto &state = (VectorKernelState &)*state_p;
+		Profiler profiler;
+		profiler.Start();
+		for (idx_t i = 0; i < KERNEL_ITERATIONS; i++) {
+			RunKernel(state);
+		}
+		profiler.End();
+		state.elapsed = profiler.Elapsed();
+	}
+	void Cleanup(BenchmarkState *state) override {
+	}
+	string Verify(BenchmarkState *state) override {
+		return string();
+	}
+	void Interrupt(BenchmarkState *state) override {
+	}
+	string GetLogOutput(BenchmarkState *state_p) override {
+		auto &state = (VectorKernelState &)*state_p;
+		auto values = double(KERNEL_ITERATIONS) * KERNEL_ROW_COUNT;
+		auto bytes = double(KERNEL_ITERATIONS) * BytesPerIteration(state);
+		return StringUtil::Format("%s: %.3f GB/s, %.3f ns/value", name, bytes / state.elapsed / 1e9,
+		                          state.elapsed * 1e9 / values);
+	}
+};
+
+#define VECTOR_KERNEL_BENCHMARK(NAME)                                                                                  \
+	class NAME##Benchmark : public VectorKernelBenchmark {                                                             \
+		NAME##Benchmark(bool register_benchmark) : VectorKernelBenchmark(register_benchmark, "" #NAME) {               \
+		}                                                                                                              \
+                                                                                                                       \
+	public:                                                                                                            \
+		static NAME##Benchmark *GetInstance() {                                                                        \
+			static NAME##Benchmark singleton(true);                                                                    \
+			return &singleton;                                                                                         \
+		}
+
+static void FillInputData(Vector &vec, idx_t count) {
+	auto data = FlatVector::GetData<int64_t>(vec);
+	for (idx_t i = 0; i < count; i++) {
+		data[i] = int64_t((i * 1337) % 4096);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// VectorOperations::Hash
+//===--------------------------------------------------------------------===//
+struct HashKernelState : public VectorKernelState {
+	HashKernelState() : base(LogicalType::BIGINT), input(LogicalType::BIGINT), hashes(LogicalType::HASH) {
+	}
+
+	Vector base;
+	Vector input;
+	Vector hashes;
+	SelectionVector sel;
+};
+
+static unique_ptr<HashKernelState> InitializeHashState(bool dictionary, bool nulls) {
+	auto state = make_unique<HashKernelState>();
+	FillInputData(state->base, KERNEL_ROW_COUNT);
+	if (nulls) {
+		auto &mask = FlatVector::Validity(state->base);
+		for (idx_t i = 0; i < KERNEL_ROW_COUNT; i += 4) {
+			mask.SetInvalid(i);
+		}
+	}
+	if (dictionary) {
+		// a dictionary over the base vector that selects every value twice
+		state->sel.Initialize(KERNEL_ROW_COUNT);
+		for (idx_t i = 0; i < KERNEL_ROW_COUNT; i++) {
+			state->sel.set_index(i, i / 2);
+		}
+		state->input.Slice(state->base, state->sel, KERNEL_ROW_COUNT);
+	} else {
+		state->input.Reference(state->base);
+	}
+	return state;
+}
+
+VECTOR_KERNEL_BENCHMARK(VectorHashFlat)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	return InitializeHashState(false, false);
+}
+void RunKernel(VectorKernelState &state) override {
+	auto &hash_state = (HashKernelState &)state;
+	VectorOperations::Hash(hash_state.input, hash_state.hashes, KERNEL_ROW_COUNT);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	return KERNEL_ROW_COUNT * (sizeof(int64_t) + sizeof(hash_t));
+}
+string BenchmarkInfo() override {
+	return "Hash a flat BIGINT vector";
+}
+FINISH_BENCHMARK(VectorHashFlat)
+
+VECTOR_KERNEL_BENCHMARK(VectorHashDictionary)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	return InitializeHashState(true, false);
+}
+void RunKernel(VectorKernelState &state) override {
+	auto &hash_state = (HashKernelState &)state;
+	VectorOperations::Hash(hash_state.input, hash_state.hashes, KERNEL_ROW_COUNT);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	return KERNEL_ROW_COUNT * (sizeof(int64_t) + sizeof(hash_t));
+}
+string BenchmarkInfo() override {
+	return "Hash a dictionary BIGINT vector";
+}
+FINISH_BENCHMARK(VectorHashDictionary)
+
+VECTOR_KERNEL_BENCHMARK(VectorHashNulls)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	return InitializeHashState(false, true);
+}
+void RunKernel(VectorKernelState &state) override {
+	auto &hash_state = (HashKernelState &)state;
+	VectorOperations::Hash(hash_state.input, hash_state.hashes, KERNEL_ROW_COUNT);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	return KERNEL_ROW_COUNT * (sizeof(int64_t) + sizeof(hash_t));
+}
+string BenchmarkInfo() override {
+	return "Hash a flat BIGINT vector with one in four values NULL";
+}
+FINISH_BENCHMARK(VectorHashNulls)
+
+//===--------------------------------------------------------------------===//
+// VectorOperations::Equals
+//===--------------------------------------------------------------------===//
+struct CompareKernelState : public VectorKernelState {
+	CompareKernelState()
+	    : left(LogicalType::BIGINT), right(LogicalType::BIGINT), result(LogicalType::BOOLEAN),
+	      true_sel(KERNEL_ROW_COUNT), false_sel(KERNEL_ROW_COUNT) {
+	}
+
+	Vector left;
+	Vector right;
+	Vector result;
+	SelectionVector true_sel;
+	SelectionVector false_sel;
+};
+
+static unique_ptr<CompareKernelState> InitializeCompareState() {
+	auto state = make_unique<CompareKernelState>();
+	FillInputData(state->left, KERNEL_ROW_COUNT);
+	// half of the values match, so the select variant fills both output selection vectors
+	auto rdata = FlatVector::GetData<int64_t>(state->right);
+	auto ldata = FlatVector::GetData<int64_t>(state->left);
+	for (idx_t i = 0; i < KERNEL_ROW_COUNT; i++) {
+		rdata[i] = i % 2 == 0 ? ldata[i] : ldata[i] + 1;
+	}
+	return state;
+}
+
+VECTOR_KERNEL_BENCHMARK(VectorEqualsFlat)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	return InitializeCompareState();
+}
+void RunKernel(VectorKernelState &state) override {
+	auto &cmp_state = (CompareKernelState &)state;
+	VectorOperations::Equals(cmp_state.left, cmp_state.right, cmp_state.result, KERNEL_ROW_COUNT);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	return KERNEL_ROW_COUNT * (2 * sizeof(int64_t) + sizeof(bool));
+}
+string BenchmarkInfo() override {
+	return "Compare two flat BIGINT vectors into a boolean result vector";
+}
+FINISH_BENCHMARK(VectorEqualsFlat)
+
+VECTOR_KERNEL_BENCHMARK(VectorEqualsSelection)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	return InitializeCompareState();
+}
+void RunKernel(VectorKernelState &state) override {
+	auto &cmp_state = (CompareKernelState &)state;
+	VectorOperations::Equals(cmp_state.left, cmp_state.right, FlatVector::IncrementalSelectionVector(),
+	                         KERNEL_ROW_COUNT, &cmp_state.true_sel, &cmp_state.false_sel);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	return KERNEL_ROW_COUNT * (2 * sizeof(int64_t) + sizeof(sel_t));
+}
+string BenchmarkInfo() override {
+	return "Compare two flat BIGINT vectors into true/false selection vectors";
+}
+FINISH_BENCHMARK(VectorEqualsSelection)
+
+//===--------------------------------------------------------------------===//
+// RowOperations::Scatter
+//===--------------------------------------------------------------------===//
+struct RowScatterKernelState : public VectorKernelState {
+	RowScatterKernelState() : db(nullptr), addresses(LogicalType::POINTER) {
+	}
+
+	DuckDB db;
+	RowLayout layout;
+	DataChunk input;
+	vector<UnifiedVectorFormat> source_data;
+	unique_ptr<RowDataCollection> string_heap;
+	//! The fixed row storage the chunk is scattered into
+	unique_ptr<data_t[]> row_data;
+	Vector addresses;
+};
+
+static unique_ptr<RowScatterKernelState> InitializeRowScatterState(bool nulls) {
+	auto state = make_unique<RowScatterKernelState>();
+	vector<LogicalType> types {LogicalType::BIGINT, LogicalType::BIGINT};
+	state->layout.Initialize(types);
+	state->input.Initialize(Allocator::DefaultAllocator(), types);
+	for (auto &col : state->input.data) {
+		FillInputData(col, KERNEL_ROW_COUNT);
+		if (nulls) {
+			auto &mask = FlatVector::Validity(col);
+			for (idx_t i = 0; i < KERNEL_ROW_COUNT; i += 4) {
+				mask.SetInvalid(i);
+			}
+		}
+	}
+	state->input.SetCardinality(KERNEL_ROW_COUNT);
+	state->source_data.resize(types.size());
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		state->input.data[col_idx].ToUnifiedFormat(KERNEL_ROW_COUNT, state->source_data[col_idx]);
+	}
+	// the heap is required by the interface but unused for fixed-size types
+	state->string_heap =
+	    make_unique<RowDataCollection>(BufferManager::GetBufferManager(*state->db.instance), KERNEL_ROW_COUNT, 1, true);
+	state->row_data = unique_ptr<data_t[]>(new data_t[state->layout.GetRowWidth() * KERNEL_ROW_COUNT]);
+	auto pointers = FlatVector::GetData<data_ptr_t>(state->addresses);
+	for (idx_t i = 0; i < KERNEL_ROW_COUNT; i++) {
+		pointers[i] = state->row_data.get() + i * state->layout.GetRowWidth();
+	}
+	return state;
+}
+
+static void RunRowScatterKernel(VectorKernelState &state) {
+	auto &scatter_state = (RowScatterKernelState &)state;
+	RowOperations::Scatter(scatter_state.input, scatter_state.source_data.data(), scatter_state.layout,
+	                       scatter_state.addresses, *scatter_state.string_heap,
+	                       *FlatVector::IncrementalSelectionVector(), KERNEL_ROW_COUNT);
+}
+
+VECTOR_KERNEL_BENCHMARK(RowScatterFlat)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	return InitializeRowScatterState(false);
+}
+void RunKernel(VectorKernelState &state) override {
+	RunRowScatterKernel(state);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	auto &scatter_state = (RowScatterKernelState &)state;
+	return KERNEL_ROW_COUNT * (2 * sizeof(int64_t) + scatter_state.layout.GetRowWidth());
+}
+string BenchmarkInfo() override {
+	return "Scatter a two-column BIGINT chunk into row-major storage";
+}
+FINISH_BENCHMARK(RowScatterFlat)
+
+VECTOR_KERNEL_BENCHMARK(RowScatterNulls)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	return InitializeRowScatterState(true);
+}
+void RunKernel(VectorKernelState &state) override {
+	RunRowScatterKernel(state);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	auto &scatter_state = (RowScatterKernelState &)state;
+	return KERNEL_ROW_COUNT * (2 * sizeof(int64_t) + scatter_state.layout.GetRowWidth());
+}
+string BenchmarkInfo() override {
+	return "Scatter a two-column BIGINT chunk with NULLs into row-major storage";
+}
+FINISH_BENCHMARK(RowScatterNulls)
+
+//===--------------------------------------------------------------------===//
+// BitpackingPrimitives::UnPackBuffer
+//===--------------------------------------------------------------------===//
+struct BitpackingKernelState : public VectorKernelState {
+	static constexpr const bitpacking_width_t WIDTH = 13;
+
+	unique_ptr<data_t[]> packed;
+	unique_ptr<data_t[]> unpacked;
+};
+
+VECTOR_KERNEL_BENCHMARK(BitpackingUnpack)
+unique_ptr<VectorKernelState> InitializeKernel() override {
+	auto state = make_unique<BitpackingKernelState>();
+	vector<uint32_t> values(KERNEL_ROW_COUNT);
+	for (idx_t i = 0; i < KERNEL_ROW_COUNT; i++) {
+		values[i] = uint32_t((i * 1337) % (1 << BitpackingKernelState::WIDTH));
+	}
+	state->packed = unique_ptr<data_t[]>(new data_t[KERNEL_ROW_COUNT * sizeof(uint32_t)]);
+	state->unpacked = unique_ptr<data_t[]>(new data_t[KERNEL_ROW_COUNT * sizeof(uint32_t)]);
+	BitpackingPrimitives::PackBuffer<uint32_t>(state->packed.get(), values.data(), KERNEL_ROW_COUNT,
+	                                           BitpackingKernelState::WIDTH);
+	return std::move(state);
+}
+void RunKernel(VectorKernelState &state) override {
+	auto &bp_state = (BitpackingKernelState &)state;
+	BitpackingPrimitives::UnPackBuffer<uint32_t>(bp_state.unpacked.get(), bp_state.packed.get(), KERNEL_ROW_COUNT,
+	                                             BitpackingKernelState::WIDTH, true);
+}
+idx_t BytesPerIteration(VectorKernelState &state) override {
+	return KERNEL_ROW_COUNT * BitpackingKernelState::WIDTH / 8 + KERNEL_ROW_COUNT * sizeof(uint32_t);
+}
+string BenchmarkInfo() override {
+	return "Unpack a buffer of 13-bit packed UINTEGER values";
+}
+FINISH_BENCHMARK(BitpackingUnpack)
@@ -62,6 +62,12 @@ void FTSExtension::Load(DuckDB &db) {
 	create_fts_index_func.named_parameters["overwrite"] = LogicalType::BOOLEAN;
 	CreatePragmaFunctionInfo create_fts_index_info(create_fts_index_func);
 
+	auto refresh_fts_index_func =
+	    PragmaFunction::PragmaCall("refresh_fts_index", refresh_fts_index_query,
+	                               {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::VARCHAR);
+	refresh_fts_index_func.named_parameters["stemmer"] = LogicalType::VARCHAR;
+	CreatePragmaFunctionInfo refresh_fts_index_info(refresh_fts_index_func);
+
 	auto drop_fts_index_func =
 	    PragmaFunction::PragmaCall("drop_fts_index", drop_fts_index_query, {LogicalType::VARCHAR});
 	CreatePragmaFunctionInfo drop_fts_index_info(drop_fts_index_func);
@@ -71,6 +77,7 @@ void FTSExtension::Load(DuckDB &db) {
 	auto &catalog = Catalog::GetSystemCatalog(*conn.context);
 	catalog.CreateFunction(*conn.context, &stem_info);
 	catalog.CreatePragmaFunction(*conn.context, &create_fts_index_info);
+	catalog.CreatePragmaFunction(*conn.context, &refresh_fts_index_info);
 	catalog.CreatePragmaFunction(*conn.context, &drop_fts_index_info);
 	conn.Commit();
 }
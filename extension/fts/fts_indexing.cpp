@@ -236,6 +236,36 @@ void check_exists(ClientContext &context, QualifiedName &qname) {
 	Catalog::GetEntry<TableCatalogEntry>(context, INVALID_CATALOG, qname.schema, qname.name);
 }
 
+static vector<string> doc_values_from_parameters(ClientContext &context, QualifiedName &qname,
+                                                 const FunctionParameters &parameters) {
+	// check all specified columns
+	auto table = Catalog::GetEntry<TableCatalogEntry>(context, INVALID_CATALOG, qname.schema, qname.name);
+	vector<string> doc_values;
+	for (idx_t i = 2; i < parameters.values.size(); i++) {
+		string col_name = StringValue::Get(parameters.values[i]);
+		if (col_name == "*") {
+			// star found - get all columns
+			doc_values.clear();
+			for (auto &cd : table->columns.Logical()) {
+				if (cd.Type() == LogicalType::VARCHAR) {
+					doc_values.push_back(cd.Name());
+				}
+			}
+			break;
+		}
+		if (!table->ColumnExists(col_name)) {
+			// we check this here because else we we end up with an error halfway the indexing script
+			throw CatalogException("Table '%s.%s' does not have a column named '%s'!", qname.schema, qname.name,
+			                       col_name);
+		}
+		doc_values.push_back(col_name);
+	}
+	if (doc_values.empty()) {
+		throw Exception("at least one column must be supplied for indexing!");
+	}
+	return doc_values;
+}
+
 string create_fts_index_query(ClientContext &context, const FunctionParameters &parameters) {
 	auto qname = QualifiedName::Parse(StringValue::Get(parameters.values[0]));
 	if (qname.schema == INVALID_SCHEMA) {
@@ -293,34 +323,137 @@ string create_fts_index_query(ClientContext &context, const FunctionParameters &
 
 	// positional parameters
 	auto doc_id = StringValue::Get(parameters.values[1]);
-	// check all specified columns
-	auto table = Catalog::GetEntry<TableCatalogEntry>(context, INVALID_CATALOG, qname.schema, qname.name);
-	vector<string> doc_values;
-	for (idx_t i = 2; i < parameters.values.size(); i++) {
-		string col_name = StringValue::Get(parameters.values[i]);
-		if (col_name == "*") {
-			// star found - get all columns
-			doc_values.clear();
-			for (auto &cd : table->columns.Logical()) {
-				if (cd.Type() == LogicalType::VARCHAR) {
-					doc_values.push_back(cd.Name());
-				}
-			}
-			break;
-		}
-		if (!table->ColumnExists(col_name)) {
-			// we check this here because else we we end up with an error halfway the indexing script
-			throw CatalogException("Table '%s.%s' does not have a column named '%s'!", qname.schema, qname.name,
-			                       col_name);
-		}
-		doc_values.push_back(col_name);
-	}
-	if (doc_values.empty()) {
-		throw Exception("at least one column must be supplied for indexing!");
-	}
+	auto doc_values = doc_values_from_parameters(context, qname, parameters);
 
 	return indexing_script(qname.schema, qname.name, doc_id, doc_values, stemmer, stopwords, ignore, strip_accents,
 	                       lower);
 }
 
+static string refresh_script(const string &input_schema, const string &input_table, const string &input_id,
+                             const vector<string> &input_values, const string &stemmer) {
+	// index only the rows that were appended since the last (re)build, i.e. rows beyond the highest indexed docid,
+	// and merge them into the existing index tables; the stored tokenize macro and stopwords table are reused
+	// clang-format off
+	string result = R"(
+        CREATE TEMPORARY TABLE fts_refresh_docs AS
+        SELECT rowid AS docid,
+               "%input_id%" AS name
+        FROM %input_schema%.%input_table%
+        WHERE rowid > (SELECT coalesce(max(docid), -1) FROM %fts_schema%.docs);
+
+        CREATE TEMPORARY TABLE fts_refresh_terms AS
+        WITH tokenized AS (
+            %union_fields_query%
+        ),
+	    stemmed_stopped AS (
+            SELECT stem(t.w, '%stemmer%') AS term,
+	               t.docid AS docid,
+                   t.fieldid AS fieldid
+	        FROM tokenized AS t
+	        WHERE t.w NOT NULL
+              AND len(t.w) > 0
+	          AND t.w NOT IN (SELECT sw FROM %fts_schema%.stopwords)
+        )
+	    SELECT ss.term,
+	           ss.docid,
+	           ss.fieldid
+        FROM stemmed_stopped AS ss;
+
+        INSERT INTO %fts_schema%.docs (docid, name, len)
+        SELECT d.docid,
+               d.name,
+               (SELECT count(*) FROM fts_refresh_terms AS t WHERE t.docid = d.docid)
+        FROM fts_refresh_docs AS d;
+
+        INSERT INTO %fts_schema%.dict (termid, term, df)
+        SELECT (SELECT coalesce(max(termid), -1) FROM %fts_schema%.dict) + row_number() OVER (PARTITION BY (SELECT NULL)) AS termid,
+               nt.term,
+               0
+        FROM (
+            SELECT DISTINCT term
+            FROM fts_refresh_terms
+            WHERE term NOT IN (SELECT term FROM %fts_schema%.dict)
+        ) AS nt;
+
+        INSERT INTO %fts_schema%.terms (docid, fieldid, termid)
+        SELECT t.docid,
+               t.fieldid,
+               d.termid
+        FROM fts_refresh_terms AS t
+        JOIN %fts_schema%.dict AS d
+        ON t.term = d.term;
+
+        UPDATE %fts_schema%.dict d
+        SET df = df + (
+            SELECT count(DISTINCT t.docid)
+            FROM fts_refresh_terms t
+            WHERE t.term = d.term
+        )
+        WHERE d.term IN (SELECT term FROM fts_refresh_terms);
+
+        DELETE FROM %fts_schema%.stats;
+        INSERT INTO %fts_schema%.stats
+        SELECT COUNT(docs.docid) AS num_docs,
+               SUM(docs.len) / COUNT(docs.len) AS avgdl
+        FROM %fts_schema%.docs AS docs;
+
+        DROP TABLE fts_refresh_terms;
+        DROP TABLE fts_refresh_docs;
+    )";
+
+	// tokenize only the newly appended rows of each indexed field
+	string tokenize_field_query = R"(
+        SELECT unnest(%fts_schema%.tokenize(fts_ii."%input_value%")) AS w,
+	           rowid AS docid,
+	           (SELECT fieldid FROM %fts_schema%.fields WHERE field = '%input_value%') AS fieldid
+        FROM %input_schema%.%input_table% AS fts_ii
+        WHERE fts_ii.rowid IN (SELECT docid FROM fts_refresh_docs)
+    )";
+	// clang-format on
+	vector<string> tokenize_fields;
+	for (idx_t i = 0; i < input_values.size(); i++) {
+		tokenize_fields.push_back(StringUtil::Replace(tokenize_field_query, "%input_value%", input_values[i]));
+	}
+	result = StringUtil::Replace(result, "%union_fields_query%", StringUtil::Join(tokenize_fields, " UNION ALL "));
+
+	string fts_schema = fts_schema_name(input_schema, input_table);
+
+	// fill in variables (inefficiently, but keeps SQL script readable)
+	result = StringUtil::Replace(result, "%fts_schema%", fts_schema);
+	result = StringUtil::Replace(result, "%input_schema%", input_schema);
+	result = StringUtil::Replace(result, "%input_table%", input_table);
+	result = StringUtil::Replace(result, "%input_id%", input_id);
+	result = StringUtil::Replace(result, "%stemmer%", stemmer);
+
+	return result;
+}
+
+string refresh_fts_index_query(ClientContext &context, const FunctionParameters &parameters) {
+	auto qname = QualifiedName::Parse(StringValue::Get(parameters.values[0]));
+	if (qname.schema == INVALID_SCHEMA) {
+		qname.schema = ClientData::Get(context).catalog_search_path->GetDefaultSchema(INVALID_CATALOG);
+	}
+	check_exists(context, qname);
+	string fts_schema = fts_schema_name(qname.schema, qname.name);
+
+	if (!Catalog::GetSchema(context, INVALID_CATALOG, fts_schema, true)) {
+		throw CatalogException(
+		    "a FTS index does not exist on table '%s.%s'. Create one with 'PRAGMA create_fts_index()'.", qname.schema,
+		    qname.name);
+	}
+
+	// the stemmer cannot be recovered from the index tables, so it must match the one supplied at build time
+	string stemmer = "porter";
+	auto stemmer_entry = parameters.named_parameters.find("stemmer");
+	if (stemmer_entry != parameters.named_parameters.end()) {
+		stemmer = StringValue::Get(stemmer_entry->second);
+	}
+
+	// positional parameters: the same document identifier and columns that were supplied at build time
+	auto doc_id = StringValue::Get(parameters.values[1]);
+	auto doc_values = doc_values_from_parameters(context, qname, parameters);
+
+	return refresh_script(qname.schema, qname.name, doc_id, doc_values, stemmer);
+}
+
 } // namespace duckdb
@@ -14,5 +14,6 @@ namespace duckdb {
 
 string drop_fts_index_query(ClientContext &context, const FunctionParameters &parameters);
 string create_fts_index_query(ClientContext &context, const FunctionParameters &parameters);
+string refresh_fts_index_query(ClientContext &context, const FunctionParameters &parameters);
 
 } // namespace duckdb
@@ -185,6 +185,29 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PostRequest(FileHandle &handle, stri
 	return RunRequestWithRetry(request, url, "POST", hfs.http_params);
 }
 
+unique_ptr<duckdb_httplib_openssl::Client> HTTPFileSystem::CheckOutClient(const HTTPParams &http_params,
+                                                                           const string &proto_host_port) {
+	{
+		lock_guard<mutex> lck(client_pool_lock);
+		auto entry = client_pool.find(proto_host_port);
+		if (entry != client_pool.end() && !entry->second.empty()) {
+			auto client = std::move(entry->second.back());
+			entry->second.pop_back();
+			return client;
+		}
+	}
+	// no idle client for this host: set up a new connection
+	return GetClient(http_params, proto_host_port.c_str());
+}
+
+void HTTPFileSystem::CheckInClient(const string &proto_host_port, unique_ptr<duckdb_httplib_openssl::Client> client) {
+	lock_guard<mutex> lck(client_pool_lock);
+	auto &pool = client_pool[proto_host_port];
+	if (pool.size() < MAX_POOLED_CLIENTS_PER_HOST) {
+		pool.push_back(std::move(client));
+	}
+}
+
 unique_ptr<duckdb_httplib_openssl::Client> HTTPFileSystem::GetClient(const HTTPParams &http_params,
                                                                      const char *proto_host_port) {
 	auto client = make_unique<duckdb_httplib_openssl::Client>(proto_host_port);
@@ -204,8 +227,10 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PutRequest(FileHandle &handle, strin
 	ParseUrl(url, path, proto_host_port);
 	auto headers = initialize_http_headers(header_map);
 
+	// PUT requests (e.g. the parts of a multipart upload) run concurrently over many handles: check out a keep-alive
+	// client from the pool instead of setting up a fresh connection for every request
+	auto client = CheckOutClient(hfs.http_params, proto_host_port);
 	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
-		auto client = GetClient(hfs.http_params, proto_host_port.c_str());
 		if (hfs.stats) {
 			hfs.stats->put_count++;
 			hfs.stats->total_bytes_sent += buffer_in_len;
@@ -213,7 +238,13 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PutRequest(FileHandle &handle, strin
 		return client->Put(path.c_str(), *headers, buffer_in, buffer_in_len, "application/octet-stream");
 	});
 
-	return RunRequestWithRetry(request, url, "PUT", hfs.http_params);
+	// the pooled connection may have gone stale: retry with a fresh one
+	std::function<void(void)> on_retry([&]() { client = GetClient(hfs.http_params, proto_host_port.c_str()); });
+
+	auto response = RunRequestWithRetry(request, url, "PUT", hfs.http_params, on_retry);
+	// only successful requests return their client to the pool; on an exception the connection is simply dropped
+	CheckInClient(proto_host_port, std::move(client));
+	return response;
 }
 
 unique_ptr<ResponseWrapper> HTTPFileSystem::HeadRequest(FileHandle &handle, string url, HeaderMap header_map) {
@@ -246,6 +277,11 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 	string range_expr = "bytes=" + to_string(file_offset) + "-" + to_string(file_offset + buffer_out_len - 1);
 	headers->insert(pair<string, string>("Range", range_expr));
 
+	// if we know the (strong) ETag of the file, guard the ranged read against concurrent modification
+	if (!hfs.etag.empty() && hfs.etag.front() == '"') {
+		headers->insert(pair<string, string>("If-Match", hfs.etag));
+	}
+
 	idx_t out_offset = 0;
 
 	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
@@ -257,6 +293,9 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 		    [&](const duckdb_httplib_openssl::Response &response) {
 			    if (response.status >= 400) {
 				    string error = "HTTP GET error on '" + url + "' (HTTP " + to_string(response.status) + ")";
+				    if (response.status == 412) {
+					    error += " The file was modified on the server since it was first opened (ETag mismatch).";
+				    }
 				    if (response.status == 416) {
 					    error += " This could mean the file was changed. Try disabling the duckdb http metadata cache "
 					             "if enabled, and confirm the server supports range requests.";
@@ -290,8 +329,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, string path, uint8_t flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), tail_start(0), metadata_cache(nullptr),
+      buffer_available(0), buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, const string &query_param, uint8_t flags,
@@ -336,6 +375,16 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 		throw IOException("out of file");
 	}
 
+	// Serve the read from the cached file tail (typically a Parquet footer) if it is fully contained in it
+	if (hfh.tail_data && location >= hfh.tail_start &&
+	    location + to_read <= hfh.tail_start + hfh.tail_data->size()) {
+		memcpy(buffer, hfh.tail_data->data() + (location - hfh.tail_start), to_read);
+		hfh.buffer_available = 0;
+		hfh.buffer_idx = 0;
+		hfh.file_offset = location + nr_bytes;
+		return;
+	}
+
 	// Don't buffer when DirectIO is set.
 	if (hfh.flags & FileFlags::FILE_FLAGS_DIRECT_IO && to_read > 0) {
 		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
@@ -387,6 +436,15 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
 				hfh.buffer_end = hfh.buffer_start + new_buffer_available;
+				if (hfh.metadata_cache && hfh.buffer_end == hfh.length &&
+				    (!hfh.tail_data || new_buffer_available > hfh.tail_data->size())) {
+					// we just read up to the end of the file: publish the tail (typically a Parquet footer) to the
+					// metadata cache so later handles for this URL skip these round-trips entirely
+					hfh.tail_start = hfh.buffer_start;
+					hfh.tail_data = make_shared<string>((const char *)hfh.read_buffer.get(), new_buffer_available);
+					hfh.metadata_cache->Insert(
+					    hfh.path, {hfh.length, hfh.last_modified, hfh.etag, hfh.tail_start, hfh.tail_data});
+				}
 			}
 		}
 	}
@@ -481,6 +539,7 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 
 	bool should_write_cache = false;
 	if (current_cache && !(flags & FileFlags::FILE_FLAGS_WRITE)) {
+		metadata_cache = current_cache;
 
 		HTTPMetadataCacheEntry value;
 		bool found = current_cache->Find(path, value);
@@ -488,6 +547,9 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
+			tail_start = value.tail_start;
+			tail_data = value.tail_data;
 
 			if (flags & FileFlags::FILE_FLAGS_READ) {
 				read_buffer = unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
@@ -525,6 +587,7 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 	}
 
 	length = atoll(res->headers["Content-Length"].c_str());
+	etag = res->headers["ETag"];
 
 	if (!res->headers["Last-Modified"].empty()) {
 		auto result = StrpTimeFormat::Parse("%a, %d %h %Y %T %Z", res->headers["Last-Modified"]);
@@ -541,7 +604,7 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 	}
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag, tail_start, tail_data});
 	}
 }
 
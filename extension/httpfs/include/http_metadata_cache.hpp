@@ -17,6 +17,11 @@ namespace duckdb {
 struct HTTPMetadataCacheEntry {
 	idx_t length;
 	time_t last_modified;
+	//! The ETag the server reported for the file (if any)
+	string etag;
+	//! Cached tail of the file (typically a Parquet footer), so repeated metadata reads skip the round-trips
+	idx_t tail_start;
+	shared_ptr<const string> tail_data;
 };
 
 // Simple cache with a max age for an entry to be valid
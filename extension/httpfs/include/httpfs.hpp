@@ -1,6 +1,7 @@
 #pragma once
 
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
@@ -55,6 +56,13 @@ public:
 	uint8_t flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
+
+	// Cached tail of the file (if any), shared through the metadata cache across handles for the same URL
+	idx_t tail_start;
+	shared_ptr<const string> tail_data;
+	// The metadata cache the tail is published to, if metadata caching is enabled
+	HTTPMetadataCache *metadata_cache;
 
 	// Read info
 	idx_t buffer_available;
@@ -81,6 +89,11 @@ class HTTPFileSystem : public FileSystem {
 public:
 	static unique_ptr<duckdb_httplib_openssl::Client> GetClient(const HTTPParams &http_params,
 	                                                            const char *proto_host_port);
+	//! Checks out a client for the given host, reusing a pooled keep-alive connection when one is available
+	unique_ptr<duckdb_httplib_openssl::Client> CheckOutClient(const HTTPParams &http_params,
+	                                                          const string &proto_host_port);
+	//! Returns a client to the pool so later requests to the same host reuse its connection
+	void CheckInClient(const string &proto_host_port, unique_ptr<duckdb_httplib_openssl::Client> client);
 	static void ParseUrl(string &url, string &path_out, string &proto_host_port_out);
 	unique_ptr<FileHandle> OpenFile(const string &path, uint8_t flags, FileLockType lock = DEFAULT_LOCK,
 	                                FileCompressionType compression = DEFAULT_COMPRESSION,
@@ -132,6 +145,15 @@ protected:
 	virtual unique_ptr<HTTPFileHandle> CreateHandle(const string &path, const string &query_param, uint8_t flags,
 	                                                FileLockType lock, FileCompressionType compression,
 	                                                FileOpener *opener);
+
+private:
+	//! We keep at most this many idle clients per host; any more are dropped, closing their connection
+	constexpr static idx_t MAX_POOLED_CLIENTS_PER_HOST = 64;
+
+	//! Idle keep-alive clients per host, reused by concurrent upload threads to avoid paying connection setup
+	//! (TCP + TLS handshakes) for every request
+	mutex client_pool_lock;
+	unordered_map<string, vector<unique_ptr<duckdb_httplib_openssl::Client>>> client_pool;
 };
 
 } // namespace duckdb
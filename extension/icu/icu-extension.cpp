@@ -82,29 +82,20 @@ static int32_t ICUGetSortKey(icu::Collator &collator, string_t input, unique_ptr
 }
 
 static void ICUCollateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
-	const char HEX_TABLE[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-
 	auto &func_expr = (BoundFunctionExpression &)state.expr;
 	auto &info = (IcuBindData &)*func_expr.bind_info;
 	auto &collator = *info.collator;
 
-	unique_ptr<char[]> buffer;
-	int32_t buffer_size = 0;
+	// sort keys are usually short: start out with a buffer that fits most of them to avoid computing keys twice
+	int32_t buffer_size = 64;
+	auto buffer = unique_ptr<char[]>(new char[buffer_size]);
 	UnaryExecutor::Execute<string_t, string_t>(args.data[0], result, args.size(), [&](string_t input) {
 		// create a sort key from the string
 		const auto string_size = idx_t(ICUGetSortKey(collator, input, buffer, buffer_size));
-		// convert the sort key to hexadecimal
-		auto str_result = StringVector::EmptyString(result, (string_size - 1) * 2);
-		auto str_data = str_result.GetDataWriteable();
-		for (idx_t i = 0; i < string_size - 1; i++) {
-			uint8_t byte = uint8_t(buffer[i]);
-			D_ASSERT(byte != 0);
-			str_data[i * 2] = HEX_TABLE[byte / 16];
-			str_data[i * 2 + 1] = HEX_TABLE[byte % 16];
-		}
-		str_result.Finalize();
-		// printf("%s: %s\n", input.GetString().c_str(), str_result.GetString().c_str());
-		return str_result;
+		// the raw sort key (without the terminator) compares and hashes like the collated string, at half the size
+		// of its hexadecimal representation
+		D_ASSERT(string_size > 0);
+		return StringVector::AddStringOrBlob(result, buffer.get(), string_size - 1);
 	});
 }
 
@@ -58,6 +58,11 @@ public:
 	JSONAllocator json_allocator;
 };
 
+//! Entry point into the JSON transform machinery, transforming JSON values directly into a (typed) result vector
+struct JSONTransform {
+	static void Transform(yyjson_val *vals[], yyjson_alc *alc, Vector &result, const idx_t count, bool strict);
+};
+
 class JSONFunctions {
 public:
 	static vector<CreateScalarFunctionInfo> GetScalarFunctions();
@@ -97,6 +102,8 @@ private:
 	// Table functions
 	static CreateTableFunctionInfo GetReadJSONObjectsFunction();
 	static CreateTableFunctionInfo GetReadNDJSONObjectsFunction();
+	static CreateTableFunctionInfo GetReadJSONFunction();
+	static CreateTableFunctionInfo GetReadNDJSONFunction();
 };
 
 } // namespace duckdb
@@ -103,6 +103,7 @@ public:
 	                                                GlobalTableFunctionState *global_state);
 	idx_t ReadNext(JSONScanGlobalState &gstate);
 	idx_t GetBatchIndex() const;
+	yyjson_alc *GetAllocator();
 
 	JSONLine lines[STANDARD_VECTOR_SIZE];
 	yyjson_doc *objects[STANDARD_VECTOR_SIZE];
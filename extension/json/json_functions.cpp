@@ -149,6 +149,10 @@ vector<CreateTableFunctionInfo> JSONFunctions::GetTableFunctions() {
 	functions.push_back(GetReadJSONObjectsFunction());
 	functions.push_back(GetReadNDJSONObjectsFunction());
 
+	// Reads JSON as columns
+	functions.push_back(GetReadJSONFunction());
+	functions.push_back(GetReadNDJSONFunction());
+
 	return functions;
 }
 
@@ -368,6 +368,10 @@ static void Transform(yyjson_val *vals[], yyjson_alc *alc, Vector &result, const
 	}
 }
 
+void JSONTransform::Transform(yyjson_val *vals[], yyjson_alc *alc, Vector &result, const idx_t count, bool strict) {
+	duckdb::Transform(vals, alc, result, count, strict);
+}
+
 template <bool strict>
 static void TransformFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto &lstate = JSONFunctionLocalState::ResetAndGet(state);
@@ -0,0 +1,141 @@
+#include "json_common.hpp"
+#include "json_functions.hpp"
+#include "json_scan.hpp"
+
+namespace duckdb {
+
+struct ReadJSONData : public JSONScanData {
+public:
+	ReadJSONData() {
+	}
+
+	void Serialize(FieldWriter &writer) {
+		JSONScanData::Serialize(writer);
+		writer.WriteList<string>(names);
+		writer.WriteRegularSerializableList<LogicalType>(types);
+	}
+
+	void Deserialize(FieldReader &reader) {
+		JSONScanData::Deserialize(reader);
+		names = reader.ReadRequiredList<string>();
+		types = reader.ReadRequiredSerializableList<LogicalType, LogicalType>();
+	}
+
+public:
+	//! The names and types of the columns to emit
+	vector<string> names;
+	vector<LogicalType> types;
+};
+
+unique_ptr<FunctionData> ReadJSONBind(ClientContext &context, TableFunctionBindInput &input,
+                                      vector<LogicalType> &return_types, vector<string> &names) {
+	// Bind the file paths and scan options, then transfer them into our bind data
+	auto base_data = JSONScanData::Bind(context, input);
+	auto result = make_unique<ReadJSONData>();
+	(JSONScanData &)*result = std::move((JSONScanData &)*base_data);
+
+	// The "columns" parameter tells us what to emit: a struct mapping column names to type strings
+	auto columns_it = input.named_parameters.find("columns");
+	if (columns_it == input.named_parameters.end()) {
+		throw BinderException("read_json \"columns\" parameter is required");
+	}
+	const auto &columns = columns_it->second;
+	const auto &columns_type = columns.type();
+	if (columns_type.id() != LogicalTypeId::STRUCT) {
+		throw BinderException("read_json \"columns\" parameter requires a struct as input");
+	}
+	auto &struct_children = StructValue::GetChildren(columns);
+	D_ASSERT(StructType::GetChildCount(columns_type) == struct_children.size());
+	for (idx_t child_idx = 0; child_idx < struct_children.size(); child_idx++) {
+		auto &name = StructType::GetChildName(columns_type, child_idx);
+		auto &child = struct_children[child_idx];
+		if (child.type().id() != LogicalTypeId::VARCHAR) {
+			throw BinderException("read_json \"columns\" parameter type specification must be VARCHAR");
+		}
+		result->names.emplace_back(name);
+		result->types.emplace_back(TransformStringToLogicalType(StringValue::Get(child), context));
+	}
+	if (result->names.empty()) {
+		throw BinderException("read_json \"columns\" parameter needs at least one column");
+	}
+
+	names = result->names;
+	return_types = result->types;
+	return std::move(result);
+}
+
+static void ReadJSONFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &gstate = (JSONScanGlobalState &)*data_p.global_state;
+	auto &lstate = (JSONScanLocalState &)*data_p.local_state;
+	auto &bind_data = (ReadJSONData &)gstate.bind_data;
+
+	// Fetch next objects
+	const auto count = lstate.ReadNext(gstate);
+	const auto objects = lstate.objects;
+	output.SetCardinality(count);
+	if (count == 0) {
+		return;
+	}
+
+	// Get the root values of the documents (NULL for rows that failed to parse)
+	yyjson_val *roots[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < count; i++) {
+		roots[i] = objects[i] ? yyjson_doc_get_root(objects[i]) : nullptr;
+	}
+
+	// Transform the documents directly into the output vectors, column by column
+	auto alc = lstate.GetAllocator();
+	yyjson_val *vals[STANDARD_VECTOR_SIZE];
+	for (idx_t col_idx = 0; col_idx < bind_data.names.size(); col_idx++) {
+		const auto &name = bind_data.names[col_idx];
+		auto name_ptr = name.c_str();
+		auto name_len = name.size();
+		for (idx_t i = 0; i < count; i++) {
+			vals[i] = yyjson_obj_getn(roots[i], name_ptr, name_len);
+		}
+		JSONTransform::Transform(vals, alc, output.data[col_idx], count, false);
+	}
+}
+
+static void ReadJSONSerialize(FieldWriter &writer, const FunctionData *bind_data_p, const TableFunction &function) {
+	auto &bind_data = (ReadJSONData &)*bind_data_p;
+	bind_data.Serialize(writer);
+}
+
+static unique_ptr<FunctionData> ReadJSONDeserialize(ClientContext &context, FieldReader &reader,
+                                                    TableFunction &function) {
+	auto result = make_unique<ReadJSONData>();
+	result->Deserialize(reader);
+	return std::move(result);
+}
+
+TableFunction GetReadJSONTableFunction(bool list_parameter, shared_ptr<JSONScanInfo> function_info) {
+	auto parameter = list_parameter ? LogicalType::LIST(LogicalType::VARCHAR) : LogicalType::VARCHAR;
+	TableFunction table_function({parameter}, ReadJSONFunction, ReadJSONBind, JSONScanGlobalState::Init,
+	                             JSONScanLocalState::Init);
+	JSONScan::TableFunctionDefaults(table_function);
+	table_function.named_parameters["columns"] = LogicalType::ANY;
+	table_function.serialize = ReadJSONSerialize;
+	table_function.deserialize = ReadJSONDeserialize;
+	table_function.function_info = std::move(function_info);
+
+	return table_function;
+}
+
+CreateTableFunctionInfo JSONFunctions::GetReadJSONFunction() {
+	TableFunctionSet function_set("read_json");
+	auto function_info = make_shared<JSONScanInfo>(JSONFormat::UNSTRUCTURED, false);
+	function_set.AddFunction(GetReadJSONTableFunction(false, function_info));
+	function_set.AddFunction(GetReadJSONTableFunction(true, function_info));
+	return CreateTableFunctionInfo(function_set);
+}
+
+CreateTableFunctionInfo JSONFunctions::GetReadNDJSONFunction() {
+	TableFunctionSet function_set("read_ndjson");
+	auto function_info = make_shared<JSONScanInfo>(JSONFormat::NEWLINE_DELIMITED, false);
+	function_set.AddFunction(GetReadJSONTableFunction(false, function_info));
+	function_set.AddFunction(GetReadJSONTableFunction(true, function_info));
+	return CreateTableFunctionInfo(function_set);
+}
+
+} // namespace duckdb
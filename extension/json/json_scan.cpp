@@ -498,4 +498,8 @@ idx_t JSONScanLocalState::GetBatchIndex() const {
 	return batch_index;
 }
 
+yyjson_alc *JSONScanLocalState::GetAllocator() {
+	return json_allocator.GetYYJSONAllocator();
+}
+
 } // namespace duckdb
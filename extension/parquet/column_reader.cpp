@@ -1,4 +1,5 @@
 #include "column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_timestamp.hpp"
 #include "utf8proc_wrapper.hpp"
 #include "parquet_reader.hpp"
@@ -23,6 +24,9 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
 #endif
 
 namespace duckdb {
@@ -127,6 +131,175 @@ unique_ptr<BaseStatistics> ColumnReader::Stats(idx_t row_group_idx_p, const std:
 	return ParquetStatisticsUtils::TransformColumnStatistics(Schema(), Type(), columns[file_idx]);
 }
 
+static bool ChunkIsFullyDictionaryEncoded(const ColumnChunk &chunk) {
+	auto &meta_data = chunk.meta_data;
+	if (!meta_data.__isset.dictionary_page_offset || meta_data.dictionary_page_offset < 4) {
+		return false;
+	}
+	if (!meta_data.__isset.encoding_stats) {
+		// without the page encoding stats we cannot tell whether the dictionary covers all data pages
+		return false;
+	}
+	for (auto &encoding_stat : meta_data.encoding_stats) {
+		if (encoding_stat.page_type != PageType::DATA_PAGE && encoding_stat.page_type != PageType::DATA_PAGE_V2) {
+			continue;
+		}
+		if (encoding_stat.encoding != Encoding::PLAIN_DICTIONARY &&
+		    encoding_stat.encoding != Encoding::RLE_DICTIONARY) {
+			// a data page fell back to plain encoding, e.g., because the dictionary grew too large
+			return false;
+		}
+	}
+	return true;
+}
+
+static void CollectEqualityConstants(TableFilter &filter, vector<const Value *> &constants) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = (ConstantFilter &)filter;
+		if (constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL) {
+			constants.push_back(&constant_filter.constant);
+		}
+		break;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = (ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			CollectEqualityConstants(*child_filter, constants);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+//! Computes the Bloom filter hash of the plain encoding of a constant; restricted to the cases where the encoding
+//! the writer applied to the column's values can be reproduced exactly from the constant
+static bool TryGetBloomFilterHash(const Value &constant, duckdb_parquet::format::Type::type physical_type,
+                                  uint64_t &hash) {
+	switch (physical_type) {
+	case Type::BYTE_ARRAY: {
+		if (constant.type().InternalType() != PhysicalType::VARCHAR) {
+			return false;
+		}
+		auto &str = StringValue::Get(constant);
+		hash = ParquetBloomFilter::HashBytes((const_data_ptr_t)str.data(), str.size());
+		return true;
+	}
+	case Type::INT32: {
+		int32_t value;
+		switch (constant.type().id()) {
+		case LogicalTypeId::TINYINT:
+			value = constant.GetValueUnsafe<int8_t>();
+			break;
+		case LogicalTypeId::SMALLINT:
+			value = constant.GetValueUnsafe<int16_t>();
+			break;
+		case LogicalTypeId::INTEGER:
+			value = constant.GetValueUnsafe<int32_t>();
+			break;
+		case LogicalTypeId::UTINYINT:
+			value = (int32_t)constant.GetValueUnsafe<uint8_t>();
+			break;
+		case LogicalTypeId::USMALLINT:
+			value = (int32_t)constant.GetValueUnsafe<uint16_t>();
+			break;
+		case LogicalTypeId::UINTEGER:
+			value = (int32_t)constant.GetValueUnsafe<uint32_t>();
+			break;
+		case LogicalTypeId::DATE:
+			value = constant.GetValueUnsafe<date_t>().days;
+			break;
+		default:
+			return false;
+		}
+		hash = ParquetBloomFilter::HashBytes((const_data_ptr_t)&value, sizeof(int32_t));
+		return true;
+	}
+	case Type::INT64: {
+		int64_t value;
+		switch (constant.type().id()) {
+		case LogicalTypeId::BIGINT:
+			value = constant.GetValueUnsafe<int64_t>();
+			break;
+		case LogicalTypeId::UBIGINT:
+			value = (int64_t)constant.GetValueUnsafe<uint64_t>();
+			break;
+		default:
+			// timestamps and times are excluded: their plain encoding depends on the unit the writer chose
+			return false;
+		}
+		hash = ParquetBloomFilter::HashBytes((const_data_ptr_t)&value, sizeof(int64_t));
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ColumnReader::BloomFilterPrune(TableFilter &filter) {
+	if (!chunk || !chunk->meta_data.__isset.bloom_filter_offset || chunk->meta_data.bloom_filter_offset < 4) {
+		return false;
+	}
+	vector<const Value *> constants;
+	CollectEqualityConstants(filter, constants);
+	if (constants.empty()) {
+		return false;
+	}
+	vector<uint64_t> hashes;
+	for (auto &constant : constants) {
+		uint64_t hash;
+		if (TryGetBloomFilterHash(*constant, chunk->meta_data.type, hash)) {
+			hashes.push_back(hash);
+		}
+	}
+	if (hashes.empty()) {
+		return false;
+	}
+	auto &trans = (ThriftFileTransport &)*protocol->getTransport();
+	trans.SetLocation(chunk->meta_data.bloom_filter_offset);
+	ParquetBloomFilter bloom_filter;
+	if (!bloom_filter.Read(*protocol)) {
+		return false;
+	}
+	for (auto &hash : hashes) {
+		if (!bloom_filter.ContainsHash(hash)) {
+			// a value the filter requires is definitely not in this chunk: no row can match
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ColumnReader::DictionaryFilterPrune(TableFilter &filter) {
+	if (!chunk || !ChunkIsFullyDictionaryEncoded(*chunk)) {
+		return false;
+	}
+	vector<const Value *> constants;
+	CollectEqualityConstants(filter, constants);
+	if (constants.empty()) {
+		return false;
+	}
+	// read the dictionary page so we can probe it; scanning continues with the data pages that follow it
+	auto &trans = (ThriftFileTransport &)*protocol->getTransport();
+	trans.SetLocation(chunk_read_offset);
+	PrepareRead(none_filter);
+	chunk_read_offset = trans.GetLocation();
+	for (auto &constant : constants) {
+		if (!HasDictionaryEntry(*constant)) {
+			// the filter requires a value that does not occur anywhere in this chunk: no row can match
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ColumnReader::HasDictionaryEntry(const Value &constant) { // NOLINT
+	// we cannot probe the dictionary of this reader: assume the value is present
+	return true;
+}
+
 void ColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, // NOLINT
                          parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Plain");
@@ -549,6 +722,7 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 
 void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) {
 	dict = std::move(data);
+	dict_count = num_entries;
 	dict_strings = unique_ptr<string_t[]>(new string_t[num_entries]);
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
@@ -567,6 +741,20 @@ void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num
 	}
 }
 
+bool StringColumnReader::HasDictionaryEntry(const Value &constant) {
+	if (!dict_strings || dict_count == 0 || constant.type().id() != LogicalTypeId::VARCHAR) {
+		return true;
+	}
+	auto &probe = StringValue::Get(constant);
+	for (idx_t dict_idx = 0; dict_idx < dict_count; dict_idx++) {
+		auto &dict_str = dict_strings[dict_idx];
+		if (dict_str.GetSize() == probe.size() && memcmp(dict_str.GetDataUnsafe(), probe.c_str(), probe.size()) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
 static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, ResizeableBuffer &buffer, idx_t &value_count) {
 	auto decoder = make_unique<DbpDecoder>((const uint8_t *)buffer.ptr, buffer.len);
 	value_count = decoder->TotalValues();
@@ -1092,6 +1280,7 @@ protected:
 			dict_ptr[i] =
 			    DecimalParquetValueConversion<DUCKDB_PHYSICAL_TYPE, FIXED_LENGTH>::PlainRead(*dictionary_data, *this);
 		}
+		this->dict_count = num_entries;
 	}
 };
 
@@ -1182,6 +1371,7 @@ protected:
 		for (idx_t i = 0; i < num_entries; i++) {
 			dict_ptr[i] = UUIDValueConversion::PlainRead(*dictionary_data, *this);
 		}
+		dict_count = num_entries;
 	}
 };
 
@@ -1233,6 +1423,7 @@ protected:
 		for (idx_t i = 0; i < num_entries; i++) {
 			dict_ptr[i] = IntervalValueConversion::PlainRead(*dictionary_data, *this);
 		}
+		dict_count = num_entries;
 	}
 };
 
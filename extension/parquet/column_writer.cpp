@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -18,6 +19,7 @@
 #include "duckdb/common/types/string_heap.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #endif
 
 #include "miniz_wrapper.hpp"
@@ -315,6 +317,8 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The distinct XXH64 hashes of the written values (only tracked when Bloom filters are enabled)
+	unordered_set<uint64_t> bloom_filter_hashes;
 };
 
 //===--------------------------------------------------------------------===//
@@ -384,6 +388,16 @@ protected:
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+
+	//! Whether this writer can build a Parquet Bloom filter over its values
+	virtual bool SupportsBloomFilter() {
+		return false;
+	}
+	//! Adds the XXH64 hashes of the plain-encoded values of a vector to the write state
+	virtual void CollectBloomFilterHashes(BasicColumnWriterState &state, Vector &vector, idx_t count) {
+	}
+	//! Builds the Bloom filter from the collected hashes and appends it to the file
+	void WriteBloomFilter(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group,
@@ -577,6 +591,10 @@ idx_t BasicColumnWriter::GetRowSize(Vector &vector, idx_t index, BasicColumnWrit
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = (BasicColumnWriterState &)state_p;
 
+	if (writer.EnableBloomFilters() && SupportsBloomFilter()) {
+		CollectBloomFilterHashes(state, vector, count);
+	}
+
 	idx_t remaining = count;
 	idx_t offset = 0;
 	while (remaining > 0) {
@@ -675,6 +693,23 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (!state.bloom_filter_hashes.empty()) {
+		WriteBloomFilter(state, column_chunk);
+	}
+}
+
+void BasicColumnWriter::WriteBloomFilter(BasicColumnWriterState &state,
+                                         duckdb_parquet::format::ColumnChunk &column_chunk) {
+	ParquetBloomFilter bloom_filter(state.bloom_filter_hashes.size(), ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+	for (auto &hash : state.bloom_filter_hashes) {
+		bloom_filter.InsertHash(hash);
+	}
+	auto &column_writer = writer.GetWriter();
+	column_chunk.meta_data.bloom_filter_offset = column_writer.GetTotalWritten();
+	column_chunk.meta_data.__isset.bloom_filter_offset = true;
+	bloom_filter.WriteHeader(*writer.GetProtocol());
+	column_writer.WriteData(bloom_filter.GetData(), bloom_filter.GetDataSize());
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -837,6 +872,25 @@ public:
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(TGT);
 	}
+
+	bool SupportsBloomFilter() override {
+		// hashes are computed over the plain encoding: only the physical types whose plain encoding the spec defines
+		// Bloom filter hashing for (4- and 8-byte little-endian integers) are supported here
+		return std::is_same<TGT, int32_t>::value || std::is_same<TGT, int64_t>::value;
+	}
+
+	void CollectBloomFilterHashes(BasicColumnWriterState &state, Vector &vector, idx_t count) override {
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			state.bloom_filter_hashes.insert(
+			    ParquetBloomFilter::HashBytes((const_data_ptr_t)&target_value, sizeof(TGT)));
+		}
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -1415,6 +1469,22 @@ public:
 			return strings[index].GetSize();
 		}
 	}
+
+	bool SupportsBloomFilter() override {
+		return true;
+	}
+
+	void CollectBloomFilterHashes(BasicColumnWriterState &state, Vector &vector, idx_t count) override {
+		auto &mask = FlatVector::Validity(vector);
+		auto *strings = FlatVector::GetData<string_t>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			state.bloom_filter_hashes.insert(
+			    ParquetBloomFilter::HashBytes((const_data_ptr_t)strings[r].GetDataUnsafe(), strings[r].GetSize()));
+		}
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -38,6 +38,7 @@ protected:
 		for (idx_t i = 0; i < num_entries; i++) {
 			dict_ptr[i] = FUNC(dictionary_data->read<PARQUET_PHYSICAL_TYPE>());
 		}
+		this->dict_count = num_entries;
 	}
 };
 
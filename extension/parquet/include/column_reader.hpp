@@ -29,6 +29,7 @@
 
 namespace duckdb {
 class ParquetReader;
+class TableFilter;
 
 using duckdb_apache::thrift::protocol::TProtocol;
 
@@ -73,11 +74,26 @@ public:
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns);
 
+	//! Whether a pushed-down filter can be ruled out entirely because a required equality constant is definitely
+	//! absent from the chunk's Bloom filter (if the writer emitted one); only reads the filter, no data pages
+	bool BloomFilterPrune(TableFilter &filter);
+
+	//! Whether a pushed-down filter can be ruled out entirely because the chunk is fully dictionary-encoded and a
+	//! required equality constant does not occur in the dictionary; reads the dictionary page to probe it
+	bool DictionaryFilterPrune(TableFilter &filter);
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 		auto result_ptr = FlatVector::GetData<VALUE_TYPE>(result);
 		auto &result_mask = FlatVector::Validity(result);
+		if (!HasDefines() && filter.all()) {
+			// Fast path for fully-defined, unfiltered reads
+			for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+				result_ptr[row_idx + result_offset] = CONVERSION::PlainRead(*plain_data, *this);
+			}
+			return;
+		}
 		for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
 			if (HasDefines() && defines[row_idx + result_offset] != max_define) {
 				result_mask.SetInvalid(row_idx + result_offset);
@@ -101,6 +117,9 @@ protected:
 	virtual void Offsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, parquet_filter_t &filter,
 	                     idx_t result_offset, Vector &result);
 
+	//! Whether the given constant occurs in the dictionary of this chunk; conservatively true when we cannot tell
+	virtual bool HasDictionaryEntry(const Value &constant);
+
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
 	virtual void PlainReference(shared_ptr<ByteBuffer>, Vector &result);
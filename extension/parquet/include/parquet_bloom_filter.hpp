@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/common.hpp"
+#endif
+#include "thrift/protocol/TProtocol.h"
+
+namespace duckdb {
+
+//! A Parquet split-block Bloom filter. Values are hashed with XXH64 over their plain encoding; each hash sets/tests
+//! one bit in each of the eight 32-bit words of a single 256-bit block.
+class ParquetBloomFilter {
+public:
+	//! The false-positive ratio filters are sized for when writing
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+	//! The number of 32-bit words in a block
+	static constexpr const idx_t BLOCK_WORDS = 8;
+	//! The maximum number of blocks in a single filter (16MB worth of blocks)
+	static constexpr const idx_t MAX_BLOCK_COUNT = 512 * 1024;
+
+public:
+	//! Creates an empty filter sized for the given number of distinct values
+	ParquetBloomFilter(idx_t distinct_count, double false_positive_ratio);
+	//! Creates an unsized filter to be populated by Read
+	ParquetBloomFilter() {
+	}
+
+	void InsertHash(uint64_t hash);
+	bool ContainsHash(uint64_t hash) const;
+
+	//! Hashes the plain-encoded representation of a value
+	static uint64_t HashBytes(const_data_ptr_t data, idx_t len);
+
+	//! Writes the thrift BloomFilterHeader; the filter data (GetData/GetDataSize) must directly follow it in the file
+	void WriteHeader(duckdb_apache::thrift::protocol::TProtocol &protocol) const;
+	//! Reads a filter (header and data); returns false if the filter uses an unsupported algorithm, hash or compression
+	bool Read(duckdb_apache::thrift::protocol::TProtocol &protocol);
+
+	const_data_ptr_t GetData() const {
+		return (const_data_ptr_t)data.data();
+	}
+	idx_t GetDataSize() const {
+		return data.size() * sizeof(uint32_t);
+	}
+
+private:
+	idx_t BlockIndex(uint64_t hash) const;
+
+private:
+	//! The filter data as 32-bit words, BLOCK_WORDS words per block
+	vector<uint32_t> data;
+	idx_t block_count = 0;
+};
+
+} // namespace duckdb
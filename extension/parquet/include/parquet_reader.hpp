@@ -62,6 +62,15 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+	//! Whether the prefetch of the current group also covered the row group that follows it
+	bool next_group_prefetched = false;
+
+	//! Row ranges of the current row group that can contain filter matches, derived from the page index of the
+	//! filtered columns; when not set every row of the group is a candidate
+	bool has_candidate_ranges = false;
+	vector<std::pair<idx_t, idx_t>> candidate_ranges;
+	//! Current position in the candidate ranges while scanning the group
+	idx_t candidate_range_idx = 0;
 };
 
 struct ParquetOptions {
@@ -127,6 +136,9 @@ public:
 	void InitializeScan(ParquetReaderScanState &state, vector<column_t> column_ids, vector<idx_t> groups_to_read,
 	                    TableFilterSet *table_filters);
 	void Scan(ParquetReaderScanState &state, DataChunk &output);
+	//! Issue a best-effort read-ahead hint to the file system for the given row group, so that its column chunks can
+	//! be read in the background while another row group is being decoded
+	void PrefetchGroupHint(idx_t group_idx);
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
@@ -149,9 +161,12 @@ private:
 	const duckdb_parquet::format::RowGroup &GetGroup(ParquetReaderScanState &state);
 	uint64_t GetGroupCompressedSize(ParquetReaderScanState &state);
 	idx_t GetGroupOffset(ParquetReaderScanState &state);
+	static idx_t GetGroupOffset(const duckdb_parquet::format::RowGroup &group);
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
+	static uint64_t GetGroupSpan(const duckdb_parquet::format::RowGroup &group);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	void ApplyPageIndexPruning(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 	void RearrangeChildReaders(unique_ptr<duckdb::ColumnReader> &root_reader, vector<column_t> &column_ids);
 
@@ -18,6 +18,10 @@ struct ParquetStatisticsUtils {
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const SchemaElement &s_ele, const LogicalType &type,
 	                                                            const ColumnChunk &column_chunk);
 
+	static unique_ptr<BaseStatistics> TransformColumnStatistics(const SchemaElement &s_ele, const LogicalType &type,
+	                                                            duckdb_parquet::format::Type::type physical_type,
+	                                                            const duckdb_parquet::format::Statistics &parquet_stats);
+
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
 };
@@ -22,13 +22,19 @@
 #include "thrift/protocol/TCompactProtocol.h"
 
 namespace duckdb {
+class ClientContext;
 class FileSystem;
 class FileOpener;
+class TaskScheduler;
+struct ParquetEncodeTaskState;
 
 class ParquetWriter {
+	friend struct ParquetEncodeTaskState;
+
 public:
-	ParquetWriter(FileSystem &fs, string file_name, FileOpener *file_opener, vector<LogicalType> types,
-	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec);
+	ParquetWriter(ClientContext &context, FileSystem &fs, string file_name, FileOpener *file_opener,
+	              vector<LogicalType> types, vector<string> names,
+	              duckdb_parquet::format::CompressionCodec::type codec, bool enable_bloom_filters);
 
 public:
 	void Flush(ColumnDataCollection &buffer);
@@ -49,12 +55,22 @@ public:
 	BufferedFileWriter &GetWriter() {
 		return *writer;
 	}
+	//! Whether Bloom filters should be written for the columns that support them
+	bool EnableBloomFilters() const {
+		return enable_bloom_filters;
+	}
+
+private:
+	//! Encode and compress a single column of the collection into the given write state
+	void EncodeColumn(ColumnDataCollection &buffer, ColumnWriterState &state, idx_t col_idx);
 
 private:
+	TaskScheduler &scheduler;
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec;
+	bool enable_bloom_filters;
 
 	unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
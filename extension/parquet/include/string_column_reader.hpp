@@ -38,6 +38,8 @@ public:
 	                    Vector &result) override;
 	uint32_t VerifyString(const char *str_data, uint32_t str_len);
 
+	bool HasDictionaryEntry(const Value &constant) override;
+
 protected:
 	void DictReference(Vector &result) override;
 	void PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) override;
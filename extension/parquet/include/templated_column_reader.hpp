@@ -36,6 +36,7 @@ public:
 	    : ColumnReader(reader, std::move(type_p), schema_p, schema_idx_p, max_define_p, max_repeat_p) {};
 
 	shared_ptr<ResizeableBuffer> dict;
+	idx_t dict_count = 0;
 
 public:
 	void AllocateDict(idx_t size) {
@@ -48,6 +49,32 @@ public:
 
 	void Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) override {
 		dict = std::move(data);
+		dict_count = num_entries;
+	}
+
+	bool HasDictionaryEntry(const Value &constant) override {
+		switch (Type().id()) {
+		case LogicalTypeId::BOOLEAN:
+		case LogicalTypeId::FLOAT:
+		case LogicalTypeId::DOUBLE:
+		case LogicalTypeId::INTERVAL:
+			// equality of these types is not bitwise equality of their in-memory representation
+			return true;
+		default:
+			break;
+		}
+		if (!dict || dict_count == 0 || constant.type() != Type()) {
+			return true;
+		}
+		auto probe = constant.GetValueUnsafe<VALUE_TYPE>();
+		for (idx_t dict_idx = 0; dict_idx < dict_count; dict_idx++) {
+			uint32_t offset = dict_idx;
+			VALUE_TYPE entry = VALUE_CONVERSION::DictRead(*dict, offset, *this);
+			if (memcmp(&entry, &probe, sizeof(VALUE_TYPE)) == 0) {
+				return true;
+			}
+		}
+		return false;
 	}
 
 	void Offsets(uint32_t *offsets, uint8_t *defines, uint64_t num_values, parquet_filter_t &filter,
@@ -55,6 +82,14 @@ public:
 		auto result_ptr = FlatVector::GetData<VALUE_TYPE>(result);
 		auto &result_mask = FlatVector::Validity(result);
 
+		if (!HasDefines() && filter.all()) {
+			// Fast path for fully-defined, unfiltered reads: a plain gather from the dictionary
+			for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+				result_ptr[row_idx + result_offset] = VALUE_CONVERSION::DictRead(*dict, offsets[row_idx], *this);
+			}
+			return;
+		}
+
 		idx_t offset_idx = 0;
 		for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
 			if (HasDefines() && defines[row_idx + result_offset] != max_define) {
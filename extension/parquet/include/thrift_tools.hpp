@@ -95,6 +95,19 @@ struct ReadAheadBuffer {
 		}
 	}
 
+	// Remove all read heads except those overlapping the given range
+	void ClearExcept(idx_t location, uint64_t size) {
+		for (auto it = read_heads.begin(); it != read_heads.end();) {
+			if (it->location < location + size && location < it->GetEnd()) {
+				++it;
+			} else {
+				total_size -= it->size;
+				it = read_heads.erase(it);
+			}
+		}
+		merge_set.clear();
+	}
+
 	// Returns the relevant read head
 	ReadHead *GetReadHead(idx_t pos) {
 		for (auto &read_head : read_heads) {
@@ -181,6 +194,11 @@ public:
 		ra_buffer.merge_set.clear();
 	}
 
+	// Clear all prefetched buffers except those overlapping the given range
+	void ClearPrefetch(idx_t keep_location, uint64_t keep_size) {
+		ra_buffer.ClearExcept(keep_location, keep_size);
+	}
+
 	void SetLocation(idx_t location_p) {
 		location = location_p;
 	}
@@ -88,6 +88,8 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	unique_ptr<mutex[]> file_mutexes;
 	//! Signal to other threads that a file failed to open, letting every thread abort.
 	bool error_opening_file = false;
+	//! The maximum number of files whose footers may be fetched ahead of the scan
+	static constexpr idx_t FILE_OPEN_READAHEAD = 8;
 
 	//! Index of file currently up for scanning
 	idx_t file_index;
@@ -114,6 +116,7 @@ struct ParquetWriteBindData : public TableFunctionData {
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec = duckdb_parquet::format::CompressionCodec::SNAPPY;
 	idx_t row_group_size = RowGroup::ROW_GROUP_SIZE;
+	bool enable_bloom_filters = false;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -601,6 +604,11 @@ public:
 				if (parallel_state.row_group_index <
 				    parallel_state.readers[parallel_state.file_index]->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
+					// Before claiming one, make sure the footers of the files ahead are being fetched, so that the
+					// scan does not stall on a metadata read whenever a file runs out of row groups
+					if (TryOpenNextFile(context, bind_data, scan_data, parallel_state, parallel_lock)) {
+						continue;
+					}
 					scan_data.reader = parallel_state.readers[parallel_state.file_index];
 					vector<idx_t> group_indexes {parallel_state.row_group_index};
 					scan_data.reader->InitializeScan(scan_data.scan_state, scan_data.column_ids, group_indexes,
@@ -608,6 +616,11 @@ public:
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
 					parallel_state.row_group_index++;
+					if (parallel_state.row_group_index < scan_data.reader->NumRowGroups()) {
+						// hint the row group that will be claimed next, so its reads can start in the background
+						// while the row group we just claimed is being decoded
+						scan_data.reader->PrefetchGroupHint(parallel_state.row_group_index);
+					}
 					return true;
 				} else {
 					// Set state to the next file
@@ -679,11 +692,14 @@ public:
 		}
 	}
 
-	//! Helper function that try to start opening a next file. Parallel lock should be locked when calling.
+	//! Helper function that tries to start opening the next unopened file within the readahead window, pipelining
+	//! footer reads ahead of the scan. Parallel lock should be locked when calling.
 	static bool TryOpenNextFile(ClientContext &context, const ParquetReadBindData &bind_data,
 	                            ParquetReadLocalState &scan_data, ParquetReadGlobalState &parallel_state,
 	                            unique_lock<mutex> &parallel_lock) {
-		for (idx_t i = parallel_state.file_index; i < bind_data.files.size(); i++) {
+		const auto file_open_limit = MinValue<idx_t>(
+		    bind_data.files.size(), parallel_state.file_index + ParquetReadGlobalState::FILE_OPEN_READAHEAD);
+		for (idx_t i = parallel_state.file_index; i < file_open_limit; i++) {
 			if (!parallel_state.readers[i] && parallel_state.file_opening[i] == false) {
 				string file = bind_data.files[i];
 				parallel_state.file_opening[i] = true;
@@ -742,6 +758,9 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyInfo &info
 				}
 			}
 			throw ParserException("Expected %s argument to be either [uncompressed, snappy, gzip or zstd]", loption);
+		} else if (loption == "bloom_filters") {
+			bind_data->enable_bloom_filters =
+			    option.second.empty() || option.second[0].CastAs(context, LogicalType::BOOLEAN).GetValue<bool>();
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -758,8 +777,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer =
-	    make_unique<ParquetWriter>(fs, file_path, FileSystem::GetFileOpener(context), parquet_bind.sql_types,
-	                               parquet_bind.column_names, parquet_bind.codec);
+	    make_unique<ParquetWriter>(context, fs, file_path, FileSystem::GetFileOpener(context), parquet_bind.sql_types,
+	                               parquet_bind.column_names, parquet_bind.codec, parquet_bind.enable_bloom_filters);
 	return std::move(global_state);
 }
 
@@ -0,0 +1,171 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+
+//! The salt constants of the split-block algorithm, as defined by the Parquet spec
+static constexpr const uint32_t BLOOM_SALT[ParquetBloomFilter::BLOCK_WORDS] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t distinct_count, double false_positive_ratio) {
+	// standard bloom filter sizing, rounded up to a power-of-two number of 256-bit blocks
+	auto bits_per_value = -std::log(false_positive_ratio) / (std::log(2.0) * std::log(2.0));
+	auto min_bits = (idx_t)std::ceil(bits_per_value * double(MaxValue<idx_t>(distinct_count, 1)));
+	block_count = NextPowerOfTwo((min_bits + 255) / 256);
+	block_count = MaxValue<idx_t>(MinValue<idx_t>(block_count, MAX_BLOCK_COUNT), 1);
+	data.resize(block_count * BLOCK_WORDS, 0);
+}
+
+idx_t ParquetBloomFilter::BlockIndex(uint64_t hash) const {
+	// the top 32 bits of the hash select the block, the bottom 32 bits select a bit in each of its words
+	return (idx_t)(((hash >> 32) * (uint64_t)block_count) >> 32);
+}
+
+void ParquetBloomFilter::InsertHash(uint64_t hash) {
+	auto block = data.data() + BlockIndex(hash) * BLOCK_WORDS;
+	auto x = (uint32_t)hash;
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		block[i] |= 1U << ((x * BLOOM_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::ContainsHash(uint64_t hash) const {
+	auto block = data.data() + BlockIndex(hash) * BLOCK_WORDS;
+	auto x = (uint32_t)hash;
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		if ((block[i] & (1U << ((x * BLOOM_SALT[i]) >> 27))) == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::HashBytes(const_data_ptr_t data, idx_t len) {
+	return duckdb_zstd::XXH64(data, len, 0);
+}
+
+//! Writes a union of empty structs with only the given variant (field id 1) set
+static void WriteEmptyUnionVariant(TProtocol &protocol, const char *union_name, const char *variant_name) {
+	protocol.writeStructBegin(union_name);
+	protocol.writeFieldBegin(variant_name, duckdb_apache::thrift::protocol::T_STRUCT, 1);
+	protocol.writeStructBegin(variant_name);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+}
+
+void ParquetBloomFilter::WriteHeader(TProtocol &protocol) const {
+	D_ASSERT(block_count > 0);
+	// the vendored thrift definitions predate Bloom filters, so the BloomFilterHeader struct is written by hand
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", duckdb_apache::thrift::protocol::T_I32, 1);
+	protocol.writeI32((int32_t)GetDataSize());
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("algorithm", duckdb_apache::thrift::protocol::T_STRUCT, 2);
+	WriteEmptyUnionVariant(protocol, "BloomFilterAlgorithm", "BLOCK");
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("hash", duckdb_apache::thrift::protocol::T_STRUCT, 3);
+	WriteEmptyUnionVariant(protocol, "BloomFilterHash", "XXHASH");
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("compression", duckdb_apache::thrift::protocol::T_STRUCT, 4);
+	WriteEmptyUnionVariant(protocol, "BloomFilterCompression", "UNCOMPRESSED");
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+}
+
+//! Reads a union of empty structs, returning the field id of the variant that is set (or -1 if there is none)
+static void ReadUnionVariantId(TProtocol &protocol, int16_t &variant_id) {
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+	variant_id = -1;
+	protocol.readStructBegin(fname);
+	while (true) {
+		protocol.readFieldBegin(fname, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		variant_id = fid;
+		protocol.skip(ftype);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+}
+
+bool ParquetBloomFilter::Read(TProtocol &protocol) {
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+	int32_t num_bytes = 0;
+	int16_t algorithm = -1;
+	int16_t hash = -1;
+	int16_t compression = -1;
+
+	protocol.readStructBegin(fname);
+	while (true) {
+		protocol.readFieldBegin(fname, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		switch (fid) {
+		case 1:
+			if (ftype == duckdb_apache::thrift::protocol::T_I32) {
+				protocol.readI32(num_bytes);
+			} else {
+				protocol.skip(ftype);
+			}
+			break;
+		case 2:
+			if (ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+				ReadUnionVariantId(protocol, algorithm);
+			} else {
+				protocol.skip(ftype);
+			}
+			break;
+		case 3:
+			if (ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+				ReadUnionVariantId(protocol, hash);
+			} else {
+				protocol.skip(ftype);
+			}
+			break;
+		case 4:
+			if (ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+				ReadUnionVariantId(protocol, compression);
+			} else {
+				protocol.skip(ftype);
+			}
+			break;
+		default:
+			protocol.skip(ftype);
+			break;
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+
+	// only uncompressed split-block XXH64 filters are supported (these are the only ones the spec defines)
+	if (algorithm != 1 || hash != 1 || compression != 1) {
+		return false;
+	}
+	const idx_t block_bytes = BLOCK_WORDS * sizeof(uint32_t);
+	if (num_bytes <= 0 || (idx_t)num_bytes % block_bytes != 0 ||
+	    (idx_t)num_bytes > MAX_BLOCK_COUNT * block_bytes) {
+		return false;
+	}
+	block_count = (idx_t)num_bytes / block_bytes;
+	data.resize(block_count * BLOCK_WORDS);
+	protocol.getTransport()->read((uint8_t *)data.data(), num_bytes);
+	return true;
+}
+
+} // namespace duckdb
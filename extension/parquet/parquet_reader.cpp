@@ -634,7 +634,10 @@ uint64_t ParquetReader::GetGroupCompressedSize(ParquetReaderScanState &state) {
 }
 
 uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+	return GetGroupSpan(GetGroup(state));
+}
+
+uint64_t ParquetReader::GetGroupSpan(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 	idx_t max_offset = NumericLimits<idx_t>::Minimum();
 
@@ -657,7 +660,10 @@ uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
 }
 
 idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+	return GetGroupOffset(GetGroup(state));
+}
+
+idx_t ParquetReader::GetGroupOffset(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 
 	for (auto &column_chunk : group.columns) {
@@ -673,6 +679,105 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
+void ParquetReader::PrefetchGroupHint(idx_t group_idx) {
+	auto file_meta_data = GetFileMetadata();
+	D_ASSERT(group_idx < file_meta_data->row_groups.size());
+	auto &group = file_meta_data->row_groups[group_idx];
+	if (group.columns.empty()) {
+		return;
+	}
+	file_handle->file_system.Prefetch(*file_handle, GetGroupOffset(group), GetGroupSpan(group));
+}
+
+//! Intersects two sorted lists of non-overlapping row ranges
+static vector<std::pair<idx_t, idx_t>> IntersectRowRanges(const vector<std::pair<idx_t, idx_t>> &lhs,
+                                                          const vector<std::pair<idx_t, idx_t>> &rhs) {
+	vector<std::pair<idx_t, idx_t>> result;
+	idx_t lhs_idx = 0;
+	idx_t rhs_idx = 0;
+	while (lhs_idx < lhs.size() && rhs_idx < rhs.size()) {
+		auto range_start = MaxValue<idx_t>(lhs[lhs_idx].first, rhs[rhs_idx].first);
+		auto range_end = MinValue<idx_t>(lhs[lhs_idx].second, rhs[rhs_idx].second);
+		if (range_start < range_end) {
+			result.emplace_back(range_start, range_end);
+		}
+		if (lhs[lhs_idx].second < rhs[rhs_idx].second) {
+			lhs_idx++;
+		} else {
+			rhs_idx++;
+		}
+	}
+	return result;
+}
+
+void ParquetReader::ApplyPageIndexPruning(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                          TableFilter &filter) {
+	auto &group = GetGroup(state);
+	if (column_reader.FileIdx() >= group.columns.size()) {
+		return;
+	}
+	auto &chunk = group.columns[column_reader.FileIdx()];
+	if (!chunk.__isset.column_index_offset || !chunk.__isset.offset_index_offset) {
+		// no page index was written for this column chunk
+		return;
+	}
+
+	auto &trans = (ThriftFileTransport &)*state.thrift_file_proto->getTransport();
+	duckdb_parquet::format::ColumnIndex column_index;
+	trans.SetLocation(chunk.column_index_offset);
+	column_index.read(state.thrift_file_proto.get());
+	duckdb_parquet::format::OffsetIndex offset_index;
+	trans.SetLocation(chunk.offset_index_offset);
+	offset_index.read(state.thrift_file_proto.get());
+
+	auto &page_locations = offset_index.page_locations;
+	const idx_t page_count = page_locations.size();
+	if (page_count == 0 || column_index.null_pages.size() != page_count ||
+	    column_index.min_values.size() != page_count || column_index.max_values.size() != page_count) {
+		return;
+	}
+
+	// collect the row ranges of the pages whose statistics cannot rule out the filter
+	vector<std::pair<idx_t, idx_t>> ranges;
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		auto row_start = (idx_t)page_locations[page_idx].first_row_index;
+		auto row_end =
+		    page_idx + 1 < page_count ? (idx_t)page_locations[page_idx + 1].first_row_index : (idx_t)group.num_rows;
+		bool candidate = true;
+		if (!column_index.null_pages[page_idx]) {
+			Statistics page_stats;
+			page_stats.__set_min_value(column_index.min_values[page_idx]);
+			page_stats.__set_max_value(column_index.max_values[page_idx]);
+			if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+				page_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			auto stats = ParquetStatisticsUtils::TransformColumnStatistics(
+			    column_reader.Schema(), column_reader.Type(), chunk.meta_data.type, page_stats);
+			if (stats && filter.CheckStatistics(*stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				candidate = false;
+			}
+		}
+		if (candidate) {
+			if (!ranges.empty() && ranges.back().second == row_start) {
+				ranges.back().second = row_end;
+			} else {
+				ranges.emplace_back(row_start, row_end);
+			}
+		}
+	}
+
+	if (!state.has_candidate_ranges) {
+		state.has_candidate_ranges = true;
+		state.candidate_ranges = std::move(ranges);
+	} else {
+		state.candidate_ranges = IntersectRowRanges(state.candidate_ranges, ranges);
+	}
+	if (state.candidate_ranges.empty()) {
+		// no page of this group can contain filter matches: skip the group entirely
+		state.group_offset = group.num_rows;
+	}
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx) {
 	auto &group = GetGroup(state);
 
@@ -695,11 +800,27 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t o
 				state.group_offset = group.num_rows;
 				return;
 			}
+			// the chunk statistics cannot rule out the filter, but the page index can still rule out individual pages
+			ApplyPageIndexPruning(state, *column_reader, filter);
+			if (state.group_offset == (idx_t)group.num_rows) {
+				return;
+			}
 		}
 	}
 
 	state.root_reader->InitializeRead(state.group_idx_list[state.current_group], group.columns,
 	                                  *state.thrift_file_proto);
+
+	if (state.filters) {
+		auto filter_entry = state.filters->filters.find(out_col_idx);
+		if (filter_entry != state.filters->filters.end() &&
+		    (column_reader->BloomFilterPrune(*filter_entry->second) ||
+		     column_reader->DictionaryFilterPrune(*filter_entry->second))) {
+			// an equality constant of the filter is absent from the chunk's Bloom filter or complete dictionary:
+			// skip the chunk without decoding its data pages
+			state.group_offset = group.num_rows;
+		}
+	}
 }
 
 idx_t ParquetReader::NumRows() {
@@ -964,16 +1085,29 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	if (state.current_group < 0 || (int64_t)state.group_offset >= GetGroup(state).num_rows) {
 		state.current_group++;
 		state.group_offset = 0;
+		state.has_candidate_ranges = false;
+		state.candidate_ranges.clear();
+		state.candidate_range_idx = 0;
 
 		auto &trans = (ThriftFileTransport &)*state.thrift_file_proto->getTransport();
-		trans.ClearPrefetch();
 		state.current_group_prefetched = false;
 
 		if ((idx_t)state.current_group == state.group_idx_list.size()) {
+			trans.ClearPrefetch();
 			state.finished = true;
 			return false;
 		}
 
+		if (state.next_group_prefetched) {
+			// the prefetch of the previous row group also covered this one: keep its buffer, drop everything else
+			auto &group = GetGroup(state);
+			trans.ClearPrefetch(GetGroupOffset(group), GetGroupSpan(group));
+			state.current_group_prefetched = true;
+		} else {
+			trans.ClearPrefetch();
+		}
+		state.next_group_prefetched = false;
+
 		uint64_t to_scan_compressed_bytes = 0;
 		for (idx_t out_col_idx = 0; out_col_idx < result.ColumnCount(); out_col_idx++) {
 			// this is a special case where we are not interested in the actual contents of the file
@@ -1006,7 +1140,25 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				if (!state.current_group_prefetched) {
 					auto total_compressed_size = GetGroupCompressedSize(state);
 					if (total_compressed_size > 0) {
-						trans.Prefetch(GetGroupOffset(state), total_row_group_span);
+						auto group_offset = GetGroupOffset(state);
+						trans.RegisterPrefetch(group_offset, total_row_group_span, true);
+						// when the next row group to scan directly follows this one in the file, fetch it in the
+						// same read: its data is then already buffered by the time we switch to it
+						if ((idx_t)state.current_group + 1 < state.group_idx_list.size()) {
+							auto &next_group =
+							    GetFileMetadata()->row_groups[state.group_idx_list[state.current_group + 1]];
+							if (!next_group.columns.empty()) {
+								auto next_offset = GetGroupOffset(next_group);
+								if (next_offset >= group_offset &&
+								    next_offset <=
+								        group_offset + total_row_group_span + ReadHeadComparator::ALLOW_GAP) {
+									trans.RegisterPrefetch(next_offset, GetGroupSpan(next_group), true);
+									state.next_group_prefetched = true;
+								}
+							}
+						}
+						trans.FinalizeRegistration();
+						trans.PrefetchRegistered();
 					}
 					state.current_group_prefetched = true;
 				}
@@ -1037,6 +1189,10 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				}
 			}
 		}
+		if ((idx_t)state.current_group + 1 < state.group_idx_list.size() && !state.next_group_prefetched) {
+			// let the file system start reading the next row group in the background while this one is decoded
+			PrefetchGroupHint(state.group_idx_list[state.current_group + 1]);
+		}
 		return true;
 	}
 
@@ -1067,6 +1223,22 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto root_reader = ((StructColumnReader *)state.root_reader.get());
 
 	if (state.filters) {
+		if (state.has_candidate_ranges) {
+			// mask out the rows that the page index proved cannot match the filters, so that whole pages worth of
+			// rows can be skipped instead of decoded and filtered
+			for (idx_t i = 0; i < this_output_chunk_rows; i++) {
+				const idx_t row_idx = state.group_offset + i;
+				while (state.candidate_range_idx < state.candidate_ranges.size() &&
+				       state.candidate_ranges[state.candidate_range_idx].second <= row_idx) {
+					state.candidate_range_idx++;
+				}
+				if (state.candidate_range_idx == state.candidate_ranges.size() ||
+				    row_idx < state.candidate_ranges[state.candidate_range_idx].first) {
+					filter_mask.set(i, false);
+				}
+			}
+		}
+
 		vector<bool> need_to_read(result.ColumnCount(), true);
 
 		for (idx_t col = 0; col < need_to_read.size(); ++col) {
@@ -204,7 +204,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformColumnStatistics(s_ele, type, column_chunk.meta_data.type, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformColumnStatistics(const SchemaElement &s_ele, const LogicalType &type,
+                                                  duckdb_parquet::format::Type::type physical_type,
+                                                  const duckdb_parquet::format::Statistics &parquet_stats) {
 	unique_ptr<BaseStatistics> row_group_stats;
 
 	switch (type.id()) {
@@ -255,8 +261,8 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 
 	// null count is generic
 	if (row_group_stats) {
-		if (column_chunk.meta_data.type == duckdb_parquet::format::Type::FLOAT ||
-		    column_chunk.meta_data.type == duckdb_parquet::format::Type::DOUBLE) {
+		if (physical_type == duckdb_parquet::format::Type::FLOAT ||
+		    physical_type == duckdb_parquet::format::Type::DOUBLE) {
 			// floats/doubles can have infinity, which can become NULL
 			row_group_stats->validity_stats = make_unique<ValidityStatistics>(true);
 		} else if (parquet_stats.__isset.null_count) {
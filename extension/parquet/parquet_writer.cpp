@@ -4,15 +4,19 @@
 #include "parquet_timestamp.hpp"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/preserved_error.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #endif
 
+#include <thread>
+
 namespace duckdb {
 
 using namespace duckdb_apache::thrift;            // NOLINT
@@ -211,9 +215,12 @@ void ParquetWriter::SetSchemaProperties(const LogicalType &duckdb_type,
 	}
 }
 
-ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, FileOpener *file_opener_p, vector<LogicalType> types_p,
-                             vector<string> names_p, CompressionCodec::type codec)
-    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec) {
+ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file_name_p, FileOpener *file_opener_p,
+                             vector<LogicalType> types_p, vector<string> names_p, CompressionCodec::type codec,
+                             bool enable_bloom_filters)
+    : scheduler(TaskScheduler::GetScheduler(context)), file_name(std::move(file_name_p)),
+      sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
+      enable_bloom_filters(enable_bloom_filters) {
 	// initialize the file writer
 	writer = make_unique<BufferedFileWriter>(
 	    fs, file_name.c_str(), FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW, file_opener_p);
@@ -244,6 +251,88 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, FileOpener *fil
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Column Encoding
+//===--------------------------------------------------------------------===//
+//! State shared between the tasks that encode the columns of a single row group
+struct ParquetEncodeTaskState {
+	ParquetEncodeTaskState(ParquetWriter &writer, ColumnDataCollection &buffer,
+	                       vector<unique_ptr<ColumnWriterState>> &states)
+	    : writer(writer), buffer(buffer), states(states) {
+	}
+
+	ParquetWriter &writer;
+	ColumnDataCollection &buffer;
+	vector<unique_ptr<ColumnWriterState>> &states;
+	//! The next column that needs to be encoded
+	atomic<idx_t> next_column {0};
+	//! The number of encode tasks that have finished executing
+	atomic<idx_t> finished_tasks {0};
+
+	mutex error_lock;
+	PreservedError error;
+	atomic<bool> has_error {false};
+
+	//! Claim and encode columns until they run out
+	void EncodeColumns() {
+		idx_t col_idx;
+		while ((col_idx = next_column++) < states.size()) {
+			if (has_error) {
+				continue;
+			}
+			try {
+				writer.EncodeColumn(buffer, *states[col_idx], col_idx);
+			} catch (Exception &ex) {
+				SetError(PreservedError(ex));
+			} catch (std::exception &ex) {
+				SetError(PreservedError(ex));
+			} catch (...) { // LCOV_EXCL_START
+				SetError(PreservedError("Unknown error while encoding Parquet column"));
+			} // LCOV_EXCL_STOP
+		}
+	}
+
+	void SetError(PreservedError error_p) {
+		lock_guard<mutex> guard(error_lock);
+		if (!error) {
+			error = std::move(error_p);
+			has_error = true;
+		}
+	}
+};
+
+class ParquetColumnEncodeTask : public Task {
+public:
+	explicit ParquetColumnEncodeTask(ParquetEncodeTaskState &task_state) : task_state(task_state) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		task_state.EncodeColumns();
+		task_state.finished_tasks++;
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	ParquetEncodeTaskState &task_state;
+};
+
+void ParquetWriter::EncodeColumn(ColumnDataCollection &buffer, ColumnWriterState &state, idx_t col_idx) {
+	const auto &col_writer = column_writers[col_idx];
+	if (col_writer->HasAnalyze()) {
+		for (auto &chunk : buffer.Chunks()) {
+			col_writer->Analyze(state, nullptr, chunk.data[col_idx], chunk.size());
+		}
+		col_writer->FinalizeAnalyze(state);
+	}
+	for (auto &chunk : buffer.Chunks()) {
+		col_writer->Prepare(state, nullptr, chunk.data[col_idx], chunk.size());
+	}
+	col_writer->BeginWrite(state);
+	for (auto &chunk : buffer.Chunks()) {
+		col_writer->Write(state, chunk.data[col_idx], chunk.size());
+	}
+}
+
 void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	if (buffer.Count() == 0) {
 		return;
@@ -255,25 +344,40 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	row_group.__isset.file_offset = true;
 
 	vector<unique_ptr<ColumnWriterState>> states;
-	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
 	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
-		const auto &col_writer = column_writers[col_idx];
-		auto write_state = col_writer->InitializeWriteState(row_group, buffer.GetAllocator());
-		if (col_writer->HasAnalyze()) {
-			for (auto &chunk : buffer.Chunks()) {
-				col_writer->Analyze(*write_state, nullptr, chunk.data[col_idx], chunk.size());
+		states.push_back(column_writers[col_idx]->InitializeWriteState(row_group, buffer.GetAllocator()));
+	}
+
+	// encode and compress the columns: this is the bulk of the work and is independent per column
+	auto num_threads = (idx_t)scheduler.NumberOfThreads();
+	if (num_threads > 1 && column_writers.size() > 1) {
+		// fan the columns out over the task scheduler, and help encoding on this thread as well
+		ParquetEncodeTaskState task_state(*this, buffer, states);
+		auto token = scheduler.CreateProducer();
+		auto num_tasks = MinValue<idx_t>(column_writers.size() - 1, num_threads - 1);
+		for (idx_t i = 0; i < num_tasks; i++) {
+			scheduler.ScheduleTask(*token, make_unique<ParquetColumnEncodeTask>(task_state));
+		}
+		task_state.EncodeColumns();
+		// execute any encode tasks that were not picked up by the worker threads,
+		// and wait for the remaining tasks to finish
+		unique_ptr<Task> task;
+		while (task_state.finished_tasks != num_tasks) {
+			if (scheduler.GetTaskFromProducer(*token, task)) {
+				task->Execute(TaskExecutionMode::PROCESS_ALL);
+				task.reset();
+			} else {
+				std::this_thread::yield();
 			}
-			col_writer->FinalizeAnalyze(*write_state);
 		}
-		for (auto &chunk : buffer.Chunks()) {
-			col_writer->Prepare(*write_state, nullptr, chunk.data[col_idx], chunk.size());
+		if (task_state.error) {
+			task_state.error.Throw();
 		}
-		col_writer->BeginWrite(*write_state);
-		for (auto &chunk : buffer.Chunks()) {
-			col_writer->Write(*write_state, chunk.data[col_idx], chunk.size());
+	} else {
+		for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
+			EncodeColumn(buffer, *states[col_idx], col_idx);
 		}
-		states.push_back(std::move(write_state));
 	}
 
 	lock_guard<mutex> glock(lock);
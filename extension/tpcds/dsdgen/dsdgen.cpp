@@ -65,13 +65,19 @@ void DSDGenWrapper::CreateTPCDSSchema(ClientContext &context, string schema, str
 	CreateTPCDSTable<WebSiteInfo>(context, schema, suffix, keys, overwrite);
 }
 
-void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string schema, string suffix) {
+void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string schema, string suffix, idx_t children,
+                           idx_t step) {
 	if (scale <= 0) {
 		// schema only
 		return;
 	}
 
 	InitializeDSDgen(scale);
+	if (children > 1) {
+		// generating one partition of a parallelized load: dsdgen skips to this worker's range of rows itself,
+		// and only builds the small tables in the first worker
+		SetParallelChild((int)children, (int)step + 1);
+	}
 
 	// populate append info
 	vector<unique_ptr<tpcds_append_information>> append_info;
@@ -98,7 +104,8 @@ void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string schema,
 			continue;
 		}
 
-		ds_key_t k_row_count = GetRowCount(table_id), k_first_row = 1;
+		ds_key_t k_row_count, k_first_row;
+		SplitWork(table_id, k_first_row, k_row_count);
 
 		// TODO: verify this is correct and required here
 		/*
@@ -8,6 +8,7 @@
 #include "genrand.h"
 #include "params.h"
 #include "porting.h"
+#include "parallel.h"
 #include "scaling.h"
 #include "tdefs.h"
 #include "init.h"
@@ -26,6 +27,17 @@ ds_key_t GetRowCount(int table_id) {
 	return get_rowcount(table_id);
 }
 
+void SetParallelChild(int parallel, int child) {
+	auto parallel_str = std::to_string(parallel);
+	auto child_str = std::to_string(child);
+	set_int("PARALLEL", (char *)parallel_str.c_str());
+	set_int("CHILD", (char *)child_str.c_str());
+}
+
+void SplitWork(int table_id, ds_key_t &first_row, ds_key_t &row_count) {
+	split_work(table_id, &first_row, &row_count);
+}
+
 void ResetCountCount() {
 	resetCountCount();
 }
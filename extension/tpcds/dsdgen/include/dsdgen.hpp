@@ -25,9 +25,10 @@ struct DSDGenWrapper {
 	//! Create the TPC-DS tables in the given schema with the given suffix
 	static void CreateTPCDSSchema(duckdb::ClientContext &context, std::string schema, std::string suffix, bool keys,
 	                              bool overwrite);
-	//! Generate the TPC-DS data of the given scale factor
+	//! Generate the TPC-DS data of the given scale factor; when children > 1 only the partition belonging to the
+	//! given step (0-based) is generated, so separate workers can load a scale factor in parallel
 	static void DSDGen(double scale, duckdb::ClientContext &context, std::string schema = DEFAULT_SCHEMA,
-	                   std::string suffix = "");
+	                   std::string suffix = "", duckdb::idx_t children = 1, duckdb::idx_t step = 0);
 
 	static uint32_t QueriesCount();
 	//! Gets the specified TPC-DS Query number as a string
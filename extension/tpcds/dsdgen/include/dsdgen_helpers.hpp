@@ -12,6 +12,12 @@ typedef int (*tpcds_builder_func)(void *, ds_key_t);
 
 void InitializeDSDgen(double scale);
 ds_key_t GetRowCount(int table_id);
+
+//! Configures a parallelized generation run consisting of parallel chunks, of which this process builds one (1-based)
+void SetParallelChild(int parallel, int child);
+
+//! Computes the range of rows of the given table that this process should build
+void SplitWork(int table_id, ds_key_t &first_row, ds_key_t &row_count);
 void ResetCountCount();
 tpcds_table_def GetTDefByNumber(int table_id);
 tpcds_builder_func GetTDefFunctionByNumber(int table_id);
@@ -25,6 +25,8 @@ struct DSDGenFunctionData : public TableFunctionData {
 	string suffix;
 	bool overwrite = false;
 	bool keys = false;
+	idx_t children = 1;
+	idx_t step = 0;
 };
 
 static unique_ptr<FunctionData> DsdgenBind(ClientContext &context, TableFunctionBindInput &input,
@@ -41,8 +43,18 @@ static unique_ptr<FunctionData> DsdgenBind(ClientContext &context, TableFunction
 			result->overwrite = kv.second.GetValue<bool>();
 		} else if (kv.first == "keys") {
 			result->keys = kv.second.GetValue<bool>();
+		} else if (kv.first == "children") {
+			result->children = kv.second.GetValue<int64_t>();
+		} else if (kv.first == "step") {
+			result->step = kv.second.GetValue<int64_t>();
 		}
 	}
+	if (result->children < 1) {
+		throw BinderException("dsdgen: children must be at least 1");
+	}
+	if (result->step >= result->children) {
+		throw BinderException("dsdgen: step must be between 0 and children - 1");
+	}
 	return_types.emplace_back(LogicalType::BOOLEAN);
 	names.emplace_back("Success");
 	return std::move(result);
@@ -53,8 +65,11 @@ static void DsdgenFunction(ClientContext &context, TableFunctionInput &data_p, D
 	if (data.finished) {
 		return;
 	}
-	tpcds::DSDGenWrapper::CreateTPCDSSchema(context, data.schema, data.suffix, data.keys, data.overwrite);
-	tpcds::DSDGenWrapper::DSDGen(data.sf, context, data.schema, data.suffix);
+	if (data.step == 0) {
+		// in a parallelized load the tables are created by the first worker only
+		tpcds::DSDGenWrapper::CreateTPCDSSchema(context, data.schema, data.suffix, data.keys, data.overwrite);
+	}
+	tpcds::DSDGenWrapper::DSDGen(data.sf, context, data.schema, data.suffix, data.children, data.step);
 
 	data.finished = true;
 }
@@ -156,6 +171,8 @@ void TPCDSExtension::Load(DuckDB &db) {
 	dsdgen_func.named_parameters["keys"] = LogicalType::BOOLEAN;
 	dsdgen_func.named_parameters["schema"] = LogicalType::VARCHAR;
 	dsdgen_func.named_parameters["suffix"] = LogicalType::VARCHAR;
+	dsdgen_func.named_parameters["children"] = LogicalType::BIGINT;
+	dsdgen_func.named_parameters["step"] = LogicalType::BIGINT;
 	CreateTableFunctionInfo dsdgen_info(dsdgen_func);
 
 	// create the dsdgen function
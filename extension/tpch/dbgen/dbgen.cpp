@@ -244,14 +244,14 @@ static void append_region(code_t *c, tpch_append_information *info) {
 	append_info.appender->EndRow();
 }
 
-static void gen_tbl(int tnum, DSS_HUGE count, tpch_append_information *info, DBGenContext *dbgen_ctx) {
+static void gen_tbl(int tnum, DSS_HUGE start, DSS_HUGE count, tpch_append_information *info, DBGenContext *dbgen_ctx) {
 	order_t o;
 	supplier_t supp;
 	customer_t cust;
 	part_t part;
 	code_t code;
 
-	for (DSS_HUGE i = 1; count; count--, i++) {
+	for (DSS_HUGE i = start; count; count--, i++) {
 		row_start(tnum, dbgen_ctx);
 		switch (tnum) {
 		case LINE:
@@ -437,7 +437,8 @@ void DBGenWrapper::CreateTPCHSchema(ClientContext &context, string schema, strin
 	CreateTPCHTable<LineitemInfo>(context, schema, suffix);
 }
 
-void DBGenWrapper::LoadTPCHData(ClientContext &context, double flt_scale, string schema, string suffix) {
+void DBGenWrapper::LoadTPCHData(ClientContext &context, double flt_scale, string schema, string suffix,
+                                idx_t children_p, idx_t step_p) {
 	if (flt_scale == 0) {
 		return;
 	}
@@ -511,13 +512,30 @@ void DBGenWrapper::LoadTPCHData(ClientContext &context, double flt_scale, string
 
 	for (i = PART; i <= REGION; i++) {
 		if (table & (1 << i)) {
+			DSS_HUGE start = 1;
 			if (i < NATION) {
 				rowcnt = tdefs[i].base * dbgen_ctx.scale_factor;
+				if (children_p > 1) {
+					// generating one partition of a parallelized load: fast-forward the random streams to the
+					// start of this worker's range of rows
+					DSS_HUGE extra_rows = 0;
+					rowcnt = set_state((int)i, (long)dbgen_ctx.scale_factor, (long)children_p, (long)step_p + 1,
+					                   &extra_rows, &dbgen_ctx);
+					start = rowcnt * step_p + 1;
+					if (step_p + 1 == children_p) {
+						// the last worker also generates the rows that did not divide evenly
+						rowcnt += extra_rows;
+					}
+				}
 			} else {
+				if (children_p > 1 && step_p != 0) {
+					// the small fixed-size tables are generated by the first worker only
+					continue;
+				}
 				rowcnt = tdefs[i].base;
 			}
 			// actually doing something
-			gen_tbl((int)i, rowcnt, append_info.get(), &dbgen_ctx);
+			gen_tbl((int)i, start, rowcnt, append_info.get(), &dbgen_ctx);
 		}
 	}
 	// flush any incomplete chunks
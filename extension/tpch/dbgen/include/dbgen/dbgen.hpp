@@ -24,8 +24,10 @@ namespace tpch {
 struct DBGenWrapper {
 	//! Create the TPC-H tables in the given schema with the given suffix
 	static void CreateTPCHSchema(duckdb::ClientContext &context, std::string schema, std::string suffix);
-	//! Load the TPC-H data of the given scale factor
-	static void LoadTPCHData(duckdb::ClientContext &context, double sf, std::string schema, std::string suffix);
+	//! Load the TPC-H data of the given scale factor; when children > 1 only the partition belonging to the given
+	//! step (0-based) is generated, so separate workers can load a scale factor in parallel
+	static void LoadTPCHData(duckdb::ClientContext &context, double sf, std::string schema, std::string suffix,
+	                         duckdb::idx_t children = 1, duckdb::idx_t step = 0);
 
 	//! Gets the specified TPC-H Query number as a string
 	static std::string GetQuery(int query);
@@ -25,6 +25,8 @@ struct DBGenFunctionData : public TableFunctionData {
 	string schema = DEFAULT_SCHEMA;
 	string suffix;
 	bool overwrite = false;
+	idx_t children = 1;
+	idx_t step = 0;
 };
 
 static unique_ptr<FunctionData> DbgenBind(ClientContext &context, TableFunctionBindInput &input,
@@ -39,8 +41,18 @@ static unique_ptr<FunctionData> DbgenBind(ClientContext &context, TableFunctionB
 			result->suffix = StringValue::Get(kv.second);
 		} else if (kv.first == "overwrite") {
 			result->overwrite = BooleanValue::Get(kv.second);
+		} else if (kv.first == "children") {
+			result->children = kv.second.GetValue<int64_t>();
+		} else if (kv.first == "step") {
+			result->step = kv.second.GetValue<int64_t>();
 		}
 	}
+	if (result->children < 1) {
+		throw BinderException("dbgen: children must be at least 1");
+	}
+	if (result->step >= result->children) {
+		throw BinderException("dbgen: step must be between 0 and children - 1");
+	}
 	return_types.emplace_back(LogicalType::BOOLEAN);
 	names.emplace_back("Success");
 	return std::move(result);
@@ -51,8 +63,11 @@ static void DbgenFunction(ClientContext &context, TableFunctionInput &data_p, Da
 	if (data.finished) {
 		return;
 	}
-	tpch::DBGenWrapper::CreateTPCHSchema(context, data.schema, data.suffix);
-	tpch::DBGenWrapper::LoadTPCHData(context, data.sf, data.schema, data.suffix);
+	if (data.step == 0) {
+		// in a parallelized load the tables are created by the first worker only
+		tpch::DBGenWrapper::CreateTPCHSchema(context, data.schema, data.suffix);
+	}
+	tpch::DBGenWrapper::LoadTPCHData(context, data.sf, data.schema, data.suffix, data.children, data.step);
 
 	data.finished = true;
 }
@@ -154,6 +169,8 @@ void TPCHExtension::Load(DuckDB &db) {
 	dbgen_func.named_parameters["overwrite"] = LogicalType::BOOLEAN;
 	dbgen_func.named_parameters["schema"] = LogicalType::VARCHAR;
 	dbgen_func.named_parameters["suffix"] = LogicalType::VARCHAR;
+	dbgen_func.named_parameters["children"] = LogicalType::BIGINT;
+	dbgen_func.named_parameters["step"] = LogicalType::BIGINT;
 	CreateTableFunctionInfo dbgen_info(dbgen_func);
 
 	// create the dbgen function
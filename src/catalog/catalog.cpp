@@ -38,7 +38,7 @@ namespace duckdb {
 
 Catalog::Catalog(AttachedDatabase &db)
     : schemas(make_unique<CatalogSet>(*this, make_unique<DefaultSchemaGenerator>(*this))),
-      dependency_manager(make_unique<DependencyManager>(*this)), db(db) {
+      dependency_manager(make_unique<DependencyManager>(*this)), db(db), builtin_functions_pending(false) {
 }
 Catalog::~Catalog() {
 }
@@ -56,14 +56,29 @@ void Catalog::Initialize(bool load_builtin) {
 	CreateSchema(data, &info);
 
 	if (load_builtin) {
-		// initialize default functions
-		BuiltinFunctions builtin(data, *this);
-		builtin.Initialize();
+		// the built-in functions are registered lazily on the first function lookup, so that opening a database does
+		// not pay the cost of creating all of the function catalog entries up-front
+		builtin_functions_pending = true;
 	}
 
 	Verify();
 }
 
+void Catalog::LoadBuiltinFunctions() {
+	if (!builtin_functions_pending) {
+		return;
+	}
+	lock_guard<mutex> guard(builtin_functions_lock);
+	if (!builtin_functions_pending) {
+		return;
+	}
+	// the built-in functions are created as part of the initial system transaction so they are visible to everyone
+	CatalogTransaction data(GetDatabase(), 1, 1);
+	BuiltinFunctions builtin(data, *this);
+	builtin.Initialize();
+	builtin_functions_pending = false;
+}
+
 DatabaseInstance &Catalog::GetDatabase() {
 	return db.GetDatabase();
 }
@@ -218,6 +233,8 @@ CatalogEntry *Catalog::CreateTableFunction(CatalogTransaction transaction, Creat
 }
 
 CatalogEntry *Catalog::CreateTableFunction(ClientContext &context, CreateTableFunctionInfo *info) {
+	// entry creation can overwrite or overload built-in entries - these have to be registered first
+	LoadBuiltinFunctions();
 	return CreateTableFunction(GetCatalogTransaction(context), info);
 }
 
@@ -235,6 +252,8 @@ CatalogEntry *Catalog::CreateCopyFunction(CatalogTransaction transaction, Create
 }
 
 CatalogEntry *Catalog::CreateCopyFunction(ClientContext &context, CreateCopyFunctionInfo *info) {
+	// entry creation can overwrite or overload built-in entries - these have to be registered first
+	LoadBuiltinFunctions();
 	return CreateCopyFunction(GetCatalogTransaction(context), info);
 }
 
@@ -252,6 +271,8 @@ CatalogEntry *Catalog::CreatePragmaFunction(CatalogTransaction transaction, Crea
 }
 
 CatalogEntry *Catalog::CreatePragmaFunction(ClientContext &context, CreatePragmaFunctionInfo *info) {
+	// entry creation can overwrite or overload built-in entries - these have to be registered first
+	LoadBuiltinFunctions();
 	return CreatePragmaFunction(GetCatalogTransaction(context), info);
 }
 
@@ -269,6 +290,8 @@ CatalogEntry *Catalog::CreateFunction(CatalogTransaction transaction, CreateFunc
 }
 
 CatalogEntry *Catalog::CreateFunction(ClientContext &context, CreateFunctionInfo *info) {
+	// entry creation can overwrite or overload built-in entries - these have to be registered first
+	LoadBuiltinFunctions();
 	return CreateFunction(GetCatalogTransaction(context), info);
 }
 
@@ -291,6 +314,8 @@ CatalogEntry *Catalog::CreateCollation(CatalogTransaction transaction, CreateCol
 }
 
 CatalogEntry *Catalog::CreateCollation(ClientContext &context, CreateCollationInfo *info) {
+	// entry creation can overwrite or overload built-in entries - these have to be registered first
+	LoadBuiltinFunctions();
 	return CreateCollation(GetCatalogTransaction(context), info);
 }
 
@@ -533,9 +558,27 @@ CatalogException Catalog::CreateMissingEntryException(ClientContext &context, co
 	                                                  entry_name, did_you_mean));
 }
 
+static bool IsBuiltinFunctionLookup(CatalogType type) {
+	switch (type) {
+	case CatalogType::SCALAR_FUNCTION_ENTRY:
+	case CatalogType::AGGREGATE_FUNCTION_ENTRY:
+	case CatalogType::TABLE_FUNCTION_ENTRY:
+	case CatalogType::TABLE_MACRO_ENTRY:
+	case CatalogType::MACRO_ENTRY:
+	case CatalogType::PRAGMA_FUNCTION_ENTRY:
+	case CatalogType::COPY_FUNCTION_ENTRY:
+	case CatalogType::COLLATION_ENTRY:
+		return true;
+	default:
+		return false;
+	}
+}
+
 CatalogEntryLookup Catalog::LookupEntryInternal(CatalogTransaction transaction, CatalogType type, const string &schema,
                                                 const string &name) {
-
+	if (IsBuiltinFunctionLookup(type)) {
+		LoadBuiltinFunctions();
+	}
 	auto schema_entry = (SchemaCatalogEntry *)GetSchema(transaction, schema, true);
 	if (!schema_entry) {
 		return {nullptr, nullptr};
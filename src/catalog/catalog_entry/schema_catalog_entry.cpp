@@ -130,7 +130,10 @@ CatalogEntry *SchemaCatalogEntry::CreateType(CatalogTransaction transaction, Cre
 
 CatalogEntry *SchemaCatalogEntry::CreateTable(CatalogTransaction transaction, BoundCreateTableInfo *info) {
 	auto table = make_unique<TableCatalogEntry>(catalog, this, info);
-	table->storage->info->cardinality = table->storage->GetTotalRows();
+	if (table->storage->IsLoaded()) {
+		// if the table data is loaded lazily the cardinality is set when the data is first accessed instead
+		table->storage->info->cardinality = table->storage->GetTotalRows();
+	}
 
 	CatalogEntry *entry = AddEntry(transaction, std::move(table), info->Base().on_conflict, info->dependencies);
 	if (!entry) {
@@ -278,11 +281,14 @@ void SchemaCatalogEntry::Alter(ClientContext &context, AlterInfo *info) {
 
 void SchemaCatalogEntry::Scan(ClientContext &context, CatalogType type,
                               const std::function<void(CatalogEntry *)> &callback) {
+	// make sure any lazily registered built-in entries are present before enumerating the set
+	catalog->LoadBuiltinFunctions();
 	auto &set = GetCatalogSet(type);
 	set.Scan(GetCatalogTransaction(context), callback);
 }
 
 void SchemaCatalogEntry::Scan(CatalogType type, const std::function<void(CatalogEntry *)> &callback) {
+	catalog->LoadBuiltinFunctions();
 	auto &set = GetCatalogSet(type);
 	set.Scan(callback);
 }
@@ -117,6 +117,13 @@ Allocator::Allocator(allocate_function_ptr_t allocate_function_p, free_function_
 Allocator::~Allocator() {
 }
 
+//! The net number of bytes allocated by this thread, over all allocators
+static thread_local int64_t thread_allocated_bytes = 0;
+
+int64_t Allocator::ThreadAllocatedBytes() {
+	return thread_allocated_bytes;
+}
+
 data_ptr_t Allocator::AllocateData(idx_t size) {
 	D_ASSERT(size > 0);
 	if (size >= MAXIMUM_ALLOC_SIZE) {
@@ -132,6 +139,7 @@ data_ptr_t Allocator::AllocateData(idx_t size) {
 	if (!result) {
 		throw OutOfMemoryException("Failed to allocate block of %llu bytes", size);
 	}
+	thread_allocated_bytes += int64_t(size);
 	return result;
 }
 
@@ -145,6 +153,7 @@ void Allocator::FreeData(data_ptr_t pointer, idx_t size) {
 	private_data->debug_info->FreeData(pointer, size);
 #endif
 	free_function(private_data.get(), pointer, size);
+	thread_allocated_bytes -= int64_t(size);
 }
 
 data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t size) {
@@ -165,6 +174,7 @@ data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t s
 	if (!new_pointer) {
 		throw OutOfMemoryException("Failed to re-allocate block of %llu bytes", size);
 	}
+	thread_allocated_bytes += int64_t(size) - int64_t(old_size);
 	return new_pointer;
 }
 
@@ -8,7 +8,12 @@
 
 #include "duckdb/common/arrow/result_arrow_wrapper.hpp"
 #include "duckdb/common/arrow/arrow_appender.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/types/column_data_allocator.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_result.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -73,6 +78,112 @@ const char *ArrowArrayStreamWrapper::GetError() { // LCOV_EXCL_START
 	return arrow_array_stream.get_last_error(&arrow_array_stream);
 } // LCOV_EXCL_STOP
 
+//===--------------------------------------------------------------------===//
+// Parallel Result Conversion
+//===--------------------------------------------------------------------===//
+struct ArrowConversionState {
+	explicit ArrowConversionState(ColumnDataCollection &collection) : collection(collection), remaining_tasks(0) {
+	}
+
+	//! The collection that is being converted
+	ColumnDataCollection &collection;
+	//! The converted batches, one entry per task
+	vector<shared_ptr<ArrowArrayWrapper>> batches;
+	//! The amount of tasks that have not finished converting yet
+	atomic<idx_t> remaining_tasks;
+	//! Lock protecting the error
+	mutex error_lock;
+	//! The first error that occurred during conversion (if any)
+	PreservedError error;
+};
+
+class ArrowConversionTask : public Task {
+public:
+	ArrowConversionTask(ArrowConversionState &state, idx_t batch_index, idx_t chunk_start, idx_t chunk_end)
+	    : state(state), batch_index(batch_index), chunk_start(chunk_start), chunk_end(chunk_end) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		// all errors must be caught here: this can run on a worker thread of the task scheduler
+		try {
+			ConvertBatch();
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(state.error_lock);
+			if (!state.error) {
+				state.error = PreservedError(ex);
+			}
+		} catch (...) { // LCOV_EXCL_START
+			lock_guard<mutex> guard(state.error_lock);
+			if (!state.error) {
+				state.error = PreservedError("Unknown error during arrow conversion");
+			}
+		} // LCOV_EXCL_STOP
+		state.remaining_tasks--;
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	void ConvertBatch() {
+		auto &collection = state.collection;
+		ArrowAppender appender(collection.Types(), (chunk_end - chunk_start) * STANDARD_VECTOR_SIZE);
+		DataChunk chunk;
+		collection.InitializeScanChunk(chunk);
+		for (idx_t chunk_idx = chunk_start; chunk_idx < chunk_end; chunk_idx++) {
+			collection.FetchChunk(chunk_idx, chunk);
+			appender.Append(chunk);
+		}
+		auto batch = make_shared<ArrowArrayWrapper>();
+		batch->arrow_array = appender.Finalize();
+		state.batches[batch_index] = std::move(batch);
+	}
+
+	ArrowConversionState &state;
+	idx_t batch_index;
+	idx_t chunk_start;
+	idx_t chunk_end;
+};
+
+bool ResultArrowArrayStreamWrapper::ConvertMaterializedResult(MaterializedQueryResult &result) {
+	auto &collection = result.Collection();
+	if (collection.GetAllocatorType() != ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR) {
+		// we need the buffer manager to reach the task scheduler of the database
+		return false;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(collection.GetBufferManager().GetDatabase());
+	idx_t chunks_per_batch = MaxValue<idx_t>(1, batch_size / STANDARD_VECTOR_SIZE);
+	idx_t chunk_count = collection.ChunkCount();
+	idx_t batch_count = (chunk_count + chunks_per_batch - 1) / chunks_per_batch;
+	if (batch_count <= 1 || scheduler.NumberOfThreads() <= 1) {
+		// nothing to parallelize
+		return false;
+	}
+	ArrowConversionState state(collection);
+	state.batches.resize(batch_count);
+	state.remaining_tasks = batch_count;
+
+	auto token = scheduler.CreateProducer();
+	for (idx_t batch_idx = 0; batch_idx < batch_count; batch_idx++) {
+		idx_t chunk_start = batch_idx * chunks_per_batch;
+		idx_t chunk_end = MinValue<idx_t>(chunk_count, chunk_start + chunks_per_batch);
+		scheduler.ScheduleTask(*token, make_unique<ArrowConversionTask>(state, batch_idx, chunk_start, chunk_end));
+	}
+	// work on the conversion from this thread as well
+	unique_ptr<Task> task;
+	while (scheduler.GetTaskFromProducer(*token, task)) {
+		task->Execute(TaskExecutionMode::PROCESS_ALL);
+		task.reset();
+	}
+	// wait for any tasks that were picked up by worker threads
+	while (state.remaining_tasks > 0) {
+		std::this_thread::yield();
+	}
+	if (state.error) {
+		state.error.Throw();
+	}
+	converted_batches = std::move(state.batches);
+	return true;
+}
+
 int ResultArrowArrayStreamWrapper::MyStreamGetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out) {
 	if (!stream->release) {
 		return -1;
@@ -126,6 +237,32 @@ int ResultArrowArrayStreamWrapper::MyStreamGetNext(struct ArrowArrayStream *stre
 		my_stream->column_types = result.types;
 		my_stream->column_names = result.names;
 	}
+	if (result.type == QueryResultType::MATERIALIZED_RESULT) {
+		// materialized result: try to convert all batches in parallel on the task scheduler up-front
+		if (!my_stream->conversion_attempted) {
+			my_stream->conversion_attempted = true;
+			try {
+				my_stream->use_converted_batches =
+				    my_stream->ConvertMaterializedResult((MaterializedQueryResult &)result);
+			} catch (std::exception &ex) {
+				my_stream->last_error = PreservedError(ex);
+				return -1;
+			}
+		}
+		if (my_stream->use_converted_batches) {
+			if (my_stream->converted_batch_index >= my_stream->converted_batches.size()) {
+				// all batches have been handed out
+				out->release = nullptr;
+				return 0;
+			}
+			auto &batch = my_stream->converted_batches[my_stream->converted_batch_index++];
+			// hand over ownership of the batch to the caller
+			*out = batch->arrow_array;
+			batch->arrow_array.release = nullptr;
+			batch.reset();
+			return 0;
+		}
+	}
 	idx_t result_count;
 	PreservedError error;
 	if (!ArrowUtil::TryFetchChunk(&result, my_stream->batch_size, out, result_count, error)) {
@@ -0,0 +1,244 @@
+#include "duckdb/common/cache_file_system.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace duckdb {
+
+//! Cache file layout: a fixed-size header, a bitmap with one bit per cached block, and the block data at fixed
+//! offsets. Blocks are written before their bitmap bit is persisted, so the on-disk bitmap never claims data that was
+//! not written; concurrent writers to the same cache file can at worst lose each other's bits, which only causes a
+//! block to be fetched again.
+static constexpr const uint64_t CACHE_MAGIC = 0x4548434143424446ULL; // "FDBCACHE"
+static constexpr const uint64_t CACHE_VERSION = 1;
+static constexpr const idx_t CACHE_HEADER_SIZE = 4 * sizeof(uint64_t);
+
+class CacheFile : public FileHandle {
+public:
+	CacheFile(unique_ptr<FileSystem> local_fs_p, unique_ptr<FileHandle> remote_handle_p, const string &path)
+	    : FileHandle(cache_fs, path), local_fs(std::move(local_fs_p)), remote_handle(std::move(remote_handle_p)) {
+	}
+	~CacheFile() override {
+		Close();
+	}
+
+	CacheFileSystem cache_fs;
+	unique_ptr<FileSystem> local_fs;
+	unique_ptr<FileHandle> remote_handle;
+	unique_ptr<FileHandle> cache_handle;
+
+	//! The size and last-modified time of the remote file, used to validate the cache file
+	idx_t file_size = 0;
+	time_t last_modified = 0;
+	idx_t block_count = 0;
+	//! The offset at which the block data starts in the cache file
+	idx_t data_offset = 0;
+	//! One bit per block of the remote file, set if the block is present in the cache file
+	vector<uint8_t> block_bitmap;
+	//! The current position, for sequential reads
+	idx_t file_offset = 0;
+	//! Lock protecting the bitmap and the cache file
+	mutex lock;
+
+public:
+	bool HasBlock(idx_t block_idx) {
+		return (block_bitmap[block_idx / 8] & (1 << (block_idx % 8))) != 0;
+	}
+	void SetBlock(idx_t block_idx) {
+		block_bitmap[block_idx / 8] |= 1 << (block_idx % 8);
+	}
+
+	void Close() override {
+		cache_handle.reset();
+		remote_handle.reset();
+	}
+};
+
+static string CacheFileName(const string &path) {
+	// name cache files after the hash of the remote path so any remote path maps to a valid local file name
+	return StringUtil::Format("%016llx.dbcache", (unsigned long long)Hash(path.c_str()));
+}
+
+//! Evicts the oldest cache files until the cache directory fits the configured bound again
+static void EvictCacheFiles(FileSystem &fs, const string &cache_directory, const string &keep_path,
+                            idx_t max_cache_size) {
+	// collect the cache files in the directory together with their size and last-modified time
+	vector<std::pair<time_t, std::pair<idx_t, string>>> entries;
+	idx_t total_size = 0;
+	fs.ListFiles(cache_directory, [&](const string &name, bool is_dir) {
+		if (is_dir || !StringUtil::EndsWith(name, ".dbcache")) {
+			return;
+		}
+		auto file_path = fs.JoinPath(cache_directory, name);
+		if (file_path == keep_path) {
+			return;
+		}
+		try {
+			auto handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ);
+			auto size = (idx_t)handle->GetFileSize();
+			total_size += size;
+			entries.emplace_back(fs.GetLastModifiedTime(*handle), std::make_pair(size, file_path));
+		} catch (...) { // NOLINT
+			// the file disappeared or cannot be opened: nothing to evict
+		}
+	});
+	if (total_size <= max_cache_size) {
+		return;
+	}
+	std::sort(entries.begin(), entries.end());
+	for (auto &entry : entries) {
+		if (total_size <= max_cache_size) {
+			break;
+		}
+		try {
+			fs.RemoveFile(entry.second.second);
+			total_size -= entry.second.first;
+		} catch (...) { // NOLINT
+			// the file may be in use (e.g. on Windows): skip it
+		}
+	}
+}
+
+unique_ptr<FileHandle> CacheFileSystem::OpenCachedFile(unique_ptr<FileHandle> remote_handle,
+                                                       const string &cache_directory, idx_t max_cache_size) {
+	auto path = remote_handle->path;
+	auto result = make_unique<CacheFile>(FileSystem::CreateLocal(), std::move(remote_handle), path);
+	auto &fs = *result->local_fs;
+	auto &remote = *result->remote_handle;
+
+	result->file_size = remote.GetFileSize();
+	result->last_modified = remote.file_system.GetLastModifiedTime(remote);
+	result->block_count = (result->file_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	idx_t bitmap_size = (result->block_count + 7) / 8;
+	result->data_offset = CACHE_HEADER_SIZE + bitmap_size;
+	result->block_bitmap.resize(bitmap_size, 0);
+
+	if (!fs.DirectoryExists(cache_directory)) {
+		fs.CreateDirectory(cache_directory);
+	}
+	auto cache_path = fs.JoinPath(cache_directory, CacheFileName(path));
+	EvictCacheFiles(fs, cache_directory, cache_path, max_cache_size);
+
+	result->cache_handle = fs.OpenFile(
+	    cache_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+	auto &cache = *result->cache_handle;
+
+	// check whether the cache file holds a valid cache of the current version of the remote file
+	uint64_t header[4];
+	bool valid = false;
+	if ((idx_t)cache.GetFileSize() >= result->data_offset) {
+		cache.Read(header, CACHE_HEADER_SIZE, 0);
+		valid = header[0] == CACHE_MAGIC && header[1] == CACHE_VERSION && header[2] == (uint64_t)result->file_size &&
+		        (int64_t)header[3] == (int64_t)result->last_modified;
+	}
+	if (valid) {
+		cache.Read(result->block_bitmap.data(), bitmap_size, CACHE_HEADER_SIZE);
+	} else {
+		// the remote file is new to the cache, or it changed since it was cached: (re)initialize the cache file
+		header[0] = CACHE_MAGIC;
+		header[1] = CACHE_VERSION;
+		header[2] = result->file_size;
+		header[3] = (uint64_t)result->last_modified;
+		cache.Truncate(result->data_offset);
+		cache.Write(header, CACHE_HEADER_SIZE, 0);
+		cache.Write(result->block_bitmap.data(), bitmap_size, CACHE_HEADER_SIZE);
+	}
+	return std::move(result);
+}
+
+//! Fetches the (consecutive) blocks [first_block, last_block] from the remote file into the cache file
+static void FetchBlocks(CacheFile &file, idx_t first_block, idx_t last_block) {
+	idx_t start = first_block * CacheFileSystem::BLOCK_SIZE;
+	idx_t end = MinValue<idx_t>((last_block + 1) * CacheFileSystem::BLOCK_SIZE, file.file_size);
+	auto buffer = unique_ptr<data_t[]>(new data_t[end - start]);
+	file.remote_handle->Read(buffer.get(), end - start, start);
+	file.cache_handle->Write(buffer.get(), end - start, file.data_offset + start);
+	// only mark the blocks as cached after their data has been written
+	for (idx_t block_idx = first_block; block_idx <= last_block; block_idx++) {
+		file.SetBlock(block_idx);
+	}
+	idx_t byte_start = first_block / 8;
+	idx_t byte_end = last_block / 8;
+	file.cache_handle->Write(file.block_bitmap.data() + byte_start, byte_end - byte_start + 1,
+	                         CACHE_HEADER_SIZE + byte_start);
+}
+
+static void ReadInternal(CacheFile &file, void *buffer, int64_t nr_bytes, idx_t location) {
+	if (location + nr_bytes > file.file_size) {
+		throw IOException("Cannot read %lld bytes at location %lld: out of range for file \"%s\" of size %lld",
+		                  nr_bytes, location, file.path, file.file_size);
+	}
+	lock_guard<mutex> lck(file.lock);
+	idx_t pos = location;
+	idx_t read_end_total = location + nr_bytes;
+	auto out = (data_ptr_t)buffer;
+	while (pos < read_end_total) {
+		idx_t block_idx = pos / CacheFileSystem::BLOCK_SIZE;
+		if (!file.HasBlock(block_idx)) {
+			// fetch this block, together with any directly following missing blocks the read also covers, with a
+			// single remote request
+			idx_t last_block = block_idx;
+			while (last_block + 1 < file.block_count &&
+			       (last_block + 1) * CacheFileSystem::BLOCK_SIZE < read_end_total &&
+			       !file.HasBlock(last_block + 1)) {
+				last_block++;
+			}
+			FetchBlocks(file, block_idx, last_block);
+		}
+		idx_t block_start = block_idx * CacheFileSystem::BLOCK_SIZE;
+		idx_t block_end = MinValue<idx_t>(block_start + CacheFileSystem::BLOCK_SIZE, file.file_size);
+		idx_t to_read = MinValue<idx_t>(read_end_total, block_end) - pos;
+		file.cache_handle->Read(out, to_read, file.data_offset + pos);
+		out += to_read;
+		pos += to_read;
+	}
+}
+
+void CacheFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	auto &file = (CacheFile &)handle;
+	ReadInternal(file, buffer, nr_bytes, location);
+}
+
+int64_t CacheFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
+	auto &file = (CacheFile &)handle;
+	idx_t to_read = MinValue<idx_t>(nr_bytes, file.file_size - file.file_offset);
+	if (to_read > 0) {
+		ReadInternal(file, buffer, to_read, file.file_offset);
+		file.file_offset += to_read;
+	}
+	return to_read;
+}
+
+int64_t CacheFileSystem::GetFileSize(FileHandle &handle) {
+	auto &file = (CacheFile &)handle;
+	return file.file_size;
+}
+
+time_t CacheFileSystem::GetLastModifiedTime(FileHandle &handle) {
+	auto &file = (CacheFile &)handle;
+	return file.last_modified;
+}
+
+FileType CacheFileSystem::GetFileType(FileHandle &handle) {
+	return FileType::FILE_TYPE_REGULAR;
+}
+
+void CacheFileSystem::Seek(FileHandle &handle, idx_t location) {
+	auto &file = (CacheFile &)handle;
+	file.file_offset = location;
+}
+
+idx_t CacheFileSystem::SeekPosition(FileHandle &handle) {
+	auto &file = (CacheFile &)handle;
+	return file.file_offset;
+}
+
+void CacheFileSystem::FileSync(FileHandle &handle) {
+}
+
+} // namespace duckdb
@@ -10,9 +10,20 @@ hash_t Checksum(uint64_t x) {
 uint64_t Checksum(uint8_t *buffer, size_t size) {
 	uint64_t result = 5381;
 	uint64_t *ptr = (uint64_t *)buffer;
+	size_t u64_count = size / 8;
 	size_t i;
 	// for efficiency, we first checksum uint64_t values
-	for (i = 0; i < size / 8; i++) {
+	// process four independent streams so the multiplications pipeline instead of serializing on a single
+	// accumulator; XOR is associative, so the result is identical to the single-stream loop
+	uint64_t stream0 = 0, stream1 = 0, stream2 = 0, stream3 = 0;
+	for (i = 0; i + 4 <= u64_count; i += 4) {
+		stream0 ^= Checksum(ptr[i]);
+		stream1 ^= Checksum(ptr[i + 1]);
+		stream2 ^= Checksum(ptr[i + 2]);
+		stream3 ^= Checksum(ptr[i + 3]);
+	}
+	result ^= stream0 ^ stream1 ^ stream2 ^ stream3;
+	for (; i < u64_count; i++) {
 		result ^= Checksum(ptr[i]);
 	}
 	if (size - i * 8 > 0) {
@@ -1,5 +1,7 @@
 #include "duckdb/common/compressed_file_system.hpp"
 
+#include <cstring>
+
 namespace duckdb {
 
 StreamWrapper::~StreamWrapper() {
@@ -69,6 +71,17 @@ int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 				break;
 			}
 			stream_data.in_buff_end = stream_data.in_buff_start + sz;
+		} else if (stream_data.refresh) {
+			// a stream ended mid-buffer and the header of a concatenated stream may straddle the buffer boundary:
+			// move the remaining input to the front of the buffer and refill behind it
+			idx_t bufrem = stream_data.in_buff_end - stream_data.in_buff_start;
+			memmove(stream_data.in_buff.get(), stream_data.in_buff_start, bufrem);
+			stream_data.in_buff_start = stream_data.in_buff.get();
+			stream_data.in_buff_end = stream_data.in_buff_start + bufrem;
+			auto sz = child_handle->Read(stream_data.in_buff_end, stream_data.in_buf_size - bufrem);
+			if (sz > 0) {
+				stream_data.in_buff_end += sz;
+			}
 		}
 
 		auto finished = stream_wrapper->Read(stream_data);
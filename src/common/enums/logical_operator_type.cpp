@@ -84,8 +84,12 @@ string LogicalOperatorToString(LogicalOperatorType type) {
 		return "VACUUM";
 	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE:
 		return "REC_CTE";
+	case LogicalOperatorType::LOGICAL_MATERIALIZE:
+		return "MATERIALIZE";
 	case LogicalOperatorType::LOGICAL_CTE_REF:
 		return "CTE_SCAN";
+	case LogicalOperatorType::LOGICAL_MATERIALIZE_SCAN:
+		return "MATERIALIZE_SCAN";
 	case LogicalOperatorType::LOGICAL_SHOW:
 		return "SHOW";
 	case LogicalOperatorType::LOGICAL_ALTER:
@@ -19,10 +19,13 @@ static DefaultOptimizerType internal_optimizer_types[] = {
     {"join_order", OptimizerType::JOIN_ORDER},
     {"deliminator", OptimizerType::DELIMINATOR},
     {"unused_columns", OptimizerType::UNUSED_COLUMNS},
+    {"eager_aggregate", OptimizerType::EAGER_AGGREGATE},
     {"statistics_propagation", OptimizerType::STATISTICS_PROPAGATION},
     {"common_subexpressions", OptimizerType::COMMON_SUBEXPRESSIONS},
     {"common_aggregate", OptimizerType::COMMON_AGGREGATE},
+    {"common_subplan", OptimizerType::COMMON_SUBPLAN},
     {"column_lifetime", OptimizerType::COLUMN_LIFETIME},
+    {"order_elimination", OptimizerType::ORDER_ELIMINATION},
     {"top_n", OptimizerType::TOP_N},
     {"reorder_filter", OptimizerType::REORDER_FILTER},
     {"extension", OptimizerType::EXTENSION},
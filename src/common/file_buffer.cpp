@@ -39,6 +39,14 @@ FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(so
 	source.Init();
 }
 
+FileBuffer::FileBuffer(Allocator &allocator, FileBufferType type, data_ptr_t external_buffer, uint64_t user_size)
+    : allocator(allocator), type(type) {
+	Init();
+	// the external memory is not owned by this buffer: malloced_buffer remains unset so it is never freed
+	buffer = external_buffer;
+	size = user_size;
+}
+
 FileBuffer::~FileBuffer() {
 	if (!malloced_buffer) {
 		return;
@@ -47,17 +55,34 @@ FileBuffer::~FileBuffer() {
 }
 
 void FileBuffer::ReallocBuffer(size_t new_size) {
+	size_t malloc_size = new_size;
+	if (type != FileBufferType::TINY_BUFFER) {
+		// we never do IO on tiny buffers; all other buffers get extra padding so that the internal buffer can be
+		// sector-aligned, which DIRECT_IO requires for the pointers that are handed to the OS
+		malloc_size += Storage::SECTOR_SIZE;
+	}
+	idx_t previous_offset = internal_buffer ? idx_t(internal_buffer - malloced_buffer) : 0;
+	idx_t previous_size = internal_size;
 	if (malloced_buffer) {
-		malloced_buffer = allocator.ReallocateData(malloced_buffer, malloced_size, new_size);
+		malloced_buffer = allocator.ReallocateData(malloced_buffer, malloced_size, malloc_size);
 	} else {
-		malloced_buffer = allocator.AllocateData(new_size);
+		malloced_buffer = allocator.AllocateData(malloc_size);
 	}
 	if (!malloced_buffer) {
 		throw std::bad_alloc();
 	}
-	malloced_size = new_size;
-	internal_buffer = malloced_buffer;
-	internal_size = malloced_size;
+	malloced_size = malloc_size;
+	if (type == FileBufferType::TINY_BUFFER) {
+		internal_buffer = malloced_buffer;
+	} else {
+		internal_buffer = (data_ptr_t)AlignValue<uintptr_t, Storage::SECTOR_SIZE>((uintptr_t)malloced_buffer);
+		idx_t new_offset = idx_t(internal_buffer - malloced_buffer);
+		if (previous_size > 0 && new_offset != previous_offset) {
+			// the alignment offset changed after the reallocation: move the contents to the new aligned position
+			memmove(internal_buffer, malloced_buffer + previous_offset, MinValue<idx_t>(previous_size, new_size));
+		}
+	}
+	internal_size = new_size;
 	// Caller must update these.
 	buffer = nullptr;
 	size = 0;
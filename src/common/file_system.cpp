@@ -242,6 +242,18 @@ int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Read is not implemented!", GetName());
 }
 
+void FileSystem::Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// prefetching is a best-effort hint: file systems that cannot read ahead asynchronously can safely ignore it
+}
+
+data_ptr_t FileSystem::MemoryMapRead(FileHandle &handle, idx_t nr_bytes) {
+	// memory mapping is optional: callers fall back to regular reads when nullptr is returned
+	return nullptr;
+}
+
+void FileSystem::MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) {
+}
+
 int64_t FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Write is not implemented!", GetName());
 }
@@ -121,6 +121,12 @@ void MiniZStreamWrapper::Initialize(CompressedFile &file, bool write) {
 		auto read_count = file.child_handle->Read(gzip_hdr, GZIP_HEADER_MINSIZE);
 		GZipFileSystem::VerifyGZIPHeader(gzip_hdr, read_count);
 
+		if (gzip_hdr[3] & GZIP_FLAG_EXTRA) {
+			uint8_t xlen_field[2];
+			file.child_handle->Read(xlen_field, 2);
+			idx_t xlen = xlen_field[0] | (idx_t(xlen_field[1]) << 8);
+			data_start += 2 + xlen;
+		}
 		if (gzip_hdr[3] & GZIP_FLAG_NAME) {
 			file.child_handle->Seek(data_start);
 			data_start += GZipConsumeString(*file.child_handle);
@@ -135,6 +141,43 @@ void MiniZStreamWrapper::Initialize(CompressedFile &file, bool write) {
 }
 
 bool MiniZStreamWrapper::Read(StreamData &sd) {
+	// a member of the gzip file ended in the previous call: gzip files can consist of multiple concatenated members
+	// (e.g. bgzf blocks or the result of concatenating gzip files), so check if another member follows the footer
+	if (sd.refresh) {
+		sd.refresh = false;
+		auto available = (idx_t)(sd.in_buff_end - sd.in_buff_start);
+		if (available < MiniZStream::GZIP_FOOTER_SIZE + GZIP_HEADER_MINSIZE) {
+			// only the footer of the last member remains: we are done
+			Close();
+			return true;
+		}
+		auto body_ptr = sd.in_buff_start + MiniZStream::GZIP_FOOTER_SIZE;
+		uint8_t gzip_hdr[GZIP_HEADER_MINSIZE];
+		memcpy(gzip_hdr, body_ptr, GZIP_HEADER_MINSIZE);
+		GZipFileSystem::VerifyGZIPHeader(gzip_hdr, GZIP_HEADER_MINSIZE);
+		body_ptr += GZIP_HEADER_MINSIZE;
+		if (gzip_hdr[3] & GZIP_FLAG_EXTRA) {
+			idx_t xlen = (uint8_t)body_ptr[0] | (idx_t((uint8_t)body_ptr[1]) << 8);
+			body_ptr += 2 + xlen;
+		}
+		if (gzip_hdr[3] & GZIP_FLAG_NAME) {
+			char c;
+			do {
+				c = *body_ptr;
+				body_ptr++;
+			} while (c != '\0' && body_ptr < sd.in_buff_end);
+		}
+		sd.in_buff_start = (data_ptr_t)body_ptr;
+		if (sd.in_buff_end - sd.in_buff_start < 1) {
+			Close();
+			return true;
+		}
+		duckdb_miniz::mz_inflateEnd(mz_stream_ptr);
+		auto ret = duckdb_miniz::mz_inflateInit2((duckdb_miniz::mz_streamp)mz_stream_ptr, -MZ_DEFAULT_WINDOW_BITS);
+		if (ret != duckdb_miniz::MZ_OK) {
+			throw InternalException("Failed to initialize miniz");
+		}
+	}
 	// actually decompress
 	mz_stream_ptr->next_in = (data_ptr_t)sd.in_buff_start;
 	D_ASSERT(sd.in_buff_end - sd.in_buff_start < NumericLimits<int32_t>::Maximum());
@@ -150,10 +193,9 @@ bool MiniZStreamWrapper::Read(StreamData &sd) {
 	sd.in_buff_end = sd.in_buff_start + mz_stream_ptr->avail_in;
 	sd.out_buff_end = (data_ptr_t)mz_stream_ptr->next_out;
 	D_ASSERT(sd.out_buff_end + mz_stream_ptr->avail_out == sd.out_buff.get() + sd.out_buf_size);
-	// if stream ended, deallocate inflator
+	// if the stream ended, another member may follow: request an input refill and check on the next call
 	if (ret == duckdb_miniz::MZ_STREAM_END) {
-		Close();
-		return true;
+		sd.refresh = true;
 	}
 	return false;
 }
@@ -2,7 +2,7 @@
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/execution/expression_executor.hpp"
-#include "duckdb/optimizer/filter_combiner.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "re2/re2.h"
 
@@ -36,26 +36,36 @@ static unordered_map<column_t, string> GetKnownColumnValues(string &filename,
 	return result;
 }
 
-// Takes an expression and converts a list of known column_refs to constants
-static void ConvertKnownColRefToConstants(unique_ptr<Expression> &expr,
-                                          unordered_map<column_t, string> &known_column_values, idx_t table_index) {
+// Takes an expression and converts the column refs of this table that the file paths provide values for into
+// references into a chunk of partition values. Returns false if any other column ref (or a subquery) remains,
+// i.e., if the expression cannot be evaluated from the file path alone.
+static bool ConvertKnownColRefsToBoundRefs(unique_ptr<Expression> &expr,
+                                           const unordered_map<column_t, idx_t> &column_positions,
+                                           idx_t table_index) {
 	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = (BoundColumnRefExpression &)*expr;
 
 		// This bound column ref is for another table
 		if (table_index != bound_colref.binding.table_index) {
-			return;
+			return false;
 		}
 
-		auto lookup = known_column_values.find(bound_colref.binding.column_index);
-		if (lookup != known_column_values.end()) {
-			expr = make_unique<BoundConstantExpression>(Value(lookup->second));
+		auto lookup = column_positions.find(bound_colref.binding.column_index);
+		if (lookup == column_positions.end()) {
+			// The file paths do not provide a value for this column
+			return false;
 		}
-	} else {
-		ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
-			ConvertKnownColRefToConstants(child, known_column_values, table_index);
-		});
+		expr = make_unique<BoundReferenceExpression>(LogicalType::VARCHAR, lookup->second);
+		return true;
+	}
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_SUBQUERY) {
+		return false;
 	}
+	bool can_evaluate = true;
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		can_evaluate = ConvertKnownColRefsToBoundRefs(child, column_positions, table_index) && can_evaluate;
+	});
+	return can_evaluate;
 }
 
 // matches hive partitions in file name. For example:
@@ -87,42 +97,102 @@ void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<str
                                               vector<unique_ptr<Expression>> &filters,
                                               unordered_map<string, column_t> &column_map, idx_t table_index,
                                               bool hive_enabled, bool filename_enabled) {
-	vector<string> pruned_files;
-	vector<unique_ptr<Expression>> pruned_filters;
-	duckdb_re2::RE2 regex(REGEX_STRING);
-
 	if ((!filename_enabled && !hive_enabled) || filters.empty()) {
 		return;
 	}
+	duckdb_re2::RE2 regex(REGEX_STRING);
 
-	for (idx_t i = 0; i < files.size(); i++) {
-		auto &file = files[i];
-		bool should_prune_file = false;
-		auto known_values = GetKnownColumnValues(file, column_map, regex, filename_enabled, hive_enabled);
+	// Parse every file path once into the column values that the path provides
+	vector<unordered_map<column_t, string>> known_values;
+	known_values.reserve(files.size());
+	for (auto &file : files) {
+		known_values.emplace_back(GetKnownColumnValues(file, column_map, regex, filename_enabled, hive_enabled));
+	}
 
-		FilterCombiner combiner(context);
-		for (auto &filter : filters) {
-			unique_ptr<Expression> filter_copy = filter->Copy();
-			ConvertKnownColRefToConstants(filter_copy, known_values, table_index);
-			// Evaluate the filter, if it can be evaluated here, we can not prune this filter
-			Value result_value;
-			if (!filter_copy->IsScalar() || !filter_copy->IsFoldable() ||
-			    !ExpressionExecutor::TryEvaluateScalar(context, *filter_copy, result_value)) {
+	// Group the files by the set of columns their paths provide: each group is then pruned vectorized, over a
+	// columnar table of its partition values. A uniform partition tree yields a single group.
+	map<vector<column_t>, vector<idx_t>> file_groups;
+	for (idx_t file_idx = 0; file_idx < files.size(); file_idx++) {
+		vector<column_t> signature;
+		signature.reserve(known_values[file_idx].size());
+		for (auto &entry : known_values[file_idx]) {
+			signature.push_back(entry.first);
+		}
+		std::sort(signature.begin(), signature.end());
+		file_groups[std::move(signature)].push_back(file_idx);
+	}
+
+	vector<bool> keep_file(files.size(), true);
+	vector<bool> keep_filter(filters.size(), false);
+
+	for (auto &group : file_groups) {
+		const auto &signature = group.first;
+		const auto &group_file_indices = group.second;
+
+		// Map the column ids to their positions in the partition value chunk
+		unordered_map<column_t, idx_t> column_positions;
+		for (idx_t col_pos = 0; col_pos < signature.size(); col_pos++) {
+			column_positions[signature[col_pos]] = col_pos;
+		}
+
+		DataChunk chunk;
+		const vector<LogicalType> chunk_types(signature.size(), LogicalType::VARCHAR);
+		chunk.Initialize(context, chunk_types);
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+
+		for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+			auto filter_copy = filters[filter_idx]->Copy();
+			if (!ConvertKnownColRefsToBoundRefs(filter_copy, column_positions, table_index) ||
+			    filter_copy->HasSideEffects()) {
 				// can not be evaluated only with the filename/hive columns added, we can not prune this filter
-				pruned_filters.emplace_back(filter->Copy());
-			} else if (!result_value.GetValue<bool>()) {
-				// filter evaluates to false
-				should_prune_file = true;
+				keep_filter[filter_idx] = true;
+				continue;
 			}
 
-			// Use filter combiner to determine that this filter makes
-			if (!should_prune_file && combiner.AddFilter(std::move(filter_copy)) == FilterResult::UNSATISFIABLE) {
-				should_prune_file = true;
+			// Evaluate the filter over all files of the group, a vector at a time; files for which it
+			// returns false (or NULL, which filters out every row of the file) are pruned
+			ExpressionExecutor executor(context, *filter_copy);
+			for (idx_t offset = 0; offset < group_file_indices.size(); offset += STANDARD_VECTOR_SIZE) {
+				const auto batch_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, group_file_indices.size() - offset);
+				chunk.Reset();
+				for (idx_t col_pos = 0; col_pos < signature.size(); col_pos++) {
+					auto &column = chunk.data[col_pos];
+					auto column_data = FlatVector::GetData<string_t>(column);
+					for (idx_t i = 0; i < batch_count; i++) {
+						auto &value = known_values[group_file_indices[offset + i]].at(signature[col_pos]);
+						column_data[i] = StringVector::AddString(column, value);
+					}
+				}
+				chunk.SetCardinality(batch_count);
+
+				const auto selected_count = executor.SelectExpression(chunk, sel);
+				if (selected_count == batch_count) {
+					continue;
+				}
+				vector<bool> batch_keep(batch_count, false);
+				for (idx_t i = 0; i < selected_count; i++) {
+					batch_keep[sel.get_index(i)] = true;
+				}
+				for (idx_t i = 0; i < batch_count; i++) {
+					if (!batch_keep[i]) {
+						keep_file[group_file_indices[offset + i]] = false;
+					}
+				}
 			}
 		}
+	}
 
-		if (!should_prune_file) {
-			pruned_files.push_back(file);
+	vector<unique_ptr<Expression>> pruned_filters;
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		if (keep_filter[filter_idx]) {
+			pruned_filters.emplace_back(std::move(filters[filter_idx]));
+		}
+	}
+	vector<string> pruned_files;
+	pruned_files.reserve(files.size());
+	for (idx_t file_idx = 0; file_idx < files.size(); file_idx++) {
+		if (keep_file[file_idx]) {
+			pruned_files.push_back(std::move(files[file_idx]));
 		}
 	}
 
@@ -130,4 +200,128 @@ void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<str
 	files = std::move(pruned_files);
 }
 
+HivePartitionedColumnData::HivePartitionedColumnData(const HivePartitionedColumnData &other)
+    : PartitionedColumnData(other), global_state(other.global_state), group_by_columns(other.group_by_columns),
+      hashes_v(LogicalType::HASH) {
+	// Since we're creating a new PartitionedColumnData, we need to make a copy of the last known partition map from
+	// the global state: this ensures this thread can lookup the partitions that other threads have already discovered
+	if (global_state) {
+		lock_guard<mutex> guard(global_state->lock);
+		SynchronizeLocalMap();
+	}
+}
+
+void HivePartitionedColumnData::ComputePartitionIndices(PartitionedColumnDataAppendState &state, DataChunk &input) {
+	const auto count = input.size();
+
+	input.Hash(group_by_columns, hashes_v);
+	hashes_v.Flatten(count);
+
+	for (idx_t i = 0; i < count; i++) {
+		HivePartitionKey key;
+		key.hash = FlatVector::GetData<hash_t>(hashes_v)[i];
+		for (auto &col : group_by_columns) {
+			key.values.emplace_back(input.GetValue(col, i));
+		}
+
+		auto lookup = local_partition_map.find(key);
+		const auto partition_indices = FlatVector::GetData<idx_t>(state.partition_indices);
+		if (lookup == local_partition_map.end()) {
+			idx_t new_partition_id = RegisterNewPartition(std::move(key), state);
+			partition_indices[i] = new_partition_id;
+		} else {
+			partition_indices[i] = lookup->second;
+		}
+	}
+}
+
+std::map<idx_t, const HivePartitionKey *> HivePartitionedColumnData::GetReverseMap() {
+	std::map<idx_t, const HivePartitionKey *> ret;
+	for (const auto &pair : local_partition_map) {
+		ret[pair.second] = &(pair.first);
+	}
+	return ret;
+}
+
+void HivePartitionedColumnData::GrowAllocators() {
+	lock_guard<mutex> guard(allocators->lock);
+
+	idx_t current_allocator_size = allocators->allocators.size();
+	idx_t required_allocators = local_partition_map.size();
+
+	allocators->allocators.reserve(required_allocators);
+	for (idx_t i = current_allocator_size; i < required_allocators; i++) {
+		CreateAllocator();
+	}
+
+	D_ASSERT(allocators->allocators.size() == local_partition_map.size());
+}
+
+void HivePartitionedColumnData::GrowAppendState(PartitionedColumnDataAppendState &state) {
+	idx_t current_append_state_size = state.partition_append_states.size();
+	idx_t required_append_state_size = local_partition_map.size();
+
+	for (idx_t i = current_append_state_size; i < required_append_state_size; i++) {
+		state.partition_append_states.emplace_back(make_unique<ColumnDataAppendState>());
+		state.partition_buffers.emplace_back(CreatePartitionBuffer());
+	}
+}
+
+void HivePartitionedColumnData::GrowPartitions(PartitionedColumnDataAppendState &state) {
+	idx_t current_partitions = partitions.size();
+	idx_t required_partitions = local_partition_map.size();
+
+	D_ASSERT(allocators->allocators.size() == required_partitions);
+
+	for (idx_t i = current_partitions; i < required_partitions; i++) {
+		partitions.emplace_back(CreatePartitionCollection(i));
+		partitions[i]->InitializeAppend(*state.partition_append_states[i]);
+	}
+	D_ASSERT(partitions.size() == local_partition_map.size());
+}
+
+void HivePartitionedColumnData::SynchronizeLocalMap() {
+	// Synchronise global map into local, may contain changes from other threads too
+	for (auto it = global_state->partitions.begin() + local_partition_map.size(); it < global_state->partitions.end();
+	     it++) {
+		local_partition_map[(*it)->first] = (*it)->second;
+	}
+}
+
+idx_t HivePartitionedColumnData::RegisterNewPartition(HivePartitionKey key, PartitionedColumnDataAppendState &state) {
+	idx_t partition_id;
+	if (global_state) {
+		// Synchronize Global state with our local state with the newly discovered partition
+		{
+			lock_guard<mutex> guard(global_state->lock);
+
+			// Insert into global map, or return partition if already present
+			auto res =
+			    global_state->partition_map.emplace(std::make_pair(std::move(key), global_state->partition_map.size()));
+			auto it = res.first;
+			partition_id = it->second;
+
+			// Add iterator to the latest local map state
+			if (res.second) {
+				global_state->partitions.emplace_back(it);
+			}
+
+			SynchronizeLocalMap();
+		}
+	} else {
+		partition_id = local_partition_map.size();
+		local_partition_map.emplace(std::make_pair(std::move(key), partition_id));
+	}
+
+	// After synchronizing with the global state, we need to grow the shared allocators to support
+	// the number of partitions, which guarantees that there's always enough allocators available to each thread
+	GrowAllocators();
+
+	// Grow local partition data
+	GrowAppendState(state);
+	GrowPartitions(state);
+
+	return partition_id;
+}
+
 } // namespace duckdb
@@ -17,6 +17,7 @@
 #ifndef _WIN32
 #include <dirent.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <string.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -279,6 +280,28 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 	return bytes_read;
 }
 
+void LocalFileSystem::Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+#if defined(POSIX_FADV_WILLNEED)
+	int fd = ((UnixFileHandle &)handle).fd;
+	// the kernel starts reading the advised range into the page cache asynchronously,
+	// so a subsequent Read does not have to wait for the device
+	posix_fadvise(fd, location, nr_bytes, POSIX_FADV_WILLNEED);
+#endif
+}
+
+data_ptr_t LocalFileSystem::MemoryMapRead(FileHandle &handle, idx_t nr_bytes) {
+	int fd = ((UnixFileHandle &)handle).fd;
+	auto pointer = mmap(nullptr, nr_bytes, PROT_READ, MAP_SHARED, fd, 0);
+	if (pointer == MAP_FAILED) {
+		return nullptr;
+	}
+	return (data_ptr_t)pointer;
+}
+
+void LocalFileSystem::MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) {
+	munmap(pointer, nr_bytes);
+}
+
 void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	int fd = ((UnixFileHandle &)handle).fd;
 	int64_t bytes_written = pwrite(fd, buffer, nr_bytes, location);
@@ -602,6 +625,26 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 	return bytes_read;
 }
 
+void LocalFileSystem::Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// no asynchronous read-ahead hint on Windows
+}
+
+data_ptr_t LocalFileSystem::MemoryMapRead(FileHandle &handle, idx_t nr_bytes) {
+	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
+	HANDLE mapping = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		return nullptr;
+	}
+	auto pointer = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, nr_bytes);
+	// the view keeps the mapping object alive: the handle can be closed immediately
+	CloseHandle(mapping);
+	return (data_ptr_t)pointer;
+}
+
+void LocalFileSystem::MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) {
+	UnmapViewOfFile(pointer);
+}
+
 static DWORD FSInternalWrite(FileHandle &handle, HANDLE hFile, void *buffer, int64_t nr_bytes, idx_t location) {
 	DWORD bytes_written = 0;
 	OVERLAPPED ov = {};
@@ -0,0 +1,130 @@
+#include "duckdb/common/perf_counters.hpp"
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+PerfEventCounters::PerfEventCounters() {
+	for (idx_t i = 0; i < MAX_EVENTS; i++) {
+		event_fds[i] = -1;
+		event_ids[i] = 0;
+	}
+}
+
+#if defined(__linux__)
+
+static int PerfEventOpen(uint32_t type, uint64_t config, int group_fd) {
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = type;
+	attr.size = sizeof(attr);
+	attr.config = config;
+	attr.disabled = group_fd == -1 ? 1 : 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+bool PerfEventCounters::Initialize() {
+	if (active) {
+		return true;
+	}
+	// the group leader must open: without instructions there is little to report
+	static constexpr uint64_t EVENT_CONFIGS[MAX_EVENTS] = {PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+	                                                       PERF_COUNT_HW_STALLED_CYCLES_BACKEND};
+	for (idx_t i = 0; i < MAX_EVENTS; i++) {
+		auto fd = PerfEventOpen(PERF_TYPE_HARDWARE, EVENT_CONFIGS[i], group_fd);
+		if (fd < 0) {
+			// not every machine exposes every counter; missing members simply report zero
+			continue;
+		}
+		if (group_fd == -1) {
+			group_fd = fd;
+		}
+		ioctl(fd, PERF_EVENT_IOC_ID, &event_ids[i]);
+		event_fds[i] = fd;
+	}
+	if (group_fd == -1) {
+		return false;
+	}
+	active = true;
+	return true;
+}
+
+void PerfEventCounters::Begin() {
+	if (!active) {
+		return;
+	}
+	ioctl(group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void PerfEventCounters::End() {
+	if (!active) {
+		return;
+	}
+	ioctl(group_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+	struct {
+		uint64_t nr;
+		struct {
+			uint64_t value;
+			uint64_t id;
+		} values[MAX_EVENTS];
+	} buffer;
+	auto bytes = read(group_fd, &buffer, sizeof(buffer));
+	if (bytes < (decltype(bytes))sizeof(uint64_t)) {
+		return;
+	}
+	for (uint64_t value_idx = 0; value_idx < buffer.nr && value_idx < MAX_EVENTS; value_idx++) {
+		auto &value = buffer.values[value_idx];
+		if (event_fds[0] >= 0 && value.id == event_ids[0]) {
+			instructions += value.value;
+		} else if (event_fds[1] >= 0 && value.id == event_ids[1]) {
+			llc_misses += value.value;
+		} else if (event_fds[2] >= 0 && value.id == event_ids[2]) {
+			stalled_cycles += value.value;
+		}
+	}
+}
+
+PerfEventCounters::~PerfEventCounters() {
+	for (idx_t i = 0; i < MAX_EVENTS; i++) {
+		if (event_fds[i] >= 0) {
+			close(event_fds[i]);
+		}
+	}
+}
+
+#else
+
+bool PerfEventCounters::Initialize() {
+	// hardware counters are only supported through perf_event_open on Linux
+	return false;
+}
+
+void PerfEventCounters::Begin() {
+}
+
+void PerfEventCounters::End() {
+}
+
+PerfEventCounters::~PerfEventCounters() {
+}
+
+#endif
+
+void PerfEventCounters::Reset() {
+	instructions = 0;
+	llc_misses = 0;
+	stalled_cycles = 0;
+}
+
+} // namespace duckdb
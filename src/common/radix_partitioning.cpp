@@ -186,6 +186,9 @@ struct PartitionFunctor {
 			pos[idx] = idx * CONSTANTS::TMP_BUF_SIZE;
 		}
 
+		// The partition indices of the current batch of rows
+		hash_t bins[STANDARD_VECTOR_SIZE];
+
 		auto &data_blocks = block_collection.blocks;
 		auto &heap_blocks = string_heap.blocks;
 		for (idx_t block_idx_plus_one = data_blocks.size(); block_idx_plus_one > 0; block_idx_plus_one--) {
@@ -214,8 +217,16 @@ struct PartitionFunctor {
 					RowOperations::UnswizzleHeapPointer(layout, data_ptr, heap_handle.Ptr(), next);
 				}
 
+				// Extract the hashes and apply the mask in a tight loop first, separate from the scattering
+				// copies below, so that the compiler can vectorize it
+				auto hash_ptr = data_ptr + hash_offset;
+				for (idx_t i = 0; i < next; i++) {
+					bins[i] = CONSTANTS::ApplyMask(Load<hash_t>(hash_ptr));
+					hash_ptr += row_width;
+				}
+
 				for (idx_t i = 0; i < next; i++) {
-					const auto bin = CONSTANTS::ApplyMask(Load<hash_t>(data_ptr + hash_offset));
+					const auto bin = bins[i];
 
 					// Write entry to bin in temp buf
 					FastMemcpy(tmp_buf + pos[bin] * row_width, data_ptr, row_width);
@@ -6,6 +6,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/operator/constant_operators.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/row_data_collection.hpp"
 #include "duckdb/common/types/row_layout.hpp"
 
@@ -28,18 +29,21 @@ static void TemplatedGatherLoop(Vector &rows, const SelectionVector &row_sel, Ve
 	auto data = FlatVector::GetData<T>(col);
 	auto &col_mask = FlatVector::Validity(col);
 
+	// first pass: reconstruct the values with a tight branch-free loop over the row pointers
 	for (idx_t i = 0; i < count; i++) {
-		auto row_idx = row_sel.get_index(i);
-		auto row = ptrs[row_idx];
-		auto col_idx = col_sel.get_index(i);
-		data[col_idx] = Load<T>(row + col_offset);
+		data[col_sel.get_index(i)] = Load<T>(ptrs[row_sel.get_index(i)] + col_offset);
+	}
+	// second pass: check the validity bytes, which sit at the front of the rows that the first pass
+	// just pulled into cache; the output mask is only touched when a NULL shows up
+	for (idx_t i = 0; i < count; i++) {
+		auto row = ptrs[row_sel.get_index(i)];
 		ValidityBytes row_mask(row);
 		if (!row_mask.RowIsValid(row_mask.GetValidityEntry(entry_idx), idx_in_entry)) {
 			if (build_size > STANDARD_VECTOR_SIZE && col_mask.AllValid()) {
 				//! We need to initialize the mask with the vector size.
 				col_mask.Initialize(build_size);
 			}
-			col_mask.SetInvalid(col_idx);
+			col_mask.SetInvalid(col_sel.get_index(i));
 		}
 	}
 }
@@ -171,6 +175,109 @@ void RowOperations::Gather(Vector &rows, const SelectionVector &row_sel, Vector
 	}
 }
 
+static bool TypeIsFixedWidthGather(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::INTERVAL:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! The per-column state of a multi-column gather
+struct GatherColumnInfo {
+	//! The output data
+	data_ptr_t data;
+	//! The output validity mask
+	ValidityMask *mask;
+	//! The byte offset of the column within the rows
+	idx_t col_offset;
+	//! The byte width of the column
+	idx_t width;
+	//! Precomputed validity mask indexes of the column
+	idx_t entry_idx;
+	idx_t idx_in_entry;
+};
+
+void RowOperations::Gather(Vector &rows, const SelectionVector &row_sel, DataChunk &result, const idx_t result_col_no,
+                           const SelectionVector &col_sel, const idx_t count, const RowLayout &layout,
+                           const idx_t col_no, const idx_t col_count, const idx_t build_size, data_ptr_t heap_ptr) {
+	D_ASSERT(rows.GetVectorType() == VectorType::FLAT_VECTOR);
+	D_ASSERT(rows.GetType().id() == LogicalTypeId::POINTER);
+	D_ASSERT(result_col_no + col_count <= result.ColumnCount());
+
+	// columns that reference the row heap are gathered one column at a time; the fixed-width columns
+	// are reconstructed together below, so that every row is only pulled into cache once
+	vector<GatherColumnInfo> fixed_columns;
+	const auto &offsets = layout.GetOffsets();
+	for (idx_t i = 0; i < col_count; i++) {
+		auto &col = result.data[result_col_no + i];
+		if (!TypeIsFixedWidthGather(col.GetType().InternalType())) {
+			Gather(rows, row_sel, col, col_sel, count, layout, col_no + i, build_size, heap_ptr);
+			continue;
+		}
+		col.SetVectorType(VectorType::FLAT_VECTOR);
+		GatherColumnInfo info;
+		info.data = FlatVector::GetData(col);
+		info.mask = &FlatVector::Validity(col);
+		info.col_offset = offsets[col_no + i];
+		info.width = GetTypeIdSize(col.GetType().InternalType());
+		ValidityBytes::GetEntryIndex(col_no + i, info.entry_idx, info.idx_in_entry);
+		fixed_columns.push_back(info);
+	}
+	if (fixed_columns.empty()) {
+		return;
+	}
+	auto ptrs = FlatVector::GetData<data_ptr_t>(rows);
+	for (idx_t i = 0; i < count; i++) {
+		auto row = ptrs[row_sel.get_index(i)];
+		auto col_idx = col_sel.get_index(i);
+		// the validity bytes at the front of the row serve all of the columns
+		ValidityBytes row_mask(row);
+		for (auto &info : fixed_columns) {
+			auto dst = info.data + col_idx * info.width;
+			auto src = row + info.col_offset;
+			switch (info.width) {
+			case 1:
+				memcpy(dst, src, 1);
+				break;
+			case 2:
+				memcpy(dst, src, 2);
+				break;
+			case 4:
+				memcpy(dst, src, 4);
+				break;
+			case 8:
+				memcpy(dst, src, 8);
+				break;
+			default:
+				D_ASSERT(info.width == sizeof(interval_t));
+				memcpy(dst, src, sizeof(interval_t));
+				break;
+			}
+			if (!row_mask.RowIsValid(row_mask.GetValidityEntry(info.entry_idx), info.idx_in_entry)) {
+				if (build_size > STANDARD_VECTOR_SIZE && info.mask->AllValid()) {
+					//! We need to initialize the mask with the vector size.
+					info.mask->Initialize(build_size);
+				}
+				info.mask->SetInvalid(col_idx);
+			}
+		}
+	}
+}
+
 template <class T>
 static void TemplatedFullScanLoop(Vector &rows, Vector &col, idx_t count, idx_t col_offset, idx_t col_no) {
 	// Precompute mask indexes
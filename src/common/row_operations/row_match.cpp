@@ -261,4 +261,89 @@ idx_t RowOperations::Match(DataChunk &columns, UnifiedVectorFormat col_data[], c
 	return count;
 }
 
+//===--------------------------------------------------------------------===//
+// Specialized matchers
+//===--------------------------------------------------------------------===//
+// Hash table probes overwhelmingly compare a handful of fixed-type keys for equality; these matchers fix the key
+// types at initialization time so that the per-chunk type dispatch of the generic Match disappears from the probe
+
+template <class T>
+static idx_t TemplatedSingleKeyMatch(DataChunk &columns, UnifiedVectorFormat col_data[], const RowLayout &layout,
+                                     Vector &rows, const Predicates &predicates, SelectionVector &sel, idx_t count,
+                                     SelectionVector *no_match, idx_t &no_match_count) {
+	const auto col_offset = layout.GetOffsets()[0];
+	if (no_match) {
+		TemplatedMatchType<T, Equals, true>(col_data[0], rows, sel, count, col_offset, 0, no_match, no_match_count);
+	} else {
+		TemplatedMatchType<T, Equals, false>(col_data[0], rows, sel, count, col_offset, 0, no_match, no_match_count);
+	}
+	return count;
+}
+
+template <class A, class B>
+static idx_t TemplatedTwoKeyMatch(DataChunk &columns, UnifiedVectorFormat col_data[], const RowLayout &layout,
+                                  Vector &rows, const Predicates &predicates, SelectionVector &sel, idx_t count,
+                                  SelectionVector *no_match, idx_t &no_match_count) {
+	const auto &offsets = layout.GetOffsets();
+	if (no_match) {
+		TemplatedMatchType<A, Equals, true>(col_data[0], rows, sel, count, offsets[0], 0, no_match, no_match_count);
+		TemplatedMatchType<B, Equals, true>(col_data[1], rows, sel, count, offsets[1], 1, no_match, no_match_count);
+	} else {
+		TemplatedMatchType<A, Equals, false>(col_data[0], rows, sel, count, offsets[0], 0, no_match, no_match_count);
+		TemplatedMatchType<B, Equals, false>(col_data[1], rows, sel, count, offsets[1], 1, no_match, no_match_count);
+	}
+	return count;
+}
+
+template <class A>
+static RowOperations::match_function_t TwoKeyMatchSwitch(const PhysicalType second_type) {
+	switch (second_type) {
+	case PhysicalType::INT32:
+		return TemplatedTwoKeyMatch<A, int32_t>;
+	case PhysicalType::INT64:
+		return TemplatedTwoKeyMatch<A, int64_t>;
+	default:
+		return RowOperations::Match;
+	}
+}
+
+RowOperations::match_function_t RowOperations::InitializeMatch(const RowLayout &layout, const Predicates &predicates) {
+	for (auto &predicate : predicates) {
+		switch (predicate) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+		case ExpressionType::COMPARE_DISTINCT_FROM:
+			// these are all resolved with Equals semantics in the generic Match
+			break;
+		default:
+			return RowOperations::Match;
+		}
+	}
+	auto &types = layout.GetTypes();
+	D_ASSERT(predicates.size() <= types.size());
+	if (predicates.size() == 1) {
+		switch (types[0].InternalType()) {
+		case PhysicalType::INT32:
+			return TemplatedSingleKeyMatch<int32_t>;
+		case PhysicalType::INT64:
+			return TemplatedSingleKeyMatch<int64_t>;
+		case PhysicalType::VARCHAR:
+			return TemplatedSingleKeyMatch<string_t>;
+		default:
+			return RowOperations::Match;
+		}
+	}
+	if (predicates.size() == 2) {
+		switch (types[0].InternalType()) {
+		case PhysicalType::INT32:
+			return TwoKeyMatchSwitch<int32_t>(types[1].InternalType());
+		case PhysicalType::INT64:
+			return TwoKeyMatchSwitch<int64_t>(types[1].InternalType());
+		default:
+			return RowOperations::Match;
+		}
+	}
+	return RowOperations::Match;
+}
+
 } // namespace duckdb
@@ -195,10 +195,21 @@ void RadixScatterStructVector(Vector &v, UnifiedVectorFormat &vdata, idx_t vcoun
 		}
 		width--;
 	}
-	// serialize the struct
-	auto &child_vector = *StructVector::GetEntries(v)[0];
-	RowOperations::RadixScatter(child_vector, vcount, *FlatVector::IncrementalSelectionVector(), add_count,
-	                            key_locations, false, true, false, prefix_len, width, offset);
+	// serialize the struct children: all leading constant-size children are encoded completely, and the
+	// first variable-size child is prefix-encoded (mirrors GetNestedSortingColSize in the sort layout)
+	auto &children = StructVector::GetEntries(v);
+	idx_t child_width = width;
+	for (idx_t child_idx = 0; child_idx < children.size(); child_idx++) {
+		auto &child_vector = *children[child_idx];
+		RowOperations::RadixScatter(child_vector, vcount, *FlatVector::IncrementalSelectionVector(), add_count,
+		                            key_locations, false, true, false, prefix_len, child_width, offset);
+		auto child_physical_type = child_vector.GetType().InternalType();
+		if (!TypeIsConstantSize(child_physical_type)) {
+			break;
+		}
+		// constant-size children consume their validity byte and fixed-size encoding
+		child_width -= GetTypeIdSize(child_physical_type) + 1;
+	}
 	// invert bits if desc
 	if (desc) {
 		for (idx_t i = 0; i < add_count; i++) {
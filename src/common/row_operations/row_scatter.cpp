@@ -223,4 +223,110 @@ void RowOperations::Scatter(DataChunk &columns, UnifiedVectorFormat col_data[],
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Specialized scatters
+//===--------------------------------------------------------------------===//
+// Aggregation layouts overwhelmingly consist of one or two fixed-width group columns followed by the 64-bit group
+// hash; these scatters fix the column types at initialization time so that serializing new groups becomes a single
+// loop over the rows instead of a per-column dispatch over the layout
+
+template <class T>
+static inline void ScatterValue(UnifiedVectorFormat &col, const idx_t idx, const data_ptr_t row,
+                                const idx_t col_offset, const idx_t col_no) {
+	auto col_idx = col.sel->get_index(idx);
+	auto data = (T *)col.data;
+	if (col.validity.RowIsValid(col_idx)) {
+		Store<T>(data[col_idx], row + col_offset);
+	} else {
+		Store<T>(NullValue<T>(), row + col_offset);
+		ValidityBytes(row).SetInvalidUnsafe(col_no);
+	}
+}
+
+template <class A, class B>
+static void TemplatedFixedScatter2(DataChunk &columns, UnifiedVectorFormat col_data[], const RowLayout &layout,
+                                   Vector &rows, RowDataCollection &string_heap, const SelectionVector &sel,
+                                   idx_t count) {
+	auto ptrs = FlatVector::GetData<data_ptr_t>(rows);
+	const auto &offsets = layout.GetOffsets();
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		auto row = ptrs[idx];
+		ValidityBytes(row).SetAllValid(2);
+		ScatterValue<A>(col_data[0], idx, row, offsets[0], 0);
+		ScatterValue<B>(col_data[1], idx, row, offsets[1], 1);
+	}
+}
+
+template <class A, class B, class C>
+static void TemplatedFixedScatter3(DataChunk &columns, UnifiedVectorFormat col_data[], const RowLayout &layout,
+                                   Vector &rows, RowDataCollection &string_heap, const SelectionVector &sel,
+                                   idx_t count) {
+	auto ptrs = FlatVector::GetData<data_ptr_t>(rows);
+	const auto &offsets = layout.GetOffsets();
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		auto row = ptrs[idx];
+		ValidityBytes(row).SetAllValid(3);
+		ScatterValue<A>(col_data[0], idx, row, offsets[0], 0);
+		ScatterValue<B>(col_data[1], idx, row, offsets[1], 1);
+		ScatterValue<C>(col_data[2], idx, row, offsets[2], 2);
+	}
+}
+
+template <class A, class B>
+static RowOperations::scatter_function_t ThreeColScatterSwitch(const PhysicalType third_type) {
+	switch (third_type) {
+	case PhysicalType::INT32:
+		return TemplatedFixedScatter3<A, B, int32_t>;
+	case PhysicalType::INT64:
+		return TemplatedFixedScatter3<A, B, int64_t>;
+	case PhysicalType::UINT64:
+		return TemplatedFixedScatter3<A, B, uint64_t>;
+	default:
+		return RowOperations::Scatter;
+	}
+}
+
+template <class A>
+static RowOperations::scatter_function_t TwoColScatterSwitch(const PhysicalType second_type,
+                                                             const PhysicalType third_type, const idx_t column_count) {
+	if (column_count == 2) {
+		switch (second_type) {
+		case PhysicalType::INT32:
+			return TemplatedFixedScatter2<A, int32_t>;
+		case PhysicalType::INT64:
+			return TemplatedFixedScatter2<A, int64_t>;
+		case PhysicalType::UINT64:
+			return TemplatedFixedScatter2<A, uint64_t>;
+		default:
+			return RowOperations::Scatter;
+		}
+	}
+	switch (second_type) {
+	case PhysicalType::INT32:
+		return ThreeColScatterSwitch<A, int32_t>(third_type);
+	case PhysicalType::INT64:
+		return ThreeColScatterSwitch<A, int64_t>(third_type);
+	default:
+		return RowOperations::Scatter;
+	}
+}
+
+RowOperations::scatter_function_t RowOperations::InitializeScatter(const RowLayout &layout) {
+	auto &types = layout.GetTypes();
+	if (!layout.AllConstant() || types.size() < 2 || types.size() > 3) {
+		return RowOperations::Scatter;
+	}
+	const auto third_type = types.size() == 3 ? types[2].InternalType() : PhysicalType::INVALID;
+	switch (types[0].InternalType()) {
+	case PhysicalType::INT32:
+		return TwoColScatterSwitch<int32_t>(types[1].InternalType(), third_type, types.size());
+	case PhysicalType::INT64:
+		return TwoColScatterSwitch<int64_t>(types[1].InternalType(), third_type, types.size());
+	default:
+		return RowOperations::Scatter;
+	}
+}
+
 } // namespace duckdb
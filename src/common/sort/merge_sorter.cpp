@@ -12,7 +12,7 @@ void MergeSorter::PerformInMergeRound() {
 	while (true) {
 		{
 			lock_guard<mutex> pair_guard(state.lock);
-			if (state.pair_idx == state.num_pairs) {
+			if (state.group_idx == state.num_groups) {
 				break;
 			}
 			GetNextPartition();
@@ -22,111 +22,120 @@ void MergeSorter::PerformInMergeRound() {
 }
 
 void MergeSorter::MergePartition() {
-	auto &left_block = *left->sb;
-	auto &right_block = *right->sb;
 #ifdef DEBUG
-	D_ASSERT(left_block.radix_sorting_data.size() == left_block.payload_data->data_blocks.size());
-	D_ASSERT(right_block.radix_sorting_data.size() == right_block.payload_data->data_blocks.size());
-	if (!state.payload_layout.AllConstant() && state.external) {
-		D_ASSERT(left_block.payload_data->data_blocks.size() == left_block.payload_data->heap_blocks.size());
-		D_ASSERT(right_block.payload_data->data_blocks.size() == right_block.payload_data->heap_blocks.size());
-	}
-	if (!sort_layout.all_constant) {
-		D_ASSERT(left_block.radix_sorting_data.size() == left_block.blob_sorting_data->data_blocks.size());
-		D_ASSERT(right_block.radix_sorting_data.size() == right_block.blob_sorting_data->data_blocks.size());
-		if (state.external) {
-			D_ASSERT(left_block.blob_sorting_data->data_blocks.size() ==
-			         left_block.blob_sorting_data->heap_blocks.size());
-			D_ASSERT(right_block.blob_sorting_data->data_blocks.size() ==
-			         right_block.blob_sorting_data->heap_blocks.size());
+	idx_t total_count = 0;
+	for (auto &run : runs) {
+		auto &block = *run->sb;
+		D_ASSERT(block.radix_sorting_data.size() == block.payload_data->data_blocks.size());
+		if (!state.payload_layout.AllConstant() && state.external) {
+			D_ASSERT(block.payload_data->data_blocks.size() == block.payload_data->heap_blocks.size());
+		}
+		if (!sort_layout.all_constant) {
+			D_ASSERT(block.radix_sorting_data.size() == block.blob_sorting_data->data_blocks.size());
+			if (state.external) {
+				D_ASSERT(block.blob_sorting_data->data_blocks.size() == block.blob_sorting_data->heap_blocks.size());
+			}
 		}
+		total_count += run->Remaining();
 	}
 #endif
 	// Set up the write block
 	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
 	result->InitializeWrite();
 	// Initialize arrays to store merge data
-	bool left_smaller[STANDARD_VECTOR_SIZE];
+	uint8_t run_index[STANDARD_VECTOR_SIZE];
 	idx_t next_entry_sizes[STANDARD_VECTOR_SIZE];
+	// The blob and payload data of the runs, merged in the same order as the radix data
+	vector<SortedData *> blob_data;
+	vector<SortedData *> payload_data;
+	for (auto &run : runs) {
+		if (!sort_layout.all_constant) {
+			blob_data.push_back(run->sb->blob_sorting_data.get());
+		}
+		payload_data.push_back(run->sb->payload_data.get());
+	}
 	// Merge loop
-#ifdef DEBUG
-	auto l_count = left->Remaining();
-	auto r_count = right->Remaining();
-#endif
 	while (true) {
-		auto l_remaining = left->Remaining();
-		auto r_remaining = right->Remaining();
-		if (l_remaining + r_remaining == 0) {
+		idx_t remaining = 0;
+		for (auto &run : runs) {
+			remaining += run->Remaining();
+		}
+		if (remaining == 0) {
 			// Done
 			break;
 		}
-		const idx_t next = MinValue(l_remaining + r_remaining, (idx_t)STANDARD_VECTOR_SIZE);
-		if (l_remaining != 0 && r_remaining != 0) {
-			// Compute the merge (not needed if one side is exhausted)
-			ComputeMerge(next, left_smaller);
-		}
+		const idx_t next = MinValue(remaining, (idx_t)STANDARD_VECTOR_SIZE);
+		// Compute the merge (which run each of the next tuples comes from)
+		ComputeMerge(next, run_index);
 		// Actually merge the data (radix, blob, and payload)
-		MergeRadix(next, left_smaller);
+		MergeRadix(next, run_index);
 		if (!sort_layout.all_constant) {
-			MergeData(*result->blob_sorting_data, *left_block.blob_sorting_data, *right_block.blob_sorting_data, next,
-			          left_smaller, next_entry_sizes, true);
+			MergeData(*result->blob_sorting_data, blob_data, next, run_index, next_entry_sizes, true);
 			D_ASSERT(result->radix_sorting_data.size() == result->blob_sorting_data->data_blocks.size());
 		}
-		MergeData(*result->payload_data, *left_block.payload_data, *right_block.payload_data, next, left_smaller,
-		          next_entry_sizes, false);
+		MergeData(*result->payload_data, payload_data, next, run_index, next_entry_sizes, false);
 		D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
 	}
 #ifdef DEBUG
-	D_ASSERT(result->Count() == l_count + r_count);
+	D_ASSERT(result->Count() == total_count);
 #endif
 }
 
 void MergeSorter::GetNextPartition() {
 	// Create result block
-	state.sorted_blocks_temp[state.pair_idx].push_back(make_unique<SortedBlock>(buffer_manager, state));
-	result = state.sorted_blocks_temp[state.pair_idx].back().get();
-	// Determine which blocks must be merged
-	auto &left_block = *state.sorted_blocks[state.pair_idx * 2];
-	auto &right_block = *state.sorted_blocks[state.pair_idx * 2 + 1];
-	const idx_t l_count = left_block.Count();
-	const idx_t r_count = right_block.Count();
-	// Initialize left and right reader
-	left = make_unique<SBScanState>(buffer_manager, state);
-	right = make_unique<SBScanState>(buffer_manager, state);
+	state.sorted_blocks_temp[state.group_idx].push_back(make_unique<SortedBlock>(buffer_manager, state));
+	result = state.sorted_blocks_temp[state.group_idx].back().get();
+	// Determine which runs must be merged
+	const idx_t group_start = state.group_idx * state.merge_fanout;
+	const idx_t group_end = MinValue(group_start + state.merge_fanout, state.sorted_blocks.size());
+	const idx_t num_runs = group_end - group_start;
+	vector<SortedBlock *> group_blocks;
+	idx_t remaining = 0;
+	for (idx_t r = 0; r < num_runs; r++) {
+		group_blocks.push_back(state.sorted_blocks[group_start + r].get());
+		remaining += group_blocks[r]->Count() - state.run_starts[r];
+	}
 	// Compute the work that this thread must do using Merge Path
-	idx_t l_end;
-	idx_t r_end;
-	if (state.l_start + state.r_start + state.block_capacity < l_count + r_count) {
-		left->sb = state.sorted_blocks[state.pair_idx * 2].get();
-		right->sb = state.sorted_blocks[state.pair_idx * 2 + 1].get();
-		const idx_t intersection = state.l_start + state.r_start + state.block_capacity;
-		GetIntersection(intersection, l_end, r_end);
-		D_ASSERT(l_end <= l_count);
-		D_ASSERT(r_end <= r_count);
-		D_ASSERT(intersection == l_end + r_end);
+	vector<idx_t> run_ends;
+	if (state.block_capacity < remaining) {
+		SelectBoundaries(group_blocks, state.run_starts, state.block_capacity, run_ends);
 	} else {
-		l_end = l_count;
-		r_end = r_count;
+		run_ends.resize(num_runs);
+		for (idx_t r = 0; r < num_runs; r++) {
+			run_ends[r] = group_blocks[r]->Count();
+		}
 	}
 	// Create slices of the data that this thread must merge
-	left->SetIndices(0, 0);
-	right->SetIndices(0, 0);
-	left_input = left_block.CreateSlice(state.l_start, l_end, left->entry_idx);
-	right_input = right_block.CreateSlice(state.r_start, r_end, right->entry_idx);
-	left->sb = left_input.get();
-	right->sb = right_input.get();
-	state.l_start = l_end;
-	state.r_start = r_end;
-	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity || (l_end == l_count && r_end == r_count));
+	runs.clear();
+	run_inputs.clear();
+	for (idx_t r = 0; r < num_runs; r++) {
+		auto run = make_unique<SBScanState>(buffer_manager, state);
+		run_inputs.push_back(group_blocks[r]->CreateSlice(state.run_starts[r], run_ends[r], run->entry_idx));
+		run->sb = run_inputs.back().get();
+		run->block_idx = 0;
+		runs.push_back(std::move(run));
+	}
 	// Update global state
-	if (state.l_start == l_count && state.r_start == r_count) {
-		// Delete references to previous pair
-		state.sorted_blocks[state.pair_idx * 2] = nullptr;
-		state.sorted_blocks[state.pair_idx * 2 + 1] = nullptr;
-		// Advance pair
-		state.pair_idx++;
-		state.l_start = 0;
-		state.r_start = 0;
+	state.run_starts = run_ends;
+	bool group_done = true;
+	for (idx_t r = 0; r < num_runs; r++) {
+		if (state.run_starts[r] != group_blocks[r]->Count()) {
+			group_done = false;
+			break;
+		}
+	}
+	if (group_done) {
+		// Delete references to the runs of this group
+		for (idx_t r = 0; r < num_runs; r++) {
+			state.sorted_blocks[group_start + r] = nullptr;
+		}
+		// Advance group
+		state.group_idx++;
+		if (state.group_idx < state.num_groups) {
+			const idx_t next_start = state.group_idx * state.merge_fanout;
+			const idx_t next_end = MinValue(next_start + state.merge_fanout, state.sorted_blocks.size());
+			state.run_starts.assign(next_end - next_start, 0);
+		}
 	}
 }
 
@@ -134,14 +143,6 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	D_ASSERT(l_idx < l.sb->Count());
 	D_ASSERT(r_idx < r.sb->Count());
 
-	// Easy comparison using the previous result (intersections must increase monotonically)
-	if (l_idx < state.l_start) {
-		return -1;
-	}
-	if (r_idx < state.r_start) {
-		return 1;
-	}
-
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
 
@@ -161,505 +162,362 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	return comp_res;
 }
 
-void MergeSorter::GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx) {
-	const idx_t l_count = left->sb->Count();
-	const idx_t r_count = right->sb->Count();
-	// Cover some edge cases
-	// Code coverage off because these edge cases cannot happen unless other code changes
-	// Edge cases have been tested extensively while developing Merge Path in a script
-	// LCOV_EXCL_START
-	if (diagonal >= l_count + r_count) {
-		l_idx = l_count;
-		r_idx = r_count;
-		return;
-	} else if (diagonal == 0) {
-		l_idx = 0;
-		r_idx = 0;
-		return;
-	} else if (l_count == 0) {
-		l_idx = 0;
-		r_idx = diagonal;
-		return;
-	} else if (r_count == 0) {
-		r_idx = 0;
-		l_idx = diagonal;
-		return;
+void MergeSorter::SelectBoundaries(const vector<SortedBlock *> &blocks, const vector<idx_t> &starts, const idx_t count,
+                                   vector<idx_t> &ends) {
+	const auto num_runs = blocks.size();
+	// Readers used for the comparisons
+	vector<unique_ptr<SBScanState>> readers;
+	for (idx_t r = 0; r < num_runs; r++) {
+		readers.push_back(make_unique<SBScanState>(buffer_manager, state));
+		readers.back()->sb = blocks[r];
 	}
-	// LCOV_EXCL_STOP
-	// Determine offsets for the binary search
-	const idx_t l_offset = MinValue(l_count, diagonal);
-	const idx_t r_offset = diagonal > l_count ? diagonal - l_count : 0;
-	D_ASSERT(l_offset + r_offset == diagonal);
-	const idx_t search_space = diagonal > MaxValue(l_count, r_count) ? l_count + r_count - diagonal
-	                                                                 : MinValue(diagonal, MinValue(l_count, r_count));
-	// Double binary search
-	idx_t li = 0;
-	idx_t ri = search_space - 1;
-	idx_t middle;
-	int comp_res;
-	while (li <= ri) {
-		middle = (li + ri) / 2;
-		l_idx = l_offset - middle;
-		r_idx = r_offset + middle;
-		if (l_idx == l_count || r_idx == 0) {
-			comp_res = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-			if (comp_res > 0) {
-				l_idx--;
-				r_idx++;
-			} else {
-				return;
+	// Generalization of Merge Path to k sorted runs: repeatedly discard a batch of 'm' rows from the run
+	// whose m'th next entry is the smallest. Every other run has fewer than m entries that sort before it,
+	// so all discarded entries are among the 'remaining' smallest entries of the group and belong in this
+	// partition. Halving 'm' as 'remaining' shrinks finds the exact boundary in O(k log n) comparisons.
+	ends = starts;
+	idx_t remaining = count;
+	while (remaining > 0) {
+		const idx_t m = MaxValue<idx_t>(remaining / num_runs, 1);
+		idx_t best_run = DConstants::INVALID_INDEX;
+		idx_t best_idx = 0;
+		for (idx_t r = 0; r < num_runs; r++) {
+			const idx_t run_count = blocks[r]->Count();
+			if (ends[r] == run_count) {
+				// This run is exhausted
+				continue;
 			}
-			if (l_idx == 0 || r_idx == r_count) {
-				// This case is incredibly difficult to cover as it is dependent on parallelism randomness
-				// But it has been tested extensively during development in a script
-				// LCOV_EXCL_START
-				return;
-				// LCOV_EXCL_STOP
-			} else {
-				break;
+			const idx_t cand_idx = MinValue(ends[r] + m, run_count) - 1;
+			if (best_run == DConstants::INVALID_INDEX ||
+			    CompareUsingGlobalIndex(*readers[r], *readers[best_run], cand_idx, best_idx) < 0) {
+				best_run = r;
+				best_idx = cand_idx;
 			}
 		}
-		comp_res = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx);
-		if (comp_res > 0) {
-			li = middle + 1;
-		} else {
-			ri = middle - 1;
-		}
+		D_ASSERT(best_run != DConstants::INVALID_INDEX);
+		D_ASSERT(best_idx + 1 - ends[best_run] <= remaining);
+		remaining -= best_idx + 1 - ends[best_run];
+		ends[best_run] = best_idx + 1;
+	}
+}
+
+bool MergeSorter::RunPrecedes(const idx_t a, const idx_t b, const data_ptr_t radix_ptrs[]) {
+	if (!radix_ptrs[a]) {
+		return false;
+	}
+	if (!radix_ptrs[b]) {
+		return true;
 	}
-	int l_r_min1 = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx - 1);
-	int l_min1_r = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-	if (l_r_min1 > 0 && l_min1_r < 0) {
-		return;
-	} else if (l_r_min1 > 0) {
-		l_idx--;
-		r_idx++;
-	} else if (l_min1_r < 0) {
-		l_idx++;
-		r_idx--;
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(radix_ptrs[a], radix_ptrs[b], sort_layout.comparison_size);
+	} else {
+		comp_res =
+		    Comparators::CompareTuple(*runs[a], *runs[b], radix_ptrs[a], radix_ptrs[b], sort_layout, state.external);
 	}
+	// Break ties by run index so that the merge is deterministic
+	return comp_res < 0 || (comp_res == 0 && a < b);
 }
 
-void MergeSorter::ComputeMerge(const idx_t &count, bool left_smaller[]) {
-	auto &l = *left;
-	auto &r = *right;
-	auto &l_sorted_block = *l.sb;
-	auto &r_sorted_block = *r.sb;
+void MergeSorter::ComputeMerge(const idx_t count, uint8_t run_index[]) {
+	const auto num_runs = runs.size();
 	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
-	// Data pointers for both sides
-	data_ptr_t l_radix_ptr;
-	data_ptr_t r_radix_ptr;
-	// Compute the merge of the next 'count' tuples
-	idx_t compared = 0;
-	while (compared < count) {
+	idx_t block_idx_before[SortConstants::MAX_MERGE_FANOUT];
+	idx_t entry_idx_before[SortConstants::MAX_MERGE_FANOUT];
+	// Current radix pointer of each run (nullptr if the run is exhausted), and entries left in its block
+	data_ptr_t radix_ptrs[SortConstants::MAX_MERGE_FANOUT];
+	idx_t entries_in_block[SortConstants::MAX_MERGE_FANOUT];
+	for (idx_t r = 0; r < num_runs; r++) {
+		auto &run = *runs[r];
+		block_idx_before[r] = run.block_idx;
+		entry_idx_before[r] = run.entry_idx;
+		auto &blocks = run.sb->radix_sorting_data;
 		// Move to the next block (if needed)
-		if (l.block_idx < l_sorted_block.radix_sorting_data.size() &&
-		    l.entry_idx == l_sorted_block.radix_sorting_data[l.block_idx]->count) {
-			l.block_idx++;
-			l.entry_idx = 0;
+		if (run.block_idx < blocks.size() && run.entry_idx == blocks[run.block_idx]->count) {
+			run.block_idx++;
+			run.entry_idx = 0;
 		}
-		if (r.block_idx < r_sorted_block.radix_sorting_data.size() &&
-		    r.entry_idx == r_sorted_block.radix_sorting_data[r.block_idx]->count) {
-			r.block_idx++;
-			r.entry_idx = 0;
-		}
-		const bool l_done = l.block_idx == l_sorted_block.radix_sorting_data.size();
-		const bool r_done = r.block_idx == r_sorted_block.radix_sorting_data.size();
-		if (l_done || r_done) {
-			// One of the sides is exhausted, no need to compare
-			break;
+		if (run.block_idx == blocks.size()) {
+			// This run is exhausted
+			radix_ptrs[r] = nullptr;
+			entries_in_block[r] = 0;
+			continue;
 		}
-		// Pin the radix sorting data
-		if (!l_done) {
-			left->PinRadix(l.block_idx);
-			l_radix_ptr = left->RadixPtr();
-		}
-		if (!r_done) {
-			right->PinRadix(r.block_idx);
-			r_radix_ptr = right->RadixPtr();
+		// Pin the radix sorting data (and the blob data, if the comparisons need it)
+		run.PinRadix(run.block_idx);
+		radix_ptrs[r] = run.RadixPtr();
+		entries_in_block[r] = blocks[run.block_idx]->count - run.entry_idx;
+		if (!sort_layout.all_constant) {
+			run.PinData(*run.sb->blob_sorting_data);
 		}
-		const idx_t &l_count = !l_done ? l_sorted_block.radix_sorting_data[l.block_idx]->count : 0;
-		const idx_t &r_count = !r_done ? r_sorted_block.radix_sorting_data[r.block_idx]->count : 0;
-		// Compute the merge
-		if (sort_layout.all_constant) {
-			// All sorting columns are constant size
-			for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
-				left_smaller[compared] = FastMemcmp(l_radix_ptr, r_radix_ptr, sort_layout.comparison_size) < 0;
-				const bool &l_smaller = left_smaller[compared];
-				const bool r_smaller = !l_smaller;
-				// Use comparison bool (0 or 1) to increment entries and pointers
-				l.entry_idx += l_smaller;
-				r.entry_idx += r_smaller;
-				l_radix_ptr += l_smaller * sort_layout.entry_size;
-				r_radix_ptr += r_smaller * sort_layout.entry_size;
+	}
+	// Build the tournament (loser) tree: the leaves are the runs,
+	// and each internal node holds the winning run of its subtree
+	idx_t tree_width = 1;
+	while (tree_width < num_runs) {
+		tree_width *= 2;
+	}
+	uint8_t tree[2 * SortConstants::MAX_MERGE_FANOUT];
+	for (idx_t r = num_runs; r < tree_width; r++) {
+		// Leaves beyond the number of runs behave as exhausted runs
+		radix_ptrs[r] = nullptr;
+	}
+	for (idx_t i = 0; i < tree_width; i++) {
+		tree[tree_width + i] = i;
+	}
+	for (idx_t n = tree_width - 1; n > 0; n--) {
+		tree[n] = RunPrecedes(tree[2 * n], tree[2 * n + 1], radix_ptrs) ? tree[2 * n] : tree[2 * n + 1];
+	}
+	// Compute the merge of the next 'count' tuples
+	for (idx_t i = 0; i < count; i++) {
+		const auto winner = tree[1];
+		D_ASSERT(radix_ptrs[winner]);
+		run_index[i] = winner;
+		// Advance the winning run
+		auto &run = *runs[winner];
+		run.entry_idx++;
+		if (--entries_in_block[winner] == 0) {
+			// Move to the next block
+			auto &blocks = run.sb->radix_sorting_data;
+			run.block_idx++;
+			run.entry_idx = 0;
+			if (run.block_idx == blocks.size()) {
+				// This run is exhausted
+				radix_ptrs[winner] = nullptr;
+			} else {
+				run.PinRadix(run.block_idx);
+				radix_ptrs[winner] = run.RadixPtr();
+				entries_in_block[winner] = blocks[run.block_idx]->count;
+				if (!sort_layout.all_constant) {
+					run.PinData(*run.sb->blob_sorting_data);
+				}
 			}
 		} else {
-			// Pin the blob data
-			if (!l_done) {
-				left->PinData(*l_sorted_block.blob_sorting_data);
-			}
-			if (!r_done) {
-				right->PinData(*r_sorted_block.blob_sorting_data);
-			}
-			// Merge with variable size sorting columns
-			for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
-				left_smaller[compared] =
-				    Comparators::CompareTuple(*left, *right, l_radix_ptr, r_radix_ptr, sort_layout, state.external) < 0;
-				const bool &l_smaller = left_smaller[compared];
-				const bool r_smaller = !l_smaller;
-				// Use comparison bool (0 or 1) to increment entries and pointers
-				l.entry_idx += l_smaller;
-				r.entry_idx += r_smaller;
-				l_radix_ptr += l_smaller * sort_layout.entry_size;
-				r_radix_ptr += r_smaller * sort_layout.entry_size;
-			}
+			radix_ptrs[winner] += sort_layout.entry_size;
+		}
+		// Replay the matches on the path from the winner's leaf back to the root
+		for (idx_t n = (tree_width + winner) / 2; n > 0; n /= 2) {
+			tree[n] = RunPrecedes(tree[2 * n], tree[2 * n + 1], radix_ptrs) ? tree[2 * n] : tree[2 * n + 1];
 		}
 	}
 	// Reset block indices
-	left->SetIndices(l_block_idx_before, l_entry_idx_before);
-	right->SetIndices(r_block_idx_before, r_entry_idx_before);
+	for (idx_t r = 0; r < num_runs; r++) {
+		runs[r]->SetIndices(block_idx_before[r], entry_idx_before[r]);
+	}
 }
 
-void MergeSorter::MergeRadix(const idx_t &count, const bool left_smaller[]) {
-	auto &l = *left;
-	auto &r = *right;
+void MergeSorter::MergeRadix(const idx_t count, const uint8_t run_index[]) {
+	const auto num_runs = runs.size();
+	const idx_t entry_size = sort_layout.entry_size;
 	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
-
-	auto &l_blocks = l.sb->radix_sorting_data;
-	auto &r_blocks = r.sb->radix_sorting_data;
-	RowDataBlock *l_block = nullptr;
-	RowDataBlock *r_block = nullptr;
-
-	data_ptr_t l_ptr;
-	data_ptr_t r_ptr;
-
-	RowDataBlock *result_block = result->radix_sorting_data.back().get();
-	auto result_handle = buffer_manager.Pin(result_block->block);
-	data_ptr_t result_ptr = result_handle.Ptr() + result_block->count * sort_layout.entry_size;
-
-	idx_t copied = 0;
-	while (copied < count) {
+	idx_t block_idx_before[SortConstants::MAX_MERGE_FANOUT];
+	idx_t entry_idx_before[SortConstants::MAX_MERGE_FANOUT];
+	// Current read pointer of each run, and entries left in its block
+	data_ptr_t ptrs[SortConstants::MAX_MERGE_FANOUT];
+	idx_t entries_in_block[SortConstants::MAX_MERGE_FANOUT];
+	for (idx_t r = 0; r < num_runs; r++) {
+		auto &run = *runs[r];
+		block_idx_before[r] = run.block_idx;
+		entry_idx_before[r] = run.entry_idx;
+		auto &blocks = run.sb->radix_sorting_data;
 		// Move to the next block (if needed)
-		if (l.block_idx < l_blocks.size() && l.entry_idx == l_blocks[l.block_idx]->count) {
+		if (run.block_idx < blocks.size() && run.entry_idx == blocks[run.block_idx]->count) {
 			// Delete reference to previous block
-			l_blocks[l.block_idx]->block = nullptr;
+			blocks[run.block_idx]->block = nullptr;
 			// Advance block
-			l.block_idx++;
-			l.entry_idx = 0;
+			run.block_idx++;
+			run.entry_idx = 0;
+		}
+		if (run.block_idx == blocks.size()) {
+			// This run is exhausted
+			entries_in_block[r] = 0;
+			continue;
 		}
-		if (r.block_idx < r_blocks.size() && r.entry_idx == r_blocks[r.block_idx]->count) {
+		run.PinRadix(run.block_idx);
+		ptrs[r] = run.RadixPtr();
+		entries_in_block[r] = blocks[run.block_idx]->count - run.entry_idx;
+	}
+
+	RowDataBlock *result_block = result->radix_sorting_data.back().get();
+	auto result_handle = buffer_manager.Pin(result_block->block);
+	data_ptr_t result_ptr = result_handle.Ptr() + result_block->count * entry_size;
+	D_ASSERT(result_block->count + count <= result_block->capacity);
+
+	// Copy the rows using the computed merge
+	for (idx_t i = 0; i < count; i++) {
+		const auto r = run_index[i];
+		if (entries_in_block[r] == 0) {
+			auto &run = *runs[r];
+			auto &blocks = run.sb->radix_sorting_data;
 			// Delete reference to previous block
-			r_blocks[r.block_idx]->block = nullptr;
+			blocks[run.block_idx]->block = nullptr;
 			// Advance block
-			r.block_idx++;
-			r.entry_idx = 0;
-		}
-		const bool l_done = l.block_idx == l_blocks.size();
-		const bool r_done = r.block_idx == r_blocks.size();
-		// Pin the radix sortable blocks
-		idx_t l_count;
-		if (!l_done) {
-			l_block = l_blocks[l.block_idx].get();
-			left->PinRadix(l.block_idx);
-			l_ptr = l.RadixPtr();
-			l_count = l_block->count;
-		} else {
-			l_count = 0;
-		}
-		idx_t r_count;
-		if (!r_done) {
-			r_block = r_blocks[r.block_idx].get();
-			r.PinRadix(r.block_idx);
-			r_ptr = r.RadixPtr();
-			r_count = r_block->count;
-		} else {
-			r_count = 0;
-		}
-		// Copy using computed merge
-		if (!l_done && !r_done) {
-			// Both sides have data - merge
-			MergeRows(l_ptr, l.entry_idx, l_count, r_ptr, r.entry_idx, r_count, *result_block, result_ptr,
-			          sort_layout.entry_size, left_smaller, copied, count);
-		} else if (r_done) {
-			// Right side is exhausted
-			FlushRows(l_ptr, l.entry_idx, l_count, *result_block, result_ptr, sort_layout.entry_size, copied, count);
-		} else {
-			// Left side is exhausted
-			FlushRows(r_ptr, r.entry_idx, r_count, *result_block, result_ptr, sort_layout.entry_size, copied, count);
+			run.block_idx++;
+			run.entry_idx = 0;
+			run.PinRadix(run.block_idx);
+			ptrs[r] = run.RadixPtr();
+			entries_in_block[r] = blocks[run.block_idx]->count;
 		}
+		FastMemcpy(result_ptr, ptrs[r], entry_size);
+		result_ptr += entry_size;
+		ptrs[r] += entry_size;
+		entries_in_block[r]--;
 	}
+	result_block->count += count;
+
 	// Reset block indices
-	left->SetIndices(l_block_idx_before, l_entry_idx_before);
-	right->SetIndices(r_block_idx_before, r_entry_idx_before);
+	for (idx_t r = 0; r < num_runs; r++) {
+		runs[r]->SetIndices(block_idx_before[r], entry_idx_before[r]);
+	}
 }
 
-void MergeSorter::MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-                            const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices) {
-	auto &l = *left;
-	auto &r = *right;
-	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
-
+void MergeSorter::MergeData(SortedData &result_data, const vector<SortedData *> &input_data, const idx_t count,
+                            const uint8_t run_index[], idx_t next_entry_sizes[], bool reset_indices) {
+	const auto num_runs = runs.size();
 	const auto &layout = result_data.layout;
 	const idx_t row_width = layout.GetRowWidth();
 	const idx_t heap_pointer_offset = layout.GetHeapOffset();
+	// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
+	const bool heap = !layout.AllConstant() && state.external;
 
-	// Left and right row data to merge
-	data_ptr_t l_ptr;
-	data_ptr_t r_ptr;
-	// Accompanying left and right heap data (if needed)
-	data_ptr_t l_heap_ptr;
-	data_ptr_t r_heap_ptr;
+	// Save indices to restore afterwards
+	idx_t block_idx_before[SortConstants::MAX_MERGE_FANOUT];
+	idx_t entry_idx_before[SortConstants::MAX_MERGE_FANOUT];
+	// Current row pointer and heap pointer of each run, and entries left in its block
+	data_ptr_t ptrs[SortConstants::MAX_MERGE_FANOUT];
+	data_ptr_t heap_ptrs[SortConstants::MAX_MERGE_FANOUT];
+	idx_t entries_in_block[SortConstants::MAX_MERGE_FANOUT];
+	for (idx_t r = 0; r < num_runs; r++) {
+		auto &run = *runs[r];
+		block_idx_before[r] = run.block_idx;
+		entry_idx_before[r] = run.entry_idx;
+		auto &data = *input_data[r];
+		// Move to the next block (if needed)
+		if (run.block_idx < data.data_blocks.size() && run.entry_idx == data.data_blocks[run.block_idx]->count) {
+			// Delete references to previous block
+			data.data_blocks[run.block_idx]->block = nullptr;
+			if (heap) {
+				data.heap_blocks[run.block_idx]->block = nullptr;
+			}
+			// Advance block
+			run.block_idx++;
+			run.entry_idx = 0;
+		}
+		if (run.block_idx == data.data_blocks.size()) {
+			// This run is exhausted
+			entries_in_block[r] = 0;
+			continue;
+		}
+		run.PinData(data);
+		ptrs[r] = run.DataPtr(data);
+		if (heap) {
+			heap_ptrs[r] = run.BaseHeapPtr(data) + Load<idx_t>(ptrs[r] + heap_pointer_offset);
+		}
+		entries_in_block[r] = data.data_blocks[run.block_idx]->count - run.entry_idx;
+	}
 
 	// Result rows to write to
 	RowDataBlock *result_data_block = result_data.data_blocks.back().get();
 	auto result_data_handle = buffer_manager.Pin(result_data_block->block);
 	data_ptr_t result_data_ptr = result_data_handle.Ptr() + result_data_block->count * row_width;
-	// Result heap to write to (if needed)
-	RowDataBlock *result_heap_block = nullptr;
-	BufferHandle result_heap_handle;
-	data_ptr_t result_heap_ptr;
-	if (!layout.AllConstant() && state.external) {
-		result_heap_block = result_data.heap_blocks.back().get();
-		result_heap_handle = buffer_manager.Pin(result_heap_block->block);
-		result_heap_ptr = result_heap_handle.Ptr() + result_heap_block->byte_offset;
-	}
+	D_ASSERT(result_data_block->count + count <= result_data_block->capacity);
 
-	idx_t copied = 0;
-	while (copied < count) {
-		// Move to new data blocks (if needed)
-		if (l.block_idx < l_data.data_blocks.size() && l.entry_idx == l_data.data_blocks[l.block_idx]->count) {
-			// Delete reference to previous block
-			l_data.data_blocks[l.block_idx]->block = nullptr;
-			if (!layout.AllConstant() && state.external) {
-				l_data.heap_blocks[l.block_idx]->block = nullptr;
+	if (!heap) {
+		// Only the row data needs to be copied
+		for (idx_t i = 0; i < count; i++) {
+			const auto r = run_index[i];
+			if (entries_in_block[r] == 0) {
+				auto &run = *runs[r];
+				auto &data = *input_data[r];
+				// Delete reference to previous block
+				data.data_blocks[run.block_idx]->block = nullptr;
+				// Advance block
+				run.block_idx++;
+				run.entry_idx = 0;
+				run.PinData(data);
+				ptrs[r] = run.DataPtr(data);
+				entries_in_block[r] = data.data_blocks[run.block_idx]->count;
 			}
-			// Advance block
-			l.block_idx++;
-			l.entry_idx = 0;
+			FastMemcpy(result_data_ptr, ptrs[r], row_width);
+			result_data_ptr += row_width;
+			ptrs[r] += row_width;
+			entries_in_block[r]--;
 		}
-		if (r.block_idx < r_data.data_blocks.size() && r.entry_idx == r_data.data_blocks[r.block_idx]->count) {
-			// Delete reference to previous block
-			r_data.data_blocks[r.block_idx]->block = nullptr;
-			if (!layout.AllConstant() && state.external) {
-				r_data.heap_blocks[r.block_idx]->block = nullptr;
+		result_data_block->count += count;
+	} else {
+		// External sorting with variable size data: the row and heap data both need to be dealt with
+		RowDataBlock *result_heap_block = result_data.heap_blocks.back().get();
+		auto result_heap_handle = buffer_manager.Pin(result_heap_block->block);
+		data_ptr_t result_heap_ptr;
+
+		// Copy the row data, and compute the entry sizes and total number of heap bytes that will be copied
+		data_ptr_t source_heap_ptrs[STANDARD_VECTOR_SIZE];
+		idx_t copy_bytes = 0;
+		for (idx_t i = 0; i < count; i++) {
+			const auto r = run_index[i];
+			if (entries_in_block[r] == 0) {
+				auto &run = *runs[r];
+				auto &data = *input_data[r];
+				// Delete references to previous block
+				data.data_blocks[run.block_idx]->block = nullptr;
+				data.heap_blocks[run.block_idx]->block = nullptr;
+				// Advance block
+				run.block_idx++;
+				run.entry_idx = 0;
+				run.PinData(data);
+				ptrs[r] = run.DataPtr(data);
+				heap_ptrs[r] = run.BaseHeapPtr(data) + Load<idx_t>(ptrs[r] + heap_pointer_offset);
+				entries_in_block[r] = data.data_blocks[run.block_idx]->count;
 			}
-			// Advance block
-			r.block_idx++;
-			r.entry_idx = 0;
-		}
-		const bool l_done = l.block_idx == l_data.data_blocks.size();
-		const bool r_done = r.block_idx == r_data.data_blocks.size();
-		// Pin the row data blocks
-		if (!l_done) {
-			l.PinData(l_data);
-			l_ptr = l.DataPtr(l_data);
+			FastMemcpy(result_data_ptr, ptrs[r], row_width);
+			// Store the base heap offset of this row in the result
+			Store<idx_t>(result_heap_block->byte_offset + copy_bytes, result_data_ptr + heap_pointer_offset);
+			result_data_ptr += row_width;
+			ptrs[r] += row_width;
+			entries_in_block[r]--;
+			// Compute entry size and add to total
+			auto &entry_size = next_entry_sizes[i];
+			entry_size = Load<uint32_t>(heap_ptrs[r]);
+			D_ASSERT(entry_size >= sizeof(uint32_t));
+			source_heap_ptrs[i] = heap_ptrs[r];
+			heap_ptrs[r] += entry_size;
+			copy_bytes += entry_size;
 		}
-		if (!r_done) {
-			r.PinData(r_data);
-			r_ptr = r.DataPtr(r_data);
+		// Reallocate result heap block size (if needed)
+		if (result_heap_block->byte_offset + copy_bytes > result_heap_block->capacity) {
+			idx_t new_capacity = result_heap_block->byte_offset + copy_bytes;
+			buffer_manager.ReAllocate(result_heap_block->block, new_capacity);
+			result_heap_block->capacity = new_capacity;
 		}
-		const idx_t &l_count = !l_done ? l_data.data_blocks[l.block_idx]->count : 0;
-		const idx_t &r_count = !r_done ? r_data.data_blocks[r.block_idx]->count : 0;
-		// Perform the merge
-		if (layout.AllConstant() || !state.external) {
-			// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
-			if (!l_done && !r_done) {
-				// Both sides have data - merge
-				MergeRows(l_ptr, l.entry_idx, l_count, r_ptr, r.entry_idx, r_count, *result_data_block, result_data_ptr,
-				          row_width, left_smaller, copied, count);
-			} else if (r_done) {
-				// Right side is exhausted
-				FlushRows(l_ptr, l.entry_idx, l_count, *result_data_block, result_data_ptr, row_width, copied, count);
-			} else {
-				// Left side is exhausted
-				FlushRows(r_ptr, r.entry_idx, r_count, *result_data_block, result_data_ptr, row_width, copied, count);
-			}
-		} else {
-			// External sorting with variable size data. Pin the heap blocks too
-			if (!l_done) {
-				l_heap_ptr = l.BaseHeapPtr(l_data) + Load<idx_t>(l_ptr + heap_pointer_offset);
-				D_ASSERT(l_heap_ptr - l.BaseHeapPtr(l_data) >= 0);
-				D_ASSERT((idx_t)(l_heap_ptr - l.BaseHeapPtr(l_data)) < l_data.heap_blocks[l.block_idx]->byte_offset);
-			}
-			if (!r_done) {
-				r_heap_ptr = r.BaseHeapPtr(r_data) + Load<idx_t>(r_ptr + heap_pointer_offset);
-				D_ASSERT(r_heap_ptr - r.BaseHeapPtr(r_data) >= 0);
-				D_ASSERT((idx_t)(r_heap_ptr - r.BaseHeapPtr(r_data)) < r_data.heap_blocks[r.block_idx]->byte_offset);
-			}
-			// Both the row and heap data need to be dealt with
-			if (!l_done && !r_done) {
-				// Both sides have data - merge
-				idx_t l_idx_copy = l.entry_idx;
-				idx_t r_idx_copy = r.entry_idx;
-				data_ptr_t result_data_ptr_copy = result_data_ptr;
-				idx_t copied_copy = copied;
-				// Merge row data
-				MergeRows(l_ptr, l_idx_copy, l_count, r_ptr, r_idx_copy, r_count, *result_data_block,
-				          result_data_ptr_copy, row_width, left_smaller, copied_copy, count);
-				const idx_t merged = copied_copy - copied;
-				// Compute the entry sizes and number of heap bytes that will be copied
-				idx_t copy_bytes = 0;
-				data_ptr_t l_heap_ptr_copy = l_heap_ptr;
-				data_ptr_t r_heap_ptr_copy = r_heap_ptr;
-				for (idx_t i = 0; i < merged; i++) {
-					// Store base heap offset in the row data
-					Store<idx_t>(result_heap_block->byte_offset + copy_bytes, result_data_ptr + heap_pointer_offset);
-					result_data_ptr += row_width;
-					// Compute entry size and add to total
-					const bool &l_smaller = left_smaller[copied + i];
-					const bool r_smaller = !l_smaller;
-					auto &entry_size = next_entry_sizes[copied + i];
-					entry_size =
-					    l_smaller * Load<uint32_t>(l_heap_ptr_copy) + r_smaller * Load<uint32_t>(r_heap_ptr_copy);
-					D_ASSERT(entry_size >= sizeof(uint32_t));
-					D_ASSERT(l_heap_ptr_copy - l.BaseHeapPtr(l_data) + l_smaller * entry_size <=
-					         l_data.heap_blocks[l.block_idx]->byte_offset);
-					D_ASSERT(r_heap_ptr_copy - r.BaseHeapPtr(r_data) + r_smaller * entry_size <=
-					         r_data.heap_blocks[r.block_idx]->byte_offset);
-					l_heap_ptr_copy += l_smaller * entry_size;
-					r_heap_ptr_copy += r_smaller * entry_size;
-					copy_bytes += entry_size;
-				}
-				// Reallocate result heap block size (if needed)
-				if (result_heap_block->byte_offset + copy_bytes > result_heap_block->capacity) {
-					idx_t new_capacity = result_heap_block->byte_offset + copy_bytes;
-					buffer_manager.ReAllocate(result_heap_block->block, new_capacity);
-					result_heap_block->capacity = new_capacity;
-					result_heap_ptr = result_heap_handle.Ptr() + result_heap_block->byte_offset;
-				}
-				D_ASSERT(result_heap_block->byte_offset + copy_bytes <= result_heap_block->capacity);
-				// Now copy the heap data
-				for (idx_t i = 0; i < merged; i++) {
-					const bool &l_smaller = left_smaller[copied + i];
-					const bool r_smaller = !l_smaller;
-					const auto &entry_size = next_entry_sizes[copied + i];
-					memcpy(result_heap_ptr, (data_ptr_t)(l_smaller * (idx_t)l_heap_ptr + r_smaller * (idx_t)r_heap_ptr),
-					       entry_size);
-					D_ASSERT(Load<uint32_t>(result_heap_ptr) == entry_size);
-					result_heap_ptr += entry_size;
-					l_heap_ptr += l_smaller * entry_size;
-					r_heap_ptr += r_smaller * entry_size;
-					l.entry_idx += l_smaller;
-					r.entry_idx += r_smaller;
-				}
-				// Update result indices and pointers
-				result_heap_block->count += merged;
-				result_heap_block->byte_offset += copy_bytes;
-				copied += merged;
-			} else if (r_done) {
-				// Right side is exhausted - flush left
-				FlushBlobs(layout, l_count, l_ptr, l.entry_idx, l_heap_ptr, *result_data_block, result_data_ptr,
-				           *result_heap_block, result_heap_handle, result_heap_ptr, copied, count);
-			} else {
-				// Left side is exhausted - flush right
-				FlushBlobs(layout, r_count, r_ptr, r.entry_idx, r_heap_ptr, *result_data_block, result_data_ptr,
-				           *result_heap_block, result_heap_handle, result_heap_ptr, copied, count);
-			}
-			D_ASSERT(result_data_block->count == result_heap_block->count);
+		D_ASSERT(result_heap_block->byte_offset + copy_bytes <= result_heap_block->capacity);
+		result_heap_ptr = result_heap_handle.Ptr() + result_heap_block->byte_offset;
+		// Now copy the heap data
+		for (idx_t i = 0; i < count; i++) {
+			memcpy(result_heap_ptr, source_heap_ptrs[i], next_entry_sizes[i]);
+			D_ASSERT(Load<uint32_t>(result_heap_ptr) == next_entry_sizes[i]);
+			result_heap_ptr += next_entry_sizes[i];
 		}
+		// Update result indices and pointers
+		result_data_block->count += count;
+		result_heap_block->count += count;
+		result_heap_block->byte_offset += copy_bytes;
+		D_ASSERT(result_data_block->count == result_heap_block->count);
 	}
-	if (reset_indices) {
-		left->SetIndices(l_block_idx_before, l_entry_idx_before);
-		right->SetIndices(r_block_idx_before, r_entry_idx_before);
-	}
-}
-
-void MergeSorter::MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr,
-                            idx_t &r_entry_idx, const idx_t &r_count, RowDataBlock &target_block,
-                            data_ptr_t &target_ptr, const idx_t &entry_size, const bool left_smaller[], idx_t &copied,
-                            const idx_t &count) {
-	const idx_t next = MinValue(count - copied, target_block.capacity - target_block.count);
-	idx_t i;
-	for (i = 0; i < next && l_entry_idx < l_count && r_entry_idx < r_count; i++) {
-		const bool &l_smaller = left_smaller[copied + i];
-		const bool r_smaller = !l_smaller;
-		// Use comparison bool (0 or 1) to copy an entry from either side
-		FastMemcpy(target_ptr, (data_ptr_t)(l_smaller * (idx_t)l_ptr + r_smaller * (idx_t)r_ptr), entry_size);
-		target_ptr += entry_size;
-		// Use the comparison bool to increment entries and pointers
-		l_entry_idx += l_smaller;
-		r_entry_idx += r_smaller;
-		l_ptr += l_smaller * entry_size;
-		r_ptr += r_smaller * entry_size;
-	}
-	// Update counts
-	target_block.count += i;
-	copied += i;
-}
 
-void MergeSorter::FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-                            RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-                            const idx_t &count) {
-	// Compute how many entries we can fit
-	idx_t next = MinValue(count - copied, target_block.capacity - target_block.count);
-	next = MinValue(next, source_count - source_entry_idx);
-	// Copy them all in a single memcpy
-	const idx_t copy_bytes = next * entry_size;
-	memcpy(target_ptr, source_ptr, copy_bytes);
-	target_ptr += copy_bytes;
-	source_ptr += copy_bytes;
-	// Update counts
-	source_entry_idx += next;
-	target_block.count += next;
-	copied += next;
-}
-
-void MergeSorter::FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-                             idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-                             data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block,
-                             BufferHandle &target_heap_handle, data_ptr_t &target_heap_ptr, idx_t &copied,
-                             const idx_t &count) {
-	const idx_t row_width = layout.GetRowWidth();
-	const idx_t heap_pointer_offset = layout.GetHeapOffset();
-	idx_t source_entry_idx_copy = source_entry_idx;
-	data_ptr_t target_data_ptr_copy = target_data_ptr;
-	idx_t copied_copy = copied;
-	// Flush row data
-	FlushRows(source_data_ptr, source_entry_idx_copy, source_count, target_data_block, target_data_ptr_copy, row_width,
-	          copied_copy, count);
-	const idx_t flushed = copied_copy - copied;
-	// Compute the entry sizes and number of heap bytes that will be copied
-	idx_t copy_bytes = 0;
-	data_ptr_t source_heap_ptr_copy = source_heap_ptr;
-	for (idx_t i = 0; i < flushed; i++) {
-		// Store base heap offset in the row data
-		Store<idx_t>(target_heap_block.byte_offset + copy_bytes, target_data_ptr + heap_pointer_offset);
-		target_data_ptr += row_width;
-		// Compute entry size and add to total
-		auto entry_size = Load<uint32_t>(source_heap_ptr_copy);
-		D_ASSERT(entry_size >= sizeof(uint32_t));
-		source_heap_ptr_copy += entry_size;
-		copy_bytes += entry_size;
-	}
-	// Reallocate result heap block size (if needed)
-	if (target_heap_block.byte_offset + copy_bytes > target_heap_block.capacity) {
-		idx_t new_capacity = target_heap_block.byte_offset + copy_bytes;
-		buffer_manager.ReAllocate(target_heap_block.block, new_capacity);
-		target_heap_block.capacity = new_capacity;
-		target_heap_ptr = target_heap_handle.Ptr() + target_heap_block.byte_offset;
+	if (reset_indices) {
+		for (idx_t r = 0; r < num_runs; r++) {
+			runs[r]->SetIndices(block_idx_before[r], entry_idx_before[r]);
+		}
+	} else {
+		// Leave the scan states at the first entry that was not merged
+		for (idx_t r = 0; r < num_runs; r++) {
+			auto &run = *runs[r];
+			auto &data = *input_data[r];
+			if (run.block_idx < data.data_blocks.size()) {
+				run.entry_idx = data.data_blocks[run.block_idx]->count - entries_in_block[r];
+			}
+		}
 	}
-	D_ASSERT(target_heap_block.byte_offset + copy_bytes <= target_heap_block.capacity);
-	// Copy the heap data in one go
-	memcpy(target_heap_ptr, source_heap_ptr, copy_bytes);
-	target_heap_ptr += copy_bytes;
-	source_heap_ptr += copy_bytes;
-	source_entry_idx += flushed;
-	copied += flushed;
-	// Update result indices and pointers
-	target_heap_block.count += flushed;
-	target_heap_block.byte_offset += copy_bytes;
-	D_ASSERT(target_heap_block.byte_offset <= target_heap_block.capacity);
 }
 
 } // namespace duckdb
@@ -28,10 +28,22 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 			// Lists get 2 bytes (null and empty list)
 			col_size += 2;
 			return GetNestedSortingColSize(col_size, ListType::GetChildType(type));
-		case PhysicalType::STRUCT:
-			// Structs get 1 bytes (null)
-			col_size++;
-			return GetNestedSortingColSize(col_size, StructType::GetChildType(type, 0));
+		case PhysicalType::STRUCT: {
+			// Every encoded struct child is prefixed by a validity byte. All leading constant-size children
+			// are encoded completely, and the first variable-size child gets the prefix treatment: anything
+			// after it cannot be normalized and is left for the comparator to resolve
+			idx_t struct_prefix_len = 0;
+			auto child_count = StructType::GetChildCount(type);
+			for (idx_t child_idx = 0; child_idx < child_count; child_idx++) {
+				const auto &child_type = StructType::GetChildType(type, child_idx);
+				col_size++;
+				struct_prefix_len = GetNestedSortingColSize(col_size, child_type);
+				if (!TypeIsConstantSize(child_type.InternalType())) {
+					break;
+				}
+			}
+			return struct_prefix_len;
+		}
 		default:
 			throw NotImplementedException("Unable to order column with type %s", type.ToString());
 		}
@@ -359,7 +371,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), group_idx(0), num_groups(0), merge_fanout(SortConstants::MERGE_FANOUT) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -430,18 +442,23 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// In-memory sorts cover all runs with a single group if they can: the merge then completes in one
+	// round in which the merge path partitions are disjoint slices of the final result, so the threads
+	// work fully independently and the results only have to be concatenated. External sorts keep the
+	// smaller fan-out to bound the number of blocks that a merge pins simultaneously.
+	merge_fanout = external ? SortConstants::MERGE_FANOUT
+	                        : MinValue<idx_t>(sorted_blocks.size(), SortConstants::MAX_MERGE_FANOUT);
+	// The remainder would leave a group of a single block - keep it on the side instead
+	if (sorted_blocks.size() % merge_fanout == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
-	// Init merge path path indices
-	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
+	// Init merge path indices: runs are merged in groups of (at most) merge_fanout blocks
+	group_idx = 0;
+	num_groups = (sorted_blocks.size() + merge_fanout - 1) / merge_fanout;
+	run_starts.assign(MinValue<idx_t>(sorted_blocks.size(), merge_fanout), 0);
 	// Allocate room for merge results
-	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+	for (idx_t g_idx = 0; g_idx < num_groups; g_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
@@ -0,0 +1,11 @@
+#include "duckdb/common/thread_io_counters.hpp"
+
+namespace duckdb {
+
+static thread_local ThreadIOCounters thread_io_counters;
+
+ThreadIOCounters &ThreadIOCounters::Get() {
+	return thread_io_counters;
+}
+
+} // namespace duckdb
@@ -503,6 +503,28 @@ unique_ptr<RenderTreeNode> TreeRenderer::CreateNode(const QueryProfiler::TreeNod
 	result->extra_text += "\n" + to_string(op.info.elements);
 	string timing = StringUtil::Format("%.2f", op.info.time);
 	result->extra_text += "\n(" + timing + "s)";
+	if (op.info.memory_peak > 0) {
+		auto current = StringUtil::BytesToHumanReadableString(idx_t(MaxValue<int64_t>(op.info.memory_usage, 0)));
+		auto peak = StringUtil::BytesToHumanReadableString(idx_t(op.info.memory_peak));
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\nmem: " + current;
+		result->extra_text += "\n(peak " + peak + ")";
+	}
+	auto &io = op.info.io;
+	if (io.cold_reads > 0 || io.cached_reads > 0) {
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\nreads: " + to_string(io.cold_reads) + " cold";
+		result->extra_text += "\n(" + to_string(io.cached_reads) + " cached)";
+	}
+	if (io.spill_bytes_written > 0 || io.spill_bytes_read > 0) {
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\nspilled: " + StringUtil::BytesToHumanReadableString(io.spill_bytes_written);
+		result->extra_text += "\n(re-read " + StringUtil::BytesToHumanReadableString(io.spill_bytes_read) + ")";
+	}
+	if (io.decompressed_bytes > 0) {
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\ndecompressed: " + StringUtil::BytesToHumanReadableString(io.decompressed_bytes);
+	}
 	if (config.detailed) {
 		for (auto &info : op.info.executors_info) {
 			if (!info) {
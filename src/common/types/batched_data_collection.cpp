@@ -44,16 +44,33 @@ void BatchedDataCollection::Merge(BatchedDataCollection &other) {
 	other.data.clear();
 }
 
+idx_t BatchedDataCollection::BatchCount() const {
+	return data.size();
+}
+
 void BatchedDataCollection::InitializeScan(BatchedChunkScanState &state) {
+	InitializeScan(state, 0, BatchCount());
+}
+
+void BatchedDataCollection::InitializeScan(BatchedChunkScanState &state, idx_t batch_begin, idx_t batch_end) {
+	D_ASSERT(batch_begin <= batch_end);
+	D_ASSERT(batch_end <= data.size());
 	state.iterator = data.begin();
-	if (state.iterator == data.end()) {
+	for (idx_t i = 0; i < batch_begin; i++) {
+		state.iterator++;
+	}
+	state.end = state.iterator;
+	for (idx_t i = batch_begin; i < batch_end; i++) {
+		state.end++;
+	}
+	if (state.iterator == state.end) {
 		return;
 	}
 	state.iterator->second->InitializeScan(state.scan_state);
 }
 
 void BatchedDataCollection::Scan(BatchedChunkScanState &state, DataChunk &output) {
-	while (state.iterator != data.end()) {
+	while (state.iterator != state.end) {
 		// check if there is a chunk remaining in this collection
 		auto collection = state.iterator->second.get();
 		collection->Scan(state.scan_state, output);
@@ -62,7 +79,7 @@ void BatchedDataCollection::Scan(BatchedChunkScanState &state, DataChunk &output
 		}
 		// there isn't! move to the next collection
 		state.iterator++;
-		if (state.iterator == data.end()) {
+		if (state.iterator == state.end) {
 			return;
 		}
 		state.iterator->second->InitializeScan(state.scan_state);
@@ -99,6 +99,14 @@ Allocator &ColumnDataCollection::GetAllocator() const {
 	return allocator->GetAllocator();
 }
 
+ColumnDataAllocatorType ColumnDataCollection::GetAllocatorType() const {
+	return allocator->GetType();
+}
+
+BufferManager &ColumnDataCollection::GetBufferManager() const {
+	return allocator->GetBufferManager();
+}
+
 //===--------------------------------------------------------------------===//
 // ColumnDataRow
 //===--------------------------------------------------------------------===//
@@ -723,6 +731,11 @@ void ColumnDataCollection::Append(ColumnDataAppendState &state, DataChunk &input
 
 	idx_t remaining = input.size();
 	while (remaining > 0) {
+		if (segment.chunk_data.back().IsReference()) {
+			// we cannot append into a chunk that references external buffers - allocate a new chunk
+			segment.AllocateNewChunk();
+			segment.InitializeChunkState(segment.chunk_data.size() - 1, state.current_chunk_state);
+		}
 		auto &chunk_data = segment.chunk_data.back();
 		idx_t append_amount = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE - chunk_data.count);
 		if (append_amount > 0) {
@@ -753,6 +766,17 @@ void ColumnDataCollection::Append(DataChunk &input) {
 	Append(state, input);
 }
 
+void ColumnDataCollection::AppendReference(DataChunk &input) {
+	D_ASSERT(!finished_append);
+	D_ASSERT(types == input.GetTypes());
+	if (segments.empty()) {
+		CreateSegment();
+	}
+	auto &segment = *segments.back();
+	segment.AppendReferencedChunk(input);
+	count += input.size();
+}
+
 //===--------------------------------------------------------------------===//
 // Scan
 //===--------------------------------------------------------------------===//
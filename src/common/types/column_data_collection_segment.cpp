@@ -1,5 +1,7 @@
 #include "duckdb/common/types/column_data_collection_segment.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
 namespace duckdb {
 
 ColumnDataCollectionSegment::ColumnDataCollectionSegment(shared_ptr<ColumnDataAllocator> allocator_p,
@@ -96,6 +98,20 @@ void ColumnDataCollectionSegment::AllocateNewChunk() {
 	chunk_data.push_back(std::move(meta_data));
 }
 
+void ColumnDataCollectionSegment::AppendReferencedChunk(DataChunk &input) {
+	D_ASSERT(input.size() <= STANDARD_VECTOR_SIZE);
+	ChunkMetaData meta_data;
+	meta_data.count = input.size();
+	meta_data.referenced_chunk = referenced_chunks.size();
+	chunk_data.push_back(std::move(meta_data));
+
+	auto chunk = make_unique<DataChunk>();
+	chunk->InitializeEmpty(types);
+	chunk->Reference(input);
+	referenced_chunks.push_back(std::move(chunk));
+	count += input.size();
+}
+
 void ColumnDataCollectionSegment::InitializeChunkState(idx_t chunk_index, ChunkManagementState &state) {
 	auto &chunk = chunk_data[chunk_index];
 	allocator->InitializeChunkState(state, chunk);
@@ -217,8 +233,24 @@ void ColumnDataCollectionSegment::ReadChunk(idx_t chunk_index, ChunkManagementSt
                                             const vector<column_t> &column_ids) {
 	D_ASSERT(chunk.ColumnCount() == column_ids.size());
 	D_ASSERT(state.properties != ColumnDataScanProperties::INVALID);
-	InitializeChunkState(chunk_index, state);
 	auto &chunk_meta = chunk_data[chunk_index];
+	if (chunk_meta.IsReference()) {
+		// the chunk is stored as a reference to externally owned vector buffers
+		// reference the buffers directly, unless the scan demands ownership of the data
+		auto &referenced = *referenced_chunks[chunk_meta.referenced_chunk];
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			auto vector_idx = column_ids[i];
+			D_ASSERT(vector_idx < referenced.ColumnCount());
+			if (state.properties == ColumnDataScanProperties::DISALLOW_ZERO_COPY) {
+				VectorOperations::Copy(referenced.data[vector_idx], chunk.data[i], chunk_meta.count, 0, 0);
+			} else {
+				chunk.data[i].Reference(referenced.data[vector_idx]);
+			}
+		}
+		chunk.SetCardinality(chunk_meta.count);
+		return;
+	}
+	InitializeChunkState(chunk_index, state);
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto vector_idx = column_ids[i];
 		D_ASSERT(vector_idx < chunk_meta.vector_data.size());
@@ -16,13 +16,11 @@ uint32_t ChunkReference::GetMinimumBlockID() const {
 }
 
 ColumnDataConsumer::ColumnDataConsumer(ColumnDataCollection &collection_p, vector<column_t> column_ids)
-    : collection(collection_p), column_ids(std::move(column_ids)) {
+    : collection(collection_p), column_ids(std::move(column_ids)), next_home_shard(0) {
 }
 
 void ColumnDataConsumer::InitializeScan() {
 	chunk_count = collection.ChunkCount();
-	current_chunk_index = 0;
-	chunk_delete_index = DConstants::INVALID_INDEX;
 
 	// Initialize chunk references and sort them, so we can scan them in a sane order, regardless of how it was created
 	chunk_references.reserve(chunk_count);
@@ -32,21 +30,46 @@ void ColumnDataConsumer::InitializeScan() {
 		}
 	}
 	std::sort(chunk_references.begin(), chunk_references.end());
+
+	// Split the sorted chunk references into one shard per allocator run, so consumers can make progress
+	// (and free blocks) independently per shard instead of serializing on a single lock
+	shards.clear();
+	idx_t shard_begin = 0;
+	for (idx_t chunk_index = 1; chunk_index <= chunk_count; chunk_index++) {
+		if (chunk_index == chunk_count || chunk_references[chunk_index].segment->allocator.get() !=
+		                                      chunk_references[shard_begin].segment->allocator.get()) {
+			shards.push_back(make_unique<ConsumerShard>(shard_begin, chunk_index));
+			shard_begin = chunk_index;
+		}
+	}
 }
 
 bool ColumnDataConsumer::AssignChunk(ColumnDataConsumerScanState &state) {
-	lock_guard<mutex> guard(lock);
-	if (current_chunk_index == chunk_count) {
-		// All chunks have been assigned
-		state.current_chunk_state.handles.clear();
-		state.chunk_index = DConstants::INVALID_INDEX;
-		return false;
+	const auto shard_count = shards.size();
+	if (shard_count != 0) {
+		if (state.home_shard == DConstants::INVALID_INDEX) {
+			state.home_shard = next_home_shard++ % shard_count;
+		}
+		// Try the home shard first, then steal from the other shards
+		for (idx_t i = 0; i < shard_count; i++) {
+			auto shard_index = (state.home_shard + i) % shard_count;
+			auto &shard = *shards[shard_index];
+			lock_guard<mutex> guard(shard.lock);
+			if (shard.current_index == shard.end) {
+				continue;
+			}
+			// Assign chunk index
+			state.chunk_index = shard.current_index++;
+			state.shard_index = shard_index;
+			D_ASSERT(shard.chunks_in_progress.find(state.chunk_index) == shard.chunks_in_progress.end());
+			shard.chunks_in_progress.insert(state.chunk_index);
+			return true;
+		}
 	}
-	// Assign chunk index
-	state.chunk_index = current_chunk_index++;
-	D_ASSERT(chunks_in_progress.find(state.chunk_index) == chunks_in_progress.end());
-	chunks_in_progress.insert(state.chunk_index);
-	return true;
+	// All chunks have been assigned
+	state.current_chunk_state.handles.clear();
+	state.chunk_index = DConstants::INVALID_INDEX;
+	return false;
 }
 
 void ColumnDataConsumer::ScanChunk(ColumnDataConsumerScanState &state, DataChunk &chunk) const {
@@ -62,39 +85,47 @@ void ColumnDataConsumer::ScanChunk(ColumnDataConsumerScanState &state, DataChunk
 
 void ColumnDataConsumer::FinishChunk(ColumnDataConsumerScanState &state) {
 	D_ASSERT(state.chunk_index < chunk_count);
+	auto &shard = *shards[state.shard_index];
 	idx_t delete_index_start;
 	idx_t delete_index_end;
+	bool shard_done;
 	{
-		lock_guard<mutex> guard(lock);
-		D_ASSERT(chunks_in_progress.find(state.chunk_index) != chunks_in_progress.end());
-		delete_index_start = chunk_delete_index;
-		delete_index_end = *std::min_element(chunks_in_progress.begin(), chunks_in_progress.end());
-		chunks_in_progress.erase(state.chunk_index);
-		chunk_delete_index = delete_index_end;
+		lock_guard<mutex> guard(shard.lock);
+		D_ASSERT(shard.chunks_in_progress.find(state.chunk_index) != shard.chunks_in_progress.end());
+		delete_index_start = shard.delete_index;
+		delete_index_end = *std::min_element(shard.chunks_in_progress.begin(), shard.chunks_in_progress.end());
+		shard.chunks_in_progress.erase(state.chunk_index);
+		shard.delete_index = delete_index_end;
+		// the thread whose erase empties the in-progress set of an exhausted shard cleans up its tail
+		shard_done = shard.current_index == shard.end && shard.chunks_in_progress.empty();
+	}
+	ConsumeChunks(shard, delete_index_start, delete_index_end);
+	if (shard_done) {
+		// All chunks of this shard are done: delete the remaining blocks of the shard's allocator
+		auto &frontier_chunk_ref = chunk_references[shard.delete_index];
+		auto allocator = frontier_chunk_ref.segment->allocator.get();
+		for (uint32_t block_id = frontier_chunk_ref.GetMinimumBlockID(); block_id < allocator->BlockCount();
+		     block_id++) {
+			allocator->DeleteBlock(block_id);
+		}
 	}
-	ConsumeChunks(delete_index_start, delete_index_end);
 }
-void ColumnDataConsumer::ConsumeChunks(idx_t delete_index_start, idx_t delete_index_end) {
+
+void ColumnDataConsumer::ConsumeChunks(ConsumerShard &shard, idx_t delete_index_start, idx_t delete_index_end) {
 	for (idx_t chunk_index = delete_index_start; chunk_index < delete_index_end; chunk_index++) {
-		if (chunk_index == 0) {
+		if (chunk_index == shard.begin) {
 			continue;
 		}
 		auto &prev_chunk_ref = chunk_references[chunk_index - 1];
 		auto &curr_chunk_ref = chunk_references[chunk_index];
-		auto prev_allocator = prev_chunk_ref.segment->allocator.get();
-		auto curr_allocator = curr_chunk_ref.segment->allocator.get();
+		// a shard covers a single allocator, so the cross-allocator case cannot occur within it
+		D_ASSERT(prev_chunk_ref.segment->allocator.get() == curr_chunk_ref.segment->allocator.get());
+		auto allocator = prev_chunk_ref.segment->allocator.get();
 		auto prev_min_block_id = prev_chunk_ref.GetMinimumBlockID();
 		auto curr_min_block_id = curr_chunk_ref.GetMinimumBlockID();
-		if (prev_allocator != curr_allocator) {
-			// Moved to the next allocator, delete all remaining blocks in the previous one
-			for (uint32_t block_id = prev_min_block_id; block_id < prev_allocator->BlockCount(); block_id++) {
-				prev_allocator->DeleteBlock(block_id);
-			}
-			continue;
-		}
-		// Same allocator, see if we can delete blocks
+		// Delete the blocks that the delete frontier has moved past
 		for (uint32_t block_id = prev_min_block_id; block_id < curr_min_block_id; block_id++) {
-			prev_allocator->DeleteBlock(block_id);
+			allocator->DeleteBlock(block_id);
 		}
 	}
 }
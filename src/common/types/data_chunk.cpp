@@ -15,6 +15,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/common/types/vector_cache.hpp"
+#include "duckdb/common/types/vector_cache_pool.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -57,6 +58,28 @@ void DataChunk::Initialize(ClientContext &context, vector<LogicalType>::const_it
 	Initialize(Allocator::Get(context), begin, end, capacity_p);
 }
 
+void DataChunk::Initialize(VectorCachePool &pool, const vector<LogicalType> &types) {
+	D_ASSERT(data.empty());   // can only be initialized once
+	D_ASSERT(!types.empty()); // empty chunk not allowed
+	capacity = STANDARD_VECTOR_SIZE;
+	for (auto &type : types) {
+		auto cache = pool.GetCache(type);
+		data.emplace_back(cache);
+		vector_caches.push_back(std::move(cache));
+	}
+}
+
+void DataChunk::RecycleCaches(VectorCachePool &pool) {
+	// destroy the vectors first, as they hold references to the cached buffers
+	data.clear();
+	for (auto &cache : vector_caches) {
+		pool.ReturnCache(std::move(cache));
+	}
+	vector_caches.clear();
+	capacity = 0;
+	SetCardinality(0);
+}
+
 void DataChunk::InitializeEmpty(vector<LogicalType>::const_iterator begin, vector<LogicalType>::const_iterator end) {
 	capacity = STANDARD_VECTOR_SIZE;
 	D_ASSERT(data.empty());                   // can only be initialized once
@@ -307,6 +330,16 @@ void DataChunk::Hash(Vector &result) {
 	}
 }
 
+void DataChunk::Hash(vector<idx_t> &column_ids, Vector &result) {
+	D_ASSERT(result.GetType().id() == LogicalType::HASH);
+	D_ASSERT(!column_ids.empty());
+
+	VectorOperations::Hash(data[column_ids[0]], result, size());
+	for (idx_t i = 1; i < column_ids.size(); i++) {
+		VectorOperations::CombineHash(result, data[column_ids[i]], size());
+	}
+}
+
 void DataChunk::Verify() {
 #ifdef DEBUG
 	D_ASSERT(size() <= capacity);
@@ -212,6 +212,39 @@ bool Date::TryConvertDate(const char *buf, idx_t len, idx_t &pos, date_t &result
 		return false;
 	}
 
+	// fast path for the common fixed-layout ISO-8601 date "YYYY-MM-DD": gather the eight digit characters into a
+	// single word and validate them all at once, instead of parsing character by character
+	if (len >= 10 && buf[4] == '-' && buf[7] == '-') {
+		bool fast_path = len == 10;
+		if (!fast_path && !StringUtil::CharacterIsDigit((unsigned char)buf[10])) {
+			if (strict) {
+				// in strict mode only trailing spaces may follow the date
+				fast_path = true;
+				for (idx_t i = 10; i < len; i++) {
+					if (!StringUtil::CharacterIsSpace((unsigned char)buf[i])) {
+						fast_path = false;
+						break;
+					}
+				}
+			} else {
+				// exclude a trailing " (BC)" suffix: the general parser handles that
+				fast_path = !(len >= 12 && buf[10] == ' ' && buf[11] == '(');
+			}
+		}
+		if (fast_path) {
+			const data_t digit_chars[8] {(data_t)buf[0], (data_t)buf[1], (data_t)buf[2], (data_t)buf[3],
+			                             (data_t)buf[5], (data_t)buf[6], (data_t)buf[8], (data_t)buf[9]};
+			if (StringUtil::CharactersAreDigits(digit_chars)) {
+				int32_t iso_year =
+				    (buf[0] - '0') * 1000 + (buf[1] - '0') * 100 + (buf[2] - '0') * 10 + (buf[3] - '0');
+				int32_t iso_month = (buf[5] - '0') * 10 + (buf[6] - '0');
+				int32_t iso_day = (buf[8] - '0') * 10 + (buf[9] - '0');
+				pos = strict ? len : 10;
+				return Date::TryFromDate(iso_year, iso_month, iso_day, result);
+			}
+		}
+	}
+
 	int32_t day = 0;
 	int32_t month = -1;
 	int32_t year = 0;
@@ -11,6 +11,12 @@
 
 namespace duckdb {
 
+#if ((__GNUC__ >= 5) || defined(__clang__)) && defined(__SIZEOF_INT128__)
+//! 128-bit type for the overflow-checked arithmetic fast paths below;
+//! __extension__ keeps -pedantic quiet about the non-standard __int128
+__extension__ typedef __int128 int128_arith_t;
+#endif
+
 //===--------------------------------------------------------------------===//
 // String Conversion
 //===--------------------------------------------------------------------===//
@@ -268,11 +274,22 @@ hugeint_t Hugeint::DivMod(hugeint_t lhs, hugeint_t rhs, hugeint_t &remainder) {
 	if (rhs_negative) {
 		Hugeint::NegateInPlace(rhs);
 	}
+	hugeint_t div_result;
+#if ((__GNUC__ >= 5) || defined(__clang__)) && defined(__SIZEOF_INT128__)
+	// use the native 128-bit division instead of the bit-by-bit loop: both operands are positive here
+	__uint128_t left = __uint128_t(lhs.lower) + (__uint128_t(lhs.upper) << 64);
+	__uint128_t right = __uint128_t(rhs.lower) + (__uint128_t(rhs.upper) << 64);
+	__uint128_t quotient = left / right;
+	__uint128_t rem = left % right;
+	div_result.lower = uint64_t(quotient & 0xffffffffffffffff);
+	div_result.upper = int64_t(uint64_t(quotient >> 64));
+	remainder.lower = uint64_t(rem & 0xffffffffffffffff);
+	remainder.upper = int64_t(uint64_t(rem >> 64));
+#else
 	// DivMod code adapted from:
 	// https://github.com/calccrypto/uint128_t/blob/master/uint128_t.cpp
 
 	// initialize the result and remainder to 0
-	hugeint_t div_result;
 	div_result.lower = 0;
 	div_result.upper = 0;
 	remainder.lower = 0;
@@ -296,6 +313,7 @@ hugeint_t Hugeint::DivMod(hugeint_t lhs, hugeint_t rhs, hugeint_t &remainder) {
 			Hugeint::AddInPlace(div_result, 1);
 		}
 	}
+#endif
 	if (lhs_negative ^ rhs_negative) {
 		Hugeint::NegateInPlace(div_result);
 	}
@@ -320,6 +338,22 @@ hugeint_t Hugeint::Modulo(hugeint_t lhs, hugeint_t rhs) {
 // Add/Subtract
 //===--------------------------------------------------------------------===//
 bool Hugeint::AddInPlace(hugeint_t &lhs, hugeint_t rhs) {
+#if ((__GNUC__ >= 5) || defined(__clang__)) && defined(__SIZEOF_INT128__)
+	// branch-free fast path: let the compiler emit the add-with-carry pair and an overflow flag check
+	int128_arith_t left = int128_arith_t(lhs.lower) + (int128_arith_t(lhs.upper) << 64);
+	int128_arith_t right = int128_arith_t(rhs.lower) + (int128_arith_t(rhs.upper) << 64);
+	int128_arith_t result_i128;
+	if (__builtin_add_overflow(left, right, &result_i128)) {
+		return false;
+	}
+	lhs.lower = uint64_t(__uint128_t(result_i128) & 0xffffffffffffffff);
+	lhs.upper = int64_t(uint64_t(__uint128_t(result_i128) >> 64));
+	if (lhs.upper == std::numeric_limits<int64_t>::min() && lhs.lower == 0) {
+		// the minimum value is not a valid hugeint
+		return false;
+	}
+	return true;
+#else
 	int overflow = lhs.lower + rhs.lower < lhs.lower;
 	if (rhs.upper >= 0) {
 		// RHS is positive: check for overflow
@@ -339,9 +373,26 @@ bool Hugeint::AddInPlace(hugeint_t &lhs, hugeint_t rhs) {
 		return false;
 	}
 	return true;
+#endif
 }
 
 bool Hugeint::SubtractInPlace(hugeint_t &lhs, hugeint_t rhs) {
+#if ((__GNUC__ >= 5) || defined(__clang__)) && defined(__SIZEOF_INT128__)
+	// branch-free fast path, mirroring AddInPlace
+	int128_arith_t left = int128_arith_t(lhs.lower) + (int128_arith_t(lhs.upper) << 64);
+	int128_arith_t right = int128_arith_t(rhs.lower) + (int128_arith_t(rhs.upper) << 64);
+	int128_arith_t result_i128;
+	if (__builtin_sub_overflow(left, right, &result_i128)) {
+		return false;
+	}
+	lhs.lower = uint64_t(__uint128_t(result_i128) & 0xffffffffffffffff);
+	lhs.upper = int64_t(uint64_t(__uint128_t(result_i128) >> 64));
+	if (lhs.upper == std::numeric_limits<int64_t>::min() && lhs.lower == 0) {
+		// the minimum value is not a valid hugeint
+		return false;
+	}
+	return true;
+#else
 	// underflow
 	int underflow = lhs.lower - rhs.lower > lhs.lower;
 	if (rhs.upper >= 0) {
@@ -363,6 +414,7 @@ bool Hugeint::SubtractInPlace(hugeint_t &lhs, hugeint_t rhs) {
 		return false;
 	}
 	return true;
+#endif
 }
 
 hugeint_t Hugeint::Add(hugeint_t lhs, hugeint_t rhs) {
@@ -88,9 +88,42 @@ unique_ptr<HyperLogLog> HyperLogLog::Copy() {
 	return result;
 }
 
+//! A sparse entry is a (register index, register value) pair
+static constexpr const idx_t SPARSE_ENTRY_SIZE = sizeof(uint16_t) + sizeof(uint8_t);
+
 void HyperLogLog::Serialize(FieldWriter &writer) const {
-	writer.WriteField<HLLStorageType>(HLLStorageType::UNCOMPRESSED);
-	writer.WriteBlob(GetPtr(), GetSize());
+	auto robj = (duckdb_hll::robj *)hll;
+	auto num_registers = duckdb_hll::num_registers();
+	// count the set registers to decide between the sparse and the dense encoding
+	idx_t non_zero = 0;
+	for (idx_t i = 0; i < num_registers; i++) {
+		if (duckdb_hll::get_register(robj, i) != 0) {
+			non_zero++;
+		}
+	}
+	if (non_zero * SPARSE_ENTRY_SIZE >= GetSize()) {
+		// most registers are set: write the registers as-is
+		writer.WriteField<HLLStorageType>(HLLStorageType::UNCOMPRESSED);
+		writer.WriteBlob(GetPtr(), GetSize());
+		return;
+	}
+	// few registers are set (e.g. a column with few distinct values): only write the non-zero registers
+	auto data = unique_ptr<data_t[]>(new data_t[non_zero * SPARSE_ENTRY_SIZE]);
+	idx_t offset = 0;
+	for (idx_t i = 0; i < num_registers; i++) {
+		auto value = duckdb_hll::get_register(robj, i);
+		if (value == 0) {
+			continue;
+		}
+		Store<uint16_t>(i, data.get() + offset);
+		offset += sizeof(uint16_t);
+		Store<uint8_t>(value, data.get() + offset);
+		offset += sizeof(uint8_t);
+	}
+	D_ASSERT(offset == non_zero * SPARSE_ENTRY_SIZE);
+	writer.WriteField<HLLStorageType>(HLLStorageType::SPARSE);
+	writer.WriteField<uint32_t>(non_zero);
+	writer.WriteBlob(data.get(), offset);
 }
 
 unique_ptr<HyperLogLog> HyperLogLog::Deserialize(FieldReader &reader) {
@@ -100,6 +133,20 @@ unique_ptr<HyperLogLog> HyperLogLog::Deserialize(FieldReader &reader) {
 	case HLLStorageType::UNCOMPRESSED:
 		reader.ReadBlob(result->GetPtr(), GetSize());
 		break;
+	case HLLStorageType::SPARSE: {
+		auto non_zero = reader.ReadRequired<uint32_t>();
+		auto data = unique_ptr<data_t[]>(new data_t[non_zero * SPARSE_ENTRY_SIZE]);
+		reader.ReadBlob(data.get(), non_zero * SPARSE_ENTRY_SIZE);
+		idx_t offset = 0;
+		for (idx_t i = 0; i < non_zero; i++) {
+			auto index = Load<uint16_t>(data.get() + offset);
+			offset += sizeof(uint16_t);
+			auto value = Load<uint8_t>(data.get() + offset);
+			offset += sizeof(uint8_t);
+			duckdb_hll::set_register((duckdb_hll::robj *)result->hll, index, value);
+		}
+		break;
+	}
 	default:
 		throw SerializationException("Unknown HyperLogLog storage type!");
 	}
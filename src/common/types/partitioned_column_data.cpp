@@ -1,5 +1,6 @@
 #include "duckdb/common/types/partitioned_column_data.hpp"
 
+#include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -18,6 +19,8 @@ unique_ptr<PartitionedColumnData> PartitionedColumnData::CreateShared() {
 	switch (type) {
 	case PartitionedColumnDataType::RADIX:
 		return make_unique<RadixPartitionedColumnData>((RadixPartitionedColumnData &)*this);
+	case PartitionedColumnDataType::HIVE:
+		return make_unique<HivePartitionedColumnData>((HivePartitionedColumnData &)*this);
 	default:
 		throw NotImplementedException("CreateShared for this type of PartitionedColumnData");
 	}
@@ -33,8 +36,13 @@ void PartitionedColumnData::InitializeAppendState(PartitionedColumnDataAppendSta
 }
 
 unique_ptr<DataChunk> PartitionedColumnData::CreatePartitionBuffer() const {
+	return CreatePartitionBuffer(BufferSize());
+}
+
+unique_ptr<DataChunk> PartitionedColumnData::CreatePartitionBuffer(idx_t capacity) const {
+	D_ASSERT((capacity & (capacity - 1)) == 0); // buffer capacities should be a power of two
 	auto result = make_unique<DataChunk>();
-	result->Initialize(BufferManager::GetBufferManager(context).GetBufferAllocator(), types, BufferSize());
+	result->Initialize(BufferManager::GetBufferManager(context).GetBufferAllocator(), types, capacity);
 	return result;
 }
 
@@ -108,7 +116,8 @@ void PartitionedColumnData::Append(PartitionedColumnDataAppendState &state, Data
 		// Create a selection vector for this partition using the offset into the single selection vector
 		partition_sel.Initialize(all_partitions_sel.data() + partition_offset);
 
-		if (partition_length >= HalfBufferSize()) {
+		const auto buffer_capacity = partition_buffer.GetCapacity();
+		if (partition_length >= buffer_capacity / 2) {
 			// Slice the input chunk using the selection vector
 			state.slice_chunk.Reset();
 			state.slice_chunk.Slice(input, partition_sel, partition_length);
@@ -119,11 +128,17 @@ void PartitionedColumnData::Append(PartitionedColumnDataAppendState &state, Data
 			// Append the input chunk to the partition buffer using the selection vector
 			partition_buffer.Append(input, false, &partition_sel, partition_length);
 
-			if (partition_buffer.size() >= HalfBufferSize()) {
+			if (partition_buffer.size() >= buffer_capacity / 2) {
 				// Next batch won't fit in the buffer, flush it to the partition
 				partition.Append(*partition_append_state, partition_buffer);
-				partition_buffer.Reset();
-				partition_buffer.SetCapacity(BufferSize());
+				if (buffer_capacity < MaxBufferSize()) {
+					// This partition keeps receiving rows: double its buffer capacity so that it flushes
+					// into the shared partition allocator less often
+					state.partition_buffers[partition_index] = CreatePartitionBuffer(buffer_capacity * 2);
+				} else {
+					partition_buffer.Reset();
+					partition_buffer.SetCapacity(buffer_capacity);
+				}
 			}
 		}
 	}
@@ -146,8 +161,14 @@ void PartitionedColumnData::Combine(PartitionedColumnData &other) {
 		partitions = std::move(other.partitions);
 	} else {
 		// Combine the append state's partitions into this PartitionedColumnData
+		// for partitioning types that discover partitions on the fly (e.g., hive), the other PartitionedColumnData
+		// may hold more partitions than this one - move over any partitions we have not seen yet
 		for (idx_t i = 0; i < other.partitions.size(); i++) {
-			partitions[i]->Combine(*other.partitions[i]);
+			if (i < partitions.size()) {
+				partitions[i]->Combine(*other.partitions[i]);
+			} else {
+				partitions.push_back(std::move(other.partitions[i]));
+			}
 		}
 	}
 }
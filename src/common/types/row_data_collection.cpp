@@ -70,23 +70,38 @@ vector<BufferHandle> RowDataCollection::Build(idx_t added_count, data_ptr_t key_
 				handles.push_back(std::move(handle));
 			}
 		}
-		while (remaining > 0) {
-			// now for the remaining data, allocate new buffers to store the data and append there
-			auto &new_block = CreateBlock();
-			auto handle = buffer_manager.Pin(new_block.block);
+	}
+	// for the remaining data we allocate new blocks outside of the lock: allocating buffer manager blocks is
+	// expensive, and the new blocks are private to this thread until they are spliced into the block list below,
+	// so concurrent builders only serialize on the block list itself
+	vector<unique_ptr<RowDataBlock>> new_blocks;
+	vector<BufferHandle> new_pinned_blocks;
+	while (remaining > 0) {
+		auto new_block = make_unique<RowDataBlock>(buffer_manager, block_capacity, entry_size);
+		auto handle = buffer_manager.Pin(new_block->block);
 
-			// offset the entry sizes array if we have added entries already
-			idx_t *offset_entry_sizes = entry_sizes ? entry_sizes + added_count - remaining : nullptr;
+		// offset the entry sizes array if we have added entries already
+		idx_t *offset_entry_sizes = entry_sizes ? entry_sizes + added_count - remaining : nullptr;
 
-			idx_t append_count = AppendToBlock(new_block, handle, append_entries, remaining, offset_entry_sizes);
-			D_ASSERT(new_block.count > 0);
-			remaining -= append_count;
+		idx_t append_count = AppendToBlock(*new_block, handle, append_entries, remaining, offset_entry_sizes);
+		D_ASSERT(new_block->count > 0);
+		remaining -= append_count;
 
-			if (keep_pinned) {
-				pinned_blocks.push_back(std::move(handle));
-			} else {
-				handles.push_back(std::move(handle));
-			}
+		if (keep_pinned) {
+			new_pinned_blocks.push_back(std::move(handle));
+		} else {
+			handles.push_back(std::move(handle));
+		}
+		new_blocks.push_back(std::move(new_block));
+	}
+	if (!new_blocks.empty()) {
+		// splice the new blocks into the block list
+		lock_guard<mutex> append_lock(rdc_lock);
+		for (auto &block : new_blocks) {
+			blocks.push_back(std::move(block));
+		}
+		for (auto &handle : new_pinned_blocks) {
+			pinned_blocks.push_back(std::move(handle));
 		}
 	}
 	// now set up the key_locations based on the append entries
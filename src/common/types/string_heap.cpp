@@ -55,4 +55,23 @@ string_t StringHeap::EmptyString(idx_t len) {
 	return string_t(insert_pos, len);
 }
 
+void StringHeap::AddStringBatch(string_t *entries[], idx_t count) {
+	// compute the total size of the batch so we only have to reserve heap space once
+	idx_t total_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		D_ASSERT(!entries[i]->IsInlined());
+		total_size += entries[i]->GetSize();
+	}
+	if (total_size == 0) {
+		return;
+	}
+	auto insert_pos = (char *)allocator.Allocate(total_size);
+	for (idx_t i = 0; i < count; i++) {
+		auto len = entries[i]->GetSize();
+		memcpy(insert_pos, entries[i]->GetDataUnsafe(), len);
+		*entries[i] = string_t(insert_pos, len);
+		insert_pos += len;
+	}
+}
+
 } // namespace duckdb
@@ -26,59 +26,80 @@ bool Time::TryConvertInternal(const char *buf, idx_t len, idx_t &pos, dtime_t &r
 		return false;
 	}
 
-	int sep;
-
-	// skip leading spaces
-	while (pos < len && StringUtil::CharacterIsSpace(buf[pos])) {
-		pos++;
+	// fast path for the common fixed-layout time "HH:MM:SS": gather the six digit characters into a single word and
+	// validate them all at once, instead of parsing character by character
+	bool fast_path = false;
+	if (len >= 8 && buf[2] == ':' && buf[5] == ':' &&
+	    (len == 8 || !StringUtil::CharacterIsDigit((unsigned char)buf[8]))) {
+		const data_t digit_chars[8] {(data_t)buf[0], (data_t)buf[1], (data_t)buf[3], (data_t)buf[4],
+		                             (data_t)buf[6], (data_t)buf[7], '0', '0'};
+		if (StringUtil::CharactersAreDigits(digit_chars)) {
+			hour = (buf[0] - '0') * 10 + (buf[1] - '0');
+			min = (buf[3] - '0') * 10 + (buf[4] - '0');
+			sec = (buf[6] - '0') * 10 + (buf[7] - '0');
+			if (hour >= 24 || min >= 60 || sec >= 60) {
+				return false;
+			}
+			pos = 8;
+			fast_path = true;
+		}
 	}
 
-	if (pos >= len) {
-		return false;
-	}
+	if (!fast_path) {
+		int sep;
 
-	if (!StringUtil::CharacterIsDigit(buf[pos])) {
-		return false;
-	}
+		// skip leading spaces
+		while (pos < len && StringUtil::CharacterIsSpace(buf[pos])) {
+			pos++;
+		}
 
-	if (!Date::ParseDoubleDigit(buf, len, pos, hour)) {
-		return false;
-	}
-	if (hour < 0 || hour >= 24) {
-		return false;
-	}
+		if (pos >= len) {
+			return false;
+		}
 
-	if (pos >= len) {
-		return false;
-	}
+		if (!StringUtil::CharacterIsDigit(buf[pos])) {
+			return false;
+		}
 
-	// fetch the separator
-	sep = buf[pos++];
-	if (sep != ':') {
-		// invalid separator
-		return false;
-	}
+		if (!Date::ParseDoubleDigit(buf, len, pos, hour)) {
+			return false;
+		}
+		if (hour < 0 || hour >= 24) {
+			return false;
+		}
 
-	if (!Date::ParseDoubleDigit(buf, len, pos, min)) {
-		return false;
-	}
-	if (min < 0 || min >= 60) {
-		return false;
-	}
+		if (pos >= len) {
+			return false;
+		}
 
-	if (pos >= len) {
-		return false;
-	}
+		// fetch the separator
+		sep = buf[pos++];
+		if (sep != ':') {
+			// invalid separator
+			return false;
+		}
 
-	if (buf[pos++] != sep) {
-		return false;
-	}
+		if (!Date::ParseDoubleDigit(buf, len, pos, min)) {
+			return false;
+		}
+		if (min < 0 || min >= 60) {
+			return false;
+		}
 
-	if (!Date::ParseDoubleDigit(buf, len, pos, sec)) {
-		return false;
-	}
-	if (sec < 0 || sec >= 60) {
-		return false;
+		if (pos >= len) {
+			return false;
+		}
+
+		if (buf[pos++] != sep) {
+			return false;
+		}
+
+		if (!Date::ParseDoubleDigit(buf, len, pos, sec)) {
+			return false;
+		}
+		if (sec < 0 || sec >= 60) {
+			return false;
+		}
 	}
 
 	micros = 0;
@@ -32,8 +32,16 @@ void ValidityMask::Combine(const ValidityMask &other, idx_t count) {
 	auto result_data = GetData();
 
 	auto entry_count = ValidityData::EntryCount(count);
+	validity_t combined = ValidityData::MAX_ENTRY;
 	for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
-		result_data[entry_idx] = data[entry_idx] & other_data[entry_idx];
+		auto entry = data[entry_idx] & other_data[entry_idx];
+		result_data[entry_idx] = entry;
+		combined &= entry;
+	}
+	if (combined == ValidityData::MAX_ENTRY) {
+		// the combined mask has no invalid rows: collapse it into the all-valid representation, so that downstream
+		// kernels take the no-null fast path without rescanning the mask
+		Reset();
 	}
 }
 
@@ -78,49 +86,40 @@ void ValidityMask::Slice(const ValidityMask &other, idx_t offset, idx_t end) {
 		Initialize(other);
 		return;
 	}
-	ValidityMask new_mask(end - offset);
+	idx_t count = end - offset;
+	ValidityMask new_mask(count);
+	auto source_data = other.GetData();
+	auto result_data = new_mask.GetData();
 
-// FIXME THIS NEEDS FIXING!
-#if 1
-	for (idx_t i = offset; i < end; i++) {
-		new_mask.Set(i - offset, other.RowIsValid(i));
-	}
-	Initialize(new_mask);
-#else
-	// first shift the "whole" units
+	auto result_entry_count = ValidityData::EntryCount(count);
+	auto source_entry_count = ValidityData::EntryCount(end);
 	idx_t entire_units = offset / BITS_PER_VALUE;
-	idx_t sub_units = offset - entire_units * BITS_PER_VALUE;
-	if (entire_units > 0) {
-		idx_t validity_idx;
-		for (validity_idx = 0; validity_idx + entire_units < STANDARD_ENTRY_COUNT; validity_idx++) {
-			new_mask.validity_mask[validity_idx] = other.validity_mask[validity_idx + entire_units];
+	idx_t sub_units = offset % BITS_PER_VALUE;
+	if (sub_units == 0) {
+		// the offset is aligned to an entry boundary: we can copy the entries directly
+		for (idx_t entry_idx = 0; entry_idx < result_entry_count; entry_idx++) {
+			result_data[entry_idx] = source_data[entry_idx + entire_units];
 		}
-	}
-	// now we shift the remaining sub units
-	// this gets a bit more complicated because we have to shift over the borders of the entries
-	// e.g. suppose we have 2 entries of length 4 and we left-shift by two
-	// 0101|1010
-	// a regular left-shift of both gets us:
-	// 0100|1000
-	// we then OR the overflow (right-shifted by BITS_PER_VALUE - offset) together to get the correct result
-	// 0100|1000 ->
-	// 0110|1000
-	if (sub_units > 0) {
-		idx_t validity_idx;
-		for (validity_idx = 0; validity_idx + 1 < STANDARD_ENTRY_COUNT; validity_idx++) {
-			new_mask.validity_mask[validity_idx] =
-			    (other.validity_mask[validity_idx] >> sub_units) |
-			    (other.validity_mask[validity_idx + 1] << (BITS_PER_VALUE - sub_units));
+	} else {
+		// the offset cuts through an entry: every result entry combines the high bits of one source entry with the
+		// low bits of the next one
+		for (idx_t entry_idx = 0; entry_idx < result_entry_count; entry_idx++) {
+			auto entry = source_data[entry_idx + entire_units] >> sub_units;
+			if (entry_idx + entire_units + 1 < source_entry_count) {
+				entry |= source_data[entry_idx + entire_units + 1] << (BITS_PER_VALUE - sub_units);
+			} else {
+				// no source entry for the high bits: rows past the end of the source are valid
+				entry |= ValidityData::MAX_ENTRY << (BITS_PER_VALUE - sub_units);
+			}
+			result_data[entry_idx] = entry;
 		}
-		new_mask.validity_mask[validity_idx] >>= sub_units;
 	}
 #ifdef DEBUG
-	for (idx_t i = offset; i < STANDARD_VECTOR_SIZE; i++) {
+	for (idx_t i = offset; i < end; i++) {
 		D_ASSERT(new_mask.RowIsValid(i - offset) == other.RowIsValid(i));
 	}
-	Initialize(new_mask);
-#endif
 #endif
+	Initialize(new_mask);
 }
 
 } // namespace duckdb
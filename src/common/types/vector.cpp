@@ -1378,6 +1378,19 @@ string_t StringVector::AddStringOrBlob(Vector &vector, string_t data) {
 	return string_buffer.AddBlob(data);
 }
 
+void StringVector::AddStringBatch(Vector &vector, string_t *entries[], idx_t count) {
+	D_ASSERT(vector.GetType().InternalType() == PhysicalType::VARCHAR);
+	if (count == 0) {
+		return;
+	}
+	if (!vector.auxiliary) {
+		vector.auxiliary = make_buffer<VectorStringBuffer>();
+	}
+	D_ASSERT(vector.auxiliary->GetBufferType() == VectorBufferType::STRING_BUFFER);
+	auto &string_buffer = (VectorStringBuffer &)*vector.auxiliary;
+	string_buffer.AddStringBatch(entries, count);
+}
+
 string_t StringVector::EmptyString(Vector &vector, idx_t len) {
 	D_ASSERT(vector.GetType().InternalType() == PhysicalType::VARCHAR);
 	if (len < string_t::INLINE_LENGTH) {
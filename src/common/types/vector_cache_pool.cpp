@@ -0,0 +1,36 @@
+#include "duckdb/common/types/vector_cache_pool.hpp"
+
+#include "duckdb/common/allocator.hpp"
+
+namespace duckdb {
+
+VectorCachePool::VectorCachePool(Allocator &allocator) : allocator(allocator) {
+}
+
+VectorCache VectorCachePool::GetCache(const LogicalType &type) {
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = caches.find(type);
+		if (entry != caches.end() && !entry->second.empty()) {
+			auto cache = std::move(entry->second.back());
+			entry->second.pop_back();
+			return cache;
+		}
+	}
+	return VectorCache(allocator, type);
+}
+
+void VectorCachePool::ReturnCache(VectorCache cache) {
+	if (!cache.buffer || cache.buffer.use_count() != 1) {
+		// the buffer of this cache is still referenced by a vector somewhere: it cannot be handed out again
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto &free_list = caches[cache.GetType()];
+	if (free_list.size() >= MAXIMUM_CACHES_PER_TYPE) {
+		return;
+	}
+	free_list.push_back(std::move(cache));
+}
+
+} // namespace duckdb
@@ -11,8 +11,61 @@
 
 #include "duckdb/common/likely.hpp"
 
+#if defined(__x86_64__) && defined(__linux__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+//! Comparison loops on flat, fully valid integer vectors are trivially auto-vectorizable. We compile them once per
+//! instruction set through function multi-versioning; the ifunc resolver picks the widest variant the executing CPU
+//! supports, so a single shipped binary gets SSE4.2/AVX2/AVX-512 kernels without a compile-time -march choice.
+#define DUCKDB_COMPARISON_TARGET_CLONES __attribute__((target_clones("default", "sse4.2", "avx2", "avx512f")))
+#endif
+#endif
+
 namespace duckdb {
 
+//! Dispatch point for the SIMD comparison fast path. The generic template refuses so callers fall back to the scalar
+//! BinaryExecutor loop; specializations are generated below for the integer types that benefit. Floating point types
+//! are deliberately excluded: their comparison operators have NaN-handling semantics (see the specializations in this
+//! file) that do not map onto the plain SIMD compare instructions the compiler emits for these loops.
+struct ComparisonSIMD {
+	template <class T, class OP>
+	static bool TryExecuteFlat(const T *__restrict ldata, const T *__restrict rdata, bool *__restrict result_data,
+	                           idx_t count) {
+		return false;
+	}
+};
+
+#ifdef DUCKDB_COMPARISON_TARGET_CLONES
+
+#define DUCKDB_COMPARISON_SIMD_KERNEL(TYPE, OP, CMP)                                                                   \
+	DUCKDB_COMPARISON_TARGET_CLONES static void SIMDCompare##OP##TYPE(                                                 \
+	    const TYPE *__restrict ldata, const TYPE *__restrict rdata, bool *__restrict result_data, idx_t count) {       \
+		for (idx_t i = 0; i < count; i++) {                                                                            \
+			result_data[i] = ldata[i] CMP rdata[i];                                                                    \
+		}                                                                                                              \
+	}                                                                                                                  \
+	template <>                                                                                                        \
+	bool ComparisonSIMD::TryExecuteFlat<TYPE, duckdb::OP>(const TYPE *__restrict ldata, const TYPE *__restrict rdata,  \
+	                                                      bool *__restrict result_data, idx_t count) {                 \
+		SIMDCompare##OP##TYPE(ldata, rdata, result_data, count);                                                       \
+		return true;                                                                                                   \
+	}
+
+#define DUCKDB_COMPARISON_SIMD_KERNELS(TYPE)                                                                           \
+	DUCKDB_COMPARISON_SIMD_KERNEL(TYPE, Equals, ==)                                                                    \
+	DUCKDB_COMPARISON_SIMD_KERNEL(TYPE, NotEquals, !=)                                                                 \
+	DUCKDB_COMPARISON_SIMD_KERNEL(TYPE, GreaterThan, >)                                                                \
+	DUCKDB_COMPARISON_SIMD_KERNEL(TYPE, GreaterThanEquals, >=)                                                         \
+	DUCKDB_COMPARISON_SIMD_KERNEL(TYPE, LessThan, <)                                                                   \
+	DUCKDB_COMPARISON_SIMD_KERNEL(TYPE, LessThanEquals, <=)
+
+DUCKDB_COMPARISON_SIMD_KERNELS(int32_t)
+DUCKDB_COMPARISON_SIMD_KERNELS(int64_t)
+
+#undef DUCKDB_COMPARISON_SIMD_KERNELS
+#undef DUCKDB_COMPARISON_SIMD_KERNEL
+
+#endif
+
 template <class T>
 bool EqualsFloat(T left, T right) {
 	if (DUCKDB_UNLIKELY(Value::IsNan(left) && Value::IsNan(right))) {
@@ -198,8 +251,30 @@ static void NestedComparisonExecutor(Vector &left, Vector &right, Vector &result
 
 struct ComparisonExecutor {
 private:
+	template <class T, class OP>
+	static inline bool TrySIMDExecute(Vector &left, Vector &right, Vector &result, idx_t count) {
+		if (left.GetVectorType() != VectorType::FLAT_VECTOR || right.GetVectorType() != VectorType::FLAT_VECTOR) {
+			return false;
+		}
+		if (!FlatVector::Validity(left).AllValid() || !FlatVector::Validity(right).AllValid()) {
+			return false;
+		}
+		auto ldata = FlatVector::GetData<T>(left);
+		auto rdata = FlatVector::GetData<T>(right);
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		auto result_data = FlatVector::GetData<bool>(result);
+		if (!ComparisonSIMD::TryExecuteFlat<T, OP>(ldata, rdata, result_data, count)) {
+			return false;
+		}
+		FlatVector::SetValidity(result, FlatVector::Validity(left));
+		return true;
+	}
+
 	template <class T, class OP>
 	static inline void TemplatedExecute(Vector &left, Vector &right, Vector &result, idx_t count) {
+		if (TrySIMDExecute<T, OP>(left, right, result, count)) {
+			return;
+		}
 		BinaryExecutor::Execute<T, T, bool, OP>(left, right, result, count);
 	}
 
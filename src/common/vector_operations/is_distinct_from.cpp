@@ -54,9 +54,67 @@ static void DistinctExecuteGeneric(Vector &left, Vector &right, Vector &result,
 	}
 }
 
+template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+static void DistinctExecuteFlatLoop(LEFT_TYPE *__restrict ldata, RIGHT_TYPE *__restrict rdata,
+                                    RESULT_TYPE *__restrict result_data, idx_t count, ValidityMask &lmask,
+                                    ValidityMask &rmask) {
+	const bool lconst_null = LEFT_CONSTANT && !lmask.RowIsValid(0);
+	const bool rconst_null = RIGHT_CONSTANT && !rmask.RowIsValid(0);
+	if ((LEFT_CONSTANT || lmask.AllValid()) && (RIGHT_CONSTANT || rmask.AllValid())) {
+		// no NULLs on either side: reduce to a plain comparison loop over the flat data
+		for (idx_t i = 0; i < count; i++) {
+			auto lentry = ldata[LEFT_CONSTANT ? 0 : i];
+			auto rentry = rdata[RIGHT_CONSTANT ? 0 : i];
+			result_data[i] = OP::template Operation<LEFT_TYPE>(lentry, rentry, lconst_null, rconst_null);
+		}
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		idx_t lidx = LEFT_CONSTANT ? 0 : i;
+		idx_t ridx = RIGHT_CONSTANT ? 0 : i;
+		result_data[i] =
+		    OP::template Operation<LEFT_TYPE>(ldata[lidx], rdata[ridx], !lmask.RowIsValid(lidx), !rmask.RowIsValid(ridx));
+	}
+}
+
+template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+static void DistinctExecuteFlat(Vector &left, Vector &right, Vector &result, idx_t count) {
+	auto ldata = FlatVector::GetData<LEFT_TYPE>(left);
+	auto rdata = FlatVector::GetData<RIGHT_TYPE>(right);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<RESULT_TYPE>(result);
+	if (LEFT_CONSTANT) {
+		ValidityMask lmask;
+		if (ConstantVector::IsNull(left)) {
+			lmask.SetAllInvalid(1);
+		}
+		DistinctExecuteFlatLoop<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+		    ldata, rdata, result_data, count, lmask, FlatVector::Validity(right));
+	} else if (RIGHT_CONSTANT) {
+		ValidityMask rmask;
+		if (ConstantVector::IsNull(right)) {
+			rmask.SetAllInvalid(1);
+		}
+		DistinctExecuteFlatLoop<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+		    ldata, rdata, result_data, count, FlatVector::Validity(left), rmask);
+	} else {
+		DistinctExecuteFlatLoop<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP, LEFT_CONSTANT, RIGHT_CONSTANT>(
+		    ldata, rdata, result_data, count, FlatVector::Validity(left), FlatVector::Validity(right));
+	}
+}
+
 template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OP>
 static void DistinctExecuteSwitch(Vector &left, Vector &right, Vector &result, idx_t count) {
-	DistinctExecuteGeneric<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP>(left, right, result, count);
+	if (left.GetVectorType() == VectorType::CONSTANT_VECTOR && right.GetVectorType() == VectorType::FLAT_VECTOR) {
+		DistinctExecuteFlat<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP, true, false>(left, right, result, count);
+	} else if (left.GetVectorType() == VectorType::FLAT_VECTOR && right.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		DistinctExecuteFlat<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP, false, true>(left, right, result, count);
+	} else if (left.GetVectorType() == VectorType::FLAT_VECTOR && right.GetVectorType() == VectorType::FLAT_VECTOR) {
+		DistinctExecuteFlat<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP, false, false>(left, right, result, count);
+	} else {
+		DistinctExecuteGeneric<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, OP>(left, right, result, count);
+	}
 }
 
 template <class LEFT_TYPE, class RIGHT_TYPE, class RESULT_TYPE, class OP>
@@ -170,13 +170,27 @@ void VectorOperations::Copy(const Vector &source_p, Vector &target, const Select
 	case PhysicalType::VARCHAR: {
 		auto ldata = FlatVector::GetData<string_t>(*source);
 		auto tdata = FlatVector::GetData<string_t>(target);
+		// assign all string entries first, then move the non-inlined strings into the heap of the target vector
+		// in batches: this reserves heap space once per batch instead of once per string
+		string_t *heap_entries[STANDARD_VECTOR_SIZE];
+		idx_t heap_count = 0;
 		for (idx_t i = 0; i < copy_count; i++) {
 			auto source_idx = sel->get_index(source_offset + i);
 			auto target_idx = target_offset + i;
-			if (tmask.RowIsValid(target_idx)) {
-				tdata[target_idx] = StringVector::AddStringOrBlob(target, ldata[source_idx]);
+			if (!tmask.RowIsValid(target_idx)) {
+				continue;
+			}
+			tdata[target_idx] = ldata[source_idx];
+			if (tdata[target_idx].IsInlined()) {
+				continue;
+			}
+			heap_entries[heap_count++] = &tdata[target_idx];
+			if (heap_count == STANDARD_VECTOR_SIZE) {
+				StringVector::AddStringBatch(target, heap_entries, heap_count);
+				heap_count = 0;
 			}
 		}
+		StringVector::AddStringBatch(target, heap_entries, heap_count);
 		break;
 	}
 	case PhysicalType::STRUCT: {
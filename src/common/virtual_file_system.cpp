@@ -1,8 +1,11 @@
 #include "duckdb/common/virtual_file_system.hpp"
 
+#include "duckdb/common/cache_file_system.hpp"
+#include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/gzip_file_system.hpp"
 #include "duckdb/common/pipe_file_system.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/value.hpp"
 
 namespace duckdb {
 
@@ -34,6 +37,20 @@ unique_ptr<FileHandle> VirtualFileSystem::OpenFile(const string &path, uint8_t f
 			    "Attempting to open a compressed file, but the compression type is not supported");
 		}
 		file_handle = entry->second->OpenCompressedFile(std::move(file_handle), flags & FileFlags::FILE_FLAGS_WRITE);
+	} else if (opener && !(flags & FileFlags::FILE_FLAGS_WRITE) && !file_handle->OnDiskFile() &&
+	           file_handle->CanSeek()) {
+		// remote files can be backed by a persistent local cache directory, if one is configured
+		Value cache_directory;
+		if (opener->TryGetCurrentSetting("remote_file_cache_directory", cache_directory) &&
+		    !cache_directory.IsNull() && !cache_directory.ToString().empty()) {
+			idx_t max_cache_size = CacheFileSystem::DEFAULT_CACHE_SIZE;
+			Value cache_size;
+			if (opener->TryGetCurrentSetting("remote_file_cache_size", cache_size) && !cache_size.IsNull()) {
+				max_cache_size = cache_size.GetValue<uint64_t>();
+			}
+			file_handle =
+			    CacheFileSystem::OpenCachedFile(std::move(file_handle), cache_directory.ToString(), max_cache_size);
+		}
 	}
 	return file_handle;
 }
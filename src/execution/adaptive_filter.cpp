@@ -27,6 +27,18 @@ AdaptiveFilter::AdaptiveFilter(TableFilterSet *table_filters)
 	swap_likeliness.pop_back();
 	right_random_border = 100 * (table_filters->filters.size() - 1);
 }
+
+AdaptiveFilter::AdaptiveFilter(idx_t condition_count)
+    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true) {
+	D_ASSERT(condition_count > 1);
+	for (idx_t idx = 0; idx < condition_count; idx++) {
+		permutation.push_back(idx);
+		if (idx != condition_count - 1) {
+			swap_likeliness.push_back(100);
+		}
+	}
+	right_random_border = 100 * (condition_count - 1);
+}
 void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
 	iteration_count++;
 	runtime_sum += duration;
@@ -37,7 +37,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      HtEntryType entry_type)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      entry_type(entry_type), capacity(0), entries(0), payload_page_offset(0), is_finalized(false),
+      entry_type(entry_type), capacity(0), entries(0), old_hashes_hdl_ptr(nullptr), old_capacity(0), old_bitmask(0),
+      migrate_position(0), migrate_end(0), payload_page_offset(0), is_finalized(false),
       ht_offsets(LogicalTypeId::BIGINT), hash_salts(LogicalTypeId::SMALLINT),
       group_compare_vector(STANDARD_VECTOR_SIZE), no_match_vector(STANDARD_VECTOR_SIZE),
       empty_vector(STANDARD_VECTOR_SIZE) {
@@ -53,8 +54,6 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 
 	D_ASSERT(tuple_size <= Storage::BLOCK_SIZE);
 	tuples_per_block = Storage::BLOCK_SIZE / tuple_size;
-	hashes_hdl = buffer_manager.Allocate(Storage::BLOCK_SIZE);
-	hashes_hdl_ptr = hashes_hdl.Ptr();
 
 	switch (entry_type) {
 	case HtEntryType::HT_WIDTH_64: {
@@ -72,6 +71,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 	}
 
 	predicates.resize(layout.ColumnCount() - 1, ExpressionType::COMPARE_EQUAL);
+	match_function = RowOperations::InitializeMatch(layout, predicates);
+	scatter_function = RowOperations::InitializeScatter(layout);
 	string_heap = make_unique<RowDataCollection>(buffer_manager, (idx_t)Storage::BLOCK_SIZE, 1, true);
 }
 
@@ -128,15 +129,19 @@ void GroupedAggregateHashTable::Destroy() {
 	PayloadApply([&](idx_t page_nr, idx_t page_offset, data_ptr_t ptr) {
 		data_pointers[count++] = ptr;
 		if (count == STANDARD_VECTOR_SIZE) {
-			RowOperations::DestroyStates(layout, state_vector, count);
+			RowOperations::DestroyStates(aggregate_allocator, layout, state_vector, count);
 			count = 0;
 		}
 	});
-	RowOperations::DestroyStates(layout, state_vector, count);
+	RowOperations::DestroyStates(aggregate_allocator, layout, state_vector, count);
 }
 
 template <class ENTRY>
 void GroupedAggregateHashTable::VerifyInternal() {
+	if (ResizeInProgress()) {
+		// during an incremental resize the entries are split over the old and the new directory
+		return;
+	}
 	auto hashes_ptr = (ENTRY *)hashes_hdl_ptr;
 	D_ASSERT(payload_hds.size() == payload_hds_ptrs.size());
 	idx_t count = 0;
@@ -173,6 +178,12 @@ idx_t GroupedAggregateHashTable::MaxCapacity() {
 	return max_pages * MinValue(max_tuples, (idx_t)Storage::BLOCK_SIZE / tuple_size);
 }
 
+idx_t GroupedAggregateHashTable::TotalSize() const {
+	idx_t entry_width =
+	    entry_type == HtEntryType::HT_WIDTH_64 ? sizeof(aggr_ht_entry_64) : sizeof(aggr_ht_entry_32);
+	return payload_hds.size() * (idx_t)Storage::BLOCK_SIZE + string_heap->SizeInBytes() + capacity * entry_width;
+}
+
 void GroupedAggregateHashTable::Verify() {
 #ifdef DEBUG
 	switch (entry_type) {
@@ -199,20 +210,55 @@ void GroupedAggregateHashTable::Resize(idx_t size) {
 
 	// size needs to be a power of 2
 	D_ASSERT((size & (size - 1)) == 0);
-	bitmask = size - 1;
+
+	if (ResizeInProgress()) {
+		// a previous incremental resize has not finished migrating yet: complete it before starting a new one
+		FinishResize<ENTRY>();
+	}
 
 	auto byte_size = size * sizeof(ENTRY);
-	if (byte_size > (idx_t)Storage::BLOCK_SIZE) {
-		hashes_hdl = buffer_manager.Allocate(byte_size);
-		hashes_hdl_ptr = hashes_hdl.Ptr();
+	auto new_hashes_hdl = buffer_manager.Allocate(MaxValue<idx_t>(byte_size, (idx_t)Storage::BLOCK_SIZE));
+	auto new_hashes_ptr = new_hashes_hdl.Ptr();
+	memset(new_hashes_ptr, 0, byte_size);
+
+	if (entries > 0) {
+		// stash the filled directory: instead of rehashing all entries in one shot we migrate them into the new
+		// directory in bounded chunks while probing continues, so the worst-case stall of a resize stays bounded
+		old_hashes_hdl = std::move(hashes_hdl);
+		old_hashes_hdl_ptr = hashes_hdl_ptr;
+		old_capacity = capacity;
+		old_bitmask = bitmask;
+		migrate_position = 0;
+		migrate_end = entries;
 	}
-	memset(hashes_hdl_ptr, 0, byte_size);
+
+	hashes_hdl = std::move(new_hashes_hdl);
+	hashes_hdl_ptr = new_hashes_ptr;
 	hashes_end_ptr = hashes_hdl_ptr + byte_size;
 	capacity = size;
+	bitmask = size - 1;
+
+	if (ResizeInProgress()) {
+		// migrate the first chunk immediately
+		MigrateOldDirectory<ENTRY>(RESIZE_MIGRATION_CHUNK);
+	}
 
+	Verify();
+}
+
+template <class ENTRY>
+void GroupedAggregateHashTable::MigrateOldDirectory(idx_t migrate_count) {
+	D_ASSERT(ResizeInProgress());
 	auto hashes_arr = (ENTRY *)hashes_hdl_ptr;
 
-	PayloadApply([&](idx_t page_nr, idx_t page_offset, data_ptr_t ptr) {
+	// the payload rows themselves do not move during a resize: migrating a row merely means inserting a directory
+	// entry that points to it into the new directory. Rows at or beyond migrate_end were added after the resize
+	// started and already live in the new directory.
+	auto end = MinValue<idx_t>(migrate_end, migrate_position + migrate_count);
+	for (; migrate_position < end; migrate_position++) {
+		auto page_nr = migrate_position / tuples_per_block;
+		auto page_offset = migrate_position % tuples_per_block;
+		auto ptr = payload_hds_ptrs[page_nr] + page_offset * tuple_size;
 		auto hash = Load<hash_t>(ptr + hash_offset);
 		D_ASSERT((hash & bitmask) == (hash % capacity));
 		auto entry_idx = (idx_t)hash & bitmask;
@@ -229,9 +275,26 @@ void GroupedAggregateHashTable::Resize(idx_t size) {
 		hashes_arr[entry_idx].salt = hash >> hash_prefix_shift;
 		hashes_arr[entry_idx].page_nr = page_nr + 1;
 		hashes_arr[entry_idx].page_offset = page_offset;
-	});
+	}
 
-	Verify();
+	if (migrate_position == migrate_end) {
+		// migration complete: release the old directory
+		old_hashes_hdl.Destroy();
+		old_hashes_hdl_ptr = nullptr;
+		old_capacity = 0;
+		old_bitmask = 0;
+		migrate_position = 0;
+		migrate_end = 0;
+	}
+}
+
+template <class ENTRY>
+void GroupedAggregateHashTable::FinishResize() {
+	if (!ResizeInProgress()) {
+		return;
+	}
+	MigrateOldDirectory<ENTRY>(migrate_end - migrate_position);
+	D_ASSERT(!ResizeInProgress());
 }
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload, AggregateType filter) {
@@ -290,9 +353,10 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 		D_ASSERT(i == filter[filter_idx]);
 
 		if (aggr.aggr_type != AggregateType::DISTINCT && aggr.filter) {
-			RowOperations::UpdateFilteredStates(filter_set.GetFilterData(i), aggr, addresses, payload, payload_idx);
+			RowOperations::UpdateFilteredStates(aggregate_allocator, filter_set.GetFilterData(i), aggr, addresses,
+			                                    payload, payload_idx);
 		} else {
-			RowOperations::UpdateStates(aggr, addresses, payload, payload_idx, payload.size());
+			RowOperations::UpdateStates(aggregate_allocator, aggr, addresses, payload, payload_idx, payload.size());
 		}
 
 		// move to the next aggregate
@@ -320,7 +384,7 @@ void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &re
 	Vector addresses(LogicalType::POINTER);
 	FindOrCreateGroups(groups, addresses);
 	// now fetch the aggregates
-	RowOperations::FinalizeStates(layout, addresses, result, 0);
+	RowOperations::FinalizeStates(aggregate_allocator, layout, addresses, result, 0);
 }
 
 template <class ENTRY>
@@ -336,6 +400,10 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	if (capacity - entries <= groups.size() || entries > capacity / LOAD_FACTOR) {
 		Resize<ENTRY>(capacity * 2);
 	}
+	if (ResizeInProgress()) {
+		// make bounded progress on the incremental resize with every probe batch
+		MigrateOldDirectory<ENTRY>(RESIZE_MIGRATION_CHUNK);
+	}
 
 	D_ASSERT(capacity - entries >= groups.size());
 	D_ASSERT(groups.ColumnCount() + 1 == layout.ColumnCount());
@@ -371,6 +439,14 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 
 	idx_t remaining_entries = groups.size();
 
+	// during an incremental resize a group may still live in the old directory: when probing hits an empty slot in
+	// the new directory we first consult the old directory before the group may be created as a new one
+	enum : uint8_t { PROBE_NEW = 0, PROBE_OLD = 1, PROBE_CREATE = 2 };
+	uint8_t probe_states[STANDARD_VECTOR_SIZE];
+	if (ResizeInProgress()) {
+		memset(probe_states, PROBE_NEW, groups.size());
+	}
+
 	// make a chunk that references the groups and the hashes
 	DataChunk group_chunk;
 	group_chunk.InitializeEmpty(layout.GetTypes());
@@ -392,8 +468,34 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 		// first figure out for each remaining whether or not it belongs to a full or empty group
 		for (idx_t i = 0; i < remaining_entries; i++) {
 			const idx_t index = sel_vector->get_index(i);
+			if (ResizeInProgress() && probe_states[index] == PROBE_OLD) {
+				// this group was not found in the new directory: look for it in the old directory
+				const auto old_entry_ptr = ((ENTRY *)this->old_hashes_hdl_ptr) + ht_offsets_ptr[index];
+				if (old_entry_ptr->page_nr == 0) {
+					// not in the old directory either: this is a new group
+					// re-probe the new directory from the start, now allowed to create the entry
+					probe_states[index] = PROBE_CREATE;
+					ht_offsets_ptr[index] = ((group_hashes_ptr[index] & bitmask) + bitmask) & bitmask;
+					no_match_vector.set_index(no_match_count++, index);
+				} else if (old_entry_ptr->salt == hash_salts_ptr[index]) {
+					group_compare_vector.set_index(need_compare_count++, index);
+					auto page_ptr = payload_hds_ptrs[old_entry_ptr->page_nr - 1];
+					auto page_offset = old_entry_ptr->page_offset * tuple_size;
+					addresses_ptr[index] = page_ptr + page_offset;
+				} else {
+					no_match_vector.set_index(no_match_count++, index);
+				}
+				continue;
+			}
 			const auto ht_entry_ptr = ((ENTRY *)this->hashes_hdl_ptr) + ht_offsets_ptr[index];
 			if (ht_entry_ptr->page_nr == 0) { // we use page number 0 as a "unused marker"
+				if (ResizeInProgress() && probe_states[index] == PROBE_NEW) {
+					// the group may still live in the old directory: probe that first before creating it
+					probe_states[index] = PROBE_OLD;
+					ht_offsets_ptr[index] = ((group_hashes_ptr[index] & old_bitmask) + old_bitmask) & old_bitmask;
+					no_match_vector.set_index(no_match_count++, index);
+					continue;
+				}
 				// cell is empty; setup the new entry
 				if (payload_page_offset == tuples_per_block || payload_hds.empty()) {
 					NewBlock();
@@ -437,20 +539,22 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 		}
 
 		// for each of the locations that are empty, serialize the group columns to the locations
-		RowOperations::Scatter(group_chunk, group_data.get(), layout, addresses, *string_heap, empty_vector,
-		                       new_entry_count);
+		scatter_function(group_chunk, group_data.get(), layout, addresses, *string_heap, empty_vector,
+		                 new_entry_count);
 		RowOperations::InitializeStates(layout, addresses, empty_vector, new_entry_count);
 
 		// now we have only the tuples remaining that might match to an existing group
 		// start performing comparisons with each of the groups
-		RowOperations::Match(group_chunk, group_data.get(), layout, addresses, predicates, group_compare_vector,
-		                     need_compare_count, &no_match_vector, no_match_count);
+		match_function(group_chunk, group_data.get(), layout, addresses, predicates, group_compare_vector,
+		               need_compare_count, &no_match_vector, no_match_count);
 
 		// each of the entries that do not match we move them to the next entry in the HT
 		for (idx_t i = 0; i < no_match_count; i++) {
 			idx_t index = no_match_vector.get_index(i);
+			auto probe_capacity =
+			    ResizeInProgress() && probe_states[index] == PROBE_OLD ? old_capacity : capacity;
 			ht_offsets_ptr[index]++;
-			if (ht_offsets_ptr[index] >= capacity) {
+			if (ht_offsets_ptr[index] >= probe_capacity) {
 				ht_offsets_ptr[index] = 0;
 			}
 		}
@@ -517,7 +621,7 @@ void GroupedAggregateHashTable::FlushMove(FlushMoveState &state, Vector &source_
 
 	FindOrCreateGroups(state.groups, source_hashes, state.group_addresses, state.new_groups_sel);
 
-	RowOperations::CombineStates(layout, source_addresses, state.group_addresses, count);
+	RowOperations::CombineStates(aggregate_allocator, layout, source_addresses, state.group_addresses, count);
 }
 
 void GroupedAggregateHashTable::Combine(GroupedAggregateHashTable &other) {
@@ -557,6 +661,73 @@ void GroupedAggregateHashTable::Combine(GroupedAggregateHashTable &other) {
 	Verify();
 }
 
+void GroupedAggregateHashTable::FlushRollup(FlushMoveState &state, GroupedAggregateHashTable &other,
+                                            const vector<column_t> &column_ids, Vector &source_addresses,
+                                            Vector &hashes, idx_t count) {
+	if (count == 0) {
+		return;
+	}
+
+	state.groups.Reset();
+	state.groups.SetCardinality(count);
+	for (idx_t col_no = 0; col_no < state.groups.ColumnCount(); col_no++) {
+		auto &column = state.groups.data[col_no];
+		if (column_ids[col_no] == DConstants::INVALID_INDEX) {
+			// the constant group used for aggregation without groups
+			column.Reference(Value::TINYINT(42));
+			continue;
+		}
+		RowOperations::Gather(source_addresses, *FlatVector::IncrementalSelectionVector(), column,
+		                      *FlatVector::IncrementalSelectionVector(), count, other.layout, column_ids[col_no]);
+	}
+
+	// the hashes have to be recomputed because we group on a subset of the other HT's group columns
+	state.groups.Hash(hashes);
+	FindOrCreateGroups(state.groups, hashes, state.group_addresses, state.new_groups_sel);
+
+	// combine the states of the other HT into ours; we cannot use RowOperations::CombineStates here because the
+	// source and target layouts have different group widths, and therefore different aggregate offsets
+	VectorOperations::AddInPlace(source_addresses, other.layout.GetAggrOffset(), count);
+	VectorOperations::AddInPlace(state.group_addresses, layout.GetAggrOffset(), count);
+	for (auto &aggr : layout.GetAggregates()) {
+		D_ASSERT(aggr.function.combine);
+		AggregateInputData aggr_input_data(aggr.bind_data, aggregate_allocator);
+		aggr.function.combine(source_addresses, state.group_addresses, aggr_input_data, count);
+		VectorOperations::AddInPlace(source_addresses, aggr.payload_size, count);
+		VectorOperations::AddInPlace(state.group_addresses, aggr.payload_size, count);
+	}
+}
+
+void GroupedAggregateHashTable::CombineRollup(GroupedAggregateHashTable &other, const vector<column_t> &column_ids) {
+	D_ASSERT(!is_finalized);
+	D_ASSERT(other.layout.GetAggrWidth() == layout.GetAggrWidth());
+	D_ASSERT(column_ids.size() == layout.ColumnCount() - 1);
+
+	if (other.entries == 0) {
+		return;
+	}
+
+	Vector addresses(LogicalType::POINTER);
+	auto addresses_ptr = FlatVector::GetData<data_ptr_t>(addresses);
+	Vector hashes(LogicalType::HASH);
+
+	idx_t group_idx = 0;
+
+	FlushMoveState state(allocator, layout);
+	other.PayloadApply([&](idx_t page_nr, idx_t page_offset, data_ptr_t ptr) {
+		addresses_ptr[group_idx] = ptr;
+		group_idx++;
+		if (group_idx == STANDARD_VECTOR_SIZE) {
+			FlushRollup(state, other, column_ids, addresses, hashes, group_idx);
+			group_idx = 0;
+		}
+	});
+	FlushRollup(state, other, column_ids, addresses, hashes, group_idx);
+	// note: the group strings were deep-copied into our string heap by FindOrCreateGroups, so unlike Combine we do
+	// not merge the other HT's string heap, and the other HT remains scannable
+	Verify();
+}
+
 struct PartitionInfo {
 	PartitionInfo() : addresses(LogicalType::POINTER), hashes(LogicalType::HASH), group_count(0) {
 		addresses_ptr = FlatVector::GetData<data_ptr_t>(addresses);
@@ -644,7 +815,7 @@ idx_t GroupedAggregateHashTable::Scan(AggregateHTScanState &scan_state, DataChun
 		                      *FlatVector::IncrementalSelectionVector(), result.size(), layout, col_no);
 	}
 
-	RowOperations::FinalizeStates(layout, addresses, result, group_cols);
+	RowOperations::FinalizeStates(aggregate_allocator, layout, addresses, result, group_cols);
 	return this_n;
 }
 
@@ -655,6 +826,14 @@ void GroupedAggregateHashTable::Finalize() {
 
 	// early release hashes, not needed for partition/scan
 	hashes_hdl.Destroy();
+	if (ResizeInProgress()) {
+		old_hashes_hdl.Destroy();
+		old_hashes_hdl_ptr = nullptr;
+		old_capacity = 0;
+		old_bitmask = 0;
+		migrate_position = 0;
+		migrate_end = 0;
+	}
 	is_finalized = true;
 }
 
@@ -7,7 +7,7 @@ namespace duckdb {
 BaseAggregateHashTable::BaseAggregateHashTable(ClientContext &context, Allocator &allocator,
                                                const vector<AggregateObject> &aggregates,
                                                vector<LogicalType> payload_types_p)
-    : allocator(allocator), buffer_manager(BufferManager::GetBufferManager(context)),
+    : allocator(allocator), buffer_manager(BufferManager::GetBufferManager(context)), aggregate_allocator(allocator),
       payload_types(std::move(payload_types_p)) {
 	filter_set.Initialize(context, aggregates, payload_types);
 }
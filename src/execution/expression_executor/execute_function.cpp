@@ -1,4 +1,5 @@
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/fused_kernels.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
@@ -13,8 +14,18 @@ ExecuteFunctionState::~ExecuteFunctionState() {
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunctionExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_unique<ExecuteFunctionState>(expr, root);
-	for (auto &child : expr.children) {
-		result->AddChild(child.get());
+	vector<Expression *> fused_leaves;
+	result->fused_kernel = FusedKernels::TryFuse(expr, fused_leaves);
+	if (result->fused_kernel) {
+		// the expression tree is executed as a single fused kernel:
+		// the children of this state are the leaves of the fused tree
+		for (auto &leaf : fused_leaves) {
+			result->AddChild(leaf);
+		}
+	} else {
+		for (auto &child : expr.children) {
+			result->AddChild(child.get());
+		}
 	}
 	result->Finalize();
 	if (expr.function.init_local_state) {
@@ -56,8 +67,66 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 #endif
 }
 
+//! Execute a function that cannot error over the unique values of a dictionary input only,
+//! re-wrapping the result with the original selection vector
+static bool TryDictionaryExecute(const BoundFunctionExpression &expr, ExpressionState &state, DataChunk &arguments,
+                                 Vector &result) {
+	if (expr.function.errors != FunctionErrors::CANNOT_ERROR ||
+	    expr.function.side_effects != FunctionSideEffects::NO_SIDE_EFFECTS ||
+	    expr.function.null_handling != FunctionNullHandling::DEFAULT_NULL_HANDLING) {
+		return false;
+	}
+	if (arguments.ColumnCount() != 1) {
+		return false;
+	}
+	auto &input = arguments.data[0];
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	idx_t count = arguments.size();
+	auto &sel = DictionaryVector::SelVector(input);
+	auto &child = DictionaryVector::Child(input);
+	// find the referenced prefix of the dictionary
+	idx_t dict_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		dict_size = MaxValue<idx_t>(dict_size, sel.get_index(i) + 1);
+	}
+	// only worthwhile if the dictionary is smaller than the input itself
+	if (dict_size >= count || dict_size > STANDARD_VECTOR_SIZE) {
+		return false;
+	}
+	// execute the function over the unique dictionary values
+	DataChunk dict_chunk;
+	dict_chunk.InitializeEmpty({child.GetType()});
+	dict_chunk.data[0].Reference(child);
+	dict_chunk.SetCardinality(dict_size);
+
+	Vector dict_result(result.GetType());
+	expr.function.function(dict_chunk, state, dict_result);
+	// re-wrap the result with the original selection vector
+	result.Slice(dict_result, sel, count);
+	return true;
+}
+
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
+	auto fused_kernel = ((ExecuteFunctionState &)*state).fused_kernel;
+	if (fused_kernel) {
+		// fused execution: evaluate the leaves of the fused tree and run the single fused loop
+		state->intermediate_chunk.Reset();
+		auto &inputs = state->intermediate_chunk;
+		for (idx_t i = 0; i < state->child_states.size(); i++) {
+			auto &child_state = *state->child_states[i];
+			Execute(child_state.expr, &child_state, sel, count, inputs.data[i]);
+		}
+		inputs.SetCardinality(count);
+
+		state->profiler.BeginSample();
+		fused_kernel(inputs, result);
+		state->profiler.EndSample(count);
+		D_ASSERT(result.GetType() == expr.return_type);
+		return;
+	}
 	state->intermediate_chunk.Reset();
 	auto &arguments = state->intermediate_chunk;
 	if (!state->types.empty()) {
@@ -76,7 +145,9 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 
 	state->profiler.BeginSample();
 	D_ASSERT(expr.function.function);
-	expr.function.function(arguments, *state, result);
+	if (!TryDictionaryExecute(expr, *state, arguments, result)) {
+		expr.function.function(arguments, *state, result);
+	}
 	state->profiler.EndSample(count);
 
 	VerifyNullHandling(expr, arguments, result);
@@ -1,17 +1,226 @@
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 
 namespace duckdb {
 
+//! A sorted, deduplicated set of constants, used to evaluate an IN clause over constants with a binary search per
+//! row instead of a comparison per constant
+struct InConstantSet {
+	InConstantSet(const LogicalType &type, idx_t capacity) : constants(type, capacity) {
+	}
+
+	//! The sorted constants of the IN list
+	Vector constants;
+	//! The amount of (non-NULL, distinct) constants
+	idx_t count = 0;
+	//! Whether the IN list contains a NULL constant
+	bool has_null = false;
+};
+
+struct BoundOperatorState : public ExpressionState {
+	BoundOperatorState(const Expression &expr, ExpressionExecutorState &root) : ExpressionState(expr, root) {
+	}
+
+	//! The constant set for (NOT) IN over a list of constants, if applicable
+	unique_ptr<InConstantSet> constant_set;
+};
+
+template <class T>
+static idx_t SortInConstantSet(Vector &constants, idx_t count) {
+	auto data = FlatVector::GetData<T>(constants);
+	std::sort(data, data + count, [](const T &a, const T &b) { return LessThan::Operation(a, b); });
+	// remove any duplicates
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (result_count == 0 || NotEquals::Operation(data[result_count - 1], data[i])) {
+			data[result_count++] = data[i];
+		}
+	}
+	return result_count;
+}
+
+static unique_ptr<InConstantSet> TryBuildInConstantSet(const BoundOperatorExpression &expr) {
+	D_ASSERT(expr.type == ExpressionType::COMPARE_IN || expr.type == ExpressionType::COMPARE_NOT_IN);
+	auto &in_type = expr.children[0]->return_type;
+	switch (in_type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::INTERVAL:
+	case PhysicalType::VARCHAR:
+		break;
+	default:
+		// unsupported type: fall back to the generic comparison loop
+		return nullptr;
+	}
+	for (idx_t i = 1; i < expr.children.size(); i++) {
+		if (expr.children[i]->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT ||
+		    expr.children[i]->return_type != in_type) {
+			return nullptr;
+		}
+	}
+	auto set = make_unique<InConstantSet>(in_type, expr.children.size() - 1);
+	for (idx_t i = 1; i < expr.children.size(); i++) {
+		auto &value = ((BoundConstantExpression &)*expr.children[i]).value;
+		if (value.IsNull()) {
+			set->has_null = true;
+		} else {
+			set->constants.SetValue(set->count++, value);
+		}
+	}
+	switch (in_type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		set->count = SortInConstantSet<int8_t>(set->constants, set->count);
+		break;
+	case PhysicalType::INT16:
+		set->count = SortInConstantSet<int16_t>(set->constants, set->count);
+		break;
+	case PhysicalType::INT32:
+		set->count = SortInConstantSet<int32_t>(set->constants, set->count);
+		break;
+	case PhysicalType::INT64:
+		set->count = SortInConstantSet<int64_t>(set->constants, set->count);
+		break;
+	case PhysicalType::INT128:
+		set->count = SortInConstantSet<hugeint_t>(set->constants, set->count);
+		break;
+	case PhysicalType::UINT8:
+		set->count = SortInConstantSet<uint8_t>(set->constants, set->count);
+		break;
+	case PhysicalType::UINT16:
+		set->count = SortInConstantSet<uint16_t>(set->constants, set->count);
+		break;
+	case PhysicalType::UINT32:
+		set->count = SortInConstantSet<uint32_t>(set->constants, set->count);
+		break;
+	case PhysicalType::UINT64:
+		set->count = SortInConstantSet<uint64_t>(set->constants, set->count);
+		break;
+	case PhysicalType::FLOAT:
+		set->count = SortInConstantSet<float>(set->constants, set->count);
+		break;
+	case PhysicalType::DOUBLE:
+		set->count = SortInConstantSet<double>(set->constants, set->count);
+		break;
+	case PhysicalType::INTERVAL:
+		set->count = SortInConstantSet<interval_t>(set->constants, set->count);
+		break;
+	case PhysicalType::VARCHAR:
+		set->count = SortInConstantSet<string_t>(set->constants, set->count);
+		break;
+	default:
+		throw InternalException("Unsupported type for in constant set");
+	}
+	return set;
+}
+
+template <class T>
+static void TemplatedInConstantSet(Vector &left, idx_t count, InConstantSet &set, bool invert, Vector &result) {
+	UnifiedVectorFormat ldata;
+	left.ToUnifiedFormat(count, ldata);
+	auto left_values = (const T *)ldata.data;
+	auto constants = FlatVector::GetData<T>(set.constants);
+	auto constants_end = constants + set.count;
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<bool>(result);
+	auto &result_mask = FlatVector::Validity(result);
+	result_mask.SetAllValid(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = ldata.sel->get_index(i);
+		if (!ldata.validity.RowIsValid(idx)) {
+			result_mask.SetInvalid(i);
+			continue;
+		}
+		auto &value = left_values[idx];
+		auto entry = std::lower_bound(constants, constants_end, value,
+		                              [](const T &a, const T &b) { return LessThan::Operation(a, b); });
+		if (entry != constants_end && Equals::Operation(*entry, value)) {
+			result_data[i] = !invert;
+		} else if (set.has_null) {
+			// no match, but the IN list contains a NULL: the result is NULL instead of false
+			result_mask.SetInvalid(i);
+		} else {
+			result_data[i] = invert;
+		}
+	}
+}
+
+static void ExecuteInConstantSet(Vector &left, idx_t count, InConstantSet &set, bool invert, Vector &result) {
+	switch (left.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		TemplatedInConstantSet<int8_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::INT16:
+		TemplatedInConstantSet<int16_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::INT32:
+		TemplatedInConstantSet<int32_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::INT64:
+		TemplatedInConstantSet<int64_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::INT128:
+		TemplatedInConstantSet<hugeint_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedInConstantSet<uint8_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedInConstantSet<uint16_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedInConstantSet<uint32_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedInConstantSet<uint64_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedInConstantSet<float>(left, count, set, invert, result);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedInConstantSet<double>(left, count, set, invert, result);
+		break;
+	case PhysicalType::INTERVAL:
+		TemplatedInConstantSet<interval_t>(left, count, set, invert, result);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedInConstantSet<string_t>(left, count, set, invert, result);
+		break;
+	default:
+		throw InternalException("Unsupported type for in constant set");
+	}
+}
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundOperatorExpression &expr,
                                                                 ExpressionExecutorState &root) {
-	auto result = make_unique<ExpressionState>(expr, root);
+	auto result = make_unique<BoundOperatorState>(expr, root);
 	for (auto &child : expr.children) {
 		result->AddChild(child.get());
 	}
 	result->Finalize();
-	return result;
+	if ((expr.type == ExpressionType::COMPARE_IN || expr.type == ExpressionType::COMPARE_NOT_IN) &&
+	    expr.children.size() > 2) {
+		// IN over a list of constants: try to build a sorted constant set so every row is resolved with a single
+		// binary search instead of a comparison against every constant
+		result->constant_set = TryBuildInConstantSet(expr);
+	}
+	return std::move(result);
 }
 
 void ExpressionExecutor::Execute(const BoundOperatorExpression &expr, ExpressionState *state,
@@ -27,6 +236,14 @@ void ExpressionExecutor::Execute(const BoundOperatorExpression &expr, Expression
 		// eval left side
 		Execute(*expr.children[0], state->child_states[0].get(), sel, count, left);
 
+		auto &operator_state = (BoundOperatorState &)*state;
+		if (operator_state.constant_set) {
+			// the IN list was compiled into a sorted constant set: use a binary search per row
+			ExecuteInConstantSet(left, count, *operator_state.constant_set,
+			                     expr.type == ExpressionType::COMPARE_NOT_IN, result);
+			return;
+		}
+
 		// init result to false
 		Vector intermediate(LogicalType::BOOLEAN);
 		Value false_val = Value::BOOLEAN(false);
@@ -0,0 +1,179 @@
+#include "duckdb/execution/fused_kernels.hpp"
+
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/vector_operations/ternary_executor.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Fused Arithmetic Kernels
+//===--------------------------------------------------------------------===//
+// A fused kernel computes OUTER_OP(INNER_OP(a, b), c) (INNER_IS_LEFT) or OUTER_OP(a, INNER_OP(b, c))
+// in a single pass over the three input vectors, without materializing the inner result
+template <class T, class INNER_OP, class OUTER_OP, bool INNER_IS_LEFT>
+static void FusedArithmeticKernel(DataChunk &input, Vector &result) {
+	D_ASSERT(input.ColumnCount() == 3);
+	TernaryExecutor::Execute<T, T, T, T>(input.data[0], input.data[1], input.data[2], result, input.size(),
+	                                     [](T a, T b, T c) {
+		                                     if (INNER_IS_LEFT) {
+			                                     return OUTER_OP::template Operation<T, T, T>(
+			                                         INNER_OP::template Operation<T, T, T>(a, b), c);
+		                                     } else {
+			                                     return OUTER_OP::template Operation<T, T, T>(
+			                                         a, INNER_OP::template Operation<T, T, T>(b, c));
+		                                     }
+	                                     });
+}
+
+template <class T, class INNER_OP, class OUTER_OP>
+static fused_expression_kernel_t GetFusedKernelNesting(bool inner_is_left) {
+	if (inner_is_left) {
+		return FusedArithmeticKernel<T, INNER_OP, OUTER_OP, true>;
+	} else {
+		return FusedArithmeticKernel<T, INNER_OP, OUTER_OP, false>;
+	}
+}
+
+template <class T, class ADD, class SUB, class MUL, class INNER_OP>
+static fused_expression_kernel_t FusedKernelOuterSwitch(const string &outer_op, bool inner_is_left) {
+	if (outer_op == "+") {
+		return GetFusedKernelNesting<T, INNER_OP, ADD>(inner_is_left);
+	} else if (outer_op == "-") {
+		return GetFusedKernelNesting<T, INNER_OP, SUB>(inner_is_left);
+	} else if (outer_op == "*") {
+		return GetFusedKernelNesting<T, INNER_OP, MUL>(inner_is_left);
+	}
+	return nullptr;
+}
+
+template <class T, class ADD, class SUB, class MUL>
+static fused_expression_kernel_t FusedKernelInnerSwitch(const string &inner_op, const string &outer_op,
+                                                        bool inner_is_left) {
+	if (inner_op == "+") {
+		return FusedKernelOuterSwitch<T, ADD, SUB, MUL, ADD>(outer_op, inner_is_left);
+	} else if (inner_op == "-") {
+		return FusedKernelOuterSwitch<T, ADD, SUB, MUL, SUB>(outer_op, inner_is_left);
+	} else if (inner_op == "*") {
+		return FusedKernelOuterSwitch<T, ADD, SUB, MUL, MUL>(outer_op, inner_is_left);
+	}
+	return nullptr;
+}
+
+template <class T>
+static fused_expression_kernel_t FusedIntegerKernel(const string &inner_op, const string &outer_op,
+                                                    bool inner_is_left) {
+	// integer arithmetic is bound with overflow checking (see GetScalarIntegerFunction)
+	return FusedKernelInnerSwitch<T, AddOperatorOverflowCheck, SubtractOperatorOverflowCheck,
+	                              MultiplyOperatorOverflowCheck>(inner_op, outer_op, inner_is_left);
+}
+
+template <class T>
+static fused_expression_kernel_t FusedFloatingPointKernel(const string &inner_op, const string &outer_op,
+                                                          bool inner_is_left) {
+	return FusedKernelInnerSwitch<T, AddOperator, SubtractOperator, MultiplyOperator>(inner_op, outer_op,
+	                                                                                  inner_is_left);
+}
+
+static fused_expression_kernel_t FusedKernelTypeSwitch(const LogicalType &type, const string &inner_op,
+                                                       const string &outer_op, bool inner_is_left) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+		return FusedIntegerKernel<int8_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::INT16:
+		return FusedIntegerKernel<int16_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::INT32:
+		return FusedIntegerKernel<int32_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::INT64:
+		return FusedIntegerKernel<int64_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::UINT8:
+		return FusedIntegerKernel<uint8_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::UINT16:
+		return FusedIntegerKernel<uint16_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::UINT32:
+		return FusedIntegerKernel<uint32_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::UINT64:
+		return FusedIntegerKernel<uint64_t>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::FLOAT:
+		return FusedFloatingPointKernel<float>(inner_op, outer_op, inner_is_left);
+	case PhysicalType::DOUBLE:
+		return FusedFloatingPointKernel<double>(inner_op, outer_op, inner_is_left);
+	default:
+		return nullptr;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Pattern Recognition
+//===--------------------------------------------------------------------===//
+static bool IsFusableArithmetic(const BoundFunctionExpression &expr) {
+	if (expr.children.size() != 2 || !expr.is_operator) {
+		return false;
+	}
+	if (expr.function.name != "+" && expr.function.name != "-" && expr.function.name != "*") {
+		return false;
+	}
+	// fused kernels only cover the plain numeric kernels: anything that carries bind data
+	// (e.g. decimal arithmetic) or local state keeps its regular function
+	if (expr.bind_info || expr.function.init_local_state) {
+		return false;
+	}
+	if (expr.function.null_handling != FunctionNullHandling::DEFAULT_NULL_HANDLING) {
+		return false;
+	}
+	switch (expr.return_type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		break;
+	default:
+		return false;
+	}
+	// both arguments and the result must have the same type
+	return expr.children[0]->return_type == expr.return_type && expr.children[1]->return_type == expr.return_type;
+}
+
+fused_expression_kernel_t FusedKernels::TryFuse(const BoundFunctionExpression &expr, vector<Expression *> &leaves) {
+	D_ASSERT(leaves.empty());
+	if (!IsFusableArithmetic(expr)) {
+		return nullptr;
+	}
+	for (idx_t inner_idx = 0; inner_idx < 2; inner_idx++) {
+		auto &child = *expr.children[inner_idx];
+		if (child.expression_class != ExpressionClass::BOUND_FUNCTION) {
+			continue;
+		}
+		auto &inner = (BoundFunctionExpression &)child;
+		if (!IsFusableArithmetic(inner)) {
+			continue;
+		}
+		bool inner_is_left = inner_idx == 0;
+		auto kernel = FusedKernelTypeSwitch(expr.return_type, inner.function.name, expr.function.name, inner_is_left);
+		if (!kernel) {
+			return nullptr;
+		}
+		// the leaves are the kernel inputs, in the order the kernel consumes them
+		if (inner_is_left) {
+			leaves.push_back(inner.children[0].get());
+			leaves.push_back(inner.children[1].get());
+			leaves.push_back(expr.children[1].get());
+		} else {
+			leaves.push_back(expr.children[0].get());
+			leaves.push_back(inner.children[0].get());
+			leaves.push_back(inner.children[1].get());
+		}
+		return kernel;
+	}
+	return nullptr;
+}
+
+} // namespace duckdb
@@ -315,6 +315,11 @@ void ART::ConstructFromSorted(idx_t count, vector<Key> &keys, Vector &row_identi
 	row_identifiers.Flatten(count);
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 
+	// account for the estimated memory of the constructed subtree, like the incremental insert path does
+	idx_t extra_memory = estimated_key_size * count;
+	BufferManager::GetBufferManager(db).ReserveMemory(extra_memory);
+	estimated_art_size += extra_memory;
+
 	auto key_section = KeySection(0, count - 1, 0, 0);
 	auto has_constraint = IsUnique();
 	Construct(keys, row_ids, this->tree, key_section, has_constraint);
@@ -504,12 +509,27 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
 	row_ids.Flatten(input.size());
 	auto row_identifiers = FlatVector::GetData<row_t>(row_ids);
 
+	// sort the keys so that all erasures within a shared subtree are applied in a single descent
+	vector<idx_t> key_order;
+	key_order.reserve(input.size());
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (!keys[i].Empty()) {
+			key_order.push_back(i);
+		}
+	}
+	if (key_order.empty()) {
+		return;
+	}
+	std::sort(key_order.begin(), key_order.end(),
+	          [&keys](const idx_t &a, const idx_t &b) { return keys[a] < keys[b]; });
+
+	EraseGrouped(tree, keys, key_order.data(), row_identifiers, 0, key_order.size() - 1, 0);
+
+#ifdef DEBUG
 	for (idx_t i = 0; i < input.size(); i++) {
 		if (keys[i].Empty()) {
 			continue;
 		}
-		Erase(tree, keys[i], 0, row_identifiers[i]);
-#ifdef DEBUG
 		auto node = Lookup(tree, keys[i], 0);
 		if (node) {
 			auto leaf = static_cast<Leaf *>(node);
@@ -517,7 +537,83 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
 				D_ASSERT(leaf->GetRowId(k) != row_identifiers[i]);
 			}
 		}
+	}
 #endif
+}
+
+void ART::EraseGrouped(Node *&node, vector<Key> &keys, const idx_t *sorted, const row_t *row_ids, idx_t start,
+                       idx_t end, idx_t depth) {
+	if (!node) {
+		return;
+	}
+	// all the keys of the section share the bytes up to "depth"
+	const auto entry_depth = depth;
+
+	// Delete leaves from a tree that consists of a single leaf
+	if (node->type == NodeType::NLeaf) {
+		auto leaf = static_cast<Leaf *>(node);
+		for (idx_t i = start; i <= end; i++) {
+			leaf->Remove(row_ids[sorted[i]]);
+		}
+		if (leaf->count == 0) {
+			Node::Delete(node);
+			node = nullptr;
+		}
+		return;
+	}
+
+	// Handle prefix: the keys are sorted, so the keys matching the prefix form a contiguous subrange;
+	// keys that mismatch are not present in this subtree and can be dropped from the section
+	if (node->prefix.Size()) {
+		while (start <= end && node->prefix.KeyMismatchPosition(keys[sorted[start]], depth) != node->prefix.Size()) {
+			start++;
+		}
+		if (start > end) {
+			return;
+		}
+		while (end > start && node->prefix.KeyMismatchPosition(keys[sorted[end]], depth) != node->prefix.Size()) {
+			end--;
+		}
+		depth += node->prefix.Size();
+	}
+
+	// group the section by the key byte at this depth and erase each group from the matching child
+	idx_t child_start = start;
+	while (child_start <= end) {
+		auto key_byte = keys[sorted[child_start]][depth];
+		idx_t child_end = child_start;
+		while (child_end < end && keys[sorted[child_end + 1]][depth] == key_byte) {
+			child_end++;
+		}
+		idx_t pos = node->GetChildPos(key_byte);
+		if (pos != DConstants::INVALID_INDEX) {
+			auto child = node->GetChild(*this, pos);
+			D_ASSERT(child);
+
+			if (child->type == NodeType::NLeaf) {
+				// Leaf found, remove the entries of the group
+				auto leaf = (Leaf *)child;
+				for (idx_t i = child_start; i <= child_end; i++) {
+					leaf->Remove(row_ids[sorted[i]]);
+				}
+				if (leaf->count == 0) {
+					// Leaf is empty, delete leaf, decrement node counter and maybe shrink node
+					auto old_node = node;
+					Node::EraseChild(node, pos, *this);
+					if (node != old_node && child_end < end) {
+						// the node was shrunk or collapsed into its remaining child: restart the remaining
+						// groups from the depth at which this node was entered
+						EraseGrouped(node, keys, sorted, row_ids, child_end + 1, end, entry_depth);
+						return;
+					}
+				}
+			} else {
+				// Recurse
+				EraseGrouped(child, keys, sorted, row_ids, child_start, child_end, depth + 1);
+				node->ReplaceChildPointer(pos, child);
+			}
+		}
+		child_start = child_end + 1;
 	}
 }
 
@@ -854,6 +950,29 @@ void ART::LookupValues(DataChunk &input, ConflictManager &conflict_manager) {
 	vector<Key> keys(expression_chunk.size());
 	GenerateKeys(arena_allocator, expression_chunk, keys);
 
+	// sort the keys and probe each distinct key only once: foreign key chunks typically repeat a small
+	// set of values, and the sorted probes of the distinct keys share their paths through the tree
+	vector<idx_t> key_order;
+	key_order.reserve(input.size());
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (!keys[i].Empty()) {
+			key_order.push_back(i);
+		}
+	}
+	std::sort(key_order.begin(), key_order.end(),
+	          [&keys](const idx_t &a, const idx_t &b) { return keys[a] < keys[b]; });
+
+	vector<Leaf *> leaves(input.size(), nullptr);
+	for (idx_t i = 0; i < key_order.size(); i++) {
+		if (i > 0 && keys[key_order[i]] == keys[key_order[i - 1]]) {
+			// duplicate key: reuse the result of the previous probe
+			leaves[key_order[i]] = leaves[key_order[i - 1]];
+			continue;
+		}
+		leaves[key_order[i]] = Lookup(tree, keys[key_order[i]], 0);
+	}
+
+	// report the lookup results to the conflict manager in the original row order
 	idx_t found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 		if (keys[i].Empty()) {
@@ -862,7 +981,7 @@ void ART::LookupValues(DataChunk &input, ConflictManager &conflict_manager) {
 			}
 			continue;
 		}
-		Leaf *leaf_ptr = Lookup(tree, keys[i], 0);
+		Leaf *leaf_ptr = leaves[i];
 		if (leaf_ptr == nullptr) {
 			if (conflict_manager.AddMiss(i)) {
 				found_conflict = i;
@@ -53,6 +53,7 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager, const vector<JoinCon
 	}
 	layout_types.emplace_back(LogicalType::HASH);
 	layout.Initialize(layout_types, false);
+	match_function = RowOperations::InitializeMatch(layout, predicates);
 
 	const auto &offsets = layout.GetOffsets();
 	tuple_size = offsets[condition_types.size() + build_types.size()];
@@ -112,21 +113,8 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	}
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
-		}
-	}
-}
-
-void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
+void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers,
+                                 uint64_t salts[]) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
@@ -138,6 +126,7 @@ void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
 		result_data[rindex] = main_ht + (hash & bitmask);
+		salts[rindex] = hash & SALT_MASK;
 	}
 }
 
@@ -285,22 +274,27 @@ void JoinHashTable::Build(DataChunk &keys, DataChunk &payload) {
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
-                                    const data_ptr_t key_locations[], const idx_t pointer_offset) {
+static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t hashes[], const idx_t count,
+                                    const data_ptr_t key_locations[], const idx_t pointer_offset,
+                                    const uint64_t bitmask) {
 	for (idx_t i = 0; i < count; i++) {
-		auto index = indices[i];
+		const auto index = hashes[i] & bitmask;
+		// tag the pointer with the salt bits of the tuple it points to, so that probes can reject non-matching
+		// tuples without comparing their keys. The previous head keeps its own tag when it moves into the chain.
+		D_ASSERT(!(uint64_t(key_locations[i]) & JoinHashTable::SALT_MASK));
+		const auto tagged = (data_ptr_t)(uint64_t(key_locations[i]) | (hashes[i] & JoinHashTable::SALT_MASK));
 		if (PARALLEL) {
 			data_ptr_t head;
 			do {
 				head = pointers[index];
 				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
+			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, tagged));
 		} else {
 			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
 			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
 
 			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+			pointers[index] = tagged;
 		}
 	}
 }
@@ -308,19 +302,16 @@ static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
 
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
 	auto pointers = (atomic<data_ptr_t> *)hash_map.get();
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(pointers, hash_data, count, key_locations, pointer_offset, bitmask);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(pointers, hash_data, count, key_locations, pointer_offset, bitmask);
 	}
 }
 
@@ -420,14 +411,14 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, Vector *precompu
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers, ss->salts);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
 		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers, ss->salts);
 	}
 
 	// create the selection vector linking to only non-empty entries
@@ -478,8 +469,8 @@ idx_t ScanStructure::ResolvePredicates(DataChunk &keys, SelectionVector &match_s
 	}
 	idx_t no_match_count = 0;
 
-	return RowOperations::Match(keys, key_data.get(), ht.layout, pointers, ht.predicates, match_sel, this->count,
-	                            no_match_sel, no_match_count);
+	return ht.match_function(keys, key_data.get(), ht.layout, pointers, ht.predicates, match_sel, this->count,
+	                         no_match_sel, no_match_count);
 }
 
 idx_t ScanStructure::ScanInnerJoin(DataChunk &keys, SelectionVector &result_vector) {
@@ -511,8 +502,13 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 	auto ptrs = FlatVector::GetData<data_ptr_t>(this->pointers);
 	for (idx_t i = 0; i < sel_count; i++) {
 		auto idx = sel.get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
-		if (ptrs[idx]) {
+		auto ptr = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
+		// chase the chain past any tuples whose salt does not match: they cannot compare equal to this key
+		while (ptr && (uint64_t(ptr) & JoinHashTable::SALT_MASK) != salts[idx]) {
+			ptr = Load<data_ptr_t>((data_ptr_t)(uint64_t(ptr) & JoinHashTable::POINTER_MASK) + ht.pointer_offset);
+		}
+		if (ptr) {
+			ptrs[idx] = (data_ptr_t)(uint64_t(ptr) & JoinHashTable::POINTER_MASK);
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
@@ -525,8 +521,13 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 	auto cnt = count;
 	for (idx_t i = 0; i < cnt; i++) {
 		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
-		if (ptrs[idx]) {
+		auto ptr = Load<data_ptr_t>(ptrs[idx]);
+		// chase the chain past any tuples whose salt does not match: they cannot compare equal to this key
+		while (ptr && (uint64_t(ptr) & JoinHashTable::SALT_MASK) != salts[idx]) {
+			ptr = Load<data_ptr_t>((data_ptr_t)(uint64_t(ptr) & JoinHashTable::POINTER_MASK) + ht.pointer_offset);
+		}
+		if (ptr) {
+			ptrs[idx] = (data_ptr_t)(uint64_t(ptr) & JoinHashTable::POINTER_MASK);
 			sel_vector.set_index(non_empty_count++, idx);
 		}
 	}
@@ -547,6 +548,18 @@ void ScanStructure::GatherResult(Vector &result, const SelectionVector &sel_vect
 	GatherResult(result, *FlatVector::IncrementalSelectionVector(), sel_vector, count, col_idx);
 }
 
+void ScanStructure::GatherResult(DataChunk &result, const idx_t base_column_id,
+                                 const SelectionVector &result_vector, const SelectionVector &sel_vector,
+                                 const idx_t count) {
+#ifdef DEBUG
+	for (idx_t i = 0; i < ht.build_types.size(); i++) {
+		D_ASSERT(result.data[base_column_id + i].GetType() == ht.build_types[i]);
+	}
+#endif
+	RowOperations::Gather(pointers, sel_vector, result, base_column_id, result_vector, count, ht.layout,
+	                      ht.condition_types.size(), ht.build_types.size());
+}
+
 void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &result) {
 	D_ASSERT(result.ColumnCount() == left.ColumnCount() + ht.build_types.size());
 	if (this->count == 0) {
@@ -574,11 +587,8 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 		result.Slice(left, result_vector, result_count);
 
 		// on the RHS, we need to fetch the data from the hash table
-		for (idx_t i = 0; i < ht.build_types.size(); i++) {
-			auto &vector = result.data[left.ColumnCount() + i];
-			D_ASSERT(vector.GetType() == ht.build_types[i]);
-			GatherResult(vector, result_vector, result_count, i + ht.condition_types.size());
-		}
+		GatherResult(result, left.ColumnCount(), *FlatVector::IncrementalSelectionVector(), result_vector,
+		             result_count);
 		AdvancePointers();
 	}
 }
@@ -819,18 +829,16 @@ void ScanStructure::NextSingleJoin(DataChunk &keys, DataChunk &input, DataChunk
 	for (idx_t i = 0; i < input.ColumnCount(); i++) {
 		result.data[i].Reference(input.data[i]);
 	}
-	// now fetch the data from the RHS
+	// set NULL entries on the RHS for every entry that was not found
 	for (idx_t i = 0; i < ht.build_types.size(); i++) {
-		auto &vector = result.data[input.ColumnCount() + i];
-		// set NULL entries for every entry that was not found
-		auto &mask = FlatVector::Validity(vector);
+		auto &mask = FlatVector::Validity(result.data[input.ColumnCount() + i]);
 		mask.SetAllInvalid(input.size());
 		for (idx_t j = 0; j < result_count; j++) {
 			mask.SetValid(result_sel.get_index(j));
 		}
-		// for the remaining values we fetch the values
-		GatherResult(vector, result_sel, result_sel, result_count, i + ht.condition_types.size());
 	}
+	// for the remaining values we fetch the values from the RHS
+	GatherResult(result, input.ColumnCount(), result_sel, result_sel, result_count);
 	result.SetCardinality(input.size());
 
 	// like the SEMI, ANTI and MARK join types, the SINGLE join only ever does one pass over the HT per input chunk
@@ -878,12 +886,13 @@ void JoinHashTable::GatherFullOuter(DataChunk &result, Vector &addresses, idx_t
 		ConstantVector::SetNull(vec, true);
 	}
 	// gather the values from the RHS
+#ifdef DEBUG
 	for (idx_t i = 0; i < build_types.size(); i++) {
-		auto &vector = result.data[left_column_count + i];
-		D_ASSERT(vector.GetType() == build_types[i]);
-		const auto col_no = condition_types.size() + i;
-		RowOperations::Gather(addresses, sel_vector, vector, sel_vector, found_entries, layout, col_no);
+		D_ASSERT(result.data[left_column_count + i].GetType() == build_types[i]);
 	}
+#endif
+	RowOperations::Gather(addresses, sel_vector, result, left_column_count, sel_vector, found_entries, layout,
+	                      condition_types.size(), build_types.size());
 }
 
 idx_t JoinHashTable::FillWithHTOffsets(data_ptr_t *key_locations, JoinHTScanState &state) {
@@ -1065,9 +1074,57 @@ void JoinHashTable::Reset() {
 	finalized = false;
 }
 
+void JoinHashTable::Repartition() {
+	// Find the largest partition
+	idx_t max_partition_count = 0;
+	for (auto &p_block_collection : partition_block_collections) {
+		max_partition_count = MaxValue<idx_t>(max_partition_count, p_block_collection->count);
+	}
+
+	// Increase the number of radix bits until the largest partition is expected to fit in one probe round,
+	// assuming that every additional bit splits the partitions roughly in half (maximum 10 - the limit of
+	// RadixPartitioning)
+	idx_t new_radix_bits = radix_bits;
+	for (auto count = max_partition_count; new_radix_bits < 10 && count > tuples_per_round; count /= 2) {
+		new_radix_bits++;
+	}
+	if (new_radix_bits == radix_bits) {
+		return;
+	}
+
+	// Merge the partitions back into a single (swizzled) collection
+	D_ASSERT(SwizzledCount() == 0);
+	for (idx_t p = 0; p < partition_block_collections.size(); p++) {
+		swizzled_block_collection->Merge(*partition_block_collections[p]);
+		if (!layout.AllConstant()) {
+			swizzled_string_heap->Merge(*partition_string_heaps[p]);
+		}
+	}
+	partition_block_collections.clear();
+	partition_string_heaps.clear();
+
+	// Partition again on the increased number of radix bits. The partition index is computed from the highest bits
+	// of the hash, so this is a strict refinement: partitions are only split, tuples never move between them
+	radix_bits = new_radix_bits;
+	RadixPartitioning::PartitionRowData(buffer_manager, layout, pointer_offset, *swizzled_block_collection,
+	                                    *swizzled_string_heap, partition_block_collections, partition_string_heaps,
+	                                    radix_bits);
+}
+
 bool JoinHashTable::PrepareExternalFinalize() {
+	if (partition_block_collections.empty()) {
+		return false;
+	}
+
+	if (partition_end == 0) {
+		// This is the first probe round: if a single partition is too large to be built in one round, we split the
+		// partitions on more radix bits. This must happen before any probe data is partitioned, so that the build
+		// and probe side agree on the radix bits
+		Repartition();
+	}
+
 	idx_t num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
-	if (partition_block_collections.empty() || partition_end == num_partitions) {
+	if (partition_end == num_partitions) {
 		return false;
 	}
 
@@ -1167,7 +1224,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, DataChun
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers, ss->salts);
 
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
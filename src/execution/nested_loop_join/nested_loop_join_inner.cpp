@@ -1,4 +1,5 @@
 #include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/execution/nested_loop_join.hpp"
 
 namespace duckdb {
@@ -166,16 +167,19 @@ idx_t NestedLoopJoinComparisonSwitch(Vector &left, Vector &right, idx_t left_siz
 
 idx_t NestedLoopJoinInner::Perform(idx_t &lpos, idx_t &rpos, DataChunk &left_conditions, DataChunk &right_conditions,
                                    SelectionVector &lvector, SelectionVector &rvector,
-                                   const vector<JoinCondition> &conditions) {
+                                   const vector<JoinCondition> &conditions, AdaptiveFilter *adaptive_filter) {
 	D_ASSERT(left_conditions.ColumnCount() == right_conditions.ColumnCount());
 	if (lpos >= left_conditions.size() || rpos >= right_conditions.size()) {
 		return 0;
 	}
+	// the conditions are evaluated in the order of the adaptive permutation (if any)
+	// all conditions are applied to every emitted tuple, so the order only affects performance
+	idx_t first_idx = adaptive_filter ? adaptive_filter->permutation[0] : 0;
 	// for the first condition, lvector and rvector are not set yet
 	// we initialize them using the InitialNestedLoopJoin
 	idx_t match_count = NestedLoopJoinComparisonSwitch<InitialNestedLoopJoin>(
-	    left_conditions.data[0], right_conditions.data[0], left_conditions.size(), right_conditions.size(), lpos, rpos,
-	    lvector, rvector, 0, conditions[0].comparison);
+	    left_conditions.data[first_idx], right_conditions.data[first_idx], left_conditions.size(),
+	    right_conditions.size(), lpos, rpos, lvector, rvector, 0, conditions[first_idx].comparison);
 	// now resolve the rest of the conditions
 	for (idx_t i = 1; i < conditions.size(); i++) {
 		// check if we have run out of tuples to compare
@@ -183,12 +187,13 @@ idx_t NestedLoopJoinInner::Perform(idx_t &lpos, idx_t &rpos, DataChunk &left_con
 			return 0;
 		}
 		// if not, get the vectors to compare
-		Vector &l = left_conditions.data[i];
-		Vector &r = right_conditions.data[i];
+		idx_t condition_idx = adaptive_filter ? adaptive_filter->permutation[i] : i;
+		Vector &l = left_conditions.data[condition_idx];
+		Vector &r = right_conditions.data[condition_idx];
 		// then we refine the currently obtained results using the RefineNestedLoopJoin
 		match_count = NestedLoopJoinComparisonSwitch<RefineNestedLoopJoin>(
 		    l, r, left_conditions.size(), right_conditions.size(), lpos, rpos, lvector, rvector, match_count,
-		    conditions[i].comparison);
+		    conditions[condition_idx].comparison);
 	}
 	return match_count;
 }
@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/partitionable_hashtable.hpp"
@@ -166,6 +167,43 @@ PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<Logi
 
 	distinct_collection_info = DistinctAggregateCollectionInfo::Create(grouped_aggregate_data.aggregates);
 
+	// determine which grouping sets can be computed by rolling up the result of another grouping set instead of
+	// aggregating the input: this requires all aggregates to be combinable and non-DISTINCT, and a grouping set
+	// that is a proper superset of the derived set (always the case for ROLLUP and CUBE)
+	rollup_sources.resize(grouping_sets.size(), DConstants::INVALID_INDEX);
+	bool can_rollup = !distinct_collection_info;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = (BoundAggregateExpression &)*aggregate;
+		if (!aggr.function.combine) {
+			can_rollup = false;
+			break;
+		}
+	}
+	if (can_rollup) {
+		for (idx_t i = 0; i < grouping_sets.size(); i++) {
+			// roll up from the smallest proper superset so that rollup chains stay as cheap as possible
+			for (idx_t j = 0; j < grouping_sets.size(); j++) {
+				if (grouping_sets[j].size() <= grouping_sets[i].size()) {
+					continue;
+				}
+				if (!std::includes(grouping_sets[j].begin(), grouping_sets[j].end(), grouping_sets[i].begin(),
+				                   grouping_sets[i].end())) {
+					continue;
+				}
+				if (rollup_sources[i] == DConstants::INVALID_INDEX ||
+				    grouping_sets[j].size() < grouping_sets[rollup_sources[i]].size()) {
+					rollup_sources[i] = j;
+				}
+			}
+			if (rollup_sources[i] != DConstants::INVALID_INDEX) {
+				rollup_order.push_back(i);
+			}
+		}
+		// supersets have to be rolled up before the sets that are derived from them
+		std::sort(rollup_order.begin(), rollup_order.end(),
+		          [this](idx_t a, idx_t b) { return grouping_sets[a].size() > grouping_sets[b].size(); });
+	}
+
 	for (idx_t i = 0; i < grouping_sets.size(); i++) {
 		groupings.emplace_back(grouping_sets[i], grouped_aggregate_data, distinct_collection_info);
 	}
@@ -379,6 +417,10 @@ SinkResultType PhysicalHashAggregate::Sink(ExecutionContext &context, GlobalSink
 
 	// For every grouping set there is one radix_table
 	for (idx_t i = 0; i < groupings.size(); i++) {
+		if (IsRollupDerived(i)) {
+			// this grouping is rolled up from another grouping's result in the finalize phase
+			continue;
+		}
 		auto &grouping_gstate = gstate.grouping_states[i];
 		auto &grouping_lstate = llstate.grouping_states[i];
 
@@ -430,6 +472,9 @@ void PhysicalHashAggregate::Combine(ExecutionContext &context, GlobalSinkState &
 		return;
 	}
 	for (idx_t i = 0; i < groupings.size(); i++) {
+		if (IsRollupDerived(i)) {
+			continue;
+		}
 		auto &grouping_gstate = gstate.grouping_states[i];
 		auto &grouping_lstate = llstate.grouping_states[i];
 
@@ -439,16 +484,69 @@ void PhysicalHashAggregate::Combine(ExecutionContext &context, GlobalSinkState &
 	}
 }
 
+//! ROLLUP TASK
+
+class HashAggregateRollupTask : public ExecutorTask {
+public:
+	HashAggregateRollupTask(Pipeline &pipeline, shared_ptr<Event> event_p, HashAggregateGlobalState &state_p,
+	                        ClientContext &context, const PhysicalHashAggregate &op)
+	    : ExecutorTask(pipeline.executor), event(std::move(event_p)), gstate(state_p), context(context), op(op) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		// rollups can be chained (e.g. for ROLLUP), so they are executed in order: supersets first
+		for (auto &grouping_idx : op.rollup_order) {
+			auto source_idx = op.rollup_sources[grouping_idx];
+			auto &table = op.groupings[grouping_idx].table_data;
+			auto &source_table = op.groupings[source_idx].table_data;
+			table.Rollup(context, *gstate.grouping_states[grouping_idx].table_state, source_table,
+			             *gstate.grouping_states[source_idx].table_state);
+		}
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<Event> event;
+	HashAggregateGlobalState &gstate;
+	ClientContext &context;
+	const PhysicalHashAggregate &op;
+};
+
+//! ROLLUP EVENT
+
+class HashAggregateRollupEvent : public BasePipelineEvent {
+public:
+	HashAggregateRollupEvent(const PhysicalHashAggregate &op_p, HashAggregateGlobalState &gstate_p,
+	                         Pipeline &pipeline_p, ClientContext &context)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p), context(context) {
+	}
+
+	const PhysicalHashAggregate &op;
+	HashAggregateGlobalState &gstate;
+	ClientContext &context;
+
+public:
+	void Schedule() override {
+		vector<unique_ptr<Task>> tasks;
+		tasks.push_back(make_unique<HashAggregateRollupTask>(*pipeline, shared_from_this(), gstate, context, op));
+		D_ASSERT(!tasks.empty());
+		SetTasks(std::move(tasks));
+	}
+};
+
 //! REGULAR FINALIZE EVENT
 
 class HashAggregateMergeEvent : public BasePipelineEvent {
 public:
-	HashAggregateMergeEvent(const PhysicalHashAggregate &op_p, HashAggregateGlobalState &gstate_p, Pipeline *pipeline_p)
-	    : BasePipelineEvent(*pipeline_p), op(op_p), gstate(gstate_p) {
+	HashAggregateMergeEvent(const PhysicalHashAggregate &op_p, HashAggregateGlobalState &gstate_p, Pipeline *pipeline_p,
+	                        ClientContext &context)
+	    : BasePipelineEvent(*pipeline_p), op(op_p), gstate(gstate_p), context(context) {
 	}
 
 	const PhysicalHashAggregate &op;
 	HashAggregateGlobalState &gstate;
+	ClientContext &context;
 
 public:
 	void Schedule() override {
@@ -463,6 +561,15 @@ public:
 		D_ASSERT(!tasks.empty());
 		SetTasks(std::move(tasks));
 	}
+
+	void FinishEvent() override {
+		if (op.rollup_order.empty()) {
+			return;
+		}
+		//! Now that the grouping sets that aggregated the input are combined, the remaining sets can be rolled up
+		auto new_event = make_shared<HashAggregateRollupEvent>(op, gstate, *pipeline, context);
+		this->InsertEvent(std::move(new_event));
+	}
 };
 
 //! REGULAR FINALIZE FROM DISTINCT FINALIZE
@@ -790,6 +897,10 @@ SinkFinalizeType PhysicalHashAggregate::FinalizeInternal(Pipeline &pipeline, Eve
 
 	bool any_partitioned = false;
 	for (idx_t i = 0; i < groupings.size(); i++) {
+		if (IsRollupDerived(i)) {
+			// rolled up from another grouping's result once that result has been finalized
+			continue;
+		}
 		auto &grouping = groupings[i];
 		auto &grouping_gstate = gstate.grouping_states[i];
 
@@ -799,7 +910,10 @@ SinkFinalizeType PhysicalHashAggregate::FinalizeInternal(Pipeline &pipeline, Eve
 		}
 	}
 	if (any_partitioned) {
-		auto new_event = make_shared<HashAggregateMergeEvent>(*this, gstate, &pipeline);
+		auto new_event = make_shared<HashAggregateMergeEvent>(*this, gstate, &pipeline, context);
+		event.InsertEvent(std::move(new_event));
+	} else if (!rollup_order.empty()) {
+		auto new_event = make_shared<HashAggregateRollupEvent>(*this, gstate, pipeline, context);
 		event.InsertEvent(std::move(new_event));
 	}
 	return SinkFinalizeType::READY;
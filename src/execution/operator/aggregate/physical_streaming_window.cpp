@@ -1,10 +1,12 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
@@ -26,15 +28,30 @@ class StreamingWindowState : public OperatorState {
 public:
 	using StateBuffer = vector<data_t>;
 
-	StreamingWindowState() : initialized(false), statev(LogicalType::POINTER, (data_ptr_t)&state_ptr) {
+	//! The state of a streaming LAG with a constant offset
+	struct LagState {
+		//! The constant offset to look back (default 1)
+		idx_t offset = 1;
+		//! The value for rows that look back past the start of the stream
+		Value default_value;
+		//! The number of buffered trailing values
+		idx_t buffered = 0;
+		//! The last "offset" values of the child expression, oldest first
+		unique_ptr<Vector> buffer;
+	};
+
+	StreamingWindowState()
+	    : initialized(false), allocator(Allocator::DefaultAllocator()),
+	      statev(LogicalType::POINTER, (data_ptr_t)&state_ptr) {
 	}
 
 	~StreamingWindowState() override {
 		for (size_t i = 0; i < aggregate_dtors.size(); ++i) {
 			auto dtor = aggregate_dtors[i];
 			if (dtor) {
+				AggregateInputData aggr_input_data(aggregate_bind_data[i], allocator);
 				state_ptr = aggregate_states[i].data();
-				dtor(statev, 1);
+				dtor(statev, aggr_input_data, 1);
 			}
 		}
 	}
@@ -42,7 +59,9 @@ public:
 	void Initialize(ClientContext &context, DataChunk &input, const vector<unique_ptr<Expression>> &expressions) {
 		const_vectors.resize(expressions.size());
 		aggregate_states.resize(expressions.size());
+		aggregate_bind_data.resize(expressions.size(), nullptr);
 		aggregate_dtors.resize(expressions.size(), nullptr);
+		lag_states.resize(expressions.size());
 
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
@@ -51,6 +70,7 @@ public:
 			case ExpressionType::WINDOW_AGGREGATE: {
 				auto &aggregate = *wexpr.aggregate;
 				auto &state = aggregate_states[expr_idx];
+				aggregate_bind_data[expr_idx] = wexpr.bind_info.get();
 				aggregate_dtors[expr_idx] = aggregate.destructor;
 				state.resize(aggregate.state_size());
 				aggregate.initialize(state.data());
@@ -67,6 +87,21 @@ public:
 				const_vectors[expr_idx] = make_unique<Vector>(result.GetValue(0, 0));
 				break;
 			}
+			case ExpressionType::WINDOW_LAG: {
+				// The planner only lets constant offsets and defaults through
+				auto lag = make_unique<LagState>();
+				if (wexpr.offset_expr) {
+					lag->offset = ExpressionExecutor::EvaluateScalar(context, *wexpr.offset_expr).GetValue<int64_t>();
+				}
+				if (wexpr.default_expr) {
+					lag->default_value = ExpressionExecutor::EvaluateScalar(context, *wexpr.default_expr);
+				} else {
+					lag->default_value = Value(wexpr.return_type);
+				}
+				lag->buffer = make_unique<Vector>(wexpr.return_type);
+				lag_states[expr_idx] = std::move(lag);
+				break;
+			}
 			case ExpressionType::WINDOW_PERCENT_RANK: {
 				const_vectors[expr_idx] = make_unique<Vector>(Value((double)0));
 				break;
@@ -87,8 +122,13 @@ public:
 	bool initialized;
 	vector<unique_ptr<Vector>> const_vectors;
 
+	// Lead/lag
+	vector<unique_ptr<LagState>> lag_states;
+
 	// Aggregation
+	ArenaAllocator allocator;
 	vector<StateBuffer> aggregate_states;
+	vector<FunctionData *> aggregate_bind_data;
 	vector<aggregate_destructor_t> aggregate_dtors;
 	data_ptr_t state_ptr;
 	Vector statev;
@@ -126,7 +166,7 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			auto &aggregate = *wexpr.aggregate;
 			auto &statev = state.statev;
 			state.state_ptr = state.aggregate_states[expr_idx].data();
-			AggregateInputData aggr_input_data(wexpr.bind_info.get(), Allocator::DefaultAllocator());
+			AggregateInputData aggr_input_data(wexpr.bind_info.get(), state.allocator);
 
 			// Check for COUNT(*)
 			if (wexpr.children.empty()) {
@@ -171,6 +211,49 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			}
 			break;
 		}
+		case ExpressionType::WINDOW_LAG: {
+			auto &wexpr = (BoundWindowExpression &)expr;
+			auto &lag = *state.lag_states[expr_idx];
+
+			// Compute the argument of the LAG
+			ExpressionExecutor executor(context.client, *wexpr.children[0]);
+			Vector payload(wexpr.return_type);
+			executor.ExecuteExpression(input, payload);
+
+			const auto offset = lag.offset;
+			// Rows that look back past the start of the stream get the default value
+			const idx_t prefix = MinValue<idx_t>(count, offset > lag.buffered ? offset - lag.buffered : 0);
+			for (idx_t i = 0; i < prefix; i++) {
+				result.SetValue(i, lag.default_value);
+			}
+			// Rows that look back into the trailing buffer of the previous chunks
+			const idx_t lookback = MinValue<idx_t>(count, offset);
+			if (prefix < lookback) {
+				VectorOperations::Copy(*lag.buffer, result, lag.buffered - offset + lookback,
+				                       lag.buffered - offset + prefix, prefix);
+			}
+			// Rows that look back into this chunk
+			if (offset < count) {
+				VectorOperations::Copy(payload, result, count - offset, 0, offset);
+			}
+
+			// Update the trailing buffer with the last "offset" values of this chunk
+			if (offset != 0) {
+				auto updated = make_unique<Vector>(wexpr.return_type);
+				if (count >= offset) {
+					VectorOperations::Copy(payload, *updated, count, count - offset, 0);
+					lag.buffered = offset;
+				} else {
+					// This chunk is smaller than the offset: keep the tail of the old buffer, then append
+					const idx_t keep = MinValue<idx_t>(lag.buffered, offset - count);
+					VectorOperations::Copy(*lag.buffer, *updated, lag.buffered, lag.buffered - keep, 0);
+					VectorOperations::Copy(payload, *updated, count, 0, keep);
+					lag.buffered = keep + count;
+				}
+				lag.buffer = std::move(updated);
+			}
+			break;
+		}
 		case ExpressionType::WINDOW_FIRST_VALUE:
 		case ExpressionType::WINDOW_PERCENT_RANK:
 		case ExpressionType::WINDOW_RANK:
@@ -6,8 +6,10 @@
 #include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/execution/radix_partitioned_hashtable.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/common/unordered_set.hpp"
@@ -34,13 +36,15 @@ PhysicalUngroupedAggregate::PhysicalUngroupedAggregate(vector<LogicalType> types
 // Sink
 //===--------------------------------------------------------------------===//
 struct AggregateState {
-	explicit AggregateState(const vector<unique_ptr<Expression>> &aggregate_expressions) {
+	explicit AggregateState(const vector<unique_ptr<Expression>> &aggregate_expressions)
+	    : allocator(Allocator::DefaultAllocator()) {
 		for (auto &aggregate : aggregate_expressions) {
 			D_ASSERT(aggregate->GetExpressionClass() == ExpressionClass::BOUND_AGGREGATE);
 			auto &aggr = (BoundAggregateExpression &)*aggregate;
 			auto state = unique_ptr<data_t[]>(new data_t[aggr.function.state_size()]);
 			aggr.function.initialize(state.get());
 			aggregates.push_back(std::move(state));
+			bind_data.push_back(aggr.bind_info.get());
 			destructors.push_back(aggr.function.destructor);
 #ifdef DEBUG
 			counts.push_back(0);
@@ -56,17 +60,23 @@ struct AggregateState {
 			Vector state_vector(Value::POINTER((uintptr_t)aggregates[i].get()));
 			state_vector.SetVectorType(VectorType::FLAT_VECTOR);
 
-			destructors[i](state_vector, 1);
+			AggregateInputData aggr_input_data(bind_data[i], allocator);
+			destructors[i](state_vector, aggr_input_data, 1);
 		}
 	}
 
 	void Move(AggregateState &other) {
 		other.aggregates = std::move(aggregates);
+		other.bind_data = std::move(bind_data);
 		other.destructors = std::move(destructors);
 	}
 
+	//! Arena allocator from which the aggregate states allocate their variable-size data
+	ArenaAllocator allocator;
 	//! The aggregate values
 	vector<unique_ptr<data_t[]>> aggregates;
+	//! The bind data of the aggregates
+	vector<FunctionData *> bind_data;
 	//! The destructors
 	vector<aggregate_destructor_t> destructors;
 	//! Counts (used for verification)
@@ -266,7 +276,7 @@ SinkResultType PhysicalUngroupedAggregate::Sink(ExecutionContext &context, Globa
 		}
 
 		auto start_of_input = payload_cnt == 0 ? nullptr : &payload_chunk.data[payload_idx];
-		AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
+		AggregateInputData aggr_input_data(aggregate.bind_info.get(), sink.state.allocator);
 		aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
 		                                 sink.state.aggregates[aggr_idx].get(), payload_chunk.size());
 	}
@@ -320,7 +330,7 @@ void PhysicalUngroupedAggregate::Combine(ExecutionContext &context, GlobalSinkSt
 		Vector source_state(Value::POINTER((uintptr_t)source.state.aggregates[aggr_idx].get()));
 		Vector dest_state(Value::POINTER((uintptr_t)gstate.state.aggregates[aggr_idx].get()));
 
-		AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
+		AggregateInputData aggr_input_data(aggregate.bind_info.get(), gstate.state.allocator);
 		aggregate.function.combine(source_state, dest_state, aggr_input_data, 1);
 #ifdef DEBUG
 		gstate.state.counts[aggr_idx] += source.state.counts[aggr_idx];
@@ -336,77 +346,96 @@ class UngroupedDistinctAggregateFinalizeTask : public ExecutorTask {
 public:
 	UngroupedDistinctAggregateFinalizeTask(Executor &executor, shared_ptr<Event> event_p,
 	                                       UngroupedAggregateGlobalState &state_p, ClientContext &context,
-	                                       const PhysicalUngroupedAggregate &op)
-	    : ExecutorTask(executor), event(std::move(event_p)), gstate(state_p), context(context), op(op) {
+	                                       const PhysicalUngroupedAggregate &op, idx_t agg_idx,
+	                                       GlobalSourceState &global_source)
+	    : ExecutorTask(executor), event(std::move(event_p)), gstate(state_p), context(context), op(op),
+	      agg_idx(agg_idx), global_source(global_source) {
 	}
 
 	void AggregateDistinct() {
 		D_ASSERT(gstate.distinct_state);
-		auto &aggregates = op.aggregates;
 		auto &distinct_state = *gstate.distinct_state;
 		auto &distinct_data = *op.distinct_data;
+		D_ASSERT(distinct_data.IsDistinct(agg_idx));
 
 		ThreadContext temp_thread_context(context);
 		ExecutionContext temp_exec_context(context, temp_thread_context, nullptr);
 
-		idx_t payload_idx = 0;
-		idx_t next_payload_idx = 0;
-
-		for (idx_t i = 0; i < aggregates.size(); i++) {
-			auto &aggregate = (BoundAggregateExpression &)*aggregates[i];
-
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
+		auto &aggregate = (BoundAggregateExpression &)*op.aggregates[agg_idx];
+
+		DataChunk payload_chunk;
+
+		D_ASSERT(distinct_data.info.table_map.count(agg_idx));
+		auto table_idx = distinct_data.info.table_map.at(agg_idx);
+		auto &radix_table_p = distinct_data.radix_tables[table_idx];
+		auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
+
+		// Tasks scanning the same radix table share a global source state that hands out the partitions,
+		// so every task scans with its own output chunk and local source state
+		DataChunk output_chunk;
+		output_chunk.Initialize(context, distinct_state.distinct_output_chunks[table_idx]->GetTypes());
+
+		payload_chunk.InitializeEmpty(grouped_aggregate_data.group_types);
+		payload_chunk.SetCardinality(0);
+
+		//! Create the local state for the hashtable
+		auto local_source_state = radix_table_p->GetLocalSourceState(temp_exec_context);
+
+		// Several tasks aggregate the partitions of the same table concurrently, so every task aggregates
+		// into its own state and combines it into the global aggregate state once the table is drained.
+		// Aggregates that cannot combine states get a single task that updates the global state directly.
+		auto local_state = unique_ptr<data_t[]>(new data_t[aggregate.function.state_size()]);
+		aggregate.function.initialize(local_state.get());
+		auto target_state = aggregate.function.combine ? local_state.get() : gstate.state.aggregates[agg_idx].get();
+		// arena for the task-local state; when there is no combine we update the global state directly, which
+		// must then also allocate from the global arena
+		ArenaAllocator allocator(Allocator::DefaultAllocator());
+		auto &target_allocator = aggregate.function.combine ? allocator : gstate.state.allocator;
+		idx_t rows_aggregated = 0;
+
+		//! Retrieve the stored data from the hashtable
+		while (true) {
+			output_chunk.Reset();
+			radix_table_p->GetData(temp_exec_context, output_chunk, *distinct_state.radix_states[table_idx],
+			                       global_source, *local_source_state);
+			if (output_chunk.size() == 0) {
+				break;
+			}
 
-			// If aggregate is not distinct, skip it
-			if (!distinct_data.IsDistinct(i)) {
-				continue;
+			// We dont need to resolve the filter, we already did this in Sink
+			idx_t payload_cnt = aggregate.children.size();
+			for (idx_t i = 0; i < payload_cnt; i++) {
+				payload_chunk.data[i].Reference(output_chunk.data[i]);
 			}
+			payload_chunk.SetCardinality(output_chunk);
+			rows_aggregated += payload_chunk.size();
+
+			auto start_of_input = payload_cnt ? &payload_chunk.data[0] : nullptr;
+			//! Update the aggregate state
+			AggregateInputData aggr_input_data(aggregate.bind_info.get(), target_allocator);
+			aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt, target_state,
+			                                 payload_chunk.size());
+		}
 
-			DataChunk payload_chunk;
-
-			D_ASSERT(distinct_data.info.table_map.count(i));
-			auto table_idx = distinct_data.info.table_map.at(i);
-			auto &radix_table_p = distinct_data.radix_tables[table_idx];
-			auto &output_chunk = *distinct_state.distinct_output_chunks[table_idx];
-			auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
-
-			payload_chunk.InitializeEmpty(grouped_aggregate_data.group_types);
-			payload_chunk.SetCardinality(0);
-
-			//! Create global and local state for the hashtable
-			auto global_source_state = radix_table_p->GetGlobalSourceState(context);
-			auto local_source_state = radix_table_p->GetLocalSourceState(temp_exec_context);
-
-			//! Retrieve the stored data from the hashtable
-			while (true) {
-				output_chunk.Reset();
-				radix_table_p->GetData(temp_exec_context, output_chunk, *distinct_state.radix_states[table_idx],
-				                       *global_source_state, *local_source_state);
-				if (output_chunk.size() == 0) {
-					break;
-				}
-
-				// We dont need to resolve the filter, we already did this in Sink
-				idx_t payload_cnt = aggregate.children.size();
-				for (idx_t i = 0; i < payload_cnt; i++) {
-					payload_chunk.data[i].Reference(output_chunk.data[i]);
-				}
-				payload_chunk.SetCardinality(output_chunk);
+		Vector local_state_vector(Value::POINTER((uintptr_t)local_state.get()));
+		if (aggregate.function.combine) {
+			//! Combine the task-local state into the global aggregate state
+			AggregateInputData aggr_input_data(aggregate.bind_info.get(), gstate.state.allocator);
+			Vector dest_state(Value::POINTER((uintptr_t)gstate.state.aggregates[agg_idx].get()));
+			lock_guard<mutex> glock(gstate.lock);
+			aggregate.function.combine(local_state_vector, dest_state, aggr_input_data, 1);
 #ifdef DEBUG
-				gstate.state.counts[i] += payload_chunk.size();
+			gstate.state.counts[agg_idx] += rows_aggregated;
+#endif
+		} else {
+#ifdef DEBUG
+			gstate.state.counts[agg_idx] += rows_aggregated;
 #endif
-
-				auto start_of_input = payload_cnt ? &payload_chunk.data[0] : nullptr;
-				//! Update the aggregate state
-				AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
-				aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
-				                                 gstate.state.aggregates[i].get(), payload_chunk.size());
-			}
 		}
-		D_ASSERT(!gstate.finished);
-		gstate.finished = true;
+		if (aggregate.function.destructor) {
+			AggregateInputData aggr_input_data(aggregate.bind_info.get(), allocator);
+			aggregate.function.destructor(local_state_vector, aggr_input_data, 1);
+		}
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
@@ -420,9 +449,12 @@ private:
 	UngroupedAggregateGlobalState &gstate;
 	ClientContext &context;
 	const PhysicalUngroupedAggregate &op;
+	//! The index of the distinct aggregate that this task computes
+	idx_t agg_idx;
+	//! The source state of the radix table, shared with the other tasks computing the same aggregate
+	GlobalSourceState &global_source;
 };
 
-// TODO: Create tasks and run these in parallel instead of doing this all in Schedule, single threaded
 class UngroupedDistinctAggregateFinalizeEvent : public BasePipelineEvent {
 public:
 	UngroupedDistinctAggregateFinalizeEvent(const PhysicalUngroupedAggregate &op_p,
@@ -433,15 +465,39 @@ public:
 	const PhysicalUngroupedAggregate &op;
 	UngroupedAggregateGlobalState &gstate;
 	ClientContext &context;
+	//! The global source states of the distinct tables, each shared by the tasks computing one aggregate
+	vector<unique_ptr<GlobalSourceState>> global_source_states;
 
 public:
 	void Schedule() override {
+		// schedule tasks per distinct aggregate - every task updates only its own aggregate state, so the
+		// aggregates can be computed in parallel even when they share a radix table. Aggregates that can
+		// combine states additionally get one task per thread, which drain the partitions of their radix
+		// table concurrently, so that a single distinct aggregate also scales across cores
+		auto &scheduler = TaskScheduler::GetScheduler(context);
+		const auto n_threads = MaxValue<idx_t>(1, scheduler.NumberOfThreads());
 		vector<unique_ptr<Task>> tasks;
-		tasks.push_back(make_unique<UngroupedDistinctAggregateFinalizeTask>(pipeline->executor, shared_from_this(),
-		                                                                    gstate, context, op));
+		for (auto &agg_idx : op.distinct_collection_info->Indices()) {
+			auto &aggregate = (BoundAggregateExpression &)*op.aggregates[agg_idx];
+			auto table_idx = op.distinct_data->info.table_map.at(agg_idx);
+			auto &radix_table = *op.distinct_data->radix_tables[table_idx];
+			global_source_states.push_back(radix_table.GetGlobalSourceState(context));
+			auto &global_source = *global_source_states.back();
+
+			const idx_t n_tasks = aggregate.function.combine ? n_threads : 1;
+			for (idx_t task_idx = 0; task_idx < n_tasks; task_idx++) {
+				tasks.push_back(make_unique<UngroupedDistinctAggregateFinalizeTask>(
+				    pipeline->executor, shared_from_this(), gstate, context, op, agg_idx, global_source));
+			}
+		}
 		D_ASSERT(!tasks.empty());
 		SetTasks(std::move(tasks));
 	}
+
+	void FinishEvent() override {
+		D_ASSERT(!gstate.finished);
+		gstate.finished = true;
+	}
 };
 
 class UngroupedDistinctCombineFinalizeEvent : public BasePipelineEvent {
@@ -560,7 +616,7 @@ void PhysicalUngroupedAggregate::GetData(ExecutionContext &context, DataChunk &c
 		auto &aggregate = (BoundAggregateExpression &)*aggregates[aggr_idx];
 
 		Vector state_vector(Value::POINTER((uintptr_t)gstate.state.aggregates[aggr_idx].get()));
-		AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
+		AggregateInputData aggr_input_data(aggregate.bind_info.get(), gstate.state.allocator);
 		aggregate.function.finalize(state_vector, aggr_input_data, chunk.data[aggr_idx], 1, 0);
 	}
 	VerifyNullHandling(chunk, gstate.state, aggregates);
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <thread>
 
 namespace duckdb {
 
@@ -673,14 +674,21 @@ struct WindowBoundariesState {
 		return expr ? expr->IsScalar() : true;
 	}
 
+	static inline bool HasPrecedingRange(BoundWindowExpression *wexpr) {
+		return wexpr->start == WindowBoundary::EXPR_PRECEDING_RANGE ||
+		       wexpr->end == WindowBoundary::EXPR_PRECEDING_RANGE;
+	}
+
+	static inline bool HasFollowingRange(BoundWindowExpression *wexpr) {
+		return wexpr->start == WindowBoundary::EXPR_FOLLOWING_RANGE ||
+		       wexpr->end == WindowBoundary::EXPR_FOLLOWING_RANGE;
+	}
+
 	WindowBoundariesState(BoundWindowExpression *wexpr, const idx_t input_size)
 	    : type(wexpr->type), input_size(input_size), start_boundary(wexpr->start), end_boundary(wexpr->end),
 	      partition_count(wexpr->partitions.size()), order_count(wexpr->orders.size()),
 	      range_sense(wexpr->orders.empty() ? OrderType::INVALID : wexpr->orders[0].type),
-	      has_preceding_range(wexpr->start == WindowBoundary::EXPR_PRECEDING_RANGE ||
-	                          wexpr->end == WindowBoundary::EXPR_PRECEDING_RANGE),
-	      has_following_range(wexpr->start == WindowBoundary::EXPR_FOLLOWING_RANGE ||
-	                          wexpr->end == WindowBoundary::EXPR_FOLLOWING_RANGE),
+	      has_preceding_range(HasPrecedingRange(wexpr)), has_following_range(HasFollowingRange(wexpr)),
 	      needs_peer(BoundaryNeedsPeer(wexpr->end) || wexpr->type == ExpressionType::WINDOW_CUME_DIST) {
 	}
 
@@ -1014,14 +1022,14 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 	}
 }
 
-struct WindowExecutor {
-	WindowExecutor(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count);
+//! Per-thread state for evaluating a (shared) WindowExecutor
+struct WindowExecutorState {
+	WindowExecutorState(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count,
+	                    WindowSegmentTree *segment_tree);
 
-	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count);
-	void Finalize(WindowAggregationMode mode);
-
-	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-	              const ValidityMask &order_mask);
+	//! Move the state to an arbitrary row, as if all previous rows had just been processed
+	void Seek(const idx_t row_idx, WindowInputColumn &range_collection, const ValidityMask &partition_mask,
+	          const ValidityMask &order_mask);
 
 	// The function
 	BoundWindowExpression *wexpr;
@@ -1031,6 +1039,34 @@ struct WindowExecutor {
 	uint64_t dense_rank = 1;
 	uint64_t rank_equal = 0;
 	uint64_t rank = 1;
+	//! The next row that will be evaluated sequentially (if we are not there, we have to Seek)
+	idx_t next_row = 0;
+
+	// LEAD/LAG Evaluation
+	WindowInputExpression leadlag_offset;
+	WindowInputExpression leadlag_default;
+
+	// evaluate boundaries if present. Parser has checked boundary types.
+	WindowInputExpression boundary_start;
+	WindowInputExpression boundary_end;
+
+	//! Per-thread scratch space for the shared segment tree
+	unique_ptr<WindowSegmentTree::LocalState> segment_state;
+};
+
+struct WindowExecutor {
+	WindowExecutor(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count);
+
+	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count);
+	void Finalize(WindowAggregationMode mode);
+
+	//! Evaluate the function using the given per-thread state.
+	//! After Finalize, the executor itself is read-only and can be shared by threads.
+	void Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+	              const ValidityMask &partition_mask, const ValidityMask &order_mask);
+
+	// The function
+	BoundWindowExpression *wexpr;
 
 	// Expression collections
 	DataChunk payload_collection;
@@ -1042,14 +1078,6 @@ struct WindowExecutor {
 	vector<validity_t> filter_bits;
 	SelectionVector filter_sel;
 
-	// LEAD/LAG Evaluation
-	WindowInputExpression leadlag_offset;
-	WindowInputExpression leadlag_default;
-
-	// evaluate boundaries if present. Parser has checked boundary types.
-	WindowInputExpression boundary_start;
-	WindowInputExpression boundary_end;
-
 	// evaluate RANGE expressions, if needed
 	WindowInputColumn range;
 
@@ -1061,11 +1089,95 @@ struct WindowExecutor {
 	unique_ptr<WindowSegmentTree> segment_tree = nullptr;
 };
 
+//	Counts the valid (set) bits of mask in [begin, end)
+static idx_t CountValid(const ValidityMask &mask, const idx_t begin, const idx_t end) {
+	idx_t result = 0;
+	idx_t i = begin;
+	//	Ragged start
+	for (; i < end && (i % ValidityMask::BITS_PER_VALUE) != 0; ++i) {
+		result += mask.RowIsValidUnsafe(i);
+	}
+	//	Whole entries
+	for (; i + ValidityMask::BITS_PER_VALUE <= end; i += ValidityMask::BITS_PER_VALUE) {
+		auto entry = mask.GetValidityEntry(i / ValidityMask::BITS_PER_VALUE);
+		while (entry) {
+			entry &= entry - 1;
+			++result;
+		}
+	}
+	//	Ragged end
+	for (; i < end; ++i) {
+		result += mask.RowIsValidUnsafe(i);
+	}
+	return result;
+}
+
+WindowExecutorState::WindowExecutorState(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count,
+                                         WindowSegmentTree *segment_tree)
+    : wexpr(wexpr), bounds(wexpr, count), leadlag_offset(wexpr->offset_expr.get(), context),
+      leadlag_default(wexpr->default_expr.get(), context), boundary_start(wexpr->start_expr.get(), context),
+      boundary_end(wexpr->end_expr.get(), context) {
+	if (segment_tree) {
+		segment_state = segment_tree->GetLocalState();
+	}
+}
+
+void WindowExecutorState::Seek(const idx_t row_idx, WindowInputColumn &range_collection,
+                               const ValidityMask &partition_mask, const ValidityMask &order_mask) {
+	D_ASSERT(row_idx > 0);
+	if (bounds.partition_count + bounds.order_count == 0) {
+		// OVER() - no state is carried from row to row
+		return;
+	}
+
+	// Find the partition and peer group containing the previous row.
+	// The first row of a partition is always flagged, so these always succeed.
+	idx_t n = 1;
+	bounds.partition_start = FindPrevStart(partition_mask, 0, row_idx, n);
+	n = 1;
+	bounds.peer_start = FindPrevStart(order_mask, bounds.partition_start, row_idx, n);
+
+	// find end of partition
+	bounds.partition_end = bounds.input_size;
+	if (bounds.partition_count) {
+		n = 1;
+		bounds.partition_end = FindNextStart(partition_mask, bounds.partition_start + 1, bounds.input_size, n);
+	}
+
+	// Find valid ordering values for the partition
+	// so we can exclude NULLs from RANGE expression computations
+	bounds.valid_start = bounds.partition_start;
+	bounds.valid_end = bounds.partition_end;
+
+	if ((bounds.valid_start < bounds.valid_end) && bounds.has_preceding_range) {
+		// Exclude any leading NULLs
+		if (range_collection.CellIsNull(bounds.valid_start)) {
+			n = 1;
+			bounds.valid_start = FindNextStart(order_mask, bounds.valid_start + 1, bounds.valid_end, n);
+		}
+	}
+
+	if ((bounds.valid_start < bounds.valid_end) && bounds.has_following_range) {
+		// Exclude any trailing NULLs
+		if (range_collection.CellIsNull(bounds.valid_end - 1)) {
+			n = 1;
+			bounds.valid_end = FindPrevStart(order_mask, bounds.valid_start, bounds.valid_end, n);
+		}
+	}
+
+	//	Restore the rank counters by counting the peer groups before this row
+	if (WindowNeedsRank(wexpr)) {
+		dense_rank = CountValid(order_mask, bounds.partition_start, row_idx);
+		rank = bounds.peer_start - bounds.partition_start + 1;
+		rank_equal = row_idx - bounds.peer_start;
+	}
+}
+
 WindowExecutor::WindowExecutor(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count)
-    : wexpr(wexpr), bounds(wexpr, count), payload_collection(), payload_executor(context), filter_executor(context),
-      leadlag_offset(wexpr->offset_expr.get(), context), leadlag_default(wexpr->default_expr.get(), context),
-      boundary_start(wexpr->start_expr.get(), context), boundary_end(wexpr->end_expr.get(), context),
-      range((bounds.has_preceding_range || bounds.has_following_range) ? wexpr->orders[0].expression.get() : nullptr,
+    : wexpr(wexpr), payload_collection(), payload_executor(context), filter_executor(context),
+      range((WindowBoundariesState::HasPrecedingRange(wexpr) || WindowBoundariesState::HasFollowingRange(wexpr))
+                ? wexpr->orders[0].expression.get()
+                : nullptr,
             context, count)
 
 {
@@ -1171,30 +1283,39 @@ void WindowExecutor::Finalize(WindowAggregationMode mode) {
 	}
 }
 
-void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-                              const ValidityMask &order_mask) {
+void WindowExecutor::Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+                              const ValidityMask &partition_mask, const ValidityMask &order_mask) {
+	auto &bounds = lstate.bounds;
+
+	// If we are not evaluating the next sequential row, restore the row-to-row state first
+	if (row_idx > 0 && row_idx != lstate.next_row) {
+		lstate.Seek(row_idx, range, partition_mask, order_mask);
+	}
+	lstate.next_row = row_idx + input_chunk.size();
+
 	// Evaluate the row-level arguments
-	boundary_start.Execute(input_chunk);
-	boundary_end.Execute(input_chunk);
+	lstate.boundary_start.Execute(input_chunk);
+	lstate.boundary_end.Execute(input_chunk);
 
-	leadlag_offset.Execute(input_chunk);
-	leadlag_default.Execute(input_chunk);
+	lstate.leadlag_offset.Execute(input_chunk);
+	lstate.leadlag_default.Execute(input_chunk);
 
 	// this is the main loop, go through all sorted rows and compute window function result
 	for (idx_t output_offset = 0; output_offset < input_chunk.size(); ++output_offset, ++row_idx) {
 		// special case, OVER (), aggregate over everything
-		bounds.Update(row_idx, range, output_offset, boundary_start, boundary_end, partition_mask, order_mask);
+		bounds.Update(row_idx, range, output_offset, lstate.boundary_start, lstate.boundary_end, partition_mask,
+		              order_mask);
 		if (WindowNeedsRank(wexpr)) {
 			if (!bounds.is_same_partition || row_idx == 0) { // special case for first row, need to init
-				dense_rank = 1;
-				rank = 1;
-				rank_equal = 0;
+				lstate.dense_rank = 1;
+				lstate.rank = 1;
+				lstate.rank_equal = 0;
 			} else if (!bounds.is_peer) {
-				dense_rank++;
-				rank += rank_equal;
-				rank_equal = 0;
+				lstate.dense_rank++;
+				lstate.rank += lstate.rank_equal;
+				lstate.rank_equal = 0;
 			}
-			rank_equal++;
+			lstate.rank_equal++;
 		}
 
 		// if no values are read for window, result is NULL
@@ -1205,7 +1326,7 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 
 		switch (wexpr->type) {
 		case ExpressionType::WINDOW_AGGREGATE: {
-			segment_tree->Compute(result, output_offset, bounds.window_start, bounds.window_end);
+			segment_tree->Compute(*lstate.segment_state, result, output_offset, bounds.window_start, bounds.window_end);
 			break;
 		}
 		case ExpressionType::WINDOW_ROW_NUMBER: {
@@ -1215,17 +1336,17 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 		}
 		case ExpressionType::WINDOW_RANK_DENSE: {
 			auto rdata = FlatVector::GetData<int64_t>(result);
-			rdata[output_offset] = dense_rank;
+			rdata[output_offset] = lstate.dense_rank;
 			break;
 		}
 		case ExpressionType::WINDOW_RANK: {
 			auto rdata = FlatVector::GetData<int64_t>(result);
-			rdata[output_offset] = rank;
+			rdata[output_offset] = lstate.rank;
 			break;
 		}
 		case ExpressionType::WINDOW_PERCENT_RANK: {
 			int64_t denom = (int64_t)bounds.partition_end - bounds.partition_start - 1;
-			double percent_rank = denom > 0 ? ((double)rank - 1) / denom : 0;
+			double percent_rank = denom > 0 ? ((double)lstate.rank - 1) / denom : 0;
 			auto rdata = FlatVector::GetData<double>(result);
 			rdata[output_offset] = percent_rank;
 			break;
@@ -1280,7 +1401,7 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 		case ExpressionType::WINDOW_LAG: {
 			int64_t offset = 1;
 			if (wexpr->offset_expr) {
-				offset = leadlag_offset.GetCell<int64_t>(output_offset);
+				offset = lstate.leadlag_offset.GetCell<int64_t>(output_offset);
 			}
 			int64_t val_idx = (int64_t)row_idx;
 			if (wexpr->type == ExpressionType::WINDOW_LEAD) {
@@ -1303,7 +1424,7 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 			if (!delta) {
 				CopyCell(payload_collection, 0, val_idx, result, output_offset);
 			} else if (wexpr->default_expr) {
-				leadlag_default.CopyCell(result, output_offset);
+				lstate.leadlag_default.CopyCell(result, output_offset);
 			} else {
 				FlatVector::SetNull(result, output_offset, true);
 			}
@@ -1680,42 +1801,89 @@ SinkFinalizeType PhysicalWindow::Finalize(Pipeline &pipeline, Event &event, Clie
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
+//	Per-partition read state, shared by all the threads scanning the partition
+class WindowPartitionSourceState {
+public:
+	using HashGroupPtr = unique_ptr<WindowGlobalHashGroup>;
+	using WindowExecutorPtr = unique_ptr<WindowExecutor>;
+	using WindowExecutors = vector<WindowExecutorPtr>;
+
+	WindowPartitionSourceState(ClientContext &context, const PhysicalWindow &op)
+	    : context(context), hash_bin(0), count(0), external(false), built(false), next_block(0) {
+		layout.Initialize(op.children[0]->types);
+	}
+
+	void MaterializeSortedData();
+	//! Prepare the partition for scanning: sorted data, masks and window executors.
+	//! Only the thread that claimed the partition builds; the others wait for 'built'.
+	void Build(WindowGlobalSinkState &gstate, const idx_t hash_bin_p);
+
+	ClientContext &context;
+
+	HashGroupPtr hash_group;
+	//! The generated input chunks
+	unique_ptr<RowDataCollection> rows;
+	unique_ptr<RowDataCollection> heap;
+	RowLayout layout;
+	//! The partition boundary mask
+	vector<validity_t> partition_bits;
+	ValidityMask partition_mask;
+	//! The order boundary mask
+	vector<validity_t> order_bits;
+	ValidityMask order_mask;
+	//! The shared execution functions (read-only after Build)
+	WindowExecutors window_execs;
+
+	//! The read partition
+	idx_t hash_bin;
+	//! The number of rows in the partition
+	idx_t count;
+	//! External paging
+	bool external;
+	//! Whether the partition is ready for scanning
+	atomic<bool> built;
+	//! The first global row number of each block, so threads can locate their rows
+	vector<idx_t> block_bases;
+	//! The next block to claim
+	atomic<idx_t> next_block;
+
+private:
+	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p);
+};
+
 class WindowGlobalSourceState : public GlobalSourceState {
 public:
 	explicit WindowGlobalSourceState(const PhysicalWindow &op) : op(op), next_bin(0) {
 	}
 
 	const PhysicalWindow &op;
-	//! The output read position.
-	atomic<idx_t> next_bin;
+	//! Lock for the partition queues below
+	mutex lock;
+	//! The first bin that has not yet been claimed by a thread
+	idx_t next_bin;
+	//! Claimed partitions that may still have unclaimed blocks
+	vector<shared_ptr<WindowPartitionSourceState>> partition_sources;
 
 public:
 	idx_t MaxThreads() override {
 		auto &state = (WindowGlobalSinkState &)*op.sink_state;
 
-		// If there is only one partition, we have to process it on one thread.
-		if (!state.grouping_data) {
-			return 1;
-		}
-
 		// If there is not a lot of data, process serially.
 		if (state.count < STANDARD_ROW_GROUPS_SIZE) {
 			return 1;
 		}
 
-		return state.hash_groups.size();
+		//	Large partitions can be scanned by multiple threads,
+		//	so we are not limited to the number of non-empty bins.
+		return (state.count / STANDARD_ROW_GROUPS_SIZE) + 1;
 	}
 };
 
 // Per-thread read state
 class WindowLocalSourceState : public LocalSourceState {
 public:
-	using HashGroupPtr = unique_ptr<WindowGlobalHashGroup>;
-	using WindowExecutorPtr = unique_ptr<WindowExecutor>;
-	using WindowExecutors = vector<WindowExecutorPtr>;
-
 	WindowLocalSourceState(const PhysicalWindow &op, ExecutionContext &context, WindowGlobalSourceState &gstate)
-	    : context(context.client), allocator(Allocator::Get(context.client)) {
+	    : context(context.client), allocator(Allocator::Get(context.client)), base_row(0) {
 		vector<LogicalType> output_types;
 		for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
 			D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
@@ -1725,42 +1893,38 @@ public:
 		output_chunk.Initialize(allocator, output_types);
 
 		const auto &input_types = op.children[0]->types;
-		layout.Initialize(input_types);
 		input_chunk.Initialize(allocator, input_types);
 	}
 
-	void MaterializeSortedData();
-	void GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	//! Assign the next unclaimed block to this thread. Returns false if the source is exhausted.
+	bool NextTask(WindowGlobalSinkState &gstate, WindowGlobalSourceState &gsource);
 	void Scan(DataChunk &chunk);
 
-	HashGroupPtr hash_group;
 	ClientContext &context;
 	Allocator &allocator;
 
-	//! The generated input chunks
-	unique_ptr<RowDataCollection> rows;
-	unique_ptr<RowDataCollection> heap;
-	RowLayout layout;
-	//! The partition boundary mask
-	vector<validity_t> partition_bits;
-	ValidityMask partition_mask;
-	//! The order boundary mask
-	vector<validity_t> order_bits;
-	ValidityMask order_mask;
-	//! The current execution functions
-	WindowExecutors window_execs;
-
-	//! The read partition
-	idx_t hash_bin;
+	//! The partition this thread is scanning (possibly with other threads)
+	shared_ptr<WindowPartitionSourceState> partition_source;
+	//! Per-thread evaluation states for the shared executors
+	vector<unique_ptr<WindowExecutorState>> exec_states;
+	//! The rows and heap of the block being scanned
+	unique_ptr<RowDataCollection> task_rows;
+	unique_ptr<RowDataCollection> task_heap;
+	//! The global row number of the first row of the block being scanned
+	idx_t base_row;
 	//! The read cursor
 	unique_ptr<RowDataCollectionScanner> scanner;
 	//! Buffer for the inputs
 	DataChunk input_chunk;
 	//! Buffer for window results
 	DataChunk output_chunk;
+
+private:
+	//! Start scanning a claimed block
+	void BeginBlockScan(const idx_t block_idx);
 };
 
-void WindowLocalSourceState::MaterializeSortedData() {
+void WindowPartitionSourceState::MaterializeSortedData() {
 	auto &global_sort_state = *hash_group->global_sort;
 	if (global_sort_state.sorted_blocks.empty()) {
 		return;
@@ -1799,10 +1963,9 @@ void WindowLocalSourceState::MaterializeSortedData() {
 	                              [&](idx_t c, const unique_ptr<RowDataBlock> &b) { return c + b->count; });
 }
 
-void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
+void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
 	auto &op = (PhysicalWindow &)gstate.op;
 
-	//	Get rid of any stale data
 	hash_bin = hash_bin_p;
 
 	// There are three types of partitions:
@@ -1811,7 +1974,6 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	// 3. Multiple partitions (sorting and hashing)
 
 	//	How big is the partition?
-	idx_t count = 0;
 	if (hash_bin < gstate.hash_groups.size() && gstate.hash_groups[hash_bin]) {
 		count = gstate.hash_groups[hash_bin]->count;
 	} else if (gstate.rows && !hash_bin) {
@@ -1821,7 +1983,6 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	}
 
 	// Create the executors for each function
-	window_execs.clear();
 	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto wexpr = reinterpret_cast<BoundWindowExpression *>(op.select_list[expr_idx].get());
@@ -1831,16 +1992,14 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 
 	//	Initialise masks to false
 	const auto bit_count = ValidityMask::ValidityMaskSize(count);
-	partition_bits.clear();
 	partition_bits.resize(bit_count, 0);
 	partition_mask.Initialize(partition_bits.data());
 
-	order_bits.clear();
 	order_bits.resize(bit_count, 0);
 	order_mask.Initialize(order_bits.data());
 
 	// Scan the sorted data into new Collections
-	auto external = gstate.external;
+	external = gstate.external;
 	if (gstate.rows && !hash_bin) {
 		// Simple mask
 		partition_mask.SetValidUnsafe(0);
@@ -1859,9 +2018,10 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 		return;
 	}
 
-	//	First pass over the input without flushing
-	//	TODO: Factor out the constructor data as global state
-	scanner = make_unique<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
+	//	Single pass over the input to produce the shared executor data
+	auto scanner = make_unique<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
+	DataChunk input_chunk;
+	input_chunk.Initialize(Allocator::Get(context), layout.GetTypes());
 	idx_t input_idx = 0;
 	while (true) {
 		input_chunk.Reset();
@@ -1885,8 +2045,134 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	// External scanning assumes all blocks are swizzled.
 	scanner->ReSwizzle();
 
-	//	Second pass can flush
-	scanner->Reset(true);
+	//	Compute the base row number of each block,
+	//	so the scanning threads can map their blocks back to global row numbers
+	block_bases.reserve(rows->blocks.size());
+	idx_t base = 0;
+	for (auto &block : rows->blocks) {
+		block_bases.emplace_back(base);
+		base += block->count;
+	}
+}
+
+void WindowPartitionSourceState::Build(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
+	//	Mark the partition as built even if we fail,
+	//	so that threads waiting on us are not stranded.
+	try {
+		BuildPartition(gstate, hash_bin_p);
+	} catch (...) {
+		built = true;
+		throw;
+	}
+	built = true;
+}
+
+void WindowLocalSourceState::BeginBlockScan(const idx_t block_idx) {
+	auto &source = *partition_source;
+	D_ASSERT(block_idx < source.rows->blocks.size());
+
+	//	The scanner references the slices, so get rid of it first
+	scanner.reset();
+
+	//	Each block is scanned by exactly one thread,
+	//	so we can scan (and unswizzle) it through a private slice of the shared collections
+	task_rows = source.rows->CloneEmpty(source.rows->keep_pinned);
+	task_rows->blocks.emplace_back(source.rows->blocks[block_idx]->Copy());
+	task_rows->count = task_rows->blocks[0]->count;
+
+	task_heap = source.heap->CloneEmpty(source.heap->keep_pinned);
+	if (!source.heap->blocks.empty()) {
+		task_heap->blocks.emplace_back(source.heap->blocks[block_idx]->Copy());
+		task_heap->count = task_heap->blocks[0]->count;
+	}
+
+	base_row = source.block_bases[block_idx];
+	scanner = make_unique<RowDataCollectionScanner>(*task_rows, *task_heap, source.layout, source.external, false);
+}
+
+bool WindowLocalSourceState::NextTask(WindowGlobalSinkState &gstate, WindowGlobalSourceState &gsource) {
+	//	Keep claiming blocks from the current partition while it has any left
+	if (partition_source) {
+		const auto block_idx = partition_source->next_block++;
+		if (block_idx < partition_source->rows->blocks.size()) {
+			BeginBlockScan(block_idx);
+			return true;
+		}
+		//	Partition exhausted - drop the per-thread states before the shared data
+		exec_states.clear();
+		partition_source.reset();
+	}
+
+	const auto bin_count = gstate.hash_groups.empty() ? 1 : gstate.hash_groups.size();
+
+	while (true) {
+		shared_ptr<WindowPartitionSourceState> source;
+		idx_t build_bin = 0;
+		bool build = false;
+		{
+			lock_guard<mutex> guard(gsource.lock);
+			//	Prefer partitions that no thread has started yet
+			while (gsource.next_bin < bin_count) {
+				const auto hash_bin = gsource.next_bin++;
+				//	Skip empty bins
+				if ((hash_bin < gstate.hash_groups.size() && gstate.hash_groups[hash_bin]) ||
+				    (gstate.rows && !hash_bin)) {
+					source = make_shared<WindowPartitionSourceState>(context, gsource.op);
+					gsource.partition_sources.emplace_back(source);
+					build_bin = hash_bin;
+					build = true;
+					break;
+				}
+			}
+
+			if (!source) {
+				//	No fresh bins left: help out with a partition that still has unclaimed blocks,
+				//	dropping any that are fully claimed along the way.
+				for (idx_t i = 0; i < gsource.partition_sources.size();) {
+					auto &shared_source = gsource.partition_sources[i];
+					if (shared_source->built &&
+					    (!shared_source->rows || shared_source->next_block >= shared_source->rows->blocks.size())) {
+						gsource.partition_sources.erase(gsource.partition_sources.begin() + i);
+						continue;
+					}
+					++i;
+				}
+				if (!gsource.partition_sources.empty()) {
+					source = gsource.partition_sources.front();
+				}
+			}
+		}
+
+		if (!source) {
+			//	Nothing left anywhere
+			return false;
+		}
+
+		if (build) {
+			source->Build(gstate, build_bin);
+		} else {
+			//	Wait for the partition to be built by the thread that claimed it
+			while (!source->built) {
+				std::this_thread::yield();
+			}
+		}
+
+		//	Try to claim a block
+		if (source->rows) {
+			const auto block_idx = source->next_block++;
+			if (block_idx < source->rows->blocks.size()) {
+				partition_source = std::move(source);
+				//	Create the per-thread states for the shared executors
+				for (auto &wexec : partition_source->window_execs) {
+					exec_states.emplace_back(make_unique<WindowExecutorState>(
+					    wexec->wexpr, context, partition_source->count, wexec->segment_tree.get()));
+				}
+				BeginBlockScan(block_idx);
+				return true;
+			}
+		}
+		//	All blocks were claimed by other threads while we were waiting; look again
+	}
 }
 
 void WindowLocalSourceState::Scan(DataChunk &result) {
@@ -1895,14 +2181,16 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 		return;
 	}
 
-	const auto position = scanner->Scanned();
+	const auto position = base_row + scanner->Scanned();
 	input_chunk.Reset();
 	scanner->Scan(input_chunk);
 
+	auto &source = *partition_source;
 	output_chunk.Reset();
-	for (idx_t expr_idx = 0; expr_idx < window_execs.size(); ++expr_idx) {
-		auto &executor = *window_execs[expr_idx];
-		executor.Evaluate(position, input_chunk, output_chunk.data[expr_idx], partition_mask, order_mask);
+	for (idx_t expr_idx = 0; expr_idx < source.window_execs.size(); ++expr_idx) {
+		auto &executor = *source.window_execs[expr_idx];
+		executor.Evaluate(*exec_states[expr_idx], position, input_chunk, output_chunk.data[expr_idx],
+		                  source.partition_mask, source.order_mask);
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
@@ -1934,26 +2222,12 @@ void PhysicalWindow::GetData(ExecutionContext &context, DataChunk &chunk, Global
 	auto &global_source = (WindowGlobalSourceState &)gstate_p;
 	auto &gstate = (WindowGlobalSinkState &)*sink_state;
 
-	const auto bin_count = gstate.hash_groups.empty() ? 1 : gstate.hash_groups.size();
-
 	while (chunk.size() == 0) {
-		//	Move to the next bin if we are done.
+		//	Move to the next block if we are done.
 		while (!state.scanner || !state.scanner->Remaining()) {
-			state.scanner.reset();
-			state.rows.reset();
-			state.heap.reset();
-			state.hash_group.reset();
-			auto hash_bin = global_source.next_bin++;
-			if (hash_bin >= bin_count) {
+			if (!state.NextTask(gstate, global_source)) {
 				return;
 			}
-
-			for (; hash_bin < gstate.hash_groups.size(); hash_bin = global_source.next_bin++) {
-				if (gstate.hash_groups[hash_bin]) {
-					break;
-				}
-			}
-			state.GeneratePartition(gstate, hash_bin);
 		}
 
 		state.Scan(chunk);
@@ -3,6 +3,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/transaction/transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -76,6 +77,12 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 		});
 	}
 
+	if (info->options.vacuum) {
+		// rewrite the row groups of the table to reclaim the space of rows whose deletion has been committed
+		auto &transaction_manager = TransactionManager::Get(table->storage->db);
+		transaction_manager.Vacuum(context, *table->storage);
+	}
+
 	return SinkFinalizeType::READY;
 }
 
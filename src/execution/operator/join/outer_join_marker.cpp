@@ -10,7 +10,8 @@ void OuterJoinMarker::Initialize(idx_t count_p) {
 		return;
 	}
 	this->count = count_p;
-	found_match = unique_ptr<bool[]>(new bool[count]);
+	auto word_count = (count + BITS_PER_WORD - 1) / BITS_PER_WORD;
+	found_match = unique_ptr<atomic<uint64_t>[]>(new atomic<uint64_t>[word_count]);
 	Reset();
 }
 
@@ -18,7 +19,10 @@ void OuterJoinMarker::Reset() {
 	if (!enabled) {
 		return;
 	}
-	memset(found_match.get(), 0, sizeof(bool) * count);
+	auto word_count = (count + BITS_PER_WORD - 1) / BITS_PER_WORD;
+	for (idx_t word_idx = 0; word_idx < word_count; word_idx++) {
+		found_match[word_idx].store(0, std::memory_order_relaxed);
+	}
 }
 
 void OuterJoinMarker::SetMatch(idx_t position) {
@@ -26,7 +30,7 @@ void OuterJoinMarker::SetMatch(idx_t position) {
 		return;
 	}
 	D_ASSERT(position < count);
-	found_match[position] = true;
+	SetMatchInternal(position);
 }
 
 void OuterJoinMarker::SetMatches(const SelectionVector &sel, idx_t count, idx_t base_idx) {
@@ -37,7 +41,7 @@ void OuterJoinMarker::SetMatches(const SelectionVector &sel, idx_t count, idx_t
 		auto idx = sel.get_index(i);
 		auto pos = base_idx + idx;
 		D_ASSERT(pos < this->count);
-		found_match[pos] = true;
+		SetMatchInternal(pos);
 	}
 }
 
@@ -49,7 +53,7 @@ void OuterJoinMarker::ConstructLeftJoinResult(DataChunk &left, DataChunk &result
 	SelectionVector remaining_sel(STANDARD_VECTOR_SIZE);
 	idx_t remaining_count = 0;
 	for (idx_t i = 0; i < left.size(); i++) {
-		if (!found_match[i]) {
+		if (!RowMatched(i)) {
 			remaining_sel.set_index(remaining_count++, i);
 		}
 	}
@@ -84,7 +88,7 @@ void OuterJoinMarker::Scan(OuterJoinGlobalScanState &gstate, OuterJoinLocalScanS
 		idx_t result_count = 0;
 		// figure out which tuples didn't find a match in the RHS
 		for (idx_t i = 0; i < lstate.scan_chunk.size(); i++) {
-			if (!found_match[lstate.local_scan.current_row_index + i]) {
+			if (!RowMatched(lstate.local_scan.current_row_index + i)) {
 				lstate.match_sel.set_index(result_count++, i);
 			}
 		}
@@ -17,7 +17,7 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::BuildPerfectHashTable() {
 	// First, allocate memory for each build column
 	auto build_size = perfect_join_statistics.build_range + 1;
 	for (const auto &type : ht.build_types) {
@@ -32,26 +32,45 @@ bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
 
 	// Now fill columns with build data
 	JoinHTScanState join_ht_state;
-	return FullScanHashTable(join_ht_state, key_type);
+	return FullScanHashTable(join_ht_state);
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(JoinHTScanState &state, LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable(JoinHTScanState &state) {
 	Vector tuples_addresses(LogicalType::POINTER, ht.Count());              // allocate space for all the tuples
 	auto key_locations = FlatVector::GetData<data_ptr_t>(tuples_addresses); // get a pointer to vector data
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
 	// Go through all the blocks and fill the keys addresses
 	auto keys_count = ht.FillWithHTOffsets(key_locations, state);
-	// Scan the build keys in the hash table
-	Vector build_vector(key_type, keys_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, keys_count, 0);
-	// Now fill the selection vector using the build keys and create a sequential vector
+	// Compose the dense position of every build tuple from its key columns
+	D_ASSERT(ht.equality_types.size() == perfect_join_statistics.key_mins.size());
+	const auto invalid_position = perfect_join_statistics.build_range + 1;
+	auto positions = unique_ptr<idx_t[]>(new idx_t[keys_count]);
+	memset(positions.get(), 0, sizeof(idx_t) * keys_count);
+	for (idx_t key_idx = 0; key_idx < ht.equality_types.size(); key_idx++) {
+		Vector build_vector(ht.equality_types[key_idx], keys_count);
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, keys_count, key_idx);
+		if (!ComposePositionsSwitchBuild(build_vector, key_idx, keys_count, positions.get())) {
+			return false;
+		}
+	}
+	// Now fill the selection vector using the composed positions and create a sequential vector
 	// todo: add check for fast pass when probe is part of build domain
 	SelectionVector sel_build(keys_count + 1);
 	SelectionVector sel_tuples(keys_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, keys_count);
-	// early out
-	if (!success) {
-		return false;
+	for (idx_t i = 0, sel_idx = 0; i < keys_count; ++i) {
+		auto idx = positions[i];
+		if (idx == invalid_position) {
+			// key outside of the probe domain: can never match
+			continue;
+		}
+		if (bitmap_build_idx[idx]) {
+			// duplicate build key: fall back to the regular hash join
+			return false;
+		}
+		bitmap_build_idx[idx] = true;
+		unique_keys++;
+		sel_build.set_index(sel_idx, idx);
+		sel_tuples.set_index(sel_idx++, i);
 	}
 	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
@@ -69,56 +88,55 @@ bool PerfectHashJoinExecutor::FullScanHashTable(JoinHTScanState &state, LogicalT
 	return true;
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
+bool PerfectHashJoinExecutor::ComposePositionsSwitchBuild(Vector &source, idx_t key_idx, idx_t count,
+                                                          idx_t *positions) {
 	switch (source.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<int8_t>(source, key_idx, count, positions);
 	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<int16_t>(source, key_idx, count, positions);
 	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<int32_t>(source, key_idx, count, positions);
 	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<int64_t>(source, key_idx, count, positions);
 	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<uint8_t>(source, key_idx, count, positions);
 	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<uint16_t>(source, key_idx, count, positions);
 	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<uint32_t>(source, key_idx, count, positions);
 	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComposePositionsBuild<uint64_t>(source, key_idx, count, positions);
 	default:
 		throw NotImplementedException("Type not supported for perfect hash join");
 	}
 }
 
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
+bool PerfectHashJoinExecutor::TemplatedComposePositionsBuild(Vector &source, idx_t key_idx, idx_t count,
+                                                             idx_t *positions) {
+	if (perfect_join_statistics.key_mins[key_idx].IsNull() || perfect_join_statistics.key_maxes[key_idx].IsNull()) {
 		return false;
 	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+	auto min_value = perfect_join_statistics.key_mins[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.key_maxes[key_idx].GetValueUnsafe<T>();
+	const auto stride = perfect_join_statistics.key_strides[key_idx];
+	const auto invalid_position = perfect_join_statistics.build_range + 1;
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
 	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
+	// add this key to the composed position of each tuple
+	for (idx_t i = 0; i < count; ++i) {
+		if (positions[i] == invalid_position) {
+			continue;
+		}
 		auto data_idx = vector_data.sel->get_index(i);
 		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
 		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
+			// subtract the min value to get the dense position of this key, and add it at the key's stride
+			positions[i] += (idx_t)(input_value - min_value) * stride;
+		} else {
+			positions[i] = invalid_position;
 		}
 	}
 	return true;
@@ -144,6 +162,8 @@ public:
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
 	SelectionVector seq_sel_vec;
+	//! The composed dense position of each probe key
+	idx_t positions[STANDARD_VECTOR_SIZE];
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -160,11 +180,23 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	// fetch the join keys from the chunk
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
-	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
+	// compose the dense position of every probe key; keys outside of the build domain (or NULL) can never match
 	auto keys_count = state.join_keys.size();
+	const auto invalid_position = perfect_join_statistics.build_range + 1;
+	memset(state.positions, 0, sizeof(idx_t) * keys_count);
+	for (idx_t key_idx = 0; key_idx < state.join_keys.ColumnCount(); key_idx++) {
+		ComposePositionsSwitchProbe(state.join_keys.data[key_idx], key_idx, keys_count, state.positions);
+	}
+	// select the probe keys that have a match in the build
 	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	for (idx_t i = 0, sel_idx = 0; i < keys_count; ++i) {
+		auto idx = state.positions[i];
+		if (idx != invalid_position && bitmap_build_idx[idx]) {
+			state.build_sel_vec.set_index(sel_idx, idx);
+			state.probe_sel_vec.set_index(sel_idx++, i);
+			probe_sel_count++;
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -184,33 +216,32 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
+void PerfectHashJoinExecutor::ComposePositionsSwitchProbe(Vector &source, idx_t key_idx, idx_t count,
+                                                          idx_t *positions) {
 	switch (source.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<int8_t>(source, key_idx, count, positions);
 		break;
 	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<int16_t>(source, key_idx, count, positions);
 		break;
 	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<int32_t>(source, key_idx, count, positions);
 		break;
 	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<int64_t>(source, key_idx, count, positions);
 		break;
 	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<uint8_t>(source, key_idx, count, positions);
 		break;
 	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<uint16_t>(source, key_idx, count, positions);
 		break;
 	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<uint32_t>(source, key_idx, count, positions);
 		break;
 	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+		TemplatedComposePositionsProbe<uint64_t>(source, key_idx, count, positions);
 		break;
 	default:
 		throw NotImplementedException("Type not supported");
@@ -218,50 +249,51 @@ void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, Sel
 }
 
 template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+void PerfectHashJoinExecutor::TemplatedComposePositionsProbe(Vector &source, idx_t key_idx, idx_t count,
+                                                             idx_t *positions) {
+	auto min_value = perfect_join_statistics.key_mins[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.key_maxes[key_idx].GetValueUnsafe<T>();
+	const auto stride = perfect_join_statistics.key_strides[key_idx];
+	const auto invalid_position = perfect_join_statistics.build_range + 1;
 
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
 	auto data = reinterpret_cast<T *>(vector_data.data);
 	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
+	// add this key to the composed position of each probe tuple
 	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
+		for (idx_t i = 0; i < count; ++i) {
+			if (positions[i] == invalid_position) {
+				continue;
+			}
 			// retrieve value from vector
 			auto data_idx = vector_data.sel->get_index(i);
 			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
 			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
+				// subtract the min value to get the dense position of this key, and add it at the key's stride
+				positions[i] += (idx_t)(input_value - min_value) * stride;
+			} else {
+				positions[i] = invalid_position;
 			}
 		}
 	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
+		for (idx_t i = 0; i < count; ++i) {
+			if (positions[i] == invalid_position) {
+				continue;
+			}
 			// retrieve value from vector
 			auto data_idx = vector_data.sel->get_index(i);
 			if (!validity_mask->RowIsValid(data_idx)) {
+				// NULL values are never equal
+				positions[i] = invalid_position;
 				continue;
 			}
 			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
 			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
+				// subtract the min value to get the dense position of this key, and add it at the key's stride
+				positions[i] += (idx_t)(input_value - min_value) * stride;
+			} else {
+				positions[i] = invalid_position;
 			}
 		}
 	}
@@ -116,21 +116,126 @@ OperatorResultType CrossProductExecutor::Execute(DataChunk &input, DataChunk &ou
 
 class CrossProductOperatorState : public CachingOperatorState {
 public:
-	explicit CrossProductOperatorState(ColumnDataCollection &rhs) : executor(rhs) {
+	CrossProductOperatorState(ClientContext &context, ColumnDataCollection &rhs, const vector<LogicalType> &lhs_types)
+	    : rhs(rhs), lhs_buffer(context, lhs_types), position_in_chunk(0), scan_lhs_chunk(false), emitting(false) {
+		rhs.InitializeScanChunk(rhs_chunk);
+		lhs_buffer.InitializeScanChunk(lhs_chunk);
 	}
 
-	CrossProductExecutor executor;
+	//! Start pairing the buffered LHS tile with the RHS
+	void StartTile() {
+		emitting = true;
+		rhs.InitializeScan(rhs_scan_state);
+		rhs.Scan(rhs_scan_state, rhs_chunk);
+		lhs_buffer.InitializeScan(lhs_scan_state);
+		lhs_chunk.Reset();
+		position_in_chunk = 0;
+		scan_lhs_chunk = true;
+	}
+
+	//! Move to the next value to emit; returns false if the tile has been fully paired with the RHS
+	bool NextValue() {
+		position_in_chunk++;
+		idx_t chunk_size = scan_lhs_chunk ? lhs_chunk.size() : rhs_chunk.size();
+		if (position_in_chunk < chunk_size) {
+			return true;
+		}
+		// move to the next LHS chunk of the tile
+		lhs_buffer.Scan(lhs_scan_state, lhs_chunk);
+		if (lhs_chunk.size() == 0) {
+			// the whole tile has been paired with this RHS chunk: move to the next RHS chunk and rescan the tile
+			rhs.Scan(rhs_scan_state, rhs_chunk);
+			if (rhs_chunk.size() == 0) {
+				// the RHS is exhausted: the tile is done
+				emitting = false;
+				lhs_buffer.Reset();
+				return false;
+			}
+			lhs_buffer.InitializeScan(lhs_scan_state);
+			lhs_buffer.Scan(lhs_scan_state, lhs_chunk);
+		}
+		position_in_chunk = 0;
+		// iterate over the smaller of the two chunks one value at a time, so that we emit larger chunks
+		scan_lhs_chunk = lhs_chunk.size() < rhs_chunk.size();
+		return true;
+	}
+
+	//! Emit the current pair: one chunk is kept constantly referenced, a single value of the other is referenced as
+	//! a constant vector
+	void Emit(DataChunk &output) {
+		auto &constant_chunk = scan_lhs_chunk ? rhs_chunk : lhs_chunk;
+		auto &scan = scan_lhs_chunk ? lhs_chunk : rhs_chunk;
+		idx_t constant_offset = scan_lhs_chunk ? lhs_chunk.ColumnCount() : 0;
+		idx_t scan_offset = scan_lhs_chunk ? 0 : lhs_chunk.ColumnCount();
+		output.SetCardinality(constant_chunk.size());
+		for (idx_t i = 0; i < constant_chunk.ColumnCount(); i++) {
+			output.data[constant_offset + i].Reference(constant_chunk.data[i]);
+		}
+		for (idx_t i = 0; i < scan.ColumnCount(); i++) {
+			ConstantVector::Reference(output.data[scan_offset + i], scan.data[i], position_in_chunk, scan.size());
+		}
+	}
+
+	ColumnDataCollection &rhs;
+	//! The tile of buffered LHS chunks: while a tile is paired with the RHS it stays cache-resident, and the RHS is
+	//! only streamed once per tile instead of once per LHS chunk
+	ColumnDataCollection lhs_buffer;
+	ColumnDataScanState rhs_scan_state;
+	ColumnDataScanState lhs_scan_state;
+	DataChunk rhs_chunk;
+	DataChunk lhs_chunk;
+	idx_t position_in_chunk;
+	bool scan_lhs_chunk;
+	bool emitting;
 };
 
 unique_ptr<OperatorState> PhysicalCrossProduct::GetOperatorState(ExecutionContext &context) const {
 	auto &sink = (CrossProductGlobalState &)*sink_state;
-	return make_unique<CrossProductOperatorState>(sink.rhs_materialized);
+	return make_unique<CrossProductOperatorState>(context.client, sink.rhs_materialized, children[0]->GetTypes());
 }
 
 OperatorResultType PhysicalCrossProduct::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                          GlobalOperatorState &gstate, OperatorState &state_p) const {
 	auto &state = (CrossProductOperatorState &)state_p;
-	return state.executor.Execute(input, chunk);
+	if (state.rhs.Count() == 0) {
+		// no RHS: empty result
+		return OperatorResultType::FINISHED;
+	}
+	if (!state.emitting) {
+		// buffer the input chunk into the LHS tile
+		state.lhs_buffer.Append(input);
+		if (state.lhs_buffer.Count() < LHS_TILE_SIZE) {
+			// the tile is not full yet: fetch more input first
+			return OperatorResultType::NEED_MORE_INPUT;
+		}
+		state.StartTile();
+	}
+	if (!state.NextValue()) {
+		// the tile has been fully paired with the RHS: start buffering the next tile
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	state.Emit(chunk);
+	return OperatorResultType::HAVE_MORE_OUTPUT;
+}
+
+OperatorFinalizeResultType PhysicalCrossProduct::FinalExecuteInternal(ExecutionContext &context, DataChunk &chunk,
+                                                                      GlobalOperatorState &gstate,
+                                                                      OperatorState &state_p) const {
+	auto &state = (CrossProductOperatorState &)state_p;
+	if (state.rhs.Count() == 0 || (!state.emitting && state.lhs_buffer.Count() == 0)) {
+		chunk.SetCardinality(0);
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	if (!state.emitting) {
+		// pair the remaining partially filled tile with the RHS
+		state.StartTile();
+	}
+	if (!state.NextValue()) {
+		chunk.SetCardinality(0);
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	state.Emit(chunk);
+	return OperatorFinalizeResultType::HAVE_MORE_OUTPUT;
 }
 
 //===--------------------------------------------------------------------===//
@@ -3,6 +3,11 @@
 #include "duckdb/common/types/column_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -36,6 +41,179 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
 	if (join_type != JoinType::ANTI && join_type != JoinType::SEMI && join_type != JoinType::MARK) {
 		build_types = LogicalOperator::MapTypes(children[1]->GetTypes(), right_projection_map);
 	}
+
+	InitializeProbeFilterScan();
+}
+
+static bool CanPushJoinFilter(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::ENUM) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void PhysicalHashJoin::InitializeProbeFilterScan() {
+	// for these join types non-matching probe rows are never part of the result, so the probe-side scan may be
+	// filtered down to the [min, max] range of the build keys once the build side is known
+	if (join_type != JoinType::INNER && join_type != JoinType::RIGHT && join_type != JoinType::SEMI) {
+		return;
+	}
+	if (children[0]->type != PhysicalOperatorType::TABLE_SCAN) {
+		return;
+	}
+	auto &scan = (PhysicalTableScan &)*children[0];
+	if (!scan.function.filter_pushdown) {
+		return;
+	}
+	for (idx_t i = 0; i < conditions.size(); i++) {
+		auto &condition = conditions[i];
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		if (condition.left->type != ExpressionType::BOUND_REF || !CanPushJoinFilter(condition.left->return_type)) {
+			continue;
+		}
+		auto &ref = (BoundReferenceExpression &)*condition.left;
+		// map the probe column back to the scan's column index
+		auto scan_column = scan.projection_ids.empty() ? ref.index : scan.projection_ids[ref.index];
+		if (scan_column >= scan.column_ids.size() || scan.column_ids[scan_column] == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		probe_filter_columns.emplace_back(i, scan_column);
+	}
+	if (probe_filter_columns.empty()) {
+		return;
+	}
+	probe_filter_scan = &scan;
+	if (!scan.table_filters) {
+		// the filter set must exist before the scan is initialized, as the scan state keeps a pointer to it
+		scan.table_filters = make_unique<TableFilterSet>();
+	}
+	// register a conjunction per pushed filter that is filled in once the build completes. NULL probe keys can
+	// never match for these join types, so the conjunction starts out as a (valid, non-empty) IS NOT NULL filter.
+	for (auto &entry : probe_filter_columns) {
+		auto filter = make_unique<ConjunctionAndFilter>();
+		filter->child_filters.push_back(make_unique<IsNotNullFilter>());
+		probe_filter_nodes.push_back(filter.get());
+		scan.table_filters->PushFilter(entry.second, std::move(filter));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sideways information passing
+//===--------------------------------------------------------------------===//
+static Value JoinFilterValue(const LogicalType &type, int8_t value) {
+	return Value::Numeric(type, value);
+}
+static Value JoinFilterValue(const LogicalType &type, int16_t value) {
+	return Value::Numeric(type, value);
+}
+static Value JoinFilterValue(const LogicalType &type, int32_t value) {
+	return Value::Numeric(type, value);
+}
+static Value JoinFilterValue(const LogicalType &type, int64_t value) {
+	return Value::Numeric(type, value);
+}
+static Value JoinFilterValue(const LogicalType &type, uint8_t value) {
+	return Value::Numeric(type, (int64_t)value);
+}
+static Value JoinFilterValue(const LogicalType &type, uint16_t value) {
+	return Value::Numeric(type, (int64_t)value);
+}
+static Value JoinFilterValue(const LogicalType &type, uint32_t value) {
+	return Value::Numeric(type, (int64_t)value);
+}
+static Value JoinFilterValue(const LogicalType &type, hugeint_t value) {
+	return Value::Numeric(type, value);
+}
+static Value JoinFilterValue(const LogicalType &type, float value) {
+	return Value::FLOAT(value);
+}
+static Value JoinFilterValue(const LogicalType &type, double value) {
+	return Value::DOUBLE(value);
+}
+
+template <class T>
+static void TemplatedJoinFilterMinMax(UnifiedVectorFormat &vdata, idx_t count, const LogicalType &type, Value &min_val,
+                                      Value &max_val) {
+	auto data = (T *)vdata.data;
+	bool has_value = !min_val.IsNull();
+	T min_v = has_value ? min_val.GetValueUnsafe<T>() : T();
+	T max_v = has_value ? max_val.GetValueUnsafe<T>() : T();
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto value = data[idx];
+		if (!has_value) {
+			min_v = max_v = value;
+			has_value = true;
+		} else if (LessThan::Operation(value, min_v)) {
+			min_v = value;
+		} else if (GreaterThan::Operation(value, max_v)) {
+			max_v = value;
+		}
+	}
+	if (!has_value) {
+		return;
+	}
+	min_val = JoinFilterValue(type, min_v);
+	max_val = JoinFilterValue(type, max_v);
+}
+
+static void UpdateJoinFilterMinMax(Vector &keys, idx_t count, Value &min_val, Value &max_val) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto &type = keys.GetType();
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedJoinFilterMinMax<int8_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::INT16:
+		TemplatedJoinFilterMinMax<int16_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::INT32:
+		TemplatedJoinFilterMinMax<int32_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::INT64:
+		TemplatedJoinFilterMinMax<int64_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedJoinFilterMinMax<uint8_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedJoinFilterMinMax<uint16_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedJoinFilterMinMax<uint32_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::INT128:
+		TemplatedJoinFilterMinMax<hugeint_t>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedJoinFilterMinMax<float>(vdata, count, type, min_val, max_val);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedJoinFilterMinMax<double>(vdata, count, type, min_val, max_val);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter min/max");
+	}
 }
 
 PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
@@ -59,7 +237,7 @@ public:
 		// for external hash join
 		external = op.can_go_external && ClientConfig::GetConfig(context).force_external;
 		// memory usage per thread scales with max mem / num threads
-		double max_memory = BufferManager::GetBufferManager(context).GetMaxMemory();
+		double max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory(context);
 		double num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
 		// HT may not exceed 60% of memory
 		max_ht_size = max_memory * 0.6;
@@ -69,6 +247,11 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+		// initialize the build-key min/max values for the pushed probe filters (if any)
+		for (auto &entry : op.probe_filter_columns) {
+			filter_mins.emplace_back(op.condition_types[entry.first]);
+			filter_maxs.emplace_back(op.condition_types[entry.first]);
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -98,6 +281,10 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! Per pushed probe filter: the min/max of all build keys (NULL until a value has been seen)
+	vector<Value> filter_mins;
+	vector<Value> filter_maxs;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -113,6 +300,11 @@ public:
 		join_keys.Initialize(allocator, op.condition_types);
 
 		hash_table = op.InitializeHashTable(context);
+
+		for (auto &entry : op.probe_filter_columns) {
+			filter_mins.emplace_back(op.condition_types[entry.first]);
+			filter_maxs.emplace_back(op.condition_types[entry.first]);
+		}
 	}
 
 public:
@@ -122,6 +314,10 @@ public:
 
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
+
+	//! Per pushed probe filter: the min/max of the build keys seen by this thread
+	vector<Value> filter_mins;
+	vector<Value> filter_maxs;
 };
 
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
@@ -191,6 +387,11 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, GlobalSinkState
 	// resolve the join keys for the right chunk
 	lstate.join_keys.Reset();
 	lstate.build_executor.Execute(input, lstate.join_keys);
+	// update the build-key min/max for the probe filters we push once the build completes
+	for (idx_t i = 0; i < probe_filter_columns.size(); i++) {
+		auto &key = lstate.join_keys.data[probe_filter_columns[i].first];
+		UpdateJoinFilterMinMax(key, lstate.join_keys.size(), lstate.filter_mins[i], lstate.filter_maxs[i]);
+	}
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (!right_projection_map.empty()) {
@@ -227,6 +428,20 @@ void PhysicalHashJoin::Combine(ExecutionContext &context, GlobalSinkState &gstat
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	}
+	if (!probe_filter_columns.empty()) {
+		lock_guard<mutex> filter_lock(gstate.lock);
+		for (idx_t i = 0; i < probe_filter_columns.size(); i++) {
+			if (lstate.filter_mins[i].IsNull()) {
+				continue;
+			}
+			if (gstate.filter_mins[i].IsNull() || ValueOperations::LessThan(lstate.filter_mins[i], gstate.filter_mins[i])) {
+				gstate.filter_mins[i] = lstate.filter_mins[i];
+			}
+			if (gstate.filter_maxs[i].IsNull() || ValueOperations::GreaterThan(lstate.filter_maxs[i], gstate.filter_maxs[i])) {
+				gstate.filter_maxs[i] = lstate.filter_maxs[i];
+			}
+		}
+	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(this, &lstate.build_executor, "build_executor", 1);
 	client_profiler.Flush(context.thread.profiler);
@@ -239,20 +454,34 @@ class HashJoinFinalizeTask : public ExecutorTask {
 public:
 	HashJoinFinalizeTask(shared_ptr<Event> event_p, ClientContext &context, HashJoinGlobalSinkState &sink,
 	                     idx_t block_idx_start, idx_t block_idx_end, bool parallel)
-	    : ExecutorTask(context), event(std::move(event_p)), sink(sink), block_idx_start(block_idx_start),
+	    : ExecutorTask(context), event(std::move(event_p)), sink(sink), block_idx(block_idx_start),
 	      block_idx_end(block_idx_end), parallel(parallel) {
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
-		sink.hash_table->Finalize(block_idx_start, block_idx_end, parallel);
+		if (mode == TaskExecutionMode::PROCESS_PARTIAL) {
+			// finalize a bounded number of blocks per quantum, so the scheduler can interleave other tasks
+			auto quantum_end = MinValue<idx_t>(block_idx + BLOCKS_PER_QUANTUM, block_idx_end);
+			sink.hash_table->Finalize(block_idx, quantum_end, parallel);
+			block_idx = quantum_end;
+			if (block_idx < block_idx_end) {
+				return TaskExecutionResult::TASK_NOT_FINISHED;
+			}
+		} else {
+			sink.hash_table->Finalize(block_idx, block_idx_end, parallel);
+		}
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
 
 private:
+	//! The number of blocks that are finalized per quantum in partial execution mode
+	static constexpr const idx_t BLOCKS_PER_QUANTUM = 64;
+
 	shared_ptr<Event> event;
 	HashJoinGlobalSinkState &sink;
-	idx_t block_idx_start;
+	//! The next block to finalize
+	idx_t block_idx;
 	idx_t block_idx_end;
 	bool parallel;
 };
@@ -279,20 +508,18 @@ public:
 			finalize_tasks.push_back(
 			    make_unique<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0, num_blocks, false));
 		} else {
-			// Parallel finalize
+			// Parallel finalize: schedule several tasks per thread so a slow task cannot serialize the tail
 			idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
-			auto blocks_per_thread = MaxValue<idx_t>((num_blocks + num_threads - 1) / num_threads, 1);
+			auto num_tasks = num_threads * FINALIZE_TASKS_PER_THREAD;
+			auto blocks_per_task = MaxValue<idx_t>((num_blocks + num_tasks - 1) / num_tasks, 1);
 
 			idx_t block_idx = 0;
-			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+			while (block_idx < num_blocks) {
 				auto block_idx_start = block_idx;
-				auto block_idx_end = MinValue<idx_t>(block_idx_start + blocks_per_thread, num_blocks);
+				auto block_idx_end = MinValue<idx_t>(block_idx_start + blocks_per_task, num_blocks);
 				finalize_tasks.push_back(make_unique<HashJoinFinalizeTask>(shared_from_this(), context, sink,
 				                                                           block_idx_start, block_idx_end, true));
 				block_idx = block_idx_end;
-				if (block_idx == num_blocks) {
-					break;
-				}
 			}
 		}
 		SetTasks(std::move(finalize_tasks));
@@ -303,6 +530,9 @@ public:
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
+	//! The number of finalize tasks that are created per thread, so that threads that finish their share early can
+	//! pick up remaining work instead of idling until the slowest task completes
+	static constexpr const idx_t FINALIZE_TASKS_PER_THREAD = 4;
 };
 
 void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event) {
@@ -375,6 +605,25 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
                                             GlobalSinkState &gstate) const {
 	auto &sink = (HashJoinGlobalSinkState &)gstate;
 
+	if (probe_filter_scan) {
+		// sideways information passing: fill the probe-side scan filters with the [min, max] of the build keys, so
+		// that zone-map pruning can skip probe row groups. The probe pipeline depends on this one and has not
+		// started executing yet; the scan state holds a pointer to the filter set we modify here.
+		for (idx_t i = 0; i < probe_filter_columns.size(); i++) {
+			auto &filter = *probe_filter_nodes[i];
+			filter.child_filters.clear();
+			filter.child_filters.push_back(make_unique<IsNotNullFilter>());
+			if (sink.filter_mins[i].IsNull()) {
+				// no non-NULL build keys were seen: nothing can match, the NOT NULL filter alone is kept
+				continue;
+			}
+			filter.child_filters.push_back(
+			    make_unique<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, sink.filter_mins[i]));
+			filter.child_filters.push_back(
+			    make_unique<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, sink.filter_maxs[i]));
+		}
+	}
+
 	if (sink.external) {
 		D_ASSERT(can_go_external);
 		// External join - partition HT
@@ -394,9 +643,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
-		D_ASSERT(sink.hash_table->equality_types.size() == 1);
-		auto key_type = sink.hash_table->equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable();
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
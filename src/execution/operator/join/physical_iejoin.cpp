@@ -12,6 +12,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 
+#include <algorithm>
 #include <thread>
 
 namespace duckdb {
@@ -776,8 +777,8 @@ void PhysicalIEJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &ch
 class IEJoinGlobalSourceState : public GlobalSourceState {
 public:
 	explicit IEJoinGlobalSourceState(const PhysicalIEJoin &op)
-	    : op(op), initialized(false), next_pair(0), completed(0), left_outers(0), next_left(0), right_outers(0),
-	      next_right(0) {
+	    : op(op), initialized(false), next_pair(0), completed(0), total_pairs(0), left_outers(0), next_left(0),
+	      right_outers(0), next_right(0) {
 	}
 
 	void Initialize(IEJoinGlobalState &sink_state) {
@@ -805,6 +806,42 @@ public:
 			right_base += right_table.BlockSize(rhs);
 		}
 
+		// Compute the set of block pairs that can produce matches.
+		// Both tables are sorted on the first condition, so for each left block the right blocks whose key range
+		// overlaps it form a suffix of the right block list, and the start of that suffix only moves forward as we
+		// advance through the left blocks. This way we only schedule the overlapping pairs instead of the full
+		// pairwise block matrix.
+		if (left_blocks && right_blocks) {
+			pair_offsets.reserve(left_blocks + 1);
+			first_right.reserve(left_blocks);
+			idx_t overlap_start = 0;
+			const auto &cmp = op.conditions[0].comparison;
+			SBIterator bounds1(left_table.global_sort_state, cmp);
+			SBIterator bounds2(right_table.global_sort_state, cmp);
+			for (idx_t b1 = 0; b1 < left_blocks; ++b1) {
+				pair_offsets.emplace_back(total_pairs);
+				auto block_start = right_blocks;
+				if (left_table.BlockSize(b1)) {
+					// t1.X[0] op1 t2.X'[-1], as in the IEJoinUnion construction
+					bounds1.SetIndex(bounds1.block_capacity * b1);
+					while (overlap_start < right_blocks) {
+						const auto right_size = right_table.BlockSize(overlap_start);
+						if (right_size) {
+							bounds2.SetIndex(bounds2.block_capacity * overlap_start + right_size - 1);
+							if (bounds1.Compare(bounds2)) {
+								break;
+							}
+						}
+						++overlap_start;
+					}
+					block_start = overlap_start;
+				}
+				first_right.emplace_back(block_start);
+				total_pairs += right_blocks - block_start;
+			}
+			pair_offsets.emplace_back(total_pairs);
+		}
+
 		// Outer join block counts
 		if (left_table.found_match) {
 			left_outers = left_blocks;
@@ -829,15 +866,13 @@ public:
 		auto &left_table = *gstate.tables[0];
 		auto &right_table = *gstate.tables[1];
 
-		const auto left_blocks = left_table.BlockCount();
-		const auto right_blocks = right_table.BlockCount();
-		const auto pair_count = left_blocks * right_blocks;
-
 		// Regular block
 		const auto i = next_pair++;
-		if (i < pair_count) {
-			const auto b1 = i / right_blocks;
-			const auto b2 = i % right_blocks;
+		if (i < total_pairs) {
+			// Find the left block of this pair from the prefix sums
+			auto entry = std::upper_bound(pair_offsets.begin(), pair_offsets.end(), i);
+			const auto b1 = idx_t(entry - pair_offsets.begin()) - 1;
+			const auto b2 = first_right[b1] + (i - pair_offsets[b1]);
 
 			lstate.left_block_index = b1;
 			lstate.left_base = left_bases[b1];
@@ -857,7 +892,7 @@ public:
 		}
 
 		// Spin wait for regular blocks to finish(!)
-		while (completed < pair_count) {
+		while (completed < total_pairs) {
 			std::this_thread::yield();
 		}
 
@@ -911,6 +946,14 @@ public:
 	vector<idx_t> left_bases;
 	vector<idx_t> right_bases;
 
+	// Overlapping block pairs
+	//! For each left block, the first right block whose key range overlaps it
+	vector<idx_t> first_right;
+	//! Prefix sums of the number of overlapping pairs per left block
+	vector<idx_t> pair_offsets;
+	//! The total number of overlapping block pairs
+	idx_t total_pairs;
+
 	// Outer joins
 	idx_t left_outers;
 	std::atomic<idx_t> next_left;
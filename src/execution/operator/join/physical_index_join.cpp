@@ -12,6 +12,8 @@
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
 class IndexJoinOperatorState : public CachingOperatorState {
@@ -30,6 +32,8 @@ public:
 			rhs_chunk.Initialize(allocator, op.fetch_types);
 		}
 		rhs_sel.Initialize(STANDARD_VECTOR_SIZE);
+		fetch_sel.Initialize(STANDARD_VECTOR_SIZE);
+		probe_order.reserve(STANDARD_VECTOR_SIZE);
 	}
 
 	bool first_fetch = true;
@@ -40,6 +44,10 @@ public:
 	DataChunk join_keys;
 	DataChunk rhs_chunk;
 	SelectionVector rhs_sel;
+	//! Maps each fetched row back to its position in the row-id-sorted fetch
+	SelectionVector fetch_sel;
+	//! The probe order of the current chunk, sorted by key
+	vector<idx_t> probe_order;
 
 	//! Vector of rows that mush be fetched for every LHS key
 	vector<vector<row_t>> rhs_rows;
@@ -126,9 +134,22 @@ void PhysicalIndexJoin::Output(ExecutionContext &context, DataChunk &input, Data
 		if (fetch_rows.empty()) {
 			return;
 		}
+		//! Fetch the rows in increasing row-id order, so the base-table fetch walks the row groups sequentially,
+		//! and restore the output order afterwards through a selection vector
+		vector<idx_t> fetch_order(fetch_rows.size());
+		for (idx_t i = 0; i < fetch_order.size(); i++) {
+			fetch_order[i] = i;
+		}
+		std::sort(fetch_order.begin(), fetch_order.end(),
+		          [&fetch_rows](idx_t lhs, idx_t rhs) { return fetch_rows[lhs] < fetch_rows[rhs]; });
+		vector<row_t> sorted_rows(fetch_rows.size());
+		for (idx_t i = 0; i < fetch_order.size(); i++) {
+			sorted_rows[i] = fetch_rows[fetch_order[i]];
+			state.fetch_sel.set_index(fetch_order[i], i);
+		}
 		state.rhs_chunk.Reset();
 		state.fetch_state = make_unique<ColumnFetchState>();
-		Vector row_ids(LogicalType::ROW_TYPE, (data_ptr_t)&fetch_rows[0]);
+		Vector row_ids(LogicalType::ROW_TYPE, (data_ptr_t)&sorted_rows[0]);
 		tbl->Fetch(transaction, state.rhs_chunk, fetch_ids, row_ids, output_sel_idx, *state.fetch_state);
 	}
 
@@ -139,7 +160,7 @@ void PhysicalIndexJoin::Output(ExecutionContext &context, DataChunk &input, Data
 	for (idx_t i = 0; i < right_projection_map.size(); i++) {
 		auto it = index_ids.find(column_ids[right_projection_map[i]]);
 		if (it == index_ids.end()) {
-			chunk.data[right_offset + i].Reference(state.rhs_chunk.data[rhs_column_idx++]);
+			chunk.data[right_offset + i].Slice(state.rhs_chunk.data[rhs_column_idx++], state.fetch_sel, output_sel_idx);
 		} else {
 			chunk.data[right_offset + i].Slice(state.join_keys.data[0], state.rhs_sel, output_sel_idx);
 		}
@@ -161,24 +182,42 @@ void PhysicalIndexJoin::GetRHSMatches(ExecutionContext &context, DataChunk &inpu
 	state.arena_allocator.Reset();
 	ART::GenerateKeys(state.arena_allocator, state.join_keys, state.keys);
 
+	//! Probe the ART in sorted key order: adjacent probes then traverse largely the same tree path, and duplicate
+	//! keys (common in foreign-key joins) reuse the previous probe's result outright
+	auto &probe_order = state.probe_order;
+	probe_order.clear();
 	for (idx_t i = 0; i < input.size(); i++) {
-		state.rhs_rows[i].clear();
 		if (!state.keys[i].Empty()) {
-			if (fetch_types.empty()) {
-				IndexLock lock;
-				index->InitializeLock(lock);
-				art.SearchEqualJoinNoFetch(state.keys[i], state.result_sizes[i]);
-			} else {
-				IndexLock lock;
-				index->InitializeLock(lock);
-				art.SearchEqual(state.keys[i], (idx_t)-1, state.rhs_rows[i]);
-				state.result_sizes[i] = state.rhs_rows[i].size();
-			}
+			probe_order.push_back(i);
 		} else {
 			//! This is null so no matches
 			state.result_sizes[i] = 0;
 		}
 	}
+	std::sort(probe_order.begin(), probe_order.end(),
+	          [&state](idx_t lhs, idx_t rhs) { return state.keys[lhs] < state.keys[rhs]; });
+
+	IndexLock lock;
+	index->InitializeLock(lock);
+	idx_t previous = DConstants::INVALID_INDEX;
+	for (auto probe_idx : probe_order) {
+		if (previous != DConstants::INVALID_INDEX && state.keys[probe_idx] == state.keys[previous]) {
+			//! Same key as the previous probe: reuse its result
+			state.result_sizes[probe_idx] = state.result_sizes[previous];
+			if (!fetch_types.empty()) {
+				state.rhs_rows[probe_idx] = state.rhs_rows[previous];
+			}
+			continue;
+		}
+		if (fetch_types.empty()) {
+			art.SearchEqualJoinNoFetch(state.keys[probe_idx], state.result_sizes[probe_idx]);
+		} else {
+			state.rhs_rows[probe_idx].clear();
+			art.SearchEqual(state.keys[probe_idx], (idx_t)-1, state.rhs_rows[probe_idx]);
+			state.result_sizes[probe_idx] = state.rhs_rows[probe_idx].size();
+		}
+		previous = probe_idx;
+	}
 	for (idx_t i = input.size(); i < STANDARD_VECTOR_SIZE; i++) {
 		//! No LHS chunk value so result size is empty
 		state.result_sizes[i] = 0;
@@ -1,4 +1,6 @@
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -236,6 +238,10 @@ public:
 		right_condition.Initialize(allocator, condition_types);
 		right_payload.Initialize(allocator, op.children[1]->GetTypes());
 		left_outer.Initialize(STANDARD_VECTOR_SIZE);
+		if (conditions.size() > 1) {
+			// multiple conditions: reorder their evaluation based on the observed runtime
+			adaptive_filter = make_unique<AdaptiveFilter>(conditions.size());
+		}
 	}
 
 	bool fetch_next_left;
@@ -253,6 +259,8 @@ public:
 	idx_t right_tuple;
 
 	OuterJoinMarker left_outer;
+	//! Adaptively reorders the join conditions (only set if there are multiple conditions)
+	unique_ptr<AdaptiveFilter> adaptive_filter;
 
 public:
 	void Finalize(PhysicalOperator *op, ExecutionContext &context) override {
@@ -384,8 +392,15 @@ OperatorResultType PhysicalNestedLoopJoin::ResolveComplexJoin(ExecutionContext &
 
 		// now perform the join
 		SelectionVector lvector(STANDARD_VECTOR_SIZE), rvector(STANDARD_VECTOR_SIZE);
+		auto start_time = high_resolution_clock::now();
 		match_count = NestedLoopJoinInner::Perform(state.left_tuple, state.right_tuple, state.left_condition,
-		                                           right_condition, lvector, rvector, conditions);
+		                                           right_condition, lvector, rvector, conditions,
+		                                           state.adaptive_filter.get());
+		if (state.adaptive_filter) {
+			auto end_time = high_resolution_clock::now();
+			state.adaptive_filter->AdaptRuntimeStatistics(
+			    duration_cast<duration<double>>(end_time - start_time).count());
+		}
 		// we have finished resolving the join conditions
 		if (match_count > 0) {
 			// we have matching tuples!
@@ -220,6 +220,9 @@ public:
 	DataChunk rhs_input;
 	ExpressionExecutor rhs_executor;
 	vector<BufferHandle> payload_heap_handles;
+	//! Scan state that keeps the next right-hand sorting block pinned while the current one is being joined,
+	//! so an external sort streams its blocks back in before they are needed
+	unique_ptr<SBScanState> rhs_readahead;
 
 public:
 	void ResolveJoinKeys(DataChunk &input) {
@@ -228,8 +231,11 @@ public:
 		lhs_local_table = make_unique<LocalSortedTable>(context, op, 0);
 		lhs_local_table->Sink(input, *lhs_global_state);
 
-		// Set external (can be forced with the PRAGMA)
-		lhs_global_state->external = force_external;
+		// Set external (can be forced with the PRAGMA). The RHS sort may have gone external on its own if it did
+		// not fit in memory, and the comparison routines require both sides to agree on whether blob data is
+		// swizzled, so follow the RHS here.
+		auto &rhs_sort = ((MergeJoinGlobalState &)*op.sink_state).table->global_sort_state;
+		lhs_global_state->external = force_external || rhs_sort.external;
 		lhs_global_state->AddLocalState(lhs_local_table->local_sort_state);
 		lhs_global_state->PrepareMergePhase();
 		while (lhs_global_state->sorted_blocks.size() > 1) {
@@ -359,16 +365,25 @@ static idx_t MergeJoinSimpleBlocks(PiecewiseMergeJoinState &lstate, MergeJoinGlo
 
 		// now we start from the current lpos value and check if we found a new value that is [<= OR <] the max RHS
 		// value
-		while (true) {
-			int comp_res;
-			if (all_constant) {
-				comp_res = FastMemcmp(l_ptr, r_ptr, cmp_size);
-			} else {
-				lread.entry_idx = l_entry_idx;
-				rread.entry_idx = r_entry_idx;
-				comp_res = Comparators::CompareTuple(lread, rread, l_ptr, r_ptr, lsort.sort_layout, external);
+		if (all_constant) {
+			// fixed-width keys: find the end of the matching LHS prefix with a galloping search and mark it in bulk
+			const auto l_base = l_ptr - l_entry_idx * entry_size;
+			const auto l_bound = PhysicalRangeJoin::GallopingBound(l_base, entry_size, cmp_size, r_ptr, l_entry_idx,
+			                                                       lhs_not_null, cmp);
+			for (; l_entry_idx < l_bound; l_entry_idx++) {
+				found_match[l_entry_idx] = true;
 			}
-
+			l_ptr = l_base + l_entry_idx * entry_size;
+			if (l_entry_idx >= lhs_not_null) {
+				// early out: we exhausted the entire LHS and they all match
+				return 0;
+			}
+			continue;
+		}
+		while (true) {
+			lread.entry_idx = l_entry_idx;
+			rread.entry_idx = r_entry_idx;
+			int comp_res = Comparators::CompareTuple(lread, rread, l_ptr, r_ptr, lsort.sort_layout, external);
 			if (comp_res <= cmp) {
 				// found a match for lpos, set it in the found_match vector
 				found_match[l_entry_idx] = true;
@@ -469,17 +484,43 @@ static idx_t MergeJoinComplexBlocks(BlockMergeInfo &l, BlockMergeInfo &r, const
 	const auto entry_size = l.state.sort_layout.entry_size;
 
 	idx_t result_count = 0;
+	if (all_constant) {
+		// fixed-width keys: for every RHS entry the matching LHS entries form a prefix of the sorted LHS, and that
+		// prefix only grows as the RHS advances. Find the end of the prefix with a galloping search and emit the
+		// pairs without any further comparisons.
+		auto l_bound =
+		    PhysicalRangeJoin::GallopingBound(l_start, entry_size, cmp_size, r_ptr, l.entry_idx, l.not_null, cmp);
+		while (true) {
+			// emit the remaining pairs of the current RHS entry
+			const auto to_emit = MinValue<idx_t>(l_bound - l.entry_idx, STANDARD_VECTOR_SIZE - result_count);
+			for (idx_t i = 0; i < to_emit; i++) {
+				l.result.set_index(result_count, sel_t(l.entry_idx));
+				r.result.set_index(result_count, sel_t(r.entry_idx));
+				result_count++;
+				l.entry_idx++;
+			}
+			if (result_count == STANDARD_VECTOR_SIZE) {
+				// out of space!
+				break;
+			}
+			// move the right pointer forward and reset the left side to the start
+			r.entry_idx++;
+			if (r.entry_idx >= r.not_null) {
+				break;
+			}
+			r_ptr += entry_size;
+			l.entry_idx = 0;
+			// the bound of the previous RHS entry is a lower bound for the new one
+			l_bound =
+			    PhysicalRangeJoin::GallopingBound(l_start, entry_size, cmp_size, r_ptr, l_bound, l.not_null, cmp);
+		}
+		return result_count;
+	}
 	while (true) {
 		if (l.entry_idx < l.not_null) {
-			int comp_res;
-			if (all_constant) {
-				comp_res = FastMemcmp(l_ptr, r_ptr, cmp_size);
-			} else {
-				lread.entry_idx = l.entry_idx;
-				rread.entry_idx = r.entry_idx;
-				comp_res = Comparators::CompareTuple(lread, rread, l_ptr, r_ptr, l.state.sort_layout, external);
-			}
-
+			lread.entry_idx = l.entry_idx;
+			rread.entry_idx = r.entry_idx;
+			int comp_res = Comparators::CompareTuple(lread, rread, l_ptr, r_ptr, l.state.sort_layout, external);
 			if (comp_res <= cmp) {
 				// left side smaller: found match
 				l.result.set_index(result_count, sel_t(l.entry_idx));
@@ -552,6 +593,18 @@ OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionConte
 		BlockMergeInfo right_info(gstate.table->global_sort_state, state.right_chunk_index, state.right_position,
 		                          rhs_not_null);
 
+		// Readahead: pin the right-hand block after the current one so an external sort
+		// reads it back from disk while the current block is being joined
+		auto &rhs_sort = gstate.table->global_sort_state;
+		const auto next_right = state.right_chunk_index + 1;
+		if (rhs_sort.external && next_right < rsorted.radix_sorting_data.size()) {
+			if (!state.rhs_readahead) {
+				state.rhs_readahead = make_unique<SBScanState>(rhs_sort.buffer_manager, rhs_sort);
+				state.rhs_readahead->sb = &rsorted;
+			}
+			MergeJoinPinSortingBlock(*state.rhs_readahead, next_right);
+		}
+
 		idx_t result_count = MergeJoinComplexBlocks(left_info, right_info, conditions[0].comparison);
 		if (result_count == 0) {
 			// exhausted this chunk on the right side
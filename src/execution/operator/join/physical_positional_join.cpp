@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/join/physical_positional_join.hpp"
 
+#include "duckdb/common/types/batched_data_collection.hpp"
 #include "duckdb/common/types/column_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/operator/join/physical_join.hpp"
@@ -11,6 +12,7 @@ PhysicalPositionalJoin::PhysicalPositionalJoin(vector<LogicalType> types, unique
     : PhysicalOperator(PhysicalOperatorType::POSITIONAL_JOIN, std::move(types), estimated_cardinality) {
 	children.push_back(std::move(left));
 	children.push_back(std::move(right));
+	rhs_has_batch_index = children[1]->AllSourcesSupportBatchIndex();
 }
 
 //===--------------------------------------------------------------------===//
@@ -19,11 +21,14 @@ PhysicalPositionalJoin::PhysicalPositionalJoin(vector<LogicalType> types, unique
 class PositionalJoinGlobalState : public GlobalSinkState {
 public:
 	explicit PositionalJoinGlobalState(ClientContext &context, const PhysicalPositionalJoin &op)
-	    : rhs(context, op.children[1]->GetTypes()), initialized(false), source_offset(0), exhausted(false) {
+	    : rhs(context, op.children[1]->GetTypes()), batches(op.children[1]->GetTypes()), initialized(false),
+	      source_offset(0), exhausted(false) {
 		rhs.InitializeAppend(append_state);
 	}
 
 	ColumnDataCollection rhs;
+	//! The partial RHS collections when sinking in parallel, ordered by batch index; merged into rhs on Finalize
+	BatchedDataCollection batches;
 	ColumnDataAppendState append_state;
 	mutex rhs_lock;
 
@@ -40,18 +45,60 @@ public:
 	void GetData(DataChunk &output);
 };
 
+class PositionalJoinLocalState : public LocalSinkState {
+public:
+	explicit PositionalJoinLocalState(const PhysicalPositionalJoin &op) : batches(op.children[1]->GetTypes()) {
+	}
+
+	//! Thread-local RHS chunks, partitioned by batch index to preserve the positional order
+	BatchedDataCollection batches;
+};
+
 unique_ptr<GlobalSinkState> PhysicalPositionalJoin::GetGlobalSinkState(ClientContext &context) const {
 	return make_unique<PositionalJoinGlobalState>(context, *this);
 }
 
+unique_ptr<LocalSinkState> PhysicalPositionalJoin::GetLocalSinkState(ExecutionContext &context) const {
+	return make_unique<PositionalJoinLocalState>(*this);
+}
+
 SinkResultType PhysicalPositionalJoin::Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate_p,
                                             DataChunk &input) const {
 	auto &sink = (PositionalJoinGlobalState &)state;
-	lock_guard<mutex> client_guard(sink.rhs_lock);
-	sink.rhs.Append(sink.append_state, input);
+	if (rhs_has_batch_index) {
+		// parallel sink: collect the chunks per batch index so they can be merged back in source order
+		auto &lstate = (PositionalJoinLocalState &)lstate_p;
+		D_ASSERT(lstate.batch_index != DConstants::INVALID_INDEX);
+		lstate.batches.Append(input, lstate.batch_index);
+	} else {
+		lock_guard<mutex> client_guard(sink.rhs_lock);
+		sink.rhs.Append(sink.append_state, input);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalPositionalJoin::Combine(ExecutionContext &context, GlobalSinkState &state,
+                                     LocalSinkState &lstate_p) const {
+	if (!rhs_has_batch_index) {
+		return;
+	}
+	auto &sink = (PositionalJoinGlobalState &)state;
+	auto &lstate = (PositionalJoinLocalState &)lstate_p;
+	lock_guard<mutex> client_guard(sink.rhs_lock);
+	sink.batches.Merge(lstate.batches);
+}
+
+SinkFinalizeType PhysicalPositionalJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                  GlobalSinkState &state) const {
+	auto &sink = (PositionalJoinGlobalState &)state;
+	if (rhs_has_batch_index) {
+		// stitch the batches together in batch index order and hand them to the probe side
+		auto collection = sink.batches.FetchCollection();
+		sink.rhs.Combine(*collection);
+	}
+	return SinkFinalizeType::READY;
+}
+
 //===--------------------------------------------------------------------===//
 // Operator
 //===--------------------------------------------------------------------===//
@@ -318,6 +318,29 @@ BufferHandle PhysicalRangeJoin::SliceSortedPayload(DataChunk &payload, GlobalSor
 	return std::move(read_state.payload_heap_handle);
 }
 
+idx_t PhysicalRangeJoin::GallopingBound(data_ptr_t keys, const idx_t entry_size, const idx_t cmp_size,
+                                        data_ptr_t key, idx_t lo, idx_t hi, const int cmp) {
+	// exponential probes: double the step size until we find an entry that no longer matches
+	idx_t probe_idx = lo;
+	idx_t step = 1;
+	while (probe_idx < hi && FastMemcmp(keys + probe_idx * entry_size, key, cmp_size) <= cmp) {
+		lo = probe_idx + 1;
+		probe_idx += step;
+		step *= 2;
+	}
+	hi = MinValue<idx_t>(probe_idx, hi);
+	// binary search within the bracketed range
+	while (lo < hi) {
+		idx_t mid = lo + (hi - lo) / 2;
+		if (FastMemcmp(keys + mid * entry_size, key, cmp_size) <= cmp) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
 idx_t PhysicalRangeJoin::SelectJoinTail(const ExpressionType &condition, Vector &left, Vector &right,
                                         const SelectionVector *sel, idx_t count, SelectionVector *true_sel) {
 	switch (condition) {
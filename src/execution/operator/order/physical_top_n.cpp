@@ -4,6 +4,9 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/types/row_layout.hpp"
@@ -16,6 +19,64 @@ PhysicalTopN::PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> o
       limit(limit), offset(offset) {
 }
 
+static bool CanPushTopNFilter(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::ENUM) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void PhysicalTopN::InitializeScanFilter() {
+	D_ASSERT(children.size() == 1);
+	// once the heaps hold limit+offset rows, any row that cannot beat the current (limit+offset)'th sort key can
+	// never make it into the result, so the scan below may be filtered down to the rows that beat it.
+	// the threshold is only a correct bound for the leading ORDER BY column if NULL values sort after it
+	if (orders[0].null_order != OrderByNullType::NULLS_LAST) {
+		return;
+	}
+	if (children[0]->type != PhysicalOperatorType::TABLE_SCAN) {
+		return;
+	}
+	auto &scan = (PhysicalTableScan &)*children[0];
+	if (!scan.function.filter_pushdown) {
+		return;
+	}
+	auto &order_expr = *orders[0].expression;
+	if (order_expr.type != ExpressionType::BOUND_REF || !CanPushTopNFilter(order_expr.return_type)) {
+		return;
+	}
+	auto &ref = (BoundReferenceExpression &)order_expr;
+	// map the ordering column back to the scan's column index
+	auto scan_column = scan.projection_ids.empty() ? ref.index : scan.projection_ids[ref.index];
+	if (scan_column >= scan.column_ids.size() || scan.column_ids[scan_column] == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	// for DESC we keep rows >= the threshold, for ASC rows <= the threshold (non-strict, because of ties)
+	auto comparison = orders[0].type == OrderType::DESCENDING ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+	                                                          : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	boundary_filter = make_shared<DynamicFilterData>();
+	boundary_filter->filter = make_unique<ConstantFilter>(comparison, Value(order_expr.return_type));
+	if (!scan.table_filters) {
+		// the filter set must exist before the scan is initialized, as the scan state keeps a pointer to it
+		scan.table_filters = make_unique<TableFilterSet>();
+	}
+	scan.table_filters->PushFilter(scan_column, make_unique<DynamicFilter>(boundary_filter));
+}
+
 //===--------------------------------------------------------------------===//
 // Heaps
 //===--------------------------------------------------------------------===//
@@ -441,6 +502,11 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, GlobalSinkState &st
 	auto &sink = (TopNLocalState &)lstate;
 	sink.heap.Sink(input);
 	sink.heap.Reduce();
+	if (boundary_filter && sink.heap.has_boundary_values) {
+		// this heap holds limit+offset rows that are all at least as good as its boundary value, so the boundary is
+		// a valid threshold for the other threads as well: publish it to the scan
+		boundary_filter->SetValue(sink.heap.boundary_values.GetValue(0, 0));
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -22,8 +22,68 @@
 #include <fstream>
 #include <utility>
 
+#if defined(__x86_64__) && defined(__linux__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+//! The structural scan below is a trivially vectorizable byte comparison loop. We compile it once per instruction set
+//! through function multi-versioning, so a single shipped binary scans with the widest vector unit the executing CPU
+//! supports without a compile-time -march choice. Note that not every toolchain accepts the same ISA names here:
+//! several GCC versions reject "avx512bw" in the target attribute, so we stop at AVX2.
+#define DUCKDB_CSV_SCAN_TARGET_CLONES __attribute__((target_clones("default", "sse4.2", "avx2")))
+#endif
+#endif
+#ifndef DUCKDB_CSV_SCAN_TARGET_CLONES
+#define DUCKDB_CSV_SCAN_TARGET_CLONES
+#endif
+
 namespace duckdb {
 
+//! Find the first occurrence of any of the three given characters in [ptr, end), or end if there is none.
+//! The fixed-size block loop only checks whether a block contains a match at all, which the compiler turns into SIMD
+//! byte comparisons; the block that reports a match is then re-scanned a byte at a time.
+DUCKDB_CSV_SCAN_TARGET_CLONES
+static const char *ScanForCharacters(const char *ptr, const char *end, char a, char b, char c) {
+	constexpr idx_t SCAN_BLOCK_SIZE = 64;
+	while (ptr + SCAN_BLOCK_SIZE <= end) {
+		uint8_t found = 0;
+		for (idx_t i = 0; i < SCAN_BLOCK_SIZE; i++) {
+			found |= (ptr[i] == a) | (ptr[i] == b) | (ptr[i] == c);
+		}
+		if (found) {
+			break;
+		}
+		ptr += SCAN_BLOCK_SIZE;
+	}
+	for (; ptr < end; ptr++) {
+		if (*ptr == a || *ptr == b || *ptr == c) {
+			return ptr;
+		}
+	}
+	return end;
+}
+
+//! Advance over the (possibly split) buffer read until one of the given characters is found, returning its position,
+//! or `end` if none occurs before it.
+static idx_t ScanBufferForCharacters(const CSVBufferRead &buffer, idx_t position, idx_t end, char a, char b, char c) {
+	auto first_buffer_size = buffer.buffer->GetBufferSize();
+	if (position < first_buffer_size) {
+		auto base_ptr = buffer.buffer->Ptr();
+		auto segment_end = MinValue<idx_t>(end, first_buffer_size);
+		auto match = ScanForCharacters(base_ptr + position, base_ptr + segment_end, a, b, c);
+		if (match != base_ptr + segment_end) {
+			return match - base_ptr;
+		}
+		position = segment_end;
+	}
+	if (position >= end) {
+		return end;
+	}
+	D_ASSERT(buffer.next_buffer);
+	auto next_ptr = buffer.next_buffer->Ptr();
+	auto match = ScanForCharacters(next_ptr + (position - first_buffer_size), next_ptr + (end - first_buffer_size), a,
+	                               b, c);
+	return first_buffer_size + (match - next_ptr);
+}
+
 ParallelCSVReader::ParallelCSVReader(ClientContext &context, BufferedCSVReaderOptions options_p,
                                      unique_ptr<CSVBufferRead> buffer_p, const vector<LogicalType> &requested_types)
     : BaseCSVReader(context, std::move(options_p), requested_types) {
@@ -226,17 +286,23 @@ value_start : {
 normal : {
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
-	for (; position_buffer < end_buffer; position_buffer++) {
+	// the structural scan skips over the plain value characters in bulk instead of inspecting them one by one
+	while (position_buffer < end_buffer) {
+		position_buffer =
+		    ScanBufferForCharacters(*buffer, position_buffer, end_buffer, options.delimiter[0], '\r', '\n');
+		if (position_buffer >= end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.delimiter[0]) {
 			// delimiter: end the value and add it to the chunk
 			goto add_value;
-		} else if (StringUtil::CharacterIsNewline(c)) {
-			// newline: add row
-			if (column > 0 || try_add_line || insert_chunk.data.size() == 1) {
-				goto add_row;
-			}
 		}
+		// newline: add row
+		if (column > 0 || try_add_line || insert_chunk.data.size() == 1) {
+			goto add_row;
+		}
+		position_buffer++;
 	}
 	if (!BufferRemainder()) {
 		goto final_state;
@@ -331,12 +397,16 @@ in_quotes:
 	/* state: in_quotes this state parses the remainder of a quoted value*/
 	has_quotes = true;
 	position_buffer++;
-	for (; position_buffer < end_buffer; position_buffer++) {
+	// scan for the next quote or escape character in bulk
+	position_buffer = ScanBufferForCharacters(*buffer, position_buffer, end_buffer, options.quote[0],
+	                                          options.escape[0], options.quote[0]);
+	if (position_buffer < end_buffer) {
 		auto c = (*buffer)[position_buffer];
 		if (c == options.quote[0]) {
 			// quote: move to unquoted state
 			goto unquote;
-		} else if (c == options.escape[0]) {
+		}
+		if (c == options.escape[0]) {
 			// escape: store the escaped position and move to handle_escape state
 			escape_positions.push_back(position_buffer - start_buffer);
 			goto handle_escape;
@@ -6,6 +6,7 @@
 #include "duckdb/storage/table/row_group_collection.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/transaction/transaction.hpp"
 
 namespace duckdb {
 
@@ -331,6 +332,14 @@ void PhysicalBatchInsert::Combine(ExecutionContext &context, GlobalSinkState &gs
 	gstate.AddCollection(context.client, lstate.current_index, std::move(lstate.current_collection));
 }
 
+static bool UseBulkAppend(ClientContext &context, DataTable &storage) {
+	if (!ClientConfig::GetConfig(context).bulk_append) {
+		return false;
+	}
+	// index appends have to run through the transaction-local storage
+	return storage.info->indexes.Empty();
+}
+
 SinkFinalizeType PhysicalBatchInsert::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                GlobalSinkState &gstate_p) const {
 	auto &gstate = (BatchInsertGlobalState &)gstate_p;
@@ -374,9 +383,31 @@ SinkFinalizeType PhysicalBatchInsert::Finalize(Pipeline &pipeline, Event &event,
 	}
 	writer->FinalFlush();
 
-	// finally, merge the row groups into the local storage
-	for (auto &collection : final_collections) {
-		storage.LocalMerge(context, *collection);
+	if (UseBulkAppend(context, storage)) {
+		// bulk-append mode: lock the table and append the row groups straight into the table instead of staging them
+		// in the local storage, avoiding the extra pass over the data on commit
+		// the rows are stamped with the transaction id so they remain invisible to other transactions, and a rollback
+		// truncates the appended range again
+		auto &transaction = Transaction::Get(context, *gstate.table->catalog);
+		TableAppendState append_state;
+		storage.AppendLock(append_state);
+		idx_t append_count = 0;
+		for (auto &collection : final_collections) {
+			// stamp the rows with the transaction id BEFORE linking in the row groups: the staged collections carry
+			// fully committed version info, which concurrent scans must not observe
+			collection->CommitAppend(transaction.transaction_id, collection->GetRowStart(),
+			                         collection->GetTotalRows());
+			append_count += collection->GetTotalRows();
+			storage.MergeStorage(*collection, storage.info->indexes);
+		}
+		if (append_count > 0) {
+			transaction.PushAppend(&storage, append_state.row_start, append_count);
+		}
+	} else {
+		// finally, merge the row groups into the local storage
+		for (auto &collection : final_collections) {
+			storage.LocalMerge(context, *collection);
+		}
 	}
 	return SinkFinalizeType::READY;
 }
@@ -1,6 +1,10 @@
 #include "duckdb/execution/operator/persistent/physical_copy_to_file.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/hive_partitioning.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 
 #include <algorithm>
 
@@ -15,6 +19,11 @@ public:
 	idx_t rows_copied;
 	idx_t last_file_offset;
 	unique_ptr<GlobalFunctionData> global_state;
+
+	//! shared state for the partition discovery of PARTITION_BY writes
+	shared_ptr<GlobalHivePartitionState> partition_state;
+	//! the combined partitioned data of all threads for PARTITION_BY writes
+	unique_ptr<HivePartitionedColumnData> partition_data;
 };
 
 class CopyToFunctionLocalState : public LocalSinkState {
@@ -23,6 +32,10 @@ public:
 	}
 	unique_ptr<GlobalFunctionData> global_state;
 	unique_ptr<LocalFunctionData> local_state;
+
+	//! Buffers the tuples in partitions before writing
+	unique_ptr<HivePartitionedColumnData> part_buffer;
+	unique_ptr<PartitionedColumnDataAppendState> part_buffer_append_state;
 };
 
 //===--------------------------------------------------------------------===//
@@ -52,6 +65,10 @@ SinkResultType PhysicalCopyToFile::Sink(ExecutionContext &context, GlobalSinkSta
 		lock_guard<mutex> glock(g.lock);
 		g.rows_copied += input.size();
 	}
+	if (partition_output) {
+		l.part_buffer->Append(*l.part_buffer_append_state, input);
+		return SinkResultType::NEED_MORE_INPUT;
+	}
 	function.copy_to_sink(context, *bind_data, per_thread_output ? *l.global_state : *g.global_state, *l.local_state,
 	                      input);
 	return SinkResultType::NEED_MORE_INPUT;
@@ -61,6 +78,12 @@ void PhysicalCopyToFile::Combine(ExecutionContext &context, GlobalSinkState &gst
 	auto &g = (CopyToFunctionGlobalState &)gstate;
 	auto &l = (CopyToFunctionLocalState &)lstate;
 
+	if (partition_output) {
+		// flush any remaining partition buffers and combine the partitioned data into the global state
+		l.part_buffer->FlushAppendState(*l.part_buffer_append_state);
+		g.partition_data->Combine(*l.part_buffer);
+		return;
+	}
 	if (function.copy_to_combine) {
 		function.copy_to_combine(context, *bind_data, per_thread_output ? *l.global_state : *g.global_state,
 		                         *l.local_state);
@@ -70,9 +93,69 @@ void PhysicalCopyToFile::Combine(ExecutionContext &context, GlobalSinkState &gst
 	}
 }
 
+static void CreateDir(const string &dir_path, FileSystem &fs) {
+	if (!fs.DirectoryExists(dir_path)) {
+		fs.CreateDirectory(dir_path);
+	}
+}
+
+static string CreateDirRecursive(const vector<idx_t> &cols, const vector<string> &names, const vector<Value> &values,
+                                 string path, FileSystem &fs) {
+	CreateDir(path, fs);
+
+	for (idx_t i = 0; i < cols.size(); i++) {
+		auto partition_col_name = names[cols[i]];
+		auto partition_value = values[i];
+		string p_dir = partition_col_name + "=" + partition_value.ToString();
+		path = fs.JoinPath(path, p_dir);
+		CreateDir(path, fs);
+	}
+
+	return path;
+}
+
 SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                               GlobalSinkState &gstate_p) const {
 	auto &gstate = (CopyToFunctionGlobalState &)gstate_p;
+	if (partition_output) {
+		auto &fs = FileSystem::GetFileSystem(context);
+
+		auto trimmed_path = file_path;
+		while (StringUtil::EndsWith(trimmed_path, fs.PathSeparator())) {
+			trimmed_path = trimmed_path.substr(0, trimmed_path.size() - fs.PathSeparator().size());
+		}
+
+		auto &partitions = gstate.partition_data->GetPartitions();
+		auto partition_key_map = gstate.partition_data->GetReverseMap();
+
+		// create a writer per partition and write out the hive directory tree
+		ThreadContext thread_context(context);
+		ExecutionContext execution_context(context, thread_context, nullptr);
+		for (idx_t i = 0; i < partitions.size(); i++) {
+			string hive_path =
+			    CreateDirRecursive(partition_columns, names, partition_key_map[i]->values, trimmed_path, fs);
+			string full_path = fs.JoinPath(hive_path, "data_" + to_string(i) + "." + function.extension);
+			if (fs.FileExists(full_path)) {
+				throw IOException("%s exists", full_path);
+			}
+			// Create a writer for the current file
+			auto fun_data_global = function.copy_to_initialize_global(context, *bind_data, full_path);
+			auto fun_data_local = function.copy_to_initialize_local(execution_context, *bind_data);
+
+			for (auto &chunk : partitions[i]->Chunks()) {
+				function.copy_to_sink(execution_context, *bind_data, *fun_data_global, *fun_data_local, chunk);
+			}
+
+			if (function.copy_to_combine) {
+				function.copy_to_combine(execution_context, *bind_data, *fun_data_global, *fun_data_local);
+			}
+			if (function.copy_to_finalize) {
+				function.copy_to_finalize(context, *bind_data, *fun_data_global);
+			}
+		}
+
+		return SinkFinalizeType::READY;
+	}
 	if (per_thread_output) {
 		// already happened in combine
 		return SinkFinalizeType::READY;
@@ -89,6 +172,16 @@ SinkFinalizeType PhysicalCopyToFile::Finalize(Pipeline &pipeline, Event &event,
 }
 
 unique_ptr<LocalSinkState> PhysicalCopyToFile::GetLocalSinkState(ExecutionContext &context) const {
+	if (partition_output) {
+		auto &g = (CopyToFunctionGlobalState &)*sink_state;
+
+		auto res = make_unique<CopyToFunctionLocalState>(nullptr);
+		res->part_buffer = make_unique<HivePartitionedColumnData>(context.client, expected_types, partition_columns,
+		                                                          g.partition_state);
+		res->part_buffer_append_state = make_unique<PartitionedColumnDataAppendState>();
+		res->part_buffer->InitializeAppendState(*res->part_buffer_append_state);
+		return std::move(res);
+	}
 	auto res = make_unique<CopyToFunctionLocalState>(function.copy_to_initialize_local(context, *bind_data));
 	if (per_thread_output) {
 		idx_t this_file_offset;
@@ -108,7 +201,7 @@ unique_ptr<LocalSinkState> PhysicalCopyToFile::GetLocalSinkState(ExecutionContex
 }
 
 unique_ptr<GlobalSinkState> PhysicalCopyToFile::GetGlobalSinkState(ClientContext &context) const {
-	if (per_thread_output) {
+	if (partition_output || per_thread_output) {
 		auto &fs = FileSystem::GetFileSystem(context);
 
 		if (fs.FileExists(file_path)) {
@@ -124,7 +217,13 @@ unique_ptr<GlobalSinkState> PhysicalCopyToFile::GetGlobalSinkState(ClientContext
 			}
 		}
 
-		return make_unique<CopyToFunctionGlobalState>(nullptr);
+		auto state = make_unique<CopyToFunctionGlobalState>(nullptr);
+		if (partition_output) {
+			state->partition_state = make_shared<GlobalHivePartitionState>();
+			state->partition_data = make_unique<HivePartitionedColumnData>(context, expected_types, partition_columns,
+			                                                               state->partition_state);
+		}
+		return std::move(state);
 	} else {
 		return make_unique<CopyToFunctionGlobalState>(
 		    function.copy_to_initialize_global(context, *bind_data, file_path));
@@ -60,6 +60,17 @@ void PhysicalColumnDataScan::BuildPipelines(Pipeline &current, MetaPipeline &met
 			throw InternalException("Recursive CTE scan found without recursive CTE node");
 		}
 		break;
+	case PhysicalOperatorType::MATERIALIZE_SCAN: {
+		// this scan reads the result of a materialized subplan:
+		// it can only be executed after the pipeline that materializes the subplan has finished
+		auto entry = state.materialize_dependencies.find(materialize_index);
+		if (entry == state.materialize_dependencies.end()) {
+			throw InternalException("Materialized subplan scan found without materialize node");
+		}
+		auto materialize_dependency = entry->second->shared_from_this();
+		current.AddDependency(materialize_dependency);
+		break;
+	}
 	default:
 		break;
 	}
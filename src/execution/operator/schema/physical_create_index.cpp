@@ -15,6 +15,10 @@ class CreateIndexGlobalSinkState : public GlobalSinkState {
 public:
 	//! Global index to be added to the table
 	unique_ptr<Index> global_index;
+	//! Lock for the merge queue
+	mutex merge_lock;
+	//! Local indexes that still have to be merged into the global index
+	vector<unique_ptr<Index>> merge_queue;
 };
 
 class CreateIndexLocalSinkState : public LocalSinkState {
@@ -101,8 +105,26 @@ void PhysicalCreateIndex::Combine(ExecutionContext &context, GlobalSinkState &gs
 	auto &gstate = (CreateIndexGlobalSinkState &)gstate_p;
 	auto &lstate = (CreateIndexLocalSinkState &)lstate_p;
 
-	// merge the local index into the global index
-	gstate.global_index->MergeIndexes(lstate.local_index.get());
+	// merge the local indexes pairwise, so that the reduction to a single index runs on multiple worker threads
+	// instead of serializing all merges on a single lock
+	auto local_index = std::move(lstate.local_index);
+	while (true) {
+		unique_lock<mutex> guard(gstate.merge_lock);
+		if (gstate.merge_queue.empty()) {
+			// no other local index is waiting to be merged: queue ours and return,
+			// either another Combine or Finalize picks it up
+			gstate.merge_queue.push_back(std::move(local_index));
+			return;
+		}
+		auto other_index = std::move(gstate.merge_queue.back());
+		gstate.merge_queue.pop_back();
+		guard.unlock();
+
+		// merge outside of the lock, then try to pick up the next queued index
+		if (!local_index->MergeIndexes(other_index.get())) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	}
 }
 
 SinkFinalizeType PhysicalCreateIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -116,6 +138,15 @@ SinkFinalizeType PhysicalCreateIndex::Finalize(Pipeline &pipeline, Event &event,
 		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
 	}
 
+	// merge any remaining local indexes into the global index; in the common case
+	// the pairwise merging in Combine leaves a single index here
+	for (auto &local_index : state.merge_queue) {
+		if (!state.global_index->MergeIndexes(local_index.get())) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	}
+	state.merge_queue.clear();
+
 	auto &schema = *table.schema;
 	auto index_entry = (IndexCatalogEntry *)schema.CreateIndex(context, info.get(), &table);
 	if (!index_entry) {
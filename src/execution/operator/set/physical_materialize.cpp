@@ -0,0 +1,82 @@
+#include "duckdb/execution/operator/set/physical_materialize.hpp"
+
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+
+namespace duckdb {
+
+PhysicalMaterialize::PhysicalMaterialize(vector<LogicalType> types, idx_t materialize_index,
+                                         unique_ptr<PhysicalOperator> definition, unique_ptr<PhysicalOperator> main,
+                                         idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::MATERIALIZE, std::move(types), estimated_cardinality),
+      materialize_index(materialize_index) {
+	children.push_back(std::move(definition));
+	children.push_back(std::move(main));
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class MaterializeGlobalState : public GlobalSinkState {
+public:
+	mutex lock;
+};
+
+class MaterializeLocalState : public LocalSinkState {
+public:
+	MaterializeLocalState(ClientContext &context, const vector<LogicalType> &types) : data(context, types) {
+	}
+
+	ColumnDataCollection data;
+};
+
+unique_ptr<GlobalSinkState> PhysicalMaterialize::GetGlobalSinkState(ClientContext &context) const {
+	// the plan may be executed more than once (e.g. for a prepared or cached plan):
+	// every execution starts from an empty collection
+	collection->Reset();
+	return make_unique<MaterializeGlobalState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalMaterialize::GetLocalSinkState(ExecutionContext &context) const {
+	return make_unique<MaterializeLocalState>(context.client, children[0]->GetTypes());
+}
+
+SinkResultType PhysicalMaterialize::Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate_p,
+                                         DataChunk &input) const {
+	auto &lstate = (MaterializeLocalState &)lstate_p;
+	lstate.data.Append(input);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalMaterialize::Combine(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate_p) const {
+	auto &gstate = (MaterializeGlobalState &)gstate_p;
+	auto &lstate = (MaterializeLocalState &)lstate_p;
+	lock_guard<mutex> guard(gstate.lock);
+	collection->Combine(lstate.data);
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalMaterialize::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	op_state.reset();
+	sink_state.reset();
+
+	// the subplan definition is materialized into the shared collection by a child pipeline
+	auto child_meta_pipeline = meta_pipeline.CreateChildMetaPipeline(current, this);
+	child_meta_pipeline->Build(children[0].get());
+
+	// register the materialization pipeline, so that the scans of the materialized result can depend on it
+	auto &state = meta_pipeline.GetState();
+	state.materialize_dependencies[materialize_index] = child_meta_pipeline->GetBasePipeline().get();
+
+	// the main plan continues in the current pipeline
+	children[1]->BuildPipelines(current, meta_pipeline);
+}
+
+vector<const PhysicalOperator *> PhysicalMaterialize::GetSources() const {
+	return children[1]->GetSources();
+}
+
+} // namespace duckdb
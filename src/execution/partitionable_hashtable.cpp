@@ -182,4 +182,21 @@ void PartitionableHashTable::Finalize() {
 	}
 }
 
+idx_t PartitionableHashTable::TotalSize() const {
+	idx_t total_size = 0;
+	for (auto &ht : unpartitioned_hts) {
+		if (ht) {
+			total_size += ht->TotalSize();
+		}
+	}
+	for (auto &ht_list : radix_partitioned_hts) {
+		for (auto &ht : ht_list.second) {
+			if (ht) {
+				total_size += ht->TotalSize();
+			}
+		}
+	}
+	return total_size;
+}
+
 } // namespace duckdb
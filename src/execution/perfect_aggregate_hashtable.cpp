@@ -22,13 +22,26 @@ PerfectAggregateHashTable::PerfectAggregateHashTable(ClientContext &context, All
 	layout.Initialize(std::move(aggregate_objects_p));
 	tuple_size = layout.GetRowWidth();
 
-	// allocate and null initialize the data
-	owned_data = unique_ptr<data_t[]>(new data_t[tuple_size * total_groups]);
-	data = owned_data.get();
+	// the data is paged: pages are allocated lazily on first use, so that sparsely occupied domains
+	// only pay for the pages that actually hold groups
+	idx_t page_count = (total_groups + GROUPS_PER_PAGE - 1) >> GROUPS_PER_PAGE_SHIFT;
+	pages.resize(page_count);
+	group_is_set.resize(page_count);
+}
+
+data_ptr_t PerfectAggregateHashTable::AllocatePage(idx_t page_idx) {
+	D_ASSERT(!pages[page_idx]);
+	auto group_count = PageGroupCount(page_idx);
+	// allocate the page, and initialize the "occupied" flag of its groups to false
+	pages[page_idx] = unique_ptr<data_t[]>(new data_t[tuple_size * group_count]);
+	group_is_set[page_idx] = unique_ptr<bool[]>(new bool[group_count]);
+	memset(group_is_set[page_idx].get(), 0, group_count * sizeof(bool));
+	return pages[page_idx].get();
+}
 
-	// set up the empty payloads for every tuple, and initialize the "occupied" flag to false
-	group_is_set = unique_ptr<bool[]>(new bool[total_groups]);
-	memset(group_is_set.get(), 0, total_groups * sizeof(bool));
+idx_t PerfectAggregateHashTable::PageGroupCount(idx_t page_idx) const {
+	auto page_start = page_idx << GROUPS_PER_PAGE_SHIFT;
+	return MinValue<idx_t>(GROUPS_PER_PAGE, total_groups - page_start);
 }
 
 PerfectAggregateHashTable::~PerfectAggregateHashTable() {
@@ -99,14 +112,21 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 		ComputeGroupLocation(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
 	}
 	// now we have the HT entry number for every tuple
-	// compute the actual pointer to the data by adding it to the base HT pointer and multiplying by the tuple size
+	// compute the actual pointer to the data by looking up the page of the group (allocating it on first use)
+	// and adding the offset of the group within the page
 	idx_t needs_init = 0;
 	for (idx_t i = 0; i < groups.size(); i++) {
 		D_ASSERT(address_data[i] < total_groups);
 		const auto group = address_data[i];
-		address_data[i] = uintptr_t(data) + address_data[i] * tuple_size;
-		if (!group_is_set[group]) {
-			group_is_set[group] = true;
+		const auto page_idx = group >> GROUPS_PER_PAGE_SHIFT;
+		const auto group_in_page = group & (GROUPS_PER_PAGE - 1);
+		auto page = pages[page_idx].get();
+		if (!page) {
+			page = AllocatePage(page_idx);
+		}
+		address_data[i] = uintptr_t(page) + group_in_page * tuple_size;
+		if (!group_is_set[page_idx][group_in_page]) {
+			group_is_set[page_idx][group_in_page] = true;
 			sel.set_index(needs_init++, i);
 			if (needs_init == STANDARD_VECTOR_SIZE) {
 				RowOperations::InitializeStates(layout, addresses, sel, needs_init);
@@ -123,10 +143,10 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 		auto &aggregate = aggregates[aggr_idx];
 		auto input_count = (idx_t)aggregate.child_count;
 		if (aggregate.filter) {
-			RowOperations::UpdateFilteredStates(filter_set.GetFilterData(aggr_idx), aggregate, addresses, payload,
-			                                    payload_idx);
+			RowOperations::UpdateFilteredStates(aggregate_allocator, filter_set.GetFilterData(aggr_idx), aggregate,
+			                                    addresses, payload, payload_idx);
 		} else {
-			RowOperations::UpdateStates(aggregate, addresses, payload, payload_idx, payload.size());
+			RowOperations::UpdateStates(aggregate_allocator, aggregate, addresses, payload, payload_idx, payload.size());
 		}
 		// move to the next aggregate
 		payload_idx += input_count;
@@ -143,39 +163,50 @@ void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
 	auto source_addresses_ptr = FlatVector::GetData<data_ptr_t>(source_addresses);
 	auto target_addresses_ptr = FlatVector::GetData<data_ptr_t>(target_addresses);
 
-	// iterate over all entries of both hash tables and call combine for all entries that can be combined
-	data_ptr_t source_ptr = other.data;
-	data_ptr_t target_ptr = data;
+	// iterate over the pages of both hash tables and combine all entries that occur in both
 	idx_t combine_count = 0;
-	idx_t reinit_count = 0;
-	const auto &reinit_sel = *FlatVector::IncrementalSelectionVector();
-	for (idx_t i = 0; i < total_groups; i++) {
-		auto has_entry_source = other.group_is_set[i];
-		// we only have any work to do if the source has an entry for this group
-		if (has_entry_source) {
-			auto has_entry_target = group_is_set[i];
-			if (has_entry_target) {
-				// both source and target have an entry: need to combine
-				source_addresses_ptr[combine_count] = source_ptr;
-				target_addresses_ptr[combine_count] = target_ptr;
-				combine_count++;
-				if (combine_count == STANDARD_VECTOR_SIZE) {
-					RowOperations::CombineStates(layout, source_addresses, target_addresses, combine_count);
-					combine_count = 0;
+	for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+		if (!other.pages[page_idx]) {
+			// the source has no entries in this page
+			continue;
+		}
+		if (!pages[page_idx]) {
+			// only the source has entries in this page: take the entire page over
+			pages[page_idx] = std::move(other.pages[page_idx]);
+			group_is_set[page_idx] = std::move(other.group_is_set[page_idx]);
+			continue;
+		}
+		// both hash tables have entries in this page
+		auto source_is_set = other.group_is_set[page_idx].get();
+		auto target_is_set = group_is_set[page_idx].get();
+		data_ptr_t source_ptr = other.pages[page_idx].get();
+		data_ptr_t target_ptr = pages[page_idx].get();
+		const auto group_count = PageGroupCount(page_idx);
+		for (idx_t i = 0; i < group_count; i++) {
+			// we only have any work to do if the source has an entry for this group
+			if (source_is_set[i]) {
+				if (target_is_set[i]) {
+					// both source and target have an entry: need to combine
+					source_addresses_ptr[combine_count] = source_ptr;
+					target_addresses_ptr[combine_count] = target_ptr;
+					combine_count++;
+					if (combine_count == STANDARD_VECTOR_SIZE) {
+						RowOperations::CombineStates(aggregate_allocator, layout, source_addresses, target_addresses, combine_count);
+						combine_count = 0;
+					}
+				} else {
+					target_is_set[i] = true;
+					// only source has an entry for this group: we can just memcpy it over
+					memcpy(target_ptr, source_ptr, tuple_size);
+					// we clear this entry in the other HT as we "consume" the entry here
+					source_is_set[i] = false;
 				}
-			} else {
-				group_is_set[i] = true;
-				// only source has an entry for this group: we can just memcpy it over
-				memcpy(target_ptr, source_ptr, tuple_size);
-				// we clear this entry in the other HT as we "consume" the entry here
-				other.group_is_set[i] = false;
 			}
+			source_ptr += tuple_size;
+			target_ptr += tuple_size;
 		}
-		source_ptr += tuple_size;
-		target_ptr += tuple_size;
 	}
-	RowOperations::CombineStates(layout, source_addresses, target_addresses, combine_count);
-	RowOperations::InitializeStates(layout, addresses, reinit_sel, reinit_count);
+	RowOperations::CombineStates(aggregate_allocator, layout, source_addresses, target_addresses, combine_count);
 }
 
 template <class T>
@@ -226,9 +257,16 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 	// iterate over the HT until we either have exhausted the entire HT, or
 	idx_t entry_count = 0;
 	for (; scan_position < total_groups; scan_position++) {
-		if (group_is_set[scan_position]) {
+		const auto page_idx = scan_position >> GROUPS_PER_PAGE_SHIFT;
+		if (!pages[page_idx]) {
+			// the page was never allocated: skip it entirely
+			scan_position = ((page_idx + 1) << GROUPS_PER_PAGE_SHIFT) - 1;
+			continue;
+		}
+		const auto group_in_page = scan_position & (GROUPS_PER_PAGE - 1);
+		if (group_is_set[page_idx][group_in_page]) {
 			// this group is set: add it to the set of groups to extract
-			data_pointers[entry_count] = data + tuple_size * scan_position;
+			data_pointers[entry_count] = pages[page_idx].get() + tuple_size * group_in_page;
 			group_values[entry_count] = scan_position;
 			entry_count++;
 			if (entry_count == STANDARD_VECTOR_SIZE) {
@@ -249,7 +287,7 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 	}
 	// then construct the payloads
 	result.SetCardinality(entry_count);
-	RowOperations::FinalizeStates(layout, addresses, result, grouping_columns);
+	RowOperations::FinalizeStates(aggregate_allocator, layout, addresses, result, grouping_columns);
 }
 
 void PerfectAggregateHashTable::Destroy() {
@@ -269,18 +307,25 @@ void PerfectAggregateHashTable::Destroy() {
 	idx_t count = 0;
 
 	// iterate over all initialised slots of the hash table
-	data_ptr_t payload_ptr = data;
-	for (idx_t i = 0; i < total_groups; i++) {
-		if (group_is_set[i]) {
-			data_pointers[count++] = payload_ptr;
-			if (count == STANDARD_VECTOR_SIZE) {
-				RowOperations::DestroyStates(layout, addresses, count);
-				count = 0;
+	for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+		if (!pages[page_idx]) {
+			continue;
+		}
+		auto page_is_set = group_is_set[page_idx].get();
+		data_ptr_t payload_ptr = pages[page_idx].get();
+		const auto group_count = PageGroupCount(page_idx);
+		for (idx_t i = 0; i < group_count; i++) {
+			if (page_is_set[i]) {
+				data_pointers[count++] = payload_ptr;
+				if (count == STANDARD_VECTOR_SIZE) {
+					RowOperations::DestroyStates(aggregate_allocator, layout, addresses, count);
+					count = 0;
+				}
 			}
+			payload_ptr += tuple_size;
 		}
-		payload_ptr += tuple_size;
 	}
-	RowOperations::DestroyStates(layout, addresses, count);
+	RowOperations::DestroyStates(aggregate_allocator, layout, addresses, count);
 }
 
 } // namespace duckdb
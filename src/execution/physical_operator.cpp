@@ -116,7 +116,7 @@ unique_ptr<GlobalSinkState> PhysicalOperator::GetGlobalSinkState(ClientContext &
 idx_t PhysicalOperator::GetMaxThreadMemory(ClientContext &context) {
 	// Memory usage per thread should scale with max mem / num threads
 	// We take 1/4th of this, to be conservative
-	idx_t max_memory = BufferManager::GetBufferManager(context).GetMaxMemory();
+	idx_t max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory(context);
 	idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
 	return (max_memory / num_threads) / 4;
 }
@@ -294,10 +294,29 @@ OperatorResultType CachingPhysicalOperator::Execute(ExecutionContext &context, D
 	return child_result;
 }
 
+OperatorFinalizeResultType CachingPhysicalOperator::FinalExecuteInternal(ExecutionContext &context, DataChunk &chunk,
+                                                                         GlobalOperatorState &gstate,
+                                                                         OperatorState &state) const {
+	chunk.SetCardinality(0);
+	return OperatorFinalizeResultType::FINISHED;
+}
+
 OperatorFinalizeResultType CachingPhysicalOperator::FinalExecute(ExecutionContext &context, DataChunk &chunk,
                                                                  GlobalOperatorState &gstate,
                                                                  OperatorState &state_p) const {
 	auto &state = (CachingOperatorState &)state_p;
+	if (!state.final_execute_done) {
+		// flush any output the operator itself is still holding (e.g. buffered input)
+		auto result = FinalExecuteInternal(context, chunk, gstate, state);
+		if (result == OperatorFinalizeResultType::HAVE_MORE_OUTPUT) {
+			return result;
+		}
+		state.final_execute_done = true;
+		if (chunk.size() > 0) {
+			// the operator emitted a final chunk: the cached chunk (if any) is flushed on the next call
+			return OperatorFinalizeResultType::HAVE_MORE_OUTPUT;
+		}
+	}
 	if (state.cached_chunk) {
 		chunk.Move(*state.cached_chunk);
 		state.cached_chunk.reset();
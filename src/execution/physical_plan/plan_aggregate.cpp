@@ -7,6 +7,7 @@
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
+#include "duckdb/parser/expression_map.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
@@ -169,27 +170,37 @@ PhysicalPlanGenerator::ExtractAggregateExpressions(unique_ptr<PhysicalOperator>
 	vector<unique_ptr<Expression>> expressions;
 	vector<LogicalType> types;
 
+	// identical expressions (e.g. the x * y in SUM(x * y) and AVG(x * y), or repeated FILTER predicates) are
+	// only computed once in the projection below the aggregate, and fanned out to every user by reference
+	expression_map_t<idx_t> projection_index;
+	auto extract_expression = [&](unique_ptr<Expression> &expr) -> unique_ptr<BoundReferenceExpression> {
+		idx_t index;
+		auto entry = projection_index.find(expr.get());
+		if (entry != projection_index.end()) {
+			index = entry->second;
+		} else {
+			index = expressions.size();
+			types.push_back(expr->return_type);
+			expressions.push_back(std::move(expr));
+			if (!expressions[index]->HasSideEffects()) {
+				// expressions with side effects (e.g. random()) cannot be shared
+				projection_index[expressions[index].get()] = index;
+			}
+		}
+		return make_unique<BoundReferenceExpression>(types[index], index);
+	};
+
 	for (auto &group : groups) {
-		auto ref = make_unique<BoundReferenceExpression>(group->return_type, expressions.size());
-		types.push_back(group->return_type);
-		expressions.push_back(std::move(group));
-		group = std::move(ref);
+		group = extract_expression(group);
 	}
 
 	for (auto &aggr : aggregates) {
 		auto &bound_aggr = (BoundAggregateExpression &)*aggr;
 		for (auto &child : bound_aggr.children) {
-			auto ref = make_unique<BoundReferenceExpression>(child->return_type, expressions.size());
-			types.push_back(child->return_type);
-			expressions.push_back(std::move(child));
-			child = std::move(ref);
+			child = extract_expression(child);
 		}
 		if (bound_aggr.filter) {
-			auto &filter = bound_aggr.filter;
-			auto ref = make_unique<BoundReferenceExpression>(filter->return_type, expressions.size());
-			types.push_back(filter->return_type);
-			expressions.push_back(std::move(filter));
-			bound_aggr.filter = std::move(ref);
+			bound_aggr.filter = extract_expression(bound_aggr.filter);
 		}
 	}
 	if (expressions.empty()) {
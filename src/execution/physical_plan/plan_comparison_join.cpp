@@ -12,6 +12,8 @@
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/transaction/transaction.hpp"
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/multiply.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
@@ -66,12 +68,8 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (op.join_type != JoinType::INNER) {
 		return;
 	}
-	// with one condition
-	if (op.conditions.size() != 1) {
-		return;
-	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
+	// with propagated statistics for every condition
+	if (op.join_stats.size() != 2 * op.conditions.size()) {
 		return;
 	}
 	for (auto &type : op.children[1]->types) {
@@ -83,7 +81,7 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 			break;
 		}
 	}
-	// with equality condition and null values not equal
+	// with equality conditions and null values not equal
 	for (auto &&condition : op.conditions) {
 		if (condition.comparison != ExpressionType::COMPARE_EQUAL) {
 			return;
@@ -97,37 +95,46 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		}
 	}
 
-	// and when the build range is smaller than the threshold
-	auto stats_build = reinterpret_cast<NumericStatistics *>(op.join_stats[0].get()); // lhs stats
-	if (stats_build->min.IsNull() || stats_build->max.IsNull()) {
-		return;
-	}
-	int64_t min_value, max_value;
-	if (!ExtractNumericValue(stats_build->min, min_value) || !ExtractNumericValue(stats_build->max, max_value)) {
-		return;
-	}
-	int64_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return;
-	}
-
-	// Fill join_stats for invisible join
-	auto stats_probe = reinterpret_cast<NumericStatistics *>(op.join_stats[1].get()); // rhs stats
-
-	// The max size our build must have to run the perfect HJ
+	// and when the composed build range is smaller than the threshold
+	// for multiple conditions the key positions are composed by multiplying the ranges of the individual keys
 	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = stats_probe->min;
-	join_state.probe_max = stats_probe->max;
-	join_state.build_min = stats_build->min;
-	join_state.build_max = stats_build->max;
-	join_state.estimated_cardinality = op.estimated_cardinality;
-	join_state.build_range = build_range;
-	if (join_state.build_range > MAX_BUILD_SIZE || stats_probe->max.IsNull() || stats_probe->min.IsNull()) {
-		return;
-	}
-	if (stats_build->min <= stats_probe->min && stats_probe->max <= stats_build->max) {
-		join_state.is_probe_in_domain = true;
+	int64_t build_size = 1;
+	bool is_probe_in_domain = true;
+	for (idx_t i = 0; i < op.conditions.size(); i++) {
+		auto stats_build = reinterpret_cast<NumericStatistics *>(op.join_stats[2 * i].get());     // lhs stats
+		auto stats_probe = reinterpret_cast<NumericStatistics *>(op.join_stats[2 * i + 1].get()); // rhs stats
+		if (stats_build->min.IsNull() || stats_build->max.IsNull() || stats_probe->min.IsNull() ||
+		    stats_probe->max.IsNull()) {
+			return;
+		}
+		int64_t min_value, max_value;
+		if (!ExtractNumericValue(stats_build->min, min_value) || !ExtractNumericValue(stats_build->max, max_value)) {
+			return;
+		}
+		int64_t key_range;
+		if (!TrySubtractOperator::Operation(max_value, min_value, key_range)) {
+			return;
+		}
+		// this key is placed at a stride of the sizes of the preceding keys
+		join_state.key_mins.push_back(stats_build->min);
+		join_state.key_maxes.push_back(stats_build->max);
+		join_state.key_strides.push_back((idx_t)build_size);
+		int64_t key_size;
+		if (!TryAddOperator::Operation(key_range, (int64_t)1, key_size) ||
+		    !TryMultiplyOperator::Operation(build_size, key_size, build_size)) {
+			return;
+		}
+		// The max size our build must have to run the perfect HJ
+		if ((idx_t)build_size > MAX_BUILD_SIZE) {
+			return;
+		}
+		if (!(stats_build->min <= stats_probe->min && stats_probe->max <= stats_build->max)) {
+			is_probe_in_domain = false;
+		}
 	}
+	join_state.estimated_cardinality = op.estimated_cardinality;
+	join_state.build_range = (idx_t)build_size - 1;
+	join_state.is_probe_in_domain = is_probe_in_domain;
 	join_state.is_build_small = true;
 	return;
 }
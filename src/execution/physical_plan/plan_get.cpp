@@ -92,9 +92,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalGet &op) {
 		projection->children.push_back(std::move(node));
 		return std::move(projection);
 	} else {
-		return make_unique<PhysicalTableScan>(op.types, op.function, std::move(op.bind_data), op.returned_types,
-		                                      op.column_ids, op.projection_ids, op.names, std::move(table_filters),
-		                                      op.estimated_cardinality);
+		auto node = make_unique<PhysicalTableScan>(op.types, op.function, std::move(op.bind_data), op.returned_types,
+		                                           op.column_ids, op.projection_ids, op.names, std::move(table_filters),
+		                                           op.estimated_cardinality);
+		node->projected_struct_fields = std::move(op.projected_struct_fields);
+		return std::move(node);
 	}
 }
 
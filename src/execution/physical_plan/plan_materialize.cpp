@@ -0,0 +1,43 @@
+#include "duckdb/execution/operator/set/physical_materialize.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/operator/logical_materialize.hpp"
+#include "duckdb/planner/operator/logical_materialize_scan.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+
+namespace duckdb {
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalMaterialize &op) {
+	D_ASSERT(op.children.size() == 2);
+
+	// create the collection that the materialization writes and the scans read
+	auto collection = std::make_shared<ColumnDataCollection>(context, op.children[0]->types);
+	materialized_subplans[op.materialize_index] = collection;
+
+	// the definition must be planned before the main plan, so that the scans can find the collection
+	auto definition = CreatePlan(*op.children[0]);
+	auto main = CreatePlan(*op.children[1]);
+
+	auto materialize = make_unique<PhysicalMaterialize>(op.types, op.materialize_index, std::move(definition),
+	                                                    std::move(main), op.estimated_cardinality);
+	materialize->collection = collection;
+
+	return std::move(materialize);
+}
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalMaterializeScan &op) {
+	D_ASSERT(op.children.empty());
+
+	auto chunk_scan = make_unique<PhysicalColumnDataScan>(op.types, PhysicalOperatorType::MATERIALIZE_SCAN,
+	                                                      op.estimated_cardinality, op.materialize_index);
+
+	// CreatePlan of the LogicalMaterialize must have happened before.
+	auto entry = materialized_subplans.find(op.materialize_index);
+	if (entry == materialized_subplans.end()) {
+		throw InternalException("Referenced materialized subplan does not exist.");
+	}
+	chunk_scan->collection = entry->second.get();
+	return std::move(chunk_scan);
+}
+
+} // namespace duckdb
@@ -1,3 +1,4 @@
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 #include "duckdb/execution/operator/aggregate/physical_window.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
@@ -10,7 +11,7 @@
 
 namespace duckdb {
 
-static bool IsStreamingWindow(unique_ptr<Expression> &expr) {
+static bool IsStreamingWindow(ClientContext &context, unique_ptr<Expression> &expr) {
 	auto wexpr = reinterpret_cast<BoundWindowExpression *>(expr.get());
 	if (!wexpr->partitions.empty() || !wexpr->orders.empty() || wexpr->ignore_nulls) {
 		return false;
@@ -21,6 +22,26 @@ static bool IsStreamingWindow(unique_ptr<Expression> &expr) {
 		// We can stream aggregates if they are "running totals" and don't use filters
 		return wexpr->start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr->end == WindowBoundary::CURRENT_ROW_ROWS &&
 		       !wexpr->filter_expr;
+	case ExpressionType::WINDOW_LAG: {
+		// We can stream LAG if the offset and default are constants: the function only looks backwards,
+		// so a buffer of the trailing rows of the previous chunks suffices
+		if (wexpr->offset_expr) {
+			Value offset;
+			if (wexpr->offset_expr->HasParameter() || !wexpr->offset_expr->IsFoldable() ||
+			    !ExpressionExecutor::TryEvaluateScalar(context, *wexpr->offset_expr, offset) || offset.IsNull()) {
+				return false;
+			}
+			auto offset_value = offset.GetValue<int64_t>();
+			if (offset_value < 0 || offset_value > int64_t(STANDARD_VECTOR_SIZE)) {
+				// A negative offset looks forward (like LEAD), a larger one would need a bigger buffer
+				return false;
+			}
+		}
+		if (wexpr->default_expr && (wexpr->default_expr->HasParameter() || !wexpr->default_expr->IsFoldable())) {
+			return false;
+		}
+		return true;
+	}
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -32,6 +53,69 @@ static bool IsStreamingWindow(unique_ptr<Expression> &expr) {
 	}
 }
 
+//! Returns true if the window expression does not depend on peer (ORDER BY tie) boundaries. Such an expression can
+//! be evaluated over any sort order that has its own ORDER BY as a prefix: the frame is defined in terms of rows, and
+//! the order of ties is unspecified to begin with.
+static bool WindowIgnoresPeers(const BoundWindowExpression *wexpr) {
+	switch (wexpr->type) {
+	case ExpressionType::WINDOW_RANK:
+	case ExpressionType::WINDOW_RANK_DENSE:
+	case ExpressionType::WINDOW_PERCENT_RANK:
+	case ExpressionType::WINDOW_CUME_DIST:
+		// rank-like functions are defined in terms of peer groups
+		return false;
+	default:
+		break;
+	}
+	// RANGE frame boundaries are defined in terms of peer groups
+	switch (wexpr->start) {
+	case WindowBoundary::CURRENT_ROW_RANGE:
+	case WindowBoundary::EXPR_PRECEDING_RANGE:
+	case WindowBoundary::EXPR_FOLLOWING_RANGE:
+		return false;
+	default:
+		break;
+	}
+	switch (wexpr->end) {
+	case WindowBoundary::CURRENT_ROW_RANGE:
+	case WindowBoundary::EXPR_PRECEDING_RANGE:
+	case WindowBoundary::EXPR_FOLLOWING_RANGE:
+		return false;
+	default:
+		break;
+	}
+	return true;
+}
+
+static bool WindowPartitionsAreEquivalent(const BoundWindowExpression *a, const BoundWindowExpression *b) {
+	if (a->partitions.size() != b->partitions.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < a->partitions.size(); i++) {
+		if (!Expression::Equals(a->partitions[i].get(), b->partitions[i].get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Returns true if the orders of the first expression are a prefix of the orders of the second one
+static bool WindowOrdersArePrefix(const BoundWindowExpression *prefix, const BoundWindowExpression *full) {
+	if (prefix->orders.size() > full->orders.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < prefix->orders.size(); i++) {
+		if (prefix->orders[i].type != full->orders[i].type) {
+			return false;
+		}
+		if (!BaseExpression::Equals((BaseExpression *)prefix->orders[i].expression.get(),
+		                            (BaseExpression *)full->orders[i].expression.get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -53,7 +137,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
-		if (IsStreamingWindow(op.expressions[expr_idx])) {
+		if (IsStreamingWindow(context, op.expressions[expr_idx])) {
 			streaming_windows.push_back(expr_idx);
 		} else {
 			blocking_windows.push_back(expr_idx);
@@ -62,6 +146,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 
 	// Process the window functions by sharing the partition/order definitions
 	vector<idx_t> evaluation_order;
+	bool reordered = false;
 	while (!blocking_windows.empty() || !streaming_windows.empty()) {
 		const bool process_streaming = blocking_windows.empty();
 		auto &remaining = process_streaming ? streaming_windows : blocking_windows;
@@ -70,6 +155,19 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 		const auto over_idx = remaining[0];
 		auto over_expr = reinterpret_cast<BoundWindowExpression *>(op.expressions[over_idx].get());
 
+		// If the leading expression does not depend on peer boundaries, it can also be evaluated over any sort order
+		// that extends its own ORDER BY. Use the longest such ORDER BY among the remaining expressions as the sort of
+		// the group, so that prefix-compatible window functions share a single sort instead of re-sorting the input.
+		if (!process_streaming && WindowIgnoresPeers(over_expr)) {
+			for (const auto &expr_idx : remaining) {
+				auto wexpr = reinterpret_cast<BoundWindowExpression *>(op.expressions[expr_idx].get());
+				if (wexpr->orders.size() > over_expr->orders.size() &&
+				    WindowPartitionsAreEquivalent(over_expr, wexpr) && WindowOrdersArePrefix(over_expr, wexpr)) {
+					over_expr = wexpr;
+				}
+			}
+		}
+
 		vector<idx_t> matching;
 		vector<idx_t> unprocessed;
 		for (const auto &expr_idx : remaining) {
@@ -77,12 +175,26 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 			auto wexpr = reinterpret_cast<BoundWindowExpression *>(op.expressions[expr_idx].get());
 			if (over_expr->KeysAreCompatible(wexpr)) {
 				matching.emplace_back(expr_idx);
+			} else if (!process_streaming && WindowIgnoresPeers(wexpr) &&
+			           WindowPartitionsAreEquivalent(over_expr, wexpr) && WindowOrdersArePrefix(wexpr, over_expr)) {
+				// the sort of this group extends the ORDER BY of this peer-insensitive expression
+				matching.emplace_back(expr_idx);
 			} else {
 				unprocessed.emplace_back(expr_idx);
 			}
 		}
 		remaining.swap(unprocessed);
 
+		// The expression that defines the sort of the group has to lead the select list, because the window operator
+		// sorts by the partition/order clause of its first expression
+		for (idx_t i = 1; i < matching.size(); i++) {
+			if (op.expressions[matching[i]].get() == (Expression *)over_expr) {
+				std::swap(matching[0], matching[i]);
+				reordered = true;
+				break;
+			}
+		}
+
 		// Extract the matching expressions
 		vector<unique_ptr<Expression>> select_list;
 		for (const auto &expr_idx : matching) {
@@ -101,7 +213,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 		plan = std::move(window);
 
 		// Remember the projection order if we changed it
-		if (!streaming_windows.empty() || !blocking_windows.empty() || !evaluation_order.empty()) {
+		if (!streaming_windows.empty() || !blocking_windows.empty() || !evaluation_order.empty() || reordered) {
 			evaluation_order.insert(evaluation_order.end(), matching.begin(), matching.end());
 		}
 	}
@@ -192,6 +192,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOperator &
 	case LogicalOperatorType::LOGICAL_CTE_REF:
 		plan = CreatePlan((LogicalCTERef &)op);
 		break;
+	case LogicalOperatorType::LOGICAL_MATERIALIZE:
+		plan = CreatePlan((LogicalMaterialize &)op);
+		break;
+	case LogicalOperatorType::LOGICAL_MATERIALIZE_SCAN:
+		plan = CreatePlan((LogicalMaterializeScan &)op);
+		break;
 	case LogicalOperatorType::LOGICAL_EXPORT:
 		plan = CreatePlan((LogicalExport &)op);
 		break;
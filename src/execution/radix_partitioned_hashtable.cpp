@@ -2,6 +2,11 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/parallel/event.hpp"
+#include "duckdb/common/types/partitioned_column_data.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -51,11 +56,61 @@ RadixPartitionedHashTable::RadixPartitionedHashTable(GroupingSet &grouping_set_p
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+//! AggregatePartitionedColumnData spills aggregate input data to disk, partitioned on the group hash in the same
+//! way as PartitionableHashTable, so that it can be aggregated per-partition in the finalize phase
+class AggregatePartitionedColumnData : public PartitionedColumnData {
+public:
+	AggregatePartitionedColumnData(ClientContext &context, vector<LogicalType> types_p,
+	                               RadixPartitionInfo &partition_info_p)
+	    : PartitionedColumnData(PartitionedColumnDataType::RADIX, context, std::move(types_p)),
+	      partition_info(partition_info_p) {
+		// this class is never created through CreateShared, local copies are made with the copy constructor instead
+		allocators->allocators.reserve(partition_info.n_partitions);
+		for (idx_t i = 0; i < partition_info.n_partitions; i++) {
+			CreateAllocator();
+		}
+	}
+
+	AggregatePartitionedColumnData(const AggregatePartitionedColumnData &other)
+	    : PartitionedColumnData(other), partition_info(other.partition_info) {
+		for (idx_t i = 0; i < partition_info.n_partitions; i++) {
+			partitions.emplace_back(CreatePartitionCollection(i));
+		}
+	}
+
+protected:
+	void InitializeAppendStateInternal(PartitionedColumnDataAppendState &state) const override {
+		state.partition_buffers.reserve(partition_info.n_partitions);
+		state.partition_append_states.reserve(partition_info.n_partitions);
+		for (idx_t i = 0; i < partition_info.n_partitions; i++) {
+			state.partition_append_states.emplace_back(make_unique<ColumnDataAppendState>());
+			partitions[i]->InitializeAppend(*state.partition_append_states[i]);
+			state.partition_buffers.emplace_back(CreatePartitionBuffer());
+		}
+	}
+
+	void ComputePartitionIndices(PartitionedColumnDataAppendState &state, DataChunk &input) override {
+		// the group hashes are stored in the last column of the spill chunk
+		auto &hashes = input.data.back();
+		UnaryExecutor::Execute<hash_t, hash_t>(hashes, state.partition_indices, input.size(),
+		                                       [&](hash_t hash) { return partition_info.GetHashPartition(hash); });
+	}
+
+private:
+	RadixPartitionInfo &partition_info;
+};
+
 class RadixHTGlobalState : public GlobalSinkState {
 public:
 	explicit RadixHTGlobalState(ClientContext &context)
 	    : is_empty(true), multi_scan(true), total_groups(0),
 	      partition_info((idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads()) {
+		// memory usage per thread scales with max mem / num threads
+		double max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory(context);
+		double num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		// HT may not exceed 60% of memory
+		sink_memory_per_thread = max_memory * 0.6 / num_threads;
+		force_spill = ClientConfig::GetConfig(context).force_external;
 	}
 
 	vector<unique_ptr<PartitionableHashTable>> intermediate_hts;
@@ -74,6 +129,18 @@ public:
 	bool is_partitioned = false;
 
 	RadixPartitionInfo partition_info;
+
+	//! The memory budget of a single thread's HT - when exceeded, further input is spilled to disk
+	idx_t sink_memory_per_thread;
+	//! Whether to spill regardless of the memory budget (set by force_external, for testing)
+	bool force_spill;
+	//! Input data that was spilled to disk because the HTs exceeded the memory budget
+	//! (the spill chunks hold the group columns, the payload columns, and the group hash)
+	unique_ptr<AggregatePartitionedColumnData> spill_partitions;
+	//! The number of group columns in the spilled data
+	idx_t spill_group_count = 0;
+	//! The aggregate filter columns, needed to aggregate the spilled data in the finalize phase
+	vector<idx_t> spill_filter;
 };
 
 class RadixHTLocalState : public LocalSinkState {
@@ -92,6 +159,11 @@ public:
 
 	//! Whether or not any tuples were added to the HT
 	bool is_empty;
+
+	//! The spilled input data of this thread (created when the HT exceeds the memory budget)
+	unique_ptr<AggregatePartitionedColumnData> spill_partitions;
+	PartitionedColumnDataAppendState spill_append_state;
+	DataChunk spill_chunk;
 };
 
 void RadixPartitionedHashTable::SetMultiScan(GlobalSinkState &state) {
@@ -159,9 +231,52 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, GlobalSinkState
 		                                        group_types, op.payload_types, op.bindings);
 	}
 
+	if (llstate.spill_partitions) {
+		// this thread's HT exceeded the memory budget: spill the input instead of aggregating it,
+		// the spilled data is aggregated per-partition in the finalize phase
+		Vector hashes(LogicalType::HASH);
+		group_chunk.Hash(hashes);
+		auto &spill_chunk = llstate.spill_chunk;
+		spill_chunk.Reset();
+		idx_t spill_col_idx = 0;
+		for (idx_t col_idx = 0; col_idx < group_chunk.ColumnCount(); col_idx++) {
+			spill_chunk.data[spill_col_idx++].Reference(group_chunk.data[col_idx]);
+		}
+		for (idx_t col_idx = 0; col_idx < payload_input.ColumnCount(); col_idx++) {
+			spill_chunk.data[spill_col_idx++].Reference(payload_input.data[col_idx]);
+		}
+		spill_chunk.data[spill_col_idx].Reference(hashes);
+		spill_chunk.SetCardinality(group_chunk.size());
+		llstate.spill_partitions->Append(llstate.spill_append_state, spill_chunk);
+		return;
+	}
+
 	gstate.total_groups +=
 	    llstate.ht->AddChunk(group_chunk, payload_input,
 	                         gstate.total_groups > radix_limit && gstate.partition_info.n_partitions > 1, filter);
+
+	// if the HT exceeds the memory budget we switch to spilling: any further input of this thread is written to
+	// disk, partitioned on the group hash, so the finalize phase only needs one partition's HT in memory at a time
+	if (gstate.partition_info.n_partitions > 1 &&
+	    (gstate.force_spill || llstate.ht->TotalSize() > gstate.sink_memory_per_thread)) {
+		vector<LogicalType> spill_types = group_types;
+		for (auto &payload_type : op.payload_types) {
+			spill_types.push_back(payload_type);
+		}
+		spill_types.emplace_back(LogicalType::HASH);
+		{
+			lock_guard<mutex> glock(gstate.lock);
+			if (!gstate.spill_partitions) {
+				gstate.spill_partitions = make_unique<AggregatePartitionedColumnData>(context.client, spill_types,
+				                                                                      gstate.partition_info);
+				gstate.spill_group_count = group_types.size();
+				gstate.spill_filter = filter;
+			}
+			llstate.spill_partitions = make_unique<AggregatePartitionedColumnData>(*gstate.spill_partitions);
+		}
+		llstate.spill_partitions->InitializeAppendState(llstate.spill_append_state);
+		llstate.spill_chunk.Initialize(Allocator::Get(context.client), spill_types);
+	}
 }
 
 void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkState &state,
@@ -197,6 +312,14 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 
 	// at this point we just collect them the PhysicalHashAggregateFinalizeTask (below) will merge them in parallel
 	gstate.intermediate_hts.push_back(std::move(llstate.ht));
+
+	if (llstate.spill_partitions) {
+		// add the input data that this thread spilled to the global spilled data
+		llstate.spill_partitions->FlushAppendState(llstate.spill_append_state);
+		D_ASSERT(gstate.spill_partitions);
+		gstate.spill_partitions->Combine(*llstate.spill_partitions);
+		llstate.spill_partitions.reset();
+	}
 }
 
 bool RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState &gstate_p) const {
@@ -223,6 +346,11 @@ bool RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 		}
 	}
 
+	// the spilled input data is partitioned on the group hash, so if we spilled, the HTs have to be partitioned too
+	if (gstate.spill_partitions) {
+		any_partitioned = true;
+	}
+
 	auto &allocator = Allocator::Get(context);
 	if (any_partitioned) {
 		// if one is partitioned, all have to be
@@ -261,6 +389,44 @@ bool RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 	}
 }
 
+void RadixPartitionedHashTable::Rollup(ClientContext &context, GlobalSinkState &state_p,
+                                       const RadixPartitionedHashTable &other, GlobalSinkState &other_state_p) const {
+	auto &gstate = (RadixHTGlobalState &)state_p;
+	auto &other_gstate = (RadixHTGlobalState &)other_state_p;
+	D_ASSERT(!gstate.is_finalized);
+	D_ASSERT(other_gstate.is_finalized);
+	D_ASSERT(gstate.intermediate_hts.empty());
+
+	// map each of this HT's group columns to the corresponding group column of the other HT
+	vector<column_t> column_ids;
+	if (grouping_set.empty()) {
+		// aggregation without groups: all of the other HT's groups collapse into the single constant group
+		column_ids.push_back(DConstants::INVALID_INDEX);
+	} else {
+		for (auto &entry : grouping_set) {
+			idx_t other_idx = 0;
+			for (auto &other_entry : other.grouping_set) {
+				if (other_entry == entry) {
+					break;
+				}
+				other_idx++;
+			}
+			D_ASSERT(other_idx < other.grouping_set.size());
+			column_ids.push_back(other_idx);
+		}
+	}
+
+	// roll all of the other HT's finalized HTs up into a single finalized HT
+	gstate.finalized_hts.push_back(make_shared<GroupedAggregateHashTable>(
+	    context, Allocator::Get(context), group_types, op.payload_types, op.bindings, HtEntryType::HT_WIDTH_64));
+	for (auto &other_ht : other_gstate.finalized_hts) {
+		gstate.finalized_hts[0]->CombineRollup(*other_ht, column_ids);
+	}
+	gstate.finalized_hts[0]->Finalize();
+	gstate.is_empty = other_gstate.is_empty;
+	gstate.is_finalized = true;
+}
+
 // this task is run in multiple threads and combines the radix-partitioned hash tables into a single onen and then
 // folds them into the global ht finally.
 class RadixAggregateFinalizeTask : public ExecutorTask {
@@ -279,6 +445,40 @@ public:
 				ht.reset();
 			}
 		}
+		if (gstate.spill_partitions) {
+			// aggregate the input data that was spilled to disk for this partition
+			auto &spill_partition = gstate.spill_partitions->GetPartitions()[radix];
+			auto &types = spill_partition->Types();
+			vector<column_t> group_column_ids;
+			vector<column_t> payload_column_ids;
+			for (idx_t col_idx = 0; col_idx < types.size() - 1; col_idx++) {
+				if (col_idx < gstate.spill_group_count) {
+					group_column_ids.push_back(col_idx);
+				} else {
+					payload_column_ids.push_back(col_idx);
+				}
+			}
+			vector<LogicalType> group_types(types.begin(), types.begin() + gstate.spill_group_count);
+			vector<LogicalType> payload_types(types.begin() + gstate.spill_group_count, types.end() - 1);
+
+			DataChunk scan_chunk, group_chunk, payload_chunk;
+			spill_partition->InitializeScanChunk(scan_chunk);
+			group_chunk.InitializeEmpty(group_types);
+			if (!payload_types.empty()) {
+				payload_chunk.InitializeEmpty(payload_types);
+			}
+
+			ColumnDataScanState scan_state;
+			spill_partition->InitializeScan(scan_state);
+			while (spill_partition->Scan(scan_state, scan_chunk)) {
+				group_chunk.ReferenceColumns(scan_chunk, group_column_ids);
+				payload_chunk.ReferenceColumns(scan_chunk, payload_column_ids);
+				// the group hash was materialized in the last column of the spill chunk
+				gstate.finalized_hts[radix]->AddChunk(group_chunk, scan_chunk.data.back(), payload_chunk,
+				                                      gstate.spill_filter);
+			}
+			spill_partition.reset();
+		}
 		gstate.finalized_hts[radix]->Finalize();
 	}
 
@@ -389,17 +589,18 @@ void RadixPartitionedHashTable::GetData(ExecutionContext &context, DataChunk &ch
 			chunk.data[null_group].SetVectorType(VectorType::CONSTANT_VECTOR);
 			ConstantVector::SetNull(chunk.data[null_group], true);
 		}
+		ArenaAllocator allocator(Allocator::DefaultAllocator());
 		for (idx_t i = 0; i < op.aggregates.size(); i++) {
 			D_ASSERT(op.aggregates[i]->GetExpressionClass() == ExpressionClass::BOUND_AGGREGATE);
 			auto &aggr = (BoundAggregateExpression &)*op.aggregates[i];
 			auto aggr_state = unique_ptr<data_t[]>(new data_t[aggr.function.state_size()]);
 			aggr.function.initialize(aggr_state.get());
 
-			AggregateInputData aggr_input_data(aggr.bind_info.get(), Allocator::DefaultAllocator());
+			AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
 			Vector state_vector(Value::POINTER((uintptr_t)aggr_state.get()));
 			aggr.function.finalize(state_vector, aggr_input_data, chunk.data[null_groups.size() + i], 1, 0);
 			if (aggr.function.destructor) {
-				aggr.function.destructor(state_vector, 1);
+				aggr.function.destructor(state_vector, aggr_input_data, 1);
 			}
 		}
 		// Place the grouping values (all the groups of the grouping_set condensed into a single value)
@@ -1,5 +1,6 @@
 #include "duckdb/execution/reservoir_sample.hpp"
 #include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 
@@ -24,34 +25,37 @@ void ReservoirSample::AddToReservoir(DataChunk &input) {
 	// find the position of next_index relative to current_count
 	idx_t remaining = input.size();
 	idx_t base_offset = 0;
+	// gather the rows of this chunk that enter the sample, and the reservoir slot each of them lands in
+	// with high sample rates a slot can be replaced several times within a single chunk; only the last
+	// row written to a slot survives, so the skip/weight bookkeeping is separated from the row copies
+	unordered_map<idx_t, idx_t> replacements;
 	while (true) {
 		idx_t offset = base_reservoir_sample.next_index - base_reservoir_sample.current_count;
 		if (offset >= remaining) {
 			// not in this chunk! increment current count and go to the next chunk
 			base_reservoir_sample.current_count += remaining;
-			return;
+			break;
 		}
-		// in this chunk! replace the element
-		ReplaceElement(input, base_offset + offset);
+		// in this chunk! mark the element as the current content of the minimum slot
+		// 8. The item in R with the minimum key is replaced by item vi
+		replacements[base_reservoir_sample.min_entry] = base_offset + offset;
+		base_reservoir_sample.ReplaceElement();
 		// shift the chunk forward
 		remaining -= offset;
 		base_offset += offset;
 	}
+	// now copy the surviving rows into their reservoir slots in one pass
+	for (auto &replacement : replacements) {
+		for (idx_t col_idx = 0; col_idx < input.ColumnCount(); col_idx++) {
+			reservoir.SetValue(col_idx, replacement.first, input.GetValue(col_idx, replacement.second));
+		}
+	}
 }
 
 unique_ptr<DataChunk> ReservoirSample::GetChunk() {
 	return reservoir.Fetch();
 }
 
-void ReservoirSample::ReplaceElement(DataChunk &input, idx_t index_in_chunk) {
-	// replace the entry in the reservoir
-	// 8. The item in R with the minimum key is replaced by item vi
-	for (idx_t col_idx = 0; col_idx < input.ColumnCount(); col_idx++) {
-		reservoir.SetValue(col_idx, base_reservoir_sample.min_entry, input.GetValue(col_idx, index_in_chunk));
-	}
-	base_reservoir_sample.ReplaceElement();
-}
-
 idx_t ReservoirSample::FillReservoir(DataChunk &input) {
 	idx_t chunk_count = input.size();
 	input.Flatten();
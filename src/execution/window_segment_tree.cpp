@@ -6,27 +6,43 @@
 
 namespace duckdb {
 
-WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData *bind_info,
-                                     const LogicalType &result_type_p, DataChunk *input,
-                                     const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
-    : aggregate(aggregate), bind_info(bind_info), result_type(result_type_p), state(aggregate.state_size()),
+WindowSegmentTree::LocalState::LocalState(WindowSegmentTree &tree_p)
+    : tree(tree_p), allocator(Allocator::DefaultAllocator()), state(tree_p.aggregate.state_size()),
       statep(Value::POINTER((idx_t)state.data())), frame(0, 0), statev(Value::POINTER((idx_t)state.data())),
-      internal_nodes(0), input_ref(input), filter_mask(filter_mask_p), mode(mode_p) {
-	statep.Flatten(input->size());
+      frame_rows(0), state_initialized(false) {
 	statev.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
 
-	if (input_ref && input_ref->ColumnCount() > 0) {
-		filter_sel.Initialize(input->size());
-		inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
-		// if we have a frame-by-frame method, share the single state
-		if (aggregate.window && UseWindowAPI()) {
-			AggregateInit();
-			inputs.Reference(*input_ref);
+	if (tree.input_ref && tree.input_ref->ColumnCount() > 0) {
+		statep.Flatten(tree.input_ref->size());
+		filter_sel.Initialize(tree.input_ref->size());
+		inputs.Initialize(Allocator::DefaultAllocator(), tree.input_ref->GetTypes());
+		// if we have a frame-by-frame method, the state is kept across frames
+		if (tree.aggregate.window && tree.UseWindowAPI()) {
+			tree.aggregate.initialize(state.data());
+			inputs.Reference(*tree.input_ref);
 		} else {
-			inputs.SetCapacity(*input_ref);
-			if (aggregate.combine && UseCombineAPI()) {
-				ConstructTree();
-			}
+			inputs.SetCapacity(*tree.input_ref);
+		}
+	}
+}
+
+WindowSegmentTree::LocalState::~LocalState() {
+	if (tree.aggregate.window && tree.UseWindowAPI() && tree.aggregate.destructor) {
+		AggregateInputData aggr_input_data(tree.bind_info, allocator);
+		tree.aggregate.destructor(statev, aggr_input_data, 1);
+	}
+}
+
+WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData *bind_info,
+                                     const LogicalType &result_type_p, DataChunk *input,
+                                     const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
+    : aggregate(aggregate), bind_info(bind_info), result_type(result_type_p),
+      allocator(Allocator::DefaultAllocator()), internal_nodes(0), input_ref(input), filter_mask(filter_mask_p),
+      mode(mode_p) {
+	if (input_ref && input_ref->ColumnCount() > 0) {
+		// when the running-state inverse path is used the segment tree is never queried, so don't build it
+		if (!(aggregate.window && UseWindowAPI()) && !UseInverseAPI() && aggregate.combine && UseCombineAPI()) {
+			ConstructTree();
 		}
 	}
 }
@@ -37,42 +53,41 @@ WindowSegmentTree::~WindowSegmentTree() {
 		return;
 	}
 	// call the destructor for all the intermediate states
+	AggregateInputData aggr_input_data(bind_info, allocator);
+	const auto state_size = aggregate.state_size();
 	data_ptr_t address_data[STANDARD_VECTOR_SIZE];
 	Vector addresses(LogicalType::POINTER, (data_ptr_t)address_data);
 	idx_t count = 0;
 	for (idx_t i = 0; i < internal_nodes; i++) {
-		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state.size());
+		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state_size);
 		if (count == STANDARD_VECTOR_SIZE) {
-			aggregate.destructor(addresses, count);
+			aggregate.destructor(addresses, aggr_input_data, count);
 			count = 0;
 		}
 	}
 	if (count > 0) {
-		aggregate.destructor(addresses, count);
-	}
-
-	if (aggregate.window && UseWindowAPI()) {
-		aggregate.destructor(statev, 1);
+		aggregate.destructor(addresses, aggr_input_data, count);
 	}
 }
 
-void WindowSegmentTree::AggregateInit() {
-	aggregate.initialize(state.data());
+void WindowSegmentTree::AggregateInit(LocalState &lstate) {
+	aggregate.initialize(lstate.state.data());
 }
 
-void WindowSegmentTree::AggegateFinal(Vector &result, idx_t rid) {
-	AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
-	aggregate.finalize(statev, aggr_input_data, result, 1, rid);
+void WindowSegmentTree::AggegateFinal(LocalState &lstate, Vector &result, idx_t rid) {
+	AggregateInputData aggr_input_data(bind_info, lstate.allocator);
+	aggregate.finalize(lstate.statev, aggr_input_data, result, 1, rid);
 
 	if (aggregate.destructor) {
-		aggregate.destructor(statev, 1);
+		aggregate.destructor(lstate.statev, aggr_input_data, 1);
 	}
 }
 
-void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
+void WindowSegmentTree::ExtractFrame(LocalState &lstate, idx_t begin, idx_t end) {
 	const auto size = end - begin;
 
 	auto &chunk = *input_ref;
+	auto &inputs = lstate.inputs;
 	const auto input_count = input_ref->ColumnCount();
 	inputs.SetCardinality(size);
 	for (idx_t i = 0; i < input_count; ++i) {
@@ -87,45 +102,104 @@ void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 		idx_t filtered = 0;
 		for (idx_t i = begin; i < end; ++i) {
 			if (filter_mask.RowIsValid(i)) {
-				filter_sel.set_index(filtered++, i - begin);
+				lstate.filter_sel.set_index(filtered++, i - begin);
 			}
 		}
 		if (filtered != inputs.size()) {
-			inputs.Slice(filter_sel, filtered);
+			inputs.Slice(lstate.filter_sel, filtered);
 		}
 	}
 }
 
-void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end) {
+void WindowSegmentTree::WindowSegmentValue(LocalState &lstate, idx_t l_idx, idx_t begin, idx_t end) {
 	D_ASSERT(begin <= end);
 	if (begin == end) {
 		return;
 	}
 
+	const auto state_size = lstate.state.size();
 	const auto count = end - begin;
-	Vector s(statep, 0, count);
+	Vector s(lstate.statep, 0, count);
 	if (l_idx == 0) {
-		ExtractFrame(begin, end);
-		AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
-		aggregate.update(&inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, inputs.size());
+		ExtractFrame(lstate, begin, end);
+		AggregateInputData aggr_input_data(bind_info, lstate.allocator);
+		aggregate.update(&lstate.inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, lstate.inputs.size());
 	} else {
 		// find out where the states begin
-		data_ptr_t begin_ptr = levels_flat_native.get() + state.size() * (begin + levels_flat_start[l_idx - 1]);
+		data_ptr_t begin_ptr = levels_flat_native.get() + state_size * (begin + levels_flat_start[l_idx - 1]);
 		// set up a vector of pointers that point towards the set of states
 		Vector v(LogicalType::POINTER, count);
 		auto pdata = FlatVector::GetData<data_ptr_t>(v);
 		for (idx_t i = 0; i < count; i++) {
-			pdata[i] = begin_ptr + i * state.size();
+			pdata[i] = begin_ptr + i * state_size;
 		}
 		v.Verify(count);
-		AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
+		AggregateInputData aggr_input_data(bind_info, lstate.allocator);
 		aggregate.combine(v, s, aggr_input_data, count);
 	}
 }
 
+void WindowSegmentTree::WindowDeltaValue(LocalState &lstate, idx_t begin, idx_t end, bool remove) {
+	D_ASSERT(begin <= end);
+	if (begin == end) {
+		return;
+	}
+	ExtractFrame(lstate, begin, end);
+	const auto count = lstate.inputs.size();
+	if (count == 0) {
+		// all rows in the range are filtered out
+		return;
+	}
+	Vector s(lstate.statep, 0, count);
+	AggregateInputData aggr_input_data(bind_info, lstate.allocator);
+	if (remove) {
+		D_ASSERT(lstate.frame_rows >= count);
+		aggregate.inverse(&lstate.inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, count);
+		lstate.frame_rows -= count;
+	} else {
+		aggregate.update(&lstate.inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, count);
+		lstate.frame_rows += count;
+	}
+}
+
+void WindowSegmentTree::ComputeInverse(LocalState &lstate, Vector &result, idx_t rid, idx_t begin, idx_t end) {
+	const auto prev = lstate.frame;
+	lstate.frame = FrameBounds(begin, end);
+
+	if (!lstate.state_initialized || end <= prev.first || prev.second <= begin) {
+		// no overlap with the previous frame: start over from a fresh state
+		AggregateInit(lstate);
+		lstate.state_initialized = true;
+		lstate.frame_rows = 0;
+		WindowDeltaValue(lstate, begin, end, false);
+	} else {
+		// the frames overlap: add the rows that entered the frame and remove the rows that left it
+		if (begin < prev.first) {
+			WindowDeltaValue(lstate, begin, prev.first, false);
+		} else {
+			WindowDeltaValue(lstate, prev.first, begin, true);
+		}
+		if (end > prev.second) {
+			WindowDeltaValue(lstate, prev.second, end, false);
+		} else {
+			WindowDeltaValue(lstate, end, prev.second, true);
+		}
+	}
+	if (lstate.frame_rows == 0) {
+		// reset to a canonical empty state, so that e.g. SUM over a fully filtered-out frame is NULL again
+		AggregateInit(lstate);
+	}
+	// finalize from the running state; AggegateFinal does not destroy it, as invertible aggregates have no destructor
+	AggegateFinal(lstate, result, rid);
+}
+
 void WindowSegmentTree::ConstructTree() {
 	D_ASSERT(input_ref);
-	D_ASSERT(inputs.ColumnCount() > 0);
+	D_ASSERT(input_ref->ColumnCount() > 0);
+
+	// scratch space for building the internal nodes
+	LocalState lstate(*this);
+	const auto state_size = aggregate.state_size();
 
 	// compute space required to store internal nodes of segment tree
 	internal_nodes = 0;
@@ -134,7 +208,7 @@ void WindowSegmentTree::ConstructTree() {
 		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
 		internal_nodes += level_nodes;
 	} while (level_nodes > 1);
-	levels_flat_native = unique_ptr<data_t[]>(new data_t[internal_nodes * state.size()]);
+	levels_flat_native = unique_ptr<data_t[]>(new data_t[internal_nodes * state_size]);
 	levels_flat_start.push_back(0);
 
 	idx_t levels_flat_offset = 0;
@@ -146,10 +220,10 @@ void WindowSegmentTree::ConstructTree() {
 	                                         : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
 		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
 			// compute the aggregate for this entry in the segment tree
-			AggregateInit();
-			WindowSegmentValue(level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
+			AggregateInit(lstate);
+			WindowSegmentValue(lstate, level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
 
-			memcpy(levels_flat_native.get() + (levels_flat_offset * state.size()), state.data(), state.size());
+			memcpy(levels_flat_native.get() + (levels_flat_offset * state_size), lstate.state.data(), state_size);
 
 			levels_flat_offset++;
 		}
@@ -162,30 +236,41 @@ void WindowSegmentTree::ConstructTree() {
 	if (levels_flat_offset == 0) {
 		aggregate.initialize(levels_flat_native.get());
 	}
+
+	// the internal node states were built through the scratch local state: move its arena into the tree
+	// so that any variable-size data they allocated stays alive for as long as the tree is
+	lstate.allocator.Move(allocator);
 }
 
-void WindowSegmentTree::Compute(Vector &result, idx_t rid, idx_t begin, idx_t end) {
+void WindowSegmentTree::Compute(LocalState &lstate, Vector &result, idx_t rid, idx_t begin, idx_t end) {
 	D_ASSERT(input_ref);
 
 	// If we have a window function, use that
 	if (aggregate.window && UseWindowAPI()) {
 		// Frame boundaries
-		auto prev = frame;
-		frame = FrameBounds(begin, end);
+		auto prev = lstate.frame;
+		lstate.frame = FrameBounds(begin, end);
 
 		// Extract the range
-		AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
-		aggregate.window(input_ref->data.data(), filter_mask, aggr_input_data, inputs.ColumnCount(), state.data(),
-		                 frame, prev, result, rid, 0);
+		AggregateInputData aggr_input_data(bind_info, lstate.allocator);
+		aggregate.window(input_ref->data.data(), filter_mask, aggr_input_data, lstate.inputs.ColumnCount(),
+		                 lstate.state.data(), lstate.frame, prev, result, rid, 0);
+		return;
+	}
+
+	// If the aggregate can remove rows from its state again, maintain a running state instead of querying
+	// the segment tree: sliding frames then cost O(1) amortized per row instead of O(log n)
+	if (UseInverseAPI()) {
+		ComputeInverse(lstate, result, rid, begin, end);
 		return;
 	}
 
-	AggregateInit();
+	AggregateInit(lstate);
 
 	// Aggregate everything at once if we can't combine states
 	if (!aggregate.combine || !UseCombineAPI()) {
-		WindowSegmentValue(0, begin, end);
-		AggegateFinal(result, rid);
+		WindowSegmentValue(lstate, 0, begin, end);
+		AggegateFinal(lstate, result, rid);
 		return;
 	}
 
@@ -193,23 +278,23 @@ void WindowSegmentTree::Compute(Vector &result, idx_t rid, idx_t begin, idx_t en
 		idx_t parent_begin = begin / TREE_FANOUT;
 		idx_t parent_end = end / TREE_FANOUT;
 		if (parent_begin == parent_end) {
-			WindowSegmentValue(l_idx, begin, end);
+			WindowSegmentValue(lstate, l_idx, begin, end);
 			break;
 		}
 		idx_t group_begin = parent_begin * TREE_FANOUT;
 		if (begin != group_begin) {
-			WindowSegmentValue(l_idx, begin, group_begin + TREE_FANOUT);
+			WindowSegmentValue(lstate, l_idx, begin, group_begin + TREE_FANOUT);
 			parent_begin++;
 		}
 		idx_t group_end = parent_end * TREE_FANOUT;
 		if (end != group_end) {
-			WindowSegmentValue(l_idx, group_end, end);
+			WindowSegmentValue(lstate, l_idx, group_end, end);
 		}
 		begin = parent_begin;
 		end = parent_end;
 	}
 
-	AggegateFinal(result, rid);
+	AggegateFinal(lstate, result, rid);
 }
 
 } // namespace duckdb
@@ -72,6 +72,15 @@ struct AverageSetOperation {
 	}
 };
 
+//! State operation for the window inverse of AVG: decrements the row count of values that leave the frame.
+//! Only the AddValues member is ever instantiated, since the inverse is exclusively used as an update function.
+struct AverageInverseSetOperation {
+	template <class STATE>
+	static void AddValues(STATE *state, idx_t count) {
+		state->count -= count;
+	}
+};
+
 template <class T>
 static T GetAverageDivident(uint64_t count, FunctionData *bind_data) {
 	T divident = T(count);
@@ -152,20 +161,39 @@ struct KahanAverageOperation : public BaseSumOperation<AverageSetOperation, Kaha
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16: {
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
+		auto function = AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
 		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		function.inverse =
+		    AggregateFunction::UnaryScatterUpdate<AvgState<int64_t>, int16_t,
+		                                          BaseSumOperation<AverageInverseSetOperation, RegularSubtract>>;
+		return function;
 	}
 	case PhysicalType::INT32: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::INTEGER, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::INTEGER, LogicalType::DOUBLE);
+		function.inverse =
+		    AggregateFunction::UnaryScatterUpdate<AvgState<hugeint_t>, int32_t,
+		                                          BaseSumOperation<AverageInverseSetOperation, HugeintSubtract>>;
+		return function;
 	}
 	case PhysicalType::INT64: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::BIGINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.inverse =
+		    AggregateFunction::UnaryScatterUpdate<AvgState<hugeint_t>, int64_t,
+		                                          BaseSumOperation<AverageInverseSetOperation, HugeintSubtract>>;
+		return function;
 	}
 	case PhysicalType::INT128: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
-		    LogicalType::HUGEINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
+		        LogicalType::HUGEINT, LogicalType::DOUBLE);
+		function.inverse =
+		    AggregateFunction::UnaryScatterUpdate<AvgState<hugeint_t>, hugeint_t,
+		                                          BaseSumOperation<AverageInverseSetOperation, RegularSubtract>>;
+		return function;
 	}
 	default:
 		throw InternalException("Unimplemented average aggregate");
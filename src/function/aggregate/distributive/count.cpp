@@ -72,11 +72,29 @@ struct CountFunction : public BaseCountFunction {
 	}
 };
 
+struct CountInverseFunction : public BaseCountFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE *state, AggregateInputData &, INPUT_TYPE *input, ValidityMask &mask, idx_t idx) {
+		*state -= 1;
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE *state, AggregateInputData &, INPUT_TYPE *input, ValidityMask &mask,
+	                              idx_t count) {
+		*state -= count;
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
 AggregateFunction CountFun::GetFunction() {
 	auto fun = AggregateFunction::UnaryAggregate<int64_t, int64_t, int64_t, CountFunction>(
 	    LogicalType(LogicalTypeId::ANY), LogicalType::BIGINT);
 	fun.name = "count";
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	fun.inverse = AggregateFunction::UnaryScatterUpdate<int64_t, int64_t, CountInverseFunction>;
 	return fun;
 }
 
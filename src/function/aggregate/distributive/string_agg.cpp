@@ -6,6 +6,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/common/field_writer.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
@@ -47,37 +48,29 @@ struct StringAggFunction {
 		}
 	}
 
-	template <class STATE>
-	static void Destroy(STATE *state) {
-		if (state->dataptr) {
-			delete[] state->dataptr;
-		}
-	}
-
 	static bool IgnoreNull() {
 		return true;
 	}
 
-	static inline void PerformOperation(StringAggState *state, const char *str, const char *sep, idx_t str_size,
-	                                    idx_t sep_size) {
+	static inline void PerformOperation(StringAggState *state, ArenaAllocator &allocator, const char *str,
+	                                    const char *sep, idx_t str_size, idx_t sep_size) {
 		if (!state->dataptr) {
 			// first iteration: allocate space for the string and copy it into the state
 			state->alloc_size = MaxValue<idx_t>(8, NextPowerOfTwo(str_size));
-			state->dataptr = new char[state->alloc_size];
+			state->dataptr = (char *)allocator.Allocate(state->alloc_size);
 			state->size = str_size;
 			memcpy(state->dataptr, str, str_size);
 		} else {
 			// subsequent iteration: first check if we have space to place the string and separator
 			idx_t required_size = state->size + str_size + sep_size;
 			if (required_size > state->alloc_size) {
-				// no space! allocate extra space
-				while (state->alloc_size < required_size) {
-					state->alloc_size *= 2;
+				// no space! grow the allocation
+				idx_t new_size = state->alloc_size;
+				while (new_size < required_size) {
+					new_size *= 2;
 				}
-				auto new_data = new char[state->alloc_size];
-				memcpy(new_data, state->dataptr, state->size);
-				delete[] state->dataptr;
-				state->dataptr = new_data;
+				state->dataptr = (char *)allocator.Reallocate((data_ptr_t)state->dataptr, state->alloc_size, new_size);
+				state->alloc_size = new_size;
 			}
 			// copy the separator
 			memcpy(state->dataptr + state->size, sep, sep_size);
@@ -88,15 +81,16 @@ struct StringAggFunction {
 		}
 	}
 
-	static inline void PerformOperation(StringAggState *state, string_t str, FunctionData *data_p) {
+	static inline void PerformOperation(StringAggState *state, ArenaAllocator &allocator, string_t str,
+	                                    FunctionData *data_p) {
 		auto &data = (StringAggBindData &)*data_p;
-		PerformOperation(state, str.GetDataUnsafe(), data.sep.c_str(), str.GetSize(), data.sep.size());
+		PerformOperation(state, allocator, str.GetDataUnsafe(), data.sep.c_str(), str.GetSize(), data.sep.size());
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
 	static void Operation(STATE *state, AggregateInputData &aggr_input_data, INPUT_TYPE *str_data,
 	                      ValidityMask &str_mask, idx_t str_idx) {
-		PerformOperation(state, str_data[str_idx], aggr_input_data.bind_data);
+		PerformOperation(state, aggr_input_data.allocator, str_data[str_idx], aggr_input_data.bind_data);
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
@@ -113,7 +107,8 @@ struct StringAggFunction {
 			// source is not set: skip combining
 			return;
 		}
-		PerformOperation(target, string_t(source.dataptr, source.size), aggr_input_data.bind_data);
+		PerformOperation(target, aggr_input_data.allocator, string_t(source.dataptr, source.size),
+		                 aggr_input_data.bind_data);
 	}
 };
 
@@ -159,8 +154,7 @@ void StringAggFun::RegisterFunction(BuiltinFunctions &set) {
 	    AggregateFunction::UnaryScatterUpdate<StringAggState, string_t, StringAggFunction>,
 	    AggregateFunction::StateCombine<StringAggState, StringAggFunction>,
 	    AggregateFunction::StateFinalize<StringAggState, string_t, StringAggFunction>,
-	    AggregateFunction::UnaryUpdate<StringAggState, string_t, StringAggFunction>, StringAggBind,
-	    AggregateFunction::StateDestroy<StringAggState, StringAggFunction>);
+	    AggregateFunction::UnaryUpdate<StringAggState, string_t, StringAggFunction>, StringAggBind);
 	string_agg_param.serialize = StringAggSerialize;
 	string_agg_param.deserialize = StringAggDeserialize;
 	string_agg.AddFunction(string_agg_param);
@@ -115,6 +115,8 @@ AggregateFunction SumFun::GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		function.inverse = AggregateFunction::UnaryScatterUpdate<SumState<int64_t>, int16_t,
+		                                                         BaseSumOperation<SumSetOperation, RegularSubtract>>;
 		return function;
 	}
 
@@ -123,6 +125,8 @@ AggregateFunction SumFun::GetSumAggregate(PhysicalType type) {
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
+		function.inverse = AggregateFunction::UnaryScatterUpdate<SumState<hugeint_t>, int32_t,
+		                                                         BaseSumOperation<SumSetOperation, HugeintSubtract>>;
 		return function;
 	}
 	case PhysicalType::INT64: {
@@ -130,12 +134,16 @@ AggregateFunction SumFun::GetSumAggregate(PhysicalType type) {
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
+		function.inverse = AggregateFunction::UnaryScatterUpdate<SumState<hugeint_t>, int64_t,
+		                                                         BaseSumOperation<SumSetOperation, HugeintSubtract>>;
 		return function;
 	}
 	case PhysicalType::INT128: {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
 		        LogicalType::HUGEINT, LogicalType::HUGEINT);
+		function.inverse = AggregateFunction::UnaryScatterUpdate<SumState<hugeint_t>, hugeint_t,
+		                                                         BaseSumOperation<SumSetOperation, RegularSubtract>>;
 		return function;
 	}
 	default:
@@ -149,12 +157,16 @@ AggregateFunction SumFun::GetSumAggregateNoOverflow(PhysicalType type) {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
+		function.inverse = AggregateFunction::UnaryScatterUpdate<SumState<int64_t>, int32_t,
+		                                                         BaseSumOperation<SumSetOperation, RegularSubtract>>;
 		return function;
 	}
 	case PhysicalType::INT64: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
+		function.inverse = AggregateFunction::UnaryScatterUpdate<SumState<int64_t>, int64_t,
+		                                                         BaseSumOperation<SumSetOperation, RegularSubtract>>;
 		return function;
 	}
 	default:
@@ -17,38 +17,43 @@ struct ApproxQuantileState {
 };
 
 struct ApproximateQuantileBindData : public FunctionData {
-	explicit ApproximateQuantileBindData(float quantile_p) : quantiles(1, quantile_p) {
+	//! The default t-digest compression: higher values keep more centroids per group, giving a more accurate
+	//! estimate at the cost of more memory
+	static constexpr const int32_t DEFAULT_ACCURACY = 100;
+
+	ApproximateQuantileBindData(float quantile_p, int32_t accuracy_p)
+	    : quantiles(1, quantile_p), accuracy(accuracy_p) {
 	}
 
-	explicit ApproximateQuantileBindData(vector<float> quantiles_p) : quantiles(std::move(quantiles_p)) {
+	ApproximateQuantileBindData(vector<float> quantiles_p, int32_t accuracy_p)
+	    : quantiles(std::move(quantiles_p)), accuracy(accuracy_p) {
 	}
 
 	unique_ptr<FunctionData> Copy() const override {
-		return make_unique<ApproximateQuantileBindData>(quantiles);
+		return make_unique<ApproximateQuantileBindData>(quantiles, accuracy);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = (ApproximateQuantileBindData &)other_p;
-		//		return quantiles == other.quantiles;
-		if (quantiles != other.quantiles) {
-			return false;
-		}
-		return true;
+		return quantiles == other.quantiles && accuracy == other.accuracy;
 	}
 
 	static void Serialize(FieldWriter &writer, const FunctionData *bind_data_p, const AggregateFunction &function) {
 		D_ASSERT(bind_data_p);
 		auto bind_data = (ApproximateQuantileBindData *)bind_data_p;
 		writer.WriteList<float>(bind_data->quantiles);
+		writer.WriteField<int32_t>(bind_data->accuracy);
 	}
 
 	static unique_ptr<FunctionData> Deserialize(ClientContext &context, FieldReader &reader,
 	                                            AggregateFunction &bound_function) {
 		auto quantiles = reader.ReadRequiredList<float>();
-		return make_unique<ApproximateQuantileBindData>(std::move(quantiles));
+		auto accuracy = reader.ReadRequired<int32_t>();
+		return make_unique<ApproximateQuantileBindData>(std::move(quantiles), accuracy);
 	}
 
 	vector<float> quantiles;
+	int32_t accuracy;
 };
 
 struct ApproxQuantileOperation {
@@ -69,9 +74,12 @@ struct ApproxQuantileOperation {
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
-	static void Operation(STATE *state, AggregateInputData &, INPUT_TYPE *data, ValidityMask &mask, idx_t idx) {
+	static void Operation(STATE *state, AggregateInputData &aggr_input_data, INPUT_TYPE *data, ValidityMask &mask,
+	                      idx_t idx) {
 		if (!state->h) {
-			state->h = new duckdb_tdigest::TDigest(100);
+			D_ASSERT(aggr_input_data.bind_data);
+			auto bind_data = (ApproximateQuantileBindData *)aggr_input_data.bind_data;
+			state->h = new duckdb_tdigest::TDigest(bind_data->accuracy);
 		}
 
 		state->h->add(Cast::template Operation<INPUT_TYPE, SAVE_TYPE>(data[idx]));
@@ -79,13 +87,15 @@ struct ApproxQuantileOperation {
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE *target, AggregateInputData &) {
+	static void Combine(const STATE &source, STATE *target, AggregateInputData &aggr_input_data) {
 		if (source.pos == 0) {
 			return;
 		}
 		D_ASSERT(source.h);
 		if (!target->h) {
-			target->h = new duckdb_tdigest::TDigest(100);
+			D_ASSERT(aggr_input_data.bind_data);
+			auto bind_data = (ApproximateQuantileBindData *)aggr_input_data.bind_data;
+			target->h = new duckdb_tdigest::TDigest(bind_data->accuracy);
 		}
 		target->h->merge(source.h);
 		target->pos += source.pos;
@@ -163,6 +173,7 @@ static float CheckApproxQuantile(const Value &quantile_val) {
 
 unique_ptr<FunctionData> BindApproxQuantile(ClientContext &context, AggregateFunction &function,
                                             vector<unique_ptr<Expression>> &arguments) {
+	D_ASSERT(arguments.size() >= 2);
 	if (arguments[1]->HasParameter()) {
 		throw ParameterNotResolvedException();
 	}
@@ -180,9 +191,29 @@ unique_ptr<FunctionData> BindApproxQuantile(ClientContext &context, AggregateFun
 		}
 	}
 
-	// remove the quantile argument so we can use the unary aggregate
+	if (arguments.size() == 2) {
+		// remove the quantile argument so we can use the unary aggregate
+		Function::EraseArgument(function, arguments, arguments.size() - 1);
+		return make_unique<ApproximateQuantileBindData>(quantiles, ApproximateQuantileBindData::DEFAULT_ACCURACY);
+	}
+
+	// the optional third argument sets the size of the t-digest that is kept per group
+	if (!arguments[2]->IsFoldable()) {
+		throw BinderException("APPROXIMATE QUANTILE can only take constant accuracy parameters");
+	}
+	Value accuracy_val = ExpressionExecutor::EvaluateScalar(context, *arguments[2]);
+	if (accuracy_val.IsNull()) {
+		throw BinderException("Accuracy of APPROXIMATE QUANTILE cannot be NULL");
+	}
+	auto accuracy = accuracy_val.GetValue<int32_t>();
+	if (accuracy <= 0) {
+		throw BinderException("Accuracy of APPROXIMATE QUANTILE must be bigger than 0");
+	}
+
+	// remove the accuracy and quantile arguments so we can use the unary aggregate
+	Function::EraseArgument(function, arguments, arguments.size() - 1);
 	Function::EraseArgument(function, arguments, arguments.size() - 1);
-	return make_unique<ApproximateQuantileBindData>(quantiles);
+	return make_unique<ApproximateQuantileBindData>(quantiles, accuracy);
 }
 
 unique_ptr<FunctionData> BindApproxQuantileDecimal(ClientContext &context, AggregateFunction &function,
@@ -347,30 +378,54 @@ AggregateFunction GetApproxQuantileListAggregate(const LogicalType &type) {
 	return fun;
 }
 
+static void DefineApproxQuantile(AggregateFunctionSet &set, PhysicalType type) {
+	//	Two versions: type[, accuracy]
+	auto fun = GetApproximateQuantileAggregate(type);
+	set.AddFunction(fun);
+
+	fun.arguments.emplace_back(LogicalType::INTEGER);
+	set.AddFunction(fun);
+}
+
+static void DefineApproxQuantileList(AggregateFunctionSet &set, const LogicalType &type) {
+	//	Two versions: type[, accuracy]
+	auto fun = GetApproxQuantileListAggregate(type);
+	set.AddFunction(fun);
+
+	fun.arguments.emplace_back(LogicalType::INTEGER);
+	set.AddFunction(fun);
+}
+
+static void DefineApproxQuantileDecimal(AggregateFunctionSet &set, const vector<LogicalType> &arguments,
+                                        const LogicalType &return_value, bind_aggregate_function_t bind) {
+	AggregateFunction fun(arguments, return_value, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, bind);
+	set.AddFunction(fun);
+
+	fun.arguments.emplace_back(LogicalType::INTEGER);
+	set.AddFunction(fun);
+}
+
 void ApproximateQuantileFun::RegisterFunction(BuiltinFunctions &set) {
 	AggregateFunctionSet approx_quantile("approx_quantile");
-	approx_quantile.AddFunction(AggregateFunction({LogicalTypeId::DECIMAL, LogicalType::FLOAT}, LogicalTypeId::DECIMAL,
-	                                              nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-	                                              BindApproxQuantileDecimal));
+	DefineApproxQuantileDecimal(approx_quantile, {LogicalTypeId::DECIMAL, LogicalType::FLOAT}, LogicalTypeId::DECIMAL,
+	                            BindApproxQuantileDecimal);
+	DefineApproxQuantileDecimal(approx_quantile, {LogicalTypeId::DECIMAL, LogicalType::LIST(LogicalType::FLOAT)},
+	                            LogicalType::LIST(LogicalTypeId::DECIMAL), BindApproxQuantileDecimalList);
 
-	approx_quantile.AddFunction(GetApproximateQuantileAggregate(PhysicalType::INT16));
-	approx_quantile.AddFunction(GetApproximateQuantileAggregate(PhysicalType::INT32));
-	approx_quantile.AddFunction(GetApproximateQuantileAggregate(PhysicalType::INT64));
-	approx_quantile.AddFunction(GetApproximateQuantileAggregate(PhysicalType::INT128));
-	approx_quantile.AddFunction(GetApproximateQuantileAggregate(PhysicalType::DOUBLE));
+	DefineApproxQuantile(approx_quantile, PhysicalType::INT16);
+	DefineApproxQuantile(approx_quantile, PhysicalType::INT32);
+	DefineApproxQuantile(approx_quantile, PhysicalType::INT64);
+	DefineApproxQuantile(approx_quantile, PhysicalType::INT128);
+	DefineApproxQuantile(approx_quantile, PhysicalType::DOUBLE);
 
 	// List variants
-	approx_quantile.AddFunction(AggregateFunction({LogicalTypeId::DECIMAL, LogicalType::LIST(LogicalType::FLOAT)},
-	                                              LogicalType::LIST(LogicalTypeId::DECIMAL), nullptr, nullptr, nullptr,
-	                                              nullptr, nullptr, nullptr, BindApproxQuantileDecimalList));
-
-	approx_quantile.AddFunction(GetApproxQuantileListAggregate(LogicalTypeId::TINYINT));
-	approx_quantile.AddFunction(GetApproxQuantileListAggregate(LogicalTypeId::SMALLINT));
-	approx_quantile.AddFunction(GetApproxQuantileListAggregate(LogicalTypeId::INTEGER));
-	approx_quantile.AddFunction(GetApproxQuantileListAggregate(LogicalTypeId::BIGINT));
-	approx_quantile.AddFunction(GetApproxQuantileListAggregate(LogicalTypeId::HUGEINT));
-	approx_quantile.AddFunction(GetApproxQuantileListAggregate(LogicalTypeId::FLOAT));
-	approx_quantile.AddFunction(GetApproxQuantileListAggregate(LogicalTypeId::DOUBLE));
+	DefineApproxQuantileList(approx_quantile, LogicalTypeId::TINYINT);
+	DefineApproxQuantileList(approx_quantile, LogicalTypeId::SMALLINT);
+	DefineApproxQuantileList(approx_quantile, LogicalTypeId::INTEGER);
+	DefineApproxQuantileList(approx_quantile, LogicalTypeId::BIGINT);
+	DefineApproxQuantileList(approx_quantile, LogicalTypeId::HUGEINT);
+	DefineApproxQuantileList(approx_quantile, LogicalTypeId::FLOAT);
+	DefineApproxQuantileList(approx_quantile, LogicalTypeId::DOUBLE);
 
 	set.AddFunction(approx_quantile);
 }
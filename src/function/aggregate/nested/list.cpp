@@ -2,6 +2,7 @@
 #include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/function/aggregate/nested_functions.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
@@ -25,15 +26,14 @@ struct LinkedList {
 struct WriteDataToSegment;
 struct ReadDataFromSegment;
 struct CopyDataFromSegment;
-typedef ListSegment *(*create_segment_t)(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                                         vector<AllocatedData> &owning_vector, const uint16_t &capacity);
-typedef void (*write_data_to_segment_t)(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                                        vector<AllocatedData> &owning_vector, ListSegment *segment, Vector &input,
-                                        idx_t &entry_idx, idx_t &count);
+typedef ListSegment *(*create_segment_t)(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator,
+                                         const uint16_t &capacity);
+typedef void (*write_data_to_segment_t)(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator,
+                                        ListSegment *segment, Vector &input, idx_t &entry_idx, idx_t &count);
 typedef void (*read_data_from_segment_t)(ReadDataFromSegment &read_data_from_segment, const ListSegment *segment,
                                          Vector &result, idx_t &total_count);
 typedef ListSegment *(*copy_data_from_segment_t)(CopyDataFromSegment &copy_data_from_segment, const ListSegment *source,
-                                                 Allocator &allocator, vector<AllocatedData> &owning_vector);
+                                                 ArenaAllocator &allocator);
 
 struct WriteDataToSegment {
 	create_segment_t create_segment;
@@ -50,36 +50,26 @@ struct CopyDataFromSegment {
 };
 
 // forward declarations
-static void AppendRow(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                      vector<AllocatedData> &owning_vector, LinkedList *linked_list, Vector &input, idx_t &entry_idx,
-                      idx_t &count);
+static void AppendRow(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator, LinkedList *linked_list,
+                      Vector &input, idx_t &entry_idx, idx_t &count);
 static void BuildListVector(ReadDataFromSegment &read_data_from_segment, LinkedList *linked_list, Vector &result,
                             idx_t &initial_total_count);
 static void CopyLinkedList(CopyDataFromSegment &copy_data_from_segment, const LinkedList *source_list,
-                           LinkedList &target_list, Allocator &allocator, vector<AllocatedData> &owning_vector);
+                           LinkedList &target_list, ArenaAllocator &allocator);
 
 template <class T>
-static data_ptr_t AllocatePrimitiveData(Allocator &allocator, vector<AllocatedData> &owning_vector,
-                                        const uint16_t &capacity) {
-
-	owning_vector.emplace_back(allocator.Allocate(sizeof(ListSegment) + capacity * (sizeof(bool) + sizeof(T))));
-	return owning_vector.back().get();
+static data_ptr_t AllocatePrimitiveData(ArenaAllocator &allocator, const uint16_t &capacity) {
+	return allocator.AllocateAligned(sizeof(ListSegment) + capacity * (sizeof(bool) + sizeof(T)));
 }
 
-static data_ptr_t AllocateListData(Allocator &allocator, vector<AllocatedData> &owning_vector,
-                                   const uint16_t &capacity) {
-
-	owning_vector.emplace_back(
-	    allocator.Allocate(sizeof(ListSegment) + capacity * (sizeof(bool) + sizeof(uint64_t)) + sizeof(LinkedList)));
-	return owning_vector.back().get();
+static data_ptr_t AllocateListData(ArenaAllocator &allocator, const uint16_t &capacity) {
+	return allocator.AllocateAligned(sizeof(ListSegment) + capacity * (sizeof(bool) + sizeof(uint64_t)) +
+	                                 sizeof(LinkedList));
 }
 
-static data_ptr_t AllocateStructData(Allocator &allocator, vector<AllocatedData> &owning_vector,
-                                     const uint16_t &capacity, const idx_t &child_count) {
-
-	owning_vector.emplace_back(
-	    allocator.Allocate(sizeof(ListSegment) + capacity * sizeof(bool) + child_count * sizeof(ListSegment *)));
-	return owning_vector.back().get();
+static data_ptr_t AllocateStructData(ArenaAllocator &allocator, const uint16_t &capacity, const idx_t &child_count) {
+	return allocator.AllocateAligned(sizeof(ListSegment) + capacity * sizeof(bool) +
+	                                 child_count * sizeof(ListSegment *));
 }
 
 template <class T>
@@ -116,22 +106,20 @@ static uint16_t GetCapacityForNewSegment(const LinkedList *linked_list) {
 }
 
 template <class T>
-static ListSegment *CreatePrimitiveSegment(WriteDataToSegment &, Allocator &allocator,
-                                           vector<AllocatedData> &owning_vector, const uint16_t &capacity) {
+static ListSegment *CreatePrimitiveSegment(WriteDataToSegment &, ArenaAllocator &allocator, const uint16_t &capacity) {
 
 	// allocate data and set the header
-	auto segment = (ListSegment *)AllocatePrimitiveData<T>(allocator, owning_vector, capacity);
+	auto segment = (ListSegment *)AllocatePrimitiveData<T>(allocator, capacity);
 	segment->capacity = capacity;
 	segment->count = 0;
 	segment->next = nullptr;
 	return segment;
 }
 
-static ListSegment *CreateListSegment(WriteDataToSegment &, Allocator &allocator, vector<AllocatedData> &owning_vector,
-                                      const uint16_t &capacity) {
+static ListSegment *CreateListSegment(WriteDataToSegment &, ArenaAllocator &allocator, const uint16_t &capacity) {
 
 	// allocate data and set the header
-	auto segment = (ListSegment *)AllocateListData(allocator, owning_vector, capacity);
+	auto segment = (ListSegment *)AllocateListData(allocator, capacity);
 	segment->capacity = capacity;
 	segment->count = 0;
 	segment->next = nullptr;
@@ -144,12 +132,11 @@ static ListSegment *CreateListSegment(WriteDataToSegment &, Allocator &allocator
 	return segment;
 }
 
-static ListSegment *CreateStructSegment(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                                        vector<AllocatedData> &owning_vector, const uint16_t &capacity) {
+static ListSegment *CreateStructSegment(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator,
+                                        const uint16_t &capacity) {
 
 	// allocate data and set header
-	auto segment = (ListSegment *)AllocateStructData(allocator, owning_vector, capacity,
-	                                                 write_data_to_segment.child_functions.size());
+	auto segment = (ListSegment *)AllocateStructData(allocator, capacity, write_data_to_segment.child_functions.size());
 	segment->capacity = capacity;
 	segment->count = 0;
 	segment->next = nullptr;
@@ -158,15 +145,15 @@ static ListSegment *CreateStructSegment(WriteDataToSegment &write_data_to_segmen
 	auto child_segments = GetStructData(segment);
 	for (idx_t i = 0; i < write_data_to_segment.child_functions.size(); i++) {
 		auto child_function = write_data_to_segment.child_functions[i];
-		auto child_segment = child_function.create_segment(child_function, allocator, owning_vector, capacity);
+		auto child_segment = child_function.create_segment(child_function, allocator, capacity);
 		Store<ListSegment *>(child_segment, (data_ptr_t)(child_segments + i));
 	}
 
 	return segment;
 }
 
-static ListSegment *GetSegment(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                               vector<AllocatedData> &owning_vector, LinkedList *linked_list) {
+static ListSegment *GetSegment(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator,
+                               LinkedList *linked_list) {
 
 	ListSegment *segment = nullptr;
 
@@ -174,14 +161,14 @@ static ListSegment *GetSegment(WriteDataToSegment &write_data_to_segment, Alloca
 	if (!linked_list->last_segment) {
 		// empty linked list, create the first (and last) segment
 		auto capacity = GetCapacityForNewSegment(linked_list);
-		segment = write_data_to_segment.create_segment(write_data_to_segment, allocator, owning_vector, capacity);
+		segment = write_data_to_segment.create_segment(write_data_to_segment, allocator, capacity);
 		linked_list->first_segment = segment;
 		linked_list->last_segment = segment;
 
 	} else if (linked_list->last_segment->capacity == linked_list->last_segment->count) {
 		// the last segment of the linked list is full, create a new one and append it
 		auto capacity = GetCapacityForNewSegment(linked_list);
-		segment = write_data_to_segment.create_segment(write_data_to_segment, allocator, owning_vector, capacity);
+		segment = write_data_to_segment.create_segment(write_data_to_segment, allocator, capacity);
 		linked_list->last_segment->next = segment;
 		linked_list->last_segment = segment;
 
@@ -195,9 +182,8 @@ static ListSegment *GetSegment(WriteDataToSegment &write_data_to_segment, Alloca
 }
 
 template <class T>
-static void WriteDataToPrimitiveSegment(WriteDataToSegment &, Allocator &allocator,
-                                        vector<AllocatedData> &owning_vector, ListSegment *segment, Vector &input,
-                                        idx_t &entry_idx, idx_t &count) {
+static void WriteDataToPrimitiveSegment(WriteDataToSegment &, ArenaAllocator &allocator, ListSegment *segment,
+                                        Vector &input, idx_t &entry_idx, idx_t &count) {
 
 	// get the vector data and the source index of the entry that we want to write
 	auto input_data = FlatVector::GetData(input);
@@ -214,9 +200,8 @@ static void WriteDataToPrimitiveSegment(WriteDataToSegment &, Allocator &allocat
 	}
 }
 
-static void WriteDataToVarcharSegment(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                                      vector<AllocatedData> &owning_vector, ListSegment *segment, Vector &input,
-                                      idx_t &entry_idx, idx_t &count) {
+static void WriteDataToVarcharSegment(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator,
+                                      ListSegment *segment, Vector &input, idx_t &entry_idx, idx_t &count) {
 
 	// get the vector data and the source index of the entry that we want to write
 	auto input_data = FlatVector::GetData(input);
@@ -247,8 +232,7 @@ static void WriteDataToVarcharSegment(WriteDataToSegment &write_data_to_segment,
 	// write the characters to the linked list of child segments
 	auto child_segments = Load<LinkedList>((data_ptr_t)GetListChildData(segment));
 	for (char &c : str_t.GetString()) {
-		auto child_segment =
-		    GetSegment(write_data_to_segment.child_functions.back(), allocator, owning_vector, &child_segments);
+		auto child_segment = GetSegment(write_data_to_segment.child_functions.back(), allocator, &child_segments);
 		auto data = GetPrimitiveData<char>(child_segment);
 		data[child_segment->count] = c;
 		child_segment->count++;
@@ -259,9 +243,8 @@ static void WriteDataToVarcharSegment(WriteDataToSegment &write_data_to_segment,
 	Store<LinkedList>(child_segments, (data_ptr_t)GetListChildData(segment));
 }
 
-static void WriteDataToListSegment(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                                   vector<AllocatedData> &owning_vector, ListSegment *segment, Vector &input,
-                                   idx_t &entry_idx, idx_t &count) {
+static void WriteDataToListSegment(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator,
+                                   ListSegment *segment, Vector &input, idx_t &entry_idx, idx_t &count) {
 
 	// get the vector data and the source index of the entry that we want to write
 	auto input_data = FlatVector::GetData(input);
@@ -290,7 +273,7 @@ static void WriteDataToListSegment(WriteDataToSegment &write_data_to_segment, Al
 		D_ASSERT(write_data_to_segment.child_functions.size() == 1);
 		for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
 			auto source_idx_child = list_entry.offset + child_idx;
-			AppendRow(write_data_to_segment.child_functions[0], allocator, owning_vector, &child_segments, child_vector,
+			AppendRow(write_data_to_segment.child_functions[0], allocator, &child_segments, child_vector,
 			          source_idx_child, lists_size);
 		}
 		// store the updated linked list
@@ -300,9 +283,8 @@ static void WriteDataToListSegment(WriteDataToSegment &write_data_to_segment, Al
 	Store<uint64_t>(list_length, (data_ptr_t)(list_length_data + segment->count));
 }
 
-static void WriteDataToStructSegment(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                                     vector<AllocatedData> &owning_vector, ListSegment *segment, Vector &input,
-                                     idx_t &entry_idx, idx_t &count) {
+static void WriteDataToStructSegment(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator,
+                                     ListSegment *segment, Vector &input, idx_t &entry_idx, idx_t &count) {
 
 	// write null validity
 	auto null_mask = GetNullMask(segment);
@@ -318,21 +300,19 @@ static void WriteDataToStructSegment(WriteDataToSegment &write_data_to_segment,
 	for (idx_t child_count = 0; child_count < children.size(); child_count++) {
 		auto child_list_segment = Load<ListSegment *>((data_ptr_t)(child_list + child_count));
 		auto &child_function = write_data_to_segment.child_functions[child_count];
-		child_function.segment_function(child_function, allocator, owning_vector, child_list_segment,
-		                                *children[child_count], entry_idx, count);
+		child_function.segment_function(child_function, allocator, child_list_segment, *children[child_count],
+		                                entry_idx, count);
 		child_list_segment->count++;
 	}
 }
 
-static void AppendRow(WriteDataToSegment &write_data_to_segment, Allocator &allocator,
-                      vector<AllocatedData> &owning_vector, LinkedList *linked_list, Vector &input, idx_t &entry_idx,
-                      idx_t &count) {
+static void AppendRow(WriteDataToSegment &write_data_to_segment, ArenaAllocator &allocator, LinkedList *linked_list,
+                      Vector &input, idx_t &entry_idx, idx_t &count) {
 
 	D_ASSERT(input.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	auto segment = GetSegment(write_data_to_segment, allocator, owning_vector, linked_list);
-	write_data_to_segment.segment_function(write_data_to_segment, allocator, owning_vector, segment, input, entry_idx,
-	                                       count);
+	auto segment = GetSegment(write_data_to_segment, allocator, linked_list);
+	write_data_to_segment.segment_function(write_data_to_segment, allocator, segment, input, entry_idx, count);
 
 	linked_list->total_capacity++;
 	segment->count++;
@@ -485,23 +465,23 @@ static void BuildListVector(ReadDataFromSegment &read_data_from_segment, LinkedL
 }
 
 template <class T>
-static ListSegment *CopyDataFromPrimitiveSegment(CopyDataFromSegment &, const ListSegment *source, Allocator &allocator,
-                                                 vector<AllocatedData> &owning_vector) {
+static ListSegment *CopyDataFromPrimitiveSegment(CopyDataFromSegment &, const ListSegment *source,
+                                                 ArenaAllocator &allocator) {
 
-	auto target = (ListSegment *)AllocatePrimitiveData<T>(allocator, owning_vector, source->capacity);
+	auto target = (ListSegment *)AllocatePrimitiveData<T>(allocator, source->capacity);
 	memcpy(target, source, sizeof(ListSegment) + source->capacity * (sizeof(bool) + sizeof(T)));
 	target->next = nullptr;
 	return target;
 }
 
 static ListSegment *CopyDataFromListSegment(CopyDataFromSegment &copy_data_from_segment, const ListSegment *source,
-                                            Allocator &allocator, vector<AllocatedData> &owning_vector) {
+                                            ArenaAllocator &allocator) {
 
 	// create an empty linked list for the child vector of target
 	auto source_linked_child_list = Load<LinkedList>((data_ptr_t)GetListChildData(source));
 
 	// create the segment
-	auto target = (ListSegment *)AllocateListData(allocator, owning_vector, source->capacity);
+	auto target = (ListSegment *)AllocateListData(allocator, source->capacity);
 	memcpy(target, source,
 	       sizeof(ListSegment) + source->capacity * (sizeof(bool) + sizeof(uint64_t)) + sizeof(LinkedList));
 	target->next = nullptr;
@@ -514,7 +494,7 @@ static ListSegment *CopyDataFromListSegment(CopyDataFromSegment &copy_data_from_
 	auto target_linked_child_list = Load<LinkedList>((data_ptr_t)GetListChildData(target));
 	D_ASSERT(copy_data_from_segment.child_functions.size() == 1);
 	CopyLinkedList(copy_data_from_segment.child_functions[0], &source_linked_child_list, target_linked_child_list,
-	               allocator, owning_vector);
+	               allocator);
 
 	// store the updated linked list
 	Store<LinkedList>(target_linked_child_list, (data_ptr_t)GetListChildData(target));
@@ -522,10 +502,10 @@ static ListSegment *CopyDataFromListSegment(CopyDataFromSegment &copy_data_from_
 }
 
 static ListSegment *CopyDataFromStructSegment(CopyDataFromSegment &copy_data_from_segment, const ListSegment *source,
-                                              Allocator &allocator, vector<AllocatedData> &owning_vector) {
+                                              ArenaAllocator &allocator) {
 
 	auto source_child_count = copy_data_from_segment.child_functions.size();
-	auto target = (ListSegment *)AllocateStructData(allocator, owning_vector, source->capacity, source_child_count);
+	auto target = (ListSegment *)AllocateStructData(allocator, source->capacity, source_child_count);
 	memcpy(target, source,
 	       sizeof(ListSegment) + source->capacity * sizeof(bool) + source_child_count * sizeof(ListSegment *));
 	target->next = nullptr;
@@ -537,21 +517,20 @@ static ListSegment *CopyDataFromStructSegment(CopyDataFromSegment &copy_data_fro
 	for (idx_t i = 0; i < copy_data_from_segment.child_functions.size(); i++) {
 		auto child_function = copy_data_from_segment.child_functions[i];
 		auto source_child_segment = Load<ListSegment *>((data_ptr_t)(source_child_segments + i));
-		auto target_child_segment =
-		    child_function.segment_function(child_function, source_child_segment, allocator, owning_vector);
+		auto target_child_segment = child_function.segment_function(child_function, source_child_segment, allocator);
 		Store<ListSegment *>(target_child_segment, (data_ptr_t)(target_child_segments + i));
 	}
 	return target;
 }
 
 static void CopyLinkedList(CopyDataFromSegment &copy_data_from_segment, const LinkedList *source_list,
-                           LinkedList &target_list, Allocator &allocator, vector<AllocatedData> &owning_vector) {
+                           LinkedList &target_list, ArenaAllocator &allocator) {
 
 	auto source_segment = source_list->first_segment;
 
 	while (source_segment) {
 		auto target_segment =
-		    copy_data_from_segment.segment_function(copy_data_from_segment, source_segment, allocator, owning_vector);
+		    copy_data_from_segment.segment_function(copy_data_from_segment, source_segment, allocator);
 		source_segment = source_segment->next;
 
 		if (!target_list.first_segment) {
@@ -778,35 +757,15 @@ ListBindData::~ListBindData() {
 }
 
 struct ListAggState {
-	LinkedList *linked_list;
-	LogicalType *type;
-	vector<AllocatedData> *owning_vector;
+	LinkedList linked_list;
 };
 
 struct ListFunction {
 	template <class STATE>
 	static void Initialize(STATE *state) {
-		state->linked_list = nullptr;
-		state->type = nullptr;
-		state->owning_vector = nullptr;
-	}
-
-	template <class STATE>
-	static void Destroy(STATE *state) {
-		D_ASSERT(state);
-		if (state->linked_list) {
-			delete state->linked_list;
-			state->linked_list = nullptr;
-		}
-		if (state->type) {
-			delete state->type;
-			state->type = nullptr;
-		}
-		if (state->owning_vector) {
-			state->owning_vector->clear();
-			delete state->owning_vector;
-			state->owning_vector = nullptr;
-		}
+		state->linked_list.total_capacity = 0;
+		state->linked_list.first_segment = nullptr;
+		state->linked_list.last_segment = nullptr;
 	}
 	static bool IgnoreNull() {
 		return false;
@@ -828,14 +787,8 @@ static void ListUpdateFunction(Vector inputs[], AggregateInputData &aggr_input_d
 
 	for (idx_t i = 0; i < count; i++) {
 		auto state = states[sdata.sel->get_index(i)];
-		if (!state->linked_list) {
-			state->linked_list = new LinkedList(0, nullptr, nullptr);
-			state->type = new LogicalType(input.GetType());
-			state->owning_vector = new vector<AllocatedData>;
-		}
-		D_ASSERT(state->type);
-		AppendRow(list_bind_data.write_data_to_segment, aggr_input_data.allocator, *state->owning_vector,
-		          state->linked_list, input, i, count);
+		AppendRow(list_bind_data.write_data_to_segment, aggr_input_data.allocator, &state->linked_list, input, i,
+		          count);
 	}
 }
 
@@ -849,33 +802,26 @@ static void ListCombineFunction(Vector &state, Vector &combined, AggregateInputD
 	auto combined_ptr = FlatVector::GetData<ListAggState *>(combined);
 	for (idx_t i = 0; i < count; i++) {
 		auto state = states_ptr[sdata.sel->get_index(i)];
-		if (!state->linked_list) {
+		if (!state->linked_list.first_segment) {
 			// NULL, no need to append.
 			continue;
 		}
-		D_ASSERT(state->type);
-		D_ASSERT(state->owning_vector);
 
-		if (!combined_ptr[i]->linked_list) {
-			combined_ptr[i]->linked_list = new LinkedList(0, nullptr, nullptr);
-			combined_ptr[i]->owning_vector = new vector<AllocatedData>;
-			combined_ptr[i]->type = new LogicalType(*state->type);
-		}
-		auto owning_vector = combined_ptr[i]->owning_vector;
-
-		// copy the linked list of the state
-		auto copied_linked_list = LinkedList(state->linked_list->total_capacity, nullptr, nullptr);
-		CopyLinkedList(list_bind_data.copy_data_from_segment, state->linked_list, copied_linked_list,
-		               aggr_input_data.allocator, *owning_vector);
+		// copy the linked list of the state into the arena of the combined state, as the source state
+		// (and with it its arena) may be destroyed before the combined state is finalized
+		auto &combined_list = combined_ptr[i]->linked_list;
+		auto copied_linked_list = LinkedList(state->linked_list.total_capacity, nullptr, nullptr);
+		CopyLinkedList(list_bind_data.copy_data_from_segment, &state->linked_list, copied_linked_list,
+		               aggr_input_data.allocator);
 
 		// append the copied linked list to the combined state
-		if (combined_ptr[i]->linked_list->last_segment) {
-			combined_ptr[i]->linked_list->last_segment->next = copied_linked_list.first_segment;
+		if (combined_list.last_segment) {
+			combined_list.last_segment->next = copied_linked_list.first_segment;
 		} else {
-			combined_ptr[i]->linked_list->first_segment = copied_linked_list.first_segment;
+			combined_list.first_segment = copied_linked_list.first_segment;
 		}
-		combined_ptr[i]->linked_list->last_segment = copied_linked_list.last_segment;
-		combined_ptr[i]->linked_list->total_capacity += copied_linked_list.total_capacity;
+		combined_list.last_segment = copied_linked_list.last_segment;
+		combined_list.total_capacity += copied_linked_list.total_capacity;
 	}
 }
 
@@ -897,20 +843,18 @@ static void ListFinalize(Vector &state_vector, AggregateInputData &aggr_input_da
 
 		auto state = states[sdata.sel->get_index(i)];
 		const auto rid = i + offset;
-		if (!state->linked_list) {
+		if (!state->linked_list.first_segment) {
 			mask.SetInvalid(rid);
 			continue;
 		}
 
 		// set the length and offset of this list in the result vector
-		auto total_capacity = state->linked_list->total_capacity;
+		auto total_capacity = state->linked_list.total_capacity;
 		result_data[rid].length = total_capacity;
 		result_data[rid].offset = total_len;
 		total_len += total_capacity;
 
-		D_ASSERT(state->type);
-
-		Vector aggr_vector(*state->type, total_capacity);
+		Vector aggr_vector(ListType::GetChildType(list_bind_data.stype), total_capacity);
 		// FIXME: this is a workaround because the constructor of a vector does not set the size
 		// of the validity mask, and by default it is set to STANDARD_VECTOR_SIZE
 		// ListVector::Reserve only increases the validity mask, if (to_reserve > capacity),
@@ -919,11 +863,8 @@ static void ListFinalize(Vector &state_vector, AggregateInputData &aggr_input_da
 		InitializeValidities(aggr_vector, total_capacity);
 
 		idx_t total_count = 0;
-		BuildListVector(list_bind_data.read_data_from_segment, state->linked_list, aggr_vector, total_count);
+		BuildListVector(list_bind_data.read_data_from_segment, &state->linked_list, aggr_vector, total_count);
 		ListVector::Append(result, aggr_vector, total_capacity);
-
-		// now destroy the state (for parallel destruction)
-		ListFunction::Destroy<ListAggState>(state);
 	}
 }
 
@@ -946,8 +887,7 @@ void ListFun::RegisterFunction(BuiltinFunctions &set) {
 	auto agg =
 	    AggregateFunction("list", {LogicalType::ANY}, LogicalTypeId::LIST, AggregateFunction::StateSize<ListAggState>,
 	                      AggregateFunction::StateInitialize<ListAggState, ListFunction>, ListUpdateFunction,
-	                      ListCombineFunction, ListFinalize, nullptr, ListBindFunction,
-	                      AggregateFunction::StateDestroy<ListAggState, ListFunction>, nullptr, nullptr);
+	                      ListCombineFunction, ListFinalize, nullptr, ListBindFunction, nullptr, nullptr, nullptr);
 	set.AddFunction(agg);
 	agg.name = "array_agg";
 	set.AddFunction(agg);
@@ -284,7 +284,7 @@ struct SortedAggregateFunction {
 		// State variables
 		const auto input_count = order_bind->function.arguments.size();
 		auto bind_info = order_bind->bind_info.get();
-		AggregateInputData aggr_bind_info(bind_info, Allocator::DefaultAllocator());
+		AggregateInputData aggr_bind_info(bind_info, aggr_input_data.allocator);
 
 		// Inner aggregate APIs
 		auto initialize = order_bind->function.initialize;
@@ -338,7 +338,7 @@ struct SortedAggregateFunction {
 			finalize(agg_state_vec, aggr_bind_info, result, 1, i + offset);
 
 			if (destructor) {
-				destructor(agg_state_vec, 1);
+				destructor(agg_state_vec, aggr_bind_info, 1);
 			}
 		}
 	}
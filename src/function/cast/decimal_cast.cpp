@@ -223,6 +223,65 @@ static bool DecimalToStringCast(Vector &source, Vector &result, idx_t count, Cas
 	return true;
 }
 
+//! Like VectorCastHelpers::BatchedIntegerStringCast: precompute the length of every decimal string so
+//! that the heap space for the vector is reserved with a single allocation
+template <class SRC>
+static bool BatchedDecimalToStringCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	using UNSIGNED = typename std::make_unsigned<SRC>::type;
+	if (count > STANDARD_VECTOR_SIZE || source.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		return DecimalToStringCast<SRC>(source, result, count, parameters);
+	}
+	auto &source_type = source.GetType();
+	auto width = DecimalType::GetWidth(source_type);
+	auto scale = DecimalType::GetScale(source_type);
+
+	UnifiedVectorFormat vdata;
+	source.ToUnifiedFormat(count, vdata);
+	auto source_data = (SRC *)vdata.data;
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &result_mask = FlatVector::Validity(result);
+
+	uint8_t lengths[STANDARD_VECTOR_SIZE];
+	idx_t heap_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			result_mask.SetInvalid(i);
+			lengths[i] = 0;
+			continue;
+		}
+		auto length = DecimalToString::DecimalLength<SRC, UNSIGNED>(source_data[idx], width, scale);
+		lengths[i] = uint8_t(length);
+		if (idx_t(length) >= string_t::INLINE_LENGTH) {
+			heap_size += length;
+		}
+	}
+	char *heap_ptr = nullptr;
+	if (heap_size > 0) {
+		heap_ptr = StringVector::EmptyString(result, heap_size).GetDataWriteable();
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (!result_mask.RowIsValid(i)) {
+			continue;
+		}
+		auto value = source_data[vdata.sel->get_index(i)];
+		idx_t length = lengths[i];
+		if (length < string_t::INLINE_LENGTH) {
+			string_t str(length);
+			DecimalToString::FormatDecimal<SRC, UNSIGNED>(value, width, scale, str.GetDataWriteable(), length);
+			str.Finalize();
+			result_data[i] = str;
+		} else {
+			DecimalToString::FormatDecimal<SRC, UNSIGNED>(value, width, scale, heap_ptr, length);
+			result_data[i] = string_t(heap_ptr, length);
+			heap_ptr += length;
+		}
+	}
+	return true;
+}
+
 BoundCastInfo DefaultCasts::DecimalCastSwitch(BindCastInput &input, const LogicalType &source,
                                               const LogicalType &target) {
 	// now switch on the result type
@@ -270,11 +329,11 @@ BoundCastInfo DefaultCasts::DecimalCastSwitch(BindCastInput &input, const Logica
 	case LogicalTypeId::VARCHAR: {
 		switch (source.InternalType()) {
 		case PhysicalType::INT16:
-			return DecimalToStringCast<int16_t>;
+			return BatchedDecimalToStringCast<int16_t>;
 		case PhysicalType::INT32:
-			return DecimalToStringCast<int32_t>;
+			return BatchedDecimalToStringCast<int32_t>;
 		case PhysicalType::INT64:
-			return DecimalToStringCast<int64_t>;
+			return BatchedDecimalToStringCast<int64_t>;
 		case PhysicalType::INT128:
 			return DecimalToStringCast<hugeint_t>;
 		default:
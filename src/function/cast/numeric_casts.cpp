@@ -5,6 +5,21 @@
 
 namespace duckdb {
 
+template <class SRC, bool INTEGRAL>
+struct NumericStringCastSwitch {
+	static BoundCastInfo Cast() {
+		return BoundCastInfo(&VectorCastHelpers::StringCast<SRC, duckdb::StringCast>);
+	}
+};
+
+//! Integer sources go through the batched cast, which reserves the string heap space once per vector
+template <class SRC>
+struct NumericStringCastSwitch<SRC, true> {
+	static BoundCastInfo Cast() {
+		return BoundCastInfo(&VectorCastHelpers::BatchedIntegerStringCast<SRC>);
+	}
+};
+
 template <class SRC>
 static BoundCastInfo InternalNumericCastSwitch(const LogicalType &source, const LogicalType &target) {
 	// now switch on the result type
@@ -36,7 +51,7 @@ static BoundCastInfo InternalNumericCastSwitch(const LogicalType &source, const
 	case LogicalTypeId::DECIMAL:
 		return BoundCastInfo(&VectorCastHelpers::ToDecimalCast<SRC>);
 	case LogicalTypeId::VARCHAR:
-		return BoundCastInfo(&VectorCastHelpers::StringCast<SRC, duckdb::StringCast>);
+		return NumericStringCastSwitch<SRC, std::is_integral<SRC>::value && !std::is_same<SRC, bool>::value>::Cast();
 	default:
 		return DefaultCasts::TryVectorNullCast;
 	}
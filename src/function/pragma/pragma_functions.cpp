@@ -3,6 +3,7 @@
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -107,6 +108,18 @@ static void PragmaDisableCheckpointOnShutdown(ClientContext &context, const Func
 	DBConfig::GetConfig(context).options.checkpoint_on_shutdown = false;
 }
 
+static void PragmaExportOperatorTrace(ClientContext &context, const FunctionParameters &parameters) {
+	auto &prev_profilers = ClientData::Get(context).query_profiler_history->GetPrevProfilers();
+	if (prev_profilers.empty()) {
+		throw InvalidInputException("export_operator_trace: no profiled query available - run a query with profiling "
+		                            "and \"enable_operator_trace\" enabled first");
+	}
+	auto &profiler = *prev_profilers.back().second;
+	auto json = profiler.TraceToChromeJSON();
+	auto path = parameters.values[0].ToString();
+	profiler.WriteToFile(path.c_str(), json);
+}
+
 static void PragmaEnableOptimizer(ClientContext &context, const FunctionParameters &parameters) {
 	ClientConfig::GetConfig(context).enable_optimizer = true;
 }
@@ -151,6 +164,9 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_checkpoint_on_shutdown", PragmaEnableCheckpointOnShutdown));
 	set.AddFunction(
 	    PragmaFunction::PragmaStatement("disable_checkpoint_on_shutdown", PragmaDisableCheckpointOnShutdown));
+
+	set.AddFunction(
+	    PragmaFunction::PragmaCall("export_operator_trace", PragmaExportOperatorTrace, {LogicalType::VARCHAR}));
 }
 
 } // namespace duckdb
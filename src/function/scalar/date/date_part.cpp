@@ -226,6 +226,12 @@ struct DatePart {
 		UnaryExecutor::GenericExecute<TA, TR, IOP>(input.data[0], result, input.size(), nullptr, true);
 	}
 
+	template <class TA, class OP>
+	static void UnaryExecute(Vector &left, Vector &result, idx_t count) {
+		using IOP = PartOperator<OP>;
+		UnaryExecutor::GenericExecute<TA, int64_t, IOP>(left, result, count, nullptr, true);
+	}
+
 	struct YearOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
@@ -1195,12 +1201,98 @@ static int64_t ExtractElement(DatePartSpecifier type, T element) {
 	}
 }
 
+template <typename T>
+static void DatePartUnaryExecutor(DatePartSpecifier type, Vector &left, Vector &result, idx_t count) {
+	switch (type) {
+	case DatePartSpecifier::YEAR:
+		DatePart::UnaryExecute<T, DatePart::YearOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::MONTH:
+		DatePart::UnaryExecute<T, DatePart::MonthOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::DAY:
+		DatePart::UnaryExecute<T, DatePart::DayOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::DECADE:
+		DatePart::UnaryExecute<T, DatePart::DecadeOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::CENTURY:
+		DatePart::UnaryExecute<T, DatePart::CenturyOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::MILLENNIUM:
+		DatePart::UnaryExecute<T, DatePart::MillenniumOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::QUARTER:
+		DatePart::UnaryExecute<T, DatePart::QuarterOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::DOW:
+		DatePart::UnaryExecute<T, DatePart::DayOfWeekOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::ISODOW:
+		DatePart::UnaryExecute<T, DatePart::ISODayOfWeekOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::DOY:
+		DatePart::UnaryExecute<T, DatePart::DayOfYearOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::WEEK:
+		DatePart::UnaryExecute<T, DatePart::WeekOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::ISOYEAR:
+		DatePart::UnaryExecute<T, DatePart::ISOYearOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::YEARWEEK:
+		DatePart::UnaryExecute<T, DatePart::YearWeekOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::EPOCH:
+		DatePart::UnaryExecute<T, DatePart::EpochOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::MICROSECONDS:
+		DatePart::UnaryExecute<T, DatePart::MicrosecondsOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::MILLISECONDS:
+		DatePart::UnaryExecute<T, DatePart::MillisecondsOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::SECOND:
+		DatePart::UnaryExecute<T, DatePart::SecondsOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::MINUTE:
+		DatePart::UnaryExecute<T, DatePart::MinutesOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::HOUR:
+		DatePart::UnaryExecute<T, DatePart::HoursOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::ERA:
+		DatePart::UnaryExecute<T, DatePart::EraOperator>(left, result, count);
+		break;
+	case DatePartSpecifier::TIMEZONE:
+	case DatePartSpecifier::TIMEZONE_HOUR:
+	case DatePartSpecifier::TIMEZONE_MINUTE:
+		DatePart::UnaryExecute<T, DatePart::TimezoneOperator>(left, result, count);
+		break;
+	default:
+		throw NotImplementedException("Specifier type not implemented for DATEPART");
+	}
+}
+
 template <typename T>
 static void DatePartFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	D_ASSERT(args.ColumnCount() == 2);
 	auto &spec_arg = args.data[0];
 	auto &date_arg = args.data[1];
 
+	if (spec_arg.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		// Common case of a constant specifier: look it up once and run the specialized kernel,
+		// instead of re-parsing the specifier string and re-dispatching for every value
+		if (ConstantVector::IsNull(spec_arg)) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(result, true);
+		} else {
+			const auto type = GetDatePartSpecifier(ConstantVector::GetData<string_t>(spec_arg)->GetString());
+			DatePartUnaryExecutor<T>(type, date_arg, result, args.size());
+		}
+		return;
+	}
+
 	BinaryExecutor::ExecuteWithNulls<string_t, T, int64_t>(
 	    spec_arg, date_arg, result, args.size(), [&](string_t specifier, T date, ValidityMask &mask, idx_t idx) {
 		    if (Value::IsFinite(date)) {
@@ -1212,6 +1304,94 @@ static void DatePartFunction(DataChunk &args, ExpressionState &state, Vector &re
 	    });
 }
 
+template <function_statistics_t FUN>
+static unique_ptr<BaseStatistics> DatePartBinaryStats(ClientContext &context, FunctionStatisticsInput &input) {
+	// in the two-argument version the specifier is argument 0 and the date is argument 1:
+	// shift the date statistics into the single slot the unary propagators read, so that both the
+	// [min, max] bounds and the validity are derived from the date argument instead of the specifier
+	vector<unique_ptr<BaseStatistics>> stats;
+	stats.push_back(input.child_stats[1] ? input.child_stats[1]->Copy() : nullptr);
+	FunctionStatisticsInput date_input(input.expr, input.bind_data, stats, input.expr_ptr);
+	return FUN(context, date_input);
+}
+
+template <typename T>
+static function_statistics_t DatePartStats(DatePartSpecifier type) {
+	switch (type) {
+	case DatePartSpecifier::YEAR:
+		return DatePartBinaryStats<DatePart::YearOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::MONTH:
+		return DatePartBinaryStats<DatePart::MonthOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::DAY:
+		return DatePartBinaryStats<DatePart::DayOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::DECADE:
+		return DatePartBinaryStats<DatePart::DecadeOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::CENTURY:
+		return DatePartBinaryStats<DatePart::CenturyOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::MILLENNIUM:
+		return DatePartBinaryStats<DatePart::MillenniumOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::QUARTER:
+		return DatePartBinaryStats<DatePart::QuarterOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::DOW:
+		return DatePartBinaryStats<DatePart::DayOfWeekOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::ISODOW:
+		return DatePartBinaryStats<DatePart::ISODayOfWeekOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::DOY:
+		return DatePartBinaryStats<DatePart::DayOfYearOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::WEEK:
+		return DatePartBinaryStats<DatePart::WeekOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::ISOYEAR:
+		return DatePartBinaryStats<DatePart::ISOYearOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::YEARWEEK:
+		return DatePartBinaryStats<DatePart::YearWeekOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::EPOCH:
+		return DatePartBinaryStats<DatePart::EpochOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::MICROSECONDS:
+		return DatePartBinaryStats<DatePart::MicrosecondsOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::MILLISECONDS:
+		return DatePartBinaryStats<DatePart::MillisecondsOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::SECOND:
+		return DatePartBinaryStats<DatePart::SecondsOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::MINUTE:
+		return DatePartBinaryStats<DatePart::MinutesOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::HOUR:
+		return DatePartBinaryStats<DatePart::HoursOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::ERA:
+		return DatePartBinaryStats<DatePart::EraOperator::template PropagateStatistics<T>>;
+	case DatePartSpecifier::TIMEZONE:
+	case DatePartSpecifier::TIMEZONE_HOUR:
+	case DatePartSpecifier::TIMEZONE_MINUTE:
+		return DatePartBinaryStats<DatePart::TimezoneOperator::template PropagateStatistics<T>>;
+	default:
+		throw NotImplementedException("Specifier type not implemented for DATEPART statistics");
+	}
+}
+
+static unique_ptr<FunctionData> DatePartBind(ClientContext &context, ScalarFunction &bound_function,
+                                             vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[0]->IsFoldable()) {
+		return nullptr;
+	}
+
+	// if the specifier is a constant we can also propagate the statistics of the matching part
+	Value part_value = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (part_value.IsNull()) {
+		return nullptr;
+	}
+	const auto part_code = GetDatePartSpecifier(part_value.ToString());
+	switch (bound_function.arguments[1].id()) {
+	case LogicalType::TIMESTAMP:
+		bound_function.statistics = DatePartStats<timestamp_t>(part_code);
+		break;
+	case LogicalType::DATE:
+		bound_function.statistics = DatePartStats<date_t>(part_code);
+		break;
+	default:
+		break;
+	}
+	return nullptr;
+}
+
 void AddGenericDatePartOperator(BuiltinFunctions &set, const string &name, scalar_function_t date_func,
                                 scalar_function_t ts_func, scalar_function_t interval_func,
                                 function_statistics_t date_stats, function_statistics_t ts_stats) {
@@ -1540,10 +1720,10 @@ void DatePartFun::RegisterFunction(BuiltinFunctions &set) {
 
 	// finally the actual date_part function
 	ScalarFunctionSet date_part("date_part");
-	date_part.AddFunction(
-	    ScalarFunction({LogicalType::VARCHAR, LogicalType::DATE}, LogicalType::BIGINT, DatePartFunction<date_t>));
+	date_part.AddFunction(ScalarFunction({LogicalType::VARCHAR, LogicalType::DATE}, LogicalType::BIGINT,
+	                                     DatePartFunction<date_t>, DatePartBind));
 	date_part.AddFunction(ScalarFunction({LogicalType::VARCHAR, LogicalType::TIMESTAMP}, LogicalType::BIGINT,
-	                                     DatePartFunction<timestamp_t>));
+	                                     DatePartFunction<timestamp_t>, DatePartBind));
 	date_part.AddFunction(
 	    ScalarFunction({LogicalType::VARCHAR, LogicalType::TIME}, LogicalType::BIGINT, DatePartFunction<dtime_t>));
 	date_part.AddFunction(ScalarFunction({LogicalType::VARCHAR, LogicalType::INTERVAL}, LogicalType::BIGINT,
@@ -27,6 +27,15 @@ struct DateTrunc {
 		UnaryExecutor::Execute<TA, TR>(left, result, count, UnaryFunction<TA, TR, OP>);
 	}
 
+	//! Floor a timestamp to a multiple of delta microseconds. Timestamps count microseconds since the epoch,
+	//! so truncating to parts that divide a day evenly needs no calendar math at all.
+	static inline timestamp_t TruncateMicros(timestamp_t input, const int64_t delta) {
+		auto remainder = input.value % delta;
+		// branchless flooring for timestamps before the epoch, where the remainder is negative
+		remainder += delta & (remainder >> 63);
+		return timestamp_t(input.value - remainder);
+	}
+
 	struct MillenniumOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
@@ -68,7 +77,9 @@ struct DateTrunc {
 	struct MonthOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			return Date::FromDate(Date::ExtractYear(input), Date::ExtractMonth(input), 1);
+			int32_t yyyy, mm, dd;
+			Date::Convert(input, yyyy, mm, dd);
+			return Date::FromDate(yyyy, mm, 1);
 		}
 	};
 
@@ -99,49 +110,28 @@ struct DateTrunc {
 	struct HourOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, 0, 0, 0));
+			return TruncateMicros(input, Interval::MICROS_PER_HOUR);
 		}
 	};
 
 	struct MinuteOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, 0, 0));
+			return TruncateMicros(input, Interval::MICROS_PER_MINUTE);
 		}
 	};
 
 	struct SecondOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, sec, 0));
+			return TruncateMicros(input, Interval::MICROS_PER_SEC);
 		}
 	};
 
 	struct MillisecondOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			int32_t hour, min, sec, micros;
-			date_t date;
-			dtime_t time;
-			Timestamp::Convert(input, date, time);
-			Time::Convert(time, hour, min, sec, micros);
-			micros -= micros % Interval::MICROS_PER_MSEC;
-			return Timestamp::FromDatetime(date, Time::FromTime(hour, min, sec, micros));
+			return TruncateMicros(input, Interval::MICROS_PER_MSEC);
 		}
 	};
 
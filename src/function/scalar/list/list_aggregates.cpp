@@ -8,6 +8,7 @@
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/function/function_binder.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
@@ -47,20 +48,24 @@ ListAggregatesBindData::~ListAggregatesBindData() {
 
 struct StateVector {
 	StateVector(idx_t count_p, unique_ptr<Expression> aggr_expr_p)
-	    : count(count_p), aggr_expr(std::move(aggr_expr_p)), state_vector(Vector(LogicalType::POINTER, count_p)) {
+	    : count(count_p), aggr_expr(std::move(aggr_expr_p)), state_vector(Vector(LogicalType::POINTER, count_p)),
+	      allocator(Allocator::DefaultAllocator()) {
 	}
 
 	~StateVector() {
 		// destroy objects within the aggregate states
 		auto &aggr = (BoundAggregateExpression &)*aggr_expr;
 		if (aggr.function.destructor) {
-			aggr.function.destructor(state_vector, count);
+			AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+			aggr.function.destructor(state_vector, aggr_input_data, count);
 		}
 	}
 
 	idx_t count;
 	unique_ptr<Expression> aggr_expr;
 	Vector state_vector;
+	//! Arena allocator from which the aggregate states allocate their variable-size data
+	ArenaAllocator allocator;
 };
 
 struct FinalizeValueFunctor {
@@ -160,17 +165,24 @@ static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vect
 	auto &func_expr = (BoundFunctionExpression &)state.expr;
 	auto &info = (ListAggregatesBindData &)*func_expr.bind_info;
 	auto &aggr = (BoundAggregateExpression &)*info.aggr_expr;
-	AggregateInputData aggr_input_data(aggr.bind_info.get(), Allocator::DefaultAllocator());
 
 	D_ASSERT(aggr.function.update);
 
 	auto lists_size = ListVector::GetListSize(lists);
 	auto &child_vector = ListVector::GetEntry(lists);
-	child_vector.Flatten(lists_size);
+	if (child_vector.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		child_vector.Flatten(lists_size);
+	}
 
 	UnifiedVectorFormat child_data;
 	child_vector.ToUnifiedFormat(lists_size, child_data);
 
+	// the selection vector below is filled through child_data.sel, so its indices point into the underlying
+	// vector of a dictionary: slice that directly instead of materializing a flat copy of every child entry
+	auto &child_base = child_vector.GetVectorType() == VectorType::DICTIONARY_VECTOR
+	                       ? DictionaryVector::Child(child_vector)
+	                       : child_vector;
+
 	UnifiedVectorFormat lists_data;
 	lists.ToUnifiedFormat(count, lists_data);
 	auto list_entries = (list_entry_t *)lists_data.data;
@@ -182,6 +194,7 @@ static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vect
 	// state vector for initialize and finalize
 	StateVector state_vector(count, info.aggr_expr->Copy());
 	auto states = FlatVector::GetData<data_ptr_t>(state_vector.state_vector);
+	AggregateInputData aggr_input_data(aggr.bind_info.get(), state_vector.allocator);
 
 	// state vector of STANDARD_VECTOR_SIZE holds the pointers to the states
 	Vector state_vector_update = Vector(LogicalType::POINTER);
@@ -216,7 +229,7 @@ static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vect
 			// states vector is full, update
 			if (states_idx == STANDARD_VECTOR_SIZE) {
 				// update the aggregate state(s)
-				Vector slice(child_vector, sel_vector, states_idx);
+				Vector slice(child_base, sel_vector, states_idx);
 				aggr.function.update(&slice, aggr_input_data, 1, state_vector_update, states_idx);
 
 				// reset values
@@ -232,7 +245,7 @@ static void ListAggregatesFunction(DataChunk &args, ExpressionState &state, Vect
 
 	// update the remaining elements of the last list(s)
 	if (states_idx != 0) {
-		Vector slice(child_vector, sel_vector, states_idx);
+		Vector slice(child_base, sel_vector, states_idx);
 		aggr.function.update(&slice, aggr_input_data, 1, state_vector_update, states_idx);
 	}
 
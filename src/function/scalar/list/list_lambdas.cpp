@@ -171,10 +171,18 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 	// get the child vector and child data
 	auto lists_size = ListVector::GetListSize(lists);
 	auto &child_vector = ListVector::GetEntry(lists);
-	child_vector.Flatten(lists_size);
+	if (child_vector.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		child_vector.Flatten(lists_size);
+	}
 	UnifiedVectorFormat child_data;
 	child_vector.ToUnifiedFormat(lists_size, child_data);
 
+	// the selection vector below is filled through child_data.sel, so its indices point into the underlying
+	// vector of a dictionary: slice that directly instead of materializing a flat copy of every child entry
+	auto &child_base = child_vector.GetVectorType() == VectorType::DICTIONARY_VECTOR
+	                       ? DictionaryVector::Child(child_vector)
+	                       : child_vector;
+
 	// to slice the child vector
 	SelectionVector sel(STANDARD_VECTOR_SIZE);
 
@@ -261,7 +269,7 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 			if (elem_cnt == STANDARD_VECTOR_SIZE) {
 				lambda_chunk.Reset();
 				ExecuteExpression(types, result_types, elem_cnt, sel, sel_vectors, input_chunk, lambda_chunk,
-				                  child_vector, args, expr_executor);
+				                  child_base, args, expr_executor);
 
 				auto &lambda_vector = lambda_chunk.data[0];
 
@@ -288,7 +296,7 @@ static void ListLambdaFunction(DataChunk &args, ExpressionState &state, Vector &
 	}
 
 	lambda_chunk.Reset();
-	ExecuteExpression(types, result_types, elem_cnt, sel, sel_vectors, input_chunk, lambda_chunk, child_vector, args,
+	ExecuteExpression(types, result_types, elem_cnt, sel, sel_vectors, input_chunk, lambda_chunk, child_base, args,
 	                  expr_executor);
 	auto &lambda_vector = lambda_chunk.data[0];
 
@@ -164,8 +164,10 @@ static unique_ptr<BaseStatistics> CaseConvertPropagateStats(ClientContext &conte
 }
 
 ScalarFunction LowerFun::GetFunction() {
-	return ScalarFunction("lower", {LogicalType::VARCHAR}, LogicalType::VARCHAR, CaseConvertFunction<false>, nullptr,
-	                      nullptr, CaseConvertPropagateStats<false>);
+	ScalarFunction lower("lower", {LogicalType::VARCHAR}, LogicalType::VARCHAR, CaseConvertFunction<false>, nullptr,
+	                     nullptr, CaseConvertPropagateStats<false>);
+	lower.errors = FunctionErrors::CANNOT_ERROR;
+	return lower;
 }
 
 void LowerFun::RegisterFunction(BuiltinFunctions &set) {
@@ -173,9 +175,10 @@ void LowerFun::RegisterFunction(BuiltinFunctions &set) {
 }
 
 void UpperFun::RegisterFunction(BuiltinFunctions &set) {
-	set.AddFunction({"upper", "ucase"},
-	                ScalarFunction({LogicalType::VARCHAR}, LogicalType::VARCHAR, CaseConvertFunction<true>, nullptr,
-	                               nullptr, CaseConvertPropagateStats<true>));
+	ScalarFunction upper({LogicalType::VARCHAR}, LogicalType::VARCHAR, CaseConvertFunction<true>, nullptr, nullptr,
+	                     CaseConvertPropagateStats<true>);
+	upper.errors = FunctionErrors::CANNOT_ERROR;
+	set.AddFunction({"upper", "ucase"}, upper);
 }
 
 } // namespace duckdb
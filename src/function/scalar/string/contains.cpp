@@ -4,6 +4,11 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#include <emmintrin.h>
+#define DUCKDB_CONTAINS_SSE2
+#endif
+
 namespace duckdb {
 
 template <class UNSIGNED, int NEEDLE_SIZE>
@@ -65,6 +70,57 @@ static idx_t ContainsAligned(const unsigned char *haystack, idx_t haystack_size,
 	return DConstants::INVALID_INDEX;
 }
 
+#ifdef DUCKDB_CONTAINS_SSE2
+static inline int FirstMatchPosition(uint32_t mask) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+static idx_t ContainsSSE(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
+                         idx_t needle_size, idx_t base_offset) {
+	if (needle_size > haystack_size) {
+		// needle is bigger than haystack: haystack cannot contain needle
+		return DConstants::INVALID_INDEX;
+	}
+	// SIMD contains using a 16-byte wide first/last-character filter
+	// we compare 16 candidate positions at a time against both the first and the last character of the needle;
+	// only positions where both characters match are verified with a full memcmp
+	// this implementation is inspired by http://0x80.pl/articles/simd-strfind.html
+	const auto first = _mm_set1_epi8(needle[0]);
+	const auto last = _mm_set1_epi8(needle[needle_size - 1]);
+	const idx_t positions = haystack_size - needle_size + 1;
+	idx_t offset = 0;
+	for (; offset + 16 <= positions; offset += 16) {
+		// the load of the last characters stays in bounds: the highest byte read is at position
+		// offset + 15 + needle_size - 1 <= haystack_size - 1
+		auto first_block = _mm_loadu_si128((const __m128i *)(haystack + offset));
+		auto last_block = _mm_loadu_si128((const __m128i *)(haystack + offset + needle_size - 1));
+		auto equal = _mm_and_si128(_mm_cmpeq_epi8(first, first_block), _mm_cmpeq_epi8(last, last_block));
+		uint32_t mask = _mm_movemask_epi8(equal);
+		while (mask) {
+			idx_t position = offset + FirstMatchPosition(mask);
+			// first and last character match: verify the characters in between
+			if (memcmp(haystack + position + 1, needle + 1, needle_size - 2) == 0) {
+				return base_offset + position;
+			}
+			mask &= mask - 1;
+		}
+	}
+	// handle the remaining positions with the scalar tail
+	for (; offset < positions; offset++) {
+		if (haystack[offset] == needle[0] && memcmp(haystack + offset, needle, needle_size) == 0) {
+			return base_offset + offset;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+#endif
+
 idx_t ContainsGeneric(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
                       idx_t needle_size, idx_t base_offset) {
 	if (needle_size > haystack_size) {
@@ -128,7 +184,11 @@ idx_t ContainsFun::Find(const unsigned char *haystack, idx_t haystack_size, cons
 	case 8:
 		return ContainsAligned<uint64_t>(haystack, haystack_size, needle, base_offset);
 	default:
+#ifdef DUCKDB_CONTAINS_SSE2
+		return ContainsSSE(haystack, haystack_size, needle, needle_size, base_offset);
+#else
 		return ContainsGeneric(haystack, haystack_size, needle, needle_size, base_offset);
+#endif
 	}
 }
 
@@ -9,6 +9,12 @@
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "utf8proc_wrapper.hpp"
+#include "re2/prefilter.h"
+
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#include <emmintrin.h>
+#define DUCKDB_REGEXP_PREFILTER_SSE2
+#endif
 
 namespace duckdb {
 
@@ -114,6 +120,109 @@ static bool TryParseConstantPattern(ClientContext &context, Expression &expr, st
 	return false;
 }
 
+//===--------------------------------------------------------------------===//
+// Regexp Prefilter
+//===--------------------------------------------------------------------===//
+static inline uint8_t FoldASCII(uint8_t c) {
+	return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+//! Returns whether the input contains the given literal, comparing ASCII characters case-insensitively.
+//! The literal is expected to be lowercased already (prefilter atoms always are).
+static bool ContainsFoldedASCII(const unsigned char *haystack, idx_t haystack_size, const string &needle_str) {
+	auto needle = (const unsigned char *)needle_str.c_str();
+	idx_t needle_size = needle_str.size();
+	D_ASSERT(needle_size >= 2);
+	if (needle_size > haystack_size) {
+		return false;
+	}
+	const idx_t positions = haystack_size - needle_size + 1;
+	idx_t offset = 0;
+#ifdef DUCKDB_REGEXP_PREFILTER_SSE2
+	// 16-byte wide first/last-character filter, with both sides folded by setting the 0x20 bit
+	// the fold maps 'A'-'Z' onto 'a'-'z' and cannot separate bytes that only differ in case, so it never
+	// rejects a real occurrence; spurious candidates are rejected by the exact verification below
+	const auto first = _mm_set1_epi8(needle[0] | 0x20);
+	const auto last = _mm_set1_epi8(needle[needle_size - 1] | 0x20);
+	const auto fold = _mm_set1_epi8(0x20);
+	for (; offset + 16 <= positions; offset += 16) {
+		auto first_block = _mm_or_si128(_mm_loadu_si128((const __m128i *)(haystack + offset)), fold);
+		auto last_block = _mm_or_si128(_mm_loadu_si128((const __m128i *)(haystack + offset + needle_size - 1)), fold);
+		auto equal = _mm_and_si128(_mm_cmpeq_epi8(first, first_block), _mm_cmpeq_epi8(last, last_block));
+		uint32_t mask = _mm_movemask_epi8(equal);
+		while (mask) {
+#ifdef _MSC_VER
+			unsigned long first_match;
+			_BitScanForward(&first_match, mask);
+#else
+			auto first_match = __builtin_ctz(mask);
+#endif
+			idx_t position = offset + first_match;
+			idx_t i;
+			for (i = 0; i < needle_size; i++) {
+				if (FoldASCII(haystack[position + i]) != needle[i]) {
+					break;
+				}
+			}
+			if (i == needle_size) {
+				return true;
+			}
+			mask &= mask - 1;
+		}
+	}
+#endif
+	for (; offset < positions; offset++) {
+		idx_t i;
+		for (i = 0; i < needle_size; i++) {
+			if (FoldASCII(haystack[offset + i]) != needle[i]) {
+				break;
+			}
+		}
+		if (i == needle_size) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//! Extract a literal from the pattern that any matching input must contain, so that rows can be skipped with a
+//! fast literal search before running the regex automaton. Prefilter atoms are lowercased per rune, which is only
+//! byte-exact for case-sensitive matching of pure-ASCII patterns: anything else returns an empty string.
+static string ExtractRequiredLiteral(const RE2 &pattern, const duckdb_re2::RE2::Options &options,
+                                     const string &pattern_string) {
+	if (!options.case_sensitive()) {
+		// case-insensitive patterns match Unicode case folds that an ASCII literal search would miss
+		return string();
+	}
+	for (idx_t i = 0; i < pattern_string.size(); i++) {
+		if ((unsigned char)pattern_string[i] >= 0x80) {
+			// non-ASCII runes can lowercase into different byte sequences
+			return string();
+		}
+	}
+	unique_ptr<duckdb_re2::Prefilter> prefilter(duckdb_re2::Prefilter::FromRE2(&pattern));
+	if (!prefilter) {
+		return string();
+	}
+	// a single atom is required directly; for an AND every child atom is required: pick the longest one
+	// OR nodes give no single required literal and are skipped
+	string result;
+	if (prefilter->op() == duckdb_re2::Prefilter::ATOM) {
+		result = prefilter->atom();
+	} else if (prefilter->op() == duckdb_re2::Prefilter::AND) {
+		for (auto &child : *prefilter->subs()) {
+			if (child->op() == duckdb_re2::Prefilter::ATOM && child->atom().size() > result.size()) {
+				result = child->atom();
+			}
+		}
+	}
+	if (result.size() < 2) {
+		// single-character literals filter too little to pay for the extra scan
+		return string();
+	}
+	return result;
+}
+
 //===--------------------------------------------------------------------===//
 // Regexp Matches
 //===--------------------------------------------------------------------===//
@@ -127,6 +236,7 @@ RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, s
 		}
 
 		range_success = pattern->PossibleMatchRange(&range_min, &range_max, 1000);
+		required_literal = ExtractRequiredLiteral(*pattern, options, constant_string);
 	} else {
 		range_success = false;
 	}
@@ -140,8 +250,10 @@ RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, s
 }
 
 unique_ptr<FunctionData> RegexpMatchesBindData::Copy() const {
-	return make_unique<RegexpMatchesBindData>(options, constant_string, constant_pattern, range_min, range_max,
-	                                          range_success);
+	auto copy = make_unique<RegexpMatchesBindData>(options, constant_string, constant_pattern, range_min, range_max,
+	                                               range_success);
+	copy->required_literal = required_literal;
+	return std::move(copy);
 }
 
 unique_ptr<FunctionData> RegexpMatchesBind(ClientContext &context, ScalarFunction &bound_function,
@@ -182,9 +294,20 @@ static void RegexpMatchesFunction(DataChunk &args, ExpressionState &state, Vecto
 
 	if (info.constant_pattern) {
 		auto &lstate = (RegexLocalState &)*ExecuteFunctionState::GetFunctionState(state);
-		UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
-			return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
-		});
+		if (!info.required_literal.empty()) {
+			UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
+				// only run the regex on rows that contain the required literal
+				if (!ContainsFoldedASCII((const unsigned char *)input.GetDataUnsafe(), input.GetSize(),
+				                         info.required_literal)) {
+					return false;
+				}
+				return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
+			});
+		} else {
+			UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
+				return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
+			});
+		}
 	} else {
 		BinaryExecutor::Execute<string_t, string_t, bool>(strings, patterns, result, args.size(),
 		                                                  [&](string_t input, string_t pattern) {
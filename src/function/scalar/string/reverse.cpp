@@ -50,7 +50,9 @@ static void ReverseFunction(DataChunk &args, ExpressionState &state, Vector &res
 }
 
 void ReverseFun::RegisterFunction(BuiltinFunctions &set) {
-	set.AddFunction(ScalarFunction("reverse", {LogicalType::VARCHAR}, LogicalType::VARCHAR, ReverseFunction));
+	ScalarFunction reverse("reverse", {LogicalType::VARCHAR}, LogicalType::VARCHAR, ReverseFunction);
+	reverse.errors = FunctionErrors::CANNOT_ERROR;
+	set.AddFunction(reverse);
 }
 
 } // namespace duckdb
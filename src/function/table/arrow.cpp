@@ -247,19 +247,32 @@ bool ArrowTableFunction::ArrowScanParallelStateNext(ClientContext &context, cons
 	if (parallel_state.done) {
 		return false;
 	}
-	state.chunk_offset = 0;
-	state.batch_index = ++parallel_state.batch_index;
-
-	auto current_chunk = parallel_state.stream->GetNextChunk();
-	while (current_chunk->arrow_array.length == 0 && current_chunk->arrow_array.release) {
-		current_chunk = parallel_state.stream->GetNextChunk();
+	if (!parallel_state.current_chunk ||
+	    parallel_state.chunk_offset >= (idx_t)parallel_state.current_chunk->arrow_array.length) {
+		//! the current chunk has been handed out in full - pull the next chunk from the stream
+		auto current_chunk = parallel_state.stream->GetNextChunk();
+		while (current_chunk->arrow_array.length == 0 && current_chunk->arrow_array.release) {
+			current_chunk = parallel_state.stream->GetNextChunk();
+		}
+		//! have we run out of chunks? we are done
+		if (!current_chunk->arrow_array.release) {
+			parallel_state.done = true;
+			return false;
+		}
+		parallel_state.current_chunk = std::move(current_chunk);
+		parallel_state.chunk_offset = 0;
 	}
-	state.chunk = std::move(current_chunk);
-	//! have we run out of chunks? we are done
-	if (!state.chunk->arrow_array.release) {
-		parallel_state.done = true;
-		return false;
+	//! hand out the next range of the current chunk; large chunks are shared between the scanning threads
+	if (state.chunk.get() != parallel_state.current_chunk.get()) {
+		//! the cached dictionaries reference the buffers of the previous chunk
+		state.arrow_dictionary_vectors.clear();
+		state.chunk = parallel_state.current_chunk;
 	}
+	state.chunk_offset = parallel_state.chunk_offset;
+	state.range_end = MinValue<idx_t>((idx_t)state.chunk->arrow_array.length,
+	                                  state.chunk_offset + ArrowScanGlobalState::ARROW_SCAN_RANGE_SIZE);
+	state.batch_index = ++parallel_state.batch_index;
+	parallel_state.chunk_offset = state.range_end;
 	return true;
 }
 
@@ -308,13 +321,13 @@ void ArrowTableFunction::ArrowScanFunction(ClientContext &context, TableFunction
 	auto &state = (ArrowScanLocalState &)*data_p.local_state;
 	auto &global_state = (ArrowScanGlobalState &)*data_p.global_state;
 
-	//! Out of tuples in this chunk
-	if (state.chunk_offset >= (idx_t)state.chunk->arrow_array.length) {
+	//! Out of tuples in the range assigned to this thread
+	if (state.chunk_offset >= state.range_end) {
 		if (!ArrowScanParallelStateNext(context, data_p.bind_data, state, global_state)) {
 			return;
 		}
 	}
-	int64_t output_size = MinValue<int64_t>(STANDARD_VECTOR_SIZE, state.chunk->arrow_array.length - state.chunk_offset);
+	int64_t output_size = MinValue<int64_t>(STANDARD_VECTOR_SIZE, state.range_end - state.chunk_offset);
 	data.lines_read += output_size;
 	if (global_state.CanRemoveFilterColumns()) {
 		state.all_columns.Reset();
@@ -163,13 +163,14 @@ void ArrowToDuckDBBlob(Vector &vector, ArrowArray &array, ArrowScanLocalState &s
 			offset = original_type.second * nested_offset;
 		}
 		auto cdata = (char *)array.buffers[1];
+		auto blobs = FlatVector::GetData<string_t>(vector);
 		for (idx_t row_idx = 0; row_idx < size; row_idx++) {
 			if (FlatVector::IsNull(vector, row_idx)) {
 				continue;
 			}
 			auto bptr = cdata + offset;
 			auto blob_len = original_type.second;
-			FlatVector::GetData<string_t>(vector)[row_idx] = StringVector::AddStringOrBlob(vector, bptr, blob_len);
+			blobs[row_idx] = string_t(bptr, blob_len);
 			offset += blob_len;
 		}
 	} else if (original_type.first == ArrowVariableSizeType::NORMAL) {
@@ -178,13 +179,14 @@ void ArrowToDuckDBBlob(Vector &vector, ArrowArray &array, ArrowScanLocalState &s
 			offsets = (uint32_t *)array.buffers[1] + array.offset + nested_offset;
 		}
 		auto cdata = (char *)array.buffers[2];
+		auto blobs = FlatVector::GetData<string_t>(vector);
 		for (idx_t row_idx = 0; row_idx < size; row_idx++) {
 			if (FlatVector::IsNull(vector, row_idx)) {
 				continue;
 			}
 			auto bptr = cdata + offsets[row_idx];
 			auto blob_len = offsets[row_idx + 1] - offsets[row_idx];
-			FlatVector::GetData<string_t>(vector)[row_idx] = StringVector::AddStringOrBlob(vector, bptr, blob_len);
+			blobs[row_idx] = string_t(bptr, blob_len);
 		}
 	} else {
 		//! Check if last offset is higher than max uint32
@@ -196,13 +198,14 @@ void ArrowToDuckDBBlob(Vector &vector, ArrowArray &array, ArrowScanLocalState &s
 			offsets = (uint64_t *)array.buffers[1] + array.offset + nested_offset;
 		}
 		auto cdata = (char *)array.buffers[2];
+		auto blobs = FlatVector::GetData<string_t>(vector);
 		for (idx_t row_idx = 0; row_idx < size; row_idx++) {
 			if (FlatVector::IsNull(vector, row_idx)) {
 				continue;
 			}
 			auto bptr = cdata + offsets[row_idx];
 			auto blob_len = offsets[row_idx + 1] - offsets[row_idx];
-			FlatVector::GetData<string_t>(vector)[row_idx] = StringVector::AddStringOrBlob(vector, bptr, blob_len);
+			blobs[row_idx] = string_t(bptr, blob_len);
 		}
 	}
 }
@@ -0,0 +1,82 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBMemoryData : public GlobalTableFunctionState {
+	DuckDBMemoryData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBMemoryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("memory_usage");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_limit");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("pins");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("temp_bytes_written");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("temp_bytes_read");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("eviction_queue_length");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBMemoryInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_unique<DuckDBMemoryData>();
+}
+
+void DuckDBMemoryFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = (DuckDBMemoryData &)*data_p.global_state;
+	if (data.finished) {
+		return;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	auto &stats = buffer_manager.GetStats();
+	auto max_memory = buffer_manager.GetMaxMemory();
+
+	idx_t col = 0;
+	// memory_usage, LogicalType::BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(buffer_manager.GetUsedMemory()));
+	// memory_limit, LogicalType::BIGINT (NULL when unlimited)
+	output.SetValue(col++, 0, max_memory == (idx_t)-1 ? Value(LogicalType::BIGINT) : Value::BIGINT(max_memory));
+	// pins, LogicalType::BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(stats.pins.load(std::memory_order_relaxed)));
+	// misses, LogicalType::BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(stats.misses.load(std::memory_order_relaxed)));
+	// evictions, LogicalType::BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(stats.evictions.load(std::memory_order_relaxed)));
+	// temp_bytes_written, LogicalType::BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(stats.temp_bytes_written.load(std::memory_order_relaxed)));
+	// temp_bytes_read, LogicalType::BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(stats.temp_bytes_read.load(std::memory_order_relaxed)));
+	// eviction_queue_length, LogicalType::BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(buffer_manager.EvictionQueueSize()));
+
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBMemoryFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_memory", {}, DuckDBMemoryFunction, DuckDBMemoryBind, DuckDBMemoryInit));
+}
+
+} // namespace duckdb
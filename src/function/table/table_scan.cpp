@@ -72,7 +72,11 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		auto storage_idx = GetStorageIndex(*bind_data.table, col);
 		col = storage_idx;
 	}
-	result->scan_state.Initialize(std::move(column_ids), input.filters);
+	unordered_map<column_t, vector<bool>> projected_struct_fields;
+	for (auto &entry : input.projected_struct_fields) {
+		projected_struct_fields[GetStorageIndex(*bind_data.table, entry.first)] = entry.second;
+	}
+	result->scan_state.Initialize(std::move(column_ids), input.filters, std::move(projected_struct_fields));
 	TableScanParallelStateNext(context.client, input.bind_data, result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
 		auto &tsgs = (TableScanGlobalState &)*gstate;
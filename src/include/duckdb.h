@@ -571,6 +571,23 @@ Returns the number of data chunks present in the result.
 */
 DUCKDB_API idx_t duckdb_result_chunk_count(duckdb_result result);
 
+/*!
+Fetches the next data chunk from the duckdb_result. This function should be called repeatedly until the result is
+exhausted, i.e. until it returns `NULL`.
+
+The vectors of the returned chunk reference the data of the result directly where possible instead of copying it.
+Because of this, the data of a fetched chunk is only guaranteed to remain valid until the next call to
+`duckdb_fetch_chunk` on the same result, or until the result is destroyed.
+
+The returned chunk itself must be destroyed with `duckdb_destroy_data_chunk`.
+
+This function cannot be mixed with the legacy result functions or with `duckdb_result_get_chunk`.
+
+* result: The result object to fetch the data chunk from.
+* returns: The resulting data chunk. Returns `NULL` if the result is exhausted or if an error occurred.
+*/
+DUCKDB_API duckdb_data_chunk duckdb_fetch_chunk(duckdb_result result);
+
 // Safe fetch functions
 // These functions will perform conversions if necessary.
 // On failure (e.g. if conversion cannot be performed or if the value is NULL) a default value is returned.
@@ -85,6 +85,10 @@ public:
 	DUCKDB_API DatabaseInstance &GetDatabase();
 
 	void Initialize(bool load_builtin);
+	//! Register the built-in functions in the catalog, if this has not happened yet. The built-in functions are
+	//! created lazily on the first function lookup instead of when the database is opened, so that opening a database
+	//! remains cheap.
+	DUCKDB_API void LoadBuiltinFunctions();
 
 	bool IsSystemCatalog() const;
 	bool IsTemporaryCatalog() const;
@@ -230,6 +234,10 @@ public:
 private:
 	//! Reference to the database
 	AttachedDatabase &db;
+	//! Whether or not the built-in functions still have to be registered in the catalog
+	atomic<bool> builtin_functions_pending;
+	//! Lock protecting the lazy registration of the built-in functions
+	mutex builtin_functions_lock;
 
 private:
 	CatalogEntryLookup LookupEntryInternal(CatalogTransaction transaction, CatalogType type, const string &schema,
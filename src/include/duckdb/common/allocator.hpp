@@ -101,6 +101,10 @@ public:
 	DUCKDB_API static Allocator &DefaultAllocator();
 	DUCKDB_API static shared_ptr<Allocator> &DefaultAllocatorReference();
 
+	//! Returns the net number of bytes the current thread has allocated (and not yet freed) through any Allocator.
+	//! The profiler samples this around operator invocations to attribute memory usage to operators.
+	DUCKDB_API static int64_t ThreadAllocatedBytes();
+
 private:
 	allocate_function_ptr_t allocate_function;
 	free_function_ptr_t free_function;
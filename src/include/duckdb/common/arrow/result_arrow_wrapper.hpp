@@ -12,6 +12,8 @@
 #include "duckdb/common/arrow/arrow_wrapper.hpp"
 
 namespace duckdb {
+class MaterializedQueryResult;
+
 class ResultArrowArrayStreamWrapper {
 public:
 	explicit ResultArrowArrayStreamWrapper(unique_ptr<QueryResult> result, idx_t batch_size);
@@ -24,9 +26,23 @@ public:
 	string timezone_config;
 
 private:
+	//! Converts all batches of a materialized result in parallel on the task scheduler
+	//! Returns false if the result should be converted through the regular serial path instead
+	bool ConvertMaterializedResult(MaterializedQueryResult &result);
+
 	static int MyStreamGetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out);
 	static int MyStreamGetNext(struct ArrowArrayStream *stream, struct ArrowArray *out);
 	static void MyStreamRelease(struct ArrowArrayStream *stream);
 	static const char *MyStreamGetLastError(struct ArrowArrayStream *stream);
+
+private:
+	//! The batches of a materialized result that were converted ahead of time, in result order
+	vector<shared_ptr<ArrowArrayWrapper>> converted_batches;
+	//! The index of the next converted batch to hand out
+	idx_t converted_batch_index = 0;
+	//! Whether or not parallel conversion of a materialized result has been attempted
+	bool conversion_attempted = false;
+	//! Whether or not the converted batches should be used instead of the serial fetch path
+	bool use_converted_batches = false;
 };
 } // namespace duckdb
@@ -111,6 +111,11 @@ public:
 		return num_to_round + BITPACKING_ALGORITHM_GROUP_SIZE - remainder;
 	}
 
+	template <class T>
+	inline static T RoundDownToAlgorithmGroupSize(T num_to_round) {
+		return num_to_round - (num_to_round % BITPACKING_ALGORITHM_GROUP_SIZE);
+	}
+
 private:
 	template <class T, bool round_to_next_byte = false>
 	static bitpacking_width_t FindMinimumBitWidth(T *values, idx_t count) {
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/cache_file_system.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+
+//! The CacheFileSystem wraps a (remote) file handle and stores the byte ranges it reads in a persistent local cache
+//! file, so repeated reads of the same remote file are served at local disk speed. Cached files are validated against
+//! the size and last-modified time of the remote file and re-fetched when either changes. The cache directory is
+//! bounded: when a file is opened and the directory exceeds the configured size, the oldest cache files are evicted.
+class CacheFileSystem : public FileSystem {
+public:
+	//! The granularity at which remote data is cached
+	static constexpr const idx_t BLOCK_SIZE = 262144;
+	//! The default bound on the total size of the cache directory (16GB)
+	static constexpr const idx_t DEFAULT_CACHE_SIZE = 17179869184ULL;
+
+	//! Wraps a read-only remote file handle in a handle backed by a cache file in the given directory
+	static unique_ptr<FileHandle> OpenCachedFile(unique_ptr<FileHandle> remote_handle, const string &cache_directory,
+	                                             idx_t max_cache_size);
+
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+
+	int64_t GetFileSize(FileHandle &handle) override;
+	time_t GetLastModifiedTime(FileHandle &handle) override;
+	FileType GetFileType(FileHandle &handle) override;
+	void Seek(FileHandle &handle, idx_t location) override;
+	idx_t SeekPosition(FileHandle &handle) override;
+	void FileSync(FileHandle &handle) override;
+
+	bool OnDiskFile(FileHandle &handle) override {
+		return false;
+	}
+	bool CanSeek() override {
+		return true;
+	}
+
+	std::string GetName() const override {
+		return "CacheFileSystem";
+	}
+};
+
+} // namespace duckdb
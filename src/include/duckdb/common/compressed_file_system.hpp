@@ -26,6 +26,10 @@ struct StreamData {
 
 	idx_t in_buf_size = 0;
 	idx_t out_buf_size = 0;
+
+	//! Set when the current stream has ended and the header of a following (concatenated) stream may need to be
+	//! parsed from the input buffer
+	bool refresh = false;
 };
 
 struct StreamWrapper {
@@ -40,6 +40,7 @@ enum class LogicalOperatorType : uint8_t {
 	LOGICAL_DUMMY_SCAN = 29,
 	LOGICAL_EMPTY_RESULT = 30,
 	LOGICAL_CTE_REF = 31,
+	LOGICAL_MATERIALIZE_SCAN = 32,
 	// -----------------------------
 	// Joins
 	// -----------------------------
@@ -56,6 +57,7 @@ enum class LogicalOperatorType : uint8_t {
 	LOGICAL_EXCEPT = 76,
 	LOGICAL_INTERSECT = 77,
 	LOGICAL_RECURSIVE_CTE = 78,
+	LOGICAL_MATERIALIZE = 79,
 
 	// -----------------------------
 	// Updates
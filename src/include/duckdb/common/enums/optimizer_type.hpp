@@ -22,10 +22,13 @@ enum class OptimizerType : uint32_t {
 	JOIN_ORDER,
 	DELIMINATOR,
 	UNUSED_COLUMNS,
+	EAGER_AGGREGATE,
 	STATISTICS_PROPAGATION,
 	COMMON_SUBEXPRESSIONS,
 	COMMON_AGGREGATE,
+	COMMON_SUBPLAN,
 	COLUMN_LIFETIME,
+	ORDER_ELIMINATION,
 	TOP_N,
 	REORDER_FILTER,
 	EXTENSION
@@ -25,6 +25,9 @@ public:
 	//! DIRECT_IO
 	FileBuffer(Allocator &allocator, FileBufferType type, uint64_t user_size);
 	FileBuffer(FileBuffer &source, FileBufferType type);
+	//! Creates a FileBuffer that wraps externally managed memory, e.g. a pointer into a memory-mapped file.
+	//! The buffer does not own the memory and will not free it; AllocSize() is zero for such buffers.
+	FileBuffer(Allocator &allocator, FileBufferType type, data_ptr_t external_buffer, uint64_t user_size);
 
 	virtual ~FileBuffer();
 
@@ -66,7 +69,8 @@ public:
 	MemoryRequirement CalculateMemory(uint64_t user_size);
 
 protected:
-	//! The pointer to the internal buffer that will be read or written, including the buffer header
+	//! The pointer to the internal buffer that will be read or written, including the buffer header. The pointer is
+	//! sector-aligned so that it can be used for DIRECT_IO
 	data_ptr_t internal_buffer;
 	//! The aligned size as passed to the constructor. This is the size that is read or written to disk.
 	uint64_t internal_size;
@@ -125,6 +125,15 @@ public:
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
+	//! Hint that nr_bytes at the specified location will be read in the near future, so the file system can start
+	//! reading ahead of the data asynchronously. This is best-effort: file systems are free to ignore the hint.
+	DUCKDB_API virtual void Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes);
+	//! Map the first nr_bytes of the file into memory for reading, returning a pointer to the mapping. Returns
+	//! nullptr if the file system does not support memory mapping. The mapping remains valid until it is released
+	//! again through MemoryUnmap.
+	DUCKDB_API virtual data_ptr_t MemoryMapRead(FileHandle &handle, idx_t nr_bytes);
+	//! Release a memory mapping obtained from MemoryMapRead
+	DUCKDB_API virtual void MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes);
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	DUCKDB_API virtual int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes);
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/types/partitioned_column_data.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -34,4 +35,81 @@ public:
 	DUCKDB_API static const string REGEX_STRING;
 };
 
+struct HivePartitionKey {
+	//! Columns by which we're partitioning
+	vector<Value> values;
+	//! Precomputed hash of values
+	hash_t hash;
+
+	struct Hash {
+		std::size_t operator()(const HivePartitionKey &k) const {
+			return k.hash;
+		}
+	};
+
+	struct Equality {
+		bool operator()(const HivePartitionKey &a, const HivePartitionKey &b) const {
+			if (a.values.size() != b.values.size()) {
+				return false;
+			}
+			for (idx_t i = 0; i < a.values.size(); i++) {
+				if (!Value::NotDistinctFrom(a.values[i], b.values[i])) {
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+};
+
+//! Maps hive partitions to partition_ids
+typedef unordered_map<HivePartitionKey, idx_t, HivePartitionKey::Hash, HivePartitionKey::Equality> hive_partition_map_t;
+
+//! class shared between HivePartitionColumnData classes that synchronizes partition discovery between threads.
+//! each HivePartitionedColumnData will hold a local copy of the key->partition map
+class GlobalHivePartitionState {
+public:
+	mutex lock;
+	hive_partition_map_t partition_map;
+	//! Used for incremental updating local copies of the partition map
+	vector<hive_partition_map_t::const_iterator> partitions;
+};
+
+class HivePartitionedColumnData : public PartitionedColumnData {
+public:
+	HivePartitionedColumnData(ClientContext &context, vector<LogicalType> types, vector<idx_t> partition_by_cols,
+	                          shared_ptr<GlobalHivePartitionState> global_state = nullptr)
+	    : PartitionedColumnData(PartitionedColumnDataType::HIVE, context, std::move(types)),
+	      global_state(std::move(global_state)), group_by_columns(std::move(partition_by_cols)),
+	      hashes_v(LogicalType::HASH) {
+	}
+	HivePartitionedColumnData(const HivePartitionedColumnData &other);
+	void ComputePartitionIndices(PartitionedColumnDataAppendState &state, DataChunk &input) override;
+
+	//! Reverse lookup map to reconstruct keys from a partition id
+	std::map<idx_t, const HivePartitionKey *> GetReverseMap();
+
+protected:
+	//! Create allocators for all currently registered partitions
+	void GrowAllocators();
+	//! Create append states for all currently registered partitions
+	void GrowAppendState(PartitionedColumnDataAppendState &state);
+	//! Create and initialize partitions for all currently registered partitions
+	void GrowPartitions(PartitionedColumnDataAppendState &state);
+	//! Register a newly discovered partition
+	idx_t RegisterNewPartition(HivePartitionKey key, PartitionedColumnDataAppendState &state);
+	//! Copy the newly added entries in the global_state.map to the local_partition_map (requires lock!)
+	void SynchronizeLocalMap();
+
+private:
+	//! Shared HivePartitionedColumnData should always have a global state to allow parallel key discovery
+	shared_ptr<GlobalHivePartitionState> global_state;
+	//! Thread-local copy of the partition map
+	hive_partition_map_t local_partition_map;
+	//! The columns that make up the key
+	vector<idx_t> group_by_columns;
+	//! Thread-local pre-allocated vector for hash calculations
+	Vector hashes_v;
+};
+
 } // namespace duckdb
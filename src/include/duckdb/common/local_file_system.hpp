@@ -27,6 +27,12 @@ public:
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	//! Hint that nr_bytes at the specified location will be read soon, starting an asynchronous read-ahead
+	void Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) override;
+	//! Map the first nr_bytes of the file into memory for reading, or nullptr if mapping fails
+	data_ptr_t MemoryMapRead(FileHandle &handle, idx_t nr_bytes) override;
+	//! Release a memory mapping obtained from MemoryMapRead
+	void MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) override;
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 
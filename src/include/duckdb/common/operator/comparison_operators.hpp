@@ -166,8 +166,10 @@ struct StringComparisonOperators {
 		} else {
 			// large string: first check prefix and length
 			if (memcmp(&a, &b, string_t::HEADER_SIZE) == 0) {
-				// prefix and length are equal: check main string
-				if (memcmp(a.value.pointer.ptr, b.value.pointer.ptr, a.GetSize()) == 0) {
+				// prefix and length are equal: check the remainder of the string
+				// the first PREFIX_LENGTH bytes were already compared as part of the header
+				if (memcmp(a.value.pointer.ptr + string_t::PREFIX_LENGTH, b.value.pointer.ptr + string_t::PREFIX_LENGTH,
+				           a.GetSize() - string_t::PREFIX_LENGTH) == 0) {
 					// entire string is equal
 					return INVERSE ? false : true;
 				}
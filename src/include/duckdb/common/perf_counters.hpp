@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/perf_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! PerfEventCounters samples hardware performance counters (instructions, last-level cache misses and stalled
+//! cycles) through the Linux perf_event_open interface. On other platforms, or when the counters cannot be
+//! opened (e.g. restricted by perf_event_paranoid), the counters simply remain inactive.
+class PerfEventCounters {
+public:
+	PerfEventCounters();
+	~PerfEventCounters();
+
+	//! Try to open the counters for the calling thread; returns false when they remain inactive
+	bool Initialize();
+	//! Whether or not the counters were successfully opened
+	bool IsActive() const {
+		return active;
+	}
+	//! Start counting; must be paired with a call to End
+	void Begin();
+	//! Stop counting and add the counts since Begin to the totals
+	void End();
+	//! Reset the accumulated totals
+	void Reset();
+
+	//! The number of retired instructions counted
+	uint64_t instructions = 0;
+	//! The number of last-level cache misses counted
+	uint64_t llc_misses = 0;
+	//! The number of stalled (backend) cycles counted
+	uint64_t stalled_cycles = 0;
+
+private:
+	//! The maximum number of events in the group
+	static constexpr idx_t MAX_EVENTS = 3;
+
+	bool active = false;
+	//! The group leader file descriptor (-1 if inactive)
+	int group_fd = -1;
+	//! The file descriptors of the opened events (-1 if not opened)
+	int event_fds[MAX_EVENTS];
+	//! Maps each opened event id to the counter it feeds
+	uint64_t event_ids[MAX_EVENTS];
+};
+
+} // namespace duckdb
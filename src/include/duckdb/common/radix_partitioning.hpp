@@ -26,7 +26,9 @@ struct RadixPartitioningConstants {
 public:
 	static constexpr const idx_t NUM_RADIX_BITS = radix_bits;
 	static constexpr const idx_t NUM_PARTITIONS = (idx_t)1 << NUM_RADIX_BITS;
-	static constexpr const idx_t TMP_BUF_SIZE = 8;
+	//! How many rows are buffered per partition before being flushed to the partition block
+	//! Larger buffers amortize the TLB/cache misses of the scattered writes at high partition counts
+	static constexpr const idx_t TMP_BUF_SIZE = 64;
 
 public:
 	//! Apply bitmask on the highest bits, and right shift to get a number between 0 and NUM_PARTITIONS
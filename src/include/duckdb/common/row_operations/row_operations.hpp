@@ -15,6 +15,7 @@ namespace duckdb {
 
 struct AggregateObject;
 struct AggregateFilterData;
+class ArenaAllocator;
 class DataChunk;
 class RowLayout;
 class RowDataCollection;
@@ -31,16 +32,19 @@ struct RowOperations {
 	//! initialize - unaligned addresses
 	static void InitializeStates(RowLayout &layout, Vector &addresses, const SelectionVector &sel, idx_t count);
 	//! destructor - unaligned addresses, updated
-	static void DestroyStates(RowLayout &layout, Vector &addresses, idx_t count);
+	static void DestroyStates(ArenaAllocator &allocator, RowLayout &layout, Vector &addresses, idx_t count);
 	//! update - aligned addresses
-	static void UpdateStates(AggregateObject &aggr, Vector &addresses, DataChunk &payload, idx_t arg_idx, idx_t count);
+	static void UpdateStates(ArenaAllocator &allocator, AggregateObject &aggr, Vector &addresses, DataChunk &payload,
+	                         idx_t arg_idx, idx_t count);
 	//! filtered update - aligned addresses
-	static void UpdateFilteredStates(AggregateFilterData &filter_data, AggregateObject &aggr, Vector &addresses,
-	                                 DataChunk &payload, idx_t arg_idx);
+	static void UpdateFilteredStates(ArenaAllocator &allocator, AggregateFilterData &filter_data, AggregateObject &aggr,
+	                                 Vector &addresses, DataChunk &payload, idx_t arg_idx);
 	//! combine - unaligned addresses, updated
-	static void CombineStates(RowLayout &layout, Vector &sources, Vector &targets, idx_t count);
+	static void CombineStates(ArenaAllocator &allocator, RowLayout &layout, Vector &sources, Vector &targets,
+	                          idx_t count);
 	//! finalize - unaligned addresses, updated
-	static void FinalizeStates(RowLayout &layout, Vector &addresses, DataChunk &result, idx_t aggr_idx);
+	static void FinalizeStates(ArenaAllocator &allocator, RowLayout &layout, Vector &addresses, DataChunk &result,
+	                           idx_t aggr_idx);
 
 	//===--------------------------------------------------------------------===//
 	// Read/Write Operators
@@ -54,6 +58,13 @@ struct RowOperations {
 	static void Gather(Vector &rows, const SelectionVector &row_sel, Vector &col, const SelectionVector &col_sel,
 	                   const idx_t count, const RowLayout &layout, const idx_t col_no, const idx_t build_size = 0,
 	                   data_ptr_t heap_ptr = nullptr);
+	//! Gather the columns [col_no, col_no + col_count) into result.data[result_col_no] and onwards with a
+	//! single pass over the row pointers: the fixed-width columns of a row are reconstructed together
+	//! while the row is in cache, sharing the validity bytes loaded for it. Columns that reference the
+	//! row heap fall back to per-column gathers.
+	static void Gather(Vector &rows, const SelectionVector &row_sel, DataChunk &result, const idx_t result_col_no,
+	                   const SelectionVector &col_sel, const idx_t count, const RowLayout &layout, const idx_t col_no,
+	                   const idx_t col_count, const idx_t build_size = 0, data_ptr_t heap_ptr = nullptr);
 	//! Full Scan an entire columns
 	static void FullScanColumn(const RowLayout &layout, Vector &rows, Vector &col, idx_t count, idx_t col_idx);
 
@@ -69,6 +80,22 @@ struct RowOperations {
 	                   const Predicates &predicates, SelectionVector &sel, idx_t count, SelectionVector *no_match,
 	                   idx_t &no_match_count);
 
+	//! Signature of a match function as returned by InitializeMatch
+	typedef idx_t (*match_function_t)(DataChunk &columns, UnifiedVectorFormat col_data[], const RowLayout &layout,
+	                                  Vector &rows, const Predicates &predicates, SelectionVector &sel, idx_t count,
+	                                  SelectionVector *no_match, idx_t &no_match_count);
+
+	//! Returns a match function specialized for common key layouts (e.g. a single integer or string key),
+	//! or the generic Match if there is no specialization for the given layout and predicates
+	static match_function_t InitializeMatch(const RowLayout &layout, const Predicates &predicates);
+	//! Signature of a scatter function as returned by InitializeScatter
+	typedef void (*scatter_function_t)(DataChunk &columns, UnifiedVectorFormat col_data[], const RowLayout &layout,
+	                                   Vector &rows, RowDataCollection &string_heap, const SelectionVector &sel,
+	                                   idx_t count);
+	//! Returns a scatter function specialized for the column types of the layout where possible, and the generic
+	//! Scatter otherwise
+	static scatter_function_t InitializeScatter(const RowLayout &layout);
+
 	//===--------------------------------------------------------------------===//
 	// Heap Operators
 	//===--------------------------------------------------------------------===//
@@ -22,6 +22,14 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Number of runs that are merged simultaneously in a cascaded external merge round
+	//! A higher fan-out reduces the number of rounds (and therefore I/O for external sorts),
+	//! but pins more blocks per merge and makes each comparison slightly more expensive
+	static constexpr idx_t MERGE_FANOUT = 8;
+	//! Maximum fan-out of an in-memory merge round: when all runs fit in one group, the merge
+	//! completes in a single round in which every thread produces a disjoint slice of the final
+	//! result, so the cascade (and the barriers between its rounds) disappears entirely
+	static constexpr idx_t MAX_MERGE_FANOUT = 128;
 };
 
 struct SortLayout {
@@ -92,10 +100,12 @@ public:
 	bool external;
 
 	//! Progress in merge path stage
-	idx_t pair_idx;
-	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	idx_t group_idx;
+	idx_t num_groups;
+	//! Fan-out of the current merge round
+	idx_t merge_fanout;
+	//! Per run of the current group: how many rows have been assigned to a merge partition
+	vector<idx_t> run_starts;
 };
 
 struct LocalSortState {
@@ -161,47 +171,35 @@ private:
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 
-	//! The left and right reader
-	unique_ptr<SBScanState> left;
-	unique_ptr<SBScanState> right;
+	//! The readers for the runs that are being merged
+	vector<unique_ptr<SBScanState>> runs;
 
 	//! Input and output blocks
-	unique_ptr<SortedBlock> left_input;
-	unique_ptr<SortedBlock> right_input;
+	vector<unique_ptr<SortedBlock>> run_inputs;
 	SortedBlock *result;
 
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Computes the runs and per-run boundaries that will be merged next (k-way Merge Path partition)
 	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
-	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
+	//! Finds the per-run boundaries of the next 'count' rows of the current group
+	void SelectBoundaries(const vector<SortedBlock *> &blocks, const vector<idx_t> &starts, const idx_t count,
+	                      vector<idx_t> &ends);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
 
-	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
-	void ComputeMerge(const idx_t &count, bool left_smaller[]);
-
-	//! Merges the radix sorting blocks according to the 'left_smaller' array
-	void MergeRadix(const idx_t &count, const bool left_smaller[]);
-	//! Merges SortedData according to the 'left_smaller' array
-	void MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-	               const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices);
-	//! Merges constant size rows according to the 'left_smaller' array
-	void MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr, idx_t &r_entry_idx,
-	               const idx_t &r_count, RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size,
-	               const bool left_smaller[], idx_t &copied, const idx_t &count);
-	//! Flushes constant size rows into the result
-	void FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-	               RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-	               const idx_t &count);
-	//! Flushes blob rows and accompanying heap
-	void FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-	                idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-	                data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block, BufferHandle &target_heap_handle,
-	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
+	//! Computes which run the next 'count' tuples come from by filling the 'run_index' array
+	void ComputeMerge(const idx_t count, uint8_t run_index[]);
+	//! Whether the current entry of run 'a' sorts before that of run 'b' (exhausted runs sort last)
+	bool RunPrecedes(const idx_t a, const idx_t b, const data_ptr_t radix_ptrs[]);
+
+	//! Merges the radix sorting blocks according to the 'run_index' array
+	void MergeRadix(const idx_t count, const uint8_t run_index[]);
+	//! Merges SortedData according to the 'run_index' array
+	void MergeData(SortedData &result_data, const vector<SortedData *> &input_data, const idx_t count,
+	               const uint8_t run_index[], idx_t next_entry_sizes[], bool reset_indices);
 };
 
 } // namespace duckdb
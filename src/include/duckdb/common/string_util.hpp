@@ -12,6 +12,8 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/vector.hpp"
 
+#include <cstring>
+
 namespace duckdb {
 /**
  * String Utility Functions
@@ -33,6 +35,14 @@ public:
 	DUCKDB_API static bool CharacterIsHex(char c) {
 		return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
 	}
+	//! Returns true if all eight characters are ASCII digits, checking them with a single word comparison
+	DUCKDB_API static bool CharactersAreDigits(const data_t (&digit_chars)[8]) {
+		uint64_t chars;
+		memcpy(&chars, digit_chars, sizeof(chars));
+		// every byte must be in ['0', '9']
+		return (chars & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL &&
+		       ((chars + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL;
+	}
 	DUCKDB_API static char CharacterToLower(char c) {
 		if (c >= 'A' && c <= 'Z') {
 			return c - ('A' - 'a');
@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/thread_io_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! Per-thread counters of I/O-related activity. The hot paths that perform the work (buffer manager, segment scans)
+//! increment the counters of the current thread; the OperatorProfiler samples them around operator invocations to
+//! attribute the activity to individual operators in EXPLAIN ANALYZE.
+struct ThreadIOCounters {
+	//! The number of pins that had to load the block from disk or a temporary file
+	idx_t cold_reads = 0;
+	//! The number of pins that were served from a block that was already in memory
+	idx_t cached_reads = 0;
+	//! The number of bytes written to temporary files
+	idx_t spill_bytes_written = 0;
+	//! The number of bytes read back from temporary files
+	idx_t spill_bytes_read = 0;
+	//! The number of bytes produced by decompressing compressed segments
+	idx_t decompressed_bytes = 0;
+
+	//! Returns the counters of the current thread
+	DUCKDB_API static ThreadIOCounters &Get();
+};
+
+} // namespace duckdb
@@ -17,6 +17,7 @@ class ClientContext;
 
 struct BatchedChunkScanState {
 	map<idx_t, unique_ptr<ColumnDataCollection>>::iterator iterator;
+	map<idx_t, unique_ptr<ColumnDataCollection>>::iterator end;
 	ColumnDataScanState scan_state;
 };
 
@@ -32,9 +33,17 @@ public:
 	//! Merge the other batched chunk collection into this batched collection
 	DUCKDB_API void Merge(BatchedDataCollection &other);
 
+	//! The amount of batches held by the batched chunk collection
+	DUCKDB_API idx_t BatchCount() const;
+
 	//! Initialize a scan over the batched chunk collection
 	DUCKDB_API void InitializeScan(BatchedChunkScanState &state);
 
+	//! Initialize a scan over the batches [batch_begin, batch_end), where batches are identified by their position in
+	//! batch index order (i.e. 0 is the lowest batch index). Ranges are independent - multiple threads can each scan
+	//! their own contiguous range concurrently to consume the collection in parallel while preserving order
+	DUCKDB_API void InitializeScan(BatchedChunkScanState &state, idx_t batch_begin, idx_t batch_end);
+
 	//! Scan a chunk from the batched chunk collection, in-order of batch index
 	DUCKDB_API void Scan(BatchedChunkScanState &state, DataChunk &output);
 
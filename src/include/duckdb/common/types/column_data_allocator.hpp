@@ -40,6 +40,11 @@ public:
 	ColumnDataAllocatorType GetType() {
 		return type;
 	}
+	//! Returns the buffer manager, can only be used if the type is BUFFER_MANAGER_ALLOCATOR
+	BufferManager &GetBufferManager() {
+		D_ASSERT(type == ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR);
+		return *alloc.buffer_manager;
+	}
 	void MakeShared() {
 		shared = true;
 	}
@@ -63,6 +63,10 @@ public:
 
 	//! Get the allocator
 	DUCKDB_API Allocator &GetAllocator() const;
+	//! Get the type of the allocator backing this collection
+	DUCKDB_API ColumnDataAllocatorType GetAllocatorType() const;
+	//! Get the buffer manager backing this collection, can only be used for BUFFER_MANAGER_ALLOCATOR collections
+	DUCKDB_API BufferManager &GetBufferManager() const;
 
 	//! Initializes an Append state - useful for optimizing many appends made to the same column data collection
 	DUCKDB_API void InitializeAppend(ColumnDataAppendState &state);
@@ -97,6 +101,13 @@ public:
 	//! Append a DataChunk directly to this ColumnDataCollection - calls InitializeAppend and Append internally
 	DUCKDB_API void Append(DataChunk &new_chunk);
 
+	//! Append a DataChunk to this ColumnDataCollection by referencing its vector buffers instead of copying them.
+	//! The buffers are kept alive through shared ownership, but the caller must guarantee that their contents are
+	//! not modified afterwards - i.e. this can only be used for buffers that are immutable for the lifetime of the
+	//! collection (e.g. pinned segment scans or constant vectors), not for vectors that are reset and refilled by
+	//! an upstream operator. Scans with DISALLOW_ZERO_COPY copy the referenced data out as usual.
+	DUCKDB_API void AppendReference(DataChunk &new_chunk);
+
 	//! Appends the other ColumnDataCollection to this, destroying the other data collection
 	DUCKDB_API void Combine(ColumnDataCollection &other);
 
@@ -76,6 +76,13 @@ struct ChunkMetaData {
 	unordered_set<uint32_t> block_ids;
 	//! The number of entries in the chunk
 	uint16_t count;
+	//! Index into the referenced chunks of the segment, in case this chunk is stored as a reference to externally
+	//! owned vector buffers instead of a copy
+	idx_t referenced_chunk = DConstants::INVALID_INDEX;
+
+	bool IsReference() const {
+		return referenced_chunk != DConstants::INVALID_INDEX;
+	}
 };
 
 class ColumnDataCollectionSegment {
@@ -95,9 +102,13 @@ public:
 	vector<VectorDataIndex> child_indices;
 	//! The string heap for the column data collection (only used for IN_MEMORY_ALLOCATOR)
 	StringHeap heap;
+	//! Chunks that are stored as references to externally owned vector buffers instead of copies
+	vector<unique_ptr<DataChunk>> referenced_chunks;
 
 public:
 	void AllocateNewChunk();
+	//! Append a chunk that references the vector buffers of the input instead of copying them
+	void AppendReferencedChunk(DataChunk &input);
 	//! Allocate space for a vector of a specific type in the segment
 	VectorDataIndex AllocateVector(const LogicalType &type, ChunkMetaData &chunk_data,
 	                               ChunkManagementState *chunk_state = nullptr,
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/types/column_data_collection.hpp"
 #include "duckdb/common/types/column_data_collection_segment.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/types/column_data_scan_states.hpp"
 
 namespace duckdb {
@@ -18,6 +19,10 @@ struct ColumnDataConsumerScanState {
 	ColumnDataAllocator *allocator = nullptr;
 	ChunkManagementState current_chunk_state;
 	idx_t chunk_index;
+	//! The shard the current chunk was assigned from
+	idx_t shard_index;
+	//! The shard this scan state prefers to consume from (work is stolen from other shards when it runs out)
+	idx_t home_shard = DConstants::INVALID_INDEX;
 };
 
 //! ColumnDataConsumer can scan a ColumnDataCollection, and consume it in the process, i.e., read blocks are deleted
@@ -41,6 +46,26 @@ public:
 		uint32_t chunk_index_in_segment;
 	};
 
+	//! A contiguous run of chunk references belonging to one allocator, consumed independently of the
+	//! other shards so that consumers do not serialize on a single lock and delete frontier
+	struct ConsumerShard {
+		ConsumerShard(idx_t begin_p, idx_t end_p) : begin(begin_p), end(end_p), current_index(begin_p),
+		                                            delete_index(begin_p) {
+		}
+
+		//! The half-open range of chunk references owned by this shard
+		idx_t begin;
+		idx_t end;
+		//! Protects the shard state below
+		mutex lock;
+		//! The next chunk index to assign
+		idx_t current_index;
+		//! Chunks currently in progress
+		unordered_set<idx_t> chunks_in_progress;
+		//! The data has been consumed up to this chunk index
+		idx_t delete_index;
+	};
+
 public:
 	ColumnDataConsumer(ColumnDataCollection &collection, vector<column_t> column_ids);
 
@@ -59,10 +84,9 @@ public:
 	void FinishChunk(ColumnDataConsumerScanState &state);
 
 private:
-	void ConsumeChunks(idx_t delete_index_start, idx_t delete_index_end);
+	void ConsumeChunks(ConsumerShard &shard, idx_t delete_index_start, idx_t delete_index_end);
 
 private:
-	mutex lock;
 	//! The collection being scanned
 	ColumnDataCollection &collection;
 	//! The column ids to scan
@@ -71,12 +95,10 @@ private:
 	idx_t chunk_count;
 	//! The chunks (in order) to be scanned
 	vector<ChunkReference> chunk_references;
-	//! Current index into "chunks"
-	idx_t current_chunk_index;
-	//! Chunks currently in progress
-	unordered_set<idx_t> chunks_in_progress;
-	//! The data has been consumed up to this chunk index
-	idx_t chunk_delete_index;
+	//! The per-allocator shards that the chunk references are consumed from
+	vector<unique_ptr<ConsumerShard>> shards;
+	//! Round-robin assignment of home shards to scan states
+	atomic<idx_t> next_home_shard;
 };
 
 } // namespace duckdb
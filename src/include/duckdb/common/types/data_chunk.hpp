@@ -21,6 +21,7 @@ class Allocator;
 class ClientContext;
 class ExecutionContext;
 class VectorCache;
+class VectorCachePool;
 
 //!  A Data Chunk represents a set of vectors.
 /*!
@@ -69,6 +70,9 @@ public:
 	inline void SetCapacity(const DataChunk &other) {
 		SetCapacity(other.capacity);
 	}
+	inline idx_t GetCapacity() const {
+		return capacity;
+	}
 
 	DUCKDB_API Value GetValue(idx_t col_idx, idx_t index) const;
 	DUCKDB_API void SetValue(idx_t col_idx, idx_t index, const Value &val);
@@ -97,6 +101,12 @@ public:
 	                           vector<LogicalType>::const_iterator end, idx_t capacity = STANDARD_VECTOR_SIZE);
 	DUCKDB_API void Initialize(ClientContext &context, vector<LogicalType>::const_iterator begin,
 	                           vector<LogicalType>::const_iterator end, idx_t capacity = STANDARD_VECTOR_SIZE);
+	//! Initializes the DataChunk by fetching its vector caches from the given cache pool instead of allocating new
+	//! ones. Chunks initialized this way always have the default vector capacity.
+	DUCKDB_API void Initialize(VectorCachePool &pool, const vector<LogicalType> &types);
+	//! Returns the vector caches of this DataChunk to the given cache pool for re-use.
+	//! This destroys the chunk: it cannot be used again afterwards.
+	DUCKDB_API void RecycleCaches(VectorCachePool &pool);
 
 	//! Append the other DataChunk to this one. The column count and types of
 	//! the two DataChunks have to match exactly. Throws an exception if there
@@ -144,6 +154,8 @@ public:
 
 	//! Hashes the DataChunk to the target vector
 	DUCKDB_API void Hash(Vector &result);
+	//! Hashes column subset of the vector and appends the results to the hash vector
+	DUCKDB_API void Hash(vector<idx_t> &column_ids, Vector &result);
 
 	//! Returns a list of types of the vectors of this data chunk
 	DUCKDB_API vector<LogicalType> GetTypes();
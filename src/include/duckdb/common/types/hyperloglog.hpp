@@ -14,7 +14,7 @@
 
 namespace duckdb {
 
-enum class HLLStorageType { UNCOMPRESSED = 1 };
+enum class HLLStorageType { UNCOMPRESSED = 1, SPARSE = 2 };
 
 class FieldWriter;
 class FieldReader;
@@ -28,7 +28,7 @@ public:
 	vector<unique_ptr<ColumnDataAppendState>> partition_append_states;
 };
 
-enum class PartitionedColumnDataType : uint8_t { RADIX, INVALID };
+enum class PartitionedColumnDataType : uint8_t { RADIX, HIVE, INVALID };
 
 //! Shared allocators for parallel partitioning
 struct PartitionAllocators {
@@ -59,10 +59,15 @@ protected:
 	//===--------------------------------------------------------------------===//
 	// Partitioning type implementation interface
 	//===--------------------------------------------------------------------===//
-	//! Size of the buffers in the append states for this type of partitioning (default 128)
+	//! Initial size of the buffers in the append states for this type of partitioning (default 128)
 	virtual idx_t BufferSize() const {
 		return MinValue<idx_t>(128, STANDARD_VECTOR_SIZE);
 	}
+	//! Buffers of hot partitions are grown up to this size (default the vector size), so that skewed
+	//! partitions flush into the shared partition allocators less often
+	idx_t MaxBufferSize() const {
+		return MaxValue<idx_t>(BufferSize(), STANDARD_VECTOR_SIZE);
+	}
 	//! Initialize a PartitionedColumnDataAppendState for this type of partitioning (optional)
 	virtual void InitializeAppendStateInternal(PartitionedColumnDataAppendState &state) const {
 	}
@@ -78,11 +83,6 @@ protected:
 	PartitionedColumnData(PartitionedColumnDataType type, ClientContext &context, vector<LogicalType> types);
 	PartitionedColumnData(const PartitionedColumnData &other);
 
-	//! If the buffer is half full, we append to the partition
-	inline idx_t HalfBufferSize() const {
-		D_ASSERT((BufferSize() & (BufferSize() - 1)) == 0); // BufferSize should be a power of two
-		return BufferSize() / 2;
-	}
 	//! Create a new shared allocator
 	void CreateAllocator();
 	//! Create a collection for a specific a partition
@@ -91,6 +91,8 @@ protected:
 	}
 	//! Create a DataChunk used for buffering appends to the partition
 	unique_ptr<DataChunk> CreatePartitionBuffer() const;
+	//! Create a partition buffer with a specific capacity
+	unique_ptr<DataChunk> CreatePartitionBuffer(idx_t capacity) const;
 
 protected:
 	PartitionedColumnDataType type;
@@ -37,6 +37,10 @@ public:
 	DUCKDB_API string_t AddBlob(const char *data, idx_t len);
 	//! Allocates space for an empty string of size "len" on the heap
 	DUCKDB_API string_t EmptyString(idx_t len);
+	//! Add a batch of strings to the string heap using a single allocation. Each entry holds the string to add and
+	//! receives the heap-backed string in place; the entries must be non-inlined. No validation is performed, so
+	//! this can be used for blobs as well.
+	DUCKDB_API void AddStringBatch(string_t *entries[], idx_t count);
 
 private:
 	ArenaAllocator allocator;
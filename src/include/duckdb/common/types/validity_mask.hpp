@@ -98,10 +98,27 @@ public:
 		if (AllValid()) {
 			return true;
 		}
-		for (idx_t i = from; i < to; i++) {
-			if (!RowIsValid(i)) {
+		idx_t row = from;
+		// check bit-by-bit until we are aligned to an entry boundary
+		while (row < to && row % BITS_PER_VALUE != 0) {
+			if (!RowIsValidUnsafe(row)) {
 				return false;
 			}
+			row++;
+		}
+		// check the entries that are covered entirely at the word level
+		while (row + BITS_PER_VALUE <= to) {
+			if (!AllValid(validity_mask[row / BITS_PER_VALUE])) {
+				return false;
+			}
+			row += BITS_PER_VALUE;
+		}
+		// check the ragged end bit-by-bit
+		while (row < to) {
+			if (!RowIsValidUnsafe(row)) {
+				return false;
+			}
+			row++;
 		}
 		return true;
 	}
@@ -112,32 +129,16 @@ public:
 		}
 
 		idx_t valid = 0;
-		const auto entry_count = EntryCount(count);
-		for (idx_t entry_idx = 0; entry_idx < entry_count;) {
-			auto entry = GetValidityEntry(entry_idx++);
-			// Handle ragged end (if not exactly multiple of BITS_PER_VALUE)
-			if (entry_idx == entry_count && count % BITS_PER_VALUE != 0) {
-				idx_t idx_in_entry;
-				GetEntryIndex(count, entry_idx, idx_in_entry);
-				for (idx_t i = 0; i < idx_in_entry; ++i) {
-					valid += idx_t(RowIsValid(entry, i));
-				}
-				break;
-			}
-
-			// Handle all set
-			if (AllValid(entry)) {
-				valid += BITS_PER_VALUE;
-				continue;
-			}
-
-			// Count partial entry (Kernighan's algorithm)
-			while (entry) {
-				entry &= (entry - 1);
-				++valid;
-			}
+		// count the entries that are covered entirely in bulk: a branch-free popcount loop that vectorizes well
+		const auto full_entry_count = count / BITS_PER_VALUE;
+		for (idx_t entry_idx = 0; entry_idx < full_entry_count; entry_idx++) {
+			valid += CountValidBits(validity_mask[entry_idx]);
+		}
+		if (count % BITS_PER_VALUE != 0) {
+			// handle the ragged end: only count the bits that fall within count
+			auto entry = GetValidityEntry(full_entry_count);
+			valid += CountValidBits(entry & EntryWithValidBits(count % BITS_PER_VALUE));
 		}
-
 		return valid;
 	}
 
@@ -164,6 +165,10 @@ public:
 	static inline bool NoneValid(V entry) {
 		return entry == 0;
 	}
+	//! Count the number of valid (set) bits in a single validity entry
+	static inline idx_t CountValidBits(V entry) {
+		return idx_t(__builtin_popcountll(uint64_t(entry)));
+	}
 	static inline bool RowIsValid(V entry, idx_t idx_in_entry) {
 		return entry & (V(1) << V(idx_in_entry));
 	}
@@ -364,6 +364,10 @@ struct StringVector {
 	//! Add a string or a blob to the string heap of the vector (auxiliary data)
 	//! This function is the same as ::AddString, except the added data does not need to be valid UTF8
 	DUCKDB_API static string_t AddStringOrBlob(Vector &vector, string_t data);
+	//! Add a batch of strings or blobs to the string heap of the vector (auxiliary data) using a single allocation.
+	//! Each entry holds the string to add and receives the heap-backed string in place; the entries must be
+	//! non-inlined.
+	DUCKDB_API static void AddStringBatch(Vector &vector, string_t *entries[], idx_t count);
 	//! Allocates an empty string of the specified size, and returns a writable pointer that can be used to store the
 	//! result of an operation
 	DUCKDB_API static string_t EmptyString(Vector &vector, idx_t len);
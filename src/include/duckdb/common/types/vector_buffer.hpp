@@ -148,6 +148,9 @@ public:
 	string_t EmptyString(idx_t len) {
 		return heap.EmptyString(len);
 	}
+	void AddStringBatch(string_t *entries[], idx_t count) {
+		heap.AddStringBatch(entries, count);
+	}
 
 	void AddHeapReference(buffer_ptr<VectorBuffer> heap) {
 		references.push_back(std::move(heap));
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/vector_cache_pool.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/type_map.hpp"
+#include "duckdb/common/types/vector_cache.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class Allocator;
+
+//! The VectorCachePool recycles vector caches between chunks. Chunks that draw their caches from a pool return them
+//! when they are torn down, so that chunks created later re-use the same buffers instead of performing fresh
+//! allocations for every vector.
+class VectorCachePool {
+public:
+	DUCKDB_API explicit VectorCachePool(Allocator &allocator);
+
+	//! Fetch a cache of the given type, re-using a pooled cache if one is available.
+	//! Pooled caches always have the default vector capacity.
+	DUCKDB_API VectorCache GetCache(const LogicalType &type);
+	//! Return a cache to the pool for later re-use. Caches whose buffer is still referenced elsewhere are dropped
+	//! instead, since handing them out again would alias live data.
+	DUCKDB_API void ReturnCache(VectorCache cache);
+
+private:
+	//! The maximum amount of caches that is kept around per type
+	static constexpr const idx_t MAXIMUM_CACHES_PER_TYPE = 64;
+
+	//! The allocator used to construct new caches
+	Allocator &allocator;
+	//! The lock protecting the free lists
+	mutex lock;
+	//! Per-type free lists of returned caches
+	type_map_t<vector<VectorCache>> caches;
+};
+
+} // namespace duckdb
@@ -34,6 +34,10 @@ public:
 		return handle.file_system.Read(handle, buffer, nr_bytes);
 	}
 
+	void Prefetch(FileHandle &handle, idx_t location, idx_t nr_bytes) override {
+		handle.file_system.Prefetch(handle, location, nr_bytes);
+	}
+
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return handle.file_system.Write(handle, buffer, nr_bytes);
 	}
@@ -17,6 +17,7 @@ class AdaptiveFilter {
 public:
 	explicit AdaptiveFilter(const Expression &expr);
 	explicit AdaptiveFilter(TableFilterSet *table_filters);
+	explicit AdaptiveFilter(idx_t condition_count);
 	void AdaptRuntimeStatistics(double duration);
 	vector<idx_t> permutation;
 
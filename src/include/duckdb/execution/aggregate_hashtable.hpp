@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/execution/base_aggregate_hashtable.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 
@@ -67,6 +68,9 @@ public:
 	//! The hash table load factor, when a resize is triggered
 	constexpr static float LOAD_FACTOR = 1.5;
 	constexpr static uint8_t HASH_WIDTH = sizeof(hash_t);
+	//! The amount of old directory entries that are migrated to the new directory per probe batch during an
+	//! incremental resize, bounding the per-batch stall a resize can cause
+	constexpr static idx_t RESIZE_MIGRATION_CHUNK = 4096;
 
 public:
 	GroupedAggregateHashTable(ClientContext &context, Allocator &allocator, vector<LogicalType> group_types,
@@ -108,12 +112,20 @@ public:
 	//! Executes the filter(if any) and update the aggregates
 	void Combine(GroupedAggregateHashTable &other);
 
+	//! Combines the groups and states of the other HT into this HT, grouping on a subset of the other HT's group
+	//! columns (given by column_ids, where INVALID_INDEX denotes the constant group used for aggregation without
+	//! groups). Unlike Combine, the other HT is left intact so that it can still be scanned afterwards.
+	void CombineRollup(GroupedAggregateHashTable &other, const vector<column_t> &column_ids);
+
 	idx_t Size() {
 		return entries;
 	}
 
 	idx_t MaxCapacity();
 
+	//! The approximate in-memory size of the HT in bytes (payload blocks, string heap, and hash directory)
+	idx_t TotalSize() const;
+
 	void Partition(vector<GroupedAggregateHashTable *> &partition_hts, hash_t mask, idx_t shift);
 
 	void Finalize();
@@ -140,6 +152,16 @@ private:
 	data_ptr_t hashes_end_ptr; // of hashes
 	idx_t hash_offset;         // Offset into the layout of the hash column
 
+	//! The previous directory during an incremental resize: groups that have not been migrated to the new
+	//! directory yet can still only be found here
+	BufferHandle old_hashes_hdl;
+	data_ptr_t old_hashes_hdl_ptr;
+	idx_t old_capacity;
+	hash_t old_bitmask;
+	//! The next payload row to be migrated into the new directory, and the first row that does not require migration
+	idx_t migrate_position;
+	idx_t migrate_end;
+
 	hash_t hash_prefix_shift;
 	idx_t payload_page_offset;
 
@@ -157,6 +179,10 @@ private:
 	SelectionVector no_match_vector;
 	SelectionVector empty_vector;
 	vector<ExpressionType> predicates;
+	//! The match function, specialized for the group layout where possible
+	RowOperations::match_function_t match_function;
+	//! The scatter function to use, initialized once for the group layout
+	RowOperations::scatter_function_t scatter_function;
 
 private:
 	GroupedAggregateHashTable(const GroupedAggregateHashTable &) = delete;
@@ -168,12 +194,25 @@ private:
 	void Verify();
 
 	void FlushMove(FlushMoveState &state, Vector &source_addresses, Vector &source_hashes, idx_t count);
+	void FlushRollup(FlushMoveState &state, GroupedAggregateHashTable &other, const vector<column_t> &column_ids,
+	                 Vector &source_addresses, Vector &hashes, idx_t count);
 	void NewBlock();
 
+	//! Whether an incremental resize is still migrating entries from the old directory
+	bool ResizeInProgress() const {
+		return old_capacity > 0;
+	}
+
 	template <class ENTRY>
 	void VerifyInternal();
 	template <class ENTRY>
 	void Resize(idx_t size);
+	//! Migrate up to migrate_count payload rows from the old directory into the new one
+	template <class ENTRY>
+	void MigrateOldDirectory(idx_t migrate_count);
+	//! Complete any in-progress incremental resize
+	template <class ENTRY>
+	void FinishResize();
 	template <class ENTRY>
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
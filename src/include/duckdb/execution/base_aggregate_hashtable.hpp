@@ -12,6 +12,7 @@
 #include "duckdb/common/types/row_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 class BufferManager;
@@ -26,6 +27,9 @@ public:
 protected:
 	Allocator &allocator;
 	BufferManager &buffer_manager;
+	//! Arena allocator used by the aggregates for their internal (variable-size) state data. Owned by the HT so that
+	//! all of it can be freed at once when the HT is destroyed
+	ArenaAllocator aggregate_allocator;
 	//! A helper for managing offsets into the data buffers
 	RowLayout layout;
 	//! The types of the payload columns stored in the hashtable
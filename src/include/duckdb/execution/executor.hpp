@@ -24,6 +24,7 @@ class OperatorState;
 class QueryProfiler;
 class ThreadContext;
 class Task;
+class VectorCachePool;
 
 struct PipelineEventStack;
 struct ProducerToken;
@@ -74,11 +75,16 @@ public:
 	bool GetPipelinesProgress(double &current_progress);
 
 	void CompletePipeline() {
-		completed_pipelines++;
+		if (++completed_pipelines == total_pipelines) {
+			SignalCompletion();
+		}
 	}
 	ProducerToken &GetToken() {
 		return *producer;
 	}
+	VectorCachePool &GetCachePool() {
+		return *cache_pool;
+	}
 	void AddEvent(shared_ptr<Event> event);
 
 	void AddRecursiveCTE(PhysicalOperator *rec_cte);
@@ -89,6 +95,12 @@ public:
 	//! Returns the query result - can only be used if `HasResultCollector` returns true
 	unique_ptr<QueryResult> GetResult();
 
+	//! Register a callback that is invoked (from a scheduler thread) once all pipelines have completed or
+	//! execution has failed or been cancelled; if that already happened, it is invoked immediately. After the
+	//! callback fires, ExecuteTask finishes the query without processing further tasks. Note that without
+	//! background threads (threads=1) the caller must still drive execution through ExecuteTask.
+	DUCKDB_API void SetCompletionCallback(std::function<void()> callback);
+
 private:
 	void InitializeInternal(PhysicalOperator *physical_plan);
 
@@ -103,6 +115,9 @@ private:
 
 	bool NextExecutor();
 
+	//! Invoke the completion callback (if any); only the first call per query fires it
+	void SignalCompletion();
+
 	shared_ptr<Pipeline> CreateChildPipeline(Pipeline *current, PhysicalOperator *op);
 
 	void VerifyPipeline(Pipeline &pipeline);
@@ -132,6 +147,8 @@ private:
 	vector<shared_ptr<Event>> events;
 	//! The query profiler
 	shared_ptr<QueryProfiler> profiler;
+	//! Pool of vector caches that is shared by the pipeline executors of this query
+	unique_ptr<VectorCachePool> cache_pool;
 
 	//! The amount of completed pipelines of the query
 	atomic<idx_t> completed_pipelines;
@@ -140,6 +157,13 @@ private:
 	//! Whether or not execution is cancelled
 	bool cancelled;
 
+	//! Lock protecting the completion callback state below
+	mutex completion_lock;
+	//! Callback invoked once execution has completed, failed or been cancelled
+	std::function<void()> completion_callback;
+	//! Whether completion has been signalled already
+	bool completion_signalled = false;
+
 	//! The last pending execution result (if any)
 	PendingExecutionResult execution_result;
 	//! The current task in process (if any)
@@ -42,11 +42,16 @@ public:
 	void Verify(ExpressionExecutorState &root);
 };
 
+//! A fused kernel evaluates a small expression tree in a single loop without intermediate vectors
+typedef void (*fused_expression_kernel_t)(DataChunk &input, Vector &result);
+
 struct ExecuteFunctionState : public ExpressionState {
 	ExecuteFunctionState(const Expression &expr, ExpressionExecutorState &root);
 	~ExecuteFunctionState();
 
 	unique_ptr<FunctionLocalState> local_state;
+	//! The fused kernel replacing the function call (if the expression tree could be fused)
+	fused_expression_kernel_t fused_kernel = nullptr;
 
 public:
 	DUCKDB_API static FunctionLocalState *GetFunctionState(ExpressionState &state) {
@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/fused_kernels.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/expression_executor_state.hpp"
+
+namespace duckdb {
+class BoundFunctionExpression;
+
+//! FusedKernels recognizes common arithmetic expression trees when an ExpressionExecutor is
+//! initialized and executes them as a single template-instantiated loop, so that e.g. (a * b) + c
+//! does not materialize an intermediate vector for the inner multiplication
+struct FusedKernels {
+	//! Try to fuse the given function expression into a single kernel
+	//! Returns nullptr if the expression does not match a fusable pattern
+	//! On success, leaves is filled with the three leaf expressions that provide the kernel inputs
+	static fused_expression_kernel_t TryFuse(const BoundFunctionExpression &expr, vector<Expression *> &leaves);
+};
+
+} // namespace duckdb
@@ -120,6 +120,9 @@ private:
 
 	//! Erase element from leaf (if leaf has more than one value) or eliminate the leaf itself
 	void Erase(Node *&node, Key &key, idx_t depth, row_t row_id);
+	//! Erase the sorted key section [start, end] from the tree, descending shared paths only once
+	void EraseGrouped(Node *&node, vector<Key> &keys, const idx_t *sorted, const row_t *row_ids, idx_t start,
+	                  idx_t end, idx_t depth);
 
 	//! Perform 'Lookup' for an entire chunk, marking which succeeded
 	void LookupValues(DataChunk &input, ConflictManager &conflict_manager) final override;
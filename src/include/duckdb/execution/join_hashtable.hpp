@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column_data_consumer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/null_value.hpp"
@@ -72,6 +73,14 @@ class JoinHashTable {
 public:
 	using ValidityBytes = TemplatedValidityMask<uint8_t>;
 
+	//! On 64-bit platforms the upper 16 bits of a pointer are unused: every pointer stored in the hash map and in
+	//! the tuple chains is tagged with the upper 16 bits (the "salt") of the hash of the tuple it points to, so
+	//! that probes can reject most non-matching tuples without having to compare their keys. On 32-bit platforms
+	//! the tag would be truncated when the value is cast back to a pointer, so the mask is zero there and both
+	//! tagging and salt comparison compile down to no-ops.
+	constexpr static uint64_t SALT_MASK = sizeof(data_ptr_t) == 8 ? 0xFFFF000000000000 : 0;
+	constexpr static uint64_t POINTER_MASK = ~SALT_MASK;
+
 	//! Scan structure that can be used to resume scans, as a single probe can
 	//! return 1024*N values (where N is the size of the HT). This is
 	//! returned by the JoinHashTable::Scan function and can be used to resume a
@@ -81,6 +90,8 @@ public:
 		Vector pointers;
 		idx_t count;
 		SelectionVector sel_vector;
+		//! The salt bits of every probe key's hash, used to reject chain entries without comparing their keys
+		uint64_t salts[STANDARD_VECTOR_SIZE];
 		// whether or not the given tuple has found a match
 		unique_ptr<bool[]> found_match;
 		JoinHashTable &ht;
@@ -121,6 +132,9 @@ public:
 		void GatherResult(Vector &result, const SelectionVector &result_vector, const SelectionVector &sel_vector,
 		                  const idx_t count, const idx_t col_idx);
 		void GatherResult(Vector &result, const SelectionVector &sel_vector, const idx_t count, const idx_t col_idx);
+		//! Gather all build columns of the hash table at once, sharing one pass over the row pointers
+		void GatherResult(DataChunk &result, const idx_t base_column_id, const SelectionVector &result_vector,
+		                  const SelectionVector &sel_vector, const idx_t count);
 		idx_t ResolvePredicates(DataChunk &keys, SelectionVector &match_sel, SelectionVector *no_match_sel);
 	};
 
@@ -171,6 +185,8 @@ public:
 	vector<LogicalType> build_types;
 	//! The comparison predicates
 	vector<ExpressionType> predicates;
+	//! The match function, specialized for the key layout where possible
+	RowOperations::match_function_t match_function;
 	//! Data column layout
 	RowLayout layout;
 	//! The size of an entry as stored in the HashTable
@@ -211,9 +227,8 @@ private:
 	unique_ptr<ScanStructure> InitializeScanStructure(DataChunk &keys, const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
-	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Initialize the probe pointers and salts for the given hashes
+	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers, uint64_t salts[]);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -337,6 +352,10 @@ public:
 	                                        ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk);
 
 private:
+	//! Partition on more radix bits if a single partition is too large for one probe round (called before the
+	//! first probe round only, so that the probe data is partitioned on the same radix bits)
+	void Repartition();
+
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
@@ -14,11 +14,13 @@
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 
 namespace duckdb {
+class AdaptiveFilter;
 class ColumnDataCollection;
 
 struct NestedLoopJoinInner {
 	static idx_t Perform(idx_t &ltuple, idx_t &rtuple, DataChunk &left_conditions, DataChunk &right_conditions,
-	                     SelectionVector &lvector, SelectionVector &rvector, const vector<JoinCondition> &conditions);
+	                     SelectionVector &lvector, SelectionVector &rvector, const vector<JoinCondition> &conditions,
+	                     AdaptiveFilter *adaptive_filter);
 };
 
 struct NestedLoopJoinMark {
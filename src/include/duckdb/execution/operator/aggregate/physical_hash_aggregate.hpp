@@ -82,6 +82,12 @@ public:
 
 	unordered_map<Expression *, size_t> filter_indexes;
 
+	//! For each grouping set, the index of the grouping set that its result is rolled up from
+	//! (or INVALID_INDEX if it aggregates the input itself)
+	vector<idx_t> rollup_sources;
+	//! The rolled-up grouping sets in the order in which they have to be computed (supersets first)
+	vector<idx_t> rollup_order;
+
 public:
 	// Source interface
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
@@ -129,6 +135,11 @@ private:
 	//! When we only have distinct aggregates, we can delay adding groups to the main ht
 	bool CanSkipRegularSink() const;
 
+	//! Whether the grouping at the given index is rolled up from another grouping's result
+	bool IsRollupDerived(idx_t grouping_idx) const {
+		return rollup_sources[grouping_idx] != DConstants::INVALID_INDEX;
+	}
+
 	//! Finalize the distinct aggregates
 	SinkFinalizeType FinalizeDistinct(Pipeline &pipeline, Event &event, ClientContext &context,
 	                                  GlobalSinkState &gstate) const;
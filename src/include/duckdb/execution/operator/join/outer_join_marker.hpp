@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
@@ -60,9 +61,29 @@ public:
 	//! Perform the scan
 	void Scan(OuterJoinGlobalScanState &gstate, OuterJoinLocalScanState &lstate, DataChunk &result);
 
+private:
+	//! The number of match bits that are stored per bitmap word
+	static constexpr const idx_t BITS_PER_WORD = sizeof(uint64_t) * 8;
+
+	//! Returns whether or not the row at the given position has found a match
+	inline bool RowMatched(idx_t position) const {
+		auto bit = uint64_t(1) << (position % BITS_PER_WORD);
+		return found_match[position / BITS_PER_WORD].load(std::memory_order_relaxed) & bit;
+	}
+	//! Sets the match bit of the given position. The bitmap is updated with relaxed atomics: probe threads only ever
+	//! set bits, and the pipeline barrier between the probe and the final unmatched scan orders the phases.
+	inline void SetMatchInternal(idx_t position) {
+		auto &word = found_match[position / BITS_PER_WORD];
+		auto bit = uint64_t(1) << (position % BITS_PER_WORD);
+		if (!(word.load(std::memory_order_relaxed) & bit)) {
+			word.fetch_or(bit, std::memory_order_relaxed);
+		}
+	}
+
 private:
 	bool enabled;
-	unique_ptr<bool[]> found_match;
+	//! The shared match bitmap, one bit per row of the materialized side
+	unique_ptr<atomic<uint64_t>[]> found_match;
 	idx_t count;
 };
 
@@ -20,13 +20,15 @@ class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! Per equality condition: the min/max of the build keys, and the stride of the key within the composed
+	//! position (the product of the ranges of the preceding keys)
+	vector<Value> key_mins;
+	vector<Value> key_maxes;
+	vector<idx_t> key_strides;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! The maximum composed position over all keys
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
@@ -44,21 +46,17 @@ public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable();
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
+	void ComposePositionsSwitchProbe(Vector &source, idx_t key_idx, idx_t count, idx_t *positions);
 	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	void TemplatedComposePositionsProbe(Vector &source, idx_t key_idx, idx_t count, idx_t *positions);
 
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
+	bool ComposePositionsSwitchBuild(Vector &source, idx_t key_idx, idx_t count, idx_t *positions);
 	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(JoinHTScanState &state, LogicalType &key_type);
+	bool TemplatedComposePositionsBuild(Vector &source, idx_t key_idx, idx_t count, idx_t *positions);
+	bool FullScanHashTable(JoinHTScanState &state);
 
 private:
 	const PhysicalHashJoin &join;
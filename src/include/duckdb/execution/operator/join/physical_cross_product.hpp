@@ -16,6 +16,10 @@ namespace duckdb {
 //! PhysicalCrossProduct represents a cross product between two tables
 class PhysicalCrossProduct : public CachingPhysicalOperator {
 public:
+	//! The number of LHS rows that are buffered into a tile before the RHS is streamed past it: the tile is paired
+	//! with every RHS chunk while it is still cache-resident, so larger tiles mean fewer passes over the RHS
+	static constexpr const idx_t LHS_TILE_SIZE = STANDARD_VECTOR_SIZE * 8;
+
 	PhysicalCrossProduct(vector<LogicalType> types, unique_ptr<PhysicalOperator> left,
 	                     unique_ptr<PhysicalOperator> right, idx_t estimated_cardinality);
 
@@ -26,11 +30,17 @@ public:
 	bool ParallelOperator() const override {
 		return true;
 	}
+	bool RequiresFinalExecute() const override {
+		// the buffered LHS tile has to be flushed even when caching is not supported
+		return true;
+	}
 
 protected:
 	// CachingOperator Interface
 	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecuteInternal(ExecutionContext &context, DataChunk &chunk,
+	                                                GlobalOperatorState &gstate, OperatorState &state) const override;
 
 	bool IsOrderPreserving() const override {
 		return false;
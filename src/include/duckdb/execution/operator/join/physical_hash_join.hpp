@@ -17,6 +17,8 @@
 #include "duckdb/planner/operator/logical_join.hpp"
 
 namespace duckdb {
+class ConjunctionAndFilter;
+class PhysicalTableScan;
 
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
@@ -31,6 +33,8 @@ public:
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
+	//! Determine whether build-side min/max filters can be pushed into the probe-side table scan
+	void InitializeProbeFilterScan();
 
 	vector<idx_t> right_projection_map;
 	//! The types of the keys
@@ -43,6 +47,14 @@ public:
 	PerfectHashJoinStats perfect_join_statistics;
 	//! Whether we can go external (can't yet if recursive CTE)
 	bool can_go_external;
+	//! The probe-side table scan that min/max filters over the build keys are pushed into once the build completes,
+	//! or nullptr if sideways information passing does not apply to this join
+	PhysicalTableScan *probe_filter_scan = nullptr;
+	//! Per pushed filter: the join condition index and the scan column index it maps to
+	vector<pair<idx_t, idx_t>> probe_filter_columns;
+	//! Per pushed filter: the conjunction in the scan's filter set that is filled with the build-key min/max
+	//! after every build, so re-executions of the plan replace rather than accumulate filters
+	vector<ConjunctionAndFilter *> probe_filter_nodes;
 
 public:
 	// Operator Interface
@@ -19,6 +19,9 @@ public:
 	PhysicalPositionalJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> left,
 	                       unique_ptr<PhysicalOperator> right, idx_t estimated_cardinality);
 
+	//! Whether all RHS sources produce batch indexes, so the RHS can be sunk in parallel
+	bool rhs_has_batch_index;
+
 public:
 	// Operator Interface
 	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
@@ -36,13 +39,29 @@ public:
 public:
 	// Sink Interface
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
 	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          GlobalSinkState &gstate) const override;
 
 	bool IsSink() const override {
 		return true;
 	}
 
+	bool ParallelSink() const override {
+		return rhs_has_batch_index;
+	}
+
+	bool RequiresBatchIndex() const override {
+		return rhs_has_batch_index;
+	}
+
+	bool IsOrderDependent() const override {
+		return true;
+	}
+
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
 	vector<const PhysicalOperator *> GetSources() const override;
@@ -102,6 +102,11 @@ public:
 	// Apply a tail condition to the current selection
 	static idx_t SelectJoinTail(const ExpressionType &condition, Vector &left, Vector &right,
 	                            const SelectionVector *sel, idx_t count, SelectionVector *true_sel);
+	//! Finds the first entry in the sorted radix key array [lo, hi) whose comparison result against the given key
+	//! exceeds cmp, i.e. the exclusive upper bound of the matching prefix. Uses a galloping search (exponential
+	//! probes followed by a binary search), which is fast both for small steps and for skewed distributions.
+	static idx_t GallopingBound(data_ptr_t keys, const idx_t entry_size, const idx_t cmp_size, data_ptr_t key,
+	                            idx_t lo, idx_t hi, const int cmp);
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -24,6 +25,13 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The run-time threshold on the leading ORDER BY column that is pushed into the scan below (if any)
+	shared_ptr<DynamicFilterData> boundary_filter;
+
+public:
+	//! Push a dynamic filter on the leading ORDER BY column into a table scan child, so that zone maps can skip
+	//! segments that cannot contain rows that beat the current top-n threshold
+	void InitializeScanFilter();
 
 public:
 	// Source interface
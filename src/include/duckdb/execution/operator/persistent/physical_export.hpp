@@ -49,6 +49,11 @@ public:
 	bool IsSink() const override {
 		return true;
 	}
+	bool IsOrderPreserving() const override {
+		// the child COPY pipelines write independent files and their row counts are discarded by the nop sink,
+		// so they do not have to be scheduled one after the other
+		return false;
+	}
 
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
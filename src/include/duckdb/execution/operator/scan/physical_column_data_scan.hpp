@@ -17,11 +17,19 @@ namespace duckdb {
 class PhysicalColumnDataScan : public PhysicalOperator {
 public:
 	PhysicalColumnDataScan(vector<LogicalType> types, PhysicalOperatorType op_type, idx_t estimated_cardinality)
-	    : PhysicalOperator(op_type, std::move(types), estimated_cardinality), collection(nullptr) {
+	    : PhysicalOperator(op_type, std::move(types), estimated_cardinality), collection(nullptr),
+	      materialize_index(DConstants::INVALID_INDEX) {
+	}
+	PhysicalColumnDataScan(vector<LogicalType> types, PhysicalOperatorType op_type, idx_t estimated_cardinality,
+	                       idx_t materialize_index)
+	    : PhysicalOperator(op_type, std::move(types), estimated_cardinality), collection(nullptr),
+	      materialize_index(materialize_index) {
 	}
 
 	// the column data collection to scan
 	ColumnDataCollection *collection;
+	//! The index of the materialized subplan that is scanned (MATERIALIZE_SCAN only)
+	idx_t materialize_index;
 	//! Owned column data collection, if any
 	unique_ptr<ColumnDataCollection> owned_collection;
 
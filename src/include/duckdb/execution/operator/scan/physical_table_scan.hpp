@@ -41,6 +41,9 @@ public:
 	vector<string> names;
 	//! The table filters
 	unique_ptr<TableFilterSet> table_filters;
+	//! For struct columns that are only accessed through a subset of their fields: a mask per column id of which
+	//! fields are referenced
+	unordered_map<column_t, vector<bool>> projected_struct_fields;
 
 public:
 	string GetName() const override;
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/set/physical_materialize.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+//! PhysicalMaterialize executes a common subplan (its first child) once, materializing the result into a
+//! shared ColumnDataCollection that the MATERIALIZE_SCAN operators in the main plan (its second child) read.
+class PhysicalMaterialize : public PhysicalOperator {
+public:
+	PhysicalMaterialize(vector<LogicalType> types, idx_t materialize_index, unique_ptr<PhysicalOperator> definition,
+	                    unique_ptr<PhysicalOperator> main, idx_t estimated_cardinality);
+
+	//! The index under which the materialized result is registered
+	idx_t materialize_index;
+	//! The materialized result of the subplan
+	std::shared_ptr<ColumnDataCollection> collection;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const override;
+
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+
+	vector<const PhysicalOperator *> GetSources() const override;
+};
+
+} // namespace duckdb
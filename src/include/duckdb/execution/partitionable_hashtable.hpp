@@ -41,6 +41,9 @@ public:
 
 	void Finalize();
 
+	//! The approximate in-memory size of all underlying HTs in bytes
+	idx_t TotalSize() const;
+
 private:
 	ClientContext &context;
 	Allocator &allocator;
@@ -14,6 +14,11 @@ namespace duckdb {
 
 class PerfectAggregateHashTable : public BaseAggregateHashTable {
 public:
+	//! The number of groups per page (2^GROUPS_PER_PAGE_SHIFT): pages are allocated lazily on the first use of a
+	//! group in them, which keeps the memory usage of sparse perfect HTs proportional to the occupied slots
+	static constexpr idx_t GROUPS_PER_PAGE_SHIFT = 12;
+	static constexpr idx_t GROUPS_PER_PAGE = (idx_t)1 << GROUPS_PER_PAGE_SHIFT;
+
 	PerfectAggregateHashTable(ClientContext &context, Allocator &allocator, const vector<LogicalType> &group_types,
 	                          vector<LogicalType> payload_types_p, vector<AggregateObject> aggregate_objects,
 	                          vector<Value> group_minima, vector<idx_t> required_bits);
@@ -42,12 +47,10 @@ protected:
 	//! The number of grouping columns
 	idx_t grouping_columns;
 
-	// The actual pointer to the data
-	data_ptr_t data;
-	//! The owned data of the HT
-	unique_ptr<data_t[]> owned_data;
-	//! Information on whether or not a specific group has any entries
-	unique_ptr<bool[]> group_is_set;
+	//! The pages holding the aggregate states; a page is only allocated once a group in it is used
+	vector<unique_ptr<data_t[]>> pages;
+	//! Information on whether or not a specific group has any entries, stored per page
+	vector<unique_ptr<bool[]>> group_is_set;
 
 	//! The minimum values for each of the group columns
 	vector<Value> group_minima;
@@ -56,6 +59,10 @@ protected:
 	SelectionVector sel;
 
 private:
+	//! Allocates and zero-initializes the page with the given index, which must not exist yet
+	data_ptr_t AllocatePage(idx_t page_idx);
+	//! The number of groups covered by a page (the last page may cover less than GROUPS_PER_PAGE)
+	idx_t PageGroupCount(idx_t page_idx) const;
 	//! Destroy the perfect aggregate HT (called automatically by the destructor)
 	void Destroy();
 };
@@ -239,6 +239,8 @@ public:
 	bool initialized = false;
 	//! Whether or not the chunk can be cached
 	bool can_cache_chunk = false;
+	//! Whether or not FinalExecuteInternal has run to completion
+	bool final_execute_done = false;
 };
 
 //! Base class that caches output from child Operator class. Note that Operators inheriting from this class should also
@@ -256,11 +258,15 @@ public:
 	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
 	                                        OperatorState &state) const final;
 
-	bool RequiresFinalExecute() const final {
+	bool RequiresFinalExecute() const override {
 		return caching_supported;
 	}
 
 protected:
+	//! Child classes that buffer input can override FinalExecuteInternal to flush their remaining output; it is
+	//! called (until it returns FINISHED) before the cached chunk is flushed
+	virtual OperatorFinalizeResultType FinalExecuteInternal(ExecutionContext &context, DataChunk &chunk,
+	                                                        GlobalOperatorState &gstate, OperatorState &state) const;
 	//! Child classes need to implement the ExecuteInternal method instead of the Execute
 	virtual OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                           GlobalOperatorState &gstate, OperatorState &state) const = 0;
@@ -32,6 +32,8 @@ public:
 	//! Recursive CTEs require at least one ChunkScan, referencing the working_table.
 	//! This data structure is used to establish it.
 	unordered_map<idx_t, std::shared_ptr<ColumnDataCollection>> recursive_cte_tables;
+	//! The ColumnDataCollections of materialized common subplans
+	unordered_map<idx_t, std::shared_ptr<ColumnDataCollection>> materialized_subplans;
 
 public:
 	//! Creates a plan from the logical operator. This involves resolving column bindings and generating physical
@@ -87,6 +89,8 @@ protected:
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalUnnest &op);
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalRecursiveCTE &op);
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalCTERef &op);
+	unique_ptr<PhysicalOperator> CreatePlan(LogicalMaterialize &op);
+	unique_ptr<PhysicalOperator> CreatePlan(LogicalMaterializeScan &op);
 
 	unique_ptr<PhysicalOperator> CreateDistinctOn(unique_ptr<PhysicalOperator> child,
 	                                              vector<unique_ptr<Expression>> distinct_targets);
@@ -46,6 +46,11 @@ public:
 	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const;
 	bool Finalize(ClientContext &context, GlobalSinkState &gstate_p) const;
 
+	//! Computes this HT's result by rolling up the finalized result of another RadixPartitionedHashTable whose
+	//! grouping set is a superset of this grouping set, instead of aggregating the input
+	void Rollup(ClientContext &context, GlobalSinkState &state, const RadixPartitionedHashTable &other,
+	            GlobalSinkState &other_state) const;
+
 	void ScheduleTasks(Executor &executor, const shared_ptr<Event> &event, GlobalSinkState &state,
 	                   vector<unique_ptr<Task>> &tasks) const;
 
@@ -73,9 +73,6 @@ public:
 	unique_ptr<DataChunk> GetChunk() override;
 
 private:
-	//! Replace a single element of the input
-	void ReplaceElement(DataChunk &input, idx_t index_in_chunk);
-
 	//! Fills the reservoir up until sample_count entries, returns how many entries are still required
 	idx_t FillReservoir(DataChunk &input);
 
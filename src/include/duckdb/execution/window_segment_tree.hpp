@@ -12,6 +12,7 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
@@ -19,19 +20,61 @@ class WindowSegmentTree {
 public:
 	using FrameBounds = std::pair<idx_t, idx_t>;
 
+	//! Per-thread scratch space for aggregating over the tree,
+	//! so that multiple threads can share one (read-only) tree
+	class LocalState {
+	public:
+		explicit LocalState(WindowSegmentTree &tree);
+		~LocalState();
+
+	private:
+		friend class WindowSegmentTree;
+
+		//! The shared tree
+		WindowSegmentTree &tree;
+		//! Arena allocator from which this thread's aggregate states allocate their variable-size data
+		ArenaAllocator allocator;
+		//! Data pointer that contains a single state, used for intermediate window segment aggregation
+		vector<data_t> state;
+		//! Input data chunk, used for intermediate window segment aggregation
+		DataChunk inputs;
+		//! The filtered rows in inputs.
+		SelectionVector filter_sel;
+		//! A vector of pointers to "state", used for intermediate window segment aggregation
+		Vector statep;
+		//! The frame boundaries, used for the window functions
+		FrameBounds frame;
+		//! Reused result state container for the window functions
+		Vector statev;
+		//! The number of (filtered) rows currently aggregated into the running state (inverse path)
+		idx_t frame_rows;
+		//! Whether the running state has been initialized (inverse path)
+		bool state_initialized;
+	};
+
 	WindowSegmentTree(AggregateFunction &aggregate, FunctionData *bind_info, const LogicalType &result_type,
 	                  DataChunk *input, const ValidityMask &filter_mask, WindowAggregationMode mode);
 	~WindowSegmentTree();
 
-	//! First row contains the result.
-	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end);
+	//! Create the scratch space for a thread that computes aggregates over this tree
+	unique_ptr<LocalState> GetLocalState() {
+		return make_unique<LocalState>(*this);
+	}
+
+	//! First row contains the result. Only writes to the given local state, so threads may share the tree.
+	void Compute(LocalState &lstate, Vector &result, idx_t rid, idx_t start, idx_t end);
 
 private:
 	void ConstructTree();
-	void ExtractFrame(idx_t begin, idx_t end);
-	void WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end);
-	void AggregateInit();
-	void AggegateFinal(Vector &result, idx_t rid);
+	void ExtractFrame(LocalState &lstate, idx_t begin, idx_t end);
+	void WindowSegmentValue(LocalState &lstate, idx_t l_idx, idx_t begin, idx_t end);
+	void AggregateInit(LocalState &lstate);
+	void AggegateFinal(LocalState &lstate, Vector &result, idx_t rid);
+
+	//! Compute a frame by updating the running state with the rows that entered and left the frame
+	void ComputeInverse(LocalState &lstate, Vector &result, idx_t rid, idx_t begin, idx_t end);
+	//! Add (or, using the inverse, remove) the given range of input rows to the running state
+	void WindowDeltaValue(LocalState &lstate, idx_t begin, idx_t end, bool remove);
 
 	//! Use the window API, if available
 	inline bool UseWindowAPI() const {
@@ -41,6 +84,11 @@ private:
 	inline bool UseCombineAPI() const {
 		return mode < WindowAggregationMode::SEPARATE;
 	}
+	//! Use the inverse API, if available: sliding frames then maintain a running state instead of querying
+	//! the segment tree. Aggregates with destructors are excluded, as the state must survive finalization.
+	inline bool UseInverseAPI() const {
+		return aggregate.inverse && !aggregate.destructor && UseCombineAPI();
+	}
 
 	//! The aggregate that the window function is computed over
 	AggregateFunction aggregate;
@@ -49,19 +97,8 @@ private:
 	//! The result type of the window function
 	LogicalType result_type;
 
-	//! Data pointer that contains a single state, used for intermediate window segment aggregation
-	vector<data_t> state;
-	//! Input data chunk, used for intermediate window segment aggregation
-	DataChunk inputs;
-	//! The filtered rows in inputs.
-	SelectionVector filter_sel;
-	//! A vector of pointers to "state", used for intermediate window segment aggregation
-	Vector statep;
-	//! The frame boundaries, used for the window functions
-	FrameBounds frame;
-	//! Reused result state container for the window functions
-	Vector statev;
-
+	//! Arena allocator holding the variable-size data of the internal node states
+	ArenaAllocator allocator;
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
 	unique_ptr<data_t[]> levels_flat_native;
 	//! For each level, the starting location in the levels_flat_native array
@@ -130,6 +130,33 @@ struct HugeintAdd {
 	}
 };
 
+// The subtraction counterparts of RegularAdd and HugeintAdd, used as the window inverse of SUM and AVG.
+// They are only ever applied to values that were previously added to the state, so the running sum cannot
+// move outside of the range it covered while the values were part of the frame.
+struct RegularSubtract {
+	template <class STATE, class T>
+	static void AddNumber(STATE &state, T input) {
+		state.value -= input;
+	}
+
+	template <class STATE, class T>
+	static void AddConstant(STATE &state, T input, idx_t count) {
+		state.value -= input * count;
+	}
+};
+
+struct HugeintSubtract {
+	template <class STATE, class T>
+	static void AddNumber(STATE &state, T input) {
+		state.value -= hugeint_t(int64_t(input));
+	}
+
+	template <class STATE, class T>
+	static void AddConstant(STATE &state, T input, idx_t count) {
+		state.value -= hugeint_t(int64_t(input)) * int64_t(count);
+	}
+};
+
 template <class STATEOP, class ADDOP>
 struct BaseSumOperation {
 	template <class STATE>
@@ -14,6 +14,7 @@
 #include "duckdb/planner/bound_result_modifier.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/common/vector_operations/aggregate_executor.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
@@ -23,10 +24,13 @@ enum class AggregateType : uint8_t { NON_DISTINCT = 1, DISTINCT = 2 };
 class BoundAggregateExpression;
 
 struct AggregateInputData {
-	AggregateInputData(FunctionData *bind_data_p, Allocator &allocator_p)
+	AggregateInputData(FunctionData *bind_data_p, ArenaAllocator &allocator_p)
 	    : bind_data(bind_data_p), allocator(allocator_p) {};
 	FunctionData *bind_data;
-	Allocator &allocator;
+	//! Arena allocator from which the aggregate can allocate state data that grows beyond the fixed state size. The
+	//! arena is owned by the operator that owns the states, and is torn down as a whole together with them - states
+	//! that allocate exclusively from the arena do not need a destructor
+	ArenaAllocator &allocator;
 };
 
 //! The type used for sizing hashed aggregate function states
@@ -50,7 +54,7 @@ typedef unique_ptr<BaseStatistics> (*aggregate_statistics_t)(ClientContext &cont
 typedef unique_ptr<FunctionData> (*bind_aggregate_function_t)(ClientContext &context, AggregateFunction &function,
                                                               vector<unique_ptr<Expression>> &arguments);
 //! The type used for the aggregate destructor method. NOTE: this method is used in destructors and MAY NOT throw.
-typedef void (*aggregate_destructor_t)(Vector &state, idx_t count);
+typedef void (*aggregate_destructor_t)(Vector &state, AggregateInputData &aggr_input_data, idx_t count);
 
 //! The type used for updating simple (non-grouped) aggregate functions
 typedef void (*aggregate_simple_update_t)(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
@@ -82,8 +86,8 @@ public:
 	    : BaseScalarFunction(name, arguments, return_type, FunctionSideEffects::NO_SIDE_EFFECTS,
 	                         LogicalType(LogicalTypeId::INVALID), null_handling),
 	      state_size(state_size), initialize(initialize), update(update), combine(combine), finalize(finalize),
-	      simple_update(simple_update), window(window), bind(bind), destructor(destructor), statistics(statistics),
-	      serialize(serialize), deserialize(deserialize) {
+	      simple_update(simple_update), window(window), inverse(nullptr), bind(bind), destructor(destructor),
+	      statistics(statistics), serialize(serialize), deserialize(deserialize) {
 	}
 
 	DUCKDB_API
@@ -97,8 +101,8 @@ public:
 	    : BaseScalarFunction(name, arguments, return_type, FunctionSideEffects::NO_SIDE_EFFECTS,
 	                         LogicalType(LogicalTypeId::INVALID)),
 	      state_size(state_size), initialize(initialize), update(update), combine(combine), finalize(finalize),
-	      simple_update(simple_update), window(window), bind(bind), destructor(destructor), statistics(statistics),
-	      serialize(serialize), deserialize(deserialize) {
+	      simple_update(simple_update), window(window), inverse(nullptr), bind(bind), destructor(destructor),
+	      statistics(statistics), serialize(serialize), deserialize(deserialize) {
 	}
 
 	DUCKDB_API AggregateFunction(const vector<LogicalType> &arguments, const LogicalType &return_type,
@@ -140,6 +144,9 @@ public:
 	aggregate_simple_update_t simple_update;
 	//! The windowed aggregate frame update function (may be null)
 	aggregate_window_t window;
+	//! The inverse update function: removes previously aggregated inputs from the state again, allowing sliding
+	//! window frames to maintain a running state instead of recomputing every frame (may be null)
+	aggregate_update_t inverse;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
@@ -273,7 +280,7 @@ public:
 	}
 
 	template <class STATE, class OP>
-	static void StateDestroy(Vector &states, idx_t count) {
+	static void StateDestroy(Vector &states, AggregateInputData &aggr_input_data, idx_t count) {
 		AggregateExecutor::Destroy<STATE, OP>(states, count);
 	}
 };
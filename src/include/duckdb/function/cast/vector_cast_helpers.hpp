@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "duckdb/common/types/cast_helpers.hpp"
+#include "duckdb/common/operator/string_cast.hpp"
 #include "duckdb/function/cast/default_casts.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/vector_operations/general_cast.hpp"
@@ -165,6 +167,75 @@ struct VectorCastHelpers {
 		return true;
 	}
 
+	//! Cast integers to VARCHAR in two passes: the first pass computes the digit count of every value, so
+	//! that the heap space for all non-inlined strings of the vector can be reserved with a single
+	//! allocation instead of one string heap allocation per value
+	template <class SRC>
+	static bool BatchedIntegerStringCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+		using UNSIGNED = typename std::make_unsigned<SRC>::type;
+		D_ASSERT(result.GetType().InternalType() == PhysicalType::VARCHAR);
+		if (count > STANDARD_VECTOR_SIZE || source.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			// a constant vector holds a single value: the scalar cast already performs a single allocation
+			return StringCast<SRC, duckdb::StringCast>(source, result, count, parameters);
+		}
+		UnifiedVectorFormat vdata;
+		source.ToUnifiedFormat(count, vdata);
+		auto source_data = (SRC *)vdata.data;
+
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		auto result_data = FlatVector::GetData<string_t>(result);
+		auto &result_mask = FlatVector::Validity(result);
+
+		// first pass: compute the length of every string and the combined size of the non-inlined ones
+		uint8_t lengths[STANDARD_VECTOR_SIZE];
+		idx_t heap_size = 0;
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			if (!vdata.validity.RowIsValid(idx)) {
+				result_mask.SetInvalid(i);
+				lengths[i] = 0;
+				continue;
+			}
+			auto length = NumericHelper::SignedLength<SRC, UNSIGNED>(source_data[idx]);
+			lengths[i] = uint8_t(length);
+			if (idx_t(length) >= string_t::INLINE_LENGTH) {
+				heap_size += length;
+			}
+		}
+		char *heap_ptr = nullptr;
+		if (heap_size > 0) {
+			// reserve the heap space for the entire vector at once and hand out slices of it below
+			heap_ptr = StringVector::EmptyString(result, heap_size).GetDataWriteable();
+		}
+		// second pass: write out the digits with the two-digit lookup table of FormatUnsigned
+		for (idx_t i = 0; i < count; i++) {
+			if (!result_mask.RowIsValid(i)) {
+				continue;
+			}
+			auto value = source_data[vdata.sel->get_index(i)];
+			int sign = -(value < 0);
+			UNSIGNED unsigned_value = UNSIGNED(value ^ sign) - sign;
+			idx_t length = lengths[i];
+			if (length < string_t::INLINE_LENGTH) {
+				string_t str(length);
+				auto endptr = NumericHelper::FormatUnsigned(unsigned_value, str.GetDataWriteable() + length);
+				if (sign) {
+					*--endptr = '-';
+				}
+				str.Finalize();
+				result_data[i] = str;
+			} else {
+				auto endptr = NumericHelper::FormatUnsigned(unsigned_value, heap_ptr + length);
+				if (sign) {
+					*--endptr = '-';
+				}
+				result_data[i] = string_t(heap_ptr, length);
+				heap_ptr += length;
+			}
+		}
+		return true;
+	}
+
 	template <class SRC, class T, class OP>
 	static bool TemplatedDecimalCast(Vector &source, Vector &result, idx_t count, string *error_message, uint8_t width,
 	                                 uint8_t scale) {
@@ -12,6 +12,7 @@
 #include "duckdb/function/function_set.hpp"
 
 namespace duckdb {
+class ConstantFilter;
 
 struct ConstantFun {
 	static CompressionFunction GetFunction(PhysicalType type);
@@ -28,6 +29,12 @@ struct RLEFun {
 	static bool TypeIsSupported(PhysicalType type);
 };
 
+//! RLE compression of validity masks, stored as alternating runs of valid and invalid rows
+struct ValidityRLEFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(PhysicalType type);
+};
+
 struct BitpackingFun {
 	static CompressionFunction GetFunction(PhysicalType type);
 	static bool TypeIsSupported(PhysicalType type);
@@ -36,6 +43,12 @@ struct BitpackingFun {
 struct DictionaryCompressionFun {
 	static CompressionFunction GetFunction(PhysicalType type);
 	static bool TypeIsSupported(PhysicalType type);
+	//! Whether the dictionary of a scanned segment is sorted, i.e. whether its codes are order-preserving
+	static bool HasSortedDictionary(SegmentScanState &scan_state);
+	//! Evaluate a constant comparison on a dictionary vector scanned from a segment with a sorted
+	//! dictionary: the dictionary is binary searched once and the rows are then filtered on their codes
+	static void FilterSelection(SegmentScanState &scan_state, Vector &result, const ConstantFilter &filter,
+	                            SelectionVector &sel, idx_t &approved_tuple_count);
 };
 
 struct ChimpCompressionFun {
@@ -48,6 +61,11 @@ struct PatasCompressionFun {
 	static bool TypeIsSupported(PhysicalType type);
 };
 
+struct AlpCompressionFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(PhysicalType type);
+};
+
 struct FSSTFun {
 	static CompressionFunction GetFunction(PhysicalType type);
 	static bool TypeIsSupported(PhysicalType type);
@@ -38,6 +38,8 @@ struct PragmaInfo;
 //! The default null handling is NULL in, NULL out
 enum class FunctionNullHandling : uint8_t { DEFAULT_NULL_HANDLING = 0, SPECIAL_HANDLING = 1 };
 enum class FunctionSideEffects : uint8_t { NO_SIDE_EFFECTS = 0, HAS_SIDE_EFFECTS = 1 };
+//! Whether the function can throw a runtime error for any (valid) input
+enum class FunctionErrors : uint8_t { CAN_THROW_RUNTIME_ERROR = 0, CANNOT_ERROR = 1 };
 
 struct FunctionData {
 	DUCKDB_API virtual ~FunctionData();
@@ -47,6 +47,25 @@ struct VariableReturnBindData : public FunctionData {
 	}
 };
 
+struct StructExtractBindData : public FunctionData {
+	StructExtractBindData(string key, idx_t index, LogicalType type)
+	    : key(std::move(key)), index(index), type(std::move(type)) {
+	}
+
+	string key;
+	idx_t index;
+	LogicalType type;
+
+public:
+	unique_ptr<FunctionData> Copy() const override {
+		return make_unique<StructExtractBindData>(key, index, type);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = (const StructExtractBindData &)other_p;
+		return key == other.key && index == other.index && type == other.type;
+	}
+};
+
 template <class T, class MAP_TYPE = map<T, idx_t>>
 struct HistogramAggState {
 	MAP_TYPE *hist;
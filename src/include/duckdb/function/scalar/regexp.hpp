@@ -34,6 +34,9 @@ struct RegexpMatchesBindData : public RegexpBaseBindData {
 	string range_min;
 	string range_max;
 	bool range_success;
+	//! A literal that must occur in the input for the pattern to match (lowercased ASCII), or an empty string if
+	//! no such literal could be extracted from the pattern
+	string required_literal;
 
 	unique_ptr<FunctionData> Copy() const override;
 };
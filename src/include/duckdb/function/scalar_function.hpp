@@ -86,6 +86,9 @@ public:
 
 	function_serialize_t serialize;
 	function_deserialize_t deserialize;
+	//! Whether the function can throw a runtime error: functions that cannot error can be executed
+	//! over the unique values of a dictionary vector directly (see ExpressionExecutor)
+	FunctionErrors errors = FunctionErrors::CAN_THROW_RUNTIME_ERROR;
 
 	DUCKDB_API bool operator==(const ScalarFunction &rhs) const;
 	DUCKDB_API bool operator!=(const ScalarFunction &rhs) const;
@@ -84,6 +84,8 @@ struct ArrowScanLocalState : public LocalTableFunctionState {
 	unique_ptr<ArrowArrayStreamWrapper> stream;
 	shared_ptr<ArrowArrayWrapper> chunk;
 	idx_t chunk_offset = 0;
+	//! The end of the range of the current chunk assigned to this thread (exclusive)
+	idx_t range_end = 0;
 	idx_t batch_index = 0;
 	vector<column_t> column_ids;
 	//! Store child vectors for Arrow Dictionary Vectors (col-idx,vector)
@@ -94,10 +96,17 @@ struct ArrowScanLocalState : public LocalTableFunctionState {
 };
 
 struct ArrowScanGlobalState : public GlobalTableFunctionState {
+	//! The number of rows handed out to a thread at a time when sharing a chunk between threads
+	static constexpr const idx_t ARROW_SCAN_RANGE_SIZE = 122880;
+
 	unique_ptr<ArrowArrayStreamWrapper> stream;
 	mutex main_mutex;
 	idx_t max_threads = 1;
 	idx_t batch_index = 0;
+	//! The chunk that is currently being handed out in ranges, shared between the scanning threads
+	shared_ptr<ArrowArrayWrapper> current_chunk;
+	//! The offset of the first row of the current chunk that has not been handed out yet
+	idx_t chunk_offset = 0;
 	bool done = false;
 
 	vector<idx_t> projection_ids;
@@ -68,6 +68,9 @@ struct TableFunctionInitInput {
 	const vector<column_t> &column_ids;
 	const vector<idx_t> projection_ids;
 	TableFilterSet *filters;
+	//! For struct columns that are only accessed through a subset of their fields: a mask per column id of which
+	//! fields are referenced. Scans that support it may emit NULL for fields that are not referenced.
+	unordered_map<column_t, vector<bool>> projected_struct_fields;
 
 	bool CanRemoveFilterColumns() const {
 		if (projection_ids.empty()) {
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/type_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/main/table_description.hpp"
@@ -42,6 +43,12 @@ protected:
 	idx_t column = 0;
 	//! The type of the appender
 	AppenderType appender_type;
+	//! Chunk used by the columnar batch append functions (if a batch is active)
+	DataChunk batch_chunk;
+	//! The row count of the active columnar batch (0 if no batch is active)
+	idx_t batch_count = 0;
+	//! Which columns of the active columnar batch have been filled
+	vector<bool> batch_columns_filled;
 
 protected:
 	DUCKDB_API BaseAppender(Allocator &allocator, AppenderType type);
@@ -84,12 +91,41 @@ public:
 		return column;
 	}
 	DUCKDB_API void AppendDataChunk(DataChunk &value);
+	//! Appends a DataChunk to the appender without copying it. The buffers of the chunk are shared with the
+	//! appender: the chunk can hold at most STANDARD_VECTOR_SIZE rows and must not be modified afterwards.
+	DUCKDB_API void AppendDataChunkReference(DataChunk &value);
+
+	//! Begins a columnar batch append of exactly `count` rows. Rows buffered by the row-wise Append functions are
+	//! flushed first, and the row-wise functions cannot be used until the batch is finished. Every column must be
+	//! filled once using AppendColumnData, after which EndColumnBatch commits the batch.
+	DUCKDB_API void BeginColumnBatch(idx_t count);
+	//! Appends the data for a single column of the active columnar batch. The type T must match the physical
+	//! storage type of the column exactly: no casts are performed. If `validity` is given, row i of the batch is
+	//! set to NULL when validity[i] is false. Non-inlined string data must remain valid until EndColumnBatch.
+	template <class T>
+	void AppendColumnData(idx_t column_index, const T *data, const bool *validity = nullptr) {
+		auto &col = BatchColumn(column_index, GetTypeId<T>());
+		memcpy(FlatVector::GetData<T>(col), data, batch_count * sizeof(T));
+		if (validity) {
+			auto &mask = FlatVector::Validity(col);
+			mask.Initialize(batch_count);
+			for (idx_t i = 0; i < batch_count; i++) {
+				if (!validity[i]) {
+					mask.SetInvalidUnsafe(i);
+				}
+			}
+		}
+	}
+	//! Finishes the active columnar batch and appends it to the buffered data
+	DUCKDB_API void EndColumnBatch();
 
 protected:
 	void Destructor();
 	virtual void FlushInternal(ColumnDataCollection &collection) = 0;
 	void InitializeChunk();
 	void FlushChunk();
+	//! Returns the batch column for AppendColumnData to write to, verifying the physical type of the column
+	DUCKDB_API Vector &BatchColumn(idx_t column_index, PhysicalType type);
 
 	template <class T>
 	void AppendValueInternal(T value);
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class ClientContext;
+class TableFilterSet;
+class TableFunction;
+struct FunctionData;
+
+//! The CardinalityFeedback store holds the actual cardinalities of plan fragments as observed by the profiler
+//! during query execution. Subsequent plans containing the same fragment use the observed cardinality instead of
+//! an estimate, so that repeatedly executed queries converge to good join orders.
+class CardinalityFeedback {
+public:
+	//! Record the observed cardinality of a plan fragment, replacing any previously recorded cardinality
+	DUCKDB_API void RecordCardinality(const string &fragment_key, idx_t cardinality);
+	//! Look up the observed cardinality of a plan fragment; returns true if feedback is available
+	DUCKDB_API bool TryGetCardinality(const string &fragment_key, idx_t &cardinality);
+
+	//! Construct the fragment key of a table scan. The filters of a physical table scan reference indices into the
+	//! column id list rather than column ids - pass "column_ids" to translate them so that logical and physical
+	//! scans of the same fragment produce the same key.
+	DUCKDB_API static string ScanKey(const TableFunction &function, const FunctionData *bind_data,
+	                                 const TableFilterSet *filters, const vector<column_t> *column_ids = nullptr);
+	//! Fetch the cardinality feedback store of the database
+	DUCKDB_API static CardinalityFeedback &Get(ClientContext &context);
+
+private:
+	//! The maximum amount of fragments for which feedback is retained
+	static constexpr const idx_t MAXIMUM_FRAGMENTS = 4096;
+
+	//! The lock protecting the feedback store
+	mutex lock;
+	//! A mapping of fragment key -> the cardinality observed the last time the fragment was executed
+	unordered_map<string, idx_t> observed_cardinalities;
+};
+
+} // namespace duckdb
@@ -14,6 +14,7 @@
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
+#include "duckdb/parallel/task.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -30,6 +31,14 @@ struct ClientConfig {
 	bool enable_profiler = false;
 	//! If detailed query profiling is enabled
 	bool enable_detailed_profiling = false;
+	//! If individual operator invocations are recorded as trace events while profiling
+	bool enable_operator_trace = false;
+	//! If hardware performance counters are sampled per operator while profiling (Linux only)
+	bool enable_perf_counters = false;
+	//! The priority at which the tasks of queries issued through this connection are scheduled
+	TaskPriority scheduler_priority = TaskPriority::NORMAL;
+	//! Whether or not batched appends bypass the transaction-local staging area and append straight into the table
+	bool bulk_append = false;
 	//! The format to print query profiling information in (default: query_tree), if enabled.
 	ProfilerPrintFormat profiler_print_format = ProfilerPrintFormat::QUERY_TREE;
 	//! The file to save query profiling information to, instead of printing it to the console
@@ -61,6 +70,8 @@ struct ClientConfig {
 	bool verify_serializer = false;
 	//! Enable the running of optimizers
 	bool enable_optimizer = true;
+	//! Whether or not plans of repeated identical (unparameterized) SQL statements are cached and reused
+	bool enable_plan_cache = true;
 	//! Force parallelism of small tables, used for testing
 	bool verify_parallelism = false;
 	//! Force index join independent of table cardinality, used for testing
@@ -73,8 +84,14 @@ struct ClientConfig {
 	//! True by default
 	bool use_replacement_scans = true;
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
-	//! elements)
-	idx_t perfect_ht_threshold = 12;
+	//! elements); the perfect HT only allocates pages of the domain that are actually occupied
+	idx_t perfect_ht_threshold = 20;
+	//! The amount of chunks a streaming query result prefetches in the background ahead of the client
+	//! (0 = no background prefetching)
+	idx_t streaming_prefetch_depth = 0;
+	//! The maximum amount of memory a single query issued through this connection should use before
+	//! memory-intensive operators start spilling to disk (0 = only the global memory limit applies)
+	idx_t query_memory_limit = 0;
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
@@ -238,6 +238,9 @@ private:
 	PreservedError EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction);
 
 	PendingExecutionResult ExecuteTaskInternal(ClientContextLock &lock, PendingQueryResult &result);
+	//! Returns the progress of the active query as a percentage in the range [0, 100], or -1 if the progress
+	//! cannot be estimated
+	double GetQueryProgress(ClientContextLock &lock);
 
 	unique_ptr<PendingQueryResult> PendingStatementOrPreparedStatementInternal(
 	    ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
@@ -21,6 +21,7 @@ class ClientContext;
 class CatalogSearchPath;
 class FileOpener;
 class HTTPStats;
+class PlanCache;
 class QueryProfiler;
 class QueryProfilerHistory;
 class PreparedStatementData;
@@ -40,6 +41,8 @@ struct ClientData {
 	shared_ptr<AttachedDatabase> temporary_objects;
 	//! The set of bound prepared statements that belong to this client
 	unordered_map<string, shared_ptr<PreparedStatementData>> prepared_statements;
+	//! A cache of plans for repeated identical (unparameterized) SQL statements
+	unique_ptr<PlanCache> plan_cache;
 
 	//! The writer used to log queries (if logging is enabled)
 	unique_ptr<BufferedFileWriter> log_query_writer;
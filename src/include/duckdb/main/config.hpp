@@ -18,6 +18,7 @@
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/set.hpp"
+#include "duckdb/storage/storage_info.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/winapi.hpp"
@@ -88,6 +89,11 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The maximum delay (in microseconds) before syncing a commit to the WAL, used to batch the fsync of
+	//! concurrently committing transactions (default: no delay)
+	idx_t wal_group_commit_delay = 0;
+	//! Whether data entries (inserts/deletes/updates) written to the WAL are compressed
+	bool wal_compression = false;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -102,6 +108,8 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress buffers that are evicted to temporary files, trading CPU time for less temp file I/O
+	bool temp_file_compression = false;
 	//! The collation type of the database
 	string collation = string();
 	//! The order type used when none is specified (default: ASC)
@@ -133,12 +141,24 @@ struct DBConfigOptions {
 	WindowAggregationMode window_mode = WindowAggregationMode::WINDOW;
 	//! Whether or not preserving insertion order should be preserved
 	bool preserve_insertion_order = true;
+	//! The target row group size of newly created tables, in rows. Must be a multiple of the vector size and at most
+	//! the compiled maximum row group size; smaller row groups improve pruning on wide tables at the cost of more
+	//! per-group overhead
+	idx_t row_group_size = STANDARD_ROW_GROUPS_SIZE;
+	//! Directory remote files are cached in; when empty (the default) remote files are not cached
+	string remote_file_cache_directory;
+	//! The maximum total size of the remote file cache directory
+	idx_t remote_file_cache_size = 17179869184ULL; // 16GB
 	//! Database configuration variables as controlled by SET
 	case_insensitive_map_t<Value> set_variables;
 	//! Database configuration variable default values;
 	case_insensitive_map_t<Value> set_variable_defaults;
 	//! Whether unsigned extensions should be loaded
 	bool allow_unsigned_extensions = false;
+	//! Cache materialized results of repeated read-only queries, invalidated by writes to referenced tables
+	bool enable_result_cache = false;
+	//! Cache the decoded dictionary of dictionary compressed segments, sharing it across scans
+	bool enable_dictionary_cache = false;
 	//! Enable emitting FSST Vectors
 	bool enable_fsst_vectors = false;
 	//! Experimental parallel CSV reader
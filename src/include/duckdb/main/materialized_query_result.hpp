@@ -31,6 +31,10 @@ public:
 	//! This will consume the result (i.e. the result can only be scanned once with this function)
 	DUCKDB_API unique_ptr<DataChunk> Fetch() override;
 	DUCKDB_API unique_ptr<DataChunk> FetchRaw() override;
+	//! Fetches a DataChunk that references the data of the underlying collection directly where possible, instead of
+	//! copying it. The data of the returned chunk is only valid until the next fetch call, or until the result itself
+	//! is destroyed.
+	DUCKDB_API unique_ptr<DataChunk> FetchZeroCopy();
 	//! Converts the QueryResult to a string
 	DUCKDB_API string ToString() override;
 	DUCKDB_API string ToBox(ClientContext &context, const BoxRendererConfig &config) override;
@@ -38,6 +38,15 @@ public:
 	//! This returns (mostly) instantly if ExecuteTask has been called until RESULT_READY was returned.
 	DUCKDB_API unique_ptr<QueryResult> Execute();
 
+	//! Returns the current progress of the query as a percentage in the range [0, 100], or -1 if the progress
+	//! cannot be estimated
+	DUCKDB_API double GetProgress();
+
+	//! Registers a callback that is invoked (from a scheduler thread) once execution has completed, failed or
+	//! been cancelled, instead of polling ExecuteTask; afterwards Execute returns the result without blocking.
+	//! The callback must not call back into this pending query result.
+	DUCKDB_API void SetCompletionCallback(std::function<void()> callback);
+
 	DUCKDB_API void Close();
 
 private:
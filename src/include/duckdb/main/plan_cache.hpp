@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class PreparedStatementData;
+
+//! An LRU cache of fully prepared plans for repeated identical SQL text, so that hot queries can skip parsing,
+//! binding and optimizing. Entries whose catalog version is out of date are dropped by the lookup path.
+class PlanCache {
+public:
+	//! The default maximum number of cached plans per client context
+	static constexpr const idx_t DEFAULT_CAPACITY = 256;
+
+	explicit PlanCache(idx_t capacity = DEFAULT_CAPACITY);
+	~PlanCache();
+
+	//! Find a cached plan for the given SQL text, and mark it as most recently used
+	shared_ptr<PreparedStatementData> Get(const string &sql);
+	//! Cache a plan for the given SQL text, evicting the least recently used plan when the cache is full
+	void Put(const string &sql, shared_ptr<PreparedStatementData> plan);
+	//! Remove the plan cached for the given SQL text (if any)
+	void Remove(const string &sql);
+	//! Remove all cached plans
+	void Clear();
+
+private:
+	using cache_entry_t = pair<string, shared_ptr<PreparedStatementData>>;
+
+	//! The maximum number of cached plans
+	idx_t capacity;
+	//! The cached plans, in least to most recently used order
+	list<cache_entry_t> entries;
+	//! Maps SQL text to the corresponding entry in the list
+	unordered_map<string, list<cache_entry_t>::iterator> entry_map;
+};
+
+} // namespace duckdb
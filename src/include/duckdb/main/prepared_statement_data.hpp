@@ -20,6 +20,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -45,6 +46,15 @@ public:
 	//! The catalog version of when the prepared statement was bound
 	//! If this version is lower than the current catalog version, we have to rebind the prepared statement
 	idx_t catalog_version;
+	//! The parameter values of the last execution of the cached plan
+	//! Used to detect parameter sets that change the shape of the query and require a re-optimization
+	vector<Value> last_bound_values;
+	//! Whether the result of this statement may be stored in the query result cache
+	bool result_cacheable = false;
+	//! The exact SQL text of the statement, used as the key of the query result cache
+	string cache_query;
+	//! The base tables that the plan reads (only filled in when the result is cacheable)
+	vector<shared_ptr<DataTableInfo>> cache_tables;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
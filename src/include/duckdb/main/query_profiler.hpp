@@ -10,6 +10,8 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/perf_counters.hpp"
+#include "duckdb/common/thread_io_counters.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -89,16 +91,47 @@ struct OperatorInformation {
 	double time = 0;
 	idx_t elements = 0;
 	string name;
+	//! The number of operator invocations in which the hardware counters were sampled
+	uint64_t perf_samples = 0;
+	//! The number of retired instructions over the sampled invocations
+	uint64_t instructions = 0;
+	//! The number of last-level cache misses over the sampled invocations
+	uint64_t llc_misses = 0;
+	//! The number of stalled (backend) cycles over the sampled invocations
+	uint64_t stalled_cycles = 0;
+	//! The net number of bytes allocated while the operator was active (negative if the operator frees memory that
+	//! was allocated elsewhere, e.g. a sink being scanned)
+	int64_t memory_usage = 0;
+	//! The highest value memory_usage reached over the invocations of the operator
+	int64_t memory_peak = 0;
+	//! The I/O activity (buffer pool reads, spilling, segment decompression) while the operator was active
+	ThreadIOCounters io;
 	//! A vector of Expression Executor Info
 	vector<unique_ptr<ExpressionExecutorInfo>> executors_info;
 };
 
+//! A single recorded operator invocation, used when operator tracing is enabled (see enable_operator_trace)
+struct OperatorTraceEvent {
+	OperatorTraceEvent(const PhysicalOperator *op, time_point<system_clock> start, double time, idx_t elements)
+	    : op(op), start(start), time(time), elements(elements) {
+	}
+
+	//! The operator that was executed
+	const PhysicalOperator *op;
+	//! The time at which the invocation started
+	time_point<system_clock> start;
+	//! The duration of the invocation (in seconds)
+	double time;
+	//! The number of tuples produced by the invocation
+	idx_t elements;
+};
+
 //! The OperatorProfiler measures timings of individual operators
 class OperatorProfiler {
 	friend class QueryProfiler;
 
 public:
-	DUCKDB_API explicit OperatorProfiler(bool enabled);
+	DUCKDB_API explicit OperatorProfiler(ClientContext &context);
 
 	DUCKDB_API void StartOperator(const PhysicalOperator *phys_op);
 	DUCKDB_API void EndOperator(DataChunk *chunk);
@@ -109,7 +142,12 @@ public:
 	}
 
 private:
-	void AddTiming(const PhysicalOperator *op, double time, idx_t elements);
+	//! Sample the hardware counters once every SAMPLING_RATE operator invocations
+	static constexpr int PERF_SAMPLING_RATE = 50;
+	//! The maximum number of trace events that are buffered per thread - events beyond this are dropped
+	static constexpr idx_t TRACE_BUFFER_CAPACITY = 1ULL << 16;
+
+	void AddTiming(const PhysicalOperator *op, double time, idx_t elements, int64_t memory_delta);
 
 	//! Whether or not the profiler is enabled
 	bool enabled;
@@ -117,8 +155,26 @@ private:
 	Profiler op;
 	//! The stack of Physical Operators that are currently active
 	const PhysicalOperator *active_operator;
+	//! The value of Allocator::ThreadAllocatedBytes when the active operator was started
+	int64_t memory_start = 0;
+	//! The value of the thread-local I/O counters when the active operator was started
+	ThreadIOCounters io_start;
 	//! A mapping of physical operators to recorded timings
 	unordered_map<const PhysicalOperator *, OperatorInformation> timings;
+	//! The hardware counters, sampled every PERF_SAMPLING_RATE invocations (when enabled and available)
+	PerfEventCounters perf_counters;
+	//! The number of invocations since the last hardware counter sample
+	int invocations_since_sample = 0;
+	//! Whether or not the hardware counters are running for the active operator
+	bool sampling_counters = false;
+	//! Whether or not individual invocations are recorded as trace events
+	bool trace_enabled;
+	//! The start time of the active operator invocation (only tracked when tracing is enabled)
+	time_point<system_clock> trace_start;
+	//! The trace events recorded by this thread
+	vector<OperatorTraceEvent> trace_events;
+	//! The number of trace events that were dropped because the trace buffer was full
+	idx_t dropped_trace_events = 0;
 };
 
 //! The QueryProfiler can be used to measure timings of queries
@@ -131,6 +187,8 @@ public:
 		PhysicalOperatorType type;
 		string name;
 		string extra_info;
+		//! The cardinality feedback key of the operator (empty if the operator does not produce feedback)
+		string feedback_key;
 		OperatorInformation info;
 		vector<unique_ptr<TreeNode>> children;
 		idx_t depth = 0;
@@ -144,6 +202,8 @@ public:
 private:
 	unique_ptr<TreeNode> CreateTree(PhysicalOperator *root, idx_t depth = 0);
 	void Render(const TreeNode &node, std::ostream &str) const;
+	//! Record the observed cardinalities of the operators in the tree into the cardinality feedback store
+	void RecordCardinalityFeedback(TreeNode &node);
 
 public:
 	DUCKDB_API bool IsEnabled() const;
@@ -155,7 +215,7 @@ public:
 	DUCKDB_API static QueryProfiler &Get(ClientContext &context);
 
 	DUCKDB_API void StartQuery(string query, bool is_explain_analyze = false, bool start_at_optimizer = false);
-	DUCKDB_API void EndQuery();
+	DUCKDB_API void EndQuery(bool success = true);
 
 	DUCKDB_API void StartExplainAnalyze();
 
@@ -176,6 +236,8 @@ public:
 	DUCKDB_API string ToString() const;
 
 	DUCKDB_API string ToJSON() const;
+	//! Renders the recorded operator trace events in the Chrome trace event format
+	DUCKDB_API string TraceToChromeJSON() const;
 	DUCKDB_API void WriteToFile(const char *path, string &info) const;
 
 	idx_t OperatorSize() {
@@ -205,6 +267,12 @@ private:
 	TreeMap tree_map;
 	//! Whether or not we are running as part of a explain_analyze query
 	bool is_explain_analyze;
+	//! The trace events of the individual threads, collected when operator tracing is enabled
+	vector<vector<OperatorTraceEvent>> trace_events;
+	//! The resolved names of the traced operators (the operator pointers are not valid beyond the query itself)
+	unordered_map<const PhysicalOperator *, string> trace_names;
+	//! The total number of trace events that were dropped because the per-thread trace buffers were full
+	idx_t dropped_trace_events = 0;
 
 public:
 	const TreeMap &GetTreeMap() const {
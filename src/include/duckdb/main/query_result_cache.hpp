@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+class MaterializedQueryResult;
+class PreparedStatementData;
+class QueryResult;
+struct DataTableInfo;
+
+//! A table referenced by a cached result, together with the snapshot (transaction start time) under which
+//! the result was computed. The entry remains valid as long as the last write committed to the table
+//! precedes the snapshot.
+using cached_result_table_t = pair<shared_ptr<DataTableInfo>, transaction_t>;
+
+//! The QueryResultCache caches materialized results of read-only queries, keyed on the query string and
+//! the client's resolved search path (the cache is shared by all connections, the search path is not).
+//! Entries are validated against the catalog version and, per referenced base table, against the commit
+//! id of the last write to that table, so any committed write to a referenced table invalidates them.
+//! The cache is opt-in (PRAGMA enable_result_cache) and evicts least-recently-used entries when the
+//! byte budget is exceeded.
+class QueryResultCache {
+public:
+	//! The maximum total size of the cached results, in bytes
+	static constexpr idx_t MAXIMUM_CACHE_SIZE = 1ULL << 26; // 64MB
+	//! Results larger than this are not cached: the cache targets small, frequently re-issued queries
+	static constexpr idx_t MAXIMUM_ENTRY_SIZE = MAXIMUM_CACHE_SIZE / 8;
+
+	struct CachedResult {
+		//! The query string that produced the result
+		string query;
+		//! The catalog version at the time the result was produced
+		idx_t catalog_version;
+		//! The tables the result reads, with the snapshots under which it was computed
+		vector<cached_result_table_t> tables;
+		//! The statement properties of the query
+		StatementProperties properties;
+		//! The result names
+		vector<string> names;
+		//! The materialized result
+		unique_ptr<ColumnDataCollection> collection;
+		//! The (estimated) size of the result, in bytes
+		idx_t size;
+	};
+
+public:
+	//! Try to serve the given query from the cache
+	//! Returns nullptr on a miss, or when a referenced table or the catalog has changed since
+	unique_ptr<QueryResult> GetCachedResult(ClientContext &context, const string &query);
+	//! Store a successfully materialized result in the cache (no-op if the result is too large)
+	void StoreResult(ClientContext &context, PreparedStatementData &statement, vector<cached_result_table_t> tables,
+	                 MaterializedQueryResult &result);
+	//! Capture the snapshots of the tables the statement reads in the current transaction
+	//! Must be called while the transaction that computed the result is still active
+	static vector<cached_result_table_t> GetTableSnapshots(ClientContext &context, PreparedStatementData &statement);
+	//! Collect the base tables that the plan reads into PreparedStatementData::cache_tables
+	//! Returns false if the plan reads anything the cache cannot version-track (table functions,
+	//! temporary tables) or contains expressions with side effects
+	static bool CollectCacheableTables(LogicalOperator &op, vector<shared_ptr<DataTableInfo>> &tables);
+
+private:
+	//! Whether the given entry is still valid
+	static bool EntryIsValid(ClientContext &context, CachedResult &entry);
+	//! Copy a result collection, accumulating its estimated size (used both to store and to serve)
+	static unique_ptr<ColumnDataCollection> CopyCollection(const ColumnDataCollection &collection, idx_t &size);
+	//! Evict least-recently-used entries until the cache fits the budget again
+	void Evict();
+
+private:
+	//! The lock protecting the cache
+	mutex lock;
+	//! The cached results, in least-recently-used order (front = most recent)
+	list<CachedResult> entries;
+	//! Map of query string to cache entry
+	unordered_map<string, list<CachedResult>::iterator> entry_map;
+	//! The current total size of the cached results, in bytes
+	idx_t current_size = 0;
+};
+
+} // namespace duckdb
@@ -123,6 +123,26 @@ struct EnableExternalAccessSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct EnableResultCache {
+	static constexpr const char *Name = "enable_result_cache";
+	static constexpr const char *Description =
+	    "Cache materialized results of repeated read-only queries, invalidated by writes to the tables they read";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct EnableDictionaryCache {
+	static constexpr const char *Name = "enable_dictionary_cache";
+	static constexpr const char *Description =
+	    "Cache the decoded dictionary of dictionary compressed segments in memory, sharing it across scans";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct EnableFSSTVectors {
 	static constexpr const char *Name = "enable_fsst_vectors";
 	static constexpr const char *Description =
@@ -160,6 +180,36 @@ struct EnableHTTPMetadataCacheSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct EnableOperatorTraceSetting {
+	static constexpr const char *Name = "enable_operator_trace";
+	static constexpr const char *Description =
+	    "Whether or not individual operator invocations are recorded as trace events while profiling";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct EnablePerfCountersSetting {
+	static constexpr const char *Name = "enable_perf_counters";
+	static constexpr const char *Description =
+	    "Whether or not hardware performance counters are sampled per operator while profiling (Linux only)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct EnablePlanCacheSetting {
+	static constexpr const char *Name = "enable_plan_cache";
+	static constexpr const char *Description =
+	    "Whether or not plans of repeated identical SQL statements are cached and reused";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct EnableProfilingSetting {
 	static constexpr const char *Name = "enable_profiling";
 	static constexpr const char *Description =
@@ -310,6 +360,28 @@ struct PerfectHashThresholdSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct RowGroupSizeSetting {
+	static constexpr const char *Name = "row_group_size";
+	static constexpr const char *Description =
+	    "The target row group size of newly created tables, in rows. Must be a multiple of the vector size and at "
+	    "most the compiled maximum row group size";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct BulkAppendSetting {
+	static constexpr const char *Name = "bulk_append";
+	static constexpr const char *Description =
+	    "Whether or not batched appends (e.g. INSERT INTO ... SELECT) bypass the transaction-local staging area and "
+	    "append straight into the table. Only a single writer may modify the table in this mode.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PreserveIdentifierCase {
 	static constexpr const char *Name = "preserve_identifier_case";
 	static constexpr const char *Description =
@@ -320,6 +392,17 @@ struct PreserveIdentifierCase {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct PrioritySetting {
+	static constexpr const char *Name = "priority";
+	static constexpr const char *Description =
+	    "The priority at which the tasks of queries issued through this connection are scheduled (low, normal or "
+	    "high)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PreserveInsertionOrder {
 	static constexpr const char *Name = "preserve_insertion_order";
 	static constexpr const char *Description =
@@ -369,6 +452,35 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory of a single query issued through this connection (e.g. 1GB), capped by max_memory";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct RemoteFileCacheDirectorySetting {
+	static constexpr const char *Name = "remote_file_cache_directory";
+	static constexpr const char *Description =
+	    "Set the directory remote files are cached in (empty to disable caching)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct RemoteFileCacheSizeSetting {
+	static constexpr const char *Name = "remote_file_cache_size";
+	static constexpr const char *Description = "The maximum total size of the remote file cache directory (e.g. 16GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -389,15 +501,37 @@ struct SearchPathSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct StreamingPrefetchDepthSetting {
+	static constexpr const char *Name = "streaming_prefetch_depth";
+	static constexpr const char *Description =
+	    "The amount of chunks a streaming query result prefetches in the background (default: 0, i.e. disabled)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct TempDirectorySetting {
 	static constexpr const char *Name = "temp_directory";
-	static constexpr const char *Description = "Set the directory to which to write temp files";
+	static constexpr const char *Description =
+	    "Set the directory to which to write temp files; multiple directories can be provided as a comma-separated "
+	    "list, in which case temp files are striped across them";
 	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
 	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
 	static Value GetSetting(ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress buffers that are written to temp files, trading CPU time for less temp file I/O";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -407,6 +541,27 @@ struct ThreadsSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct WalCompressionSetting {
+	static constexpr const char *Name = "wal_compression";
+	static constexpr const char *Description =
+	    "Whether data entries written to the WAL are compressed, trading commit-path CPU for log size";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct WalGroupCommitDelaySetting {
+	static constexpr const char *Name = "wal_group_commit_delay";
+	static constexpr const char *Description =
+	    "The maximum delay (in microseconds) before syncing a commit to the WAL, used to batch the fsync of "
+	    "concurrently committing transactions";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct UsernameSetting {
 	static constexpr const char *Name = "username";
 	static constexpr const char *Description = "The username to use. Ignored for legacy compatibility.";
@@ -18,9 +18,13 @@ class ClientContextLock;
 class Executor;
 class MaterializedQueryResult;
 class PreparedStatementData;
+class StreamPrefetchTask;
+struct ProducerToken;
+struct StreamQueryPrefetchState;
 
 class StreamQueryResult : public QueryResult {
 	friend class ClientContext;
+	friend class StreamPrefetchTask;
 
 public:
 	//! Create a successful StreamQueryResult. StreamQueryResults should always be successful initially (it makes no
@@ -49,6 +53,22 @@ private:
 	unique_ptr<ClientContextLock> LockContext();
 	void CheckExecutableInternal(ClientContextLock &lock);
 	bool IsOpenInternal(ClientContextLock &lock);
+	//! Fetches the next chunk directly from the executor
+	unique_ptr<DataChunk> FetchNextChunk();
+	//! Sets up the background prefetch task, if prefetching is enabled and background threads are available
+	void InitializePrefetch();
+	//! Fetches the next chunk from the prefetch queue, waiting for the background task if the queue is empty
+	unique_ptr<DataChunk> FetchPrefetched();
+	//! Stops the background prefetch task (if any) and waits until it no longer touches this result
+	void StopPrefetch();
+
+private:
+	//! Whether or not prefetch initialization has been attempted
+	bool prefetch_initialized = false;
+	//! State shared with the background prefetch task (if prefetching is enabled)
+	shared_ptr<StreamQueryPrefetchState> prefetch_state;
+	//! The producer token used to schedule the prefetch task
+	unique_ptr<ProducerToken> prefetch_producer;
 };
 
 } // namespace duckdb
@@ -0,0 +1,35 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/common_subplan.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class Binder;
+class ClientContext;
+
+//! The CommonSubplanOptimizer detects structurally identical subplans within a single query and rewrites the
+//! plan to execute each of them only once: the plan is wrapped in a LogicalMaterialize that materializes the
+//! subplan, and every occurrence is replaced by a scan of the materialized result. This primarily benefits
+//! queries that reference the same (inlined) CTE several times.
+class CommonSubplanOptimizer {
+public:
+	CommonSubplanOptimizer(ClientContext &context, Binder &binder);
+
+	//! Subplans with a higher estimated cardinality than this are not materialized
+	static constexpr idx_t MAXIMUM_MATERIALIZE_CARDINALITY = 1000000;
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> plan);
+
+private:
+	ClientContext &context;
+	Binder &binder;
+};
+
+} // namespace duckdb
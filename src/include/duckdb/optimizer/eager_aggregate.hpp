@@ -0,0 +1,38 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/eager_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class Binder;
+class ClientContext;
+class LogicalAggregate;
+class LogicalOperator;
+
+//! The EagerAggregate optimizer pushes a partial aggregate below an inner join when the aggregate arguments come from
+//! a single side of the join. The partial aggregate groups on the join keys (plus any grouped columns of that side),
+//! which can shrink the join input by orders of magnitude for typical fact-dimension queries. The rewrite is
+//! cost-guarded: it is only applied when the distinct statistics of the grouped columns indicate a large reduction.
+class EagerAggregate {
+public:
+	EagerAggregate(ClientContext &context, Binder &binder) : context(context), binder(binder) {
+	}
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	void TryPushPartialAggregate(LogicalAggregate &aggr);
+
+private:
+	ClientContext &context;
+	Binder &binder;
+};
+
+} // namespace duckdb
@@ -38,6 +38,9 @@ private:
 	ClientContext &context;
 	//! The total amount of join pairs that have been considered
 	idx_t pairs = 0;
+	//! The maximum amount of join pairs to consider during the exact enumeration before falling back to the
+	//! approximate algorithm; computed from the size of the join problem in SolveJoinOrderExactly
+	idx_t pair_budget = 0;
 	//! Set of all relations considered in the join optimizer
 	vector<unique_ptr<SingleJoinRelation>> relations;
 	//! A mapping of base table index -> index into relations array (relation number)
@@ -0,0 +1,35 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/order_eliminator.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+class LogicalOrder;
+
+//! The OrderEliminator removes ORDER BY operators over scans of base tables whose sortedness statistics show that the
+//! values were appended in the requested order: scans deliver rows in insertion order (as long as order preservation
+//! is enabled), which makes the sort redundant
+class OrderEliminator {
+public:
+	explicit OrderEliminator(ClientContext &context) : context(context) {
+	}
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	bool IsRedundantOrder(LogicalOrder &order);
+
+private:
+	ClientContext &context;
+};
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/planner/logical_operator_visitor.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/vector.hpp"
 
 namespace duckdb {
@@ -25,6 +26,7 @@ public:
 	}
 
 	void VisitOperator(LogicalOperator &op) override;
+	void VisitExpression(unique_ptr<Expression> *expression) override;
 
 protected:
 	unique_ptr<Expression> VisitReplace(BoundColumnRefExpression &expr, unique_ptr<Expression> *expr_ptr) override;
@@ -38,6 +40,12 @@ private:
 	bool everything_referenced;
 	//! The map of column references
 	column_binding_map_t<vector<BoundColumnRefExpression *>> column_references;
+	//! The struct fields that are referenced through struct_extract, per struct column
+	column_binding_map_t<vector<bool>> struct_field_references;
+	//! Struct columns that are referenced in their entirety, and can therefore not be pruned to a set of fields
+	column_binding_set_t whole_struct_references;
+	//! Column references that occur as the child of a struct_extract call
+	unordered_set<Expression *> struct_extract_children;
 
 private:
 	template <class T>
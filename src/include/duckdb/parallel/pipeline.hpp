@@ -28,6 +28,8 @@ public:
 public:
 	//! Duplicate eliminated join scan dependencies
 	unordered_map<PhysicalOperator *, Pipeline *> delim_join_dependencies;
+	//! Materialized subplan dependencies (materialize index -> the pipeline that materializes the subplan)
+	unordered_map<idx_t, Pipeline *> materialize_dependencies;
 
 public:
 	void SetPipelineSource(Pipeline &pipeline, PhysicalOperator *op);
@@ -77,7 +79,7 @@ public:
 	void PrintDependencies() const;
 
 	//! Returns query progress
-	bool GetProgress(double &current_percentage, idx_t &estimated_cardinality);
+	bool GetProgress(double &current_percentage, idx_t &estimated_work);
 
 	//! Returns a list of all operators (including source and sink) involved in this pipeline
 	vector<PhysicalOperator *> GetOperators() const;
@@ -24,6 +24,7 @@ class Executor;
 class PipelineExecutor {
 public:
 	PipelineExecutor(ClientContext &context, Pipeline &pipeline);
+	~PipelineExecutor();
 
 	//! Fully execute a pipeline with a source and a sink until the source is completely exhausted
 	void Execute();
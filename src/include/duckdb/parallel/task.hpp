@@ -18,6 +18,9 @@ enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
 enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR };
 
+//! The scheduling priority of a task; higher-priority tasks are dequeued first
+enum class TaskPriority : uint8_t { LOW = 0, NORMAL = 1, HIGH = 2 };
+
 //! Generic parallel task
 class Task {
 public:
@@ -31,12 +31,16 @@ struct ProducerToken {
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The priority at which the tasks of this producer are scheduled
+	TaskPriority priority = TaskPriority::NORMAL;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
+	// maximum semaphore wait of an idle worker, reached through exponential backoff, 500ms
+	constexpr static int64_t MAX_TASK_TIMEOUT_USECS = 500000;
 
 public:
 	TaskScheduler(DatabaseInstance &db);
@@ -63,10 +67,15 @@ public:
 	void SetThreads(int32_t n);
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
+	//! Returns the number of background worker threads launched by the scheduler
+	DUCKDB_API idx_t NumberOfBackgroundThreads();
 
 	//! Send signals to n threads, signalling for them to wake up and attempt to execute a task
 	void Signal(idx_t n);
 
+	//! Pin the calling worker thread to the NUMA node it is assigned to (no-op when no topology is available)
+	void PinThread(idx_t thread_index);
+
 private:
 	void SetThreadsInternal(int32_t n);
 
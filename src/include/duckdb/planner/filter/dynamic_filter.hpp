@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The shared state of a dynamic filter: an operator that computes a bound at run-time (e.g. the current top-n
+//! threshold) tightens the constant while the scan consults it through the filter
+struct DynamicFilterData {
+	mutex lock;
+	//! The constant comparison that is applied, once initialized
+	unique_ptr<ConstantFilter> filter;
+	//! Whether or not a bound has been set yet
+	bool initialized = false;
+
+	//! Tighten the filter bound to the given value, if it is tighter than the current one
+	void SetValue(Value value);
+};
+
+//! A filter whose comparison value is filled in (and tightened) while the query is executing. Until the producing
+//! operator publishes a bound the filter lets everything through.
+class DynamicFilter : public TableFilter {
+public:
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared (run-time) state, also held by the operator that computes the bound
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(FieldWriter &writer) const override;
+};
+
+} // namespace duckdb
@@ -23,6 +23,8 @@ class LogicalCreateIndex;
 class LogicalCreateTable;
 class LogicalCrossProduct;
 class LogicalCTERef;
+class LogicalMaterialize;
+class LogicalMaterializeScan;
 class LogicalDelete;
 class LogicalDelimGet;
 class LogicalDelimJoin;
@@ -25,6 +25,10 @@ public:
 	std::string file_path;
 	bool use_tmp_file;
 	bool per_thread_output;
+	bool partition_output;
+	vector<idx_t> partition_columns;
+	vector<string> names;
+	vector<LogicalType> expected_types;
 
 public:
 	void Serialize(FieldWriter &writer) const override;
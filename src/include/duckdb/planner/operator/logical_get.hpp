@@ -46,6 +46,9 @@ public:
 	vector<string> input_table_names;
 	//! For a table-in-out function, the set of projected input columns
 	vector<column_t> projected_input;
+	//! For struct columns that are only accessed through a subset of their fields: a mask per column id of which
+	//! fields are referenced. The scan may emit NULL for fields that are not referenced.
+	unordered_map<column_t, vector<bool>> projected_struct_fields;
 
 	string GetName() const override;
 	string ParamsToString() const override;
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/operator/logical_materialize.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+//! LogicalMaterialize executes a common subplan once, materializing its result. The first child is the
+//! subplan definition, the second child is the main plan, in which every occurrence of the subplan has
+//! been replaced by a LogicalMaterializeScan that reads the materialized result.
+class LogicalMaterialize : public LogicalOperator {
+public:
+	explicit LogicalMaterialize(idx_t materialize_index)
+	    : LogicalOperator(LogicalOperatorType::LOGICAL_MATERIALIZE), materialize_index(materialize_index) {
+	}
+	LogicalMaterialize(idx_t materialize_index, unique_ptr<LogicalOperator> definition,
+	                   unique_ptr<LogicalOperator> main)
+	    : LogicalOperator(LogicalOperatorType::LOGICAL_MATERIALIZE), materialize_index(materialize_index) {
+		children.push_back(std::move(definition));
+		children.push_back(std::move(main));
+	}
+
+	//! The index under which the materialized result is registered
+	idx_t materialize_index;
+
+public:
+	vector<ColumnBinding> GetColumnBindings() override {
+		return children[1]->GetColumnBindings();
+	}
+	void Serialize(FieldWriter &writer) const override;
+	static unique_ptr<LogicalOperator> Deserialize(LogicalDeserializationState &state, FieldReader &reader);
+
+protected:
+	void ResolveTypes() override {
+		this->types = children[1]->types;
+	}
+};
+} // namespace duckdb
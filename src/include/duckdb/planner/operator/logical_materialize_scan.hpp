@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/operator/logical_materialize_scan.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+//! LogicalMaterializeScan reads the result of a materialized common subplan (see LogicalMaterialize).
+//! It exposes the column bindings of the subplan occurrence it replaces, so the rest of the plan is
+//! left untouched by the replacement.
+class LogicalMaterializeScan : public LogicalOperator {
+public:
+	LogicalMaterializeScan(idx_t materialize_index, vector<LogicalType> chunk_types, vector<ColumnBinding> bindings)
+	    : LogicalOperator(LogicalOperatorType::LOGICAL_MATERIALIZE_SCAN), materialize_index(materialize_index),
+	      chunk_types(std::move(chunk_types)), bindings(std::move(bindings)) {
+		D_ASSERT(this->chunk_types.size() == this->bindings.size());
+	}
+
+	//! The index of the materialized subplan that is read
+	idx_t materialize_index;
+	//! The types of the materialized chunks
+	vector<LogicalType> chunk_types;
+	//! The column bindings of the subplan occurrence this scan replaces
+	vector<ColumnBinding> bindings;
+
+public:
+	vector<ColumnBinding> GetColumnBindings() override {
+		return bindings;
+	}
+	void Serialize(FieldWriter &writer) const override;
+	static unique_ptr<LogicalOperator> Deserialize(LogicalDeserializationState &state, FieldReader &reader);
+
+protected:
+	void ResolveTypes() override {
+		this->types = chunk_types;
+	}
+};
+} // namespace duckdb
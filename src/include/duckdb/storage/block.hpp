@@ -18,6 +18,8 @@ class Block : public FileBuffer {
 public:
 	Block(Allocator &allocator, block_id_t id);
 	Block(Allocator &allocator, block_id_t id, uint32_t internal_size);
+	//! Creates a block backed by externally managed memory, e.g. a read-only memory mapping of the database file
+	Block(Allocator &allocator, block_id_t id, data_ptr_t external_buffer);
 	Block(FileBuffer &source, block_id_t id);
 
 	block_id_t id;
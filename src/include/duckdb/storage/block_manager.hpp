@@ -50,6 +50,9 @@ public:
 	virtual block_id_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
 	virtual void Read(Block &block) = 0;
+	//! Hint that the block will be read in the near future, so its read can start asynchronously (best-effort)
+	virtual void Prefetch(block_id_t block_id) {
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
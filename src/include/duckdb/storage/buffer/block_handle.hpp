@@ -73,6 +73,10 @@ public:
 		return readers;
 	}
 
+	inline bool IsLoaded() const {
+		return state == BlockState::BLOCK_LOADED;
+	}
+
 	inline bool IsSwizzled() const {
 		return !unswizzled;
 	}
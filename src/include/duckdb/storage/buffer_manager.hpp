@@ -23,6 +23,21 @@ class DatabaseInstance;
 class TemporaryDirectoryHandle;
 struct EvictionQueue;
 
+//! Counters describing buffer pool activity, maintained in the buffer manager hot paths. The counters are updated
+//! with relaxed atomics: they are monotonic and may be slightly stale when read, which is fine for monitoring.
+struct BufferPoolStats {
+	//! The number of times a block was pinned
+	atomic<idx_t> pins {0};
+	//! The number of pins that had to load the block from disk or a temporary file
+	atomic<idx_t> misses {0};
+	//! The number of blocks that were unloaded to make room for other data
+	atomic<idx_t> evictions {0};
+	//! The number of bytes written to temporary files
+	atomic<idx_t> temp_bytes_written {0};
+	//! The number of bytes read back from temporary files
+	atomic<idx_t> temp_bytes_read {0};
+};
+
 //! The buffer manager is in charge of handling memory management for the database. It hands out memory buffers that can
 //! be used by the database internally.
 //
@@ -53,6 +68,10 @@ public:
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle);
 	void Unpin(shared_ptr<BlockHandle> &handle);
 
+	//! Hint the reads of a batch of blocks without pinning them. Blocks that are not in memory yet have their disk
+	//! read scheduled through the underlying block manager, so a subsequent Pin does not pay the full read latency.
+	DUCKDB_API void Prefetch(vector<shared_ptr<BlockHandle>> &handles);
+
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
 	void SetLimit(idx_t limit = (idx_t)-1);
@@ -67,11 +86,21 @@ public:
 	idx_t GetMaxMemory() {
 		return maximum_memory;
 	}
+	//! The effective memory limit for a single query: the global limit, capped by the query_memory_limit
+	//! setting of the issuing client (if set)
+	DUCKDB_API idx_t GetQueryMaxMemory(ClientContext &context);
 
 	const string &GetTemporaryDirectory() {
 		return temp_directory;
 	}
 
+	//! The buffer pool activity counters
+	BufferPoolStats &GetStats() {
+		return stats;
+	}
+	//! The approximate number of entries in the eviction queue (including stale entries)
+	DUCKDB_API idx_t EvictionQueueSize();
+
 	void SetTemporaryDirectory(string new_dir);
 
 	DUCKDB_API Allocator &GetBufferAllocator();
@@ -161,6 +190,8 @@ private:
 	unique_ptr<TemporaryDirectoryHandle> temp_directory_handle;
 	//! Eviction queue
 	unique_ptr<EvictionQueue> queue;
+	//! The buffer pool activity counters
+	BufferPoolStats stats;
 	//! The temporary id used for managed buffers
 	atomic<block_id_t> temporary_id;
 	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
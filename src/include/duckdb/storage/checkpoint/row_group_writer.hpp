@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/storage/checkpoint_manager.hpp"
+#include "duckdb/storage/data_pointer.hpp"
 
 namespace duckdb {
 struct ColumnCheckpointState;
@@ -30,7 +31,7 @@ public:
 
 	CompressionType GetColumnCompressionType(idx_t i);
 
-	virtual void WriteColumnDataPointers(ColumnCheckpointState &column_checkpoint_state) = 0;
+	virtual void WriteColumnDataPointers(const vector<DataPointer> &data_pointers) = 0;
 
 	virtual MetaBlockWriter &GetPayloadWriter() = 0;
 
@@ -59,7 +60,7 @@ public:
 	MetaBlockWriter &table_data_writer;
 
 public:
-	virtual void WriteColumnDataPointers(ColumnCheckpointState &column_checkpoint_state) override;
+	virtual void WriteColumnDataPointers(const vector<DataPointer> &data_pointers) override;
 
 	virtual MetaBlockWriter &GetPayloadWriter() override;
 };
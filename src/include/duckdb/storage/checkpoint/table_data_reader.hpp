@@ -11,6 +11,8 @@
 #include "duckdb/storage/checkpoint_manager.hpp"
 
 namespace duckdb {
+class ColumnList;
+class PersistentTableData;
 struct BoundCreateTableInfo;
 
 //! The table data reader is responsible for reading the data of a table from the block manager
@@ -20,6 +22,9 @@ public:
 
 	void ReadTableData();
 
+	//! Deserialize the table statistics and row group pointers of a table with the given columns
+	static unique_ptr<PersistentTableData> ReadTableData(MetaBlockReader &reader, const ColumnList &columns);
+
 private:
 	MetaBlockReader &reader;
 	BoundCreateTableInfo &info;
@@ -18,7 +18,8 @@ enum class BitpackingMode : uint8_t {
 	CONSTANT,
 	CONSTANT_DELTA,
 	DELTA_FOR,
-	FOR
+	FOR,
+	DELTA_DELTA_FOR
 };
 
 BitpackingMode BitpackingModeFromString(const string &str);
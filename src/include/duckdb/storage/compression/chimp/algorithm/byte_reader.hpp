@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb.h"
+#include "duckdb/common/assert.hpp"
 #include "duckdb/common/fast_mem.hpp"
 #include "duckdb/common/exception.hpp"
 
@@ -16,13 +17,22 @@ namespace duckdb {
 
 class ByteReader {
 public:
-	ByteReader() : buffer(nullptr), index(0) {
+	ByteReader() : buffer(nullptr), index(0), safe_index(0) {
 	}
 
 public:
 	void SetStream(const uint8_t *buffer) {
 		this->buffer = buffer;
 		index = 0;
+		safe_index = 0;
+	}
+
+	//! Set the stream together with its size, enabling the branch-free read path for
+	//! all reads that can not touch the last 8 bytes of the stream
+	void SetStream(const uint8_t *buffer, uint32_t size) {
+		this->buffer = buffer;
+		index = 0;
+		safe_index = size >= 8 ? size - 7 : 0;
 	}
 
 	size_t Index() const {
@@ -43,6 +53,12 @@ public:
 
 	template <class T>
 	inline T ReadValue(uint8_t bytes, uint8_t trailing_zero) {
+		if (index < safe_index) {
+			// Far enough from the end of the stream: replace the data-dependent switch below
+			// with a single unaligned 8-byte load that is masked down to the requested size
+			uint8_t load_size = (uint8_t)(bytes - 1) < 7 ? bytes : (trailing_zero < 8 ? sizeof(T) : 0);
+			return ReadMaskedValue<T>(load_size);
+		}
 		T result = 0;
 		switch (bytes) {
 		case 1:
@@ -83,13 +99,37 @@ public:
 		}
 	}
 
+private:
+	template <class T>
+	inline T ReadMaskedValue(uint8_t load_size) {
+		static const uint64_t LOAD_MASKS[] = {0x0,
+		                                      0xFF,
+		                                      0xFFFF,
+		                                      0xFFFFFF,
+		                                      0xFFFFFFFF,
+		                                      0xFFFFFFFFFF,
+		                                      0xFFFFFFFFFFFF,
+		                                      0xFFFFFFFFFFFFFF,
+		                                      0xFFFFFFFFFFFFFFFF};
+		D_ASSERT(load_size <= sizeof(uint64_t));
+		T result = (T)(Load<uint64_t>(buffer + index) & LOAD_MASKS[load_size]);
+		index += load_size;
+		return result;
+	}
+
 private:
 	const uint8_t *buffer;
 	uint32_t index;
+	//! Highest index for which an 8-byte load stays within the stream (0 if the size is unknown)
+	uint32_t safe_index;
 };
 
 template <>
 inline uint32_t ByteReader::ReadValue(uint8_t bytes, uint8_t trailing_zero) {
+	if (index < safe_index) {
+		uint8_t load_size = bytes ? bytes : (trailing_zero < 8 ? sizeof(uint32_t) : 0);
+		return ReadMaskedValue<uint32_t>(load_size);
+	}
 	uint32_t result = 0;
 	switch (bytes) {
 	case 0:
@@ -34,8 +34,8 @@ struct PatasUnpackedValueStats {
 template <class EXACT_TYPE>
 struct PatasGroupState {
 public:
-	void Init(uint8_t *data) {
-		byte_reader.SetStream(data);
+	void Init(uint8_t *data, uint32_t size) {
+		byte_reader.SetStream(data, size);
 	}
 
 	idx_t BytesRead() const {
@@ -95,12 +95,14 @@ public:
 		// ScanStates never exceed the boundaries of a Segment,
 		// but are not guaranteed to start at the beginning of the Block
 		segment_data = handle.Ptr() + segment.GetBlockOffset();
-		auto metadata_offset = Load<uint32_t>(segment_data);
+		metadata_offset = Load<uint32_t>(segment_data);
 		metadata_ptr = segment_data + metadata_offset;
 	}
 
 	BufferHandle handle;
 	data_ptr_t metadata_ptr;
+	//! Offset at which the data region of the segment ends and the metadata starts
+	uint32_t metadata_offset;
 	data_ptr_t segment_data;
 	idx_t total_value_count = 0;
 	PatasGroupState<EXACT_TYPE> group_state;
@@ -156,9 +158,11 @@ public:
 		metadata_ptr -= sizeof(uint32_t);
 		auto data_byte_offset = Load<uint32_t>(metadata_ptr);
 		D_ASSERT(data_byte_offset < Storage::BLOCK_SIZE);
+		D_ASSERT(data_byte_offset <= metadata_offset);
 
 		// Initialize the byte_reader with the data values for the group
-		group_state.Init(segment_data + data_byte_offset);
+		// The data region ends where the metadata starts, which bounds the reads of this group
+		group_state.Init(segment_data + data_byte_offset, metadata_offset - data_byte_offset);
 
 		idx_t group_size = MinValue((idx_t)PatasPrimitives::PATAS_GROUP_SIZE, (count - total_value_count));
 
@@ -163,13 +163,25 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetStatistics(column_t column_id, const std::function<void(BaseStatistics &)> &set_fun);
-
+	//! Returns true if all values of the given column were appended in the given order; scanning the table in
+	//! insertion order then produces the column in that order
+	bool IsColumnSorted(column_t column_id, OrderType order_type);
+
+	//! Rewrites the row groups of the table to reclaim the space of deleted rows. The caller must have exclusive
+	//! access to the database (see TransactionManager::Vacuum)
+	void Vacuum();
+	//! Pre-write the data of modified row groups to disk ahead of a checkpoint, while other transactions can still
+	//! run (see StorageManager::PrepareCheckpoint)
+	void PrepareCheckpoint(const vector<CompressionType> &compression_types);
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer);
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
 
 	idx_t GetTotalRows();
+	//! Whether or not the table data has been loaded - this is false if the table data is loaded lazily and the table
+	//! has not been accessed yet
+	bool IsLoaded() const;
 
 	vector<vector<Value>> GetStorageInfo();
 	static bool IsForeignKeyIndex(const vector<PhysicalIndex> &fk_keys, Index &index, ForeignKeyType fk_type);
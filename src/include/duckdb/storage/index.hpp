@@ -124,9 +124,10 @@ public:
 		return serialized_data_pointer;
 	}
 
-protected:
+	//! Execute the index expressions on an input chunk
 	void ExecuteExpressions(DataChunk &input, DataChunk &result);
 
+protected:
 	//! Lock used for updating the index
 	mutex lock;
 
@@ -26,6 +26,7 @@ class SingleFileBlockManager : public BlockManager {
 
 public:
 	SingleFileBlockManager(AttachedDatabase &db, string path, bool read_only, bool create_new, bool use_direct_io);
+	~SingleFileBlockManager() override;
 
 	//! Creates a new Block using the specified block_id and returns a pointer
 	unique_ptr<Block> CreateBlock(block_id_t block_id, FileBuffer *source_buffer) override;
@@ -43,6 +44,7 @@ public:
 	block_id_t GetMetaBlock() override;
 	//! Read the content of the block from disk
 	void Read(Block &block) override;
+	void Prefetch(block_id_t block_id) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -62,6 +64,12 @@ private:
 	//! Return the blocks to which we will write the free list and modified blocks
 	vector<block_id_t> GetFreeListBlocks();
 
+	//! Try to memory-map the database file for reading; only used for read-only databases
+	void TryMemoryMapFile();
+	//! Returns a pointer to the start of the given block within the memory mapping, or nullptr if the block
+	//! cannot be served from the mapping
+	data_ptr_t GetMappedBlock(block_id_t block_id);
+
 private:
 	AttachedDatabase &db;
 	//! The active DatabaseHeader, either 0 (h1) or 1 (h2)
@@ -92,6 +100,11 @@ private:
 	bool read_only;
 	//! Whether or not to use Direct IO to read the blocks
 	bool use_direct_io;
+	//! Read-only memory mapping of the entire database file, or nullptr if the file is not mapped
+	//! When set, pinned blocks point directly into the mapping instead of into buffer pool memory
+	data_ptr_t mapped_file;
+	//! The size of the memory mapping
+	idx_t mapped_size;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
 };
@@ -8,9 +8,13 @@
 
 #pragma once
 
+#include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/common/types/value.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 
 namespace duckdb {
+class Vector;
+struct UnifiedVectorFormat;
 
 class ColumnStatistics {
 public:
@@ -20,6 +24,37 @@ public:
 
 public:
 	static shared_ptr<ColumnStatistics> CreateEmptyStats(const LogicalType &type);
+
+	//! Start tracking sortedness; this is only valid for empty columns, as every subsequently appended value needs to
+	//! be observed for the tracked sortedness to be correct
+	void InitializeSortednessTracking();
+	//! Update the sortedness with a chunk of appended values; any NULL value or out-of-order value permanently marks
+	//! the column as unsorted
+	void UpdateSortedness(Vector &vector, idx_t count);
+	//! Merge the sortedness of another set of column statistics whose values are appended after the current values
+	//! (e.g. when transaction-local storage is merged into the table)
+	void MergeSortedness(ColumnStatistics &other);
+	//! Permanently mark the column as unsorted (e.g. after an update)
+	void SetUnsorted();
+	//! Returns true if all values of the column were appended in the given order
+	bool IsSorted(OrderType order_type) const;
+
+private:
+	//! Typed implementation of UpdateSortedness: compares the values within the chunk without boxing them
+	template <class T>
+	void TemplatedUpdateSortedness(UnifiedVectorFormat &vdata, idx_t count);
+	//! Fallback implementation for nested and other exotic types, comparing boxed values
+	void GenericUpdateSortedness(Vector &vector, idx_t count);
+
+private:
+	//! Whether the values appended so far are in ascending (resp. descending) order; both start out disabled and are
+	//! only enabled for columns with sortedness tracking
+	bool sorted_ascending = false;
+	bool sorted_descending = false;
+	//! The first and last appended value, used to verify that subsequent appends extend the sorted run; NULL if no
+	//! values have been appended yet
+	Value first_value;
+	Value last_value;
 };
 
 } // namespace duckdb
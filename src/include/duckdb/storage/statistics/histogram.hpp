@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/histogram.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/types.hpp"
+
+namespace duckdb {
+class Deserializer;
+class Serializer;
+class Value;
+class Vector;
+
+//! An equi-depth histogram over the values of a numeric column, used for selectivity estimation.
+//! The histogram consists of a lower bound and a list of ascending bucket upper bounds; every bucket holds
+//! (approximately) the same fraction of the values, so frequent values show up as buckets with identical bounds.
+class EquiDepthHistogram {
+public:
+	//! The default number of buckets in a histogram
+	static constexpr const idx_t DEFAULT_BUCKET_COUNT = 64;
+
+public:
+	EquiDepthHistogram(double min, vector<double> bucket_boundaries);
+
+	//! The (inclusive) lower bound of the first bucket
+	double min;
+	//! The (inclusive) upper bounds of the buckets, in ascending order
+	vector<double> bucket_boundaries;
+
+public:
+	//! Whether or not histograms can be collected for columns of the given type
+	static bool SupportsType(const LogicalType &type);
+	//! Append the non-null values of the vector to the sample, converted to double
+	static void SampleValues(Vector &input, idx_t count, vector<double> &sample);
+	//! Create a histogram from a sample of values; returns nullptr if the sample is empty
+	//! Note that the sample is sorted in-place
+	static unique_ptr<EquiDepthHistogram> FromSample(vector<double> &sample,
+	                                                 idx_t bucket_count = DEFAULT_BUCKET_COUNT);
+
+	//! Estimate which fraction of the values passes a comparison with the given constant
+	double EstimateSelectivity(ExpressionType comparison_type, const Value &constant) const;
+	//! Truncate the histogram to the values that pass a comparison with the given constant
+	void ApplyFilter(ExpressionType comparison_type, const Value &constant);
+	//! Merge this histogram with a histogram over other values of the same column
+	void Merge(const EquiDepthHistogram &other);
+
+	unique_ptr<EquiDepthHistogram> Copy() const;
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<EquiDepthHistogram> Deserialize(Deserializer &source);
+
+	string ToString() const;
+
+private:
+	//! Estimate which fraction of the values is smaller than (or equal to, if inclusive) the given value
+	double EstimateFractionBelow(double value, bool inclusive) const;
+	//! The fraction of the values in buckets that hold exactly the given value (i.e. frequent values)
+	double DegenerateBucketFraction(double value) const;
+	//! Convert a constant to a double; returns false if the constant cannot be used for estimation
+	static bool GetConstant(const Value &constant, double &result);
+};
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/histogram.hpp"
 #include "duckdb/storage/statistics/segment_statistics.hpp"
 #include "duckdb/storage/statistics/validity_statistics.hpp"
 #include "duckdb/common/serializer.hpp"
@@ -30,6 +31,8 @@ public:
 	Value min;
 	//! The maximum value of the segment
 	Value max;
+	//! Equi-depth histogram of the values, collected during checkpoints (may be null)
+	unique_ptr<EquiDepthHistogram> histogram;
 
 public:
 	DUCKDB_API void Merge(const BaseStatistics &other) override;
@@ -19,12 +19,14 @@ enum class StorageLockType { SHARED = 0, EXCLUSIVE = 1 };
 
 class StorageLockKey {
 public:
-	StorageLockKey(StorageLock &lock, StorageLockType type);
+	StorageLockKey(StorageLock &lock, StorageLockType type, idx_t shard);
 	~StorageLockKey();
 
 private:
 	StorageLock &lock;
 	StorageLockType type;
+	//! The reader shard whose count this key incremented (only meaningful for shared locks)
+	idx_t shard;
 };
 
 class StorageLock {
@@ -39,14 +41,28 @@ public:
 	unique_ptr<StorageLockKey> GetSharedLock();
 
 private:
+	//! The number of reader shards; concurrent readers spread their counts over the shards so that the
+	//! shared-lock hot path never contends on a single atomic
+	static constexpr idx_t SHARD_COUNT = 8;
+
+	//! A single reader count, padded to a cache line so that readers on different shards do not false-share
+	struct ReaderShard {
+		atomic<idx_t> read_count;
+		char padding[64 - sizeof(atomic<idx_t>)];
+	};
+
 	mutex exclusive_lock;
-	atomic<idx_t> read_count;
+	//! Set while a writer is waiting for (or holding) the exclusive lock; diverts readers to the slow path
+	atomic<bool> exclusive_pending;
+	ReaderShard shards[SHARD_COUNT];
 
 private:
+	//! Returns the shard the current thread announces its reads on
+	idx_t GetShardIndex();
 	//! Release an exclusive lock
 	void ReleaseExclusiveLock();
-	//! Release a shared lock
-	void ReleaseSharedLock();
+	//! Release a shared lock on the given shard
+	void ReleaseSharedLock(idx_t shard);
 };
 
 } // namespace duckdb
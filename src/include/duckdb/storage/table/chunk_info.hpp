@@ -41,6 +41,11 @@ public:
 	//! Returns whether or not a single row in the ChunkInfo should be used or not for the given transaction
 	virtual bool Fetch(TransactionData transaction, row_t row) = 0;
 	virtual void CommitAppend(transaction_t commit_id, idx_t start, idx_t end) = 0;
+	//! Returns true if all rows were inserted by transactions that committed before the given start time and no rows
+	//! were deleted, i.e. every transaction sees all of the rows covered by this info
+	virtual bool IsFullyCommitted(transaction_t min_start_time) = 0;
+	//! Returns the number of rows covered by this info whose deletion has been committed
+	virtual idx_t GetCommittedDeletedCount(idx_t max_count) = 0;
 
 	virtual void Serialize(Serializer &serialize) = 0;
 	static unique_ptr<ChunkInfo> Deserialize(Deserializer &source);
@@ -59,6 +64,8 @@ public:
 	                            SelectionVector &sel_vector, idx_t max_count) override;
 	bool Fetch(TransactionData transaction, row_t row) override;
 	void CommitAppend(transaction_t commit_id, idx_t start, idx_t end) override;
+	bool IsFullyCommitted(transaction_t min_start_time) override;
+	idx_t GetCommittedDeletedCount(idx_t max_count) override;
 
 	void Serialize(Serializer &serialize) override;
 	static unique_ptr<ChunkInfo> Deserialize(Deserializer &source);
@@ -70,6 +77,12 @@ private:
 };
 
 class ChunkVectorInfo : public ChunkInfo {
+public:
+	//! The number of tuples covered by one entry of the deletion bitmap
+	static constexpr const idx_t MASK_BITS_PER_ENTRY = sizeof(uint64_t) * 8;
+	static constexpr const idx_t MASK_ENTRY_COUNT =
+	    (STANDARD_VECTOR_SIZE + MASK_BITS_PER_ENTRY - 1) / MASK_BITS_PER_ENTRY;
+
 public:
 	ChunkVectorInfo(idx_t start);
 
@@ -80,7 +93,15 @@ public:
 
 	//! The transaction ids of the transactions that deleted the tuples (if any)
 	atomic<transaction_t> deleted[STANDARD_VECTOR_SIZE];
+	//! The transaction id of the transaction that deleted the tuples, if same_deleted_id is set
+	atomic<transaction_t> delete_id;
+	//! Whether all deletions in this vector were made (or committed) by the same transaction. Together with the
+	//! deletion bitmap this compresses the deletion info: visibility is decided once per vector and scans then skip
+	//! the deleted tuples a bitmap entry at a time instead of inspecting the per-tuple transaction ids
+	atomic<bool> same_deleted_id;
 	atomic<bool> any_deleted;
+	//! Bitmap of the deleted tuples, one bit per tuple
+	atomic<uint64_t> deleted_mask[MASK_ENTRY_COUNT];
 
 public:
 	idx_t GetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
@@ -90,6 +111,8 @@ public:
 	                            SelectionVector &sel_vector, idx_t max_count) override;
 	bool Fetch(TransactionData transaction, row_t row) override;
 	void CommitAppend(transaction_t commit_id, idx_t start, idx_t end) override;
+	bool IsFullyCommitted(transaction_t min_start_time) override;
+	idx_t GetCommittedDeletedCount(idx_t max_count) override;
 
 	void Append(idx_t start, idx_t end, transaction_t commit_id);
 
@@ -108,6 +131,8 @@ private:
 	template <class OP>
 	idx_t TemplatedGetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
 	                            idx_t max_count);
+	//! Fills the selection vector with all tuples that are not set in the deletion bitmap
+	idx_t GetUndeletedSelVector(SelectionVector &sel_vector, idx_t max_count);
 };
 
 } // namespace duckdb
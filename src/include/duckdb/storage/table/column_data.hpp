@@ -19,6 +19,7 @@
 #include "duckdb/common/mutex.hpp"
 
 namespace duckdb {
+class BlockHandle;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -101,6 +102,9 @@ public:
 	//! Fetch a specific row id and append it to the vector
 	virtual void FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
 	                      idx_t result_idx);
+	//! Collect the blocks that have to be read to fetch the given row, so a batch of fetches can hint its reads
+	//! up-front through BufferManager::Prefetch
+	virtual void PrefetchRow(row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks);
 
 	virtual void Update(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
 	                    idx_t update_count);
@@ -118,6 +122,14 @@ public:
 	virtual void CheckpointScan(ColumnSegment *segment, ColumnScanState &state, idx_t row_group_start, idx_t count,
 	                            Vector &scan_vector);
 
+	//! Whether or not the column data is fully persistent on disk, i.e. it consists only of persistent segments
+	//! without any outstanding updates. Persistent column data can be checkpointed by reference.
+	virtual bool IsPersistent();
+	//! Whether or not the column data has any outstanding updates
+	virtual bool HasUpdates();
+	//! Serialize the column by referencing the existing on-disk data of its persistent segments
+	//! This can only be used if IsPersistent() is true; the data is not rewritten
+	virtual void SerializeColumn(RowGroupWriter &writer);
 	virtual void DeserializeColumn(Deserializer &source);
 	static shared_ptr<ColumnData> Deserialize(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                          idx_t start_row, Deserializer &source, const LogicalType &type,
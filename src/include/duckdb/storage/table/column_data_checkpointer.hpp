@@ -27,9 +27,16 @@ public:
 
 	void Checkpoint(vector<SegmentNode> nodes);
 
+	//! The number of vectors the sampling analyze pass reads before committing to a compression method
+	static constexpr idx_t ANALYZE_SAMPLE_VECTORS = 64;
+
 private:
-	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
+	//! Scan the segments, invoking the callback for every vector; when vector_stride is larger than one, only
+	//! every vector_stride-th vector is read and passed to the callback
+	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback, idx_t vector_stride = 1);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
+	//! Run the analyze step of the remaining compression functions and pick the best one
+	unique_ptr<AnalyzeState> RunAnalyze(idx_t vector_stride, CompressionType forced_method, idx_t &compression_idx);
 	void WriteToDisk();
 	bool HasChanges();
 	void WritePersistentSegments();
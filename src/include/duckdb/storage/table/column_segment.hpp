@@ -64,13 +64,21 @@ public:
 
 public:
 	void InitializeScan(ColumnScanState &state);
+	//! Hint that this segment will be scanned in the near future, so its block read can start asynchronously
+	void Prefetch();
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, bool entire_vector);
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
 
+	//! Evaluate the filter over the scanned vector; when segment_scan is set, the vector is a dictionary
+	//! vector over a sorted segment dictionary and constant comparisons are evaluated on the codes
 	static idx_t FilterSelection(SelectionVector &sel, Vector &result, const TableFilter &filter,
-	                             idx_t &approved_tuple_count, ValidityMask &mask);
+	                             idx_t &approved_tuple_count, ValidityMask &mask,
+	                             SegmentScanState *segment_scan = nullptr);
+	//! Whether FilterSelection can evaluate the given filter on an FSST or dictionary vector without
+	//! flattening it
+	static bool CanFilterCompressedStrings(const TableFilter &filter);
 
 	//! Skip a scan forward to the row_index specified in the scan state
 	void Skip(ColumnScanState &state);
@@ -30,6 +30,12 @@ struct DataTableInfo {
 	string schema;
 	// name of the table
 	string table;
+	//! The target row group size of the table, in rows; captured from the database configuration when the table is
+	//! created (not persisted: reloaded tables pick up the setting active at load time)
+	idx_t row_group_size;
+	//! The commit id of the last write (append, delete or update) that was committed to the table
+	//! Consulted by the query result cache to decide whether a cached result is still current
+	atomic<transaction_t> last_write_version;
 
 	TableIndexList indexes;
 
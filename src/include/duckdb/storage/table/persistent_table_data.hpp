@@ -23,6 +23,11 @@ public:
 
 	vector<RowGroupPointer> row_groups;
 	vector<unique_ptr<BaseStatistics>> column_stats;
+	//! The location of the serialized table data within the checkpoint. If set, the statistics and row group
+	//! pointers have not been deserialized yet, and row_groups and column_stats above are empty: the table data is
+	//! loaded lazily when the table is first accessed
+	block_id_t table_data_block = INVALID_BLOCK;
+	uint64_t table_data_offset = 0;
 };
 
 } // namespace duckdb
@@ -20,6 +20,7 @@
 
 namespace duckdb {
 class AttachedDatabase;
+class BlockHandle;
 class BlockManager;
 class ColumnData;
 class DatabaseInstance;
@@ -48,6 +49,9 @@ public:
 public:
 	static constexpr const idx_t ROW_GROUP_SIZE = STANDARD_ROW_GROUPS_SIZE;
 	static constexpr const idx_t ROW_GROUP_VECTOR_COUNT = ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE;
+	//! If fewer than 1 in LATE_MATERIALIZATION_FACTOR rows survive the table filters, the columns
+	//! without filters are fetched per surviving row instead of being scanned in full
+	static constexpr const idx_t LATE_MATERIALIZATION_FACTOR = 50;
 
 public:
 	RowGroup(AttachedDatabase &db, BlockManager &block_manager, DataTableInfo &table_info, idx_t start, idx_t count);
@@ -119,6 +123,8 @@ public:
 	//! Fetch a specific row from the row_group and insert it into the result at the specified index
 	void FetchRow(TransactionData transaction, ColumnFetchState &state, const vector<column_t> &column_ids,
 	              row_t row_id, DataChunk &result, idx_t result_idx);
+	//! Collect the blocks that have to be read to fetch the given row (see BufferManager::Prefetch)
+	void PrefetchRow(const vector<column_t> &column_ids, row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks);
 
 	//! Append count rows to the version info
 	void AppendVersionInfo(TransactionData transaction, idx_t count);
@@ -131,7 +137,21 @@ public:
 	idx_t Delete(TransactionData transaction, DataTable *table, row_t *row_ids, idx_t count);
 
 	RowGroupWriteData WriteToDisk(PartialBlockManager &manager, const vector<CompressionType> &compression_types);
+	//! Whether or not all columns of the row group are fully persistent on disk (i.e. the row group was not
+	//! modified since it was last checkpointed). Persistent row groups are checkpointed by reference.
+	bool IsPersistent();
+	//! Whether or not the row group can be merged with its neighbours by background compaction: all of its rows must
+	//! be visible to every transaction (inserts committed before the given start time, no deletes) and none of its
+	//! columns may carry outstanding updates
+	bool IsCompactable(transaction_t min_start_time);
+	//! Whether or not any of the columns of the row group carry outstanding updates
+	bool HasUpdates();
+	//! Returns the number of rows in the row group whose deletion has been committed
+	idx_t GetCommittedDeletedCount();
 	RowGroupPointer Checkpoint(RowGroupWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats);
+	//! Write the metadata of a row group that was already written to disk through WriteToDisk
+	RowGroupPointer Checkpoint(RowGroupWriter &writer, RowGroupWriteData &&write_data,
+	                           vector<unique_ptr<BaseStatistics>> &global_stats);
 	static void Serialize(RowGroupPointer &pointer, Serializer &serializer);
 	static RowGroupPointer Deserialize(Deserializer &source, const ColumnList &columns);
 
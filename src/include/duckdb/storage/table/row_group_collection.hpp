@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/table/segment_tree.hpp"
 #include "duckdb/storage/statistics/column_statistics.hpp"
@@ -16,24 +18,50 @@
 namespace duckdb {
 struct ParallelTableScanState;
 
+class ColumnList;
 class PersistentTableData;
+class ProducerToken;
 class TableDataWriter;
 class TableIndexList;
 class TableStatistics;
+struct RowGroupCollectionLazyData;
+
+//! Write data of a row group that was pre-written ahead of a checkpoint, together with the row count of the row group
+//! at the time of the write
+struct PreparedRowGroupData {
+	idx_t count = 0;
+	RowGroupWriteData data;
+	//! The blocks holding the pre-written data, so they can be freed again if the data is discarded
+	unordered_set<block_id_t> blocks;
+};
+struct RowGroupCompactionState;
+class RowGroupCompactionTask;
 
 class RowGroupCollection {
+	friend class RowGroupCompactionTask;
+
 public:
 	RowGroupCollection(shared_ptr<DataTableInfo> info, BlockManager &block_manager, vector<LogicalType> types,
 	                   idx_t row_start, idx_t total_rows = 0);
+	~RowGroupCollection();
 
 public:
-	idx_t GetTotalRows() const;
+	idx_t GetTotalRows();
+	idx_t GetRowStart() const {
+		return row_start;
+	}
 	Allocator &GetAllocator() const;
 
 	void Initialize(PersistentTableData &data);
+	//! Initialize the collection from lazily loaded table data: the statistics and row group pointers are only
+	//! deserialized from the checkpoint once the collection is first accessed
+	void InitializeLazy(const ColumnList &columns, PersistentTableData &data);
 	void InitializeEmpty();
 
-	bool IsEmpty() const;
+	bool IsEmpty();
+	//! Whether or not the table data has been loaded - this is false if the collection was initialized lazily and has
+	//! not been accessed yet
+	bool IsLoaded() const;
 
 	void AppendRowGroup(SegmentLock &l, idx_t start_row);
 	//! Get the nth row-group, negative numbers start from the back (so -1 is the last row group, etc)
@@ -69,6 +97,11 @@ public:
 
 	void MergeStorage(RowGroupCollection &data);
 
+	//! Removes the rows whose deletion has been committed by rewriting the row groups that contain them. Removing a
+	//! row shifts the row ids of all rows that follow it: the caller must have exclusive access to the database (see
+	//! TransactionManager::Vacuum) and must ensure no indexes reference the row ids of the table
+	void Vacuum();
+
 	void RemoveFromIndexes(TableIndexList &indexes, Vector &row_identifiers, idx_t count);
 
 	idx_t Delete(TransactionData transaction, DataTable *table, row_t *ids, idx_t count);
@@ -76,6 +109,12 @@ public:
 	void UpdateColumn(TransactionData transaction, Vector &row_ids, const vector<column_t> &column_path,
 	                  DataChunk &updates);
 
+	//! Pre-write the data of modified row groups to disk ahead of a checkpoint, while other transactions can still
+	//! run; the next checkpoint serializes pre-written row groups by reference, unless they changed in the meantime
+	void PrepareCheckpoint(const vector<CompressionType> &compression_types);
+	//! Discard any pre-written checkpoint data, freeing its blocks; blocks listed in used_blocks are shared with
+	//! pre-written data the checkpoint does use and stay allocated
+	void DiscardPreparedCheckpointData(const unordered_set<block_id_t> *used_blocks = nullptr);
 	void Checkpoint(TableDataWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats);
 
 	void CommitDropColumn(idx_t index);
@@ -93,9 +132,21 @@ public:
 
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetStatistics(column_t column_id, const std::function<void(BaseStatistics &)> &set_fun);
+	//! Returns true if all values of the given column were appended in the given order
+	bool IsColumnSorted(column_t column_id, OrderType order_type);
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Deserialize any lazily loaded table data, if it has not been loaded yet
+	void EnsureLoaded();
+	//! Schedules a background compaction pass if the collection contains adjacent undersized row groups
+	void ScheduleCompaction();
+	//! Returns true if there are adjacent row groups that could be merged into a single row group
+	bool HasCompactionCandidates();
+	//! Merges adjacent undersized row groups into full row groups (see RowGroupCompactionTask)
+	void Compact();
+	//! Frees replaced row groups once no transaction can reference them anymore
+	void FreeRetiredRowGroups();
 
 private:
 	//! BlockManager
@@ -109,6 +160,25 @@ private:
 	shared_ptr<SegmentTree> row_groups;
 	//! Table statistics
 	TableStatistics stats;
+	//! Whether or not there is lazily loaded table data that still has to be deserialized
+	atomic<bool> has_lazy_data;
+	//! Lock protecting the lazy loading of the table data
+	mutex lazy_load_lock;
+	//! The lazily loaded table data (if any)
+	unique_ptr<RowGroupCollectionLazyData> lazy_data;
+	//! Lock taken by operations that modify existing row groups (deletes and updates), and held by the background
+	//! compaction task while it replaces row groups, so that resolved row-group pointers stay valid
+	mutex compaction_lock;
+	//! State shared with the background compaction task (if any)
+	shared_ptr<RowGroupCompactionState> compaction_state;
+	//! Producer token used to schedule background compaction tasks
+	unique_ptr<ProducerToken> compaction_producer;
+	//! Row groups that were replaced by compaction but may still be referenced by scans of older transactions;
+	//! they are retired here and freed once no such transaction remains (protected by compaction_lock)
+	vector<SegmentNode> retired_row_groups;
+	//! Row group data pre-written by PrepareCheckpoint, keyed by row group; consumed by the next checkpoint and only
+	//! used if the row group did not change since it was written. Protected by the compaction lock
+	unordered_map<RowGroup *, PreparedRowGroupData> prepared_checkpoint_data;
 };
 
 } // namespace duckdb
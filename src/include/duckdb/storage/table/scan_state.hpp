@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/scan_options.hpp"
@@ -52,6 +53,9 @@ struct ColumnScanState {
 	unique_ptr<SegmentScanState> scan_state;
 	//! Child states of the vector
 	vector<ColumnScanState> child_states;
+	//! For struct columns: whether or not each child column should be scanned
+	//! If empty, all child columns are scanned; children that are not scanned emit NULL instead
+	vector<bool> scan_child_columns;
 	//! Whether or not InitializeState has been called for this segment
 	bool initialized = false;
 	//! If this segment has already been checked for skipping purposes
@@ -101,6 +105,7 @@ public:
 	const vector<column_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
+	const unordered_map<column_t, vector<bool>> &GetProjectedStructFields();
 	idx_t GetParentMaxRow();
 
 private:
@@ -124,6 +129,7 @@ public:
 	const vector<column_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
+	const unordered_map<column_t, vector<bool>> &GetProjectedStructFields();
 	bool Scan(Transaction &transaction, DataChunk &result);
 	bool ScanCommitted(DataChunk &result, TableScanType type);
 
@@ -141,11 +147,13 @@ public:
 	CollectionScanState local_state;
 
 public:
-	void Initialize(vector<column_t> column_ids, TableFilterSet *table_filters = nullptr);
+	void Initialize(vector<column_t> column_ids, TableFilterSet *table_filters = nullptr,
+	                unordered_map<column_t, vector<bool>> projected_struct_fields = {});
 
 	const vector<column_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
+	const unordered_map<column_t, vector<bool>> &GetProjectedStructFields();
 
 private:
 	//! The column identifiers of the scan
@@ -154,6 +162,8 @@ private:
 	TableFilterSet *table_filters;
 	//! Adaptive filter info (if any)
 	unique_ptr<AdaptiveFilter> adaptive_filter;
+	//! For struct columns: a mask per column id of which child columns are referenced (if any)
+	unordered_map<column_t, vector<bool>> projected_struct_fields;
 };
 
 struct ParallelCollectionScanState {
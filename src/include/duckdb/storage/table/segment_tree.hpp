@@ -59,6 +59,12 @@ public:
 	void Replace(SegmentTree &other);
 	void Replace(SegmentLock &, SegmentTree &other);
 
+	//! Replace the "count" segments starting at "segment_index" with the given segment, which must cover the same
+	//! row range. Returns the replaced nodes so the caller can keep them alive while scans may still reference them;
+	//! the next pointers within the replaced chain are left untouched, so such scans keep working.
+	vector<SegmentNode> ReplaceSegments(SegmentLock &, idx_t segment_index, idx_t count,
+	                                    unique_ptr<SegmentBase> replacement);
+
 	//! Erase all segments after a specific segment
 	void EraseSegments(SegmentLock &, idx_t segment_start);
 
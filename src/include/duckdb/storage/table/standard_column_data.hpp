@@ -37,6 +37,7 @@ public:
 	void AppendData(BaseStatistics &stats, ColumnAppendState &state, UnifiedVectorFormat &vdata, idx_t count) override;
 	void RevertAppend(row_t start_row) override;
 	idx_t Fetch(ColumnScanState &state, row_t row_id, Vector &result) override;
+	void PrefetchRow(row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks) override;
 	void FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
 	              idx_t result_idx) override;
 	void Update(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
@@ -54,6 +55,9 @@ public:
 	void CheckpointScan(ColumnSegment *segment, ColumnScanState &state, idx_t row_group_start, idx_t count,
 	                    Vector &scan_vector) override;
 
+	bool IsPersistent() override;
+	bool HasUpdates() override;
+	void SerializeColumn(RowGroupWriter &writer) override;
 	void DeserializeColumn(Deserializer &source) override;
 
 	void GetStorageInfo(idx_t row_group_index, vector<idx_t> col_path, vector<vector<Value>> &result) override;
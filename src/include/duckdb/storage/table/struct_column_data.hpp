@@ -42,6 +42,7 @@ public:
 	void Append(BaseStatistics &stats, ColumnAppendState &state, Vector &vector, idx_t count) override;
 	void RevertAppend(row_t start_row) override;
 	idx_t Fetch(ColumnScanState &state, row_t row_id, Vector &result) override;
+	void PrefetchRow(row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks) override;
 	void FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
 	              idx_t result_idx) override;
 	void Update(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
@@ -57,6 +58,9 @@ public:
 	unique_ptr<ColumnCheckpointState> Checkpoint(RowGroup &row_group, PartialBlockManager &partial_block_manager,
 	                                             ColumnCheckpointInfo &checkpoint_info) override;
 
+	bool IsPersistent() override;
+	bool HasUpdates() override;
+	void SerializeColumn(RowGroupWriter &writer) override;
 	void DeserializeColumn(Deserializer &source) override;
 
 	void GetStorageInfo(idx_t row_group_index, vector<idx_t> col_path, vector<vector<Value>> &result) override;
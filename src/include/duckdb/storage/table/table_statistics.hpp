@@ -40,6 +40,8 @@ public:
 
 	unique_ptr<BaseStatistics> CopyStats(idx_t i);
 	ColumnStatistics &GetStats(idx_t i);
+	//! Returns true if all values of the given column were appended in the given order
+	bool IsColumnSorted(idx_t i, OrderType order_type);
 
 	bool Empty();
 
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
@@ -18,6 +20,8 @@
 #include "duckdb/catalog/catalog_entry/scalar_macro_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -34,12 +38,13 @@ class TypeCatalogEntry;
 class TableCatalogEntry;
 class Transaction;
 class TransactionManager;
+class WALReplayDispatcher;
 
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context, Deserializer &source)
 	    : db(db), context(context), catalog(Catalog::GetCatalog(context, INVALID_CATALOG)), source(source),
-	      current_table(nullptr), deserialize_only(false), checkpoint_id(INVALID_BLOCK) {
+	      current_table(nullptr), dispatcher(nullptr), deserialize_only(false), checkpoint_id(INVALID_BLOCK) {
 	}
 
 	AttachedDatabase &db;
@@ -47,6 +52,8 @@ public:
 	Catalog &catalog;
 	Deserializer &source;
 	TableCatalogEntry *current_table;
+	//! Dispatcher that applies data entries of independent tables on worker threads (if set)
+	WALReplayDispatcher *dispatcher;
 	bool deserialize_only;
 	block_id_t checkpoint_id;
 
@@ -82,6 +89,9 @@ protected:
 	void ReplayDelete();
 	void ReplayUpdate();
 	void ReplayCheckpoint();
+
+	//! Read a data chunk written by WriteAheadLog::WriteChunk, decompressing it if it was written compressed
+	void ReadChunk(DataChunk &chunk);
 };
 
 //! The WriteAheadLog (WAL) is a log that is used to provide durability. Prior
@@ -148,13 +158,34 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Write a flush marker and flush the WAL to the operating system, without syncing it to disk.
+	//! The flushed entries only become durable once Sync() has completed.
+	void FlushBuffer();
+	//! Sync all flushed WAL entries to disk. Concurrent callers share a single fsync (group commit).
+	void Sync();
+	//! Flush the WAL and sync it to disk
 	void Flush();
 
 	void WriteCheckpoint(block_id_t meta_block);
 
+protected:
+	//! Write a data chunk, compressed when wal_compression is enabled; the chunk is prefixed with a flag byte
+	//! so that replay does not depend on the current setting
+	void WriteChunk(DataChunk &chunk);
+
 protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
+	//! Lock guarding the group commit state below
+	mutex sync_lock;
+	//! Signalled when an fsync completes, waking up committers waiting for their entries to be synced
+	std::condition_variable sync_cv;
+	//! Whether a thread is currently running an fsync on the WAL
+	bool sync_in_progress = false;
+	//! The total_written marker up to which entries have been flushed to the operating system
+	atomic<idx_t> flush_target {0};
+	//! The total_written marker up to which entries have been synced to disk
+	atomic<idx_t> synced_target {0};
 	string wal_path;
 };
 
@@ -89,6 +89,11 @@ public:
 	                     bool append_to_table);
 	bool AppendToIndexes(Transaction &transaction, RowGroupCollection &source, TableIndexList &index_list,
 	                     const vector<LogicalType> &table_types, row_t &start_row);
+	//! Appends a collection to a set of ART indexes in bulk: the keys of every chunk are collected and sorted, built
+	//! into a small ART, and merged into the index wholesale, instead of inserting the rows one by one behind the
+	//! index lock. May leave partially appended data in the indexes if a constraint is violated.
+	bool BulkAppendToIndexes(Transaction &transaction, RowGroupCollection &source, TableIndexList &index_list,
+	                         const vector<LogicalType> &table_types, row_t &start_row);
 
 	//! Creates an optimistic writer for this table
 	OptimisticDataWriter *CreateOptimisticWriter();
@@ -22,12 +22,17 @@ class ClientContext;
 class Catalog;
 struct ClientLockWrapper;
 class DatabaseInstance;
+class DataTable;
+class ProducerToken;
 class Transaction;
+struct VersionCleanupState;
+class VersionCleanupTask;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
 class TransactionManager {
 	friend struct CheckpointLock;
+	friend class VersionCleanupTask;
 
 public:
 	explicit TransactionManager(AttachedDatabase &db);
@@ -48,6 +53,9 @@ public:
 	}
 
 	void Checkpoint(ClientContext &context, bool force = false);
+	//! Rewrite the row groups of the given table to reclaim the space of deleted rows. Requires the same exclusive
+	//! access to the database as a checkpoint
+	void Vacuum(ClientContext &context, DataTable &table);
 
 	static TransactionManager &Get(AttachedDatabase &db);
 
@@ -58,8 +66,20 @@ public:
 
 private:
 	bool CanCheckpoint(Transaction *current = nullptr);
+	//! Returns true if no transactions other than the given one are active and no data of finished transactions is
+	//! still pending cleanup
+	bool IsSoleTransaction(Transaction *current = nullptr);
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(Transaction *transaction) noexcept;
+	//! Hand a no-longer-visible transaction to the background version cleanup task
+	void ScheduleCleanup(unique_ptr<Transaction> transaction);
+	//! Wait for an in-flight background cleanup batch and process any queued cleanup work inline.
+	//! May only be called while all client locks are held and without holding the transaction lock.
+	void DrainCleanup();
+	//! Returns true if any background version cleanup work is queued or in flight
+	bool HasPendingCleanup();
+	//! Move cleaned-up transactions to the list of transactions awaiting GC
+	void AddOldTransactions(vector<unique_ptr<Transaction>> transactions);
 	void LockClients(vector<ClientLockWrapper> &client_locks, ClientContext &context);
 
 	//! The attached database
@@ -80,6 +100,10 @@ private:
 	vector<unique_ptr<Transaction>> old_transactions;
 	//! The lock used for transaction operations
 	mutex transaction_lock;
+	//! State shared with the background version cleanup task
+	shared_ptr<VersionCleanupState> cleanup_state;
+	//! Producer token used to schedule background version cleanup tasks
+	unique_ptr<ProducerToken> cleanup_producer;
 
 	bool thread_is_checkpointing;
 };
@@ -325,6 +325,75 @@ void BaseAppender::AppendDataChunk(DataChunk &chunk) {
 	}
 }
 
+void BaseAppender::AppendDataChunkReference(DataChunk &chunk) {
+	if (chunk.GetTypes() != types) {
+		throw InvalidInputException("Type mismatch in Append DataChunk and the types required for appender");
+	}
+	if (chunk.size() > STANDARD_VECTOR_SIZE) {
+		throw InvalidInputException("Chunks appended by reference can hold at most STANDARD_VECTOR_SIZE rows");
+	}
+	collection->AppendReference(chunk);
+	if (collection->Count() >= FLUSH_COUNT) {
+		Flush();
+	}
+}
+
+void BaseAppender::BeginColumnBatch(idx_t count) {
+	if (count == 0) {
+		throw InvalidInputException("Cannot begin a column batch of 0 rows");
+	}
+	if (batch_count != 0) {
+		throw InvalidInputException("BeginColumnBatch called while another column batch is still active");
+	}
+	if (column != 0) {
+		throw InvalidInputException("BeginColumnBatch called in the middle of a row append");
+	}
+	// flush any rows buffered by the row-wise append functions so the batch is appended in order
+	FlushChunk();
+	batch_count = count;
+	batch_chunk.Initialize(allocator, types, count);
+	batch_columns_filled.clear();
+	batch_columns_filled.resize(types.size(), false);
+}
+
+Vector &BaseAppender::BatchColumn(idx_t column_index, PhysicalType type) {
+	if (batch_count == 0) {
+		throw InvalidInputException("AppendColumnData called without an active column batch");
+	}
+	if (column_index >= batch_chunk.ColumnCount()) {
+		throw InvalidInputException("Column index out of range for AppendColumnData");
+	}
+	if (batch_columns_filled[column_index]) {
+		throw InvalidInputException("AppendColumnData called twice for column %d", column_index);
+	}
+	auto &col = batch_chunk.data[column_index];
+	if (col.GetType().InternalType() != type) {
+		throw InvalidInputException("Type mismatch in AppendColumnData: expected data of physical type %s for column %d",
+		                            TypeIdToString(col.GetType().InternalType()), column_index);
+	}
+	batch_columns_filled[column_index] = true;
+	return col;
+}
+
+void BaseAppender::EndColumnBatch() {
+	if (batch_count == 0) {
+		throw InvalidInputException("EndColumnBatch called without an active column batch");
+	}
+	for (idx_t col_idx = 0; col_idx < batch_columns_filled.size(); col_idx++) {
+		if (!batch_columns_filled[col_idx]) {
+			throw InvalidInputException("EndColumnBatch called before data was appended for column %d", col_idx);
+		}
+	}
+	batch_chunk.SetCardinality(batch_count);
+	collection->Append(batch_chunk);
+	batch_chunk.Destroy();
+	batch_count = 0;
+	batch_columns_filled.clear();
+	if (collection->Count() >= FLUSH_COUNT) {
+		Flush();
+	}
+}
+
 void BaseAppender::FlushChunk() {
 	if (chunk.size() == 0) {
 		return;
@@ -487,3 +487,30 @@ duckdb_data_chunk duckdb_result_get_chunk(duckdb_result result, idx_t chunk_idx)
 	collection.FetchChunk(chunk_idx, *chunk);
 	return reinterpret_cast<duckdb_data_chunk>(chunk.release());
 }
+
+duckdb_data_chunk duckdb_fetch_chunk(duckdb_result result) {
+	if (!result.internal_data) {
+		return nullptr;
+	}
+	auto &result_data = *((duckdb::DuckDBResultData *)result.internal_data);
+	if (result_data.result_set_type == duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_DEPRECATED) {
+		return nullptr;
+	}
+	result_data.result_set_type = duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_MATERIALIZED;
+	try {
+		duckdb::unique_ptr<duckdb::DataChunk> chunk;
+		if (result_data.result->type == duckdb::QueryResultType::MATERIALIZED_RESULT) {
+			// fetch a chunk that references the result collection directly instead of copying the data out
+			auto &materialized = (duckdb::MaterializedQueryResult &)*result_data.result;
+			chunk = materialized.FetchZeroCopy();
+		} else {
+			chunk = result_data.result->Fetch();
+		}
+		if (!chunk) {
+			return nullptr;
+		}
+		return reinterpret_cast<duckdb_data_chunk>(chunk.release());
+	} catch (...) { // LCOV_EXCL_START
+		return nullptr;
+	} // LCOV_EXCL_STOP
+}
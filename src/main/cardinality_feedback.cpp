@@ -0,0 +1,67 @@
+#include "duckdb/main/cardinality_feedback.hpp"
+
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/to_string.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+void CardinalityFeedback::RecordCardinality(const string &fragment_key, idx_t cardinality) {
+	lock_guard<mutex> guard(lock);
+	auto entry = observed_cardinalities.find(fragment_key);
+	if (entry != observed_cardinalities.end()) {
+		entry->second = cardinality;
+		return;
+	}
+	if (observed_cardinalities.size() >= MAXIMUM_FRAGMENTS) {
+		// the feedback store is full: don't track any new fragments
+		return;
+	}
+	observed_cardinalities[fragment_key] = cardinality;
+}
+
+bool CardinalityFeedback::TryGetCardinality(const string &fragment_key, idx_t &cardinality) {
+	lock_guard<mutex> guard(lock);
+	auto entry = observed_cardinalities.find(fragment_key);
+	if (entry == observed_cardinalities.end()) {
+		return false;
+	}
+	cardinality = entry->second;
+	return true;
+}
+
+string CardinalityFeedback::ScanKey(const TableFunction &function, const FunctionData *bind_data,
+                                    const TableFilterSet *filters, const vector<column_t> *column_ids) {
+	string key;
+	if (function.to_string) {
+		key = function.to_string(bind_data);
+	} else {
+		key = function.name;
+	}
+	if (filters) {
+		// canonicalize the pushed down filters: reference them by column id and emit them in column order, so that
+		// the projected columns of the scan do not influence the key
+		map<column_t, string> canonical_filters;
+		for (auto &entry : filters->filters) {
+			auto column_id = entry.first;
+			if (column_ids) {
+				D_ASSERT(column_id < column_ids->size());
+				column_id = (*column_ids)[column_id];
+			}
+			canonical_filters[column_id] = entry.second->ToString(to_string(column_id));
+		}
+		for (auto &entry : canonical_filters) {
+			key += "\n" + entry.second;
+		}
+	}
+	return key;
+}
+
+CardinalityFeedback &CardinalityFeedback::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetCardinalityFeedback();
+}
+
+} // namespace duckdb
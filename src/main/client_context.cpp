@@ -2,6 +2,7 @@
 
 #include "duckdb/main/client_context_file_opener.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/scalar_function_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_search_path.hpp"
@@ -11,6 +12,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -154,7 +156,7 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 }
 
 PreservedError ClientContext::EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction) {
-	client_data->profiler->EndQuery();
+	client_data->profiler->EndQuery(success);
 
 	if (client_data->http_stats) {
 		client_data->http_stats->Reset();
@@ -266,6 +268,12 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 		result = executor.GetResult();
 		CleanupInternal(lock, result.get(), false);
 	} else {
+		// capture the table snapshots now: the fetch loop below commits the transaction when it finishes
+		bool cache_result = prepared.result_cacheable && transaction.IsAutoCommit();
+		vector<cached_result_table_t> cache_tables;
+		if (cache_result) {
+			cache_tables = QueryResultCache::GetTableSnapshots(*this, prepared);
+		}
 		// no result collector - create a materialized result by continuously fetching
 		auto result_collection = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), pending.types);
 		D_ASSERT(!result_collection->Types().empty());
@@ -291,6 +299,9 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 #endif
 			collection.Append(append_state, *chunk);
 		}
+		if (cache_result && !materialized_result->HasError()) {
+			db->GetQueryResultCache().StoreResult(*this, prepared, std::move(cache_tables), *materialized_result);
+		}
 		result = std::move(materialized_result);
 	}
 	return result;
@@ -313,6 +324,18 @@ shared_ptr<PreparedStatementData> ClientContext::CreatePreparedStatement(ClientC
 	StatementType statement_type = statement->type;
 	auto result = make_shared<PreparedStatementData>(statement_type);
 
+	// unparameterized SELECT statements are eligible for the result cache, keyed on their exact SQL text
+	if (DBConfig::GetConfig(*this).options.enable_result_cache && !config.AnyVerification() && !values &&
+	    statement_type == StatementType::SELECT_STATEMENT && statement->n_param == 0) {
+		result->cache_query = statement->stmt_length > 0
+		                          ? statement->query.substr(statement->stmt_location, statement->stmt_length)
+		                          : statement->query;
+		// the cache is shared by all connections but the search path is client-local, so the same SQL text
+		// can read different tables: make the resolved path part of the key
+		result->cache_query += '\0';
+		result->cache_query += CatalogSearchEntry::ListToString(client_data->catalog_search_path->Get());
+	}
+
 	auto &profiler = QueryProfiler::Get(*this);
 	profiler.StartQuery(query, IsExplainAnalyze(statement.get()), true);
 	profiler.StartPhase("planner");
@@ -352,6 +375,16 @@ shared_ptr<PreparedStatementData> ClientContext::CreatePreparedStatement(ClientC
 #endif
 	}
 
+	if (!result->cache_query.empty()) {
+		// verify that the plan only reads versioned base tables and has no side effects,
+		// and collect the tables so the cached result can be invalidated when they are written to
+		result->result_cacheable = QueryResultCache::CollectCacheableTables(*plan, result->cache_tables);
+		if (!result->result_cacheable) {
+			result->cache_tables.clear();
+			result->cache_query = string();
+		}
+	}
+
 	profiler.StartPhase("physical_planner");
 	// now convert logical query plan into a physical query plan
 	PhysicalPlanGenerator physical_planner(*this);
@@ -431,6 +464,23 @@ unique_ptr<PendingQueryResult> ClientContext::PendingPreparedStatement(ClientCon
 	return pending_result;
 }
 
+double ClientContext::GetQueryProgress(ClientContextLock &lock) {
+	D_ASSERT(active_query);
+	if (active_query->progress_bar) {
+		// the progress bar already tracks the progress with every executed task
+		return active_query->progress_bar->GetCurrentPercentage();
+	}
+	// no progress bar enabled: compute the progress on demand so polling is free when nobody asks
+	if (!active_query->executor) {
+		return -1;
+	}
+	double progress;
+	if (!active_query->executor->GetPipelinesProgress(progress)) {
+		return -1;
+	}
+	return progress;
+}
+
 PendingExecutionResult ClientContext::ExecuteTaskInternal(ClientContextLock &lock, PendingQueryResult &result) {
 	D_ASSERT(active_query);
 	D_ASSERT(active_query->open_result == &result);
@@ -605,6 +655,33 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        PendingQueryParameters parameters) {
+	// only cache plans of unparameterized SELECT statements, keyed on the exact SQL text of the statement
+	auto &plan_cache = *client_data->plan_cache;
+	string cache_key;
+	if (config.enable_plan_cache && !config.AnyVerification() && !parameters.parameters &&
+	    statement->type == StatementType::SELECT_STATEMENT && statement->n_param == 0) {
+		cache_key = statement->stmt_length > 0
+		                ? statement->query.substr(statement->stmt_location, statement->stmt_length)
+		                : statement->query;
+		// the same SQL text binds to different tables under a different search path, and changing the search
+		// path is client-local (it does not bump the catalog version): make the resolved path part of the key
+		cache_key += '\0';
+		cache_key += CatalogSearchEntry::ListToString(client_data->catalog_search_path->Get());
+	}
+	unique_ptr<SQLStatement> unbound_statement;
+	if (!cache_key.empty()) {
+		auto cached = plan_cache.Get(cache_key);
+		if (cached) {
+			if (!cached->RequireRebind(*this, vector<Value>())) {
+				// we have a valid plan for this exact query: skip parsing, binding and optimizing altogether
+				return PendingPreparedStatement(lock, std::move(cached), parameters);
+			}
+			// the catalog was modified since the plan was created: create a new plan below
+			plan_cache.Remove(cache_key);
+		}
+		// keep the unbound statement around so the cached plan can be rebound after catalog changes
+		unbound_statement = statement->Copy();
+	}
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters);
 	if (prepared->properties.parameter_count > 0 && !parameters.parameters) {
@@ -615,6 +692,11 @@ unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientCon
 	if (!prepared->properties.bound_all_parameters) {
 		return make_unique<PendingQueryResult>(PreservedError("Not all parameters were bound"));
 	}
+	if (unbound_statement && prepared->plan && prepared->properties.IsReadOnly() &&
+	    prepared->properties.parameter_count == 0) {
+		prepared->unbound_statement = std::move(unbound_statement);
+		plan_cache.Put(cache_key, prepared);
+	}
 	// execute the prepared statement
 	return PendingPreparedStatement(lock, std::move(prepared), parameters);
 }
@@ -809,19 +891,32 @@ unique_ptr<QueryResult> ClientContext::Query(const string &query, bool allow_str
 		                                            std::move(collection), GetClientProperties());
 	}
 
+	bool try_result_cache = DBConfig::GetConfig(*this).options.enable_result_cache && !config.AnyVerification() &&
+	                        !transaction.HasActiveTransaction();
 	unique_ptr<QueryResult> result;
 	QueryResult *last_result = nullptr;
 	for (idx_t i = 0; i < statements.size(); i++) {
 		auto &statement = statements[i];
 		bool is_last_statement = i + 1 == statements.size();
-		PendingQueryParameters parameters;
-		parameters.allow_stream_result = allow_stream_result && is_last_statement;
-		auto pending_query = PendingQueryInternal(*lock, std::move(statement), parameters);
 		unique_ptr<QueryResult> current_result;
-		if (pending_query->HasError()) {
-			current_result = make_unique<MaterializedQueryResult>(pending_query->GetErrorObject());
-		} else {
-			current_result = ExecutePendingQueryInternal(*lock, *pending_query);
+		if (try_result_cache && statement->type == StatementType::SELECT_STATEMENT && statement->n_param == 0) {
+			// try to serve the statement from the result cache, skipping planning and execution altogether
+			auto cache_key = statement->stmt_length > 0
+			                     ? statement->query.substr(statement->stmt_location, statement->stmt_length)
+			                     : statement->query;
+			cache_key += '\0';
+			cache_key += CatalogSearchEntry::ListToString(client_data->catalog_search_path->Get());
+			current_result = db->GetQueryResultCache().GetCachedResult(*this, cache_key);
+		}
+		if (!current_result) {
+			PendingQueryParameters parameters;
+			parameters.allow_stream_result = allow_stream_result && is_last_statement;
+			auto pending_query = PendingQueryInternal(*lock, std::move(statement), parameters);
+			if (pending_query->HasError()) {
+				current_result = make_unique<MaterializedQueryResult>(pending_query->GetErrorObject());
+			} else {
+				current_result = ExecutePendingQueryInternal(*lock, *pending_query);
+			}
 		}
 		// now append the result to the list of results
 		if (!last_result) {
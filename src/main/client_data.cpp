@@ -1,6 +1,7 @@
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_context_file_opener.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/common/http_stats.hpp"
 #include "duckdb/common/random_engine.hpp"
@@ -19,6 +20,7 @@ ClientData::ClientData(ClientContext &context) : catalog_search_path(make_unique
 	query_profiler_history = make_unique<QueryProfilerHistory>();
 	temporary_objects = make_shared<AttachedDatabase>(db, AttachedDatabaseType::TEMP_DATABASE);
 	temporary_objects->oid = DatabaseManager::Get(db).ModifyCatalog();
+	plan_cache = make_unique<PlanCache>();
 	random_engine = make_unique<RandomEngine>();
 	file_opener = make_unique<ClientContextFileOpener>(context);
 	temporary_objects->Initialize();
@@ -6,7 +6,9 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/main/cardinality_feedback.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/function/compression_function.hpp"
@@ -165,6 +167,8 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	    make_unique<BufferManager>(*this, config.options.temporary_directory, config.options.maximum_memory);
 	scheduler = make_unique<TaskScheduler>(*this);
 	object_cache = make_unique<ObjectCache>();
+	query_result_cache = make_unique<QueryResultCache>();
+	cardinality_feedback = make_unique<CardinalityFeedback>();
 	connection_manager = make_unique<ConnectionManager>();
 
 	auto database_name = AttachedDatabase::ExtractDatabaseName(config.options.database_path);
@@ -230,6 +234,14 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+QueryResultCache &DatabaseInstance::GetQueryResultCache() {
+	return *query_result_cache;
+}
+
+CardinalityFeedback &DatabaseInstance::GetCardinalityFeedback() {
+	return *cardinality_feedback;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *config.file_system;
 }
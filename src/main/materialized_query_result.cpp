@@ -95,4 +95,22 @@ unique_ptr<DataChunk> MaterializedQueryResult::FetchRaw() {
 	return result;
 }
 
+unique_ptr<DataChunk> MaterializedQueryResult::FetchZeroCopy() {
+	if (HasError()) {
+		throw InvalidInputException("Attempting to fetch from an unsuccessful query result\nError: %s", GetError());
+	}
+	auto result = make_unique<DataChunk>();
+	collection->InitializeScanChunk(*result);
+	if (!scan_initialized) {
+		// allow zero copy scans: the chunk references the collection directly and is only valid until the next fetch
+		collection->InitializeScan(scan_state, ColumnDataScanProperties::ALLOW_ZERO_COPY);
+		scan_initialized = true;
+	}
+	collection->Scan(scan_state, *result);
+	if (result->size() == 0) {
+		return nullptr;
+	}
+	return result;
+}
+
 } // namespace duckdb
@@ -70,6 +70,18 @@ unique_ptr<QueryResult> PendingQueryResult::Execute() {
 	return ExecuteInternal(*lock);
 }
 
+double PendingQueryResult::GetProgress() {
+	auto lock = LockContext();
+	CheckExecutableInternal(*lock);
+	return context->GetQueryProgress(*lock);
+}
+
+void PendingQueryResult::SetCompletionCallback(std::function<void()> callback) {
+	auto lock = LockContext();
+	CheckExecutableInternal(*lock);
+	context->GetExecutor().SetCompletionCallback(std::move(callback));
+}
+
 void PendingQueryResult::Close() {
 	context.reset();
 }
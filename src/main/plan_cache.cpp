@@ -0,0 +1,54 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/main/prepared_statement_data.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache(idx_t capacity_p) : capacity(capacity_p) {
+}
+
+PlanCache::~PlanCache() {
+}
+
+shared_ptr<PreparedStatementData> PlanCache::Get(const string &sql) {
+	auto entry = entry_map.find(sql);
+	if (entry == entry_map.end()) {
+		return nullptr;
+	}
+	// move the entry to the most recently used end of the list
+	entries.splice(entries.end(), entries, entry->second);
+	return entry->second->second;
+}
+
+void PlanCache::Put(const string &sql, shared_ptr<PreparedStatementData> plan) {
+	auto entry = entry_map.find(sql);
+	if (entry != entry_map.end()) {
+		// already cached: replace the plan and mark it as most recently used
+		entries.splice(entries.end(), entries, entry->second);
+		entry->second->second = std::move(plan);
+		return;
+	}
+	if (entries.size() >= capacity) {
+		// cache is full: evict the least recently used plan
+		entry_map.erase(entries.front().first);
+		entries.pop_front();
+	}
+	entries.emplace_back(sql, std::move(plan));
+	entry_map[sql] = --entries.end();
+}
+
+void PlanCache::Remove(const string &sql) {
+	auto entry = entry_map.find(sql);
+	if (entry == entry_map.end()) {
+		return;
+	}
+	entries.erase(entry->second);
+	entry_map.erase(entry);
+}
+
+void PlanCache::Clear() {
+	entries.clear();
+	entry_map.clear();
+}
+
+} // namespace duckdb
@@ -38,6 +38,18 @@ bool PreparedStatementData::RequireRebind(ClientContext &context, const vector<V
 			return true;
 		}
 	}
+	// The cached plan was optimized without knowing the parameter values. A parameter that turns NULL
+	// (or back) folds every comparison it appears in to NULL, so the join orders and pushed-down filters
+	// that were picked for the previous values can be arbitrarily far off. Rebinding re-runs the
+	// optimizer with the new values in place; parameter sets with the same shape as the previous
+	// execution skip straight to the cached plan.
+	if (last_bound_values.size() == values.size()) {
+		for (idx_t i = 0; i < values.size(); i++) {
+			if (values[i].IsNull() != last_bound_values[i].IsNull()) {
+				return true;
+			}
+		}
+	}
 	return false;
 }
 
@@ -60,6 +72,7 @@ void PreparedStatementData::Bind(vector<Value> values) {
 		}
 		it.second->value = values[i];
 	}
+	last_bound_values = std::move(values);
 }
 
 bool PreparedStatementData::TryGetType(idx_t param_idx, LogicalType &result) {
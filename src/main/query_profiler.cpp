@@ -1,4 +1,5 @@
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/common/to_string.hpp"
 #include "duckdb/common/fstream.hpp"
 #include "duckdb/common/printer.hpp"
@@ -6,6 +7,8 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/execution/operator/join/physical_delim_join.hpp"
 #include "duckdb/execution/operator/helper/physical_execute.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/main/cardinality_feedback.hpp"
 #include "duckdb/common/http_stats.hpp"
 #include "duckdb/common/tree_renderer.hpp"
 #include "duckdb/common/limits.hpp"
@@ -118,11 +121,20 @@ void QueryProfiler::Finalize(TreeNode &node) {
 	}
 }
 
+void QueryProfiler::RecordCardinalityFeedback(TreeNode &node) {
+	if (!node.feedback_key.empty()) {
+		CardinalityFeedback::Get(context).RecordCardinality(node.feedback_key, node.info.elements);
+	}
+	for (auto &child : node.children) {
+		RecordCardinalityFeedback(*child);
+	}
+}
+
 void QueryProfiler::StartExplainAnalyze() {
 	this->is_explain_analyze = true;
 }
 
-void QueryProfiler::EndQuery() {
+void QueryProfiler::EndQuery(bool success) {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
 		return;
@@ -131,6 +143,11 @@ void QueryProfiler::EndQuery() {
 	main_query.End();
 	if (root) {
 		Finalize(*root);
+		if (success) {
+			// the query ran to completion: record the observed operator cardinalities so that subsequent plans
+			// containing the same fragments can use them instead of estimates
+			RecordCardinalityFeedback(*root);
+		}
 	}
 	this->running = false;
 	// print or output the query profiling after termination
@@ -222,7 +239,12 @@ void QueryProfiler::Initialize(PhysicalOperator *root_op) {
 	}
 }
 
-OperatorProfiler::OperatorProfiler(bool enabled_p) : enabled(enabled_p), active_operator(nullptr) {
+OperatorProfiler::OperatorProfiler(ClientContext &context) : active_operator(nullptr) {
+	enabled = QueryProfiler::Get(context).IsEnabled();
+	if (enabled && ClientConfig::GetConfig(context).enable_perf_counters) {
+		perf_counters.Initialize();
+	}
+	trace_enabled = enabled && ClientConfig::GetConfig(context).enable_operator_trace;
 }
 
 void OperatorProfiler::StartOperator(const PhysicalOperator *phys_op) {
@@ -236,6 +258,17 @@ void OperatorProfiler::StartOperator(const PhysicalOperator *phys_op) {
 
 	active_operator = phys_op;
 
+	// periodically sample the hardware counters for the current element
+	if (perf_counters.IsActive() && ++invocations_since_sample >= PERF_SAMPLING_RATE) {
+		invocations_since_sample = 0;
+		sampling_counters = true;
+		perf_counters.Begin();
+	}
+	if (trace_enabled) {
+		trace_start = system_clock::now();
+	}
+	memory_start = Allocator::ThreadAllocatedBytes();
+	io_start = ThreadIOCounters::Get();
 	// start timing for current element
 	op.Start();
 }
@@ -252,11 +285,41 @@ void OperatorProfiler::EndOperator(DataChunk *chunk) {
 	// finish timing for the current element
 	op.End();
 
-	AddTiming(active_operator, op.Elapsed(), chunk ? chunk->size() : 0);
+	AddTiming(active_operator, op.Elapsed(), chunk ? chunk->size() : 0,
+	          Allocator::ThreadAllocatedBytes() - memory_start);
+	auto &io_end = ThreadIOCounters::Get();
+	if (io_end.cold_reads != io_start.cold_reads || io_end.cached_reads != io_start.cached_reads ||
+	    io_end.spill_bytes_written != io_start.spill_bytes_written ||
+	    io_end.spill_bytes_read != io_start.spill_bytes_read ||
+	    io_end.decompressed_bytes != io_start.decompressed_bytes) {
+		auto &io = timings[active_operator].io;
+		io.cold_reads += io_end.cold_reads - io_start.cold_reads;
+		io.cached_reads += io_end.cached_reads - io_start.cached_reads;
+		io.spill_bytes_written += io_end.spill_bytes_written - io_start.spill_bytes_written;
+		io.spill_bytes_read += io_end.spill_bytes_read - io_start.spill_bytes_read;
+		io.decompressed_bytes += io_end.decompressed_bytes - io_start.decompressed_bytes;
+	}
+	if (trace_enabled) {
+		if (trace_events.size() < TRACE_BUFFER_CAPACITY) {
+			trace_events.emplace_back(active_operator, trace_start, op.Elapsed(), chunk ? chunk->size() : 0);
+		} else {
+			dropped_trace_events++;
+		}
+	}
+	if (sampling_counters) {
+		sampling_counters = false;
+		perf_counters.End();
+		auto &timing = timings[active_operator];
+		timing.perf_samples++;
+		timing.instructions += perf_counters.instructions;
+		timing.llc_misses += perf_counters.llc_misses;
+		timing.stalled_cycles += perf_counters.stalled_cycles;
+		perf_counters.Reset();
+	}
 	active_operator = nullptr;
 }
 
-void OperatorProfiler::AddTiming(const PhysicalOperator *op, double time, idx_t elements) {
+void OperatorProfiler::AddTiming(const PhysicalOperator *op, double time, idx_t elements, int64_t memory_delta) {
 	if (!enabled) {
 		return;
 	}
@@ -266,12 +329,14 @@ void OperatorProfiler::AddTiming(const PhysicalOperator *op, double time, idx_t
 	auto entry = timings.find(op);
 	if (entry == timings.end()) {
 		// add new entry
-		timings[op] = OperatorInformation(time, elements);
+		entry = timings.emplace(op, OperatorInformation(time, elements)).first;
 	} else {
 		// add to existing entry
 		entry->second.time += time;
 		entry->second.elements += elements;
 	}
+	entry->second.memory_usage += memory_delta;
+	entry->second.memory_peak = MaxValue<int64_t>(entry->second.memory_peak, entry->second.memory_usage);
 }
 void OperatorProfiler::Flush(const PhysicalOperator *phys_op, ExpressionExecutor *expression_executor,
                              const string &name, int id) {
@@ -298,6 +363,18 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 
 		entry->second->info.time += node.second.time;
 		entry->second->info.elements += node.second.elements;
+		entry->second->info.perf_samples += node.second.perf_samples;
+		entry->second->info.instructions += node.second.instructions;
+		entry->second->info.llc_misses += node.second.llc_misses;
+		entry->second->info.stalled_cycles += node.second.stalled_cycles;
+		entry->second->info.memory_usage += node.second.memory_usage;
+		entry->second->info.io.cold_reads += node.second.io.cold_reads;
+		entry->second->info.io.cached_reads += node.second.io.cached_reads;
+		entry->second->info.io.spill_bytes_written += node.second.io.spill_bytes_written;
+		entry->second->info.io.spill_bytes_read += node.second.io.spill_bytes_read;
+		entry->second->info.io.decompressed_bytes += node.second.io.decompressed_bytes;
+		// the per-thread peaks cannot be aligned in time, so the peak over all threads is bounded by their sum
+		entry->second->info.memory_peak += node.second.memory_peak;
 		if (!IsDetailedEnabled()) {
 			continue;
 		}
@@ -313,6 +390,20 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 		}
 	}
 	profiler.timings.clear();
+	if (!profiler.trace_events.empty() || profiler.dropped_trace_events > 0) {
+		// resolve the names of the traced operators while they are still alive - the trace can outlive the query
+		for (auto &event : profiler.trace_events) {
+			auto entry = trace_names.find(event.op);
+			if (entry == trace_names.end()) {
+				auto tree_entry = tree_map.find(event.op);
+				trace_names[event.op] = tree_entry != tree_map.end() ? tree_entry->second->name : event.op->GetName();
+			}
+		}
+		dropped_trace_events += profiler.dropped_trace_events;
+		trace_events.push_back(std::move(profiler.trace_events));
+		profiler.trace_events.clear();
+		profiler.dropped_trace_events = 0;
+	}
 }
 
 static string DrawPadded(const string &str, idx_t width) {
@@ -519,6 +610,20 @@ static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, int
 	ss << string(depth * 3, ' ') << "   \"name\": \"" + JSONSanitize(node.name) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timing\":" + to_string(node.info.time) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"cardinality\":" + to_string(node.info.elements) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"memory_usage\":" + to_string(node.info.memory_usage) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"memory_peak\":" + to_string(node.info.memory_peak) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"cold_reads\":" + to_string(node.info.io.cold_reads) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"cached_reads\":" + to_string(node.info.io.cached_reads) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"spill_bytes_written\":" + to_string(node.info.io.spill_bytes_written) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"spill_bytes_read\":" + to_string(node.info.io.spill_bytes_read) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"decompressed_bytes\":" + to_string(node.info.io.decompressed_bytes) + ",\n";
+	if (node.info.perf_samples > 0) {
+		// hardware counters, summed over the sampled operator invocations
+		ss << string(depth * 3, ' ') << "   \"perf_samples\":" + to_string(node.info.perf_samples) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"instructions\":" + to_string(node.info.instructions) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"llc_misses\":" + to_string(node.info.llc_misses) + ",\n";
+		ss << string(depth * 3, ' ') << "   \"stalled_cycles\":" + to_string(node.info.stalled_cycles) + ",\n";
+	}
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" + JSONSanitize(node.extra_info) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timings\": [";
 	int32_t function_counter = 1;
@@ -598,6 +703,31 @@ string QueryProfiler::ToJSON() const {
 	return ss.str();
 }
 
+string QueryProfiler::TraceToChromeJSON() const {
+	std::stringstream ss;
+	ss << "[";
+	bool first = true;
+	for (idx_t thread_idx = 0; thread_idx < trace_events.size(); thread_idx++) {
+		for (auto &event : trace_events[thread_idx]) {
+			if (!first) {
+				ss << ",";
+			}
+			first = false;
+			auto entry = trace_names.find(event.op);
+			auto name = entry != trace_names.end() ? entry->second : string("UNKNOWN");
+			auto start_us =
+			    std::chrono::duration_cast<std::chrono::microseconds>(event.start.time_since_epoch()).count();
+			ss << "\n{\"name\": \"" << JSONSanitize(name) << "\", \"cat\": \"operator\", \"ph\": \"X\", \"pid\": 0";
+			ss << ", \"tid\": " << thread_idx + 1;
+			ss << ", \"ts\": " << start_us;
+			ss << ", \"dur\": " << uint64_t(event.time * 1000000);
+			ss << ", \"args\": {\"tuples\": " << event.elements << "}}";
+		}
+	}
+	ss << "\n]\n";
+	return ss.str();
+}
+
 void QueryProfiler::WriteToFile(const char *path, string &info) const {
 	ofstream out(path);
 	out << info;
@@ -616,6 +746,12 @@ unique_ptr<QueryProfiler::TreeNode> QueryProfiler::CreateTree(PhysicalOperator *
 	node->type = root->type;
 	node->name = root->GetName();
 	node->extra_info = root->ParamsToString();
+	if (root->type == PhysicalOperatorType::TABLE_SCAN) {
+		auto &scan = (PhysicalTableScan &)*root;
+		node->feedback_key =
+		    CardinalityFeedback::ScanKey(scan.function, scan.bind_data.get(), scan.table_filters.get(),
+		                                 &scan.column_ids);
+	}
 	node->depth = depth;
 	tree_map[root] = node.get();
 	auto children = root->GetChildren();
@@ -0,0 +1,216 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Cacheability
+//===--------------------------------------------------------------------===//
+static bool ExpressionIsDeterministic(Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_FUNCTION) {
+		auto &func = (BoundFunctionExpression &)expr;
+		if (func.function.side_effects == FunctionSideEffects::HAS_SIDE_EFFECTS) {
+			return false;
+		}
+	}
+	bool result = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+		if (!ExpressionIsDeterministic(child)) {
+			result = false;
+		}
+	});
+	return result;
+}
+
+bool QueryResultCache::CollectCacheableTables(LogicalOperator &op, vector<shared_ptr<DataTableInfo>> &tables) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = (LogicalGet &)op;
+		if (get.function.name != "seq_scan") {
+			// not a base table scan: we cannot track versions of e.g. table functions
+			return false;
+		}
+		auto &bind_data = (TableScanBindData &)*get.bind_data;
+		auto &storage = *bind_data.table->storage;
+		if (storage.info->IsTemporary()) {
+			// temporary tables are connection-local: their contents must not be served to others
+			return false;
+		}
+		tables.push_back(storage.info);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		// sampling is non-deterministic
+		return false;
+	default:
+		break;
+	}
+	// walk all expression members of the operator, not just op.expressions: aggregate groups and join
+	// conditions live in separate members and can contain side-effect functions just as well
+	bool deterministic = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *child) {
+		if (!ExpressionIsDeterministic(**child)) {
+			deterministic = false;
+		}
+	});
+	if (!deterministic) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!CollectCacheableTables(*child, tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Result Copying
+//===--------------------------------------------------------------------===//
+static idx_t EstimateChunkSize(DataChunk &chunk) {
+	idx_t result = 0;
+	for (auto &vec : chunk.data) {
+		auto physical_type = vec.GetType().InternalType();
+		result += GetTypeIdSize(physical_type) * chunk.size();
+		if (physical_type == PhysicalType::VARCHAR) {
+			auto strings = FlatVector::GetData<string_t>(vec);
+			auto &mask = FlatVector::Validity(vec);
+			for (idx_t i = 0; i < chunk.size(); i++) {
+				if (mask.RowIsValid(i) && !strings[i].IsInlined()) {
+					result += strings[i].GetSize();
+				}
+			}
+		}
+	}
+	return result;
+}
+
+unique_ptr<ColumnDataCollection> QueryResultCache::CopyCollection(const ColumnDataCollection &collection,
+                                                                  idx_t &size) {
+	auto result = make_unique<ColumnDataCollection>(Allocator::DefaultAllocator(), collection.Types());
+	ColumnDataAppendState append_state;
+	result->InitializeAppend(append_state);
+
+	DataChunk chunk;
+	ColumnDataScanState scan_state;
+	collection.InitializeScan(scan_state);
+	collection.InitializeScanChunk(chunk);
+	size = 0;
+	while (collection.Scan(scan_state, chunk)) {
+		size += EstimateChunkSize(chunk);
+		result->Append(append_state, chunk);
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Lookup
+//===--------------------------------------------------------------------===//
+bool QueryResultCache::EntryIsValid(ClientContext &context, CachedResult &entry) {
+	if (Catalog::GetSystemCatalog(context).GetCatalogVersion() != entry.catalog_version) {
+		// the catalog changed: a referenced table may have been altered or dropped
+		return false;
+	}
+	for (auto &table : entry.tables) {
+		if (table.first->last_write_version >= table.second) {
+			// a write to this table committed after the snapshot that produced the result
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<QueryResult> QueryResultCache::GetCachedResult(ClientContext &context, const string &query) {
+	lock_guard<mutex> guard(lock);
+	auto it = entry_map.find(query);
+	if (it == entry_map.end()) {
+		return nullptr;
+	}
+	auto entry_it = it->second;
+	if (!EntryIsValid(context, *entry_it)) {
+		// a referenced table was written to: drop the stale entry
+		current_size -= entry_it->size;
+		entries.erase(entry_it);
+		entry_map.erase(it);
+		return nullptr;
+	}
+	// valid hit: move the entry to the front of the LRU list and serve a copy of the result
+	entries.splice(entries.begin(), entries, entry_it);
+	idx_t copy_size;
+	auto collection = CopyCollection(*entry_it->collection, copy_size);
+	return make_unique<MaterializedQueryResult>(StatementType::SELECT_STATEMENT, entry_it->properties,
+	                                            entry_it->names, std::move(collection),
+	                                            context.GetClientProperties());
+}
+
+//===--------------------------------------------------------------------===//
+// Storing
+//===--------------------------------------------------------------------===//
+void QueryResultCache::Evict() {
+	while (current_size > MAXIMUM_CACHE_SIZE && !entries.empty()) {
+		auto &victim = entries.back();
+		current_size -= victim.size;
+		entry_map.erase(victim.query);
+		entries.pop_back();
+	}
+}
+
+vector<cached_result_table_t> QueryResultCache::GetTableSnapshots(ClientContext &context,
+                                                                  PreparedStatementData &statement) {
+	vector<cached_result_table_t> result;
+	for (auto &table : statement.cache_tables) {
+		// the snapshot of this transaction in the database the table belongs to:
+		// writes committed before it are part of the result, writes after it invalidate the entry
+		auto &transaction = Transaction::Get(context, table->db);
+		result.emplace_back(table, transaction.start_time);
+	}
+	return result;
+}
+
+void QueryResultCache::StoreResult(ClientContext &context, PreparedStatementData &statement,
+                                   vector<cached_result_table_t> tables, MaterializedQueryResult &result) {
+	for (auto &type : result.types) {
+		auto physical_type = type.InternalType();
+		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
+			// nested result types are not cached: their size cannot be estimated cheaply
+			return;
+		}
+	}
+	CachedResult entry;
+	entry.query = statement.cache_query;
+	entry.catalog_version = statement.catalog_version;
+	entry.tables = std::move(tables);
+	entry.properties = statement.properties;
+	entry.names = result.names;
+	entry.collection = CopyCollection(result.Collection(), entry.size);
+	if (entry.size > MAXIMUM_ENTRY_SIZE) {
+		return;
+	}
+
+	lock_guard<mutex> guard(lock);
+	auto it = entry_map.find(entry.query);
+	if (it != entry_map.end()) {
+		// the query was cached concurrently: replace the old entry
+		current_size -= it->second->size;
+		entries.erase(it->second);
+		entry_map.erase(it);
+	}
+	current_size += entry.size;
+	entries.push_front(std::move(entry));
+	entry_map[entries.front().query] = entries.begin();
+	Evict();
+}
+
+} // namespace duckdb
@@ -5,11 +5,13 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -316,6 +318,38 @@ Value EnableExternalAccessSetting::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_external_access);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Result Cache
+//===--------------------------------------------------------------------===//
+void EnableResultCache::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_result_cache = input.GetValue<bool>();
+}
+
+void EnableResultCache::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_result_cache = DBConfig().options.enable_result_cache;
+}
+
+Value EnableResultCache::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_result_cache);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Dictionary Cache
+//===--------------------------------------------------------------------===//
+void EnableDictionaryCache::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_dictionary_cache = input.GetValue<bool>();
+}
+
+void EnableDictionaryCache::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_dictionary_cache = DBConfig().options.enable_dictionary_cache;
+}
+
+Value EnableDictionaryCache::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_dictionary_cache);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable FSST Vectors
 //===--------------------------------------------------------------------===//
@@ -387,6 +421,89 @@ Value EnableHTTPMetadataCacheSetting::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(config.options.http_metadata_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Operator Trace
+//===--------------------------------------------------------------------===//
+void EnableOperatorTraceSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_operator_trace = ClientConfig().enable_operator_trace;
+}
+
+void EnableOperatorTraceSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_operator_trace = input.GetValue<bool>();
+}
+
+Value EnableOperatorTraceSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_operator_trace);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Perf Counters
+//===--------------------------------------------------------------------===//
+void EnablePerfCountersSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_perf_counters = ClientConfig().enable_perf_counters;
+}
+
+void EnablePerfCountersSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_perf_counters = input.GetValue<bool>();
+}
+
+Value EnablePerfCountersSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_perf_counters);
+}
+
+//===--------------------------------------------------------------------===//
+// Priority
+//===--------------------------------------------------------------------===//
+void PrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).scheduler_priority = ClientConfig().scheduler_priority;
+}
+
+void PrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	TaskPriority priority;
+	if (parameter == "low") {
+		priority = TaskPriority::LOW;
+	} else if (parameter == "normal") {
+		priority = TaskPriority::NORMAL;
+	} else if (parameter == "high") {
+		priority = TaskPriority::HIGH;
+	} else {
+		throw ParserException("Unrecognized priority \"%s\", expected low, normal or high", parameter);
+	}
+	ClientConfig::GetConfig(context).scheduler_priority = priority;
+}
+
+Value PrioritySetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).scheduler_priority) {
+	case TaskPriority::LOW:
+		return Value("low");
+	case TaskPriority::HIGH:
+		return Value("high");
+	default:
+		return Value("normal");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Plan Cache
+//===--------------------------------------------------------------------===//
+void EnablePlanCacheSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_plan_cache = ClientConfig().enable_plan_cache;
+}
+
+void EnablePlanCacheSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.enable_plan_cache = input.GetValue<bool>();
+	if (!config.enable_plan_cache) {
+		// drop any cached plans when the cache is disabled
+		ClientData::Get(context).plan_cache->Clear();
+	}
+}
+
+Value EnablePlanCacheSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_plan_cache);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable Profiling
 //===--------------------------------------------------------------------===//
@@ -588,7 +705,7 @@ void ForceBitpackingModeSetting::SetGlobal(DatabaseInstance *db, DBConfig &confi
 		if (mode == BitpackingMode::AUTO) {
 			throw ParserException(
 			    "Unrecognized option for force_bitpacking_mode, expected none, constant, constant_delta, "
-			    "delta_for, or for");
+			    "delta_for, delta_delta_for, or for");
 		}
 		config.options.force_bitpacking_mode = mode;
 	}
@@ -734,6 +851,45 @@ Value PerfectHashThresholdSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).perfect_ht_threshold);
 }
 
+//===--------------------------------------------------------------------===//
+// Row Group Size
+//===--------------------------------------------------------------------===//
+void RowGroupSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto row_group_size = input.GetValue<idx_t>();
+	if (row_group_size == 0 || row_group_size % STANDARD_VECTOR_SIZE != 0) {
+		throw InvalidInputException("Row group size must be a non-zero multiple of the vector size (%lld)",
+		                            STANDARD_VECTOR_SIZE);
+	}
+	if (row_group_size > RowGroup::ROW_GROUP_SIZE) {
+		throw InvalidInputException("Row group size cannot exceed the compiled maximum of %lld rows",
+		                            RowGroup::ROW_GROUP_SIZE);
+	}
+	config.options.row_group_size = row_group_size;
+}
+
+void RowGroupSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.row_group_size = DBConfig().options.row_group_size;
+}
+
+Value RowGroupSizeSetting::GetSetting(ClientContext &context) {
+	return Value::UBIGINT(DBConfig::GetConfig(context).options.row_group_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Bulk Append
+//===--------------------------------------------------------------------===//
+void BulkAppendSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).bulk_append = input.GetValue<bool>();
+}
+
+void BulkAppendSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).bulk_append = ClientConfig().bulk_append;
+}
+
+Value BulkAppendSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).bulk_append);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -859,6 +1015,62 @@ Value ProgressBarTimeSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (limit == DConstants::INVALID_INDEX) {
+		// no per-query limit: only the global memory limit applies
+		limit = 0;
+	}
+	ClientConfig::GetConfig(context).query_memory_limit = limit;
+}
+
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.query_memory_limit == 0) {
+		return Value("");
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Remote File Cache Directory
+//===--------------------------------------------------------------------===//
+void RemoteFileCacheDirectorySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.remote_file_cache_directory = input.ToString();
+}
+
+void RemoteFileCacheDirectorySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.remote_file_cache_directory = DBConfig().options.remote_file_cache_directory;
+}
+
+Value RemoteFileCacheDirectorySetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.remote_file_cache_directory);
+}
+
+//===--------------------------------------------------------------------===//
+// Remote File Cache Size
+//===--------------------------------------------------------------------===//
+void RemoteFileCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.remote_file_cache_size = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void RemoteFileCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.remote_file_cache_size = DBConfig().options.remote_file_cache_size;
+}
+
+Value RemoteFileCacheSizeSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BIGINT(config.options.remote_file_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -900,6 +1112,21 @@ Value SearchPathSetting::GetSetting(ClientContext &context) {
 	return Value(CatalogSearchEntry::ListToString(set_paths));
 }
 
+//===--------------------------------------------------------------------===//
+// Streaming Prefetch Depth
+//===--------------------------------------------------------------------===//
+void StreamingPrefetchDepthSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).streaming_prefetch_depth = input.GetValue<uint64_t>();
+}
+
+void StreamingPrefetchDepthSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).streaming_prefetch_depth = ClientConfig().streaming_prefetch_depth;
+}
+
+Value StreamingPrefetchDepthSetting::GetSetting(ClientContext &context) {
+	return Value::BIGINT(ClientConfig::GetConfig(context).streaming_prefetch_depth);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -926,6 +1153,22 @@ Value TempDirectorySetting::GetSetting(ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -945,6 +1188,38 @@ Value ThreadsSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(config.options.maximum_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Compression
+//===--------------------------------------------------------------------===//
+void WalCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_compression = input.GetValue<bool>();
+}
+
+void WalCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_compression = DBConfig().options.wal_compression;
+}
+
+Value WalCompressionSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_compression);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Delay
+//===--------------------------------------------------------------------===//
+void WalGroupCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit_delay = input.GetValue<int64_t>();
+}
+
+void WalGroupCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_delay = DBConfig().options.wal_group_commit_delay;
+}
+
+Value WalGroupCommitDelaySetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BIGINT(config.options.wal_group_commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Username Setting
 //===--------------------------------------------------------------------===//
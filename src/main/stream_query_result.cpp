@@ -1,11 +1,99 @@
 #include "duckdb/main/stream_query_result.hpp"
 
+#include "duckdb/common/box_renderer.hpp"
+#include "duckdb/common/queue.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
-#include "duckdb/common/box_renderer.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
+//! State shared between a StreamQueryResult and its background prefetch task
+struct StreamQueryPrefetchState {
+	StreamQueryPrefetchState() : stop_requested(false), finished(false) {
+	}
+
+	//! Lock protecting the queue of prefetched chunks and the error
+	mutex queue_lock;
+	//! Signalled whenever a chunk is pushed or popped, the task finishes, or a stop is requested; the producer blocks
+	//! on this while the queue is full and the consumer while it is empty
+	std::condition_variable queue_cv;
+	//! The prefetched chunks, in result order
+	queue<unique_ptr<DataChunk>> chunks;
+	//! The maximum amount of chunks to prefetch ahead of the client
+	idx_t prefetch_depth = 0;
+	//! Lock held by the task while it fetches from the result; used to safely stop the task
+	mutex fetch_lock;
+	//! Set when the result is closed or destroyed: the task must stop touching the result
+	atomic<bool> stop_requested;
+	//! Set by the task when the result is exhausted or the task has stopped
+	atomic<bool> finished;
+	//! The error that occurred while prefetching (if any)
+	PreservedError error;
+};
+
+class StreamPrefetchTask : public Task {
+public:
+	StreamPrefetchTask(shared_ptr<StreamQueryPrefetchState> state_p, shared_ptr<ClientContext> context_p,
+	                   StreamQueryResult &result_p)
+	    : state(std::move(state_p)), context(std::move(context_p)), result(result_p) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		while (!state->stop_requested) {
+			{
+				// if the client has fallen behind, block until there is room in the queue again
+				unique_lock<mutex> guard(state->queue_lock);
+				state->queue_cv.wait(guard, [&] {
+					return state->chunks.size() < state->prefetch_depth || state->stop_requested;
+				});
+			}
+			if (state->stop_requested) {
+				break;
+			}
+			unique_ptr<DataChunk> chunk;
+			try {
+				// the fetch lock guarantees the result is not closed or destroyed while we are fetching from it
+				lock_guard<mutex> guard(state->fetch_lock);
+				if (state->stop_requested) {
+					break;
+				}
+				chunk = result.FetchNextChunk();
+			} catch (std::exception &ex) {
+				lock_guard<mutex> guard(state->queue_lock);
+				state->error = PreservedError(ex);
+				break;
+			} catch (...) { // LCOV_EXCL_START
+				lock_guard<mutex> guard(state->queue_lock);
+				state->error = PreservedError("Unknown error while prefetching from stream query result");
+				break;
+			} // LCOV_EXCL_STOP
+			if (!chunk || chunk->size() == 0) {
+				break;
+			}
+			{
+				lock_guard<mutex> guard(state->queue_lock);
+				state->chunks.push(std::move(chunk));
+			}
+			state->queue_cv.notify_all();
+		}
+		{
+			// set under the lock so a consumer cannot miss the wakeup between checking the flag and blocking
+			lock_guard<mutex> guard(state->queue_lock);
+			state->finished = true;
+		}
+		state->queue_cv.notify_all();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<StreamQueryPrefetchState> state;
+	shared_ptr<ClientContext> context;
+	StreamQueryResult &result;
+};
+
 StreamQueryResult::StreamQueryResult(StatementType statement_type, StatementProperties properties,
                                      shared_ptr<ClientContext> context_p, vector<LogicalType> types,
                                      vector<string> names)
@@ -16,6 +104,7 @@ StreamQueryResult::StreamQueryResult(StatementType statement_type, StatementProp
 }
 
 StreamQueryResult::~StreamQueryResult() {
+	StopPrefetch();
 }
 
 string StreamQueryResult::ToString() {
@@ -50,7 +139,78 @@ void StreamQueryResult::CheckExecutableInternal(ClientContextLock &lock) {
 	}
 }
 
+unique_ptr<DataChunk> StreamQueryResult::FetchNextChunk() {
+	auto lock = LockContext();
+	CheckExecutableInternal(*lock);
+	return context->Fetch(*lock, *this);
+}
+
+void StreamQueryResult::InitializePrefetch() {
+	if (!context) {
+		return;
+	}
+	auto prefetch_depth = ClientConfig::GetConfig(*context).streaming_prefetch_depth;
+	if (prefetch_depth == 0) {
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(*context);
+	if (scheduler.NumberOfThreads() <= 1) {
+		// there are no background threads to run the prefetch task on
+		return;
+	}
+	prefetch_state = make_shared<StreamQueryPrefetchState>();
+	prefetch_state->prefetch_depth = prefetch_depth;
+	prefetch_producer = scheduler.CreateProducer();
+	scheduler.ScheduleTask(*prefetch_producer, make_unique<StreamPrefetchTask>(prefetch_state, context, *this));
+}
+
+unique_ptr<DataChunk> StreamQueryResult::FetchPrefetched() {
+	auto &state = *prefetch_state;
+	unique_ptr<DataChunk> chunk;
+	{
+		// the queue may be empty while the task is still running - block until the next chunk arrives
+		unique_lock<mutex> guard(state.queue_lock);
+		state.queue_cv.wait(guard, [&] { return !state.chunks.empty() || state.finished; });
+		if (!state.chunks.empty()) {
+			chunk = std::move(state.chunks.front());
+			state.chunks.pop();
+		}
+	}
+	if (chunk) {
+		// there is room in the queue again - wake up the task if it was blocked on a full queue
+		state.queue_cv.notify_all();
+		return chunk;
+	}
+	if (state.error && !HasError()) {
+		SetError(state.error);
+	}
+	Close();
+	return nullptr;
+}
+
+void StreamQueryResult::StopPrefetch() {
+	if (!prefetch_state) {
+		return;
+	}
+	{
+		// set under the queue lock so the task cannot miss the wakeup if it is about to block on a full queue
+		lock_guard<mutex> guard(prefetch_state->queue_lock);
+		prefetch_state->stop_requested = true;
+	}
+	prefetch_state->queue_cv.notify_all();
+	// acquiring the fetch lock guarantees any in-progress fetch has finished; afterwards the task only sees
+	// stop_requested and never touches this result again
+	lock_guard<mutex> guard(prefetch_state->fetch_lock);
+}
+
 unique_ptr<DataChunk> StreamQueryResult::FetchRaw() {
+	if (!prefetch_initialized) {
+		prefetch_initialized = true;
+		InitializePrefetch();
+	}
+	if (prefetch_state) {
+		return FetchPrefetched();
+	}
 	unique_ptr<DataChunk> chunk;
 	{
 		auto lock = LockContext();
@@ -104,6 +264,7 @@ bool StreamQueryResult::IsOpen() {
 }
 
 void StreamQueryResult::Close() {
+	StopPrefetch();
 	context.reset();
 }
 
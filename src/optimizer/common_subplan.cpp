@@ -0,0 +1,395 @@
+#include "duckdb/optimizer/common_subplan.hpp"
+
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/list.hpp"
+#include "duckdb/planner/operator/logical_materialize.hpp"
+#include "duckdb/planner/operator/logical_materialize_scan.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Canonicalization
+//===--------------------------------------------------------------------===//
+//! The CommonSubplanCanonicalizer computes a canonical serialization of a subplan: the serialized subplan
+//! with all table indexes renumbered in traversal order. Two subplans are structurally identical - and
+//! therefore produce the same result - if and only if their canonical serializations are byte-identical,
+//! even though the indexes assigned during binding differ between (inlined) copies of the same subquery.
+class CommonSubplanCanonicalizer : public LogicalOperatorVisitor {
+public:
+	//! Analysis result for a single subplan
+	struct SubplanInfo {
+		//! Whether the subplan is eligible for materialization at all
+		bool eligible = true;
+		//! The number of operators in the subplan
+		idx_t operator_count = 0;
+		//! Whether the subplan contains an operator that is worth avoiding re-execution of
+		//! (a join, aggregate, window, distinct, sort or set operation)
+		bool has_blocking_operator = false;
+	};
+
+public:
+	//! Analyze a subplan: check eligibility and gather the operator counts
+	SubplanInfo Analyze(LogicalOperator &op);
+	//! Compute the canonical serialization of an (eligible) subplan
+	//! Returns false if the subplan turns out not to be self-contained or cannot be serialized
+	bool GetCanonicalSignature(LogicalOperator &op, string &signature);
+
+protected:
+	void VisitOperator(LogicalOperator &op) override;
+	unique_ptr<Expression> VisitReplace(BoundColumnRefExpression &expr, unique_ptr<Expression> *expr_ptr) override;
+	unique_ptr<Expression> VisitReplace(BoundFunctionExpression &expr, unique_ptr<Expression> *expr_ptr) override;
+
+private:
+	enum class CanonicalizeMode { ANALYZE, CHECK_REFERENCES, APPLY };
+
+	//! Handle a table index defined by an operator in the subplan, depending on the current mode
+	void HandleIndex(idx_t &index);
+	//! Handle the table indexes of the given operator (see HandleIndex)
+	void HandleOperatorIndexes(LogicalOperator &op);
+
+private:
+	//! The current mode of the traversal
+	CanonicalizeMode mode;
+	//! The analysis result (ANALYZE mode)
+	SubplanInfo info;
+	//! The table indexes defined within the subplan, in traversal order (ANALYZE mode)
+	vector<idx_t> defined_indexes;
+	//! The index mapping that is checked (CHECK_REFERENCES) or applied (APPLY)
+	unordered_map<idx_t, idx_t> index_map;
+};
+
+static bool IsBlockingOperator(LogicalOperatorType type) {
+	switch (type) {
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+	case LogicalOperatorType::LOGICAL_WINDOW:
+	case LogicalOperatorType::LOGICAL_DISTINCT:
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+	case LogicalOperatorType::LOGICAL_TOP_N:
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_ANY_JOIN:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+	case LogicalOperatorType::LOGICAL_POSITIONAL_JOIN:
+	case LogicalOperatorType::LOGICAL_UNION:
+	case LogicalOperatorType::LOGICAL_EXCEPT:
+	case LogicalOperatorType::LOGICAL_INTERSECT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void CommonSubplanCanonicalizer::HandleIndex(idx_t &index) {
+	if (mode == CanonicalizeMode::ANALYZE) {
+		defined_indexes.push_back(index);
+		return;
+	}
+	D_ASSERT(mode == CanonicalizeMode::APPLY);
+	auto entry = index_map.find(index);
+	D_ASSERT(entry != index_map.end());
+	index = entry->second;
+}
+
+void CommonSubplanCanonicalizer::HandleOperatorIndexes(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET:
+		HandleIndex(((LogicalGet &)op).table_index);
+		break;
+	case LogicalOperatorType::LOGICAL_CHUNK_GET:
+		HandleIndex(((LogicalColumnDataGet &)op).table_index);
+		break;
+	case LogicalOperatorType::LOGICAL_EXPRESSION_GET:
+		HandleIndex(((LogicalExpressionGet &)op).table_index);
+		break;
+	case LogicalOperatorType::LOGICAL_DUMMY_SCAN:
+		HandleIndex(((LogicalDummyScan &)op).table_index);
+		break;
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+		HandleIndex(((LogicalProjection &)op).table_index);
+		break;
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		auto &aggr = (LogicalAggregate &)op;
+		HandleIndex(aggr.group_index);
+		HandleIndex(aggr.aggregate_index);
+		HandleIndex(aggr.groupings_index);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_WINDOW:
+		HandleIndex(((LogicalWindow &)op).window_index);
+		break;
+	case LogicalOperatorType::LOGICAL_UNNEST:
+		HandleIndex(((LogicalUnnest &)op).unnest_index);
+		break;
+	case LogicalOperatorType::LOGICAL_UNION:
+	case LogicalOperatorType::LOGICAL_EXCEPT:
+	case LogicalOperatorType::LOGICAL_INTERSECT:
+		HandleIndex(((LogicalSetOperation &)op).table_index);
+		break;
+	case LogicalOperatorType::LOGICAL_DELIM_GET:
+	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
+	case LogicalOperatorType::LOGICAL_CTE_REF:
+	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE:
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+	case LogicalOperatorType::LOGICAL_EMPTY_RESULT:
+	case LogicalOperatorType::LOGICAL_MATERIALIZE:
+	case LogicalOperatorType::LOGICAL_MATERIALIZE_SCAN:
+		// delim joins and CTEs introduce dependencies that a materialization would break,
+		// sampling is non-deterministic, and empty results carry bindings that are defined elsewhere
+		info.eligible = false;
+		break;
+	default:
+		if (!op.GetTableIndex().empty()) {
+			// an operator that defines a table index we do not know how to renumber
+			info.eligible = false;
+		}
+		break;
+	}
+}
+
+void CommonSubplanCanonicalizer::VisitOperator(LogicalOperator &op) {
+	if (mode == CanonicalizeMode::ANALYZE) {
+		info.operator_count++;
+		if (IsBlockingOperator(op.type)) {
+			info.has_blocking_operator = true;
+		}
+	}
+	if (mode != CanonicalizeMode::CHECK_REFERENCES) {
+		HandleOperatorIndexes(op);
+	}
+	if (!info.eligible) {
+		return;
+	}
+	VisitOperatorExpressions(op);
+	VisitOperatorChildren(op);
+}
+
+unique_ptr<Expression> CommonSubplanCanonicalizer::VisitReplace(BoundColumnRefExpression &expr,
+                                                                unique_ptr<Expression> *expr_ptr) {
+	switch (mode) {
+	case CanonicalizeMode::CHECK_REFERENCES: {
+		if (index_map.find(expr.binding.table_index) == index_map.end()) {
+			// reference to a column that is not defined within the subplan: not self-contained
+			info.eligible = false;
+		}
+		break;
+	}
+	case CanonicalizeMode::APPLY: {
+		auto entry = index_map.find(expr.binding.table_index);
+		D_ASSERT(entry != index_map.end());
+		expr.binding.table_index = entry->second;
+		break;
+	}
+	default:
+		break;
+	}
+	return nullptr;
+}
+
+unique_ptr<Expression> CommonSubplanCanonicalizer::VisitReplace(BoundFunctionExpression &expr,
+                                                                unique_ptr<Expression> *expr_ptr) {
+	if (mode == CanonicalizeMode::ANALYZE &&
+	    expr.function.side_effects == FunctionSideEffects::HAS_SIDE_EFFECTS) {
+		// executing the subplan once instead of once per occurrence changes the result of e.g. random()
+		info.eligible = false;
+	}
+	return nullptr;
+}
+
+CommonSubplanCanonicalizer::SubplanInfo CommonSubplanCanonicalizer::Analyze(LogicalOperator &op) {
+	info = SubplanInfo();
+	defined_indexes.clear();
+	mode = CanonicalizeMode::ANALYZE;
+	VisitOperator(op);
+	return info;
+}
+
+bool CommonSubplanCanonicalizer::GetCanonicalSignature(LogicalOperator &op, string &signature) {
+	if (!Analyze(op).eligible) {
+		return false;
+	}
+	// number the defined table indexes in traversal order
+	index_map.clear();
+	for (auto &index : defined_indexes) {
+		if (index_map.find(index) != index_map.end()) {
+			// the same index is defined twice: should not happen, bail out to be safe
+			return false;
+		}
+		auto ordinal = index_map.size();
+		index_map[index] = ordinal;
+	}
+	// verify that every column reference resolves within the subplan before we start rewriting
+	mode = CanonicalizeMode::CHECK_REFERENCES;
+	VisitOperator(op);
+	if (!info.eligible) {
+		return false;
+	}
+	// temporarily renumber the indexes to their canonical values and serialize the subplan
+	mode = CanonicalizeMode::APPLY;
+	VisitOperator(op);
+	bool success = true;
+	BufferedSerializer serializer;
+	try {
+		op.Serialize(serializer);
+	} catch (std::exception &ex) {
+		// not all operators support serialization: simply skip those subplans
+		success = false;
+	}
+	// restore the original indexes
+	unordered_map<idx_t, idx_t> inverse_map;
+	for (auto &entry : index_map) {
+		inverse_map[entry.second] = entry.first;
+	}
+	index_map = std::move(inverse_map);
+	VisitOperator(op);
+
+	if (!success) {
+		return false;
+	}
+	auto data = serializer.GetData();
+	signature = string((const char *)data.data.get(), data.size);
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Optimize
+//===--------------------------------------------------------------------===//
+CommonSubplanOptimizer::CommonSubplanOptimizer(ClientContext &context, Binder &binder)
+    : context(context), binder(binder) {
+}
+
+struct CommonSubplanCandidate {
+	CommonSubplanCandidate(LogicalOperator *op, idx_t operator_count) : op(op), operator_count(operator_count) {
+	}
+
+	LogicalOperator *op;
+	idx_t operator_count;
+};
+
+struct CommonSubplanGroup {
+	vector<LogicalOperator *> occurrences;
+	idx_t operator_count = 0;
+};
+
+//! Collect the subplans that are worth materializing if they occur more than once
+static void CollectCandidates(ClientContext &context, CommonSubplanCanonicalizer &canonicalizer, LogicalOperator &op,
+                              vector<CommonSubplanCandidate> &candidates) {
+	for (auto &child : op.children) {
+		auto info = canonicalizer.Analyze(*child);
+		if (info.eligible && info.has_blocking_operator &&
+		    child->EstimateCardinality(context) <= CommonSubplanOptimizer::MAXIMUM_MATERIALIZE_CARDINALITY) {
+			candidates.emplace_back(child.get(), info.operator_count);
+		}
+		CollectCandidates(context, canonicalizer, *child, candidates);
+	}
+}
+
+//! Find the plan slots that hold an occurrence of the given group
+//! Occurrences are re-located by walking the plan, as applying a previous group may have removed some of them
+static void FindOccurrences(unique_ptr<LogicalOperator> &op, const unordered_set<LogicalOperator *> &occurrences,
+                            vector<unique_ptr<LogicalOperator> *> &result) {
+	if (occurrences.find(op.get()) != occurrences.end()) {
+		// occurrences of a group are disjoint: no need to recurse into a match
+		result.push_back(&op);
+		return;
+	}
+	for (auto &child : op->children) {
+		FindOccurrences(child, occurrences, result);
+	}
+}
+
+unique_ptr<LogicalOperator> CommonSubplanOptimizer::Optimize(unique_ptr<LogicalOperator> plan) {
+	// make sure the types of all operators are resolved: the scans that replace an occurrence take them over
+	plan->ResolveOperatorTypes();
+
+	CommonSubplanCanonicalizer canonicalizer;
+
+	// collect the subplans that are worth materializing (the root itself can never occur twice)
+	vector<CommonSubplanCandidate> candidates;
+	CollectCandidates(context, canonicalizer, *plan, candidates);
+
+	// cheap pre-grouping: subplans can only be identical if they have the same root type and operator count
+	map<pair<LogicalOperatorType, idx_t>, idx_t> shape_counts;
+	for (auto &candidate : candidates) {
+		shape_counts[make_pair(candidate.op->type, candidate.operator_count)]++;
+	}
+
+	// group the remaining candidates by their canonical serialization
+	unordered_map<string, CommonSubplanGroup> groups;
+	for (auto &candidate : candidates) {
+		if (shape_counts[make_pair(candidate.op->type, candidate.operator_count)] < 2) {
+			continue;
+		}
+		string signature;
+		if (!canonicalizer.GetCanonicalSignature(*candidate.op, signature)) {
+			continue;
+		}
+		auto &group = groups[std::move(signature)];
+		group.occurrences.push_back(candidate.op);
+		group.operator_count = candidate.operator_count;
+	}
+
+	// materialize the groups with multiple occurrences, largest subplans first, so that a subplan that is
+	// nested within the definition of another ends up in the outermost LogicalMaterialize
+	vector<pair<const string *, CommonSubplanGroup *>> ordered_groups;
+	for (auto &entry : groups) {
+		if (entry.second.occurrences.size() >= 2) {
+			ordered_groups.emplace_back(&entry.first, &entry.second);
+		}
+	}
+	std::sort(ordered_groups.begin(), ordered_groups.end(),
+	          [](const pair<const string *, CommonSubplanGroup *> &a,
+	             const pair<const string *, CommonSubplanGroup *> &b) {
+		          return a.second->operator_count > b.second->operator_count;
+	          });
+
+	for (auto &group_entry : ordered_groups) {
+		auto &group = *group_entry.second;
+
+		// re-locate the occurrences: applying a previous group may have removed some of them,
+		// and their addresses may since have been re-used, so re-verify the canonical signature
+		unordered_set<LogicalOperator *> occurrence_set(group.occurrences.begin(), group.occurrences.end());
+		vector<unique_ptr<LogicalOperator> *> slots;
+		for (auto &child : plan->children) {
+			FindOccurrences(child, occurrence_set, slots);
+		}
+		vector<unique_ptr<LogicalOperator> *> verified_slots;
+		for (auto &slot : slots) {
+			string signature;
+			if (canonicalizer.GetCanonicalSignature(**slot, signature) && signature == *group_entry.first) {
+				verified_slots.push_back(slot);
+			}
+		}
+		if (verified_slots.size() < 2) {
+			continue;
+		}
+
+		// move the first occurrence out as the definition and replace every occurrence by a scan
+		auto materialize_index = binder.GenerateTableIndex();
+		unique_ptr<LogicalOperator> definition;
+		for (auto &slot : verified_slots) {
+			auto &node = *slot;
+			auto scan = make_unique<LogicalMaterializeScan>(materialize_index, node->types, node->GetColumnBindings());
+			scan->estimated_cardinality = node->estimated_cardinality;
+			scan->has_estimated_cardinality = node->has_estimated_cardinality;
+			scan->ResolveOperatorTypes();
+			if (!definition) {
+				definition = std::move(node);
+			}
+			*slot = std::move(scan);
+		}
+		plan = make_unique<LogicalMaterialize>(materialize_index, std::move(definition), std::move(plan));
+		plan->ResolveOperatorTypes();
+	}
+	return plan;
+}
+
+} // namespace duckdb
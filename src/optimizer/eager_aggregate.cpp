@@ -0,0 +1,211 @@
+#include "duckdb/optimizer/eager_aggregate.hpp"
+
+#include "duckdb/function/aggregate/distributive_functions.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
+
+namespace duckdb {
+
+//! The minimum factor by which the partial aggregate must shrink the join input before the rewrite is applied
+static constexpr const idx_t EAGER_AGGREGATE_MINIMUM_REDUCTION = 10;
+
+//! Returns true if re-aggregating the partial result of this aggregate produces the same result as aggregating the
+//! base rows directly; for these aggregates the partial output can be fed back into an aggregate of the same family
+static bool CanDecomposeAggregate(BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.filter || aggr.children.size() != 1 || !aggr.function.combine) {
+		return false;
+	}
+	auto &name = aggr.function.name;
+	if (name == "min" || name == "max") {
+		// min/max are idempotent over partial results
+		return true;
+	}
+	if (name == "sum") {
+		// the final sum re-aggregates the partial sums; this requires an aggregate that accepts the partial result
+		// type, which is either the original function (type-preserving sums) or sum over HUGEINT (integer sums)
+		return aggr.return_type == aggr.children[0]->return_type ||
+		       aggr.return_type.id() == LogicalTypeId::HUGEINT;
+	}
+	return false;
+}
+
+unique_ptr<LogicalOperator> EagerAggregate::Optimize(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		TryPushPartialAggregate((LogicalAggregate &)*op);
+	}
+	return op;
+}
+
+void EagerAggregate::TryPushPartialAggregate(LogicalAggregate &aggr) {
+	if (aggr.expressions.empty() || !aggr.grouping_functions.empty() || aggr.grouping_sets.size() > 1) {
+		return;
+	}
+	if (aggr.grouping_sets.size() == 1 && aggr.grouping_sets[0].size() != aggr.groups.size()) {
+		// ROLLUP/CUBE-style partial grouping sets are not supported
+		return;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return;
+	}
+	auto &join = (LogicalComparisonJoin &)*aggr.children[0];
+	if (join.join_type != JoinType::INNER) {
+		// pushing below outer joins would aggregate rows that the join turns into NULL padding
+		return;
+	}
+	// the rewrite requires plain column equality conditions: the join keys become the partial grouping columns, which
+	// guarantees that all rows within a partial group match the same set of rows on the other side
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			return;
+		}
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF ||
+		    cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+			return;
+		}
+	}
+	unordered_set<idx_t> left_bindings, right_bindings;
+	LogicalJoin::GetTableReferences(*join.children[0], left_bindings);
+	LogicalJoin::GetTableReferences(*join.children[1], right_bindings);
+
+	// all aggregates must be decomposable and draw their arguments from the same side of the join
+	JoinSide aggregate_side = JoinSide::NONE;
+	for (auto &expr : aggr.expressions) {
+		D_ASSERT(expr->type == ExpressionType::BOUND_AGGREGATE);
+		auto &bound_aggr = (BoundAggregateExpression &)*expr;
+		if (!CanDecomposeAggregate(bound_aggr)) {
+			return;
+		}
+		auto side = JoinSide::GetJoinSide(*bound_aggr.children[0], left_bindings, right_bindings);
+		if (side != JoinSide::LEFT && side != JoinSide::RIGHT) {
+			return;
+		}
+		if (aggregate_side != JoinSide::NONE && side != aggregate_side) {
+			return;
+		}
+		aggregate_side = side;
+	}
+	// group expressions on the aggregate side must be plain column references so they can be grouped on below the join
+	vector<BoundColumnRefExpression *> push_side_group_refs;
+	for (auto &group : aggr.groups) {
+		auto side = JoinSide::GetJoinSide(*group, left_bindings, right_bindings);
+		if (side == JoinSide::BOTH) {
+			return;
+		}
+		if (side != aggregate_side) {
+			continue;
+		}
+		if (group->type != ExpressionType::BOUND_COLUMN_REF) {
+			return;
+		}
+		push_side_group_refs.push_back((BoundColumnRefExpression *)group.get());
+	}
+	// gather the partial grouping columns: the join keys of the aggregate side plus the grouped columns of that side
+	idx_t child_idx = aggregate_side == JoinSide::LEFT ? 0 : 1;
+	column_binding_map_t<idx_t> key_slots;
+	vector<BoundColumnRefExpression *> key_refs;
+	auto add_key = [&](BoundColumnRefExpression &colref) {
+		if (key_slots.find(colref.binding) == key_slots.end()) {
+			key_slots[colref.binding] = key_refs.size();
+			key_refs.push_back(&colref);
+		}
+	};
+	for (auto &cond : join.conditions) {
+		add_key((BoundColumnRefExpression &)*(aggregate_side == JoinSide::LEFT ? cond.left : cond.right));
+	}
+	for (auto &group_ref : push_side_group_refs) {
+		add_key(*group_ref);
+	}
+	if (key_refs.empty()) {
+		return;
+	}
+	// cost guard: only apply the rewrite when the distinct statistics of the grouping columns show that the partial
+	// aggregate shrinks the join input by at least EAGER_AGGREGATE_MINIMUM_REDUCTION
+	auto &child = *join.children[child_idx];
+	if (child.type != LogicalOperatorType::LOGICAL_GET) {
+		return;
+	}
+	auto &get = (LogicalGet &)child;
+	if (!get.function.statistics) {
+		return;
+	}
+	idx_t group_threshold = child.EstimateCardinality(context) / EAGER_AGGREGATE_MINIMUM_REDUCTION;
+	if (group_threshold == 0) {
+		return;
+	}
+	idx_t estimated_groups = 1;
+	for (auto &key : key_refs) {
+		if (key->binding.table_index != get.table_index) {
+			return;
+		}
+		auto column_id = get.column_ids[key->binding.column_index];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			return;
+		}
+		auto stats = get.function.statistics(context, get.bind_data.get(), column_id);
+		if (!stats || !stats->distinct_stats) {
+			return;
+		}
+		auto &distinct = (DistinctStatistics &)*stats->distinct_stats;
+		idx_t distinct_count = distinct.GetCount();
+		if (distinct_count == 0 || estimated_groups > group_threshold / distinct_count) {
+			return;
+		}
+		estimated_groups *= distinct_count;
+	}
+
+	// perform the rewrite: place a partial aggregate between the join and the aggregate-side child
+	auto group_index = binder.GenerateTableIndex();
+	auto aggregate_index = binder.GenerateTableIndex();
+
+	// the partial aggregate computes the original aggregates over the base rows
+	vector<unique_ptr<Expression>> partial_aggregates;
+	partial_aggregates.reserve(aggr.expressions.size());
+	for (auto &expr : aggr.expressions) {
+		partial_aggregates.push_back(expr->Copy());
+	}
+	// the partial aggregate groups on the (deduplicated) grouping columns; copy the column references before the
+	// upstream bindings are rewritten below
+	vector<unique_ptr<Expression>> partial_groups;
+	partial_groups.reserve(key_refs.size());
+	for (auto &key : key_refs) {
+		partial_groups.push_back(key->Copy());
+	}
+	// rewrite the final aggregates to re-aggregate the partial results
+	FunctionBinder function_binder(context);
+	for (idx_t i = 0; i < aggr.expressions.size(); i++) {
+		auto &bound_aggr = (BoundAggregateExpression &)*aggr.expressions[i];
+		bool type_preserving = bound_aggr.return_type == bound_aggr.children[0]->return_type;
+		auto final_function = type_preserving ? bound_aggr.function : SumFun::GetSumAggregate(PhysicalType::INT128);
+		vector<unique_ptr<Expression>> final_children;
+		final_children.push_back(
+		    make_unique<BoundColumnRefExpression>(bound_aggr.return_type, ColumnBinding(aggregate_index, i)));
+		auto final_aggr = function_binder.BindAggregateFunction(std::move(final_function), std::move(final_children),
+		                                                        nullptr, AggregateType::NON_DISTINCT);
+		D_ASSERT(final_aggr->return_type == bound_aggr.return_type);
+		aggr.expressions[i] = std::move(final_aggr);
+	}
+	// rewrite the join conditions and final groups to refer to the partial grouping columns
+	for (auto &cond : join.conditions) {
+		auto &colref = (BoundColumnRefExpression &)*(aggregate_side == JoinSide::LEFT ? cond.left : cond.right);
+		colref.binding = ColumnBinding(group_index, key_slots[colref.binding]);
+	}
+	for (auto &group_ref : push_side_group_refs) {
+		group_ref->binding = ColumnBinding(group_index, key_slots[group_ref->binding]);
+	}
+	auto partial_aggr = make_unique<LogicalAggregate>(group_index, aggregate_index, std::move(partial_aggregates));
+	partial_aggr->groups = std::move(partial_groups);
+	partial_aggr->AddChild(std::move(join.children[child_idx]));
+	join.children[child_idx] = std::move(partial_aggr);
+}
+
+} // namespace duckdb
@@ -394,6 +394,19 @@ bool FilterCombiner::HasFilters() {
 // 	return zonemap_checks;
 // }
 
+//! Computes the smallest string that is greater than every string starting with "prefix" by incrementing the last
+//! byte that can still be incremented (dropping any trailing 0xFF bytes); returns false if no such string exists
+static bool ComputePrefixUpperBound(string &prefix) {
+	while (!prefix.empty()) {
+		if (uint8_t(prefix.back()) < 0xFF) {
+			prefix.back()++;
+			return true;
+		}
+		prefix.pop_back();
+	}
+	return false;
+}
+
 TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_ids) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
@@ -439,10 +452,11 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 		auto &remaining_filter = remaining_filters[rem_fil_idx];
 		if (remaining_filter->expression_class == ExpressionClass::BOUND_FUNCTION) {
 			auto &func = (BoundFunctionExpression &)*remaining_filter;
-			if (func.function.name == "prefix" &&
+			if ((func.function.name == "prefix" || func.function.name == "starts_with" ||
+			     func.function.name == "^@") &&
 			    func.children[0]->expression_class == ExpressionClass::BOUND_COLUMN_REF &&
 			    func.children[1]->type == ExpressionType::VALUE_CONSTANT) {
-				//! This is a like function.
+				//! This is a prefix function (e.g. the rewritten form of LIKE 'abc%')
 				auto &column_ref = (BoundColumnRefExpression &)*func.children[0].get();
 				auto &constant_value_expr = (BoundConstantExpression &)*func.children[1].get();
 				auto like_string = StringValue::Get(constant_value_expr.value);
@@ -450,13 +464,15 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 					continue;
 				}
 				auto column_index = column_ids[column_ref.binding.column_index];
-				//! Here the like must be transformed to a BOUND COMPARISON geq le
+				//! Here the prefix must be transformed to a range [prefix, successor(prefix))
 				auto lower_bound =
 				    make_unique<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, Value(like_string));
-				like_string[like_string.size() - 1]++;
-				auto upper_bound = make_unique<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value(like_string));
 				table_filters.PushFilter(column_index, std::move(lower_bound));
-				table_filters.PushFilter(column_index, std::move(upper_bound));
+				if (ComputePrefixUpperBound(like_string)) {
+					auto upper_bound =
+					    make_unique<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value(like_string));
+					table_filters.PushFilter(column_index, std::move(upper_bound));
+				}
 				table_filters.PushFilter(column_index, make_unique<IsNotNullFilter>());
 			}
 			if (func.function.name == "~~" && func.children[0]->expression_class == ExpressionClass::BOUND_COLUMN_REF &&
@@ -465,9 +481,9 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 				auto &column_ref = (BoundColumnRefExpression &)*func.children[0].get();
 				auto &constant_value_expr = (BoundConstantExpression &)*func.children[1].get();
 				auto &like_string = StringValue::Get(constant_value_expr.value);
-				if (like_string[0] == '%' || like_string[0] == '_') {
+				if (like_string.empty() || like_string[0] == '%' || like_string[0] == '_') {
 					//! We have no prefix so nothing to pushdown
-					break;
+					continue;
 				}
 				string prefix;
 				bool equality = true;
@@ -485,13 +501,14 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 					table_filters.PushFilter(column_index, std::move(equal_filter));
 					table_filters.PushFilter(column_index, make_unique<IsNotNullFilter>());
 				} else {
-					//! Here the like must be transformed to a BOUND COMPARISON geq le
+					//! Here the like must be transformed to a range [prefix, successor(prefix))
 					auto lower_bound =
 					    make_unique<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, Value(prefix));
-					prefix[prefix.size() - 1]++;
-					auto upper_bound = make_unique<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value(prefix));
 					table_filters.PushFilter(column_index, std::move(lower_bound));
-					table_filters.PushFilter(column_index, std::move(upper_bound));
+					if (ComputePrefixUpperBound(prefix)) {
+						auto upper_bound = make_unique<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, Value(prefix));
+						table_filters.PushFilter(column_index, std::move(upper_bound));
+					}
 					table_filters.PushFilter(column_index, make_unique<IsNotNullFilter>());
 				}
 			}
@@ -505,7 +522,7 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 			auto &column_ref = (BoundColumnRefExpression &)*func.children[0].get();
 			auto column_index = column_ids[column_ref.binding.column_index];
 			if (column_index == COLUMN_IDENTIFIER_ROW_ID) {
-				break;
+				continue;
 			}
 			//! check if all children are const expr
 			bool children_constant = true;
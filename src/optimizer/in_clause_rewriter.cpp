@@ -1,8 +1,10 @@
 #include "duckdb/optimizer/in_clause_rewriter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/operator/logical_column_data_get.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
@@ -10,6 +12,30 @@
 
 namespace duckdb {
 
+//! Whether the expression executor can evaluate an IN over a list of constants of this type with a sorted constant
+//! set, instead of requiring a mark join against the materialized constants
+static bool SupportsInConstantSet(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::INTERVAL:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
 unique_ptr<LogicalOperator> InClauseRewriter::Rewrite(unique_ptr<LogicalOperator> op) {
 	if (op->children.size() == 1) {
 		root = std::move(op->children[0]);
@@ -60,6 +86,43 @@ unique_ptr<Expression> InClauseRewriter::VisitReplace(BoundOperatorExpression &e
 		}
 		return std::move(conjunction);
 	}
+	if (SupportsInConstantSet(in_type)) {
+		// IN clause with many constant children of a type the executor can evaluate with a sorted constant set:
+		// fold the children into constants and keep the IN expression itself, so that it remains pushable into the
+		// scan as a filter instead of requiring a mark join
+		auto in_expr = make_unique<BoundOperatorExpression>(expr.type, LogicalType::BOOLEAN);
+		in_expr->children.push_back(std::move(expr.children[0]));
+		bool has_null = false;
+		Value min_value, max_value;
+		for (idx_t i = 1; i < expr.children.size(); i++) {
+			// resolve this expression to a constant
+			auto value = ExpressionExecutor::EvaluateScalar(context, *expr.children[i]);
+			if (value.IsNull()) {
+				has_null = true;
+			} else {
+				if (min_value.IsNull() || value < min_value) {
+					min_value = value;
+				}
+				if (max_value.IsNull() || max_value < value) {
+					max_value = value;
+				}
+			}
+			in_expr->children.push_back(make_unique<BoundConstantExpression>(std::move(value)));
+		}
+		if (is_regular_in && !has_null) {
+			// for a regular IN without NULL constants, X IN (...) implies min <= X <= max
+			// AND a BETWEEN over the constant range with the IN, so that the filter can be pushed into zone maps
+			// with NULL constants this does not hold: a non-matching X outside of the range must yield NULL, not false
+			auto between = make_unique<BoundBetweenExpression>(
+			    in_expr->children[0]->Copy(), make_unique<BoundConstantExpression>(std::move(min_value)),
+			    make_unique<BoundConstantExpression>(std::move(max_value)), true, true);
+			auto conjunction = make_unique<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+			conjunction->children.push_back(std::move(between));
+			conjunction->children.push_back(std::move(in_expr));
+			return std::move(conjunction);
+		}
+		return std::move(in_expr);
+	}
 	// IN clause with many constant children
 	// generate a mark join that replaces this IN expression
 	// first generate a ColumnDataCollection from the set of expressions
@@ -1,4 +1,5 @@
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
@@ -479,6 +480,16 @@ idx_t CardinalityEstimator::InspectConjunctionAND(idx_t cardinality, idx_t colum
 			continue;
 		}
 		auto comparison_filter = (ConstantFilter &)*child_filter;
+		// if the column carries a histogram, use it: it handles skewed values and range comparisons
+		if (base_stats && base_stats->type.IsNumeric()) {
+			auto &numeric_stats = (NumericStatistics &)*base_stats;
+			if (numeric_stats.histogram) {
+				auto selectivity = numeric_stats.histogram->EstimateSelectivity(comparison_filter.comparison_type,
+				                                                                comparison_filter.constant);
+				auto histogram_card = MaxValue<idx_t>(idx_t(double(cardinality) * selectivity), 1U);
+				cardinality_after_filters = MinValue(cardinality_after_filters, histogram_card);
+			}
+		}
 		if (comparison_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
 			continue;
 		}
@@ -491,7 +502,7 @@ idx_t CardinalityEstimator::InspectConjunctionAND(idx_t cardinality, idx_t colum
 		if (column_count > 0) {
 			// we want the ceil of cardinality/column_count. We also want to avoid compiler errors
 			filtered_card = (cardinality + column_count - 1) / column_count;
-			cardinality_after_filters = filtered_card;
+			cardinality_after_filters = MinValue(cardinality_after_filters, filtered_card);
 		}
 		if (has_equality_filter) {
 			cardinality_after_filters = MinValue(filtered_card, cardinality_after_filters);
@@ -561,6 +572,22 @@ idx_t CardinalityEstimator::InspectTableFilters(idx_t cardinality, LogicalOperat
 
 void CardinalityEstimator::EstimateBaseTableCardinality(JoinNode *node, LogicalOperator *op) {
 	auto has_logical_filter = IsLogicalFilter(op);
+	auto get = GetLogicalGet(op);
+	if (get) {
+		// check if a scan of this exact fragment has been executed before
+		// if so, the observed cardinality replaces both the base table estimate and the filter selectivity guesses
+		idx_t observed_cardinality;
+		auto key = CardinalityFeedback::ScanKey(get->function, get->bind_data.get(), &get->table_filters);
+		if (CardinalityFeedback::Get(context).TryGetCardinality(key, observed_cardinality)) {
+			double observed_after_filters = observed_cardinality;
+			if (has_logical_filter) {
+				// the observed cardinality only covers the filters that were pushed into the scan
+				observed_after_filters *= DEFAULT_SELECTIVITY;
+			}
+			node->SetEstimatedCardinality(observed_after_filters);
+			return;
+		}
+	}
 	auto table_filters = GetTableFilters(op);
 
 	auto card_after_filters = node->GetBaseTableCardinality();
@@ -351,10 +351,8 @@ bool JoinOrderOptimizer::TryEmitPair(JoinRelationSet *left, JoinRelationSet *rig
 	// If a full plan is created, it's possible a node in the plan gets updated. When this happens, make sure you keep
 	// emitting pairs until you emit another final plan. Another final plan is guaranteed to be produced because of
 	// our symmetry guarantees.
-	if (pairs >= 10000 && !must_update_full_plan) {
+	if (pairs >= pair_budget && !must_update_full_plan) {
 		// when the amount of pairs gets too large we exit the dynamic programming and resort to a greedy algorithm
-		// FIXME: simple heuristic currently
-		// at 10K pairs stop searching exactly and switch to heuristic
 		return false;
 	}
 	EmitPair(left, right, info);
@@ -468,7 +466,19 @@ bool JoinOrderOptimizer::EnumerateCSGRecursive(JoinRelationSet *node, unordered_
 	return true;
 }
 
+//! The budget of join pairs to explore per relation during the exact join order enumeration
+static constexpr const idx_t PAIR_BUDGET_PER_RELATION = 10000;
+//! The upper bound on the amount of join pairs to explore during the exact join order enumeration
+static constexpr const idx_t MAXIMUM_PAIR_BUDGET = 250000;
+
 bool JoinOrderOptimizer::SolveJoinOrderExactly() {
+	// the amount of pairs the enumeration emits depends heavily on the shape of the query graph: for chain- and
+	// snowflake-shaped graphs it stays polynomial in the amount of relations, while for dense (clique-like) graphs
+	// it grows exponentially
+	// we scale the pair budget with the amount of relations so that large-but-sparse join problems are still solved
+	// exactly; genuinely dense graphs exhaust the budget regardless and fall back to the greedy algorithm
+	pairs = 0;
+	pair_budget = MinValue<idx_t>(MAXIMUM_PAIR_BUDGET, relations.size() * PAIR_BUDGET_PER_RELATION);
 	// now we perform the actual dynamic programming to compute the final result
 	// we enumerate over all the possible pairs in the neighborhood
 	for (idx_t i = relations.size(); i > 0; i--) {
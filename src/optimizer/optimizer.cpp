@@ -7,13 +7,16 @@
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/optimizer/column_lifetime_optimizer.hpp"
 #include "duckdb/optimizer/common_aggregate_optimizer.hpp"
+#include "duckdb/optimizer/common_subplan.hpp"
 #include "duckdb/optimizer/cse_optimizer.hpp"
 #include "duckdb/optimizer/deliminator.hpp"
+#include "duckdb/optimizer/eager_aggregate.hpp"
 #include "duckdb/optimizer/expression_heuristics.hpp"
 #include "duckdb/optimizer/filter_pullup.hpp"
 #include "duckdb/optimizer/filter_pushdown.hpp"
 #include "duckdb/optimizer/in_clause_rewriter.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
+#include "duckdb/optimizer/order_eliminator.hpp"
 #include "duckdb/optimizer/regex_range_filter.hpp"
 #include "duckdb/optimizer/remove_unused_columns.hpp"
 #include "duckdb/optimizer/rule/equal_or_null_simplification.hpp"
@@ -116,6 +119,12 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 		unused.VisitOperator(*plan);
 	});
 
+	// push partial aggregates below joins where the grouped join input is significantly smaller
+	RunOptimizer(OptimizerType::EAGER_AGGREGATE, [&]() {
+		EagerAggregate eager_aggregate(context, binder);
+		plan = eager_aggregate.Optimize(std::move(plan));
+	});
+
 	// perform statistics propagation
 	RunOptimizer(OptimizerType::STATISTICS_PROPAGATION, [&]() {
 		StatisticsPropagator propagator(context);
@@ -138,6 +147,12 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 		column_lifetime.VisitOperator(*plan);
 	});
 
+	// remove ORDER BY operators that are redundant because the underlying scan already produces the rows in order
+	RunOptimizer(OptimizerType::ORDER_ELIMINATION, [&]() {
+		OrderEliminator order_eliminator(context);
+		plan = order_eliminator.Optimize(std::move(plan));
+	});
+
 	// transform ORDER BY + LIMIT to TopN
 	RunOptimizer(OptimizerType::TOP_N, [&]() {
 		TopN topn;
@@ -150,6 +165,12 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 		plan = expression_heuristics.Rewrite(std::move(plan));
 	});
 
+	// materialize subplans that occur multiple times within the same query
+	RunOptimizer(OptimizerType::COMMON_SUBPLAN, [&]() {
+		CommonSubplanOptimizer common_subplan(context, binder);
+		plan = common_subplan.Optimize(std::move(plan));
+	});
+
 	for (auto &optimizer_extension : DBConfig::GetConfig(context).optimizer_extensions) {
 		RunOptimizer(OptimizerType::EXTENSION, [&]() {
 			optimizer_extension.optimize_function(context, optimizer_extension.optimizer_info.get(), plan);
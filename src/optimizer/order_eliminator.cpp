@@ -0,0 +1,94 @@
+#include "duckdb/optimizer/order_eliminator.hpp"
+
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+unique_ptr<LogicalOperator> OrderEliminator::Optimize(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_ORDER_BY) {
+		auto &order = (LogicalOrder &)*op;
+		if (order.projections.empty() && IsRedundantOrder(order)) {
+			return std::move(op->children[0]);
+		}
+	}
+	return op;
+}
+
+bool OrderEliminator::IsRedundantOrder(LogicalOrder &order) {
+	auto &config = DBConfig::GetConfig(context);
+	if (!config.options.preserve_insertion_order) {
+		// without order preservation scans are free to emit rows in any order
+		return false;
+	}
+	if (order.orders.size() != 1) {
+		// for multiple order keys the sortedness of the first key is not sufficient: ties need to be broken by the
+		// remaining keys
+		return false;
+	}
+	auto &order_node = order.orders[0];
+	if (order_node.type != OrderType::ASCENDING && order_node.type != OrderType::DESCENDING) {
+		return false;
+	}
+	// trace the order key through order-preserving operators down to a base table column
+	auto expr = order_node.expression.get();
+	auto op = order.children[0].get();
+	while (op->type != LogicalOperatorType::LOGICAL_GET) {
+		if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		auto &colref = (BoundColumnRefExpression &)*expr;
+		switch (op->type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = (LogicalProjection &)*op;
+			if (colref.binding.table_index != proj.table_index) {
+				return false;
+			}
+			expr = proj.expressions[colref.binding.column_index].get();
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER:
+			// filters remove rows but keep the order of the remaining rows
+			break;
+		default:
+			return false;
+		}
+		op = op->children[0].get();
+	}
+	if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto &colref = (BoundColumnRefExpression &)*expr;
+	auto &get = (LogicalGet &)*op;
+	if (!get.bind_data || get.function.name != "seq_scan") {
+		return false;
+	}
+	auto &bind_data = (TableScanBindData &)*get.bind_data;
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return false;
+	}
+	if (colref.binding.table_index != get.table_index) {
+		return false;
+	}
+	auto &local_storage = LocalStorage::Get(context, *bind_data.table->catalog);
+	if (local_storage.Find(bind_data.table->storage.get())) {
+		// transaction-local rows are scanned after the committed rows and are not covered by the table's sortedness
+		// statistics
+		return false;
+	}
+	// note that the NULL order can be ignored here: a column only keeps its sortedness statistics if no NULL value
+	// was ever appended to it
+	auto column_id = get.column_ids[colref.binding.column_index];
+	return bind_data.table->storage->IsColumnSorted(column_id, order_node.type);
+}
+
+} // namespace duckdb
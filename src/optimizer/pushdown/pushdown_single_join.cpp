@@ -1,4 +1,5 @@
 #include "duckdb/optimizer/filter_pushdown.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 
 namespace duckdb {
@@ -10,17 +11,43 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownSingleJoin(unique_ptr<Logica
                                                                unordered_set<idx_t> &right_bindings) {
 	D_ASSERT(((LogicalJoin &)*op).join_type == JoinType::SINGLE);
 	FilterPushdown left_pushdown(optimizer), right_pushdown(optimizer);
+	// for a comparison join we create a FilterCombiner that checks if we can push conditions on LHS join conditions
+	// into the RHS of the join
+	FilterCombiner filter_combiner(optimizer);
+	if (op->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		// add all comparison conditions
+		auto &comparison_join = (LogicalComparisonJoin &)*op;
+		for (auto &cond : comparison_join.conditions) {
+			filter_combiner.AddFilter(
+			    make_unique<BoundComparisonExpression>(cond.comparison, cond.left->Copy(), cond.right->Copy()));
+		}
+	}
 	// now check the set of filters
 	for (idx_t i = 0; i < filters.size(); i++) {
 		auto side = JoinSide::GetJoinSide(filters[i]->bindings, left_bindings, right_bindings);
 		if (side == JoinSide::LEFT) {
 			// bindings match left side: push into left
+			if (op->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+				// we MIGHT be able to push it down the RHS as well, but only if it is a comparison that matches the
+				// join predicates we use the FilterCombiner to figure this out add the expression to the FilterCombiner
+				filter_combiner.AddFilter(filters[i]->filter->Copy());
+			}
 			left_pushdown.filters.push_back(std::move(filters[i]));
 			// erase the filter from the list of filters
 			filters.erase(filters.begin() + i);
 			i--;
 		}
 	}
+	// check the FilterCombiner to see if there are any predicates we can push into the RHS
+	// as for left outer joins, a generated filter that is only on JoinSide::RIGHT can be safely pushed into the RHS:
+	// it only removes right tuples that cannot match any left tuple that passes the LHS filters, which does not
+	// change the (at most one) match of any surviving left tuple
+	filter_combiner.GenerateFilters([&](unique_ptr<Expression> filter) {
+		if (JoinSide::GetJoinSide(*filter, left_bindings, right_bindings) == JoinSide::RIGHT) {
+			right_pushdown.AddFilter(std::move(filter));
+		}
+	});
+	right_pushdown.GenerateFilters();
 	op->children[0] = left_pushdown.Rewrite(std::move(op->children[0]));
 	op->children[1] = right_pushdown.Rewrite(std::move(op->children[1]));
 	return FinishPushdown(std::move(op));
@@ -2,12 +2,14 @@
 
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
+#include "duckdb/function/scalar/nested_functions.hpp"
 #include "duckdb/parser/parsed_data/vacuum_info.hpp"
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
@@ -98,6 +100,25 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 								column_references[lhs_col.binding].push_back(entry);
 							}
 							column_references.erase(rhs_col.binding);
+							// also move over any struct field references
+							if (whole_struct_references.erase(rhs_col.binding) > 0) {
+								whole_struct_references.insert(lhs_col.binding);
+							}
+							auto field_refs = struct_field_references.find(rhs_col.binding);
+							if (field_refs != struct_field_references.end()) {
+								auto rhs_fields = std::move(field_refs->second);
+								struct_field_references.erase(rhs_col.binding);
+								auto &fields = struct_field_references[lhs_col.binding];
+								if (fields.empty()) {
+									fields = std::move(rhs_fields);
+								} else {
+									for (idx_t field_idx = 0; field_idx < fields.size(); field_idx++) {
+										if (rhs_fields[field_idx]) {
+											fields[field_idx] = true;
+										}
+									}
+								}
+							}
 						}
 					}
 				}
@@ -219,6 +240,36 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 				return;
 			}
 
+			// for any struct column that is only referenced through struct_extract calls, tell the scan which fields
+			// are referenced, so that it can skip the unreferenced fields and emit NULL for them instead
+			// this has to happen before ClearUnusedExpressions below, which re-binds the column references
+			for (idx_t col_idx = 0; col_idx < get.column_ids.size(); col_idx++) {
+				ColumnBinding binding(get.table_index, col_idx);
+				if (column_references.find(binding) == column_references.end()) {
+					// column is not referenced at all: it is removed entirely below
+					continue;
+				}
+				if (whole_struct_references.find(binding) != whole_struct_references.end()) {
+					// the column is referenced in its entirety somewhere: we cannot prune any fields
+					continue;
+				}
+				auto field_refs = struct_field_references.find(binding);
+				if (field_refs == struct_field_references.end()) {
+					continue;
+				}
+				idx_t referenced_fields = 0;
+				for (idx_t field_idx = 0; field_idx < field_refs->second.size(); field_idx++) {
+					if (field_refs->second[field_idx]) {
+						referenced_fields++;
+					}
+				}
+				if (referenced_fields == field_refs->second.size()) {
+					// all fields are referenced: nothing to prune
+					continue;
+				}
+				get.projected_struct_fields[get.column_ids[col_idx]] = field_refs->second;
+			}
+
 			// Create "selection vector" of all column ids
 			vector<idx_t> proj_sel;
 			for (idx_t col_idx = 0; col_idx < get.column_ids.size(); col_idx++) {
@@ -303,10 +354,37 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 	LogicalOperatorVisitor::VisitOperatorChildren(op);
 }
 
+void RemoveUnusedColumns::VisitExpression(unique_ptr<Expression> *expression) {
+	auto &expr = **expression;
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_FUNCTION) {
+		auto &function = (BoundFunctionExpression &)expr;
+		if (function.function.name == "struct_extract" && function.bind_info &&
+		    function.children[0]->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+			// struct_extract on a direct column reference: only the extracted field of the struct is referenced
+			auto &colref = (BoundColumnRefExpression &)*function.children[0];
+			auto &bind_data = (StructExtractBindData &)*function.bind_info;
+			auto &child_types = StructType::GetChildTypes(colref.return_type);
+			auto &fields = struct_field_references[colref.binding];
+			if (fields.empty()) {
+				fields.resize(child_types.size(), false);
+			}
+			D_ASSERT(bind_data.index < fields.size());
+			fields[bind_data.index] = true;
+			struct_extract_children.insert(&colref);
+		}
+	}
+	LogicalOperatorVisitor::VisitExpression(expression);
+}
+
 unique_ptr<Expression> RemoveUnusedColumns::VisitReplace(BoundColumnRefExpression &expr,
                                                          unique_ptr<Expression> *expr_ptr) {
 	// add a column reference
 	column_references[expr.binding].push_back(&expr);
+	if (expr.return_type.id() == LogicalTypeId::STRUCT &&
+	    struct_extract_children.find(&expr) == struct_extract_children.end()) {
+		// a struct column that is referenced outside of a struct_extract call: all fields are required
+		whole_struct_references.insert(expr.binding);
+	}
 	return nullptr;
 }
 
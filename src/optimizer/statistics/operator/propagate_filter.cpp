@@ -53,6 +53,15 @@ void StatisticsPropagator::UpdateFilterStatistics(BaseStatistics &stats, Express
 		// no stats available: skip this
 		return;
 	}
+	if (numeric_stats.histogram) {
+		// scale the estimated cardinality with the fraction of the values that passes the filter
+		auto selectivity = numeric_stats.histogram->EstimateSelectivity(comparison_type, constant);
+		if (node_stats && node_stats->has_estimated_cardinality) {
+			node_stats->estimated_cardinality = idx_t(double(node_stats->estimated_cardinality) * selectivity);
+		}
+		// and truncate the histogram so operators above the filter see the filtered distribution
+		numeric_stats.histogram->ApplyFilter(comparison_type, constant);
+	}
 	switch (comparison_type) {
 	case ExpressionType::COMPARE_LESSTHAN:
 	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
@@ -1,6 +1,9 @@
 #include "duckdb/optimizer/statistics_propagator.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_window.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+#include "duckdb/storage/statistics/validity_statistics.hpp"
 
 namespace duckdb {
 
@@ -19,6 +22,54 @@ unique_ptr<NodeStatistics> StatisticsPropagator::PropagateStatistics(LogicalWind
 			bound_order.stats = PropagateExpression(bound_order.expression);
 		}
 	}
+
+	// finally propagate statistics for the window expressions themselves
+	// the columns of the child pass through the window unchanged and keep their statistics in the binding-based
+	// statistics map; the rank family of window functions additionally has known ranges and never emits NULL
+	for (idx_t expr_idx = 0; expr_idx < window.expressions.size(); expr_idx++) {
+		auto &over_expr = (BoundWindowExpression &)*window.expressions[expr_idx];
+		unique_ptr<BaseStatistics> stats;
+		switch (over_expr.type) {
+		case ExpressionType::WINDOW_ROW_NUMBER:
+		case ExpressionType::WINDOW_RANK:
+		case ExpressionType::WINDOW_RANK_DENSE: {
+			// numbers and ranks start at one and can at most reach the row count of the input
+			Value max_value = node_stats && node_stats->has_max_cardinality
+			                      ? Value::BIGINT(MaxValue<int64_t>(node_stats->max_cardinality, 1))
+			                      : Value(LogicalType::BIGINT);
+			stats = make_unique<NumericStatistics>(LogicalType::BIGINT, Value::BIGINT(1), std::move(max_value),
+			                                       StatisticsType::GLOBAL_STATS);
+			break;
+		}
+		case ExpressionType::WINDOW_PERCENT_RANK:
+		case ExpressionType::WINDOW_CUME_DIST:
+			// percent_rank and cume_dist are relative positions within [0, 1]
+			stats = make_unique<NumericStatistics>(LogicalType::DOUBLE, Value::DOUBLE(0), Value::DOUBLE(1),
+			                                       StatisticsType::GLOBAL_STATS);
+			break;
+		case ExpressionType::WINDOW_NTILE: {
+			// ntile buckets range from 1 to the (constant) bucket count
+			if (over_expr.children.empty() ||
+			    over_expr.children[0]->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+				break;
+			}
+			auto &bucket_count = ((BoundConstantExpression &)*over_expr.children[0]).value;
+			if (bucket_count.IsNull() || bucket_count.type() != LogicalType::BIGINT) {
+				break;
+			}
+			stats = make_unique<NumericStatistics>(LogicalType::BIGINT, Value::BIGINT(1), bucket_count,
+			                                       StatisticsType::GLOBAL_STATS);
+			break;
+		}
+		default:
+			break;
+		}
+		if (stats) {
+			stats->validity_stats = make_unique<ValidityStatistics>(false);
+			ColumnBinding window_binding(window.window_index, expr_idx);
+			statistics_map[window_binding] = std::move(stats);
+		}
+	}
 	return std::move(node_stats);
 }
 
@@ -1,5 +1,6 @@
 #include "duckdb/execution/executor.hpp"
 
+#include "duckdb/common/types/vector_cache_pool.hpp"
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
@@ -20,6 +21,7 @@
 namespace duckdb {
 
 Executor::Executor(ClientContext &context) : context(context) {
+	cache_pool = make_unique<VectorCachePool>(Allocator::Get(context));
 }
 
 Executor::~Executor() {
@@ -299,6 +301,7 @@ void Executor::InitializeInternal(PhysicalOperator *plan) {
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(physical_plan);
 		this->producer = scheduler.CreateProducer();
+		this->producer->priority = ClientConfig::GetConfig(context).scheduler_priority;
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -364,6 +367,8 @@ void Executor::CancelTasks() {
 			}
 		}
 	}
+	// wake up any client waiting for completion of the cancelled query
+	SignalCompletion();
 }
 
 void Executor::WorkOnTasks() {
@@ -422,6 +427,11 @@ PendingExecutionResult Executor::ExecuteTask() {
 }
 
 void Executor::Reset() {
+	{
+		lock_guard<mutex> clock(completion_lock);
+		completion_callback = nullptr;
+		completion_signalled = false;
+	}
 	lock_guard<mutex> elock(executor_lock);
 	physical_plan = nullptr;
 	cancelled = false;
@@ -434,6 +444,8 @@ void Executor::Reset() {
 	exceptions.clear();
 	pipelines.clear();
 	events.clear();
+	// drop any pooled vector caches so the memory is not held on to between queries
+	cache_pool = make_unique<VectorCachePool>(Allocator::Get(context));
 	execution_result = PendingExecutionResult::RESULT_NOT_READY;
 }
 
@@ -463,11 +475,44 @@ vector<LogicalType> Executor::GetTypes() {
 }
 
 void Executor::PushError(PreservedError exception) {
-	lock_guard<mutex> elock(error_lock);
-	// interrupt execution of any other pipelines that belong to this executor
-	context.interrupted = true;
-	// push the exception onto the stack
-	exceptions.push_back(std::move(exception));
+	{
+		lock_guard<mutex> elock(error_lock);
+		// interrupt execution of any other pipelines that belong to this executor
+		context.interrupted = true;
+		// push the exception onto the stack
+		exceptions.push_back(std::move(exception));
+	}
+	// wake up any client waiting for completion, so it can collect the error
+	SignalCompletion();
+}
+
+void Executor::SetCompletionCallback(std::function<void()> callback) {
+	std::function<void()> fire;
+	{
+		lock_guard<mutex> guard(completion_lock);
+		completion_callback = std::move(callback);
+		if (completion_signalled) {
+			fire = completion_callback;
+		}
+	}
+	if (fire) {
+		fire();
+	}
+}
+
+void Executor::SignalCompletion() {
+	std::function<void()> fire;
+	{
+		lock_guard<mutex> guard(completion_lock);
+		if (completion_signalled) {
+			return;
+		}
+		completion_signalled = true;
+		fire = completion_callback;
+	}
+	if (fire) {
+		fire();
+	}
 }
 
 bool Executor::HasError() {
@@ -490,22 +535,30 @@ bool Executor::GetPipelinesProgress(double &current_progress) { // LCOV_EXCL_STA
 	lock_guard<mutex> elock(executor_lock);
 
 	vector<double> progress;
-	vector<idx_t> cardinality;
-	idx_t total_cardinality = 0;
+	vector<idx_t> work;
+	idx_t total_work = 0;
+	bool any_supported = false;
 	for (auto &pipeline : pipelines) {
 		double child_percentage;
-		idx_t child_cardinality;
+		idx_t child_work;
 
-		if (!pipeline->GetProgress(child_percentage, child_cardinality)) {
-			return false;
+		if (pipeline->GetProgress(child_percentage, child_work)) {
+			any_supported = true;
+		} else {
+			// the source of this pipeline cannot report its progress: count its estimated work as not started
+			// instead of giving up on progress estimation for the entire query
+			child_percentage = 0;
 		}
 		progress.push_back(child_percentage);
-		cardinality.push_back(child_cardinality);
-		total_cardinality += child_cardinality;
+		work.push_back(child_work);
+		total_work += child_work;
+	}
+	if (!any_supported || total_work == 0) {
+		return false;
 	}
 	current_progress = 0;
 	for (size_t i = 0; i < progress.size(); i++) {
-		current_progress += progress[i] * double(cardinality[i]) / double(total_cardinality);
+		current_progress += progress[i] * double(work[i]) / double(total_work);
 	}
 	return true;
 } // LCOV_EXCL_STOP
@@ -55,9 +55,18 @@ ClientContext &Pipeline::GetClientContext() {
 	return executor.context;
 }
 
-bool Pipeline::GetProgress(double &current_percentage, idx_t &source_cardinality) {
+bool Pipeline::GetProgress(double &current_percentage, idx_t &estimated_work) {
 	D_ASSERT(source);
-	source_cardinality = source->estimated_cardinality;
+	// weight the pipeline by the estimated number of rows that flow through all of its operators, so that pipelines
+	// dominated by joins or aggregates contribute according to the optimizer's cardinality model instead of only
+	// their (possibly tiny) source cardinality
+	estimated_work = source->estimated_cardinality;
+	for (auto &op : operators) {
+		estimated_work += op->estimated_cardinality;
+	}
+	if (sink) {
+		estimated_work += sink->estimated_cardinality;
+	}
 	if (!initialized) {
 		current_percentage = 0;
 		return true;
@@ -1,6 +1,7 @@
 #include "duckdb/parallel/pipeline_executor.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/common/limits.hpp"
+#include "duckdb/common/types/vector_cache_pool.hpp"
 
 namespace duckdb {
 
@@ -13,6 +14,7 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 		requires_batch_index = pipeline.sink->RequiresBatchIndex() && pipeline.source->SupportsBatchIndex();
 	}
 
+	auto &cache_pool = pipeline.executor.GetCachePool();
 	intermediate_chunks.reserve(pipeline.operators.size());
 	intermediate_states.reserve(pipeline.operators.size());
 	for (idx_t i = 0; i < pipeline.operators.size(); i++) {
@@ -20,7 +22,7 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 		auto current_operator = pipeline.operators[i];
 
 		auto chunk = make_unique<DataChunk>();
-		chunk->Initialize(Allocator::Get(context.client), prev_operator->GetTypes());
+		chunk->Initialize(cache_pool, prev_operator->GetTypes());
 		intermediate_chunks.push_back(std::move(chunk));
 
 		auto op_state = current_operator->GetOperatorState(context);
@@ -35,6 +37,16 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 	InitializeChunk(final_chunk);
 }
 
+PipelineExecutor::~PipelineExecutor() {
+	// return the chunk buffers to the cache pool so pipeline executors created later can re-use them
+	// buffers that are still referenced elsewhere are dropped by the pool instead of being pooled
+	auto &cache_pool = pipeline.executor.GetCachePool();
+	for (auto &chunk : intermediate_chunks) {
+		chunk->RecycleCaches(cache_pool);
+	}
+	final_chunk.RecycleCaches(cache_pool);
+}
+
 bool PipelineExecutor::Execute(idx_t max_chunks) {
 	D_ASSERT(pipeline.sink);
 	bool exhausted_source = false;
@@ -377,7 +389,7 @@ void PipelineExecutor::FetchFromSource(DataChunk &result) {
 
 void PipelineExecutor::InitializeChunk(DataChunk &chunk) {
 	PhysicalOperator *last_op = pipeline.operators.empty() ? pipeline.source : pipeline.operators.back();
-	chunk.Initialize(Allocator::DefaultAllocator(), last_op->GetTypes());
+	chunk.Initialize(pipeline.executor.GetCachePool(), last_op->GetTypes());
 }
 
 void PipelineExecutor::StartOperator(PhysicalOperator *op) {
@@ -1,5 +1,6 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
@@ -8,6 +9,12 @@
 #include "concurrentqueue.h"
 #include "lightweightsemaphore.h"
 #include "duckdb/common/thread.hpp"
+#if defined(__linux__)
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#define DUCKDB_NUMA_AWARE_SCHEDULER
+#endif
 #else
 #include <queue>
 #endif
@@ -27,24 +34,210 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<unique_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULER
+static bool ReadCPUList(const string &path, vector<idx_t> &cpus) {
+	std::ifstream in(path.c_str());
+	if (!in.is_open()) {
+		return false;
+	}
+	string line;
+	if (!std::getline(in, line)) {
+		return false;
+	}
+	// the cpulist format is a comma-separated list of cpu indices and (inclusive) ranges, e.g. "0-3,8-11"
+	idx_t pos = 0;
+	while (pos < line.size() && isdigit(line[pos])) {
+		idx_t range_start = 0;
+		while (pos < line.size() && isdigit(line[pos])) {
+			range_start = range_start * 10 + (line[pos++] - '0');
+		}
+		idx_t range_end = range_start;
+		if (pos < line.size() && line[pos] == '-') {
+			pos++;
+			range_end = 0;
+			while (pos < line.size() && isdigit(line[pos])) {
+				range_end = range_end * 10 + (line[pos++] - '0');
+			}
+		}
+		for (idx_t cpu = range_start; cpu <= range_end; cpu++) {
+			cpus.push_back(cpu);
+		}
+		if (pos < line.size() && line[pos] == ',') {
+			pos++;
+		}
+	}
+	return !cpus.empty();
+}
+
+//! The NUMA topology of the machine, read once from sysfs when the scheduler is created.
+//! If no topology information is available we fall back to a single node (i.e. a single task queue).
+struct NumaTopology {
+	NumaTopology() {
+		for (idx_t node = 0;; node++) {
+			vector<idx_t> cpus;
+			auto path = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+			if (!ReadCPUList(path, cpus)) {
+				break;
+			}
+			for (auto cpu : cpus) {
+				if (cpu >= cpu_to_node.size()) {
+					cpu_to_node.resize(cpu + 1, 0);
+				}
+				cpu_to_node[cpu] = node_cpus.size();
+			}
+			node_cpus.push_back(std::move(cpus));
+		}
+		if (node_cpus.empty()) {
+			node_cpus.emplace_back();
+		}
+	}
+
+	idx_t NodeCount() const {
+		return node_cpus.size();
+	}
+
+	//! The node the calling thread is currently running on
+	idx_t NodeOfCurrentThread() const {
+		auto cpu = sched_getcpu();
+		if (cpu < 0 || idx_t(cpu) >= cpu_to_node.size()) {
+			return 0;
+		}
+		return cpu_to_node[cpu];
+	}
+
+	//! Restrict the calling thread to the cpus of the given node
+	void PinCurrentThreadToNode(idx_t node) const {
+		auto &cpus = node_cpus[node];
+		if (cpus.empty()) {
+			return;
+		}
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+		for (auto cpu : cpus) {
+			CPU_SET(cpu, &cpu_set);
+		}
+		pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+	}
+
+	//! Per node: the cpus that belong to it
+	vector<vector<idx_t>> node_cpus;
+	//! Per cpu: the node it belongs to
+	vector<idx_t> cpu_to_node;
+};
+#endif
+
+//! A per-worker task deque: the owning thread pushes and pops at the back so tasks it schedules itself stay
+//! thread-local and dequeues are uncontended in the common case, while idle workers steal from the front.
+struct WorkerTaskDeque {
+	mutex lock;
+	deque<unique_ptr<Task>> tasks;
+
+	void PushLocal(unique_ptr<Task> task) {
+		lock_guard<mutex> guard(lock);
+		tasks.push_back(std::move(task));
+	}
+
+	bool PopLocal(unique_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back());
+		tasks.pop_back();
+		return true;
+	}
+
+	bool Steal(unique_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front());
+		tasks.pop_front();
+		return true;
+	}
+};
+
+//! The deque of the worker thread this thread belongs to, if it is a registered worker thread
+static thread_local WorkerTaskDeque *local_worker_deque = nullptr;
+
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	//! The number of task priority levels (see TaskPriority)
+	static constexpr idx_t PRIORITY_COUNT = 3;
+	//! Every AGING_INTERVAL-th dequeue scans the priorities lowest-first, so low-priority tasks keep making
+	//! progress while high-priority work is continuously arriving
+	static constexpr idx_t AGING_INTERVAL = 16;
+
+	ConcurrentQueue() : dequeue_count(0) {
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULER
+		auto node_count = topology.NodeCount();
+#else
+		idx_t node_count = 1;
+#endif
+		// one queue per priority level per NUMA node
+		for (idx_t i = 0; i < node_count * PRIORITY_COUNT; i++) {
+			queues.push_back(make_unique<concurrent_queue_t>());
+		}
+	}
+
+	idx_t NodeCount() const {
+		return queues.size() / PRIORITY_COUNT;
+	}
+
+	//! The queue belonging to the node the calling thread runs on
+	idx_t LocalQueueIndex() const {
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULER
+		return topology.NodeOfCurrentThread();
+#else
+		return 0;
+#endif
+	}
+
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULER
+	NumaTopology topology;
+#endif
+	//! One task queue per priority level per NUMA node, indexed by node * PRIORITY_COUNT + priority
+	vector<unique_ptr<concurrent_queue_t>> queues;
+	//! The number of dequeues from the shared queues, which drives the aging schedule
+	atomic<idx_t> dequeue_count;
 	lightweight_semaphore_t semaphore;
+	//! The work-stealing deques of the registered worker threads
+	mutex worker_lock;
+	vector<WorkerTaskDeque *> worker_deques;
 
 	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task);
+	bool TryDequeue(unique_ptr<Task> &task);
+	bool TryDequeueFromQueues(unique_ptr<Task> &task);
+	bool TryDequeueShared(unique_ptr<Task> &task);
+	bool TryStealFromWorkers(unique_ptr<Task> &task);
+	void RegisterWorker(WorkerTaskDeque &worker_deque);
+	void DeregisterWorker(WorkerTaskDeque &worker_deque);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	explicit QueueProducerToken(ConcurrentQueue &queue) {
+		for (auto &q : queue.queues) {
+			queue_tokens.push_back(make_unique<duckdb_moodycamel::ProducerToken>(*q));
+		}
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	//! A producer token for every per-node queue
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
 };
 
 void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
+	if (local_worker_deque) {
+		// tasks scheduled by a worker thread go into its own deque: they are picked up again by that thread without
+		// touching the shared queues, and idle workers can still steal them
+		local_worker_deque->PushLocal(std::move(task));
+		semaphore.signal();
+		return;
+	}
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	// enqueue into the queue of the producer's priority on the node the producing thread runs on
+	auto queue_idx = LocalQueueIndex() * PRIORITY_COUNT + (idx_t)token.priority;
+	if (queues[queue_idx]->enqueue(*token.token->queue_tokens[queue_idx], std::move(task))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
@@ -53,7 +246,92 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	// prefer the queues of the local node, then look at the queues of the other nodes
+	auto local_idx = LocalQueueIndex() * PRIORITY_COUNT;
+	for (idx_t i = 0; i < queues.size(); i++) {
+		auto queue_idx = (local_idx + i) % queues.size();
+		if (queues[queue_idx]->try_dequeue_from_producer(*token.token->queue_tokens[queue_idx], task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::TryDequeue(unique_ptr<Task> &task) {
+	// pop from this worker's own deque first, if there is one
+	if (local_worker_deque && local_worker_deque->PopLocal(task)) {
+		return true;
+	}
+	if (TryDequeueFromQueues(task)) {
+		return true;
+	}
+	// finally, steal from the deques of the other workers
+	return TryStealFromWorkers(task);
+}
+
+//! Dequeue from the shared queues, highest priority first; node-locality is a tie-breaker within a priority level
+bool ConcurrentQueue::TryDequeueFromQueues(unique_ptr<Task> &task) {
+	auto local_idx = LocalQueueIndex();
+	auto node_count = NodeCount();
+	// periodically reverse the scan order, so low-priority tasks cannot starve
+	bool aged = ++dequeue_count % AGING_INTERVAL == 0;
+	for (idx_t p = 0; p < PRIORITY_COUNT; p++) {
+		auto priority = aged ? p : PRIORITY_COUNT - p - 1;
+		for (idx_t i = 0; i < node_count; i++) {
+			auto node_idx = (local_idx + i) % node_count;
+			if (queues[node_idx * PRIORITY_COUNT + priority]->try_dequeue(task)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+//! Dequeue a task that was not scheduled by this worker itself: the shared queues and the deques of the other
+//! workers, but not this worker's own deque (where yielded tasks are parked)
+bool ConcurrentQueue::TryDequeueShared(unique_ptr<Task> &task) {
+	if (TryDequeueFromQueues(task)) {
+		return true;
+	}
+	return TryStealFromWorkers(task);
+}
+
+bool ConcurrentQueue::TryStealFromWorkers(unique_ptr<Task> &task) {
+	lock_guard<mutex> guard(worker_lock);
+	for (auto &worker_deque : worker_deques) {
+		if (worker_deque == local_worker_deque) {
+			continue;
+		}
+		if (worker_deque->Steal(task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ConcurrentQueue::RegisterWorker(WorkerTaskDeque &worker_deque) {
+	lock_guard<mutex> guard(worker_lock);
+	worker_deques.push_back(&worker_deque);
+	local_worker_deque = &worker_deque;
+}
+
+void ConcurrentQueue::DeregisterWorker(WorkerTaskDeque &worker_deque) {
+	{
+		lock_guard<mutex> guard(worker_lock);
+		for (idx_t i = 0; i < worker_deques.size(); i++) {
+			if (worker_deques[i] == &worker_deque) {
+				worker_deques.erase(worker_deques.begin() + i);
+				break;
+			}
+		}
+		local_worker_deque = nullptr;
+	}
+	// push any tasks this worker still held back into the shared queues so they are not lost
+	unique_ptr<Task> task;
+	while (worker_deque.Steal(task)) {
+		queues[LocalQueueIndex() * PRIORITY_COUNT + (idx_t)TaskPriority::NORMAL]->enqueue(std::move(task));
+		semaphore.signal();
+	}
 }
 
 #else
@@ -127,15 +405,44 @@ bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, unique_ptr<Task> &
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	unique_ptr<Task> task;
+	// register a work-stealing deque for this worker thread
+	WorkerTaskDeque worker_deque;
+	queue->RegisterWorker(worker_deque);
 	// loop until the marker is set to false
+	int64_t wait_timeout = TASK_TIMEOUT_USECS;
 	while (*marker) {
-		// wait for a signal with a timeout
-		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
-			task->Execute(TaskExecutionMode::PROCESS_ALL);
-			task.reset();
+		// wait for a signal with a timeout; the bounded wait guarantees the marker is observed even when the
+		// wake-up signal of a stopping thread is consumed by another worker
+		queue->semaphore.wait(wait_timeout);
+		if (!queue->TryDequeue(task)) {
+			// no work: back off the timeout so long-idle workers park with few spurious wakeups; an enqueue
+			// signals the semaphore and wakes a parked worker immediately regardless of the timeout
+			wait_timeout = MinValue<int64_t>(wait_timeout * 2, MAX_TASK_TIMEOUT_USECS);
+			continue;
+		}
+		wait_timeout = TASK_TIMEOUT_USECS;
+		while (task) {
+			if (!*marker) {
+				// the thread is being shut down: finish the task without yielding
+				task->Execute(TaskExecutionMode::PROCESS_ALL);
+				break;
+			}
+			// execute the task in bounded quanta, so long-running tasks cannot monopolize the thread
+			if (task->Execute(TaskExecutionMode::PROCESS_PARTIAL) != TaskExecutionResult::TASK_NOT_FINISHED) {
+				break;
+			}
+			// the task yielded: if another task is waiting, park the yielded task in the worker deque (where other
+			// workers can steal it) and run the waiting task first
+			unique_ptr<Task> other_task;
+			if (queue->TryDequeueShared(other_task)) {
+				worker_deque.PushLocal(std::move(task));
+				queue->semaphore.signal();
+				task = std::move(other_task);
+			}
 		}
+		task.reset();
 	}
+	queue->DeregisterWorker(worker_deque);
 #else
 	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
 #endif
@@ -147,7 +454,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		unique_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->TryDequeue(task)) {
 			return completed_tasks;
 		}
 		task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -165,7 +472,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	unique_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->TryDequeue(task)) {
 			return;
 		}
 		try {
@@ -181,7 +488,8 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, idx_t thread_index) {
+	scheduler->PinThread(thread_index);
 	scheduler->ExecuteForever(marker);
 }
 #endif
@@ -192,6 +500,11 @@ int32_t TaskScheduler::NumberOfThreads() {
 	return threads.size() + config.options.external_threads + 1;
 }
 
+idx_t TaskScheduler::NumberOfBackgroundThreads() {
+	lock_guard<mutex> t(thread_lock);
+	return threads.size();
+}
+
 void TaskScheduler::SetThreads(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	lock_guard<mutex> t(thread_lock);
@@ -212,6 +525,17 @@ void TaskScheduler::Signal(idx_t n) {
 #endif
 }
 
+void TaskScheduler::PinThread(idx_t thread_index) {
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULER
+	auto &topology = queue->topology;
+	if (topology.NodeCount() <= 1) {
+		return;
+	}
+	// distribute the worker threads round-robin over the nodes
+	topology.PinCurrentThreadToNode(thread_index % topology.NodeCount());
+#endif
+}
+
 void TaskScheduler::SetThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	if (threads.size() == idx_t(n - 1)) {
@@ -219,26 +543,28 @@ void TaskScheduler::SetThreadsInternal(int32_t n) {
 	}
 	idx_t new_thread_count = n - 1;
 	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
-		for (idx_t i = 0; i < threads.size(); i++) {
+		// we are reducing the number of threads: stop and join only the excess threads, so the pool can be
+		// resized at runtime without draining the workers that remain
+		for (idx_t i = new_thread_count; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
-		Signal(threads.size());
-		// now join the threads to ensure they are fully stopped before erasing them
-		for (idx_t i = 0; i < threads.size(); i++) {
+		Signal(threads.size() - new_thread_count);
+		// now join the excess threads to ensure they are fully stopped before erasing them
+		for (idx_t i = new_thread_count; i < threads.size(); i++) {
 			threads[i]->internal_thread->join();
 		}
-		// erase the threads/markers
-		threads.clear();
-		markers.clear();
+		// erase the excess threads/markers
+		threads.resize(new_thread_count);
+		markers.resize(new_thread_count);
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
+			idx_t thread_index = threads.size();
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
-			auto worker_thread = make_unique<thread>(ThreadExecuteTasks, this, marker.get());
+			auto worker_thread = make_unique<thread>(ThreadExecuteTasks, this, marker.get(), thread_index);
 			auto thread_wrapper = make_unique<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
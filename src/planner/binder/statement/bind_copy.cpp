@@ -42,6 +42,7 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt) {
 	bool use_tmp_file = true;
 	bool user_set_use_tmp_file = false;
 	bool per_thread_output = false;
+	vector<idx_t> partition_cols;
 
 	auto original_options = stmt.info->options;
 	stmt.info->options.clear();
@@ -57,15 +58,38 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt) {
 			per_thread_output = option.second[0].CastAs(context, LogicalType::BOOLEAN).GetValue<bool>();
 			continue;
 		}
+		if (loption == "partition_by") {
+			for (auto &partition_col : option.second) {
+				auto col_name = partition_col.ToString();
+				idx_t col_index = DConstants::INVALID_INDEX;
+				for (idx_t i = 0; i < select_node.names.size(); i++) {
+					if (StringUtil::CIEquals(select_node.names[i], col_name)) {
+						col_index = i;
+						break;
+					}
+				}
+				if (col_index == DConstants::INVALID_INDEX) {
+					throw BinderException("PARTITION_BY column \"%s\" not found in the result columns", col_name);
+				}
+				partition_cols.push_back(col_index);
+			}
+			continue;
+		}
 		stmt.info->options[option.first] = option.second;
 	}
 	if (user_set_use_tmp_file && per_thread_output) {
 		throw NotImplementedException("Can't combine USE_TMP_FILE and PER_THREAD_OUTPUT for COPY");
 	}
+	if (user_set_use_tmp_file && !partition_cols.empty()) {
+		throw NotImplementedException("Can't combine USE_TMP_FILE and PARTITION_BY for COPY");
+	}
+	if (per_thread_output && !partition_cols.empty()) {
+		throw NotImplementedException("Can't combine PER_THREAD_OUTPUT and PARTITION_BY for COPY");
+	}
 	bool is_file_and_exists = config.file_system->FileExists(stmt.info->file_path);
 	bool is_stdout = stmt.info->file_path == "/dev/stdout";
 	if (!user_set_use_tmp_file) {
-		use_tmp_file = is_file_and_exists && !per_thread_output && !is_stdout;
+		use_tmp_file = is_file_and_exists && !per_thread_output && partition_cols.empty() && !is_stdout;
 	}
 
 	auto function_data =
@@ -75,6 +99,10 @@ BoundStatement Binder::BindCopyTo(CopyStatement &stmt) {
 	copy->file_path = stmt.info->file_path;
 	copy->use_tmp_file = use_tmp_file;
 	copy->per_thread_output = per_thread_output;
+	copy->partition_output = !partition_cols.empty();
+	copy->partition_columns = std::move(partition_cols);
+	copy->names = select_node.names;
+	copy->expected_types = select_node.types;
 
 	copy->AddChild(std::move(select_node.plan));
 
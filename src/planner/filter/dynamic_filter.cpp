@@ -0,0 +1,65 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/common/field_writer.hpp"
+
+namespace duckdb {
+
+void DynamicFilterData::SetValue(Value value) {
+	if (value.IsNull()) {
+		// a NULL bound cannot prune anything
+		return;
+	}
+	lock_guard<mutex> glock(lock);
+	D_ASSERT(filter);
+	if (initialized) {
+		// only tighten the bound
+		if (filter->comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
+			if (!(value > filter->constant)) {
+				return;
+			}
+		} else {
+			if (!(value < filter->constant)) {
+				return;
+			}
+		}
+	}
+	filter->constant = std::move(value);
+	initialized = true;
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	lock_guard<mutex> glock(filter_data->lock);
+	if (!filter_data->initialized) {
+		// no bound has been published yet
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	lock_guard<mutex> glock(filter_data->lock);
+	if (!filter_data->initialized) {
+		return "DYNAMIC FILTER (" + column_name + ")";
+	}
+	return "DYNAMIC FILTER (" + filter_data->filter->ToString(column_name) + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = (const DynamicFilter &)other_p;
+	// dynamic filters are only equal if they share the same run-time state
+	return other.filter_data.get() == filter_data.get();
+}
+
+void DynamicFilter::Serialize(FieldWriter &writer) const {
+	// dynamic filters are created at physical planning time and hold transient state - they cannot be serialized
+	throw NotImplementedException("Cannot serialize dynamic filters");
+}
+
+} // namespace duckdb
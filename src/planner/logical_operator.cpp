@@ -247,6 +247,9 @@ unique_ptr<LogicalOperator> LogicalOperator::Deserialize(Deserializer &deseriali
 	case LogicalOperatorType::LOGICAL_CTE_REF:
 		result = LogicalCTERef::Deserialize(state, reader);
 		break;
+	case LogicalOperatorType::LOGICAL_MATERIALIZE_SCAN:
+		result = LogicalMaterializeScan::Deserialize(state, reader);
+		break;
 	case LogicalOperatorType::LOGICAL_JOIN:
 		throw InternalException("LogicalJoin deserialize not supported");
 	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
@@ -276,6 +279,9 @@ unique_ptr<LogicalOperator> LogicalOperator::Deserialize(Deserializer &deseriali
 	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE:
 		result = LogicalRecursiveCTE::Deserialize(state, reader);
 		break;
+	case LogicalOperatorType::LOGICAL_MATERIALIZE:
+		result = LogicalMaterialize::Deserialize(state, reader);
+		break;
 	case LogicalOperatorType::LOGICAL_INSERT:
 		result = LogicalInsert::Deserialize(state, reader);
 		break;
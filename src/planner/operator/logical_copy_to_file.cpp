@@ -10,6 +10,10 @@ void LogicalCopyToFile::Serialize(FieldWriter &writer) const {
 	writer.WriteString(file_path);
 	writer.WriteField(use_tmp_file);
 	writer.WriteField(per_thread_output);
+	writer.WriteField(partition_output);
+	writer.WriteList<idx_t>(partition_columns);
+	writer.WriteList<string>(names);
+	writer.WriteRegularSerializableList(expected_types);
 
 	D_ASSERT(!function.name.empty());
 	writer.WriteString(function.name);
@@ -26,6 +30,10 @@ unique_ptr<LogicalOperator> LogicalCopyToFile::Deserialize(LogicalDeserializatio
 	auto file_path = reader.ReadRequired<string>();
 	auto use_tmp_file = reader.ReadRequired<bool>();
 	auto per_thread_output = reader.ReadRequired<bool>();
+	auto partition_output = reader.ReadRequired<bool>();
+	auto partition_columns = reader.ReadRequiredList<idx_t>();
+	auto names = reader.ReadRequiredList<string>();
+	auto expected_types = reader.ReadRequiredSerializableList<LogicalType, LogicalType>();
 
 	auto copy_func_name = reader.ReadRequired<string>();
 
@@ -51,6 +59,10 @@ unique_ptr<LogicalOperator> LogicalCopyToFile::Deserialize(LogicalDeserializatio
 	result->file_path = file_path;
 	result->use_tmp_file = use_tmp_file;
 	result->per_thread_output = per_thread_output;
+	result->partition_output = partition_output;
+	result->partition_columns = std::move(partition_columns);
+	result->names = std::move(names);
+	result->expected_types = std::move(expected_types);
 	return std::move(result);
 }
 
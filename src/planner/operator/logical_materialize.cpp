@@ -0,0 +1,15 @@
+#include "duckdb/planner/operator/logical_materialize.hpp"
+#include "duckdb/common/field_writer.hpp"
+
+namespace duckdb {
+
+void LogicalMaterialize::Serialize(FieldWriter &writer) const {
+	writer.WriteField(materialize_index);
+}
+
+unique_ptr<LogicalOperator> LogicalMaterialize::Deserialize(LogicalDeserializationState &state, FieldReader &reader) {
+	auto materialize_index = reader.ReadRequired<idx_t>();
+	return make_unique<LogicalMaterialize>(materialize_index);
+}
+
+} // namespace duckdb
@@ -0,0 +1,32 @@
+#include "duckdb/planner/operator/logical_materialize_scan.hpp"
+#include "duckdb/common/field_writer.hpp"
+
+namespace duckdb {
+
+void LogicalMaterializeScan::Serialize(FieldWriter &writer) const {
+	writer.WriteField(materialize_index);
+	writer.WriteRegularSerializableList(chunk_types);
+	vector<idx_t> binding_tables;
+	vector<idx_t> binding_columns;
+	for (auto &binding : bindings) {
+		binding_tables.push_back(binding.table_index);
+		binding_columns.push_back(binding.column_index);
+	}
+	writer.WriteList<idx_t>(binding_tables);
+	writer.WriteList<idx_t>(binding_columns);
+}
+
+unique_ptr<LogicalOperator> LogicalMaterializeScan::Deserialize(LogicalDeserializationState &state,
+                                                                FieldReader &reader) {
+	auto materialize_index = reader.ReadRequired<idx_t>();
+	auto chunk_types = reader.ReadRequiredSerializableList<LogicalType, LogicalType>();
+	auto binding_tables = reader.ReadRequiredList<idx_t>();
+	auto binding_columns = reader.ReadRequiredList<idx_t>();
+	vector<ColumnBinding> bindings;
+	for (idx_t i = 0; i < binding_tables.size(); i++) {
+		bindings.emplace_back(binding_tables[i], binding_columns[i]);
+	}
+	return make_unique<LogicalMaterializeScan>(materialize_index, std::move(chunk_types), std::move(bindings));
+}
+
+} // namespace duckdb
@@ -3,10 +3,15 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/set.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread_io_counters.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
+#include "miniz.hpp"
 
 namespace duckdb {
 
@@ -68,7 +73,8 @@ BlockHandle::~BlockHandle() {
 	auto &buffer_manager = block_manager.buffer_manager;
 	// no references remain to this block: erase
 	if (buffer && state == BlockState::BLOCK_LOADED) {
-		D_ASSERT(memory_charge.size > 0);
+		// externally backed (memory-mapped) buffers have an AllocSize of zero and carry no charge
+		D_ASSERT(memory_charge.size > 0 || buffer->AllocSize() == 0);
 		// the block is still loaded in memory: erase it
 		buffer.reset();
 		memory_charge.Resize(buffer_manager.current_memory, 0);
@@ -214,12 +220,87 @@ struct BufferEvictionNode {
 
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
+//! Two-level eviction queue. Blocks that have been unpinned only once live in the cold level and are evicted
+//! first; blocks that were pinned again after having been unpinned graduate to the hot level. A single large
+//! scan only cycles through the cold level and can no longer flush the frequently used working set.
+//! Each level is split into shards that are filled round-robin, so that concurrent pin/unpin heavy workloads
+//! do not contend on a single queue. Eviction rotates over the shards, making the order approximately FIFO
+//! within a level.
 struct EvictionQueue {
-	eviction_queue_t q;
+	static constexpr idx_t SHARD_COUNT = 8;
+
+	EvictionQueue() : insertion_count(0), eviction_count(0) {
+	}
+
+	//! The shards of the cold level (blocks seen once)
+	eviction_queue_t cold[SHARD_COUNT];
+	//! The shards of the hot level (blocks seen more than once)
+	eviction_queue_t hot[SHARD_COUNT];
+	//! Round-robin counters for selecting the insertion/eviction shard
+	atomic<idx_t> insertion_count;
+	atomic<idx_t> eviction_count;
+
+	void Enqueue(BufferEvictionNode node, bool is_hot) {
+		auto &level = is_hot ? hot : cold;
+		level[++insertion_count % SHARD_COUNT].enqueue(std::move(node));
+	}
+
+	bool TryDequeue(BufferEvictionNode &node) {
+		// the cold level is drained before any hot block is considered for eviction
+		idx_t start = ++eviction_count;
+		for (idx_t i = 0; i < SHARD_COUNT; i++) {
+			if (cold[(start + i) % SHARD_COUNT].try_dequeue(node)) {
+				return true;
+			}
+		}
+		for (idx_t i = 0; i < SHARD_COUNT; i++) {
+			if (hot[(start + i) % SHARD_COUNT].try_dequeue(node)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//! The approximate total number of nodes in the queue, including stale nodes
+	idx_t ApproxSize() const {
+		idx_t total = 0;
+		for (idx_t i = 0; i < SHARD_COUNT; i++) {
+			total += cold[i].size_approx() + hot[i].size_approx();
+		}
+		return total;
+	}
+
+	//! Pop expired nodes from the front of every shard
+	void Purge() {
+		BufferEvictionNode node;
+		for (idx_t level_idx = 0; level_idx < 2; level_idx++) {
+			auto level = level_idx == 0 ? cold : hot;
+			for (idx_t i = 0; i < SHARD_COUNT; i++) {
+				while (level[i].try_dequeue(node)) {
+					auto handle = node.TryGetBlockHandle();
+					if (handle) {
+						// the node at the front of this shard is still alive: put it back and move on
+						level[i].enqueue(std::move(node));
+						break;
+					}
+				}
+			}
+		}
+	}
 };
 
 class TemporaryFileManager;
 
+//! Multiple temporary directories can be provided as a comma-separated list, in which case the temporary files are
+//! striped across the directories so that spilling aggregates the bandwidth of multiple disks
+static vector<string> SplitTemporaryDirectories(const string &temp_directory) {
+	auto result = StringUtil::Split(temp_directory, ',');
+	if (result.empty()) {
+		result.push_back(temp_directory);
+	}
+	return result;
+}
+
 class TemporaryDirectoryHandle {
 public:
 	TemporaryDirectoryHandle(DatabaseInstance &db, string path_p);
@@ -230,6 +311,7 @@ public:
 private:
 	DatabaseInstance &db;
 	string temp_directory;
+	vector<string> temp_directories;
 	unique_ptr<TemporaryFileManager> temp_file;
 };
 
@@ -391,7 +473,24 @@ void BufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size
 	D_ASSERT(handle->memory_usage == handle->buffer->AllocSize());
 }
 
+void BufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	unordered_set<BlockHandle *> seen;
+	for (auto &handle : handles) {
+		D_ASSERT(handle);
+		if (handle->IsLoaded()) {
+			// the block is already in memory: there is nothing to read ahead
+			continue;
+		}
+		if (!seen.insert(handle.get()).second) {
+			// the same block was requested multiple times: only hint it once
+			continue;
+		}
+		handle->block_manager.Prefetch(handle->BlockId());
+	}
+}
+
 BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
+	stats.pins.fetch_add(1, std::memory_order_relaxed);
 	idx_t required_memory;
 	{
 		// lock the block
@@ -400,6 +499,7 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			handle->readers++;
+			ThreadIOCounters::Get().cached_reads++;
 			return handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
@@ -415,14 +515,19 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
 		handle->readers++;
 		reservation.Resize(current_memory, 0);
+		ThreadIOCounters::Get().cached_reads++;
 		return handle->Load(handle);
 	}
 	// now we can actually load the current block
+	stats.misses.fetch_add(1, std::memory_order_relaxed);
+	ThreadIOCounters::Get().cold_reads++;
 	D_ASSERT(handle->readers == 0);
 	handle->readers = 1;
 	auto buf = handle->Load(handle, std::move(reusable_buffer));
 	handle->memory_charge = std::move(reservation);
 	// In the case of a variable sized block, the buffer may be smaller than a full block.
+	// Memory-mapped blocks do not own any memory at all (AllocSize is zero), which drops their charge entirely:
+	// the operating system manages their residency, so they should not count against the buffer pool.
 	int64_t delta = handle->buffer->AllocSize() - handle->memory_usage;
 	if (delta) {
 		D_ASSERT(delta < 0);
@@ -442,11 +547,18 @@ void BufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	if ((++queue_insertions % INSERT_INTERVAL) == 0) {
 		PurgeQueue();
 	}
-	queue->q.enqueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
+	// blocks that are unpinned for the first time enter the cold level of the queue
+	// blocks that were pinned again after having been unpinned are placed in the hot level instead
+	bool is_hot = handle->eviction_timestamp > 1;
+	queue->Enqueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp), is_hot);
 }
 
 void BufferManager::VerifyZeroReaders(shared_ptr<BlockHandle> &handle) {
 #ifdef DUCKDB_DEBUG_DESTROY_BLOCKS
+	if (handle->buffer->AllocSize() == 0) {
+		// the buffer wraps externally managed (read-only) memory that we can neither replace nor scribble over
+		return;
+	}
 	auto replacement_buffer = make_unique<FileBuffer>(Allocator::Get(db), handle->buffer->type,
 	                                                  handle->memory_usage - Storage::BLOCK_HEADER_SIZE);
 	memcpy(replacement_buffer->buffer, handle->buffer->buffer, handle->buffer->size);
@@ -474,7 +586,7 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
 	TempBufferPoolReservation r(current_memory, extra_memory);
 	while (current_memory > memory_limit) {
 		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		if (!queue->TryDequeue(node)) {
 			// Failed to reserve. Adjust size of temp reservation to 0.
 			r.Resize(current_memory, 0);
 			return {false, std::move(r)};
@@ -491,8 +603,10 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
 			continue;
 		}
 		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+		stats.evictions.fetch_add(1, std::memory_order_relaxed);
+		if (buffer && extra_memory > 0 && handle->buffer->AllocSize() == extra_memory) {
 			// we can actually re-use the memory directly!
+			// (externally backed buffers have an AllocSize of zero and own no re-usable memory)
 			*buffer = handle->UnloadAndTakeBlock();
 			return {true, std::move(r)};
 		} else {
@@ -504,19 +618,11 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
 }
 
 void BufferManager::PurgeQueue() {
-	BufferEvictionNode node;
-	while (true) {
-		if (!queue->q.try_dequeue(node)) {
-			break;
-		}
-		auto handle = node.TryGetBlockHandle();
-		if (!handle) {
-			continue;
-		} else {
-			queue->q.enqueue(std::move(node));
-			break;
-		}
-	}
+	queue->Purge();
+}
+
+idx_t BufferManager::EvictionQueueSize() {
+	return queue->ApproxSize();
 }
 
 void BlockManager::UnregisterBlock(block_id_t block_id, bool can_destroy) {
@@ -564,19 +670,51 @@ unique_ptr<FileBuffer> ReadTemporaryBufferInternal(BufferManager &buffer_manager
 	return buffer;
 }
 
+//! Compresses an evicted buffer before it is written to a temporary file, so that less temp I/O is performed.
+//! Returns nullptr if the buffer did not shrink, in which case it is written uncompressed.
+//! The compressed size is only kept in memory - temporary blocks never survive a restart.
+static unique_ptr<data_t[]> CompressTemporaryBuffer(FileBuffer &buffer, idx_t &compressed_size) {
+	auto bound = duckdb_miniz::mz_compressBound(buffer.size);
+	auto compressed = unique_ptr<data_t[]>(new data_t[bound]);
+	duckdb_miniz::mz_ulong mz_size = bound;
+	auto status =
+	    duckdb_miniz::mz_compress2(compressed.get(), &mz_size, buffer.buffer, buffer.size, duckdb_miniz::MZ_BEST_SPEED);
+	if (status != duckdb_miniz::MZ_OK || idx_t(mz_size) >= buffer.size) {
+		// compression failed or did not shrink the buffer: write it uncompressed
+		return nullptr;
+	}
+	compressed_size = mz_size;
+	return compressed;
+}
+
+static void DecompressTemporaryBuffer(data_ptr_t compressed, idx_t compressed_size, FileBuffer &buffer) {
+	duckdb_miniz::mz_ulong mz_size = buffer.size;
+	auto status = duckdb_miniz::mz_uncompress(buffer.buffer, &mz_size, compressed, compressed_size);
+	if (status != duckdb_miniz::MZ_OK || idx_t(mz_size) != buffer.size) {
+		throw IOException("Corrupt temporary file: failed to decompress temporary buffer");
+	}
+}
+
 struct TemporaryFileIndex {
 	explicit TemporaryFileIndex(idx_t file_index = DConstants::INVALID_INDEX,
-	                            idx_t block_index = DConstants::INVALID_INDEX)
-	    : file_index(file_index), block_index(block_index) {
+	                            idx_t block_index = DConstants::INVALID_INDEX,
+	                            idx_t compressed_size = DConstants::INVALID_INDEX)
+	    : file_index(file_index), block_index(block_index), compressed_size(compressed_size) {
 	}
 
 	idx_t file_index;
 	idx_t block_index;
+	//! The compressed size of the block within its slot, or INVALID_INDEX if it was written uncompressed
+	idx_t compressed_size;
 
 public:
 	bool IsValid() {
 		return block_index != DConstants::INVALID_INDEX;
 	}
+
+	bool IsCompressed() {
+		return compressed_size != DConstants::INVALID_INDEX;
+	}
 };
 
 struct BlockIndexManager {
@@ -678,16 +816,30 @@ public:
 		buffer.Write(*handle, GetPositionInFile(index.block_index));
 	}
 
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, idx_t block_index,
+	void WriteCompressedTemporaryFile(data_ptr_t compressed, TemporaryFileIndex index) {
+		D_ASSERT(index.compressed_size < Storage::BLOCK_SIZE);
+		handle->Write(compressed, index.compressed_size, GetPositionInFile(index.block_index));
+	}
+
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, TemporaryFileIndex index,
 	                                           unique_ptr<FileBuffer> reusable_buffer) {
-		auto buffer =
-		    ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-		                                Storage::BLOCK_SIZE, id, std::move(reusable_buffer));
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		unique_ptr<FileBuffer> buffer;
+		if (index.IsCompressed()) {
+			// the block was compressed when it was evicted: read the compressed data and decompress it
+			auto compressed = unique_ptr<data_t[]>(new data_t[index.compressed_size]);
+			handle->Read(compressed.get(), index.compressed_size, GetPositionInFile(index.block_index));
+			buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+			DecompressTemporaryBuffer(compressed.get(), index.compressed_size, *buffer);
+		} else {
+			buffer = ReadTemporaryBufferInternal(buffer_manager, *handle, GetPositionInFile(index.block_index),
+			                                     Storage::BLOCK_SIZE, id, std::move(reusable_buffer));
+		}
 		{
 			// remove the block (and potentially truncate the temp file)
 			TemporaryFileLock lock(file_lock);
 			D_ASSERT(handle);
-			RemoveTempBlockIndex(lock, block_index);
+			RemoveTempBlockIndex(lock, index.block_index);
 		}
 		return buffer;
 	}
@@ -743,8 +895,9 @@ private:
 
 class TemporaryFileManager {
 public:
-	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p)
-	    : db(db), temp_directory(temp_directory_p) {
+	TemporaryFileManager(DatabaseInstance &db, vector<string> temp_directories_p)
+	    : db(db), temp_directories(std::move(temp_directories_p)), directory_files(temp_directories.size()),
+	      next_directory_index(0) {
 	}
 
 public:
@@ -757,35 +910,51 @@ public:
 
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 		D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+		// compress the buffer before grabbing the manager lock, if enabled for this database
+		unique_ptr<data_t[]> compressed;
+		idx_t compressed_size = DConstants::INVALID_INDEX;
+		if (DBConfig::GetConfig(db).options.temp_file_compression) {
+			compressed = CompressTemporaryBuffer(buffer, compressed_size);
+		}
+
 		TemporaryFileIndex index;
 		TemporaryFileHandle *handle = nullptr;
 
 		{
 			TemporaryManagerLock lock(manager_lock);
-			// first check if we can write to an open existing file
-			for (auto &entry : files) {
-				auto &temp_file = entry.second;
+			// stripe the blocks across the configured temporary directories in round-robin fashion
+			auto dir_index = next_directory_index++ % temp_directories.size();
+			// first check if we can write to an open existing file in this directory
+			for (auto &file_index : directory_files[dir_index]) {
+				auto &temp_file = files[file_index];
 				index = temp_file->TryGetBlockIndex();
 				if (index.IsValid()) {
-					handle = entry.second.get();
+					handle = temp_file.get();
 					break;
 				}
 			}
 			if (!handle) {
 				// no existing handle to write to; we need to create & open a new file
 				auto new_file_index = index_manager.GetNewBlockIndex();
-				auto new_file = make_unique<TemporaryFileHandle>(db, temp_directory, new_file_index);
+				auto new_file = make_unique<TemporaryFileHandle>(db, temp_directories[dir_index], new_file_index);
 				handle = new_file.get();
 				files[new_file_index] = std::move(new_file);
+				directory_files[dir_index].push_back(new_file_index);
+				file_directories[new_file_index] = dir_index;
 
 				index = handle->TryGetBlockIndex();
 			}
+			index.compressed_size = compressed_size;
 			D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
 			used_blocks[block_id] = index;
 		}
 		D_ASSERT(handle);
 		D_ASSERT(index.IsValid());
-		handle->WriteTemporaryFile(buffer, index);
+		if (compressed) {
+			handle->WriteCompressedTemporaryFile(compressed.get(), index);
+		} else {
+			handle->WriteTemporaryFile(buffer, index);
+		}
 	}
 
 	bool HasTemporaryBuffer(block_id_t block_id) {
@@ -801,7 +970,7 @@ public:
 			index = GetTempBlockIndex(lock, id);
 			handle = GetFileHandle(lock, index.file_index);
 		}
-		auto buffer = handle->ReadTemporaryBuffer(id, index.block_index, std::move(reusable_buffer));
+		auto buffer = handle->ReadTemporaryBuffer(id, index, std::move(reusable_buffer));
 		{
 			// remove the block (and potentially erase the temp file)
 			TemporaryManagerLock lock(manager_lock);
@@ -837,13 +1006,25 @@ private:
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index) {
 		files.erase(file_index);
 		index_manager.RemoveIndex(file_index);
+		auto entry = file_directories.find(file_index);
+		if (entry != file_directories.end()) {
+			auto &dir_files = directory_files[entry->second];
+			dir_files.erase(std::find(dir_files.begin(), dir_files.end(), file_index));
+			file_directories.erase(entry);
+		}
 	}
 
 private:
 	DatabaseInstance &db;
 	mutex manager_lock;
-	//! The temporary directory
-	string temp_directory;
+	//! The temporary directories, with the temporary files striped across them
+	vector<string> temp_directories;
+	//! The file indexes of the active files per temporary directory
+	vector<vector<idx_t>> directory_files;
+	//! map of file index -> temporary directory index
+	unordered_map<idx_t, idx_t> file_directories;
+	//! The next directory to write a new block to
+	idx_t next_directory_index;
 	//! The set of active temporary file handles
 	unordered_map<idx_t, unique_ptr<TemporaryFileHandle>> files;
 	//! map of block_id -> temporary file position
@@ -853,19 +1034,24 @@ private:
 };
 
 TemporaryDirectoryHandle::TemporaryDirectoryHandle(DatabaseInstance &db, string path_p)
-    : db(db), temp_directory(std::move(path_p)), temp_file(make_unique<TemporaryFileManager>(db, temp_directory)) {
+    : db(db), temp_directory(std::move(path_p)), temp_directories(SplitTemporaryDirectories(temp_directory)),
+      temp_file(make_unique<TemporaryFileManager>(db, temp_directories)) {
 	auto &fs = FileSystem::GetFileSystem(db);
 	if (!temp_directory.empty()) {
-		fs.CreateDirectory(temp_directory);
+		for (auto &directory : temp_directories) {
+			fs.CreateDirectory(directory);
+		}
 	}
 }
 TemporaryDirectoryHandle::~TemporaryDirectoryHandle() {
 	// first release any temporary files
 	temp_file.reset();
-	// then delete the temporary file directory
+	// then delete the temporary file directories
 	auto &fs = FileSystem::GetFileSystem(db);
 	if (!temp_directory.empty()) {
-		fs.RemoveDirectory(temp_directory);
+		for (auto &directory : temp_directories) {
+			fs.RemoveDirectory(directory);
+		}
 	}
 }
 
@@ -875,7 +1061,10 @@ TemporaryFileManager &TemporaryDirectoryHandle::GetTempFile() {
 
 string BufferManager::GetTemporaryPath(block_id_t id) {
 	auto &fs = FileSystem::GetFileSystem(db);
-	return fs.JoinPath(temp_directory, to_string(id) + ".block");
+	// stripe the file over the temporary directories by block id, so reads find the file without extra bookkeeping
+	auto directories = SplitTemporaryDirectories(temp_directory);
+	auto &directory = directories[idx_t(id) % directories.size()];
+	return fs.JoinPath(directory, to_string(id) + ".block");
 }
 
 void BufferManager::RequireTemporaryDirectory() {
@@ -893,6 +1082,8 @@ void BufferManager::RequireTemporaryDirectory() {
 
 void BufferManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	RequireTemporaryDirectory();
+	stats.temp_bytes_written.fetch_add(buffer.size, std::memory_order_relaxed);
+	ThreadIOCounters::Get().spill_bytes_written += buffer.size;
 	if (buffer.size == Storage::BLOCK_SIZE) {
 		temp_directory_handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
 		return;
@@ -900,29 +1091,54 @@ void BufferManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer
 	// get the path to write to
 	auto path = GetTemporaryPath(block_id);
 	D_ASSERT(buffer.size > Storage::BLOCK_SIZE);
-	// create the file and write the size followed by the buffer contents
+	// create the file and write the size and compressed size followed by the buffer contents
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
 	handle->Write(&buffer.size, sizeof(idx_t), 0);
-	buffer.Write(*handle, sizeof(idx_t));
+	idx_t compressed_size = DConstants::INVALID_INDEX;
+	if (DBConfig::GetConfig(db).options.temp_file_compression) {
+		auto compressed = CompressTemporaryBuffer(buffer, compressed_size);
+		if (compressed) {
+			handle->Write(&compressed_size, sizeof(idx_t), sizeof(idx_t));
+			handle->Write(compressed.get(), compressed_size, sizeof(idx_t) * 2);
+			return;
+		}
+	}
+	handle->Write(&compressed_size, sizeof(idx_t), sizeof(idx_t));
+	buffer.Write(*handle, sizeof(idx_t) * 2);
 }
 
 unique_ptr<FileBuffer> BufferManager::ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer) {
 	D_ASSERT(!temp_directory.empty());
 	D_ASSERT(temp_directory_handle.get());
 	if (temp_directory_handle->GetTempFile().HasTemporaryBuffer(id)) {
+		stats.temp_bytes_read.fetch_add(Storage::BLOCK_SIZE, std::memory_order_relaxed);
+		ThreadIOCounters::Get().spill_bytes_read += Storage::BLOCK_SIZE;
 		return temp_directory_handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
 	}
 	idx_t block_size;
-	// open the temporary file and read the size
+	idx_t compressed_size;
+	// open the temporary file and read the size and compressed size
 	auto path = GetTemporaryPath(id);
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
 	handle->Read(&block_size, sizeof(idx_t), 0);
+	handle->Read(&compressed_size, sizeof(idx_t), sizeof(idx_t));
+	stats.temp_bytes_read.fetch_add(block_size, std::memory_order_relaxed);
+	ThreadIOCounters::Get().spill_bytes_read += block_size;
 
 	// now allocate a buffer of this size and read the data into that buffer
-	auto buffer =
-	    ReadTemporaryBufferInternal(*this, *handle, sizeof(idx_t), block_size, id, std::move(reusable_buffer));
+	unique_ptr<FileBuffer> buffer;
+	if (compressed_size != DConstants::INVALID_INDEX) {
+		// the buffer was compressed when it was evicted: read the compressed data and decompress it
+		auto compressed = unique_ptr<data_t[]>(new data_t[compressed_size]);
+		handle->Read(compressed.get(), compressed_size, sizeof(idx_t) * 2);
+		buffer = ConstructManagedBuffer(block_size, std::move(reusable_buffer));
+		DecompressTemporaryBuffer(compressed.get(), compressed_size, *buffer);
+	} else {
+		buffer = ReadTemporaryBufferInternal(*this, *handle, sizeof(idx_t) * 2, block_size, id,
+		                                     std::move(reusable_buffer));
+	}
 
 	handle.reset();
 	DeleteTemporaryFile(id);
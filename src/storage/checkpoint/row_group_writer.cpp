@@ -19,9 +19,8 @@ PartialBlockAllocation RowGroupWriter::GetBlockAllocation(uint32_t segment_size)
 	return partial_block_manager.GetBlockAllocation(segment_size);
 }
 
-void SingleFileRowGroupWriter::WriteColumnDataPointers(ColumnCheckpointState &column_checkpoint_state) {
+void SingleFileRowGroupWriter::WriteColumnDataPointers(const vector<DataPointer> &data_pointers) {
 	auto &meta_writer = table_data_writer;
-	const auto &data_pointers = column_checkpoint_state.data_pointers;
 
 	meta_writer.Write<idx_t>(data_pointers.size());
 	// then write the data pointers themselves
@@ -16,26 +16,30 @@
 namespace duckdb {
 
 TableDataReader::TableDataReader(MetaBlockReader &reader, BoundCreateTableInfo &info) : reader(reader), info(info) {
-	info.data = make_unique<PersistentTableData>(info.Base().columns.LogicalColumnCount());
 }
 
 void TableDataReader::ReadTableData() {
-	auto &columns = info.Base().columns;
+	info.data = ReadTableData(reader, info.Base().columns);
+}
+
+unique_ptr<PersistentTableData> TableDataReader::ReadTableData(MetaBlockReader &reader, const ColumnList &columns) {
 	D_ASSERT(!columns.empty());
+	auto data = make_unique<PersistentTableData>(columns.LogicalColumnCount());
 
 	// deserialize the total table statistics
-	info.data->column_stats.reserve(columns.PhysicalColumnCount());
+	data->column_stats.reserve(columns.PhysicalColumnCount());
 	for (auto &col : columns.Physical()) {
-		info.data->column_stats.push_back(BaseStatistics::Deserialize(reader, col.Type()));
+		data->column_stats.push_back(BaseStatistics::Deserialize(reader, col.Type()));
 	}
 
 	// deserialize each of the individual row groups
 	auto row_group_count = reader.Read<uint64_t>();
-	info.data->row_groups.reserve(row_group_count);
+	data->row_groups.reserve(row_group_count);
 	for (idx_t i = 0; i < row_group_count; i++) {
 		auto row_group_pointer = RowGroup::Deserialize(reader, columns);
-		info.data->row_groups.push_back(std::move(row_group_pointer));
+		data->row_groups.push_back(std::move(row_group_pointer));
 	}
+	return data;
 }
 
 } // namespace duckdb
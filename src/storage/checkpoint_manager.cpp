@@ -456,11 +456,11 @@ void CheckpointReader::ReadTableData(ClientContext &context, MetaBlockReader &re
 	auto block_id = reader.Read<block_id_t>();
 	auto offset = reader.Read<uint64_t>();
 
-	MetaBlockReader table_data_reader(reader.block_manager, block_id);
-	table_data_reader.offset = offset;
-	TableDataReader data_reader(table_data_reader, bound_info);
-
-	data_reader.ReadTableData();
+	// we only record where the table data lives here: the statistics and row group pointers are deserialized
+	// lazily when the table is first accessed
+	bound_info.data = make_unique<PersistentTableData>(bound_info.Base().columns.LogicalColumnCount());
+	bound_info.data->table_data_block = block_id;
+	bound_info.data->table_data_offset = offset;
 
 	// Get any indexes block info
 	idx_t num_indexes = reader.Read<idx_t>();
@@ -0,0 +1,611 @@
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+#include <cmath>
+#include <functional>
+
+namespace duckdb {
+
+//! ALP-style adaptive lossless floating-point compression: many real-world DOUBLE columns hold
+//! decimals-in-float (prices, percentages) that can be scaled by a power of ten into small
+//! integers, which are then frame-of-reference encoded and bitpacked. Values that do not
+//! round-trip exactly are stored verbatim as exceptions and patched back in during decoding.
+
+static constexpr const idx_t ALP_GROUP_SIZE = 1024;
+static constexpr const idx_t ALP_HEADER_SIZE = sizeof(idx_t);
+//! The maximum amount of values that is sampled per group to select the scaling exponent
+static constexpr const idx_t ALP_SAMPLE_COUNT = 32;
+
+template <class T>
+struct AlpTypeTraits {};
+
+template <>
+struct AlpTypeTraits<float> {
+	using EncodedType = int32_t;
+	static constexpr uint8_t MAX_EXPONENT = 10;
+	//! Scaled values beyond this magnitude can not be represented exactly anymore
+	static constexpr double ENCODED_BOUND = (double)(1 << 22);
+};
+
+template <>
+struct AlpTypeTraits<double> {
+	using EncodedType = int64_t;
+	static constexpr uint8_t MAX_EXPONENT = 18;
+	static constexpr double ENCODED_BOUND = (double)(1LL << 51);
+};
+
+static inline double AlpExponentValue(uint8_t exponent) {
+	static const double EXPONENT_VALUES[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+	                                         1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+	D_ASSERT(exponent <= 18);
+	return EXPONENT_VALUES[exponent];
+}
+
+//! Try to encode a value as round(value * 10^exponent): the encoding is only used when decoding
+//! by division reproduces the exact input value again
+template <class T>
+static inline bool AlpTryEncode(T value, uint8_t exponent, typename AlpTypeTraits<T>::EncodedType &result) {
+	double scaled = (double)value * AlpExponentValue(exponent);
+	if (!(scaled >= -AlpTypeTraits<T>::ENCODED_BOUND && scaled <= AlpTypeTraits<T>::ENCODED_BOUND)) {
+		// Out of the exactly roundable integer range, this also rejects NaN and infinity
+		return false;
+	}
+	auto encoded = (typename AlpTypeTraits<T>::EncodedType)std::nearbyint(scaled);
+	T decoded = (T)((double)encoded / AlpExponentValue(exponent));
+	if (decoded != value) {
+		return false;
+	}
+	// -0.0 compares equal to 0.0 but has a different bit pattern: store it as an exception
+	if (decoded == 0 && std::signbit(value)) {
+		return false;
+	}
+	result = encoded;
+	return true;
+}
+
+template <class T>
+struct AlpState;
+
+struct EmptyAlpWriter {
+	template <class T>
+	static void WriteGroup(AlpState<T> &state) {
+	}
+};
+
+template <class T>
+struct AlpState {
+public:
+	using ENC = typename AlpTypeTraits<T>::EncodedType;
+	using ENC_U = typename std::make_unsigned<ENC>::type;
+
+	AlpState() : total_size(0), data_ptr(nullptr) {
+		Reset();
+	}
+
+	T group_buffer[ALP_GROUP_SIZE];
+	ENC encoded_buffer[ALP_GROUP_SIZE];
+	uint16_t exception_positions[ALP_GROUP_SIZE];
+	T exception_values[ALP_GROUP_SIZE];
+	idx_t group_idx;
+	idx_t exception_count;
+	uint8_t exponent;
+	bitpacking_width_t width;
+	ENC frame_of_reference;
+	idx_t total_size;
+
+	// Stats on the valid values of the current group
+	T min_value;
+	T max_value;
+	bool has_valid;
+
+	// Used to pass CompressionState ptr through the Alp writer
+	void *data_ptr;
+
+public:
+	void Reset() {
+		group_idx = 0;
+		exception_count = 0;
+		exponent = 0;
+		width = 0;
+		frame_of_reference = 0;
+		min_value = NumericLimits<T>::Maximum();
+		max_value = NumericLimits<T>::Minimum();
+		has_valid = false;
+	}
+
+	//! Select the scaling exponent for the current group by scoring a small sample of its values
+	uint8_t ChooseExponent() {
+		idx_t stride = MaxValue<idx_t>(group_idx / ALP_SAMPLE_COUNT, 1);
+		uint8_t best_exponent = 0;
+		idx_t best_score = DConstants::INVALID_INDEX;
+		for (uint8_t candidate = 0; candidate <= AlpTypeTraits<T>::MAX_EXPONENT; candidate++) {
+			ENC min_encoded = NumericLimits<ENC>::Maximum();
+			ENC max_encoded = NumericLimits<ENC>::Minimum();
+			idx_t sampled = 0;
+			idx_t exceptions = 0;
+			for (idx_t i = 0; i < group_idx; i += stride) {
+				sampled++;
+				ENC encoded;
+				if (AlpTryEncode<T>(group_buffer[i], candidate, encoded)) {
+					min_encoded = MinValue<ENC>(min_encoded, encoded);
+					max_encoded = MaxValue<ENC>(max_encoded, encoded);
+				} else {
+					exceptions++;
+				}
+			}
+			bitpacking_width_t sample_width = 0;
+			if (exceptions < sampled) {
+				sample_width =
+				    BitpackingPrimitives::MinimumBitWidth<ENC_U>((ENC_U)max_encoded - (ENC_U)min_encoded);
+			}
+			// Estimated bits per sampled value: bitpacked size plus the verbatim exceptions
+			idx_t score = (sampled - exceptions) * sample_width + exceptions * (sizeof(T) + sizeof(uint16_t)) * 8;
+			if (score < best_score) {
+				best_score = score;
+				best_exponent = candidate;
+			}
+		}
+		return best_exponent;
+	}
+
+	//! Encode the entire group with the chosen exponent, collecting the exceptions
+	void EncodeGroup() {
+		exception_count = 0;
+		ENC min_encoded = NumericLimits<ENC>::Maximum();
+		ENC max_encoded = NumericLimits<ENC>::Minimum();
+		for (idx_t i = 0; i < group_idx; i++) {
+			if (AlpTryEncode<T>(group_buffer[i], exponent, encoded_buffer[i])) {
+				min_encoded = MinValue<ENC>(min_encoded, encoded_buffer[i]);
+				max_encoded = MaxValue<ENC>(max_encoded, encoded_buffer[i]);
+			} else {
+				exception_positions[exception_count] = (uint16_t)i;
+				exception_values[exception_count] = group_buffer[i];
+				exception_count++;
+			}
+		}
+		if (exception_count == group_idx) {
+			min_encoded = 0;
+			max_encoded = 0;
+		}
+		// Fill the exception slots with the frame of reference so they do not widen the bitwidth
+		for (idx_t i = 0; i < exception_count; i++) {
+			encoded_buffer[exception_positions[i]] = min_encoded;
+		}
+		frame_of_reference = min_encoded;
+		width = BitpackingPrimitives::MinimumBitWidth<ENC_U>((ENC_U)max_encoded - (ENC_U)min_encoded);
+		for (idx_t i = 0; i < group_idx; i++) {
+			encoded_buffer[i] -= frame_of_reference;
+		}
+	}
+
+	idx_t GroupDataSize() const {
+		idx_t result = 2 * sizeof(uint8_t) + sizeof(uint16_t) + sizeof(ENC);
+		result += BitpackingPrimitives::GetRequiredSize(group_idx, width);
+		result += exception_count * (sizeof(uint16_t) + sizeof(T));
+		return result;
+	}
+
+	template <class OP>
+	bool Flush() {
+		if (group_idx == 0) {
+			return true;
+		}
+		exponent = ChooseExponent();
+		EncodeGroup();
+		OP::WriteGroup(*this);
+		total_size += GroupDataSize() + sizeof(uint32_t);
+		return true;
+	}
+
+	template <class OP = EmptyAlpWriter>
+	bool Update(T value, bool is_valid) {
+		if (is_valid) {
+			min_value = MinValue<T>(min_value, value);
+			max_value = MaxValue<T>(max_value, value);
+			has_valid = true;
+		} else {
+			value = 0;
+		}
+		group_buffer[group_idx++] = value;
+
+		if (group_idx == ALP_GROUP_SIZE) {
+			bool success = Flush<OP>();
+			Reset();
+			return success;
+		}
+		return true;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct AlpAnalyzeState : public AnalyzeState {
+	AlpState<T> state;
+};
+
+template <class T>
+unique_ptr<AnalyzeState> AlpInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_unique<AlpAnalyzeState<T>>();
+}
+
+template <class T>
+bool AlpAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = (AlpAnalyzeState<T> &)state;
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = (T *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!analyze_state.state.template Update<EmptyAlpWriter>(data[idx], vdata.validity.RowIsValid(idx))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <class T>
+idx_t AlpFinalAnalyze(AnalyzeState &state) {
+	auto &analyze_state = (AlpAnalyzeState<T> &)state;
+	analyze_state.state.template Flush<EmptyAlpWriter>();
+	return ALP_HEADER_SIZE + analyze_state.state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct AlpCompressState : public CompressionState {
+public:
+	using ENC = typename AlpTypeTraits<T>::EncodedType;
+
+	explicit AlpCompressState(ColumnDataCheckpointer &checkpointer) : checkpointer(checkpointer) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto &config = DBConfig::GetConfig(db);
+		function = config.GetCompressionFunction(CompressionType::COMPRESSION_ALP, type.InternalType());
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+
+		state.data_ptr = (void *)this;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction *function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	// Ptr to next free spot in segment;
+	data_ptr_t data_ptr;
+	// Ptr to next free spot for storing the group offsets (growing downwards).
+	data_ptr_t metadata_ptr;
+
+	AlpState<T> state;
+
+public:
+	struct AlpWriter {
+		static void WriteGroup(AlpState<T> &alp_state) {
+			auto state = (AlpCompressState<T> *)alp_state.data_ptr;
+			state->WriteGroup(alp_state);
+		}
+	};
+
+	// Space remaining between the metadata_ptr growing down and data ptr growing up
+	idx_t RemainingSize() {
+		return metadata_ptr - data_ptr;
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + ALP_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + Storage::BLOCK_SIZE;
+	}
+
+	void WriteGroup(AlpState<T> &alp_state) {
+		auto bp_size = BitpackingPrimitives::GetRequiredSize(alp_state.group_idx, alp_state.width);
+		idx_t data_bytes = alp_state.GroupDataSize();
+		FlushAndCreateSegmentIfFull(data_bytes + sizeof(uint32_t));
+
+		// Store the offset of the group so that scans can skip entire groups without parsing them
+		metadata_ptr -= sizeof(uint32_t);
+		Store<uint32_t>((uint32_t)(data_ptr - handle.Ptr()), metadata_ptr);
+
+		Store<uint8_t>(alp_state.exponent, data_ptr);
+		data_ptr += sizeof(uint8_t);
+		Store<uint8_t>(alp_state.width, data_ptr);
+		data_ptr += sizeof(uint8_t);
+		Store<uint16_t>((uint16_t)alp_state.exception_count, data_ptr);
+		data_ptr += sizeof(uint16_t);
+		Store<ENC>(alp_state.frame_of_reference, data_ptr);
+		data_ptr += sizeof(ENC);
+
+		BitpackingPrimitives::PackBuffer<ENC, false>(data_ptr, alp_state.encoded_buffer, alp_state.group_idx,
+		                                             alp_state.width);
+		data_ptr += bp_size;
+
+		memcpy(data_ptr, alp_state.exception_positions, alp_state.exception_count * sizeof(uint16_t));
+		data_ptr += alp_state.exception_count * sizeof(uint16_t);
+		memcpy(data_ptr, alp_state.exception_values, alp_state.exception_count * sizeof(T));
+		data_ptr += alp_state.exception_count * sizeof(T);
+
+		current_segment->count += alp_state.group_idx;
+		if (alp_state.has_valid) {
+			NumericStatistics::Update<T>(current_segment->stats, alp_state.min_value);
+			NumericStatistics::Update<T>(current_segment->stats, alp_state.max_value);
+		}
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = (T *)vdata.data;
+
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			state.template Update<AlpCompressState<T>::AlpWriter>(data[idx], vdata.validity.RowIsValid(idx));
+		}
+	}
+
+	void FlushAndCreateSegmentIfFull(idx_t required_space) {
+		if (RemainingSize() < required_space) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// Compact the segment by moving the metadata next to the data.
+		idx_t metadata_offset = AlignValue(data_ptr - base_ptr);
+		idx_t metadata_size = base_ptr + Storage::BLOCK_SIZE - metadata_ptr;
+		idx_t total_segment_size = metadata_offset + metadata_size;
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+
+		// Store the offset of the metadata of the first group (which is at the highest address).
+		Store<idx_t>(metadata_offset + metadata_size, base_ptr);
+		handle.Destroy();
+
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		state.template Flush<AlpCompressState<T>::AlpWriter>();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> AlpInitCompression(ColumnDataCheckpointer &checkpointer, unique_ptr<AnalyzeState> state) {
+	return make_unique<AlpCompressState<T>>(checkpointer);
+}
+
+template <class T>
+void AlpCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = (AlpCompressState<T> &)state_p;
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void AlpFinalizeCompress(CompressionState &state_p) {
+	auto &state = (AlpCompressState<T> &)state_p;
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct AlpScanState : public SegmentScanState {
+public:
+	using ENC = typename AlpTypeTraits<T>::EncodedType;
+
+	explicit AlpScanState(ColumnSegment &segment) : segment(segment), count(segment.count) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+
+		handle = buffer_manager.Pin(segment.block);
+		segment_data = handle.Ptr() + segment.GetBlockOffset();
+		// The metadata of the first group sits at the highest address
+		metadata_ptr = segment_data + Load<idx_t>(segment_data) - sizeof(uint32_t);
+	}
+
+	BufferHandle handle;
+	data_ptr_t metadata_ptr;
+	data_ptr_t segment_data;
+	idx_t total_value_count = 0;
+	idx_t group_offset = 0;
+
+	T values[ALP_GROUP_SIZE];
+	ENC encoded_buffer[ALP_GROUP_SIZE];
+
+	ColumnSegment &segment;
+	idx_t count;
+
+	idx_t LeftInGroup() const {
+		return ALP_GROUP_SIZE - (total_value_count % ALP_GROUP_SIZE);
+	}
+
+	inline bool GroupFinished() const {
+		return (total_value_count % ALP_GROUP_SIZE) == 0;
+	}
+
+	//! Load and decode the next group into the values buffer
+	void LoadGroup() {
+		auto group_ptr = segment_data + Load<uint32_t>(metadata_ptr);
+		metadata_ptr -= sizeof(uint32_t);
+
+		auto exponent = Load<uint8_t>(group_ptr);
+		group_ptr += sizeof(uint8_t);
+		auto width = (bitpacking_width_t)Load<uint8_t>(group_ptr);
+		group_ptr += sizeof(uint8_t);
+		auto exception_count = Load<uint16_t>(group_ptr);
+		group_ptr += sizeof(uint16_t);
+		auto frame_of_reference = Load<ENC>(group_ptr);
+		group_ptr += sizeof(ENC);
+
+		idx_t group_size = MinValue((idx_t)ALP_GROUP_SIZE, count - total_value_count);
+
+		// Values were stored offset against the frame of reference, sign extension can be skipped
+		BitpackingPrimitives::UnPackBuffer<ENC>((data_ptr_t)encoded_buffer, group_ptr, group_size, width, true);
+		group_ptr += BitpackingPrimitives::GetRequiredSize(group_size, width);
+
+		// Decode by division: the compressor verified that this reproduces the input exactly
+		for (idx_t i = 0; i < group_size; i++) {
+			values[i] = (T)((double)(encoded_buffer[i] + frame_of_reference) / AlpExponentValue(exponent));
+		}
+
+		// Patch the values that could not be encoded
+		auto position_ptr = group_ptr;
+		auto exception_ptr = group_ptr + exception_count * sizeof(uint16_t);
+		for (idx_t i = 0; i < exception_count; i++) {
+			auto position = Load<uint16_t>(position_ptr + i * sizeof(uint16_t));
+			values[position] = Load<T>(exception_ptr + i * sizeof(T));
+		}
+		group_offset = 0;
+	}
+
+	template <bool SKIP = false>
+	void ScanGroup(T *result, idx_t scan_count) {
+		D_ASSERT(scan_count <= ALP_GROUP_SIZE);
+		D_ASSERT(scan_count <= LeftInGroup());
+
+		if (GroupFinished() && total_value_count < count) {
+			LoadGroup();
+		}
+		if (!SKIP) {
+			memcpy(result, values + group_offset, scan_count * sizeof(T));
+		}
+		group_offset += scan_count;
+		total_value_count += scan_count;
+	}
+
+	// Using the metadata, we can skip entire groups without decoding them
+	void SkipGroup() {
+		metadata_ptr -= sizeof(uint32_t);
+		total_value_count += MinValue((idx_t)ALP_GROUP_SIZE, count - total_value_count);
+	}
+
+	//! Skip the next 'skip_count' values, we don't store the values
+	void Skip(ColumnSegment &segment, idx_t skip_count) {
+		if (total_value_count != 0 && !GroupFinished()) {
+			// Finish skipping the current group
+			idx_t to_skip = MinValue(skip_count, LeftInGroup());
+			ScanGroup<true>(nullptr, to_skip);
+			skip_count -= to_skip;
+		}
+		// For entire groups, we don't need to decode any of the values
+		idx_t groups_to_skip = skip_count / ALP_GROUP_SIZE;
+		for (idx_t i = 0; i < groups_to_skip; i++) {
+			SkipGroup();
+		}
+		skip_count -= ALP_GROUP_SIZE * groups_to_skip;
+		if (skip_count == 0) {
+			return;
+		}
+		// For the last group that this skip (partially) touches, we do need to decode the group
+		ScanGroup<true>(nullptr, skip_count);
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> AlpInitScan(ColumnSegment &segment) {
+	auto result = make_unique_base<SegmentScanState, AlpScanState<T>>(segment);
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                    idx_t result_offset) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		const idx_t to_scan = MinValue(scan_count - scanned, scan_state.LeftInGroup());
+
+		scan_state.template ScanGroup<false>(result_data + result_offset + scanned, to_scan);
+		scanned += to_scan;
+	}
+}
+
+template <class T>
+void AlpScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	AlpScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+template <class T>
+void AlpSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+	scan_state.Skip(segment, skip_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	AlpScanState<T> scan_state(segment);
+	scan_state.Skip(segment, row_id);
+	auto result_data = FlatVector::GetData<T>(result);
+
+	if (scan_state.GroupFinished() && scan_state.total_value_count < scan_state.count) {
+		scan_state.LoadGroup();
+	}
+	result_data[result_idx] = scan_state.values[scan_state.group_offset];
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetAlpFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_ALP, data_type, AlpInitAnalyze<T>, AlpAnalyze<T>,
+	                           AlpFinalAnalyze<T>, AlpInitCompression<T>, AlpCompress<T>, AlpFinalizeCompress<T>,
+	                           AlpInitScan<T>, AlpScan<T>, AlpScanPartial<T>, AlpFetchRow<T>, AlpSkip<T>);
+}
+
+CompressionFunction AlpCompressionFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+		return GetAlpFunction<float>(type);
+	case PhysicalType::DOUBLE:
+		return GetAlpFunction<double>(type);
+	default:
+		throw InternalException("Unsupported type for ALP");
+	}
+}
+
+bool AlpCompressionFun::TypeIsSupported(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
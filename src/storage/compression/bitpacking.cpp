@@ -29,6 +29,8 @@ BitpackingMode BitpackingModeFromString(const string &str) {
 		return BitpackingMode::CONSTANT_DELTA;
 	} else if (mode == "delta_for") {
 		return BitpackingMode::DELTA_FOR;
+	} else if (mode == "delta_delta_for") {
+		return BitpackingMode::DELTA_DELTA_FOR;
 	} else if (mode == "for") {
 		return BitpackingMode::FOR;
 	} else {
@@ -46,6 +48,8 @@ string BitpackingModeToString(const BitpackingMode &mode) {
 		return "constant_delta";
 	case (BitpackingMode::DELTA_FOR):
 		return "delta_for";
+	case (BitpackingMode::DELTA_DELTA_FOR):
+		return "delta_delta_for";
 	case (BitpackingMode::FOR):
 		return "for";
 	default:
@@ -85,6 +89,10 @@ struct EmptyBitpackingWriter {
 	static void WriteDeltaFor(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference,
 	                          T_S delta_offset, T *original_values, idx_t count, void *data_ptr) {
 	}
+	template <class T, class T_S = typename std::make_signed<T>::type>
+	static void WriteDeltaDeltaFor(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference,
+	                               T_S delta_offset, T_S value_offset, T *original_values, idx_t count, void *data_ptr) {
+	}
 	template <class T>
 	static void WriteFor(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference, idx_t count,
 	                     void *data_ptr) {
@@ -104,6 +112,7 @@ public:
 	T compression_buffer_internal[BITPACKING_METADATA_GROUP_SIZE + 1];
 	T *compression_buffer;
 	T_S delta_buffer[BITPACKING_METADATA_GROUP_SIZE];
+	T_S delta_delta_buffer[BITPACKING_METADATA_GROUP_SIZE];
 	bool compression_buffer_validity[BITPACKING_METADATA_GROUP_SIZE];
 	idx_t compression_buffer_idx;
 	idx_t total_size;
@@ -119,11 +128,17 @@ public:
 	T_S maximum_delta;
 	T_S min_max_delta_diff;
 	T_S delta_offset;
+	T_S minimum_delta_delta;
+	T_S maximum_delta_delta;
+	T_S min_max_delta_delta_diff;
+	T_S delta_delta_offset;
+	T_S value_offset;
 	bool all_valid;
 	bool all_invalid;
 
 	bool can_do_delta;
 	bool can_do_for;
+	bool can_do_delta_delta;
 
 	// Used to force a specific mode, useful in testing
 	BitpackingMode mode = BitpackingMode::AUTO;
@@ -135,13 +150,19 @@ public:
 		maximum = NumericLimits<T>::Minimum();
 		maximum_delta = NumericLimits<T_S>::Minimum();
 		delta_offset = 0;
+		minimum_delta_delta = NumericLimits<T_S>::Maximum();
+		maximum_delta_delta = NumericLimits<T_S>::Minimum();
+		delta_delta_offset = 0;
+		value_offset = 0;
 		all_valid = true;
 		all_invalid = true;
 		can_do_delta = false;
 		can_do_for = false;
+		can_do_delta_delta = false;
 		compression_buffer_idx = 0;
 		min_max_diff = 0;
 		min_max_delta_diff = 0;
+		min_max_delta_delta_diff = 0;
 	}
 
 	void CalculateFORStats() {
@@ -209,6 +230,56 @@ public:
 		    can_do_delta && TrySubtractOperator::Operation((T_S)(compression_buffer[0]), minimum_delta, delta_offset);
 	}
 
+	void CalculateDeltaDeltaStats() {
+		// Second-order deltas: these are small for nearly monotonic sequences (e.g. event timestamps)
+		// whose first-order deltas drift, in which case delta-of-delta needs a far smaller bitwidth
+		if (!can_do_delta) {
+			return;
+		}
+
+		// With fewer than 3 values there are no second-order deltas to speak of
+		if (compression_buffer_idx < 3) {
+			return;
+		}
+
+		for (int64_t i = 2; i < (int64_t)compression_buffer_idx; i++) {
+			auto success = TrySubtractOperator::Operation(delta_buffer[i], delta_buffer[i - 1], delta_delta_buffer[i]);
+			if (!success) {
+				return;
+			}
+		}
+
+		for (int64_t i = 2; i < (int64_t)compression_buffer_idx; i++) {
+			maximum_delta_delta = MaxValue<T_S>(maximum_delta_delta, delta_delta_buffer[i]);
+			minimum_delta_delta = MinValue<T_S>(minimum_delta_delta, delta_delta_buffer[i]);
+		}
+
+		if (!TrySubtractOperator::Operation(maximum_delta_delta, minimum_delta_delta, min_max_delta_delta_diff)) {
+			return;
+		}
+
+		// The first two positions carry no real second-order delta, pick one from the current domain
+		// and adjust the decoding seeds so that the first value and first delta still decode correctly
+		delta_delta_buffer[0] = minimum_delta_delta;
+		delta_delta_buffer[1] = minimum_delta_delta;
+
+		// first_delta decodes to delta_buffer[1] again: delta_delta_offset + delta_delta_buffer[0] == first_delta
+		// and first_delta + delta_delta_buffer[1] == delta_buffer[1]
+		T_S first_delta;
+		if (!TrySubtractOperator::Operation(delta_buffer[1], minimum_delta_delta, first_delta)) {
+			return;
+		}
+		if (!TrySubtractOperator::Operation(first_delta, minimum_delta_delta, delta_delta_offset)) {
+			return;
+		}
+		// value_offset + first_delta decodes to the original first value again
+		if (!TrySubtractOperator::Operation((T_S)(compression_buffer[0]), first_delta, value_offset)) {
+			return;
+		}
+
+		can_do_delta_delta = true;
+	}
+
 	template <class T_INNER>
 	void SubtractFrameOfReference(T_INNER *buffer, T_INNER frame_of_reference) {
 		for (idx_t i = 0; i < compression_buffer_idx; i++) {
@@ -232,7 +303,8 @@ public:
 		CalculateDeltaStats();
 
 		if (can_do_delta) {
-			if (maximum_delta == minimum_delta && mode != BitpackingMode::FOR && mode != BitpackingMode::DELTA_FOR) {
+			if (maximum_delta == minimum_delta && mode != BitpackingMode::FOR && mode != BitpackingMode::DELTA_FOR &&
+			    mode != BitpackingMode::DELTA_DELTA_FOR) {
 				idx_t frame_of_reference = compression_buffer[0];
 				OP::WriteConstantDelta((T_S)maximum_delta, (T)frame_of_reference, compression_buffer_idx,
 				                       (T *)compression_buffer, (bool *)compression_buffer_validity, data_ptr);
@@ -244,7 +316,33 @@ public:
 			auto delta_required_bitwidth = BitpackingPrimitives::MinimumBitWidth<T_U>(min_max_delta_diff);
 			auto regular_required_bitwidth = BitpackingPrimitives::MinimumBitWidth(min_max_diff);
 
-			if (delta_required_bitwidth < regular_required_bitwidth && mode != BitpackingMode::FOR) {
+			CalculateDeltaDeltaStats();
+			if (can_do_delta_delta) {
+				auto delta_delta_required_bitwidth =
+				    BitpackingPrimitives::MinimumBitWidth<T_U>(min_max_delta_delta_diff);
+
+				if (delta_delta_required_bitwidth < delta_required_bitwidth &&
+				    delta_delta_required_bitwidth < regular_required_bitwidth && mode != BitpackingMode::FOR &&
+				    mode != BitpackingMode::DELTA_FOR) {
+					SubtractFrameOfReference(delta_delta_buffer, minimum_delta_delta);
+
+					OP::WriteDeltaDeltaFor((T *)delta_delta_buffer, compression_buffer_validity,
+					                       delta_delta_required_bitwidth, (T)minimum_delta_delta, delta_delta_offset,
+					                       value_offset, (T *)compression_buffer, compression_buffer_idx, data_ptr);
+
+					total_size +=
+					    BitpackingPrimitives::GetRequiredSize(compression_buffer_idx, delta_delta_required_bitwidth);
+					total_size += sizeof(T);                              // FOR value
+					total_size += sizeof(T);                              // Delta offset value
+					total_size += sizeof(T);                              // Value offset value
+					total_size += AlignValue(sizeof(bitpacking_width_t)); // FOR value
+
+					return true;
+				}
+			}
+
+			if (delta_required_bitwidth < regular_required_bitwidth && mode != BitpackingMode::FOR &&
+			    mode != BitpackingMode::DELTA_DELTA_FOR) {
 				SubtractFrameOfReference(delta_buffer, minimum_delta);
 
 				OP::WriteDeltaFor((T *)delta_buffer, compression_buffer_validity, delta_required_bitwidth,
@@ -415,6 +513,26 @@ public:
 			UpdateStats(state, count);
 		}
 
+		static void WriteDeltaDeltaFor(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference,
+		                               T_S delta_offset, T_S value_offset, T *original_values, idx_t count,
+		                               void *data_ptr) {
+			auto state = (BitpackingCompressState<T> *)data_ptr;
+
+			auto bp_size = BitpackingPrimitives::GetRequiredSize(count, width);
+			ReserveSpace(state, bp_size + 4 * sizeof(T));
+
+			WriteMetaData(state, BitpackingMode::DELTA_DELTA_FOR);
+			WriteData(state->data_ptr, frame_of_reference);
+			WriteData(state->data_ptr, (T)width);
+			WriteData(state->data_ptr, delta_offset);
+			WriteData(state->data_ptr, value_offset);
+
+			BitpackingPrimitives::PackBuffer<T, false>(state->data_ptr, values, count, width);
+			state->data_ptr += bp_size;
+
+			UpdateStats(state, count);
+		}
+
 		static void WriteFor(T *values, bool *validity, bitpacking_width_t width, T frame_of_reference, idx_t count,
 		                     void *data_ptr) {
 			auto state = (BitpackingCompressState<T> *)data_ptr;
@@ -607,6 +725,8 @@ public:
 	T current_frame_of_reference;
 	T current_constant;
 	T current_delta_offset;
+	//! The last decoded delta (only used for the DELTA_DELTA_FOR mode)
+	T current_delta;
 
 	idx_t current_group_offset = 0;
 	data_ptr_t current_group_ptr;
@@ -634,6 +754,7 @@ public:
 		case BitpackingMode::FOR:
 		case BitpackingMode::CONSTANT_DELTA:
 		case BitpackingMode::DELTA_FOR:
+		case BitpackingMode::DELTA_DELTA_FOR:
 			current_frame_of_reference = *(T *)(current_group_ptr);
 			current_group_ptr += sizeof(T);
 			break;
@@ -649,6 +770,7 @@ public:
 			break;
 		case BitpackingMode::FOR:
 		case BitpackingMode::DELTA_FOR:
+		case BitpackingMode::DELTA_DELTA_FOR:
 			current_width = (bitpacking_width_t) * (T *)(current_group_ptr);
 			current_group_ptr += MaxValue(sizeof(T), sizeof(bitpacking_width_t));
 			break;
@@ -662,6 +784,12 @@ public:
 		if (current_group.mode == BitpackingMode::DELTA_FOR) {
 			current_delta_offset = *(T *)(current_group_ptr);
 			current_group_ptr += sizeof(T);
+		} else if (current_group.mode == BitpackingMode::DELTA_DELTA_FOR) {
+			// Delta-of-delta groups store two decoding seeds: the initial delta and the initial value
+			current_delta = *(T *)(current_group_ptr);
+			current_group_ptr += sizeof(T);
+			current_delta_offset = *(T *)(current_group_ptr);
+			current_group_ptr += sizeof(T);
 		}
 	}
 
@@ -669,7 +797,8 @@ public:
 		while (skip_count > 0) {
 			if (current_group_offset + skip_count < BITPACKING_METADATA_GROUP_SIZE) {
 				// Skipping Delta FOR requires a bit of decoding to figure out the new delta
-				if (current_group.mode == BitpackingMode::DELTA_FOR) {
+				if (current_group.mode == BitpackingMode::DELTA_FOR ||
+				    current_group.mode == BitpackingMode::DELTA_DELTA_FOR) {
 					// if current_group_offset points into the middle of a
 					// BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE, we need to scan a few
 					// values before current_group_offset to align with the algorithm groups
@@ -687,6 +816,12 @@ public:
 
 					ApplyFrameOfReference<T_S>((T_S *)&decompression_buffer[extra_count], current_frame_of_reference,
 					                           skip_count);
+					if (current_group.mode == BitpackingMode::DELTA_DELTA_FOR) {
+						// First reconstruct the deltas from the second-order deltas
+						DeltaDecode<T_S>((T_S *)&decompression_buffer[extra_count], (T_S)current_delta,
+						                 (idx_t)skip_count);
+						current_delta = decompression_buffer[extra_count + skip_count - 1];
+					}
 					DeltaDecode<T_S>((T_S *)&decompression_buffer[extra_count], (T_S)current_delta_offset,
 					                 (idx_t)skip_count);
 					current_delta_offset = decompression_buffer[extra_count + skip_count - 1];
@@ -751,7 +886,7 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 			idx_t remaining = scan_count - scanned;
 			idx_t to_scan = MinValue(remaining, BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
 			T *begin = result_data + result_offset + scanned;
-			T *end = begin + remaining;
+			T *end = begin + to_scan;
 			std::fill(begin, end, scan_state.current_constant);
 			scanned += to_scan;
 			scan_state.current_group_offset += to_scan;
@@ -772,7 +907,8 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 			continue;
 		}
 		D_ASSERT(scan_state.current_group.mode == BitpackingMode::FOR ||
-		         scan_state.current_group.mode == BitpackingMode::DELTA_FOR);
+		         scan_state.current_group.mode == BitpackingMode::DELTA_FOR ||
+		         scan_state.current_group.mode == BitpackingMode::DELTA_DELTA_FOR);
 
 		idx_t to_scan = MinValue<idx_t>(scan_count - scanned, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE -
 		                                                          offset_in_compression_group);
@@ -786,8 +922,13 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 
 		if (to_scan == BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE && offset_in_compression_group == 0) {
 			// Decompress directly into result vector
-			BitpackingPrimitives::UnPackBlock<T>((data_ptr_t)current_result_ptr, decompression_group_start_pointer,
-			                                     scan_state.current_width, skip_sign_extend);
+			// scan as many contiguous algorithm groups as possible in one go: this unpacks all
+			// groups back-to-back and applies the frame of reference over the entire range at once
+			idx_t group_limit = MinValue<idx_t>(scan_count - scanned,
+			                                    BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+			to_scan = BitpackingPrimitives::RoundDownToAlgorithmGroupSize(group_limit);
+			BitpackingPrimitives::UnPackBuffer<T>((data_ptr_t)current_result_ptr, decompression_group_start_pointer,
+			                                      to_scan, scan_state.current_width, skip_sign_extend);
 		} else {
 			// Decompress compression algorithm to buffer
 			BitpackingPrimitives::UnPackBlock<T>((data_ptr_t)scan_state.decompression_buffer,
@@ -802,6 +943,13 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 			ApplyFrameOfReference<T_S>((T_S *)current_result_ptr, (T_S)scan_state.current_frame_of_reference, to_scan);
 			DeltaDecode<T_S>((T_S *)current_result_ptr, (T_S)scan_state.current_delta_offset, to_scan);
 			scan_state.current_delta_offset = ((T *)current_result_ptr)[to_scan - 1];
+		} else if (scan_state.current_group.mode == BitpackingMode::DELTA_DELTA_FOR) {
+			ApplyFrameOfReference<T_S>((T_S *)current_result_ptr, (T_S)scan_state.current_frame_of_reference, to_scan);
+			// Reconstruct the deltas from the second-order deltas, then the values from the deltas
+			DeltaDecode<T_S>((T_S *)current_result_ptr, (T_S)scan_state.current_delta, to_scan);
+			scan_state.current_delta = ((T *)current_result_ptr)[to_scan - 1];
+			DeltaDecode<T_S>((T_S *)current_result_ptr, (T_S)scan_state.current_delta_offset, to_scan);
+			scan_state.current_delta_offset = ((T *)current_result_ptr)[to_scan - 1];
 		} else {
 			ApplyFrameOfReference<T>(current_result_ptr, scan_state.current_frame_of_reference, to_scan);
 		}
@@ -849,7 +997,8 @@ void BitpackingFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t r
 	}
 
 	D_ASSERT(scan_state.current_group.mode == BitpackingMode::FOR ||
-	         scan_state.current_group.mode == BitpackingMode::DELTA_FOR);
+	         scan_state.current_group.mode == BitpackingMode::DELTA_FOR ||
+	         scan_state.current_group.mode == BitpackingMode::DELTA_DELTA_FOR);
 
 	BitpackingPrimitives::UnPackBlock<T>((data_ptr_t)scan_state.decompression_buffer, decompression_group_start_pointer,
 	                                     scan_state.current_width, skip_sign_extend);
@@ -859,6 +1008,9 @@ void BitpackingFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t r
 
 	if (scan_state.current_group.mode == BitpackingMode::DELTA_FOR) {
 		*current_result_ptr += scan_state.current_delta_offset;
+	} else if (scan_state.current_group.mode == BitpackingMode::DELTA_DELTA_FOR) {
+		// The unpacked value is a second-order delta: add the previous delta and the previous value
+		*current_result_ptr += scan_state.current_delta + scan_state.current_delta_offset;
 	}
 }
 template <class T>
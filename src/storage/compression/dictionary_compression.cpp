@@ -5,6 +5,7 @@
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/segment/uncompressed.hpp"
 #include "duckdb/storage/string_uncompressed.hpp"
 #include "duckdb/storage/table/append_state.hpp"
@@ -100,6 +101,7 @@ struct DictionaryCompressionStorage {
 	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
 	static void FinalizeCompress(CompressionState &state_p);
 
+	static unique_ptr<CompressedSegmentState> StringInitSegment(ColumnSegment &segment, block_id_t block_id);
 	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
 	template <bool ALLOW_DICT_VECTORS>
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
@@ -128,7 +130,9 @@ struct DictionaryCompressionStorage {
 // the unique strings without lenghts or null termination as we can deduce the lengths from the index buffer. The
 // addition of the selection buffer is done for two reasons: firstly, to allow the scan to emit dictionary vectors by
 // scanning the whole dictionary at once and then scanning the selection buffer for each emitted vector. Secondly, it
-// allows for efficient bitpacking compression as the selection values should remain relatively small.
+// allows for efficient bitpacking compression as the selection values should remain relatively small. When a
+// segment is finalized its dictionary is sorted, making the indices order-preserving: pushed down comparisons can
+// then be answered with a single binary search of the dictionary followed by integer comparisons on the indices.
 struct DictionaryCompressionCompressState : public DictionaryCompressionState {
 	explicit DictionaryCompressionCompressState(ColumnDataCheckpointer &checkpointer)
 	    : checkpointer(checkpointer), heap(BufferAllocator::Get(checkpointer.GetDatabase())) {
@@ -261,11 +265,57 @@ public:
 		}
 	}
 
+	//! Rewrite the dictionary in sorted order so that the indices are order-preserving, remapping the
+	//! index buffer and the selection buffer accordingly
+	void SortDictionary(BufferHandle &handle) {
+		if (index_buffer.size() <= 2) {
+			// only the null index and at most one string: nothing to sort
+			return;
+		}
+		auto dict_end_ptr = handle.Ptr() + current_dictionary.end;
+
+		// determine the sort order of the indices (index 0 remains reserved for null strings)
+		vector<uint32_t> order;
+		order.reserve(index_buffer.size() - 1);
+		for (uint32_t i = 1; i < index_buffer.size(); i++) {
+			order.push_back(i);
+		}
+		std::sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) {
+			string_t left((const char *)(dict_end_ptr - index_buffer[lhs]), index_buffer[lhs] - index_buffer[lhs - 1]);
+			string_t right((const char *)(dict_end_ptr - index_buffer[rhs]), index_buffer[rhs] - index_buffer[rhs - 1]);
+			return LessThan::Operation(left, right);
+		});
+
+		// rewrite the dictionary and the index buffer in sorted order
+		auto sorted_dictionary = unique_ptr<data_t[]>(new data_t[current_dictionary.size]);
+		vector<uint32_t> sorted_index_buffer(index_buffer.size(), 0);
+		vector<uint32_t> index_map(index_buffer.size(), 0);
+		uint32_t offset = 0;
+		for (idx_t i = 0; i < order.size(); i++) {
+			auto old_index = order[i];
+			auto length = index_buffer[old_index] - index_buffer[old_index - 1];
+			offset += length;
+			memcpy(sorted_dictionary.get() + current_dictionary.size - offset,
+			       dict_end_ptr - index_buffer[old_index], length);
+			sorted_index_buffer[i + 1] = offset;
+			index_map[old_index] = i + 1;
+		}
+		memcpy(dict_end_ptr - current_dictionary.size, sorted_dictionary.get(), current_dictionary.size);
+		index_buffer = std::move(sorted_index_buffer);
+
+		// remap the selection buffer onto the sorted indices
+		for (auto &selection : selection_buffer) {
+			selection = index_map[selection];
+		}
+	}
+
 	idx_t Finalize() {
 		auto &buffer_manager = BufferManager::GetBufferManager(checkpointer.GetDatabase());
 		auto handle = buffer_manager.Pin(current_segment->block);
 		D_ASSERT(current_dictionary.end == Storage::BLOCK_SIZE);
 
+		SortDictionary(handle);
+
 		// calculate sizes
 		auto compressed_selection_buffer_size =
 		    BitpackingPrimitives::GetRequiredSize(current_segment->count, current_width);
@@ -425,17 +475,63 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 	state.Flush(true);
 }
 
+//===--------------------------------------------------------------------===//
+// Segment State
+//===--------------------------------------------------------------------===//
+//! When the dictionary cache is enabled, the dictionary of a persistent segment is decoded into
+//! memory once and shared by all scans of the segment instead of being rebuilt per scan
+struct DictionarySegmentState : public CompressedSegmentState {
+	explicit DictionarySegmentState(DatabaseInstance &db) : db(db), reserved_memory(0) {
+	}
+	~DictionarySegmentState() override {
+		if (reserved_memory) {
+			BufferManager::GetBufferManager(db).FreeReservedMemory(reserved_memory);
+		}
+	}
+
+	DatabaseInstance &db;
+	mutex lock;
+	//! The decoded dictionary; the strings are copied out of the block so the cache does not pin it
+	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size = 0;
+	bool dictionary_sorted = false;
+	//! The dictionary bytes accounted for with the buffer manager
+	idx_t reserved_memory;
+};
+
+unique_ptr<CompressedSegmentState> DictionaryCompressionStorage::StringInitSegment(ColumnSegment &segment,
+                                                                                   block_id_t block_id) {
+	if (block_id == INVALID_BLOCK || !DBConfig::GetConfig(segment.db).options.enable_dictionary_cache) {
+		// transient segments are only scanned by the checkpointer: no cache
+		return nullptr;
+	}
+	return make_unique<DictionarySegmentState>(segment.db);
+}
+
 //===--------------------------------------------------------------------===//
 // Scan
 //===--------------------------------------------------------------------===//
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
 	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size = 0;
+	bool dictionary_sorted = false;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
 };
 
+//! Whether the dictionary indices are order-preserving; segments written before the dictionary was
+//! sorted on finalize may have arbitrary order
+static bool DictionaryIsSorted(string_t *dict_child_data, uint32_t index_buffer_count) {
+	for (uint32_t i = 2; i < index_buffer_count; i++) {
+		if (LessThan::Operation(dict_child_data[i], dict_child_data[i - 1])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
 	auto state = make_unique<CompressedStringScanState>();
 	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
@@ -452,6 +548,30 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 
 	auto index_buffer_ptr = (uint32_t *)(baseptr + index_buffer_offset);
 
+	auto segment_state = (DictionarySegmentState *)segment.GetSegmentState();
+	if (segment_state) {
+		// the dictionary cache is enabled: decode the dictionary once and share it across scans
+		lock_guard<mutex> guard(segment_state->lock);
+		if (!segment_state->dictionary) {
+			buffer_manager.ReserveMemory(dict.size);
+			segment_state->reserved_memory = dict.size;
+
+			segment_state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+			auto dict_child_data = FlatVector::GetData<string_t>(*segment_state->dictionary);
+			for (uint32_t i = 0; i < index_buffer_count; i++) {
+				uint16_t str_len = GetStringLength(index_buffer_ptr, i);
+				auto str = FetchStringFromDict(segment, dict, baseptr, index_buffer_ptr[i], str_len);
+				dict_child_data[i] = StringVector::AddStringOrBlob(*segment_state->dictionary, str);
+			}
+			segment_state->dictionary_size = index_buffer_count;
+			segment_state->dictionary_sorted = DictionaryIsSorted(dict_child_data, index_buffer_count);
+		}
+		state->dictionary = segment_state->dictionary;
+		state->dictionary_size = segment_state->dictionary_size;
+		state->dictionary_sorted = segment_state->dictionary_sorted;
+		return std::move(state);
+	}
+
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
@@ -461,6 +581,9 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 		dict_child_data[i] = FetchStringFromDict(segment, dict, baseptr, index_buffer_ptr[i], str_len);
 	}
 
+	state->dictionary_size = index_buffer_count;
+	state->dictionary_sorted = DictionaryIsSorted(dict_child_data, index_buffer_count);
+
 	return std::move(state);
 }
 
@@ -634,6 +757,78 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Filter Selection
+//===--------------------------------------------------------------------===//
+bool DictionaryCompressionFun::HasSortedDictionary(SegmentScanState &scan_state) {
+	return ((CompressedStringScanState &)scan_state).dictionary_sorted;
+}
+
+void DictionaryCompressionFun::FilterSelection(SegmentScanState &scan_state_p, Vector &result,
+                                               const ConstantFilter &filter, SelectionVector &sel,
+                                               idx_t &approved_tuple_count) {
+	auto &scan_state = (CompressedStringScanState &)scan_state_p;
+	D_ASSERT(scan_state.dictionary_sorted);
+	D_ASSERT(result.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+	auto dict_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
+	auto &str_value = StringValue::Get(filter.constant);
+	string_t predicate(str_value.c_str(), str_value.size());
+
+	// binary search the sorted dictionary once: index 0 is reserved for null strings, the remaining
+	// indices are order-preserving so the comparison reduces to a single range of indices
+	auto less_than = [](const string_t &lhs, const string_t &rhs) { return LessThan::Operation(lhs, rhs); };
+	auto dict_begin = dict_data + 1;
+	auto dict_end = dict_data + scan_state.dictionary_size;
+	idx_t lower = std::lower_bound(dict_begin, dict_end, predicate, less_than) - dict_data;
+	idx_t upper = std::upper_bound(dict_begin, dict_end, predicate, less_than) - dict_data;
+
+	idx_t range_begin = 1;
+	idx_t range_end = scan_state.dictionary_size;
+	bool invert = false;
+	switch (filter.comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		range_begin = lower;
+		range_end = upper;
+		break;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		range_begin = lower;
+		range_end = upper;
+		invert = true;
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		range_end = lower;
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		range_end = upper;
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		range_begin = upper;
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		range_begin = lower;
+		break;
+	default:
+		throw NotImplementedException("Unknown comparison type for filter pushed down to table!");
+	}
+
+	// now filter the rows on their indices as integers
+	auto &indices = DictionaryVector::SelVector(result);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto index = indices.get_index(idx);
+		// this path is only taken when the segment contains no nulls: the null index cannot occur
+		D_ASSERT(index != 0);
+		bool match = index >= range_begin && index < range_end;
+		if (match != invert) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Get Function
 //===--------------------------------------------------------------------===//
@@ -644,7 +839,8 @@ CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
-	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip,
+	    DictionaryCompressionStorage::StringInitSegment);
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(PhysicalType type) {
@@ -350,6 +350,9 @@ CompressionFunction GetRLEFunction(PhysicalType data_type) {
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
 	switch (type) {
+	case PhysicalType::BIT:
+		// validity masks use a specialized RLE implementation over the validity bits
+		return ValidityRLEFun::GetFunction(type);
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
 		return GetRLEFunction<int8_t>(type);
@@ -380,6 +383,7 @@ CompressionFunction RLEFun::GetFunction(PhysicalType type) {
 
 bool RLEFun::TypeIsSupported(PhysicalType type) {
 	switch (type) {
+	case PhysicalType::BIT:
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
 	case PhysicalType::INT16:
@@ -0,0 +1,313 @@
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/validity_statistics.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+namespace duckdb {
+
+//! Validity RLE stores the validity mask as alternating runs of valid and invalid rows. For columns that are almost
+//! entirely non-NULL this shrinks the mask from one bit per row to a handful of run lengths, and scanning a valid run
+//! leaves the (all-valid) result mask untouched so downstream kernels keep their fast path.
+
+using validity_run_t = uint32_t;
+
+struct ValidityRLEConstants {
+	//! Segment layout: [number of runs (uint32_t)][validity of the first run (uint32_t)][run lengths]
+	//! the runs alternate in validity, starting with the validity stored in the header
+	static constexpr const idx_t HEADER_SIZE = 2 * sizeof(uint32_t);
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ValidityRLEAnalyzeState : public AnalyzeState {
+	idx_t run_count = 0;
+	bool current_valid = true;
+	bool has_rows = false;
+
+	void Update(bool valid) {
+		if (!has_rows || valid != current_valid) {
+			run_count++;
+			current_valid = valid;
+			has_rows = true;
+		}
+	}
+};
+
+unique_ptr<AnalyzeState> ValidityRLEInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_unique<ValidityRLEAnalyzeState>();
+}
+
+bool ValidityRLEAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = (ValidityRLEAnalyzeState &)state_p;
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	if (vdata.validity.AllValid()) {
+		// fast path: the entire vector extends (or starts) a single valid run
+		state.Update(true);
+		return true;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.Update(vdata.validity.RowIsValidUnsafe(idx));
+	}
+	return true;
+}
+
+idx_t ValidityRLEFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = (ValidityRLEAnalyzeState &)state_p;
+	return ValidityRLEConstants::HEADER_SIZE + state.run_count * sizeof(validity_run_t);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+struct ValidityRLECompressState : public CompressionState {
+	explicit ValidityRLECompressState(ColumnDataCheckpointer &checkpointer_p) : checkpointer(checkpointer_p) {
+		auto &db = checkpointer.GetDatabase();
+		auto &config = DBConfig::GetConfig(db);
+		function = config.GetCompressionFunction(CompressionType::COMPRESSION_RLE, PhysicalType::BIT);
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	static idx_t MaxRunCount() {
+		return (Storage::BLOCK_SIZE - ValidityRLEConstants::HEADER_SIZE) / sizeof(validity_run_t);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto column_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		column_segment->function = function;
+		current_segment = std::move(column_segment);
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+		entry_count = 0;
+		first_valid = true;
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			AddRow(vdata.validity.RowIsValid(idx));
+		}
+	}
+
+	void AddRow(bool valid) {
+		if (run_length == 0) {
+			// first row of a run: the run takes the validity of this row
+			current_valid = valid;
+			run_length = 1;
+			return;
+		}
+		if (valid == current_valid) {
+			run_length++;
+			return;
+		}
+		// the validity flips: write away the current run and start a new one
+		WriteRun();
+		current_valid = valid;
+		run_length = 1;
+	}
+
+	void WriteRun() {
+		D_ASSERT(run_length <= NumericLimits<validity_run_t>::Maximum());
+		if (entry_count == 0) {
+			// first run of this segment defines the validity the alternating runs start with
+			first_valid = current_valid;
+		}
+		auto run_data = (validity_run_t *)(handle.Ptr() + ValidityRLEConstants::HEADER_SIZE);
+		run_data[entry_count] = run_length;
+		entry_count++;
+
+		auto &validity_stats = (ValidityStatistics &)*current_segment->stats.statistics;
+		if (current_valid) {
+			validity_stats.has_no_null = true;
+		} else {
+			validity_stats.has_null = true;
+		}
+		current_segment->count += run_length;
+		run_length = 0;
+
+		if (entry_count == MaxRunCount()) {
+			// the run array is full: flush this segment and start a new one
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+	}
+
+	void FlushSegment() {
+		auto data_ptr = handle.Ptr();
+		Store<uint32_t>(entry_count, data_ptr);
+		Store<uint32_t>(first_valid ? 1 : 0, data_ptr + sizeof(uint32_t));
+		idx_t total_segment_size = ValidityRLEConstants::HEADER_SIZE + entry_count * sizeof(validity_run_t);
+		handle.Destroy();
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		if (run_length > 0) {
+			WriteRun();
+		}
+		FlushSegment();
+		current_segment.reset();
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction *function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! The validity and length of the current (unwritten) run
+	bool current_valid = true;
+	idx_t run_length = 0;
+	//! The number of runs written to the current segment, and the validity its first run starts with
+	uint32_t entry_count = 0;
+	bool first_valid = true;
+};
+
+unique_ptr<CompressionState> ValidityRLEInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                        unique_ptr<AnalyzeState> state) {
+	return make_unique<ValidityRLECompressState>(checkpointer);
+}
+
+void ValidityRLECompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = (ValidityRLECompressState &)state_p;
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+
+	state.Append(vdata, count);
+}
+
+void ValidityRLEFinalizeCompress(CompressionState &state_p) {
+	auto &state = (ValidityRLECompressState &)state_p;
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ValidityRLEScanState : public SegmentScanState {
+	explicit ValidityRLEScanState(ColumnSegment &segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		auto data_ptr = handle.Ptr() + segment.GetBlockOffset();
+		run_count = Load<uint32_t>(data_ptr);
+		current_valid = Load<uint32_t>(data_ptr + sizeof(uint32_t)) != 0;
+		run_data = (validity_run_t *)(data_ptr + ValidityRLEConstants::HEADER_SIZE);
+		entry_pos = 0;
+		position_in_entry = 0;
+	}
+
+	void Skip(idx_t skip_count) {
+		while (skip_count > 0) {
+			D_ASSERT(entry_pos < run_count);
+			idx_t remaining_in_run = run_data[entry_pos] - position_in_entry;
+			if (skip_count < remaining_in_run) {
+				position_in_entry += skip_count;
+				return;
+			}
+			skip_count -= remaining_in_run;
+			NextRun();
+		}
+	}
+
+	void NextRun() {
+		entry_pos++;
+		position_in_entry = 0;
+		current_valid = !current_valid;
+	}
+
+	BufferHandle handle;
+	validity_run_t *run_data;
+	uint32_t run_count;
+	idx_t entry_pos;
+	idx_t position_in_entry;
+	//! The validity of the run at entry_pos; runs alternate in validity
+	bool current_valid;
+};
+
+unique_ptr<SegmentScanState> ValidityRLEInitScan(ColumnSegment &segment) {
+	auto result = make_unique<ValidityRLEScanState>(segment);
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+void ValidityRLESkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = (ValidityRLEScanState &)*state.scan_state;
+	scan_state.Skip(skip_count);
+}
+
+void ValidityRLEScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                            idx_t result_offset) {
+	auto &scan_state = (ValidityRLEScanState &)*state.scan_state;
+
+	// this method relies on all the bits we are going to write to being set to valid (see validity_uncompressed.cpp):
+	// valid runs can then be scanned without touching the result mask at all, keeping it in its all-valid fast path
+	auto &result_mask = FlatVector::Validity(result);
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		D_ASSERT(scan_state.entry_pos < scan_state.run_count);
+		idx_t remaining_in_run = scan_state.run_data[scan_state.entry_pos] - scan_state.position_in_entry;
+		idx_t run_scan_count = MinValue<idx_t>(scan_count - scanned, remaining_in_run);
+		if (!scan_state.current_valid) {
+			if (!result_mask.GetData()) {
+				result_mask.Initialize(MaxValue<idx_t>(STANDARD_VECTOR_SIZE, result_offset + scan_count));
+			}
+			for (idx_t i = 0; i < run_scan_count; i++) {
+				result_mask.SetInvalid(result_offset + scanned + i);
+			}
+		}
+		scanned += run_scan_count;
+		if (run_scan_count == remaining_in_run) {
+			scan_state.NextRun();
+		} else {
+			scan_state.position_in_entry += run_scan_count;
+		}
+	}
+}
+
+void ValidityRLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	result.Flatten(scan_count);
+	ValidityRLEScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ValidityRLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                         idx_t result_idx) {
+	ValidityRLEScanState scan_state(segment);
+	scan_state.Skip(row_id);
+	if (!scan_state.current_valid) {
+		auto &result_mask = FlatVector::Validity(result);
+		result_mask.SetInvalid(result_idx);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ValidityRLEFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::BIT);
+	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, ValidityRLEInitAnalyze, ValidityRLEAnalyze,
+	                           ValidityRLEFinalAnalyze, ValidityRLEInitCompression, ValidityRLECompress,
+	                           ValidityRLEFinalizeCompress, ValidityRLEInitScan, ValidityRLEScan,
+	                           ValidityRLEScanPartial, ValidityRLEFetchRow, ValidityRLESkip);
+}
+
+bool ValidityRLEFun::TypeIsSupported(PhysicalType type) {
+	return type == PhysicalType::BIT;
+}
+
+} // namespace duckdb
@@ -341,6 +341,14 @@ void ValidityScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t s
 }
 
 void ValidityScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		auto &validity_stats = (ValidityStatistics &)*segment.stats.statistics;
+		if (!validity_stats.has_null) {
+			// the scanned base column emitted a compressed (dictionary or FSST) vector: when this segment
+			// holds no nulls there is no mask to merge, so the vector does not have to be flattened
+			return;
+		}
+	}
 	result.Flatten(scan_count);
 
 	auto start = segment.GetRelativeIndex(state.row_index);
@@ -8,6 +8,7 @@
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/column_list.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/planner/constraints/list.hpp"
 #include "duckdb/planner/expression_binder/check_binder.hpp"
@@ -21,6 +22,7 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/types/constraint_conflict_info.hpp"
 
@@ -29,7 +31,8 @@ namespace duckdb {
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
     : db(db), table_io_manager(std::move(table_io_manager_p)), cardinality(0), schema(std::move(schema)),
-      table(std::move(table)) {
+      table(std::move(table)), row_group_size(DBConfig::GetConfig(db.GetDatabase()).options.row_group_size),
+      last_write_version(0) {
 }
 
 bool DataTableInfo::IsTemporary() const {
@@ -45,7 +48,14 @@ DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_m
 	auto types = GetTypes();
 	this->row_groups =
 	    make_shared<RowGroupCollection>(info, TableIOManager::Get(*this).GetBlockManagerForRowData(), types, 0);
-	if (data && !data->row_groups.empty()) {
+	if (data && data->table_data_block != INVALID_BLOCK) {
+		// the table data has not been deserialized yet - it is loaded lazily when the table is first accessed
+		ColumnList columns;
+		for (auto &column_def : column_definitions) {
+			columns.AddColumn(column_def.Copy());
+		}
+		this->row_groups->InitializeLazy(columns, *data);
+	} else if (data && !data->row_groups.empty()) {
 		this->row_groups->Initialize(*data);
 	} else {
 		this->row_groups->InitializeEmpty();
@@ -775,6 +785,7 @@ void DataTable::WriteToLog(WriteAheadLog &log, idx_t row_start, idx_t count) {
 }
 
 void DataTable::CommitAppend(transaction_t commit_id, idx_t row_start, idx_t count) {
+	info->last_write_version = commit_id;
 	lock_guard<mutex> lock(append_lock);
 	row_groups->CommitAppend(commit_id, row_start, count);
 	info->cardinality += count;
@@ -1115,9 +1126,33 @@ void DataTable::SetStatistics(column_t column_id, const std::function<void(BaseS
 	row_groups->SetStatistics(column_id, set_fun);
 }
 
+bool DataTable::IsColumnSorted(column_t column_id, OrderType order_type) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		// row identifiers are assigned in insertion order and hence always ascending
+		return order_type == OrderType::ASCENDING;
+	}
+	return row_groups->IsColumnSorted(column_id, order_type);
+}
+
+//===--------------------------------------------------------------------===//
+// Vacuum
+//===--------------------------------------------------------------------===//
+void DataTable::Vacuum() {
+	if (!info->indexes.Empty()) {
+		// removing a deleted row shifts the row ids of all rows that follow it, which would invalidate the row ids
+		// stored in the indexes of the table: only reclaim space for tables without indexes
+		return;
+	}
+	row_groups->Vacuum();
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
+void DataTable::PrepareCheckpoint(const vector<CompressionType> &compression_types) {
+	row_groups->PrepareCheckpoint(compression_types);
+}
+
 void DataTable::Checkpoint(TableDataWriter &writer) {
 	// checkpoint each individual row group
 	// FIXME: we might want to combine adjacent row groups in case they have had deletions...
@@ -1144,6 +1179,10 @@ idx_t DataTable::GetTotalRows() {
 	return row_groups->GetTotalRows();
 }
 
+bool DataTable::IsLoaded() const {
+	return row_groups->IsLoaded();
+}
+
 void DataTable::CommitDropTable() {
 	// commit a drop of this table: mark all blocks as modified so they can be reclaimed later on
 	row_groups->CommitDropTable();
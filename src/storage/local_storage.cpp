@@ -12,6 +12,8 @@
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
@@ -224,6 +226,121 @@ bool LocalTableStorage::AppendToIndexes(Transaction &transaction, RowGroupCollec
 	return success;
 }
 
+bool LocalTableStorage::BulkAppendToIndexes(Transaction &transaction, RowGroupCollection &source,
+                                            TableIndexList &index_list, const vector<LogicalType> &table_types,
+                                            row_t &start_row) {
+	// only need to scan for index append
+	// figure out which columns we need to scan for the set of indexes
+	auto columns = index_list.GetRequiredColumns();
+	// create an empty mock chunk that contains all the correct types for the table
+	DataChunk mock_chunk;
+	mock_chunk.InitializeEmpty(table_types);
+
+	// collect the target indexes, and create an empty accumulation ART per index, so that the expensive tree
+	// construction happens outside of the index locks
+	vector<ART *> target_arts;
+	vector<unique_ptr<ART>> local_arts;
+	vector<unique_ptr<DataChunk>> key_chunks;
+	index_list.Scan([&](Index &index) {
+		D_ASSERT(index.type == IndexType::ART);
+		auto &art = (ART &)index;
+		vector<unique_ptr<Expression>> unbound_expressions;
+		unbound_expressions.reserve(art.unbound_expressions.size());
+		for (auto &expr : art.unbound_expressions) {
+			unbound_expressions.push_back(expr->Copy());
+		}
+		target_arts.push_back(&art);
+		local_arts.push_back(make_unique<ART>(art.column_ids, art.table_io_manager, std::move(unbound_expressions),
+		                                      art.constraint_type, art.db));
+		auto key_chunk = make_unique<DataChunk>();
+		key_chunk->Initialize(allocator, art.logical_types);
+		key_chunks.push_back(std::move(key_chunk));
+		return false;
+	});
+
+	ArenaAllocator arena_allocator(allocator);
+	vector<Key> keys(STANDARD_VECTOR_SIZE);
+	vector<idx_t> key_order;
+	vector<Key> sorted_keys;
+
+	bool success = true;
+	source.Scan(transaction, columns, [&](DataChunk &chunk) -> bool {
+		// construct the mock chunk by referencing the required columns
+		for (idx_t i = 0; i < columns.size(); i++) {
+			mock_chunk.data[columns[i]].Reference(chunk.data[i]);
+		}
+		mock_chunk.SetCardinality(chunk);
+
+		for (idx_t index_idx = 0; index_idx < target_arts.size(); index_idx++) {
+			auto &target_art = *target_arts[index_idx];
+			auto &key_chunk = *key_chunks[index_idx];
+
+			// generate the keys of this chunk for this index
+			key_chunk.Reset();
+			target_art.ExecuteExpressions(mock_chunk, key_chunk);
+			arena_allocator.Reset();
+			ART::GenerateKeys(arena_allocator, key_chunk, keys);
+
+			// determine the sorted key order, ignoring any NULL keys (they are not stored in the index)
+			key_order.clear();
+			for (idx_t i = 0; i < key_chunk.size(); i++) {
+				if (!keys[i].Empty()) {
+					key_order.push_back(i);
+				}
+			}
+			if (key_order.empty()) {
+				continue;
+			}
+			std::sort(key_order.begin(), key_order.end(),
+			          [&keys](const idx_t &a, const idx_t &b) { return keys[a] < keys[b]; });
+
+			sorted_keys.clear();
+			sorted_keys.reserve(key_order.size());
+			Vector sorted_row_ids(LogicalType::ROW_TYPE);
+			auto sorted_row_data = FlatVector::GetData<row_t>(sorted_row_ids);
+			for (idx_t i = 0; i < key_order.size(); i++) {
+				sorted_keys.push_back(keys[key_order[i]]);
+				sorted_row_data[i] = start_row + key_order[i];
+			}
+
+			// construct an ART for this chunk from the sorted keys, and merge it into the accumulation ART
+			auto &local_art = *local_arts[index_idx];
+			vector<unique_ptr<Expression>> unbound_expressions;
+			unbound_expressions.reserve(local_art.unbound_expressions.size());
+			for (auto &expr : local_art.unbound_expressions) {
+				unbound_expressions.push_back(expr->Copy());
+			}
+			auto chunk_art = make_unique<ART>(local_art.column_ids, local_art.table_io_manager,
+			                                  std::move(unbound_expressions), local_art.constraint_type, local_art.db);
+			try {
+				chunk_art->ConstructFromSorted(sorted_keys.size(), sorted_keys, sorted_row_ids);
+			} catch (ConstraintException &ex) {
+				// the chunk contains duplicates on the indexed column(s)
+				success = false;
+				return false;
+			}
+			if (!local_art.Index::MergeIndexes(chunk_art.get())) {
+				success = false;
+				return false;
+			}
+		}
+		start_row += chunk.size();
+		return true;
+	});
+	if (!success) {
+		return false;
+	}
+
+	// finally, merge the accumulation ARTs into the target indexes - this applies each batch of data to the index
+	// with a single lock acquisition per index, linking in whole subtrees where possible
+	for (idx_t index_idx = 0; index_idx < target_arts.size(); index_idx++) {
+		if (!target_arts[index_idx]->Index::MergeIndexes(local_arts[index_idx].get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void LocalTableStorage::AppendToIndexes(Transaction &transaction, TableAppendState &append_state, idx_t append_count,
                                         bool append_to_table) {
 	bool constraint_violated = false;
@@ -433,8 +550,11 @@ void LocalStorage::LocalMerge(DataTable *table, RowGroupCollection &collection)
 	auto storage = table_manager.GetOrCreateStorage(table);
 	if (!storage->indexes.Empty()) {
 		// append data to indexes if required
+		// this is the bulk path: batch inserts merge large collections at once, so we construct sorted per-chunk
+		// ARTs and merge those into the indexes instead of inserting the rows one by one
 		row_t base_id = MAX_ROW_ID + storage->row_groups->GetTotalRows();
-		bool success = storage->AppendToIndexes(transaction, collection, storage->indexes, table->GetTypes(), base_id);
+		bool success =
+		    storage->BulkAppendToIndexes(transaction, collection, storage->indexes, table->GetTypes(), base_id);
 		if (!success) {
 			throw ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicated key");
 		}
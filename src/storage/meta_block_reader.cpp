@@ -50,6 +50,12 @@ void MetaBlockReader::ReadNewBlock(block_id_t id) {
 	next_block = Load<block_id_t>(handle.Ptr());
 	D_ASSERT(next_block >= -1);
 	offset = sizeof(block_id_t);
+
+	if (next_block != INVALID_BLOCK) {
+		// hint the file system that the next block in the chain will be read shortly, so that the read of the
+		// next 256KB metadata block can overlap with the deserialization of the current one
+		block_manager.Prefetch(next_block);
+	}
 }
 
 } // namespace duckdb
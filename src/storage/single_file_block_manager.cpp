@@ -1,6 +1,7 @@
 #include "duckdb/storage/single_file_block_manager.hpp"
 
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/serializer/buffered_deserializer.hpp"
 #include "duckdb/common/serializer/buffered_serializer.hpp"
@@ -111,7 +112,8 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, string path
     : BlockManager(BufferManager::GetBufferManager(db)), db(db), path(std::move(path_p)),
       header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
                     Storage::FILE_HEADER_SIZE - Storage::BLOCK_HEADER_SIZE),
-      iteration_count(0), read_only(read_only), use_direct_io(use_direct_io) {
+      iteration_count(0), read_only(read_only), use_direct_io(use_direct_io), mapped_file(nullptr),
+      mapped_size(0) {
 	uint8_t flags;
 	FileLockType lock;
 	if (read_only) {
@@ -131,6 +133,11 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, string path
 	// open the RDBMS handle
 	auto &fs = FileSystem::Get(db);
 	handle = fs.OpenFile(path, flags, lock);
+	if (read_only && !use_direct_io) {
+		// read-only databases serve pinned blocks directly from a read-only mapping of the file, letting the
+		// operating system manage residency instead of copying every block into the buffer pool
+		TryMemoryMapFile();
+	}
 	if (create_new) {
 		// if we create a new file, we fill the metadata of the file
 		// first fill in the new header
@@ -305,21 +312,75 @@ idx_t SingleFileBlockManager::FreeBlocks() {
 	return free_list.size();
 }
 
+SingleFileBlockManager::~SingleFileBlockManager() {
+	if (mapped_file) {
+		handle->file_system.MemoryUnmap(*handle, mapped_file, mapped_size);
+		mapped_file = nullptr;
+	}
+}
+
+void SingleFileBlockManager::TryMemoryMapFile() {
+	D_ASSERT(read_only);
+	auto file_size = handle->file_system.GetFileSize(*handle);
+	if (file_size <= 0) {
+		return;
+	}
+	// best-effort: if the file system does not support memory mapping we fall back to regular reads
+	mapped_file = handle->file_system.MemoryMapRead(*handle, file_size);
+	if (mapped_file) {
+		mapped_size = file_size;
+	}
+}
+
+data_ptr_t SingleFileBlockManager::GetMappedBlock(block_id_t block_id) {
+	if (!mapped_file) {
+		return nullptr;
+	}
+	auto location = BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE;
+	if (location + Storage::BLOCK_ALLOC_SIZE > mapped_size) {
+		// the block lies (partially) beyond the mapping: fall back to a regular read
+		return nullptr;
+	}
+	return mapped_file + location;
+}
+
 unique_ptr<Block> SingleFileBlockManager::CreateBlock(block_id_t block_id, FileBuffer *source_buffer) {
 	if (source_buffer) {
 		D_ASSERT(source_buffer->AllocSize() == Storage::BLOCK_ALLOC_SIZE);
 		return make_unique<Block>(*source_buffer, block_id);
-	} else {
-		return make_unique<Block>(Allocator::Get(db), block_id);
 	}
+	auto mapped_block = GetMappedBlock(block_id);
+	if (mapped_block) {
+		// serve the block directly from the memory mapping: no buffer pool memory is allocated or charged
+		return make_unique<Block>(Allocator::Get(db), block_id, mapped_block + Storage::BLOCK_HEADER_SIZE);
+	}
+	return make_unique<Block>(Allocator::Get(db), block_id);
 }
 
 void SingleFileBlockManager::Read(Block &block) {
 	D_ASSERT(block.id >= 0);
 	D_ASSERT(std::find(free_list.begin(), free_list.end(), block.id) == free_list.end());
+	auto mapped_block = GetMappedBlock(block.id);
+	if (mapped_block && block.buffer == mapped_block + Storage::BLOCK_HEADER_SIZE) {
+		// the block points into the memory mapping: the data is already accessible, only verify the checksum
+		auto stored_checksum = Load<uint64_t>(mapped_block);
+		uint64_t computed_checksum = Checksum(block.buffer, block.size);
+		if (stored_checksum != computed_checksum) {
+			throw IOException(
+			    "Corrupt database file: computed checksum %llu does not match stored checksum %llu in block",
+			    computed_checksum, stored_checksum);
+		}
+		return;
+	}
 	block.ReadAndChecksum(*handle, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
 }
 
+void SingleFileBlockManager::Prefetch(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	handle->file_system.Prefetch(*handle, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE,
+	                             Storage::BLOCK_ALLOC_SIZE);
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	buffer.ChecksumAndWrite(*handle, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE);
@@ -1,5 +1,8 @@
 #include "duckdb/storage/statistics/column_statistics.hpp"
 
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/vector.hpp"
+
 namespace duckdb {
 
 ColumnStatistics::ColumnStatistics(unique_ptr<BaseStatistics> stats_p) : stats(std::move(stats_p)) {
@@ -10,4 +13,166 @@ shared_ptr<ColumnStatistics> ColumnStatistics::CreateEmptyStats(const LogicalTyp
 	return make_shared<ColumnStatistics>(std::move(col_stats));
 }
 
+void ColumnStatistics::InitializeSortednessTracking() {
+	sorted_ascending = true;
+	sorted_descending = true;
+}
+
+template <class T>
+void ColumnStatistics::TemplatedUpdateSortedness(UnifiedVectorFormat &vdata, idx_t count) {
+	auto data = (const T *)vdata.data;
+	auto prev = data[vdata.sel->get_index(0)];
+	// compare the first value of the chunk against the last previously appended value
+	auto chunk_first = Value::CreateValue<T>(prev);
+	if (!last_value.IsNull()) {
+		if (sorted_ascending && chunk_first < last_value) {
+			sorted_ascending = false;
+		}
+		if (sorted_descending && last_value < chunk_first) {
+			sorted_descending = false;
+		}
+	} else {
+		first_value = chunk_first;
+	}
+	// the values within the chunk are compared without boxing them into Values
+	for (idx_t i = 1; i < count && (sorted_ascending || sorted_descending); i++) {
+		auto value = data[vdata.sel->get_index(i)];
+		if (sorted_ascending && LessThan::Operation(value, prev)) {
+			sorted_ascending = false;
+		}
+		if (sorted_descending && LessThan::Operation(prev, value)) {
+			sorted_descending = false;
+		}
+		prev = value;
+	}
+	if (!sorted_ascending && !sorted_descending) {
+		SetUnsorted();
+		return;
+	}
+	last_value = Value::CreateValue<T>(prev);
+}
+
+void ColumnStatistics::UpdateSortedness(Vector &vector, idx_t count) {
+	if ((!sorted_ascending && !sorted_descending) || count == 0) {
+		// the column is already known to be unsorted (or sortedness is not tracked)
+		return;
+	}
+	UnifiedVectorFormat vdata;
+	vector.ToUnifiedFormat(count, vdata);
+	// NULL values conservatively break sortedness; this means a sorted column is guaranteed NULL-free and the
+	// requested NULL order can be ignored when exploiting the sortedness
+	if (!vdata.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+				SetUnsorted();
+				return;
+			}
+		}
+	}
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedUpdateSortedness<bool>(vdata, count);
+	case PhysicalType::INT8:
+		return TemplatedUpdateSortedness<int8_t>(vdata, count);
+	case PhysicalType::INT16:
+		return TemplatedUpdateSortedness<int16_t>(vdata, count);
+	case PhysicalType::INT32:
+		return TemplatedUpdateSortedness<int32_t>(vdata, count);
+	case PhysicalType::INT64:
+		return TemplatedUpdateSortedness<int64_t>(vdata, count);
+	case PhysicalType::INT128:
+		return TemplatedUpdateSortedness<hugeint_t>(vdata, count);
+	case PhysicalType::UINT8:
+		return TemplatedUpdateSortedness<uint8_t>(vdata, count);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateSortedness<uint16_t>(vdata, count);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateSortedness<uint32_t>(vdata, count);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateSortedness<uint64_t>(vdata, count);
+	case PhysicalType::FLOAT:
+		return TemplatedUpdateSortedness<float>(vdata, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedUpdateSortedness<double>(vdata, count);
+	case PhysicalType::VARCHAR:
+		return TemplatedUpdateSortedness<string_t>(vdata, count);
+	default:
+		// nested and other exotic types fall back to boxed comparisons
+		return GenericUpdateSortedness(vector, count);
+	}
+}
+
+void ColumnStatistics::GenericUpdateSortedness(Vector &vector, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		auto value = vector.GetValue(i);
+		if (value.IsNull()) {
+			SetUnsorted();
+			return;
+		}
+		if (!last_value.IsNull()) {
+			if (sorted_ascending && value < last_value) {
+				sorted_ascending = false;
+			}
+			if (sorted_descending && last_value < value) {
+				sorted_descending = false;
+			}
+			if (!sorted_ascending && !sorted_descending) {
+				SetUnsorted();
+				return;
+			}
+		} else {
+			first_value = value;
+		}
+		last_value = std::move(value);
+	}
+}
+
+void ColumnStatistics::MergeSortedness(ColumnStatistics &other) {
+	if (!sorted_ascending && !sorted_descending) {
+		return;
+	}
+	if (other.first_value.IsNull()) {
+		// the other column statistics have no appended values; they can only be merged in if they (vacuously) kept
+		// their sortedness tracking, otherwise we cannot tell whether values were appended without being observed
+		if (!other.sorted_ascending || !other.sorted_descending) {
+			SetUnsorted();
+		}
+		return;
+	}
+	// the values of "other" follow our current values: the merged column remains sorted if both runs are sorted in the
+	// same direction and the boundary values between the runs do not break the order
+	if (sorted_ascending && !(other.sorted_ascending && (last_value.IsNull() || !(other.first_value < last_value)))) {
+		sorted_ascending = false;
+	}
+	if (sorted_descending && !(other.sorted_descending && (last_value.IsNull() || !(last_value < other.first_value)))) {
+		sorted_descending = false;
+	}
+	if (!sorted_ascending && !sorted_descending) {
+		SetUnsorted();
+		return;
+	}
+	if (last_value.IsNull()) {
+		first_value = other.first_value;
+	}
+	last_value = other.last_value;
+}
+
+void ColumnStatistics::SetUnsorted() {
+	sorted_ascending = false;
+	sorted_descending = false;
+	first_value = Value();
+	last_value = Value();
+}
+
+bool ColumnStatistics::IsSorted(OrderType order_type) const {
+	switch (order_type) {
+	case OrderType::ASCENDING:
+		return sorted_ascending;
+	case OrderType::DESCENDING:
+		return sorted_descending;
+	default:
+		return false;
+	}
+}
+
 } // namespace duckdb
@@ -0,0 +1,248 @@
+#include "duckdb/storage/statistics/histogram.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/serializer.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+EquiDepthHistogram::EquiDepthHistogram(double min, vector<double> bucket_boundaries)
+    : min(min), bucket_boundaries(std::move(bucket_boundaries)) {
+	D_ASSERT(!this->bucket_boundaries.empty());
+}
+
+bool EquiDepthHistogram::SupportsType(const LogicalType &type) {
+	return type.IsNumeric();
+}
+
+void EquiDepthHistogram::SampleValues(Vector &input, idx_t count, vector<double> &sample) {
+	Vector cast_vector(LogicalType::DOUBLE);
+	VectorOperations::DefaultCast(input, cast_vector, count);
+
+	UnifiedVectorFormat vdata;
+	cast_vector.ToUnifiedFormat(count, vdata);
+	auto data = (double *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		if (!Value::DoubleIsFinite(data[idx])) {
+			continue;
+		}
+		sample.push_back(data[idx]);
+	}
+}
+
+unique_ptr<EquiDepthHistogram> EquiDepthHistogram::FromSample(vector<double> &sample, idx_t bucket_count) {
+	if (sample.empty()) {
+		return nullptr;
+	}
+	std::sort(sample.begin(), sample.end());
+	bucket_count = MinValue<idx_t>(bucket_count, sample.size());
+	vector<double> boundaries;
+	boundaries.reserve(bucket_count);
+	for (idx_t k = 1; k <= bucket_count; k++) {
+		// the upper bound of bucket k is the k/bucket_count quantile of the sample
+		idx_t index = k * sample.size() / bucket_count;
+		boundaries.push_back(sample[index - 1]);
+	}
+	return make_unique<EquiDepthHistogram>(sample[0], std::move(boundaries));
+}
+
+bool EquiDepthHistogram::GetConstant(const Value &constant, double &result) {
+	if (constant.IsNull()) {
+		return false;
+	}
+	Value double_value;
+	if (!constant.DefaultTryCastAs(LogicalType::DOUBLE, double_value, nullptr)) {
+		return false;
+	}
+	result = double_value.GetValue<double>();
+	return Value::DoubleIsFinite(result);
+}
+
+double EquiDepthHistogram::EstimateFractionBelow(double value, bool inclusive) const {
+	double bucket_weight = 1.0 / double(bucket_boundaries.size());
+	double fraction = 0;
+	double lower = min;
+	for (auto upper : bucket_boundaries) {
+		if (value > upper || (inclusive && value == upper)) {
+			// the entire bucket passes
+			fraction += bucket_weight;
+		} else {
+			if (value > lower) {
+				// the bucket partially passes: interpolate within the bucket
+				fraction += bucket_weight * (value - lower) / (upper - lower);
+			}
+			break;
+		}
+		lower = upper;
+	}
+	return fraction;
+}
+
+double EquiDepthHistogram::DegenerateBucketFraction(double value) const {
+	double bucket_weight = 1.0 / double(bucket_boundaries.size());
+	double fraction = 0;
+	double lower = min;
+	for (auto upper : bucket_boundaries) {
+		if (lower == value && upper == value) {
+			// this bucket holds only the requested value
+			fraction += bucket_weight;
+		} else if (lower > value) {
+			break;
+		}
+		lower = upper;
+	}
+	return fraction;
+}
+
+double EquiDepthHistogram::EstimateSelectivity(ExpressionType comparison_type, const Value &constant) const {
+	double value;
+	if (!GetConstant(constant, value)) {
+		// cannot use the constant for estimation: assume the filter has no effect
+		return 1.0;
+	}
+	double bucket_weight = 1.0 / double(bucket_boundaries.size());
+	double selectivity;
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL: {
+		auto degenerate = DegenerateBucketFraction(value);
+		if (degenerate > 0) {
+			// a frequent value that occupies one or more buckets on its own
+			selectivity = degenerate;
+		} else if (value < min || value > bucket_boundaries.back()) {
+			selectivity = 0;
+		} else {
+			// the value shares a bucket with other values: a single bucket is an upper bound
+			selectivity = bucket_weight;
+		}
+		break;
+	}
+	case ExpressionType::COMPARE_NOTEQUAL:
+		selectivity = 1.0 - EstimateSelectivity(ExpressionType::COMPARE_EQUAL, constant);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		selectivity = EstimateFractionBelow(value, true) - DegenerateBucketFraction(value);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		selectivity = EstimateFractionBelow(value, true);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		selectivity = 1.0 - EstimateFractionBelow(value, true);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		selectivity = 1.0 - (EstimateFractionBelow(value, true) - DegenerateBucketFraction(value));
+		break;
+	default:
+		return 1.0;
+	}
+	return MaxValue<double>(0, MinValue<double>(1, selectivity));
+}
+
+void EquiDepthHistogram::ApplyFilter(ExpressionType comparison_type, const Value &constant) {
+	double value;
+	if (!GetConstant(constant, value)) {
+		return;
+	}
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		// only the constant remains
+		min = value;
+		bucket_boundaries.assign(1, value);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO: {
+		// drop the buckets above the constant and clip the bucket that contains it
+		vector<double> new_boundaries;
+		double lower = min;
+		for (auto upper : bucket_boundaries) {
+			if (upper <= value) {
+				new_boundaries.push_back(upper);
+			} else {
+				if (value > lower) {
+					new_boundaries.push_back(value);
+				}
+				break;
+			}
+			lower = upper;
+		}
+		if (new_boundaries.empty()) {
+			new_boundaries.push_back(value);
+			min = value;
+		}
+		bucket_boundaries = std::move(new_boundaries);
+		break;
+	}
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO: {
+		// drop the buckets below the constant
+		vector<double> new_boundaries;
+		for (auto upper : bucket_boundaries) {
+			if (upper > value) {
+				new_boundaries.push_back(upper);
+			}
+		}
+		min = MaxValue<double>(min, value);
+		if (new_boundaries.empty()) {
+			new_boundaries.push_back(min);
+		}
+		bucket_boundaries = std::move(new_boundaries);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void EquiDepthHistogram::Merge(const EquiDepthHistogram &other) {
+	// approximate the merged distribution by re-sampling the bucket boundaries of both histograms
+	// this assumes both histograms summarize a comparable number of values
+	vector<double> sample;
+	sample.reserve(bucket_boundaries.size() + other.bucket_boundaries.size() + 2);
+	sample.push_back(min);
+	for (auto boundary : bucket_boundaries) {
+		sample.push_back(boundary);
+	}
+	sample.push_back(other.min);
+	for (auto boundary : other.bucket_boundaries) {
+		sample.push_back(boundary);
+	}
+	auto merged = FromSample(sample);
+	min = merged->min;
+	bucket_boundaries = std::move(merged->bucket_boundaries);
+}
+
+unique_ptr<EquiDepthHistogram> EquiDepthHistogram::Copy() const {
+	return make_unique<EquiDepthHistogram>(min, bucket_boundaries);
+}
+
+void EquiDepthHistogram::Serialize(Serializer &serializer) const {
+	serializer.Write<double>(min);
+	serializer.Write<uint32_t>(bucket_boundaries.size());
+	for (auto boundary : bucket_boundaries) {
+		serializer.Write<double>(boundary);
+	}
+}
+
+unique_ptr<EquiDepthHistogram> EquiDepthHistogram::Deserialize(Deserializer &source) {
+	auto min = source.Read<double>();
+	auto bucket_count = source.Read<uint32_t>();
+	vector<double> boundaries;
+	boundaries.reserve(bucket_count);
+	for (idx_t i = 0; i < bucket_count; i++) {
+		boundaries.push_back(source.Read<double>());
+	}
+	return make_unique<EquiDepthHistogram>(min, std::move(boundaries));
+}
+
+string EquiDepthHistogram::ToString() const {
+	return StringUtil::Format("[Histogram: %llu buckets, %s..%s]", bucket_boundaries.size(), to_string(min),
+	                          to_string(bucket_boundaries.back()));
+}
+
+} // namespace duckdb
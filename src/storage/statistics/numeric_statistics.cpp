@@ -39,6 +39,14 @@ void NumericStatistics::Merge(const BaseStatistics &other_p) {
 	} else if (other.max > max) {
 		max = other.max;
 	}
+	if (other.histogram) {
+		if (histogram) {
+			histogram->Merge(*other.histogram);
+		} else {
+			histogram = other.histogram->Copy();
+		}
+	}
+	// if only this side has a histogram we keep it: it still summarizes the bulk of the data
 }
 
 FilterPropagateResult NumericStatistics::CheckZonemap(ExpressionType comparison_type, const Value &constant) const {
@@ -117,6 +125,9 @@ FilterPropagateResult NumericStatistics::CheckZonemap(ExpressionType comparison_
 unique_ptr<BaseStatistics> NumericStatistics::Copy() const {
 	auto result = make_unique<NumericStatistics>(type, min, max, stats_type);
 	result->CopyBase(*this);
+	if (histogram) {
+		result->histogram = histogram->Copy();
+	}
 	return std::move(result);
 }
 
@@ -127,12 +138,16 @@ bool NumericStatistics::IsConstant() const {
 void NumericStatistics::Serialize(FieldWriter &writer) const {
 	writer.WriteSerializable(min);
 	writer.WriteSerializable(max);
+	writer.WriteOptional(histogram);
 }
 
 unique_ptr<BaseStatistics> NumericStatistics::Deserialize(FieldReader &reader, LogicalType type) {
 	auto min = reader.ReadRequiredSerializable<Value, Value>();
 	auto max = reader.ReadRequiredSerializable<Value, Value>();
-	return make_unique_base<BaseStatistics, NumericStatistics>(std::move(type), min, max, StatisticsType::LOCAL_STATS);
+	auto result =
+	    make_unique<NumericStatistics>(std::move(type), std::move(min), std::move(max), StatisticsType::LOCAL_STATS);
+	result->histogram = reader.ReadOptional<EquiDepthHistogram>(nullptr);
+	return std::move(result);
 }
 
 string NumericStatistics::ToString() const {
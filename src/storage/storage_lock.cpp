@@ -2,9 +2,12 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/assert.hpp"
 
+#include <thread>
+
 namespace duckdb {
 
-StorageLockKey::StorageLockKey(StorageLock &lock, StorageLockType type) : lock(lock), type(type) {
+StorageLockKey::StorageLockKey(StorageLock &lock, StorageLockType type, idx_t shard)
+    : lock(lock), type(type), shard(shard) {
 }
 
 StorageLockKey::~StorageLockKey() {
@@ -12,33 +15,55 @@ StorageLockKey::~StorageLockKey() {
 		lock.ReleaseExclusiveLock();
 	} else {
 		D_ASSERT(type == StorageLockType::SHARED);
-		lock.ReleaseSharedLock();
+		lock.ReleaseSharedLock(shard);
+	}
+}
+
+StorageLock::StorageLock() : exclusive_pending(false) {
+	for (idx_t i = 0; i < SHARD_COUNT; i++) {
+		shards[i].read_count = 0;
 	}
 }
 
-StorageLock::StorageLock() : read_count(0) {
+idx_t StorageLock::GetShardIndex() {
+	// hash the thread id so that concurrent readers spread out over the shards
+	static thread_local idx_t thread_shard = std::hash<std::thread::id>()(std::this_thread::get_id());
+	return thread_shard % SHARD_COUNT;
 }
 
 unique_ptr<StorageLockKey> StorageLock::GetExclusiveLock() {
 	exclusive_lock.lock();
-	while (read_count != 0) {
+	// divert incoming readers to the slow path, then wait for the readers that already announced themselves
+	exclusive_pending = true;
+	for (idx_t i = 0; i < SHARD_COUNT; i++) {
+		while (shards[i].read_count != 0) {
+		}
 	}
-	return make_unique<StorageLockKey>(*this, StorageLockType::EXCLUSIVE);
+	return make_unique<StorageLockKey>(*this, StorageLockType::EXCLUSIVE, 0);
 }
 
 unique_ptr<StorageLockKey> StorageLock::GetSharedLock() {
-	exclusive_lock.lock();
-	read_count++;
-	exclusive_lock.unlock();
-	return make_unique<StorageLockKey>(*this, StorageLockType::SHARED);
+	auto shard = GetShardIndex();
+	// fast path: announce the read on our shard, then verify that no writer is active or waiting
+	// a writer that did not see the announcement has set exclusive_pending before we re-checked it here
+	shards[shard].read_count++;
+	if (!exclusive_pending) {
+		return make_unique<StorageLockKey>(*this, StorageLockType::SHARED, shard);
+	}
+	// slow path: a writer is active or waiting; retract the announcement and queue behind the writer
+	shards[shard].read_count--;
+	lock_guard<mutex> lock(exclusive_lock);
+	shards[shard].read_count++;
+	return make_unique<StorageLockKey>(*this, StorageLockType::SHARED, shard);
 }
 
 void StorageLock::ReleaseExclusiveLock() {
+	exclusive_pending = false;
 	exclusive_lock.unlock();
 }
 
-void StorageLock::ReleaseSharedLock() {
-	read_count--;
+void StorageLock::ReleaseSharedLock(idx_t shard) {
+	shards[shard].read_count--;
 }
 
 } // namespace duckdb
@@ -7,6 +7,7 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/function/function.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
@@ -40,6 +41,14 @@ BufferManager &BufferManager::GetBufferManager(ClientContext &context) {
 	return BufferManager::GetBufferManager(*context.db);
 }
 
+idx_t BufferManager::GetQueryMaxMemory(ClientContext &context) {
+	auto query_memory_limit = ClientConfig::GetConfig(context).query_memory_limit;
+	if (query_memory_limit != 0 && query_memory_limit < maximum_memory) {
+		return query_memory_limit;
+	}
+	return maximum_memory;
+}
+
 ObjectCache &ObjectCache::GetObjectCache(ClientContext &context) {
 	return context.db->GetObjectCache();
 }
@@ -177,7 +186,9 @@ void SingleFileStorageCommitState::FlushCommit() {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			// flush the WAL to the operating system - the actual fsync happens in the transaction manager,
+			// outside of the transaction lock, so that concurrent commits can share it (group commit)
+			log->FlushBuffer();
 		}
 		log->skip_writing = false;
 	}
@@ -205,6 +216,50 @@ bool SingleFileStorageManager::IsCheckpointClean(block_id_t checkpoint_id) {
 	return block_manager->IsRootBlock(checkpoint_id);
 }
 
+void SingleFileStorageManager::PrepareCheckpoint() {
+	if (InMemory() || read_only || !wal) {
+		return;
+	}
+	if (wal->GetWALSize() == 0) {
+		// nothing to checkpoint
+		return;
+	}
+	// collect the committed tables of the catalog; the table storage is kept alive through the shared pointer even if
+	// a table is dropped concurrently
+	struct PreparedTable {
+		shared_ptr<DataTable> storage;
+		vector<CompressionType> compression_types;
+	};
+	vector<PreparedTable> tables;
+	auto &catalog = Catalog::GetCatalog(db);
+	vector<SchemaCatalogEntry *> schemas;
+	catalog.schemas->Scan([&](CatalogEntry *entry) { schemas.push_back((SchemaCatalogEntry *)entry); });
+	for (auto &schema : schemas) {
+		schema->Scan(CatalogType::TABLE_ENTRY, [&](CatalogEntry *entry) {
+			if (entry->internal || entry->type != CatalogType::TABLE_ENTRY) {
+				return;
+			}
+			auto &table = (TableCatalogEntry &)*entry;
+			PreparedTable prepared;
+			prepared.storage = table.storage;
+			auto column_count = prepared.storage->GetTypes().size();
+			prepared.compression_types.reserve(column_count);
+			for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+				prepared.compression_types.push_back(table.columns.GetColumn(LogicalIndex(column_idx)).CompressionType());
+			}
+			tables.push_back(std::move(prepared));
+		});
+	}
+	for (auto &table : tables) {
+		try {
+			table.storage->PrepareCheckpoint(table.compression_types);
+		} catch (...) {
+			// a failure during the pre-write is not fatal: the checkpoint itself writes the data of the tables
+			break;
+		}
+	}
+}
+
 void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_checkpoint) {
 	if (InMemory() || read_only || !wal) {
 		return;
@@ -78,6 +78,14 @@ void ChunkConstantInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t
 	insert_id = commit_id;
 }
 
+bool ChunkConstantInfo::IsFullyCommitted(transaction_t min_start_time) {
+	return insert_id < min_start_time && delete_id == NOT_DELETED_ID;
+}
+
+idx_t ChunkConstantInfo::GetCommittedDeletedCount(idx_t max_count) {
+	return delete_id < TRANSACTION_ID_START ? max_count : 0;
+}
+
 void ChunkConstantInfo::Serialize(Serializer &serializer) {
 	// we only need to write this node if any tuple deletions have been committed
 	bool is_deleted = insert_id >= TRANSACTION_ID_START || delete_id < TRANSACTION_ID_START;
@@ -102,11 +110,15 @@ unique_ptr<ChunkInfo> ChunkConstantInfo::Deserialize(Deserializer &source) {
 // Vector info
 //===--------------------------------------------------------------------===//
 ChunkVectorInfo::ChunkVectorInfo(idx_t start)
-    : ChunkInfo(start, ChunkInfoType::VECTOR_INFO), insert_id(0), same_inserted_id(true), any_deleted(false) {
+    : ChunkInfo(start, ChunkInfoType::VECTOR_INFO), insert_id(0), same_inserted_id(true), delete_id(NOT_DELETED_ID),
+      same_deleted_id(true), any_deleted(false) {
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 		inserted[i] = 0;
 		deleted[i] = NOT_DELETED_ID;
 	}
+	for (idx_t i = 0; i < MASK_ENTRY_COUNT; i++) {
+		deleted_mask[i] = 0;
+	}
 }
 
 template <class OP>
@@ -124,7 +136,20 @@ idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transacti
 		if (!OP::UseInsertedVersion(start_time, transaction_id, insert_id)) {
 			return 0;
 		}
-		// have to check deleted flag
+		if (same_deleted_id) {
+			// all tuples were deleted by the same transaction: decide visibility once for the whole vector
+			if (OP::UseDeletedVersion(start_time, transaction_id, delete_id)) {
+				// the deletions are not visible: all tuples qualify
+				return max_count;
+			}
+			if (delete_id < TRANSACTION_ID_START) {
+				// the deletions are committed: the bitmap is complete and was fully written before the commit
+				// finished, so we can skip the deleted tuples a bitmap entry at a time
+				return GetUndeletedSelVector(sel_vector, max_count);
+			}
+			// the deletions are our own uncommitted ones: they only exist in the per-tuple ids
+		}
+		// have to check the per-tuple deleted ids
 		for (idx_t i = 0; i < max_count; i++) {
 			if (OP::UseDeletedVersion(start_time, transaction_id, deleted[i])) {
 				sel_vector.set_index(count++, i);
@@ -137,6 +162,30 @@ idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transacti
 				sel_vector.set_index(count++, i);
 			}
 		}
+	} else if (same_deleted_id && OP::UseDeletedVersion(start_time, transaction_id, delete_id)) {
+		// the deletions are not visible: only the inserted flag has to be checked
+		for (idx_t i = 0; i < max_count; i++) {
+			if (OP::UseInsertedVersion(start_time, transaction_id, inserted[i])) {
+				sel_vector.set_index(count++, i);
+			}
+		}
+	} else if (same_deleted_id && delete_id < TRANSACTION_ID_START) {
+		// the deletions are all visible and committed: check the inserted flag of the tuples surviving the
+		// deletion bitmap
+		idx_t base_idx = 0;
+		for (idx_t entry_idx = 0; base_idx < max_count; entry_idx++, base_idx += MASK_BITS_PER_ENTRY) {
+			uint64_t alive = ~deleted_mask[entry_idx].load();
+			if (max_count - base_idx < MASK_BITS_PER_ENTRY) {
+				alive &= (uint64_t(1) << (max_count - base_idx)) - 1;
+			}
+			while (alive) {
+				idx_t i = base_idx + idx_t(__builtin_ctzll(alive));
+				alive &= alive - 1;
+				if (OP::UseInsertedVersion(start_time, transaction_id, inserted[i])) {
+					sel_vector.set_index(count++, i);
+				}
+			}
+		}
 	} else {
 		// have to check both flags
 		for (idx_t i = 0; i < max_count; i++) {
@@ -149,6 +198,23 @@ idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transacti
 	return count;
 }
 
+idx_t ChunkVectorInfo::GetUndeletedSelVector(SelectionVector &sel_vector, idx_t max_count) {
+	idx_t count = 0;
+	idx_t base_idx = 0;
+	for (idx_t entry_idx = 0; base_idx < max_count; entry_idx++, base_idx += MASK_BITS_PER_ENTRY) {
+		uint64_t alive = ~deleted_mask[entry_idx].load();
+		if (max_count - base_idx < MASK_BITS_PER_ENTRY) {
+			// mask out the bits beyond max_count in the last entry
+			alive &= (uint64_t(1) << (max_count - base_idx)) - 1;
+		}
+		while (alive) {
+			sel_vector.set_index(count++, base_idx + idx_t(__builtin_ctzll(alive)));
+			alive &= alive - 1;
+		}
+	}
+	return count;
+}
+
 idx_t ChunkVectorInfo::GetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
                                     idx_t max_count) {
 	return TemplatedGetSelVector<TransactionVersionOperator>(start_time, transaction_id, sel_vector, max_count);
@@ -169,6 +235,12 @@ bool ChunkVectorInfo::Fetch(TransactionData transaction, row_t row) {
 
 idx_t ChunkVectorInfo::Delete(transaction_t transaction_id, row_t rows[], idx_t count) {
 	any_deleted = true;
+	// track whether all deletions in this vector were made by the same transaction
+	if (delete_id == NOT_DELETED_ID) {
+		delete_id = transaction_id;
+	} else if (delete_id != transaction_id) {
+		same_deleted_id = false;
+	}
 
 	idx_t deleted_tuples = 0;
 	for (idx_t i = 0; i < count; i++) {
@@ -181,6 +253,8 @@ idx_t ChunkVectorInfo::Delete(transaction_t transaction_id, row_t rows[], idx_t
 			throw TransactionException("Conflict on tuple deletion!");
 		}
 		// after verifying that there are no conflicts we mark the tuple as deleted
+		// note that only the per-tuple id is written here: the deletion bitmap holds committed deletions only,
+		// so concurrent readers taking the bitmap fast path can never observe these uncommitted deletions
 		deleted[rows[i]] = transaction_id;
 		rows[deleted_tuples] = rows[i];
 		deleted_tuples++;
@@ -189,8 +263,23 @@ idx_t ChunkVectorInfo::Delete(transaction_t transaction_id, row_t rows[], idx_t
 }
 
 void ChunkVectorInfo::CommitDelete(transaction_t commit_id, row_t rows[], idx_t count) {
+	if (commit_id == NOT_DELETED_ID) {
+		// rollback of a delete: restore the per-tuple ids; the bitmap was never touched for uncommitted deletions
+		// the uniformity flags are left as-is, which at worst costs us the fast path for this vector
+		for (idx_t i = 0; i < count; i++) {
+			deleted[rows[i]] = commit_id;
+		}
+		return;
+	}
+	// the deletion bitmap only holds committed deletions: populate it here, before the commit id is published,
+	// so that any reader whose snapshot can see these deletions also sees the complete bitmap
 	for (idx_t i = 0; i < count; i++) {
 		deleted[rows[i]] = commit_id;
+		deleted_mask[rows[i] / MASK_BITS_PER_ENTRY] |= uint64_t(1) << (rows[i] % MASK_BITS_PER_ENTRY);
+	}
+	if (same_deleted_id) {
+		// all deletions belong to the committing transaction: the commit id remains uniform
+		delete_id = commit_id;
 	}
 }
 
@@ -215,6 +304,51 @@ void ChunkVectorInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t e
 	}
 }
 
+bool ChunkVectorInfo::IsFullyCommitted(transaction_t min_start_time) {
+	if (any_deleted) {
+		return false;
+	}
+	if (same_inserted_id) {
+		return insert_id < min_start_time;
+	}
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (inserted[i] >= min_start_time) {
+			return false;
+		}
+	}
+	return true;
+}
+
+idx_t ChunkVectorInfo::GetCommittedDeletedCount(idx_t max_count) {
+	if (!any_deleted) {
+		return 0;
+	}
+	idx_t deleted_count = 0;
+	if (same_deleted_id) {
+		if (delete_id >= TRANSACTION_ID_START) {
+			// the deletions have not been committed yet
+			return 0;
+		}
+		// all deletions were committed by the same transaction: count the set bits of the deletion bitmap
+		for (idx_t entry_idx = 0; entry_idx * MASK_BITS_PER_ENTRY < max_count; entry_idx++) {
+			uint64_t mask = deleted_mask[entry_idx].load();
+			idx_t base_idx = entry_idx * MASK_BITS_PER_ENTRY;
+			if (max_count - base_idx < MASK_BITS_PER_ENTRY) {
+				// the last entry can cover more tuples than the vector holds: mask out the excess bits
+				mask &= (uint64_t(1) << (max_count - base_idx)) - 1;
+			}
+			deleted_count += __builtin_popcountll(mask);
+		}
+		return deleted_count;
+	}
+	for (idx_t i = 0; i < max_count; i++) {
+		if (deleted[i] < TRANSACTION_ID_START) {
+			deleted_count++;
+		}
+	}
+	return deleted_count;
+}
+
 void ChunkVectorInfo::Serialize(Serializer &serializer) {
 	SelectionVector sel(STANDARD_VECTOR_SIZE);
 	transaction_t start_time = TRANSACTION_ID_START - 1;
@@ -249,11 +383,14 @@ unique_ptr<ChunkInfo> ChunkVectorInfo::Deserialize(Deserializer &source) {
 
 	auto result = make_unique<ChunkVectorInfo>(start);
 	result->any_deleted = true;
+	// checkpointed deletions are visible to all transactions: they carry a uniform commit id of zero
+	result->delete_id = 0;
 	bool deleted_tuples[STANDARD_VECTOR_SIZE];
 	source.ReadData((data_ptr_t)deleted_tuples, sizeof(bool) * STANDARD_VECTOR_SIZE);
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 		if (deleted_tuples[i]) {
 			result->deleted[i] = 0;
+			result->deleted_mask[i / MASK_BITS_PER_ENTRY] |= uint64_t(1) << (i % MASK_BITS_PER_ENTRY);
 		}
 	}
 	return std::move(result);
@@ -163,7 +163,7 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 }
 
 void ColumnCheckpointState::WriteDataPointers(RowGroupWriter &writer) {
-	writer.WriteColumnDataPointers(*this);
+	writer.WriteColumnDataPointers(data_pointers);
 }
 
 void ColumnCheckpointState::GetBlockIds(unordered_set<block_id_t> &result) {
@@ -1,8 +1,10 @@
 #include "duckdb/storage/table/column_data.hpp"
 
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/checkpoint/row_group_writer.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
@@ -199,8 +201,20 @@ idx_t ColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t count)
 void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                         SelectionVector &sel, idx_t &count, const TableFilter &filter) {
 	idx_t scan_count = Scan(transaction, vector_index, state, result);
-	result.Flatten(scan_count);
-	ColumnSegment::FilterSelection(sel, result, filter, count, FlatVector::Validity(result));
+	SegmentScanState *segment_scan = nullptr;
+	if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR && state.current && state.scan_state &&
+	    state.current->function->type == CompressionType::COMPRESSION_DICTIONARY &&
+	    ColumnSegment::CanFilterCompressedStrings(filter) &&
+	    DictionaryCompressionFun::HasSortedDictionary(*state.scan_state)) {
+		// dictionary vector over a sorted segment dictionary: evaluate the filter on the codes
+		segment_scan = state.scan_state.get();
+	} else if (result.GetVectorType() != VectorType::FSST_VECTOR ||
+	           !ColumnSegment::CanFilterCompressedStrings(filter)) {
+		result.Flatten(scan_count);
+	}
+	auto &mask =
+	    segment_scan ? FlatVector::Validity(DictionaryVector::Child(result)) : FlatVector::Validity(result);
+	ColumnSegment::FilterSelection(sel, result, filter, count, mask, segment_scan);
 }
 
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
@@ -301,6 +315,18 @@ idx_t ColumnData::Fetch(ColumnScanState &state, row_t row_id, Vector &result) {
 	return ScanVector(state, result, STANDARD_VECTOR_SIZE);
 }
 
+void ColumnData::PrefetchRow(row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks) {
+	auto segment = (ColumnSegment *)data.GetSegment(row_id);
+	if (segment->segment_type != ColumnSegmentType::PERSISTENT) {
+		return;
+	}
+	if (!segment->block || segment->block->IsLoaded()) {
+		// the block is already in memory: there is nothing to read ahead
+		return;
+	}
+	prefetch_blocks.push_back(segment->block);
+}
+
 void ColumnData::FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
                           idx_t result_idx) {
 	auto segment = (ColumnSegment *)data.GetSegment(row_id);
@@ -402,10 +428,53 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group,
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
 	version++;
+	// the checkpoint has merged any outstanding (committed) updates into the segments: clear the update segment
+	// so that the column is considered clean again by subsequent checkpoints
+	updates.reset();
 
 	return checkpoint_state;
 }
 
+bool ColumnData::HasUpdates() {
+	lock_guard<mutex> update_guard(update_lock);
+	return updates && updates->HasUpdates();
+}
+
+bool ColumnData::IsPersistent() {
+	lock_guard<mutex> update_guard(update_lock);
+	if (updates && updates->HasUpdates()) {
+		return false;
+	}
+	auto segment = (ColumnSegment *)data.GetRootSegment();
+	while (segment) {
+		if (segment->segment_type != ColumnSegmentType::PERSISTENT) {
+			return false;
+		}
+		segment = (ColumnSegment *)segment->Next();
+	}
+	return true;
+}
+
+void ColumnData::SerializeColumn(RowGroupWriter &writer) {
+	// the column was not changed since it was last checkpointed
+	// instead of rewriting the data we serialize it by referencing the existing persistent segments
+	vector<DataPointer> data_pointers;
+	auto segment = (ColumnSegment *)data.GetRootSegment();
+	while (segment) {
+		D_ASSERT(segment->segment_type == ColumnSegmentType::PERSISTENT);
+		DataPointer pointer;
+		pointer.block_pointer.block_id = segment->GetBlockId();
+		pointer.block_pointer.offset = segment->GetBlockOffset();
+		pointer.row_start = segment->start;
+		pointer.tuple_count = segment->count;
+		pointer.compression_type = segment->function->type;
+		pointer.statistics = segment->stats.statistics->Copy();
+		data_pointers.push_back(std::move(pointer));
+		segment = (ColumnSegment *)segment->Next();
+	}
+	writer.WriteColumnDataPointers(data_pointers);
+}
+
 void ColumnData::DeserializeColumn(Deserializer &source) {
 	// load the data pointers for the column
 	idx_t data_pointer_count = source.Read<idx_t>();
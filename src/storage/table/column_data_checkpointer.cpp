@@ -1,5 +1,6 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -35,21 +36,32 @@ ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
 
-void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback) {
+void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx_t)> &callback, idx_t vector_stride) {
 	Vector scan_vector(intermediate.GetType(), nullptr);
+	idx_t vector_index = 0;
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = (ColumnSegment *)nodes[segment_idx].node.get();
 		ColumnScanState scan_state;
 		scan_state.current = segment;
 		segment->InitializeScan(scan_state);
+		scan_state.internal_index = segment->start;
 
 		for (idx_t base_row_index = 0; base_row_index < segment->count; base_row_index += STANDARD_VECTOR_SIZE) {
+			if (vector_stride > 1 && vector_index++ % vector_stride != 0) {
+				// this vector is not part of the sample
+				continue;
+			}
 			scan_vector.Reference(intermediate);
 
 			idx_t count = MinValue<idx_t>(segment->count - base_row_index, STANDARD_VECTOR_SIZE);
 			scan_state.row_index = segment->start + base_row_index;
+			if (scan_state.internal_index < scan_state.row_index) {
+				// skip over the vectors in between the sampled vectors
+				segment->Skip(scan_state);
+			}
 
 			col_data.CheckpointScan(segment, scan_state, row_group.start, count, scan_vector);
+			scan_state.internal_index = scan_state.row_index + count;
 
 			callback(scan_vector, count);
 		}
@@ -83,19 +95,8 @@ CompressionType ForceCompression(vector<CompressionFunction *> &compression_func
 	return found ? compression_type : CompressionType::COMPRESSION_AUTO;
 }
 
-unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
-	D_ASSERT(!compression_functions.empty());
-	auto &config = DBConfig::GetConfig(GetDatabase());
-	CompressionType forced_method = CompressionType::COMPRESSION_AUTO;
-
-	auto compression_type = checkpoint_info.compression_type;
-	if (compression_type != CompressionType::COMPRESSION_AUTO) {
-		forced_method = ForceCompression(compression_functions, compression_type);
-	}
-	if (compression_type == CompressionType::COMPRESSION_AUTO &&
-	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
-		forced_method = ForceCompression(compression_functions, config.options.force_compression);
-	}
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::RunAnalyze(idx_t vector_stride, CompressionType forced_method,
+                                                            idx_t &compression_idx) {
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
@@ -107,21 +108,23 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 		analyze_states.push_back(compression_functions[i]->init_analyze(col_data, col_data.type.InternalType()));
 	}
 
-	// scan over all the segments and run the analyze step
-	ScanSegments([&](Vector &scan_vector, idx_t count) {
-		for (idx_t i = 0; i < compression_functions.size(); i++) {
-			if (!compression_functions[i]) {
-				continue;
-			}
-			auto success = compression_functions[i]->analyze(*analyze_states[i], scan_vector, count);
-			if (!success) {
-				// could not use this compression function on this data set
-				// erase it
-				compression_functions[i] = nullptr;
-				analyze_states[i].reset();
-			}
-		}
-	});
+	// scan over the segments and run the analyze step
+	ScanSegments(
+	    [&](Vector &scan_vector, idx_t count) {
+		    for (idx_t i = 0; i < compression_functions.size(); i++) {
+			    if (!compression_functions[i]) {
+				    continue;
+			    }
+			    auto success = compression_functions[i]->analyze(*analyze_states[i], scan_vector, count);
+			    if (!success) {
+				    // could not use this compression function on this data set
+				    // erase it
+				    compression_functions[i] = nullptr;
+				    analyze_states[i].reset();
+			    }
+		    }
+	    },
+	    vector_stride);
 
 	// now that we have passed over all the data, we need to figure out the best method
 	// we do this using the final_analyze method
@@ -154,6 +157,56 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	return state;
 }
 
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
+	D_ASSERT(!compression_functions.empty());
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	CompressionType forced_method = CompressionType::COMPRESSION_AUTO;
+
+	auto compression_type = checkpoint_info.compression_type;
+	if (compression_type != CompressionType::COMPRESSION_AUTO) {
+		forced_method = ForceCompression(compression_functions, compression_type);
+	}
+	if (compression_type == CompressionType::COMPRESSION_AUTO &&
+	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
+		forced_method = ForceCompression(compression_functions, config.options.force_compression);
+	}
+
+	// count the vectors to be checkpointed to determine the sampling stride
+	idx_t total_vectors = 0;
+	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+		auto segment = (ColumnSegment *)nodes[segment_idx].node.get();
+		total_vectors += (segment->count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	}
+	const idx_t sample_stride = total_vectors / ANALYZE_SAMPLE_VECTORS;
+	if (sample_stride <= 1) {
+		// little data: analyze all of it with every compression method
+		return RunAnalyze(1, forced_method, compression_idx);
+	}
+
+	// lots of data: rank the compression methods on a bounded sample of the vectors, then run the full analyze
+	// pass only for the winner (whose analyze state the compression step requires to cover all of the data)
+	auto all_functions = compression_functions;
+	auto sample_state = RunAnalyze(sample_stride, forced_method, compression_idx);
+	while (sample_state) {
+		for (idx_t i = 0; i < compression_functions.size(); i++) {
+			if (i != compression_idx) {
+				compression_functions[i] = nullptr;
+			}
+		}
+		idx_t full_idx;
+		auto full_state = RunAnalyze(1, forced_method, full_idx);
+		if (full_state) {
+			compression_idx = full_idx;
+			return full_state;
+		}
+		// the sample misled us: the winner cannot represent the full data - retry without it
+		all_functions[compression_idx] = nullptr;
+		compression_functions = all_functions;
+		sample_state = RunAnalyze(sample_stride, forced_method, compression_idx);
+	}
+	return nullptr;
+}
+
 void ColumnDataCheckpointer::WriteToDisk() {
 	// there were changes or transient segments
 	// we need to rewrite the column segments to disk
@@ -185,10 +238,23 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	// now that we have analyzed the compression functions we can start writing to disk
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	// since the column is scanned for the compression anyway, also collect a histogram sample of numeric columns
+	// for use in selectivity estimation
+	bool collect_histogram = !is_validity && EquiDepthHistogram::SupportsType(GetType());
+	vector<double> histogram_sample;
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (collect_histogram) {
+			EquiDepthHistogram::SampleValues(scan_vector, count, histogram_sample);
+		}
+		best_function->compress(*compress_state, scan_vector, count);
+	});
 	best_function->compress_finalize(*compress_state);
 
+	if (collect_histogram && state.global_stats->type.IsNumeric()) {
+		auto &numeric_stats = (NumericStatistics &)*state.global_stats;
+		numeric_stats.histogram = EquiDepthHistogram::FromSample(histogram_sample);
+	}
+
 	nodes.clear();
 }
 
@@ -1,5 +1,6 @@
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/common/limits.hpp"
+#include "duckdb/common/thread_io_counters.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
@@ -8,9 +9,13 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
+#include "duckdb/function/compression/compression.hpp"
 #include "duckdb/main/config.hpp"
 
+#include "fsst.h"
+
 #include <cstring>
 
 namespace duckdb {
@@ -83,6 +88,22 @@ ColumnSegment::~ColumnSegment() {
 //===--------------------------------------------------------------------===//
 void ColumnSegment::InitializeScan(ColumnScanState &state) {
 	state.scan_state = function->init_scan(*this);
+	// hint the next segment of this column, so its block read can proceed while this segment is scanned
+	auto next_segment = (ColumnSegment *)Next();
+	if (next_segment) {
+		next_segment->Prefetch();
+	}
+}
+
+void ColumnSegment::Prefetch() {
+	if (segment_type != ColumnSegmentType::PERSISTENT) {
+		return;
+	}
+	if (!block || block->IsLoaded()) {
+		// the block is already in memory: there is nothing to read ahead
+		return;
+	}
+	block->block_manager.Prefetch(block_id);
 }
 
 void ColumnSegment::Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset,
@@ -104,10 +125,19 @@ void ColumnSegment::Skip(ColumnScanState &state) {
 
 void ColumnSegment::Scan(ColumnScanState &state, idx_t scan_count, Vector &result) {
 	function->scan_vector(*this, state, scan_count, result);
+	if (function->type != CompressionType::COMPRESSION_UNCOMPRESSED &&
+	    function->type != CompressionType::COMPRESSION_CONSTANT) {
+		// approximate the decompressed size by the in-memory size of the scanned values
+		ThreadIOCounters::Get().decompressed_bytes += scan_count * type_size;
+	}
 }
 
 void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset) {
 	function->scan_partial(*this, state, scan_count, result, result_offset);
+	if (function->type != CompressionType::COMPRESSION_UNCOMPRESSED &&
+	    function->type != CompressionType::COMPRESSION_CONSTANT) {
+		ThreadIOCounters::Get().decompressed_bytes += scan_count * type_size;
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -302,6 +332,139 @@ static void FilterSelectionSwitch(T *vec, T *predicate, SelectionVector &sel, id
 	sel.Initialize(new_sel);
 }
 
+//! The maximum expansion of an FSST symbol is 8 bytes, escapes compress 2 bytes into 1
+static constexpr idx_t FSST_MAX_EXPANSION = 8;
+
+template <class OP, bool IS_EQUALITY>
+static idx_t TemplatedCompressedStringSelection(Vector &result, const string_t &predicate, SelectionVector &sel,
+                                                idx_t approved_tuple_count, ValidityMask &mask,
+                                                SelectionVector &result_sel, vector<unsigned char> &buffer) {
+	auto compressed_data = FSSTVector::GetCompressedData<string_t>(result);
+	auto decoder = (duckdb_fsst_decoder_t *)FSSTVector::GetDecoder(result);
+	bool has_null = !mask.AllValid();
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (has_null && !mask.RowIsValid(idx)) {
+			continue;
+		}
+		auto &compressed = compressed_data[idx];
+		idx_t compressed_size = compressed.GetSize();
+		if (IS_EQUALITY) {
+			// the decompressed length is bounded by the compressed length: skip rows for which the
+			// predicate length falls outside of these bounds without decompressing them
+			if (predicate.GetSize() > compressed_size * FSST_MAX_EXPANSION ||
+			    predicate.GetSize() * 2 < compressed_size) {
+				continue;
+			}
+		}
+		string_t value;
+		if (compressed_size == 0) {
+			value = string_t(nullptr, 0);
+		} else {
+			if (buffer.size() < compressed_size * FSST_MAX_EXPANSION) {
+				buffer.resize(compressed_size * FSST_MAX_EXPANSION);
+			}
+			auto decompressed_size =
+			    duckdb_fsst_decompress(decoder, compressed_size, (unsigned char *)compressed.GetDataUnsafe(),
+			                           buffer.size(), buffer.data());
+			value = string_t((const char *)buffer.data(), decompressed_size);
+		}
+		if (OP::Operation(value, predicate)) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	return result_count;
+}
+
+//! Evaluate a constant comparison on an FSST vector: rows are decompressed one at a time into a
+//! scratch buffer, so that only the rows surviving all filters are materialized afterwards
+static void CompressedStringFilterSelection(Vector &result, const ConstantFilter &constant_filter,
+                                            SelectionVector &sel, idx_t &approved_tuple_count, ValidityMask &mask) {
+	auto &str_value = StringValue::Get(constant_filter.constant);
+	string_t predicate(str_value.c_str(), str_value.size());
+	SelectionVector new_sel(approved_tuple_count);
+	vector<unsigned char> buffer;
+	switch (constant_filter.comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		approved_tuple_count = TemplatedCompressedStringSelection<Equals, true>(result, predicate, sel,
+		                                                                        approved_tuple_count, mask, new_sel,
+		                                                                        buffer);
+		break;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		approved_tuple_count = TemplatedCompressedStringSelection<NotEquals, false>(result, predicate, sel,
+		                                                                            approved_tuple_count, mask,
+		                                                                            new_sel, buffer);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		approved_tuple_count = TemplatedCompressedStringSelection<LessThan, false>(result, predicate, sel,
+		                                                                           approved_tuple_count, mask, new_sel,
+		                                                                           buffer);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		approved_tuple_count = TemplatedCompressedStringSelection<GreaterThan, false>(result, predicate, sel,
+		                                                                              approved_tuple_count, mask,
+		                                                                              new_sel, buffer);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		approved_tuple_count = TemplatedCompressedStringSelection<LessThanEquals, false>(result, predicate, sel,
+		                                                                                 approved_tuple_count, mask,
+		                                                                                 new_sel, buffer);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		approved_tuple_count = TemplatedCompressedStringSelection<GreaterThanEquals, false>(result, predicate, sel,
+		                                                                                    approved_tuple_count, mask,
+		                                                                                    new_sel, buffer);
+		break;
+	default:
+		throw NotImplementedException("Unknown comparison type for filter pushed down to table!");
+	}
+	sel.Initialize(new_sel);
+}
+
+bool ColumnSegment::CanFilterCompressedStrings(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_or = (const ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction_or.child_filters) {
+			if (!CanFilterCompressedStrings(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (!CanFilterCompressedStrings(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = (const ConstantFilter &)filter;
+		switch (constant_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOTEQUAL:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			return constant_filter.constant.type().InternalType() == PhysicalType::VARCHAR;
+		default:
+			return false;
+		}
+	}
+	case TableFilterType::IS_NULL:
+	case TableFilterType::IS_NOT_NULL:
+		// null filters only inspect the validity mask
+		return true;
+	default:
+		return false;
+	}
+}
+
 template <bool IS_NULL>
 static idx_t TemplatedNullSelection(SelectionVector &sel, idx_t &approved_tuple_count, ValidityMask &mask) {
 	if (mask.AllValid()) {
@@ -328,7 +491,8 @@ static idx_t TemplatedNullSelection(SelectionVector &sel, idx_t &approved_tuple_
 }
 
 idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const TableFilter &filter,
-                                     idx_t &approved_tuple_count, ValidityMask &mask) {
+                                     idx_t &approved_tuple_count, ValidityMask &mask,
+                                     SegmentScanState *segment_scan) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_OR: {
 		// similar to the CONJUNCTION_AND, but we need to take care of the SelectionVectors (OR all of them)
@@ -339,7 +503,7 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 			SelectionVector temp_sel;
 			temp_sel.Initialize(sel);
 			idx_t temp_tuple_count = approved_tuple_count;
-			idx_t temp_count = FilterSelection(temp_sel, result, *child_filter, temp_tuple_count, mask);
+			idx_t temp_count = FilterSelection(temp_sel, result, *child_filter, temp_tuple_count, mask, segment_scan);
 			// tuples passed, move them into the actual result vector
 			for (idx_t i = 0; i < temp_count; i++) {
 				auto new_idx = temp_sel.get_index(i);
@@ -362,7 +526,7 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction_and = (ConjunctionAndFilter &)filter;
 		for (auto &child_filter : conjunction_and.child_filters) {
-			FilterSelection(sel, result, *child_filter, approved_tuple_count, mask);
+			FilterSelection(sel, result, *child_filter, approved_tuple_count, mask, segment_scan);
 		}
 		return approved_tuple_count;
 	}
@@ -459,6 +623,17 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 			break;
 		}
 		case PhysicalType::VARCHAR: {
+			if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR && segment_scan) {
+				// the dictionary of the segment is sorted: binary search it once and filter the codes
+				DictionaryCompressionFun::FilterSelection(*segment_scan, result, constant_filter, sel,
+				                                          approved_tuple_count);
+				break;
+			}
+			if (result.GetVectorType() == VectorType::FSST_VECTOR) {
+				// evaluate the comparison on the compressed strings without flattening the vector
+				CompressedStringFilterSelection(result, constant_filter, sel, approved_tuple_count, mask);
+				break;
+			}
 			auto result_flat = FlatVector::GetData<string_t>(result);
 			Vector predicate_vector(constant_filter.constant);
 			auto predicate = FlatVector::GetData<string_t>(predicate_vector);
@@ -483,6 +658,15 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 		return TemplatedNullSelection<true>(sel, approved_tuple_count, mask);
 	case TableFilterType::IS_NOT_NULL:
 		return TemplatedNullSelection<false>(sel, approved_tuple_count, mask);
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = (DynamicFilter &)filter;
+		lock_guard<mutex> glock(dynamic_filter.filter_data->lock);
+		if (!dynamic_filter.filter_data->initialized) {
+			// no bound has been published yet - nothing can be filtered out
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, result, *dynamic_filter.filter_data->filter, approved_tuple_count, mask);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
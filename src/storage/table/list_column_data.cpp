@@ -271,6 +271,13 @@ unique_ptr<BaseStatistics> ListColumnData::GetUpdateStatistics() {
 	return nullptr;
 }
 
+void ListColumnData::PrefetchRow(row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks) {
+	// hint the list entries and validity; the child rows are only known after the list entry itself has been read,
+	// so they cannot be hinted up-front
+	ColumnData::PrefetchRow(row_id, prefetch_blocks);
+	validity.PrefetchRow(row_id, prefetch_blocks);
+}
+
 void ListColumnData::FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
                               idx_t result_idx) {
 	// insert any child states that are required
@@ -369,6 +376,20 @@ unique_ptr<ColumnCheckpointState> ListColumnData::Checkpoint(RowGroup &row_group
 	return base_state;
 }
 
+bool ListColumnData::IsPersistent() {
+	return ColumnData::IsPersistent() && validity.IsPersistent() && child_column->IsPersistent();
+}
+
+bool ListColumnData::HasUpdates() {
+	return ColumnData::HasUpdates() || validity.HasUpdates() || child_column->HasUpdates();
+}
+
+void ListColumnData::SerializeColumn(RowGroupWriter &writer) {
+	ColumnData::SerializeColumn(writer);
+	validity.SerializeColumn(writer);
+	child_column->SerializeColumn(writer);
+}
+
 void ListColumnData::DeserializeColumn(Deserializer &source) {
 	ColumnData::DeserializeColumn(source);
 	validity.DeserializeColumn(source);
@@ -106,9 +106,14 @@ bool RowGroup::InitializeScanWithOffset(RowGroupScanState &state, idx_t vector_o
 	state.vector_index = vector_offset;
 	state.max_row = this->start > parent_max_row ? 0 : MinValue<idx_t>(this->count, parent_max_row - this->start);
 	state.column_scans = unique_ptr<ColumnScanState[]>(new ColumnScanState[column_ids.size()]);
+	auto &projected_struct_fields = state.GetProjectedStructFields();
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto column = column_ids[i];
 		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			auto struct_entry = projected_struct_fields.find(column);
+			if (struct_entry != projected_struct_fields.end()) {
+				state.column_scans[i].scan_child_columns = struct_entry->second;
+			}
 			columns[column]->InitializeScanWithOffset(state.column_scans[i],
 			                                          start + vector_offset * STANDARD_VECTOR_SIZE);
 		} else {
@@ -131,9 +136,14 @@ bool RowGroup::InitializeScan(RowGroupScanState &state) {
 	state.vector_index = 0;
 	state.max_row = this->start > parent_max_row ? 0 : MinValue<idx_t>(this->count, parent_max_row - this->start);
 	state.column_scans = unique_ptr<ColumnScanState[]>(new ColumnScanState[column_ids.size()]);
+	auto &projected_struct_fields = state.GetProjectedStructFields();
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto column = column_ids[i];
 		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			auto struct_entry = projected_struct_fields.find(column);
+			if (struct_entry != projected_struct_fields.end()) {
+				state.column_scans[i].scan_child_columns = struct_entry->second;
+			}
 			columns[column]->InitializeScan(state.column_scans[i]);
 		} else {
 			state.column_scans[i].current = nullptr;
@@ -420,6 +430,10 @@ void RowGroup::TemplatedScan(TransactionData transaction, RowGroupScanState &sta
 				continue;
 			}
 			//! Now we use the selection vector to fetch data for the other columns.
+			// if only very few rows survived the filters, fetching those rows directly is cheaper
+			// than scanning and decompressing the entire vector for every remaining column
+			bool fetch_surviving_rows = table_filters && TYPE == TableScanType::TABLE_SCAN_REGULAR &&
+			                            approved_tuple_count * LATE_MATERIALIZATION_FACTOR < max_count;
 			for (idx_t i = 0; i < column_ids.size(); i++) {
 				if (!table_filters || table_filters->filters.find(i) == table_filters->filters.end()) {
 					auto column = column_ids[i];
@@ -430,6 +444,15 @@ void RowGroup::TemplatedScan(TransactionData transaction, RowGroupScanState &sta
 						for (size_t sel_idx = 0; sel_idx < approved_tuple_count; sel_idx++) {
 							result_data[sel_idx] = this->start + current_row + sel.get_index(sel_idx);
 						}
+					} else if (fetch_surviving_rows) {
+						// late materialization: skip the sequential scan of this column and
+						// rematerialize the surviving rows through the row fetch path instead
+						columns[column]->Skip(state.column_scans[i]);
+						ColumnFetchState fetch_state;
+						for (idx_t sel_idx = 0; sel_idx < approved_tuple_count; sel_idx++) {
+							auto row_id = row_t(this->start + current_row + sel.get_index(sel_idx));
+							columns[column]->FetchRow(transaction, fetch_state, row_id, result.data[i], sel_idx);
+						}
 					} else {
 						if (TYPE == TableScanType::TABLE_SCAN_REGULAR) {
 							columns[column]->FilterScan(transaction, state.vector_index, state.column_scans[i],
@@ -537,6 +560,18 @@ void RowGroup::FetchRow(TransactionData transaction, ColumnFetchState &state, co
 	}
 }
 
+void RowGroup::PrefetchRow(const vector<column_t> &column_ids, row_t row_id,
+                           vector<shared_ptr<BlockHandle>> &prefetch_blocks) {
+	for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+		auto column = column_ids[col_idx];
+		if (column == COLUMN_IDENTIFIER_ROW_ID) {
+			// row id column: no blocks have to be read
+			continue;
+		}
+		columns[column]->PrefetchRow(row_id, prefetch_blocks);
+	}
+}
+
 void RowGroup::AppendVersionInfo(TransactionData transaction, idx_t count) {
 	idx_t row_group_start = this->count.load();
 	idx_t row_group_end = row_group_start + count;
@@ -716,25 +751,68 @@ RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
 	return result;
 }
 
-RowGroupPointer RowGroup::Checkpoint(RowGroupWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats) {
-	RowGroupPointer row_group_pointer;
+bool RowGroup::IsPersistent() {
+	for (auto &column : columns) {
+		if (!column->IsPersistent()) {
+			return false;
+		}
+	}
+	return true;
+}
 
-	vector<CompressionType> compression_types;
-	compression_types.reserve(columns.size());
-	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
-		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+bool RowGroup::IsCompactable(transaction_t min_start_time) {
+	if (version_info) {
+		idx_t vector_count = (count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+		for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+			auto info = version_info->info[vector_idx].get();
+			if (info && !info->IsFullyCommitted(min_start_time)) {
+				return false;
+			}
+		}
 	}
-	auto result = WriteToDisk(writer.GetPartialBlockManager(), compression_types);
+	return !HasUpdates();
+}
+
+bool RowGroup::HasUpdates() {
+	for (auto &column : columns) {
+		if (column->HasUpdates()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+idx_t RowGroup::GetCommittedDeletedCount() {
+	if (!version_info) {
+		return 0;
+	}
+	idx_t deleted_count = 0;
+	idx_t vector_count = (count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+		auto info = version_info->info[vector_idx].get();
+		if (!info) {
+			continue;
+		}
+		idx_t max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - vector_idx * STANDARD_VECTOR_SIZE);
+		deleted_count += info->GetCommittedDeletedCount(max_count);
+	}
+	return deleted_count;
+}
+
+RowGroupPointer RowGroup::Checkpoint(RowGroupWriter &writer, RowGroupWriteData &&write_data,
+                                     vector<unique_ptr<BaseStatistics>> &global_stats) {
+	RowGroupPointer row_group_pointer;
+
 	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
-		global_stats[column_idx]->Merge(*result.statistics[column_idx]);
+		global_stats[column_idx]->Merge(*write_data.statistics[column_idx]);
 	}
-	row_group_pointer.statistics = std::move(result.statistics);
+	row_group_pointer.statistics = std::move(write_data.statistics);
 
 	// construct the row group pointer and write the column meta data to disk
-	D_ASSERT(result.states.size() == columns.size());
+	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
-	for (auto &state : result.states) {
+	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
 		auto pointer = data_writer.GetBlockPointer();
@@ -753,6 +831,41 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriter &writer, vector<unique_ptr<B
 	return row_group_pointer;
 }
 
+RowGroupPointer RowGroup::Checkpoint(RowGroupWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats) {
+	RowGroupPointer row_group_pointer;
+
+	if (IsPersistent()) {
+		// the row group was not modified since it was last checkpointed
+		// serialize the row group by referencing the existing on-disk data instead of rewriting it
+		// note that deletes are serialized separately through the version info and do not dirty the column data
+		row_group_pointer.row_start = start;
+		row_group_pointer.tuple_count = count;
+		for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
+			auto column_stats = GetStatistics(column_idx);
+			global_stats[column_idx]->Merge(*column_stats);
+			row_group_pointer.statistics.push_back(std::move(column_stats));
+
+			// get the current position of the table data writer
+			auto &data_writer = writer.GetPayloadWriter();
+			row_group_pointer.data_pointers.push_back(data_writer.GetBlockPointer());
+
+			// write the pointers to the existing column segments
+			columns[column_idx]->SerializeColumn(writer);
+		}
+		row_group_pointer.versions = version_info;
+		Verify();
+		return row_group_pointer;
+	}
+
+	vector<CompressionType> compression_types;
+	compression_types.reserve(columns.size());
+	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
+		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+	}
+	auto result = WriteToDisk(writer.GetPartialBlockManager(), compression_types);
+	return Checkpoint(writer, std::move(result), global_stats);
+}
+
 void RowGroup::CheckpointDeletes(VersionNode *versions, Serializer &serializer) {
 	if (!versions) {
 		// no version information: write nothing
@@ -6,17 +6,104 @@
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
+#include "duckdb/common/preserved_error.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
+#include "duckdb/storage/meta_block_reader.hpp"
+#include "duckdb/parser/column_list.hpp"
+#include "duckdb/transaction/transaction_manager.hpp"
+
+#include <condition_variable>
+#include <thread>
 
 namespace duckdb {
 
+//! The location of serialized table data that has not been deserialized yet
+struct RowGroupCollectionLazyData {
+	RowGroupCollectionLazyData(ColumnList columns_p, block_id_t block_id, uint64_t offset)
+	    : columns(std::move(columns_p)), block_id(block_id), offset(offset) {
+	}
+
+	//! The columns of the table, required to deserialize the row group pointers
+	ColumnList columns;
+	//! The location of the serialized table data within the checkpoint
+	block_id_t block_id;
+	uint64_t offset;
+};
+
+//! State shared between a row group collection and its background compaction task. The task may outlive the
+//! collection (it sits in the scheduler queue), so the state is reference counted and holds a back pointer that the
+//! collection clears on destruction.
+struct RowGroupCompactionState {
+	//! Lock protecting this state
+	mutex lock;
+	//! Whether a compaction task is currently scheduled or running
+	bool task_active = false;
+	//! Whether a compaction task is currently executing a compaction pass outside of the lock
+	bool task_running = false;
+	//! Signalled when the compaction task finishes a pass
+	std::condition_variable task_done;
+	//! The collection to compact, or nullptr if it has been destroyed
+	RowGroupCollection *collection = nullptr;
+};
+
+//! Background task that merges adjacent undersized row groups (as produced by continuous small appends) into full
+//! row groups, keeping the per-row-group overhead of scans low and letting the next checkpoint run its compression
+//! analysis over full row groups instead of over the individual fragments
+class RowGroupCompactionTask : public Task {
+public:
+	explicit RowGroupCompactionTask(shared_ptr<RowGroupCompactionState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		RowGroupCollection *collection;
+		{
+			lock_guard<mutex> guard(state->lock);
+			collection = state->collection;
+			if (!collection) {
+				state->task_active = false;
+				return TaskExecutionResult::TASK_FINISHED;
+			}
+			// while task_running is set the collection destructor waits for us, so "collection" stays valid
+			state->task_running = true;
+		}
+		collection->Compact();
+		{
+			lock_guard<mutex> guard(state->lock);
+			state->task_running = false;
+			state->task_active = false;
+		}
+		state->task_done.notify_all();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<RowGroupCompactionState> state;
+};
+
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p) {
+      row_start(row_start_p), has_lazy_data(false) {
 	row_groups = make_shared<SegmentTree>();
 }
 
-idx_t RowGroupCollection::GetTotalRows() const {
+RowGroupCollection::~RowGroupCollection() {
+	if (compaction_state) {
+		unique_lock<mutex> guard(compaction_state->lock);
+		// prevent any further background compaction and wait for an in-flight compaction pass to finish
+		compaction_state->collection = nullptr;
+		while (compaction_state->task_running) {
+			compaction_state->task_done.wait(guard);
+		}
+	}
+}
+
+idx_t RowGroupCollection::GetTotalRows() {
+	EnsureLoaded();
 	return total_rows.load();
 }
 
@@ -45,6 +132,37 @@ void RowGroupCollection::Initialize(PersistentTableData &data) {
 	stats.Initialize(types, data);
 }
 
+void RowGroupCollection::InitializeLazy(const ColumnList &columns, PersistentTableData &data) {
+	D_ASSERT(data.table_data_block != INVALID_BLOCK);
+	lazy_data = make_unique<RowGroupCollectionLazyData>(columns.Copy(), data.table_data_block, data.table_data_offset);
+	has_lazy_data = true;
+}
+
+void RowGroupCollection::EnsureLoaded() {
+	if (!has_lazy_data) {
+		return;
+	}
+	lock_guard<mutex> guard(lazy_load_lock);
+	if (!has_lazy_data) {
+		return;
+	}
+	auto lazy = std::move(lazy_data);
+
+	// deserialize the statistics and row group pointers from the checkpoint
+	MetaBlockReader reader(block_manager, lazy->block_id);
+	reader.offset = lazy->offset;
+	auto data = TableDataReader::ReadTableData(reader, lazy->columns);
+	Initialize(*data);
+
+	// the cardinality was not known when the catalog entry was created - update it now
+	info->cardinality = total_rows.load();
+	has_lazy_data = false;
+}
+
+bool RowGroupCollection::IsLoaded() const {
+	return !has_lazy_data;
+}
+
 void RowGroupCollection::InitializeEmpty() {
 	stats.InitializeEmpty(types);
 }
@@ -57,6 +175,7 @@ void RowGroupCollection::AppendRowGroup(SegmentLock &l, idx_t start_row) {
 }
 
 RowGroup *RowGroupCollection::GetRowGroup(int64_t index) {
+	EnsureLoaded();
 	return (RowGroup *)row_groups->GetSegmentByIndex(index);
 }
 
@@ -77,8 +196,13 @@ void RowGroupCollection::Verify() {
 //===--------------------------------------------------------------------===//
 // Scan
 //===--------------------------------------------------------------------===//
+//! During the tail of a parallel scan, every thread should see at least this many morsels before the morsel size
+//! bottoms out at a single vector
+static constexpr const idx_t PARALLEL_SCAN_TAIL_MORSELS = 4;
+
 void RowGroupCollection::InitializeScan(CollectionScanState &state, const vector<column_t> &column_ids,
                                         TableFilterSet *table_filters) {
+	EnsureLoaded();
 	auto row_group = (RowGroup *)row_groups->GetRootSegment();
 	D_ASSERT(row_group);
 	state.max_row = row_start + total_rows;
@@ -88,11 +212,13 @@ void RowGroupCollection::InitializeScan(CollectionScanState &state, const vector
 }
 
 void RowGroupCollection::InitializeCreateIndexScan(CreateIndexScanState &state) {
+	EnsureLoaded();
 	state.segment_lock = row_groups->Lock();
 }
 
 void RowGroupCollection::InitializeScanWithOffset(CollectionScanState &state, const vector<column_t> &column_ids,
                                                   idx_t start_row, idx_t end_row) {
+	EnsureLoaded();
 	auto row_group = (RowGroup *)row_groups->GetSegment(start_row);
 	D_ASSERT(row_group);
 	state.max_row = end_row;
@@ -109,6 +235,7 @@ bool RowGroupCollection::InitializeScanInRowGroup(CollectionScanState &state, Ro
 }
 
 void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state) {
+	EnsureLoaded();
 	state.current_row_group = (RowGroup *)row_groups->GetRootSegment();
 	state.vector_index = 0;
 	state.max_row = row_start + total_rows;
@@ -118,28 +245,37 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
 	while (state.current_row_group && state.current_row_group->count > 0) {
-		idx_t vector_index;
+		auto &row_group = *state.current_row_group;
+		idx_t vector_index = state.vector_index;
+		idx_t morsel_vectors;
 		idx_t max_row;
 		if (ClientConfig::GetConfig(context).verify_parallelism) {
-			vector_index = state.vector_index;
-			max_row = state.current_row_group->start +
-			          MinValue<idx_t>(state.current_row_group->count,
-			                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
-			D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
+			morsel_vectors = 1;
+			max_row = row_group.start +
+			          MinValue<idx_t>(row_group.count, STANDARD_VECTOR_SIZE * vector_index + STANDARD_VECTOR_SIZE);
+			D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < row_group.count);
 		} else {
-			vector_index = 0;
-			max_row = state.current_row_group->start + state.current_row_group->count;
+			// adaptive morsel sizing: while plenty of rows remain every thread scans a whole row group at a time, but
+			// towards the tail of the scan the morsels shrink down to vector granularity, so that the last row groups
+			// are divided over all threads instead of the threads idling out one by one
+			idx_t scanned_rows = row_group.start + vector_index * STANDARD_VECTOR_SIZE;
+			idx_t remaining_rows = state.max_row > scanned_rows ? state.max_row - scanned_rows : 0;
+			idx_t threads = MaxValue<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads(), 1);
+			idx_t target_vectors = remaining_rows / (threads * PARALLEL_SCAN_TAIL_MORSELS * STANDARD_VECTOR_SIZE);
+			idx_t row_group_vectors = (row_group.count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+			morsel_vectors = row_group_vectors - vector_index;
+			if (target_vectors < morsel_vectors) {
+				morsel_vectors = MaxValue<idx_t>(target_vectors, 1);
+			}
+			max_row = row_group.start +
+			          MinValue<idx_t>(row_group.count, STANDARD_VECTOR_SIZE * (vector_index + morsel_vectors));
 		}
 		max_row = MinValue<idx_t>(max_row, state.max_row);
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, state.current_row_group, vector_index, max_row);
-		if (ClientConfig::GetConfig(context).verify_parallelism) {
-			state.vector_index++;
-			if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-				state.current_row_group = (RowGroup *)state.current_row_group->Next();
-				state.vector_index = 0;
-			}
-		} else {
+		state.vector_index += morsel_vectors;
+		if (state.vector_index * STANDARD_VECTOR_SIZE >= row_group.count) {
 			state.current_row_group = (RowGroup *)state.current_row_group->Next();
+			state.vector_index = 0;
 		}
 		scan_state.batch_index = ++state.batch_index;
 		if (!need_to_scan) {
@@ -153,6 +289,7 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 
 bool RowGroupCollection::Scan(Transaction &transaction, const vector<column_t> &column_ids,
                               const std::function<bool(DataChunk &chunk)> &fun) {
+	EnsureLoaded();
 	vector<LogicalType> scan_types;
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		scan_types.push_back(types[column_ids[i]]);
@@ -178,6 +315,7 @@ bool RowGroupCollection::Scan(Transaction &transaction, const vector<column_t> &
 }
 
 bool RowGroupCollection::Scan(Transaction &transaction, const std::function<bool(DataChunk &chunk)> &fun) {
+	EnsureLoaded();
 	vector<column_t> column_ids;
 	column_ids.reserve(types.size());
 	for (idx_t i = 0; i < types.size(); i++) {
@@ -191,8 +329,29 @@ bool RowGroupCollection::Scan(Transaction &transaction, const std::function<bool
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
                                const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
-	// figure out which row_group to fetch from
+	EnsureLoaded();
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+	// first pass: hint the reads of any cold blocks the fetch will touch, so the row-by-row fetches below do not
+	// pay the full synchronous read latency per block
+	vector<shared_ptr<BlockHandle>> prefetch_blocks;
+	for (idx_t i = 0; i < fetch_count; i++) {
+		auto row_id = row_ids[i];
+		RowGroup *row_group;
+		{
+			idx_t segment_index;
+			auto l = row_groups->Lock();
+			if (!row_groups->TryGetSegmentIndex(l, row_id, segment_index)) {
+				continue;
+			}
+			row_group = (RowGroup *)row_groups->GetSegmentByIndex(l, segment_index);
+		}
+		row_group->PrefetchRow(column_ids, row_id, prefetch_blocks);
+	}
+	if (!prefetch_blocks.empty()) {
+		auto &buffer_manager = BufferManager::GetBufferManager(info->db);
+		buffer_manager.Prefetch(prefetch_blocks);
+	}
+	// second pass: figure out which row_group to fetch from and perform the actual fetches
 	idx_t count = 0;
 	for (idx_t i = 0; i < fetch_count; i++) {
 		auto row_id = row_ids[i];
@@ -226,7 +385,8 @@ TableAppendState::~TableAppendState() {
 	D_ASSERT(Exception::UncaughtException() || remaining == 0);
 }
 
-bool RowGroupCollection::IsEmpty() const {
+bool RowGroupCollection::IsEmpty() {
+	EnsureLoaded();
 	auto l = row_groups->Lock();
 	return IsEmpty(l);
 }
@@ -236,6 +396,7 @@ bool RowGroupCollection::IsEmpty(SegmentLock &l) const {
 }
 
 void RowGroupCollection::InitializeAppend(TransactionData transaction, TableAppendState &state, idx_t append_count) {
+	EnsureLoaded();
 	state.row_start = total_rows;
 	state.current_row = state.row_start;
 	state.total_append_count = 0;
@@ -270,11 +431,18 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 	idx_t append_count = chunk.size();
 	idx_t remaining = chunk.size();
 	state.total_append_count += append_count;
+	{
+		// update the sortedness statistics before the chunk is (potentially) sliced by the append loop below
+		auto stats_lock = stats.GetLock();
+		for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+			stats.GetStats(col_idx).UpdateSortedness(chunk.data[col_idx], chunk.size());
+		}
+	}
 	while (true) {
 		auto current_row_group = state.row_group_append_state.row_group;
 		// check how much we can fit into the current row_group
 		idx_t append_count =
-		    MinValue<idx_t>(remaining, RowGroup::ROW_GROUP_SIZE - state.row_group_append_state.offset_in_row_group);
+		    MinValue<idx_t>(remaining, info->row_group_size - state.row_group_append_state.offset_in_row_group);
 		if (append_count > 0) {
 			current_row_group->Append(state.row_group_append_state, chunk, append_count);
 			// merge the stats
@@ -332,7 +500,7 @@ void RowGroupCollection::FinalizeAppend(TransactionData transaction, TableAppend
 	auto remaining = state.total_append_count;
 	auto row_group = state.start_row_group;
 	while (remaining > 0) {
-		auto append_count = MinValue<idx_t>(remaining, RowGroup::ROW_GROUP_SIZE - row_group->count);
+		auto append_count = MinValue<idx_t>(remaining, info->row_group_size - row_group->count);
 		row_group->AppendVersionInfo(transaction, append_count);
 		remaining -= append_count;
 		row_group = (RowGroup *)row_group->Next();
@@ -385,6 +553,7 @@ void RowGroupCollection::RevertAppendInternal(idx_t start_row, idx_t count) {
 }
 
 void RowGroupCollection::MergeStorage(RowGroupCollection &data) {
+	EnsureLoaded();
 	D_ASSERT(data.types == types);
 	auto index = row_start + total_rows.load();
 	for (auto segment = data.row_groups->GetRootSegment(); segment; segment = segment->Next()) {
@@ -395,12 +564,292 @@ void RowGroupCollection::MergeStorage(RowGroupCollection &data) {
 	}
 	stats.MergeStats(data.stats);
 	total_rows += data.total_rows.load();
+
+	// local storage flushes tend to produce undersized row groups: schedule a background compaction pass to merge
+	// them back into full row groups
+	ScheduleCompaction();
+}
+
+//===--------------------------------------------------------------------===//
+// Compaction
+//===--------------------------------------------------------------------===//
+void RowGroupCollection::ScheduleCompaction() {
+	// compaction can only run in the background when the scheduler has worker threads; without them the task would
+	// never execute
+	auto &scheduler = TaskScheduler::GetScheduler(info->db.GetDatabase());
+	if (scheduler.NumberOfBackgroundThreads() == 0) {
+		return;
+	}
+	if (!HasCompactionCandidates()) {
+		return;
+	}
+	bool schedule_task;
+	{
+		lock_guard<mutex> compaction_guard(compaction_lock);
+		if (!compaction_state) {
+			compaction_state = make_shared<RowGroupCompactionState>();
+			compaction_state->collection = this;
+		}
+		if (!compaction_producer) {
+			compaction_producer = scheduler.CreateProducer();
+			compaction_producer->priority = TaskPriority::LOW;
+		}
+		lock_guard<mutex> guard(compaction_state->lock);
+		schedule_task = !compaction_state->task_active;
+		compaction_state->task_active = true;
+	}
+	if (schedule_task) {
+		scheduler.ScheduleTask(*compaction_producer, make_unique<RowGroupCompactionTask>(compaction_state));
+	}
+}
+
+bool RowGroupCollection::HasCompactionCandidates() {
+	// cheap size-only check; the compaction task re-checks the eligibility of the row groups in detail
+	auto l = row_groups->Lock();
+	RowGroup *previous = nullptr;
+	for (idx_t segment_idx = 0;; segment_idx++) {
+		auto segment = (RowGroup *)row_groups->GetSegmentByIndex(l, segment_idx);
+		if (!segment || !row_groups->GetSegmentByIndex(l, segment_idx + 1)) {
+			// the last row group is the append target and is never compacted
+			break;
+		}
+		if (previous && previous->count + segment->count <= info->row_group_size) {
+			return true;
+		}
+		previous = segment;
+	}
+	return false;
+}
+
+void RowGroupCollection::Compact() {
+	auto &transaction_manager = TransactionManager::Get(info->db);
+	// the compaction lock blocks out deletes, updates and checkpoints for the duration of the pass; appends are
+	// unaffected, as they only ever touch the last row group, which is never compacted
+	lock_guard<mutex> compaction_guard(compaction_lock);
+	FreeRetiredRowGroups();
+
+	vector<column_t> column_ids;
+	column_ids.reserve(types.size());
+	for (idx_t i = 0; i < types.size(); i++) {
+		column_ids.push_back(i);
+	}
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(GetAllocator(), types);
+
+	idx_t search_start = 0;
+	while (true) {
+		// rows committed before the lowest active start time are visible to every transaction: only row groups whose
+		// rows are all visible (and that carry no deletes or updates) can be merged without any version info
+		auto lowest_active_start = transaction_manager.LowestActiveStart();
+
+		// find the next run of adjacent row groups that can be merged into a single full row group
+		vector<RowGroup *> merge_set;
+		idx_t first_index = 0;
+		idx_t merged_rows = 0;
+		RowGroup *successor = nullptr;
+		{
+			auto l = row_groups->Lock();
+			for (idx_t segment_idx = search_start;; segment_idx++) {
+				auto segment = (RowGroup *)row_groups->GetSegmentByIndex(l, segment_idx);
+				auto next = segment ? (RowGroup *)row_groups->GetSegmentByIndex(l, segment_idx + 1) : nullptr;
+				if (!segment || !next) {
+					// the last row group is the append target and is never compacted
+					break;
+				}
+				bool compactable = segment->IsCompactable(lowest_active_start);
+				if (compactable && merged_rows + segment->count <= info->row_group_size) {
+					// the row group can be added to the current run
+					if (merge_set.empty()) {
+						first_index = segment_idx;
+					}
+					merge_set.push_back(segment);
+					merged_rows += segment->count;
+					successor = next;
+					continue;
+				}
+				if (merge_set.size() >= 2) {
+					break;
+				}
+				// the row group is not eligible or does not fit with the current run: restart the run
+				merge_set.clear();
+				merged_rows = 0;
+				if (compactable && segment->count < info->row_group_size) {
+					first_index = segment_idx;
+					merge_set.push_back(segment);
+					merged_rows = segment->count;
+					successor = next;
+				}
+			}
+		}
+		if (merge_set.size() < 2) {
+			break;
+		}
+
+		// copy the data of the run into a single fresh row group outside of the segment tree lock; concurrent deletes
+		// and updates are blocked by the compaction lock, so the data cannot change while it is copied
+		auto merged = make_unique<RowGroup>(info->db, block_manager, *info, merge_set[0]->start, 0);
+		merged->InitializeEmpty(types);
+		TableAppendState append_state;
+		merged->InitializeAppend(append_state.row_group_append_state);
+
+		TableScanState scan_state;
+		scan_state.Initialize(column_ids);
+		scan_state.table_state.max_row = row_start + total_rows;
+		for (auto &row_group : merge_set) {
+			row_group->InitializeScan(scan_state.table_state.row_group_state);
+			while (true) {
+				scan_chunk.Reset();
+				row_group->ScanCommitted(scan_state.table_state.row_group_state, scan_chunk,
+				                         TableScanType::TABLE_SCAN_COMMITTED_ROWS);
+				if (scan_chunk.size() == 0) {
+					break;
+				}
+				merged->Append(append_state.row_group_append_state, scan_chunk, scan_chunk.size());
+			}
+		}
+		// all rows of the merged row group are visible to every transaction: it needs no version info
+		merged->count = merged_rows;
+
+		{
+			auto l = row_groups->Lock();
+			// re-validate the run: appends never touch it, but a concurrent rollback may have erased trailing row
+			// groups and turned the end of the run into the append target of subsequent appends
+			auto current_successor = (RowGroup *)row_groups->GetSegmentByIndex(l, first_index + merge_set.size());
+			bool valid = current_successor == successor;
+			idx_t current_rows = 0;
+			for (idx_t i = 0; valid && i < merge_set.size(); i++) {
+				auto segment = (RowGroup *)row_groups->GetSegmentByIndex(l, first_index + i);
+				if (segment != merge_set[i]) {
+					valid = false;
+					break;
+				}
+				current_rows += segment->count;
+			}
+			if (valid && current_rows == merged_rows) {
+				// splice the merged row group into the segment tree in place of the run; the replaced row groups can
+				// still be referenced by scans of older transactions, so they are retired instead of freed
+				auto retired = row_groups->ReplaceSegments(l, first_index, merge_set.size(), std::move(merged));
+				for (auto &node : retired) {
+					retired_row_groups.push_back(std::move(node));
+				}
+				// pre-written checkpoint data is keyed by row group and must not outlive replacements
+				DiscardPreparedCheckpointData();
+			}
+		}
+		search_start = first_index + 1;
+	}
+}
+
+void RowGroupCollection::FreeRetiredRowGroups() {
+	if (retired_row_groups.empty()) {
+		return;
+	}
+	// a replaced row group can still be referenced by scans of transactions that started before the replacement; new
+	// transactions can only reach the replacement through the segment tree, so once no transactions are active at all
+	// the retired row groups have become unreachable
+	auto &transaction_manager = TransactionManager::Get(info->db);
+	if (transaction_manager.LowestActiveStart() < TRANSACTION_ID_START) {
+		return;
+	}
+	retired_row_groups.clear();
+}
+
+//===--------------------------------------------------------------------===//
+// Vacuum
+//===--------------------------------------------------------------------===//
+void RowGroupCollection::Vacuum() {
+	EnsureLoaded();
+	// exclusive access to the database is guaranteed by the caller; the background compaction task is not a client,
+	// so it has to be blocked out explicitly through the compaction lock
+	lock_guard<mutex> compaction_guard(compaction_lock);
+	// with exclusive access no transaction can still reference row groups replaced by earlier compaction passes
+	retired_row_groups.clear();
+
+	// removing a row shifts the row ids of all rows that follow it: the rewrite has to start at the first row group
+	// that contains a committed delete and covers everything from there to the end of the table
+	idx_t vacuum_index = 0;
+	idx_t vacuum_start = 0;
+	bool requires_vacuum = false;
+	{
+		auto l = row_groups->Lock();
+		for (idx_t segment_idx = 0;; segment_idx++) {
+			auto segment = (RowGroup *)row_groups->GetSegmentByIndex(l, segment_idx);
+			if (!segment) {
+				break;
+			}
+			if (segment->GetCommittedDeletedCount() > 0) {
+				vacuum_index = segment_idx;
+				vacuum_start = segment->start;
+				requires_vacuum = true;
+				break;
+			}
+		}
+	}
+	if (!requires_vacuum) {
+		return;
+	}
+
+	// copy the surviving rows of the affected row groups into a fresh collection, skipping the deleted rows
+	vector<column_t> column_ids;
+	column_ids.reserve(types.size());
+	for (idx_t i = 0; i < types.size(); i++) {
+		column_ids.push_back(i);
+	}
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(GetAllocator(), types);
+
+	RowGroupCollection vacuum_collection(info, block_manager, types, vacuum_start);
+	vacuum_collection.InitializeEmpty();
+	TableAppendState append_state;
+	vacuum_collection.InitializeAppend(append_state);
+
+	TableScanState scan_state;
+	scan_state.Initialize(column_ids);
+	scan_state.table_state.max_row = row_start + total_rows;
+	for (auto segment = row_groups->GetSegment(vacuum_start); segment; segment = segment->Next()) {
+		auto &row_group = (RowGroup &)*segment;
+		row_group.InitializeScan(scan_state.table_state.row_group_state);
+		while (true) {
+			scan_chunk.Reset();
+			row_group.ScanCommitted(scan_state.table_state.row_group_state, scan_chunk,
+			                        TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
+			if (scan_chunk.size() == 0) {
+				break;
+			}
+			vacuum_collection.Append(scan_chunk, append_state);
+		}
+	}
+	vacuum_collection.FinalizeAppend(TransactionData(0, 0), append_state);
+
+	// replace the affected row groups with the rewritten ones; the replaced row groups are freed immediately, as
+	// exclusive access means no scan can still reference them
+	// pre-written checkpoint data is keyed by row group and must not outlive replacements
+	DiscardPreparedCheckpointData();
+	idx_t vacuumed_rows = vacuum_collection.total_rows.load();
+	{
+		auto l = row_groups->Lock();
+		auto old_nodes = row_groups->MoveSegments(l);
+		for (idx_t i = 0; i < vacuum_index; i++) {
+			row_groups->AppendSegment(l, std::move(old_nodes[i].node));
+		}
+		auto vacuum_lock = vacuum_collection.row_groups->Lock();
+		auto new_nodes = vacuum_collection.row_groups->MoveSegments(vacuum_lock);
+		for (auto &node : new_nodes) {
+			row_groups->AppendSegment(l, std::move(node.node));
+		}
+	}
+	total_rows = vacuum_start - row_start + vacuumed_rows;
+	info->cardinality = total_rows.load();
+	Verify();
 }
 
 //===--------------------------------------------------------------------===//
 // Delete
 //===--------------------------------------------------------------------===//
 idx_t RowGroupCollection::Delete(TransactionData transaction, DataTable *table, row_t *ids, idx_t count) {
+	EnsureLoaded();
+	// prevent the background compaction task from replacing row groups while we hold pointers to them
+	lock_guard<mutex> compaction_guard(compaction_lock);
 	idx_t delete_count = 0;
 	// delete is in the row groups
 	// we need to figure out for each id to which row group it belongs
@@ -432,6 +881,9 @@ idx_t RowGroupCollection::Delete(TransactionData transaction, DataTable *table,
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const vector<PhysicalIndex> &column_ids,
                                 DataChunk &updates) {
+	EnsureLoaded();
+	// prevent the background compaction task from replacing row groups while we hold pointers to them
+	lock_guard<mutex> compaction_guard(compaction_lock);
 	idx_t pos = 0;
 	do {
 		idx_t start = pos;
@@ -456,12 +908,15 @@ void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const v
 		auto l = stats.GetLock();
 		for (idx_t i = 0; i < column_ids.size(); i++) {
 			auto column_id = column_ids[i];
+			// updates overwrite values in-place, which invalidates any tracked sortedness
+			stats.GetStats(column_id.index).SetUnsorted();
 			stats.MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
 		}
 	} while (pos < updates.size());
 }
 
 void RowGroupCollection::RemoveFromIndexes(TableIndexList &indexes, Vector &row_identifiers, idx_t count) {
+	EnsureLoaded();
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 
 	// figure out which row_group to fetch from
@@ -504,26 +959,269 @@ void RowGroupCollection::RemoveFromIndexes(TableIndexList &indexes, Vector &row_
 
 void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_ids, const vector<column_t> &column_path,
                                       DataChunk &updates) {
+	EnsureLoaded();
 	auto first_id = FlatVector::GetValue<row_t>(row_ids, 0);
 	if (first_id >= MAX_ROW_ID) {
 		throw NotImplementedException("Cannot update a column-path on transaction local data");
 	}
+	// prevent the background compaction task from replacing row groups while we hold pointers to them
+	lock_guard<mutex> compaction_guard(compaction_lock);
 	// find the row_group this id belongs to
 	auto primary_column_idx = column_path[0];
 	auto row_group = (RowGroup *)row_groups->GetSegment(first_id);
 	row_group->UpdateColumn(transaction, updates, row_ids, column_path);
 
+	stats.GetStats(primary_column_idx).SetUnsorted();
 	row_group->MergeIntoStatistics(primary_column_idx, *stats.GetStats(primary_column_idx).stats);
 }
 
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
+void RowGroupCollection::PrepareCheckpoint(const vector<CompressionType> &compression_types) {
+	if (!IsLoaded()) {
+		// the table data was never loaded: none of the row groups can be modified
+		return;
+	}
+	// deletes and updates take the compaction lock: holding it keeps the column data of the row groups stable while
+	// it is written, without blocking out readers or appends (which only ever touch the last row group)
+	lock_guard<mutex> compaction_guard(compaction_lock);
+	// free the blocks of a previous pre-write whose checkpoint never happened
+	DiscardPreparedCheckpointData();
+
+	// collect the row groups that are safe to pre-write: the last row group is the append target, and row groups
+	// with uncommitted rows can still be erased by a rollback, which could recycle their allocation
+	vector<RowGroup *> groups;
+	{
+		auto l = row_groups->Lock();
+		for (idx_t segment_idx = 0;; segment_idx++) {
+			auto segment = (RowGroup *)row_groups->GetSegmentByIndex(l, segment_idx);
+			auto next = segment ? segment->Next() : nullptr;
+			if (!segment || !next) {
+				break;
+			}
+			if (!segment->IsPersistent() && segment->IsCompactable(TRANSACTION_ID_START)) {
+				groups.push_back(segment);
+			}
+		}
+	}
+
+	PartialBlockManager partial_block_manager(block_manager);
+	try {
+		for (auto &row_group : groups) {
+			PreparedRowGroupData prepared;
+			prepared.count = row_group->count;
+			prepared.data = row_group->WriteToDisk(partial_block_manager, compression_types);
+			for (auto &state : prepared.data.states) {
+				state->GetBlockIds(prepared.blocks);
+			}
+			prepared_checkpoint_data[row_group] = std::move(prepared);
+		}
+		partial_block_manager.FlushPartialBlocks();
+	} catch (...) {
+		// a failure during the pre-write is not fatal: the checkpoint itself writes the data of the row groups
+		partial_block_manager.Clear();
+		DiscardPreparedCheckpointData();
+		throw;
+	}
+}
+
+void RowGroupCollection::DiscardPreparedCheckpointData(const unordered_set<block_id_t> *used_blocks) {
+	unordered_set<block_id_t> discarded;
+	for (auto &entry : prepared_checkpoint_data) {
+		discarded.insert(entry.second.blocks.begin(), entry.second.blocks.end());
+	}
+	prepared_checkpoint_data.clear();
+	for (auto block_id : discarded) {
+		if (used_blocks && used_blocks->count(block_id)) {
+			// partial blocks can be shared between row groups: this one is still referenced by pre-written data
+			// the checkpoint uses
+			continue;
+		}
+		block_manager.MarkBlockAsFree(block_id);
+	}
+}
+
+//! State shared between the threads that write the modified row groups of a table to disk
+class RowGroupWriteState {
+public:
+	RowGroupWriteState(BlockManager &block_manager, vector<RowGroup *> &row_groups,
+	                   vector<CompressionType> compression_types)
+	    : block_manager(block_manager), row_groups(row_groups), compression_types(std::move(compression_types)),
+	      write_data(row_groups.size()), next_index(0), active_workers(0), keep_running(true), has_error(false) {
+	}
+
+	BlockManager &block_manager;
+	//! The row groups of the table, in order
+	vector<RowGroup *> &row_groups;
+	//! The compression type to use for each column of the table
+	vector<CompressionType> compression_types;
+	//! The write result per row group; left empty for row groups that are already persistent
+	vector<RowGroupWriteData> write_data;
+	//! The next row group to be handed to a writing thread
+	atomic<idx_t> next_index;
+	//! The number of threads that are currently writing row groups
+	atomic<idx_t> active_workers;
+	//! Marker passed to ExecuteTasks when the checkpointing thread helps out, never set to false
+	atomic<bool> keep_running;
+	//! Lock protecting the error state
+	mutex error_lock;
+	//! The first error raised by a writing thread
+	PreservedError error;
+	atomic<bool> has_error;
+
+public:
+	//! Write row groups to disk until none are left, then flush the partial blocks of this thread
+	void WriteRowGroups() {
+		++active_workers;
+		// each thread writes into its own partial block manager so no locking is required while compressing
+		// the block managers all allocate from the same block manager, which hands out disjoint blocks
+		PartialBlockManager partial_block_manager(block_manager);
+		while (true) {
+			idx_t index = next_index++;
+			if (index >= row_groups.size()) {
+				break;
+			}
+			auto &row_group = *row_groups[index];
+			if (HasError()) {
+				// after an error we still drain the row groups, but stop writing them
+				continue;
+			}
+			try {
+				if (!row_group.IsPersistent() && write_data[index].states.empty()) {
+					write_data[index] = row_group.WriteToDisk(partial_block_manager, compression_types);
+				}
+			} catch (Exception &ex) {
+				SetError(PreservedError(ex));
+			} catch (std::exception &ex) {
+				SetError(PreservedError(ex));
+			} catch (...) { // LCOV_EXCL_START
+				SetError(PreservedError("Unknown error while checkpointing row group"));
+			} // LCOV_EXCL_STOP
+		}
+		if (HasError()) {
+			partial_block_manager.Clear();
+		} else {
+			partial_block_manager.FlushPartialBlocks();
+		}
+		--active_workers;
+	}
+
+	//! Wait until all writing threads have finished, helping out with task execution
+	void Drain(TaskScheduler &scheduler) {
+		while (next_index < row_groups.size() || active_workers != 0) {
+			if (scheduler.ExecuteTasks(&keep_running, 1) == 0) {
+				// no more tasks available, but a worker thread is still writing a row group
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	bool HasError() {
+		return has_error;
+	}
+
+	void ThrowIfError() {
+		lock_guard<mutex> guard(error_lock);
+		if (error) {
+			error.Throw();
+		}
+	}
+
+	void SetError(PreservedError error_p) {
+		lock_guard<mutex> guard(error_lock);
+		if (!error) {
+			error = std::move(error_p);
+			has_error = true;
+		}
+	}
+};
+
+//! Task that writes modified row groups to disk on a worker thread
+class RowGroupWriteTask : public Task {
+public:
+	explicit RowGroupWriteTask(shared_ptr<RowGroupWriteState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		state->WriteRowGroups();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<RowGroupWriteState> state;
+};
+
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats) {
+	EnsureLoaded();
+	// checkpointing requires exclusive access to the database: block out the background compaction task and free any
+	// row groups it retired, as no scans can reference them anymore
+	lock_guard<mutex> compaction_guard(compaction_lock);
+	retired_row_groups.clear();
+	// collect the row groups of the table and match them against the data pre-written by PrepareCheckpoint
+	// pre-written data is only used if the row group did not change since it was written: updates are merged into the
+	// column data when it is written and hence invalidate it, while deletes are serialized separately and do not
+	vector<RowGroup *> groups;
+	vector<RowGroupWriteData> write_data;
+	unordered_set<block_id_t> used_blocks;
+	idx_t dirty_count = 0;
 	for (auto row_group = (RowGroup *)row_groups->GetRootSegment(); row_group;
 	     row_group = (RowGroup *)row_group->Next()) {
+		RowGroupWriteData prepared;
+		auto entry = prepared_checkpoint_data.find(row_group);
+		if (entry != prepared_checkpoint_data.end() && entry->second.count == row_group->count &&
+		    !row_group->HasUpdates()) {
+			prepared = std::move(entry->second.data);
+			used_blocks.insert(entry->second.blocks.begin(), entry->second.blocks.end());
+		}
+		if (!row_group->IsPersistent() && prepared.states.empty()) {
+			dirty_count++;
+		}
+		groups.push_back(row_group);
+		write_data.push_back(std::move(prepared));
+	}
+	// the blocks of pre-written row groups that did change in the meantime are not referenced by the checkpoint:
+	// return them to the free list of the block manager so the next checkpoint can reuse the space
+	DiscardPreparedCheckpointData(&used_blocks);
+
+	// first write the modified row groups to disk, in parallel if there are multiple threads
+	// the metadata is written sequentially afterwards so the row group order on disk is deterministic
+	auto &scheduler = TaskScheduler::GetScheduler(info->db.GetDatabase());
+	idx_t num_workers = MinValue<idx_t>(scheduler.NumberOfThreads(), dirty_count);
+	shared_ptr<RowGroupWriteState> state;
+	if (num_workers > 1) {
+		vector<CompressionType> compression_types;
+		compression_types.reserve(types.size());
+		for (idx_t column_idx = 0; column_idx < types.size(); column_idx++) {
+			compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+		}
+		state = make_shared<RowGroupWriteState>(block_manager, groups, std::move(compression_types));
+		// hand the pre-written data to the workers so they skip the row groups that are already on disk
+		state->write_data = std::move(write_data);
+
+		auto token = scheduler.CreateProducer();
+		for (idx_t worker_idx = 0; worker_idx < num_workers - 1; worker_idx++) {
+			scheduler.ScheduleTask(*token, make_unique<RowGroupWriteTask>(state));
+		}
+		// the checkpointing thread writes row groups as well
+		state->WriteRowGroups();
+		state->Drain(scheduler);
+		state->ThrowIfError();
+		write_data = std::move(state->write_data);
+	}
+
+	// now write the metadata of the row groups, in order
+	// row groups that were written in parallel or pre-written only need their pointers serialized here
+	// persistent row groups that were not modified are serialized by referencing their existing data
+	for (idx_t index = 0; index < groups.size(); index++) {
+		auto row_group = groups[index];
 		auto rowg_writer = writer.GetRowGroupWriter(*row_group);
-		auto pointer = row_group->Checkpoint(*rowg_writer, global_stats);
+		RowGroupPointer pointer;
+		if (!write_data[index].states.empty()) {
+			pointer = row_group->Checkpoint(*rowg_writer, std::move(write_data[index]), global_stats);
+		} else {
+			pointer = row_group->Checkpoint(*rowg_writer, global_stats);
+		}
 		writer.AddRowGroup(std::move(pointer), std::move(rowg_writer));
 	}
 }
@@ -532,25 +1230,36 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, vector<unique_ptr<B
 // CommitDrop
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::CommitDropColumn(idx_t index) {
+	EnsureLoaded();
+	lock_guard<mutex> compaction_guard(compaction_lock);
 	auto segment = (RowGroup *)row_groups->GetRootSegment();
 	while (segment) {
 		segment->CommitDropColumn(index);
 		segment = (RowGroup *)segment->Next();
 	}
+	for (auto &retired : retired_row_groups) {
+		((RowGroup &)*retired.node).CommitDropColumn(index);
+	}
 }
 
 void RowGroupCollection::CommitDropTable() {
+	EnsureLoaded();
+	lock_guard<mutex> compaction_guard(compaction_lock);
 	auto segment = (RowGroup *)row_groups->GetRootSegment();
 	while (segment) {
 		segment->CommitDrop();
 		segment = (RowGroup *)segment->Next();
 	}
+	for (auto &retired : retired_row_groups) {
+		((RowGroup &)*retired.node).CommitDrop();
+	}
 }
 
 //===--------------------------------------------------------------------===//
 // GetStorageInfo
 //===--------------------------------------------------------------------===//
 vector<vector<Value>> RowGroupCollection::GetStorageInfo() {
+	EnsureLoaded();
 	vector<vector<Value>> result;
 
 	auto row_group = (RowGroup *)row_groups->GetRootSegment();
@@ -570,6 +1279,7 @@ vector<vector<Value>> RowGroupCollection::GetStorageInfo() {
 //===--------------------------------------------------------------------===//
 shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &context, ColumnDefinition &new_column,
                                                              Expression *default_value) {
+	EnsureLoaded();
 	idx_t new_column_idx = types.size();
 	auto new_types = types;
 	new_types.push_back(new_column.GetType());
@@ -603,6 +1313,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 }
 
 shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
+	EnsureLoaded();
 	D_ASSERT(col_idx < types.size());
 	auto new_types = types;
 	new_types.erase(new_types.begin() + col_idx);
@@ -623,6 +1334,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &context, idx_t changed_idx,
                                                              const LogicalType &target_type,
                                                              vector<column_t> bound_columns, Expression &cast_expr) {
+	EnsureLoaded();
 	D_ASSERT(changed_idx < types.size());
 	auto new_types = types;
 	new_types[changed_idx] = target_type;
@@ -664,6 +1376,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 }
 
 void RowGroupCollection::VerifyNewConstraint(DataTable &parent, const BoundConstraint &constraint) {
+	EnsureLoaded();
 	if (total_rows == 0) {
 		return;
 	}
@@ -701,10 +1414,17 @@ void RowGroupCollection::VerifyNewConstraint(DataTable &parent, const BoundConst
 // Statistics
 //===--------------------------------------------------------------------===//
 unique_ptr<BaseStatistics> RowGroupCollection::CopyStats(column_t column_id) {
+	EnsureLoaded();
 	return stats.CopyStats(column_id);
 }
 
+bool RowGroupCollection::IsColumnSorted(column_t column_id, OrderType order_type) {
+	EnsureLoaded();
+	return stats.IsColumnSorted(column_id, order_type);
+}
+
 void RowGroupCollection::SetStatistics(column_t column_id, const std::function<void(BaseStatistics &)> &set_fun) {
+	EnsureLoaded();
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	auto stats_guard = stats.GetLock();
 	set_fun(*stats.GetStats(column_id).stats);
@@ -5,9 +5,11 @@
 
 namespace duckdb {
 
-void TableScanState::Initialize(vector<column_t> column_ids, TableFilterSet *table_filters) {
+void TableScanState::Initialize(vector<column_t> column_ids, TableFilterSet *table_filters,
+                                unordered_map<column_t, vector<bool>> projected_struct_fields) {
 	this->column_ids = std::move(column_ids);
 	this->table_filters = table_filters;
+	this->projected_struct_fields = std::move(projected_struct_fields);
 	if (table_filters) {
 		D_ASSERT(table_filters->filters.size() > 0);
 		this->adaptive_filter = make_unique<AdaptiveFilter>(table_filters);
@@ -28,6 +30,10 @@ AdaptiveFilter *TableScanState::GetAdaptiveFilter() {
 	return adaptive_filter.get();
 }
 
+const unordered_map<column_t, vector<bool>> &TableScanState::GetProjectedStructFields() {
+	return projected_struct_fields;
+}
+
 void ColumnScanState::NextInternal(idx_t count) {
 	if (!current) {
 		//! There is no column segment
@@ -68,6 +74,10 @@ AdaptiveFilter *RowGroupScanState::GetAdaptiveFilter() {
 	return parent.GetAdaptiveFilter();
 }
 
+const unordered_map<column_t, vector<bool>> &RowGroupScanState::GetProjectedStructFields() {
+	return parent.GetProjectedStructFields();
+}
+
 idx_t RowGroupScanState::GetParentMaxRow() {
 	return parent.max_row;
 }
@@ -84,6 +94,10 @@ AdaptiveFilter *CollectionScanState::GetAdaptiveFilter() {
 	return parent.GetAdaptiveFilter();
 }
 
+const unordered_map<column_t, vector<bool>> &CollectionScanState::GetProjectedStructFields() {
+	return parent.GetProjectedStructFields();
+}
+
 bool CollectionScanState::Scan(Transaction &transaction, DataChunk &result) {
 	auto current_row_group = row_group_state.row_group;
 	while (current_row_group) {
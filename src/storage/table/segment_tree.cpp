@@ -158,6 +158,34 @@ void SegmentTree::Replace(SegmentTree &other) {
 	Replace(l, other);
 }
 
+vector<SegmentNode> SegmentTree::ReplaceSegments(SegmentLock &, idx_t segment_index, idx_t count,
+                                                 unique_ptr<SegmentBase> replacement) {
+	D_ASSERT(count > 0);
+	D_ASSERT(segment_index + count <= nodes.size());
+	// the replacement must cover exactly the row range of the replaced segments
+	D_ASSERT(replacement->start == nodes[segment_index].node->start);
+	D_ASSERT(replacement->start + replacement->count ==
+	         nodes[segment_index + count - 1].node->start + nodes[segment_index + count - 1].node->count);
+	// link the replacement into the segment chain; the chain of the replaced segments is left intact, so scans that
+	// are positioned within it continue into the successor of the replaced range
+	replacement->next =
+	    segment_index + count < nodes.size() ? nodes[segment_index + count].node.get() : (SegmentBase *)nullptr;
+	if (segment_index > 0) {
+		nodes[segment_index - 1].node->next = replacement.get();
+	}
+	// take ownership of the replaced nodes and insert the replacement in their place
+	vector<SegmentNode> replaced;
+	for (idx_t i = 0; i < count; i++) {
+		replaced.push_back(std::move(nodes[segment_index + i]));
+	}
+	nodes.erase(nodes.begin() + segment_index + 1, nodes.begin() + segment_index + count);
+	SegmentNode node;
+	node.row_start = replacement->start;
+	node.node = std::move(replacement);
+	nodes[segment_index] = std::move(node);
+	return replaced;
+}
+
 void SegmentTree::Verify(SegmentLock &) {
 #ifdef DEBUG
 	idx_t base_start = nodes.empty() ? 0 : nodes[0].node->start;
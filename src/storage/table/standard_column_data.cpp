@@ -142,6 +142,11 @@ unique_ptr<BaseStatistics> StandardColumnData::GetUpdateStatistics() {
 	return stats;
 }
 
+void StandardColumnData::PrefetchRow(row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks) {
+	ColumnData::PrefetchRow(row_id, prefetch_blocks);
+	validity.PrefetchRow(row_id, prefetch_blocks);
+}
+
 void StandardColumnData::FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
                                   idx_t result_idx) {
 	// find the segment the row belongs to
@@ -207,6 +212,19 @@ void StandardColumnData::CheckpointScan(ColumnSegment *segment, ColumnScanState
 	validity.ScanCommittedRange(row_group_start, offset_in_row_group, count, scan_vector);
 }
 
+bool StandardColumnData::IsPersistent() {
+	return ColumnData::IsPersistent() && validity.IsPersistent();
+}
+
+bool StandardColumnData::HasUpdates() {
+	return ColumnData::HasUpdates() || validity.HasUpdates();
+}
+
+void StandardColumnData::SerializeColumn(RowGroupWriter &writer) {
+	ColumnData::SerializeColumn(writer);
+	validity.SerializeColumn(writer);
+}
+
 void StandardColumnData::DeserializeColumn(Deserializer &source) {
 	ColumnData::DeserializeColumn(source);
 	validity.DeserializeColumn(source);
@@ -75,10 +75,28 @@ void StructColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t ro
 	}
 }
 
+//! Whether a child column is pruned from the scan: pruned children emit constant NULL instead of being scanned
+static bool ChildColumnPruned(ColumnScanState &state, idx_t child_idx, idx_t child_count, Vector &child_entry) {
+	if (state.scan_child_columns.empty()) {
+		return false;
+	}
+	D_ASSERT(state.scan_child_columns.size() == child_count);
+	if (state.scan_child_columns[child_idx]) {
+		return false;
+	}
+	child_entry.SetVectorType(VectorType::CONSTANT_VECTOR);
+	ConstantVector::SetNull(child_entry, true);
+	return true;
+}
+
 idx_t StructColumnData::Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
 	auto scan_count = validity.Scan(transaction, vector_index, state.child_states[0], result);
 	auto &child_entries = StructVector::GetEntries(result);
 	for (idx_t i = 0; i < sub_columns.size(); i++) {
+		if (ChildColumnPruned(state, i, sub_columns.size(), *child_entries[i])) {
+			sub_columns[i]->Skip(state.child_states[i + 1], scan_count);
+			continue;
+		}
 		sub_columns[i]->Scan(transaction, vector_index, state.child_states[i + 1], *child_entries[i]);
 	}
 	return scan_count;
@@ -88,6 +106,10 @@ idx_t StructColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &state
 	auto scan_count = validity.ScanCommitted(vector_index, state.child_states[0], result, allow_updates);
 	auto &child_entries = StructVector::GetEntries(result);
 	for (idx_t i = 0; i < sub_columns.size(); i++) {
+		if (ChildColumnPruned(state, i, sub_columns.size(), *child_entries[i])) {
+			sub_columns[i]->Skip(state.child_states[i + 1], scan_count);
+			continue;
+		}
 		sub_columns[i]->ScanCommitted(vector_index, state.child_states[i + 1], *child_entries[i], allow_updates);
 	}
 	return scan_count;
@@ -97,6 +119,10 @@ idx_t StructColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t
 	auto scan_count = validity.ScanCount(state.child_states[0], result, count);
 	auto &child_entries = StructVector::GetEntries(result);
 	for (idx_t i = 0; i < sub_columns.size(); i++) {
+		if (ChildColumnPruned(state, i, sub_columns.size(), *child_entries[i])) {
+			sub_columns[i]->Skip(state.child_states[i + 1], scan_count);
+			continue;
+		}
 		sub_columns[i]->ScanCount(state.child_states[i + 1], *child_entries[i], count);
 	}
 	return scan_count;
@@ -202,6 +228,13 @@ unique_ptr<BaseStatistics> StructColumnData::GetUpdateStatistics() {
 	return stats;
 }
 
+void StructColumnData::PrefetchRow(row_t row_id, vector<shared_ptr<BlockHandle>> &prefetch_blocks) {
+	validity.PrefetchRow(row_id, prefetch_blocks);
+	for (auto &sub_column : sub_columns) {
+		sub_column->PrefetchRow(row_id, prefetch_blocks);
+	}
+}
+
 void StructColumnData::FetchRow(TransactionData transaction, ColumnFetchState &state, row_t row_id, Vector &result,
                                 idx_t result_idx) {
 	// fetch validity mask
@@ -279,6 +312,37 @@ unique_ptr<ColumnCheckpointState> StructColumnData::Checkpoint(RowGroup &row_gro
 	return std::move(checkpoint_state);
 }
 
+bool StructColumnData::IsPersistent() {
+	if (!validity.IsPersistent()) {
+		return false;
+	}
+	for (auto &sub_column : sub_columns) {
+		if (!sub_column->IsPersistent()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool StructColumnData::HasUpdates() {
+	if (validity.HasUpdates()) {
+		return true;
+	}
+	for (auto &sub_column : sub_columns) {
+		if (sub_column->HasUpdates()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void StructColumnData::SerializeColumn(RowGroupWriter &writer) {
+	validity.SerializeColumn(writer);
+	for (auto &sub_column : sub_columns) {
+		sub_column->SerializeColumn(writer);
+	}
+}
+
 void StructColumnData::DeserializeColumn(Deserializer &source) {
 	validity.DeserializeColumn(source);
 	for (auto &sub_column : sub_columns) {
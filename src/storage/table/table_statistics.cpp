@@ -19,7 +19,13 @@ void TableStatistics::InitializeEmpty(const vector<LogicalType> &types) {
 	D_ASSERT(Empty());
 
 	for (auto &type : types) {
-		column_stats.push_back(ColumnStatistics::CreateEmptyStats(type));
+		auto stats = ColumnStatistics::CreateEmptyStats(type);
+		auto physical_type = type.InternalType();
+		if (physical_type != PhysicalType::LIST && physical_type != PhysicalType::STRUCT) {
+			// the collection starts out empty, so we can observe every appended value and track sortedness
+			stats->InitializeSortednessTracking();
+		}
+		column_stats.push_back(std::move(stats));
 	}
 }
 
@@ -70,6 +76,7 @@ void TableStatistics::MergeStats(TableStatistics &other) {
 	auto l = GetLock();
 	D_ASSERT(column_stats.size() == other.column_stats.size());
 	for (idx_t i = 0; i < column_stats.size(); i++) {
+		column_stats[i]->MergeSortedness(*other.column_stats[i]);
 		column_stats[i]->stats->Merge(*other.column_stats[i]->stats);
 	}
 }
@@ -83,6 +90,11 @@ void TableStatistics::MergeStats(TableStatisticsLock &lock, idx_t i, BaseStatist
 	column_stats[i]->stats->Merge(stats);
 }
 
+bool TableStatistics::IsColumnSorted(idx_t i, OrderType order_type) {
+	lock_guard<mutex> l(stats_lock);
+	return column_stats[i]->IsSorted(order_type);
+}
+
 ColumnStatistics &TableStatistics::GetStats(idx_t i) {
 	return *column_stats[i];
 }
@@ -1047,6 +1047,22 @@ static idx_t SortSelectionVector(SelectionVector &sel, idx_t count, row_t *ids)
 	return pos;
 }
 
+//! Grow the tuple arrays of a base update info to the new capacity, preserving the current contents
+static void GrowUpdateInfo(UpdateNodeData &node_data, idx_t type_size, idx_t new_capacity) {
+	D_ASSERT(new_capacity <= STANDARD_VECTOR_SIZE);
+	auto &info = *node_data.info;
+	D_ASSERT(new_capacity > info.max);
+	auto new_tuples = unique_ptr<sel_t[]>(new sel_t[new_capacity]);
+	auto new_tuple_data = unique_ptr<data_t[]>(new data_t[new_capacity * type_size]);
+	memcpy(new_tuples.get(), info.tuples, sizeof(sel_t) * info.N);
+	memcpy(new_tuple_data.get(), info.tuple_data, type_size * info.N);
+	node_data.tuples = std::move(new_tuples);
+	node_data.tuple_data = std::move(new_tuple_data);
+	info.tuples = node_data.tuples.get();
+	info.tuple_data = node_data.tuple_data.get();
+	info.max = new_capacity;
+}
+
 UpdateInfo *CreateEmptyUpdateInfo(TransactionData transaction, idx_t type_size, idx_t count, unique_ptr<char[]> &data) {
 	data = unique_ptr<char[]>(new char[sizeof(UpdateInfo) + (sizeof(sel_t) + type_size) * STANDARD_VECTOR_SIZE]);
 	auto update_info = (UpdateInfo *)data.get();
@@ -1139,6 +1155,12 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 		node->Verify();
 
 		// now we are going to perform the merge
+		// the merged result can touch at most N + count tuples: grow the base arrays if they cannot hold that
+		idx_t merge_count = idx_t(base_info->N) + count;
+		if (merge_count > base_info->max) {
+			GrowUpdateInfo(*root->info[vector_index], type_size,
+			               MinValue<idx_t>(STANDARD_VECTOR_SIZE, NextPowerOfTwo(merge_count)));
+		}
 		merge_update_function(base_info, base_data, node, update, ids, count, sel);
 
 		base_info->Verify();
@@ -1148,10 +1170,14 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 		auto result = make_unique<UpdateNodeData>();
 
 		result->info = make_unique<UpdateInfo>();
-		result->tuples = unique_ptr<sel_t[]>(new sel_t[STANDARD_VECTOR_SIZE]);
-		result->tuple_data = unique_ptr<data_t[]>(new data_t[STANDARD_VECTOR_SIZE * type_size]);
+		// right-size the allocation to the number of updated tuples instead of always allocating for a full vector;
+		// the arrays are grown if later updates touch more tuples of this vector
+		idx_t capacity = MinValue<idx_t>(STANDARD_VECTOR_SIZE, NextPowerOfTwo(count));
+		result->tuples = unique_ptr<sel_t[]>(new sel_t[capacity]);
+		result->tuple_data = unique_ptr<data_t[]>(new data_t[capacity * type_size]);
 		result->info->tuples = result->tuples.get();
 		result->info->tuple_data = result->tuple_data.get();
+		result->info->max = capacity;
 		result->info->version_number = TRANSACTION_ID_START - 1;
 		result->info->column_index = column_index;
 		InitializeUpdateInfo(*result->info, ids, sel, count, vector_index, vector_offset);
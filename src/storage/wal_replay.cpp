@@ -2,12 +2,18 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/preserved_error.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/common/serializer/buffered_deserializer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -18,9 +24,239 @@
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "miniz_wrapper.hpp"
+
+#include <thread>
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// Parallel Replay
+//===--------------------------------------------------------------------===//
+// Insert entries are partitioned by their target table and applied by tasks on the TaskScheduler, so that
+// recovery of independent tables scales with the core count. The dispatching thread deserializes the WAL
+// strictly sequentially; entries of the same table are applied in WAL order by a single task at a time.
+// Catalog entries and commits act as barriers that wait for all outstanding data entries. Deletes and updates
+// also act as barriers: they generate undo entries in the replay transaction's unsynchronized undo buffer, so
+// they are always applied by the dispatching thread itself after all queued inserts have finished.
+
+//! A single deserialized data entry of the WAL
+struct WALReplayEntry {
+	//! The type of the entry (insert/delete/update)
+	WALType type;
+	//! The deserialized data of the entry
+	DataChunk chunk;
+	//! The column path (only set for updates)
+	vector<column_t> column_path;
+};
+
+//! The pending data entries of a single table
+struct WALReplayTableQueue {
+	explicit WALReplayTableQueue(TableCatalogEntry &table) : table(table), scheduled(false) {
+	}
+
+	//! The table the entries belong to
+	TableCatalogEntry &table;
+	//! Lock protecting the entry queue
+	mutex lock;
+	//! The pending entries, in WAL order
+	deque<unique_ptr<WALReplayEntry>> entries;
+	//! Whether a task is currently scheduled (or running) for this queue
+	bool scheduled;
+};
+
+class WALReplayDispatcher {
+public:
+	//! Maximum number of dispatched entries that can be pending before the dispatching thread starts
+	//! applying entries itself, bounding the memory held by deserialized chunks
+	static constexpr idx_t MAXIMUM_OUTSTANDING_ENTRIES = 1024;
+
+	WALReplayDispatcher(ClientContext &context, TaskScheduler &scheduler)
+	    : context(context), scheduler(scheduler), token(scheduler.CreateProducer()), outstanding(0), keep_running(true),
+	      has_error(false) {
+	}
+
+	//! Whether data entries of the given table can be applied in parallel with other tables
+	bool CanParallelReplay(TableCatalogEntry &table);
+	//! Hand a data entry to the replay task of its table
+	void Dispatch(TableCatalogEntry &table, unique_ptr<WALReplayEntry> entry);
+	//! Wait until all dispatched entries have been applied, helping out with task execution
+	void Drain();
+	//! Whether an error occurred while applying a dispatched entry
+	bool HasError() {
+		return has_error;
+	}
+	//! Re-throw the first error raised by a replay task (if any)
+	void ThrowIfError();
+	void SetError(PreservedError error_p);
+	void FinishEntry() {
+		--outstanding;
+	}
+	//! Apply a single data entry to the given table
+	static void Apply(ClientContext &context, TableCatalogEntry &table, WALReplayEntry &entry);
+
+	ClientContext &context;
+	TaskScheduler &scheduler;
+	//! Producer token under which the replay tasks are scheduled
+	unique_ptr<ProducerToken> token;
+	//! Lock protecting the queue map
+	mutex lock;
+	//! The pending entries per table
+	unordered_map<TableCatalogEntry *, unique_ptr<WALReplayTableQueue>> queues;
+	//! The number of dispatched entries that have not been applied yet
+	atomic<idx_t> outstanding;
+	//! Marker passed to ExecuteTasks when the dispatching thread helps out, never set to false
+	atomic<bool> keep_running;
+	//! Lock protecting the error state
+	mutex error_lock;
+	//! The first error raised by a replay task
+	PreservedError error;
+	atomic<bool> has_error;
+};
+
+//! Task that applies the pending entries of a single table, in order
+class WALReplayTableTask : public Task {
+public:
+	WALReplayTableTask(WALReplayDispatcher &dispatcher, WALReplayTableQueue &queue)
+	    : dispatcher(dispatcher), queue(queue) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		while (true) {
+			unique_ptr<WALReplayEntry> entry;
+			{
+				lock_guard<mutex> guard(queue.lock);
+				if (queue.entries.empty()) {
+					// no more pending entries: a new task is scheduled if more entries arrive
+					queue.scheduled = false;
+					return TaskExecutionResult::TASK_FINISHED;
+				}
+				entry = std::move(queue.entries.front());
+				queue.entries.pop_front();
+			}
+			if (!dispatcher.HasError()) {
+				// after an error we still drain the queue, but stop applying entries
+				try {
+					WALReplayDispatcher::Apply(dispatcher.context, queue.table, *entry);
+				} catch (Exception &ex) {
+					dispatcher.SetError(PreservedError(ex));
+				} catch (std::exception &ex) {
+					dispatcher.SetError(PreservedError(ex));
+				} catch (...) { // LCOV_EXCL_START
+					dispatcher.SetError(PreservedError("Unknown error during WAL replay"));
+				} // LCOV_EXCL_STOP
+			}
+			dispatcher.FinishEntry();
+		}
+	}
+
+private:
+	WALReplayDispatcher &dispatcher;
+	WALReplayTableQueue &queue;
+};
+
+bool WALReplayDispatcher::CanParallelReplay(TableCatalogEntry &table) {
+	if (scheduler.NumberOfThreads() <= 1) {
+		return false;
+	}
+	// tables involved in foreign key constraints depend on the data of other tables:
+	// their entries are applied in WAL order by the dispatching thread itself
+	for (auto &constraint : table.bound_constraints) {
+		if (constraint->type == ConstraintType::FOREIGN_KEY) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void WALReplayDispatcher::Dispatch(TableCatalogEntry &table, unique_ptr<WALReplayEntry> entry) {
+	WALReplayTableQueue *queue;
+	{
+		lock_guard<mutex> guard(lock);
+		auto queue_entry = queues.find(&table);
+		if (queue_entry == queues.end()) {
+			auto new_queue = make_unique<WALReplayTableQueue>(table);
+			queue = new_queue.get();
+			queues[&table] = std::move(new_queue);
+		} else {
+			queue = queue_entry->second.get();
+		}
+	}
+	++outstanding;
+	bool schedule_task;
+	{
+		lock_guard<mutex> guard(queue->lock);
+		queue->entries.push_back(std::move(entry));
+		schedule_task = !queue->scheduled;
+		queue->scheduled = true;
+	}
+	if (schedule_task) {
+		scheduler.ScheduleTask(*token, make_unique<WALReplayTableTask>(*this, *queue));
+	}
+	// backpressure: help apply entries while too many are pending
+	while (outstanding >= MAXIMUM_OUTSTANDING_ENTRIES) {
+		if (scheduler.ExecuteTasks(&keep_running, 1) == 0) {
+			std::this_thread::yield();
+		}
+	}
+}
+
+void WALReplayDispatcher::Drain() {
+	while (outstanding != 0) {
+		if (scheduler.ExecuteTasks(&keep_running, 1) == 0) {
+			// no more tasks available, but a worker thread is still applying an entry
+			std::this_thread::yield();
+		}
+	}
+}
+
+void WALReplayDispatcher::ThrowIfError() {
+	lock_guard<mutex> guard(error_lock);
+	if (error) {
+		error.Throw();
+	}
+}
+
+void WALReplayDispatcher::SetError(PreservedError error_p) {
+	lock_guard<mutex> guard(error_lock);
+	if (!error) {
+		error = std::move(error_p);
+		has_error = true;
+	}
+}
+
+void WALReplayDispatcher::Apply(ClientContext &context, TableCatalogEntry &table, WALReplayEntry &entry) {
+	switch (entry.type) {
+	case WALType::INSERT_TUPLE:
+		// append to the table
+		table.storage->LocalAppend(table, context, entry.chunk);
+		break;
+	case WALType::DELETE_TUPLE: {
+		row_t row_ids[1];
+		Vector row_identifiers(LogicalType::ROW_TYPE, (data_ptr_t)row_ids);
+
+		auto source_ids = FlatVector::GetData<row_t>(entry.chunk.data[0]);
+		// delete the tuples from the table
+		for (idx_t i = 0; i < entry.chunk.size(); i++) {
+			row_ids[0] = source_ids[i];
+			table.storage->Delete(table, context, row_identifiers, 1);
+		}
+		break;
+	}
+	case WALType::UPDATE_TUPLE: {
+		// remove the row id vector from the chunk
+		auto row_ids = std::move(entry.chunk.data.back());
+		entry.chunk.data.pop_back();
+
+		// now perform the update
+		table.storage->UpdateColumn(table, context, row_ids, entry.column_path, entry.chunk);
+		break;
+	}
+	default:
+		throw InternalException("Invalid WAL entry type for table replay!");
+	}
+}
+
 bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 	auto initial_reader = make_unique<BufferedFileReader>(FileSystem::Get(database), path.c_str());
 	if (initial_reader->Finished()) {
@@ -71,6 +307,15 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 	BufferedFileReader reader(FileSystem::Get(database), path.c_str());
 	ReplayState state(database, *con.context, reader);
 
+	// launch the scheduler's worker threads for the duration of the replay, so that data entries of independent
+	// tables can be applied in parallel; during startup the scheduler does not have any threads yet
+	auto &scheduler = TaskScheduler::GetScheduler(database.GetDatabase());
+	auto &config = DBConfig::GetConfig(database.GetDatabase());
+	auto original_thread_count = scheduler.NumberOfThreads();
+	scheduler.SetThreads(config.options.maximum_threads);
+	WALReplayDispatcher dispatcher(*con.context, scheduler);
+	state.dispatcher = &dispatcher;
+
 	// replay the WAL
 	// note that everything is wrapped inside a try/catch block here
 	// there can be errors in WAL replay because of a corrupt WAL file
@@ -80,7 +325,10 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 			// read the current entry
 			WALType entry_type = reader.Read<WALType>();
 			if (entry_type == WALType::WAL_FLUSH) {
-				// flush: commit the current transaction
+				// flush: all outstanding data entries must be applied before we can commit
+				dispatcher.Drain();
+				dispatcher.ThrowIfError();
+				// commit the current transaction
 				con.Commit();
 				// check if the file is exhausted
 				if (reader.Finished()) {
@@ -97,13 +345,20 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 	} catch (std::exception &ex) { // LCOV_EXCL_START
 		// FIXME: this should report a proper warning in the connection
 		Printer::Print(StringUtil::Format("Exception in WAL playback: %s\n", ex.what()));
+		// wait for any outstanding data entries before rolling back
+		dispatcher.Drain();
 		// exception thrown in WAL replay: rollback
 		con.Rollback();
 	} catch (...) {
 		Printer::Print("Unknown Exception in WAL playback: %s\n");
+		// wait for any outstanding data entries before rolling back
+		dispatcher.Drain();
 		// exception thrown in WAL replay: rollback
 		con.Rollback();
 	} // LCOV_EXCL_STOP
+	// restore the original thread count of the scheduler
+	state.dispatcher = nullptr;
+	scheduler.SetThreads(original_thread_count);
 	return false;
 }
 
@@ -111,6 +366,20 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, string &path) {
 // Replay Entries
 //===--------------------------------------------------------------------===//
 void ReplayState::ReplayEntry(WALType entry_type) {
+	switch (entry_type) {
+	case WALType::USE_TABLE:
+	case WALType::INSERT_TUPLE:
+	case WALType::DELETE_TUPLE:
+	case WALType::UPDATE_TUPLE:
+		break;
+	default:
+		// catalog entries act as a barrier: all outstanding data entries must be applied first
+		if (dispatcher) {
+			dispatcher->Drain();
+			dispatcher->ThrowIfError();
+		}
+		break;
+	}
 	switch (entry_type) {
 	case WALType::CREATE_TABLE:
 		ReplayCreateTable();
@@ -391,9 +660,28 @@ void ReplayState::ReplayUseTable() {
 	current_table = catalog.GetEntry<TableCatalogEntry>(context, schema_name, table_name);
 }
 
+void ReplayState::ReadChunk(DataChunk &chunk) {
+	auto compressed_flag = source.Read<uint8_t>();
+	if (!compressed_flag) {
+		chunk.Deserialize(source);
+		return;
+	}
+	auto uncompressed_size = source.Read<uint64_t>();
+	auto compressed_size = source.Read<uint64_t>();
+	auto compressed = unique_ptr<data_t[]>(new data_t[compressed_size]);
+	source.ReadData(compressed.get(), compressed_size);
+	auto uncompressed = unique_ptr<data_t[]>(new data_t[uncompressed_size]);
+	MiniZStream zstream;
+	zstream.Decompress((const char *)compressed.get(), compressed_size, (char *)uncompressed.get(),
+	                   uncompressed_size);
+	BufferedDeserializer deserializer(uncompressed.get(), uncompressed_size);
+	chunk.Deserialize(deserializer);
+}
+
 void ReplayState::ReplayInsert() {
-	DataChunk chunk;
-	chunk.Deserialize(source);
+	auto entry = make_unique<WALReplayEntry>();
+	entry->type = WALType::INSERT_TUPLE;
+	ReadChunk(entry->chunk);
 	if (deserialize_only) {
 		return;
 	}
@@ -401,41 +689,43 @@ void ReplayState::ReplayInsert() {
 		throw Exception("Corrupt WAL: insert without table");
 	}
 
-	// append to the current table
-	current_table->storage->LocalAppend(*current_table, context, chunk);
+	if (dispatcher && dispatcher->CanParallelReplay(*current_table)) {
+		dispatcher->Dispatch(*current_table, std::move(entry));
+		return;
+	}
+	WALReplayDispatcher::Apply(context, *current_table, *entry);
 }
 
 void ReplayState::ReplayDelete() {
-	DataChunk chunk;
-	chunk.Deserialize(source);
+	auto entry = make_unique<WALReplayEntry>();
+	entry->type = WALType::DELETE_TUPLE;
+	ReadChunk(entry->chunk);
 	if (deserialize_only) {
 		return;
 	}
 	if (!current_table) {
 		throw InternalException("Corrupt WAL: delete without table");
 	}
+	D_ASSERT(entry->chunk.ColumnCount() == 1 && entry->chunk.data[0].GetType() == LogicalType::ROW_TYPE);
 
-	D_ASSERT(chunk.ColumnCount() == 1 && chunk.data[0].GetType() == LogicalType::ROW_TYPE);
-	row_t row_ids[1];
-	Vector row_identifiers(LogicalType::ROW_TYPE, (data_ptr_t)row_ids);
-
-	auto source_ids = FlatVector::GetData<row_t>(chunk.data[0]);
-	// delete the tuples from the current table
-	for (idx_t i = 0; i < chunk.size(); i++) {
-		row_ids[0] = source_ids[i];
-		current_table->storage->Delete(*current_table, context, row_identifiers, 1);
+	if (dispatcher) {
+		// deletes write undo entries into the shared replay transaction, which the parallel tasks cannot do safely:
+		// wait for the queued inserts so the WAL order is preserved, then apply the delete on this thread
+		dispatcher->Drain();
+		dispatcher->ThrowIfError();
 	}
+	WALReplayDispatcher::Apply(context, *current_table, *entry);
 }
 
 void ReplayState::ReplayUpdate() {
-	vector<column_t> column_path;
+	auto entry = make_unique<WALReplayEntry>();
+	entry->type = WALType::UPDATE_TUPLE;
 	auto column_index_count = source.Read<idx_t>();
-	column_path.reserve(column_index_count);
+	entry->column_path.reserve(column_index_count);
 	for (idx_t i = 0; i < column_index_count; i++) {
-		column_path.push_back(source.Read<column_t>());
+		entry->column_path.push_back(source.Read<column_t>());
 	}
-	DataChunk chunk;
-	chunk.Deserialize(source);
+	ReadChunk(entry->chunk);
 	if (deserialize_only) {
 		return;
 	}
@@ -443,16 +733,17 @@ void ReplayState::ReplayUpdate() {
 		throw InternalException("Corrupt WAL: update without table");
 	}
 
-	if (column_path[0] >= current_table->columns.PhysicalColumnCount()) {
+	if (entry->column_path[0] >= current_table->columns.PhysicalColumnCount()) {
 		throw InternalException("Corrupt WAL: column index for update out of bounds");
 	}
 
-	// remove the row id vector from the chunk
-	auto row_ids = std::move(chunk.data.back());
-	chunk.data.pop_back();
-
-	// now perform the update
-	current_table->storage->UpdateColumn(*current_table, context, row_ids, column_path, chunk);
+	if (dispatcher) {
+		// updates write undo entries into the shared replay transaction, which the parallel tasks cannot do safely:
+		// wait for the queued inserts so the WAL order is preserved, then apply the update on this thread
+		dispatcher->Drain();
+		dispatcher->ThrowIfError();
+	}
+	WALReplayDispatcher::Apply(context, *current_table, *entry);
 }
 
 void ReplayState::ReplayCheckpoint() {
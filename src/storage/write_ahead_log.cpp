@@ -5,9 +5,15 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
+#include "miniz_wrapper.hpp"
+#include <chrono>
 #include <cstring>
+#include <thread>
 
 namespace duckdb {
 
@@ -218,6 +224,26 @@ void WriteAheadLog::WriteSetTable(string &schema, string &table) {
 	writer->WriteString(table);
 }
 
+void WriteAheadLog::WriteChunk(DataChunk &chunk) {
+	if (!DBConfig::GetConfig(database.GetDatabase()).options.wal_compression) {
+		writer->Write<uint8_t>(0);
+		chunk.Serialize(*writer);
+		return;
+	}
+	// serialize the chunk into memory and write it as a gzip-framed blob
+	BufferedSerializer serializer;
+	chunk.Serialize(serializer);
+	auto &blob = serializer.blob;
+	MiniZStream zstream;
+	auto compressed_size = zstream.MaxCompressedLength(blob.size);
+	auto compressed = unique_ptr<data_t[]>(new data_t[compressed_size]);
+	zstream.Compress((const char *)blob.data.get(), blob.size, (char *)compressed.get(), &compressed_size);
+	writer->Write<uint8_t>(1);
+	writer->Write<uint64_t>(blob.size);
+	writer->Write<uint64_t>(compressed_size);
+	writer->WriteData(compressed.get(), compressed_size);
+}
+
 void WriteAheadLog::WriteInsert(DataChunk &chunk) {
 	if (skip_writing) {
 		return;
@@ -226,7 +252,7 @@ void WriteAheadLog::WriteInsert(DataChunk &chunk) {
 	chunk.Verify();
 
 	writer->Write<WALType>(WALType::INSERT_TUPLE);
-	chunk.Serialize(*writer);
+	WriteChunk(chunk);
 }
 
 void WriteAheadLog::WriteDelete(DataChunk &chunk) {
@@ -238,7 +264,7 @@ void WriteAheadLog::WriteDelete(DataChunk &chunk) {
 	chunk.Verify();
 
 	writer->Write<WALType>(WALType::DELETE_TUPLE);
-	chunk.Serialize(*writer);
+	WriteChunk(chunk);
 }
 
 void WriteAheadLog::WriteUpdate(DataChunk &chunk, const vector<column_t> &column_indexes) {
@@ -255,7 +281,7 @@ void WriteAheadLog::WriteUpdate(DataChunk &chunk, const vector<column_t> &column
 	for (auto &col_idx : column_indexes) {
 		writer->Write<column_t>(col_idx);
 	}
-	chunk.Serialize(*writer);
+	WriteChunk(chunk);
 }
 
 //===--------------------------------------------------------------------===//
@@ -272,14 +298,67 @@ void WriteAheadLog::WriteAlter(AlterInfo &info) {
 //===--------------------------------------------------------------------===//
 // FLUSH
 //===--------------------------------------------------------------------===//
-void WriteAheadLog::Flush() {
+void WriteAheadLog::FlushBuffer() {
 	if (skip_writing) {
 		return;
 	}
 	// write an empty entry
 	writer->Write<WALType>(WALType::WAL_FLUSH);
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// hand the buffered entries to the operating system, so that a (concurrent) Sync covers them
+	// note that appends to the WAL are serialized by the transaction lock - only Sync runs concurrently
+	writer->Flush();
+	flush_target = writer->GetTotalWritten();
+}
+
+void WriteAheadLog::Sync() {
+	idx_t target = flush_target;
+	if (synced_target >= target) {
+		// our entries were already covered by an earlier fsync
+		return;
+	}
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_target < target) {
+		if (sync_in_progress) {
+			// another thread is running an fsync - wait for it to finish
+			// the in-flight fsync might not cover our entries, in which case we loop around
+			sync_cv.wait(guard);
+			continue;
+		}
+		// no fsync in progress - we become the leader of this commit group
+		sync_in_progress = true;
+		guard.unlock();
+		auto delay = DBConfig::GetConfig(database.GetDatabase()).options.wal_group_commit_delay;
+		if (delay != 0) {
+			// give other committers a chance to add their entries to this group
+			std::this_thread::sleep_for(std::chrono::microseconds(delay));
+		}
+		// read the flush target again: it may have advanced while we were waiting
+		idx_t sync_up_to = flush_target;
+		try {
+			// sync directly on the file handle - the buffer of the writer is owned by appending threads
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_cv.notify_all();
+			throw;
+		}
+		guard.lock();
+		sync_in_progress = false;
+		if (sync_up_to > synced_target) {
+			synced_target = sync_up_to;
+		}
+		// wake up any followers - their entries may have been covered by this fsync
+		sync_cv.notify_all();
+	}
+}
+
+void WriteAheadLog::Flush() {
+	if (skip_writing) {
+		return;
+	}
+	FlushBuffer();
+	Sync();
 }
 
 } // namespace duckdb
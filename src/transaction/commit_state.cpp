@@ -251,6 +251,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		}
 		// mark the tuples as committed
 		info->vinfo->CommitDelete(commit_id, info->rows, info->count);
+		info->table->info->last_write_version = commit_id;
 		break;
 	}
 	case UndoFlags::UPDATE_TUPLE: {
@@ -260,6 +261,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 			WriteUpdate(info);
 		}
 		info->version_number = commit_id;
+		info->segment->column_data.GetTableInfo().last_write_version = commit_id;
 		break;
 	}
 	default:
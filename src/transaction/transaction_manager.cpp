@@ -6,15 +6,78 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
+//! State shared between the transaction manager and the background version cleanup task. The task may outlive the
+//! transaction manager (it sits in the scheduler queue), so the state is reference counted and holds a back pointer
+//! that the transaction manager clears on destruction.
+struct VersionCleanupState {
+	//! Lock protecting this state
+	mutex lock;
+	//! Committed transactions whose versions are no longer visible to any transaction, awaiting cleanup
+	vector<unique_ptr<Transaction>> transactions;
+	//! Whether a cleanup task is currently scheduled or running
+	bool task_active = false;
+	//! Whether a cleanup task is currently processing a batch outside of the lock
+	bool task_running = false;
+	//! Signalled when the cleanup task finishes processing a batch
+	std::condition_variable task_done;
+	//! The transaction manager, or nullptr if it has been destroyed
+	TransactionManager *manager = nullptr;
+};
+
+//! Background task that prunes the version chains and dead chunk info entries of committed transactions that no
+//! active transaction can see anymore, keeping this work off the commit path
+class VersionCleanupTask : public Task {
+public:
+	explicit VersionCleanupTask(shared_ptr<VersionCleanupState> state_p) : state(std::move(state_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		do {
+			vector<unique_ptr<Transaction>> batch;
+			TransactionManager *manager;
+			{
+				lock_guard<mutex> guard(state->lock);
+				manager = state->manager;
+				if (!manager || state->transactions.empty()) {
+					state->task_active = false;
+					return TaskExecutionResult::TASK_FINISHED;
+				}
+				batch = std::move(state->transactions);
+				state->transactions = vector<unique_ptr<Transaction>>();
+				// while task_running is set the transaction manager destructor waits for us, so "manager" stays valid
+				state->task_running = true;
+			}
+			for (auto &transaction : batch) {
+				transaction->Cleanup();
+			}
+			// the transactions still await GC: queries started before the cleanup can be using their version info
+			manager->AddOldTransactions(std::move(batch));
+			{
+				lock_guard<mutex> guard(state->lock);
+				state->task_running = false;
+			}
+			state->task_done.notify_all();
+		} while (mode == TaskExecutionMode::PROCESS_ALL);
+		return TaskExecutionResult::TASK_NOT_FINISHED;
+	}
+
+private:
+	shared_ptr<VersionCleanupState> state;
+};
+
 struct CheckpointLock {
 	explicit CheckpointLock(TransactionManager &manager) : manager(manager), is_locked(false) {
 	}
@@ -50,9 +113,70 @@ TransactionManager::TransactionManager(AttachedDatabase &db) : db(db), thread_is
 	current_transaction_id = TRANSACTION_ID_START;
 	lowest_active_id = TRANSACTION_ID_START;
 	lowest_active_start = MAX_TRANSACTION_ID;
+	cleanup_state = make_shared<VersionCleanupState>();
+	cleanup_state->manager = this;
 }
 
 TransactionManager::~TransactionManager() {
+	vector<unique_ptr<Transaction>> remaining;
+	{
+		unique_lock<mutex> guard(cleanup_state->lock);
+		// prevent any further background cleanup and wait for an in-flight cleanup batch to finish
+		cleanup_state->manager = nullptr;
+		while (cleanup_state->task_running) {
+			cleanup_state->task_done.wait(guard);
+		}
+		remaining = std::move(cleanup_state->transactions);
+	}
+	// clean up any transactions the background task did not get to
+	for (auto &transaction : remaining) {
+		transaction->Cleanup();
+	}
+}
+
+void TransactionManager::ScheduleCleanup(unique_ptr<Transaction> transaction) {
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	if (!cleanup_producer) {
+		cleanup_producer = scheduler.CreateProducer();
+		cleanup_producer->priority = TaskPriority::LOW;
+	}
+	bool schedule_task;
+	{
+		lock_guard<mutex> guard(cleanup_state->lock);
+		cleanup_state->transactions.push_back(std::move(transaction));
+		schedule_task = !cleanup_state->task_active;
+		cleanup_state->task_active = true;
+	}
+	if (schedule_task) {
+		scheduler.ScheduleTask(*cleanup_producer, make_unique<VersionCleanupTask>(cleanup_state));
+	}
+}
+
+void TransactionManager::DrainCleanup() {
+	vector<unique_ptr<Transaction>> pending;
+	{
+		unique_lock<mutex> guard(cleanup_state->lock);
+		while (cleanup_state->task_running) {
+			cleanup_state->task_done.wait(guard);
+		}
+		pending = std::move(cleanup_state->transactions);
+		cleanup_state->transactions = vector<unique_ptr<Transaction>>();
+	}
+	for (auto &transaction : pending) {
+		transaction->Cleanup();
+	}
+	// all client locks are held, so no query can still be reading the version info of the drained transactions:
+	// they can be destroyed immediately instead of awaiting GC. The same holds for the transactions the background
+	// task already moved to the GC list, which would otherwise needlessly fail the sole-transaction check.
+	lock_guard<mutex> lock(transaction_lock);
+	old_transactions.clear();
+}
+
+void TransactionManager::AddOldTransactions(vector<unique_ptr<Transaction>> transactions) {
+	lock_guard<mutex> lock(transaction_lock);
+	for (auto &transaction : transactions) {
+		old_transactions.push_back(std::move(transaction));
+	}
 }
 
 Transaction *TransactionManager::StartTransaction(ClientContext &context) {
@@ -117,12 +241,20 @@ void TransactionManager::Checkpoint(ClientContext &context, bool force) {
 	checkpoint_lock.Lock();
 	lock.unlock();
 
+	// pre-write the table data of the checkpoint while other transactions can still run: the exclusive phase below
+	// then only writes the row groups that changed in the meantime, plus the metadata
+	storage_manager.PrepareCheckpoint();
+
 	// lock all the clients AND the connection manager now
 	// this ensures no new queries can be started, and no new connections to the database can be made
 	// to avoid deadlock we release the transaction lock while locking the clients
 	vector<ClientLockWrapper> client_locks;
 	LockClients(client_locks, context);
 
+	// finish any queued or in-flight background version cleanup: the checkpoint frees structures such as the update
+	// segments that a cleanup task may still be traversing
+	DrainCleanup();
+
 	auto current = &Transaction::Get(context, db);
 	lock.lock();
 	if (current->ChangesMade()) {
@@ -155,6 +287,38 @@ void TransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint();
 }
 
+void TransactionManager::Vacuum(ClientContext &context, DataTable &table) {
+	// vacuuming rewrites row groups in place and cannot be rolled back: it requires the same exclusive access to the
+	// database as a checkpoint
+	// first check if no other thread is checkpointing right now
+	auto lock = unique_lock<mutex>(transaction_lock);
+	if (thread_is_checkpointing) {
+		throw TransactionException("Cannot VACUUM: another thread is checkpointing right now");
+	}
+	CheckpointLock checkpoint_lock(*this);
+	checkpoint_lock.Lock();
+	lock.unlock();
+
+	// lock all the clients AND the connection manager now
+	// this ensures no new queries can be started, and no new connections to the database can be made
+	// to avoid deadlock we release the transaction lock while locking the clients
+	vector<ClientLockWrapper> client_locks;
+	LockClients(client_locks, context);
+
+	// finish any queued or in-flight background version cleanup before rewriting row groups in place
+	DrainCleanup();
+
+	auto current = &Transaction::Get(context, db);
+	lock.lock();
+	if (current->ChangesMade()) {
+		throw TransactionException("Cannot VACUUM: the current transaction has transaction local changes");
+	}
+	if (!IsSoleTransaction(current)) {
+		throw TransactionException("Cannot VACUUM: there are other active transactions");
+	}
+	table.Vacuum();
+}
+
 bool TransactionManager::CanCheckpoint(Transaction *current) {
 	if (db.IsSystem()) {
 		return false;
@@ -163,9 +327,23 @@ bool TransactionManager::CanCheckpoint(Transaction *current) {
 	if (storage_manager.InMemory()) {
 		return false;
 	}
+	return IsSoleTransaction(current);
+}
+
+bool TransactionManager::HasPendingCleanup() {
+	lock_guard<mutex> guard(cleanup_state->lock);
+	return !cleanup_state->transactions.empty() || cleanup_state->task_running;
+}
+
+bool TransactionManager::IsSoleTransaction(Transaction *current) {
 	if (!recently_committed_transactions.empty() || !old_transactions.empty()) {
 		return false;
 	}
+	if (HasPendingCleanup()) {
+		// transactions handed to the background cleanup task are invisible to the lists above, but their version
+		// info is still being traversed: they count against exclusive access just like active transactions
+		return false;
+	}
 	for (auto &transaction : active_transactions) {
 		if (transaction.get() != current) {
 			return false;
@@ -187,8 +365,16 @@ string TransactionManager::CommitTransaction(ClientContext &context, Transaction
 			// to avoid deadlock we release the transaction lock while locking the clients
 			lock.reset();
 
+			// pre-write the table data of the checkpoint before stalling the other clients: the exclusive phase then
+			// only writes the row groups that changed in the meantime, plus the metadata
+			db.GetStorageManager().PrepareCheckpoint();
+
 			LockClients(client_locks, context);
 
+			// finish any queued or in-flight background version cleanup: the checkpoint frees structures such as
+			// the update segments that a cleanup task may still be traversing
+			DrainCleanup();
+
 			lock = make_unique<lock_guard<mutex>>(transaction_lock);
 			checkpoint = CanCheckpoint(transaction);
 			if (!checkpoint) {
@@ -214,6 +400,28 @@ string TransactionManager::CommitTransaction(ClientContext &context, Transaction
 		checkpoint_lock.Unlock();
 		client_locks.clear();
 	}
+	if (error.empty() && !checkpoint && !db.IsSystem()) {
+		auto log = db.GetStorageManager().GetWriteAheadLog();
+		if (log) {
+			// sync the WAL entries of this commit to disk before acknowledging the commit
+			// we release the transaction lock while syncing so that concurrent commits can append to the WAL
+			// and share a single fsync (group commit)
+			// note that the transaction remains in the set of active transactions during the sync:
+			// this prevents a concurrent checkpoint from truncating the WAL underneath us
+			lock.reset();
+			try {
+				log->Sync();
+			} catch (std::exception &ex) {
+				// the commit has already been applied in memory and cannot be rolled back anymore, but it may not
+				// be durable: remove the transaction so it cannot block checkpoints forever and invalidate the
+				// database, as its on-disk state is no longer trustworthy
+				lock = make_unique<lock_guard<mutex>>(transaction_lock);
+				RemoveTransaction(transaction);
+				throw FatalException("Failed to sync the WAL to disk on commit: %s", ex.what());
+			}
+			lock = make_unique<lock_guard<mutex>>(transaction_lock);
+		}
+	}
 
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
@@ -276,6 +484,9 @@ void TransactionManager::RemoveTransaction(Transaction *transaction) noexcept {
 	}
 	// remove the transaction from the set of currently active transactions
 	active_transactions.erase(active_transactions.begin() + t_index);
+	// version cleanup can run in the background when the scheduler has worker threads; without them the task would
+	// never execute and we fall back to cleaning up on the commit path as before
+	bool background_cleanup = TaskScheduler::GetScheduler(db.GetDatabase()).NumberOfBackgroundThreads() > 0;
 	// traverse the recently_committed transactions to see if we can remove any
 	idx_t i = 0;
 	for (; i < recently_committed_transactions.size(); i++) {
@@ -294,11 +505,18 @@ void TransactionManager::RemoveTransaction(Transaction *transaction) noexcept {
 			// we can only safely do the actual memory cleanup when all the
 			// currently active queries have finished running! (actually,
 			// when all the currently active scans have finished running...)
-			recently_committed_transactions[i]->Cleanup();
+
 			// store the current highest active query
 			recently_committed_transactions[i]->highest_active_query = current_query;
-			// move it to the list of transactions awaiting GC
-			old_transactions.push_back(std::move(recently_committed_transactions[i]));
+			if (background_cleanup) {
+				// hand the transaction to the background cleanup task: this keeps the (potentially long) version
+				// chain traversal off the commit path
+				ScheduleCleanup(std::move(recently_committed_transactions[i]));
+			} else {
+				recently_committed_transactions[i]->Cleanup();
+				// move it to the list of transactions awaiting GC
+				old_transactions.push_back(std::move(recently_committed_transactions[i]));
+			}
 		} else {
 			// recently_committed_transactions is ordered on commit_id
 			// implicitly thus if the current one is bigger than
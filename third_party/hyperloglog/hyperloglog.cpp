@@ -1247,6 +1247,23 @@ uint64_t get_size() {
 	return HLL_DENSE_SIZE;
 }
 
+uint64_t num_registers() {
+	return HLL_REGISTERS;
+}
+
+uint8_t get_register(robj *o, uint64_t index) {
+	struct hllhdr *hdr = (struct hllhdr *)o->ptr;
+	uint8_t val;
+	HLL_DENSE_GET_REGISTER(val, hdr->registers, index);
+	return val;
+}
+
+void set_register(robj *o, uint64_t index, uint8_t value) {
+	struct hllhdr *hdr = (struct hllhdr *)o->ptr;
+	HLL_DENSE_SET_REGISTER(hdr->registers, index, value);
+	HLL_INVALIDATE_CACHE(hdr);
+}
+
 }
 
 namespace duckdb {
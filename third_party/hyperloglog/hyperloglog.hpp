@@ -37,6 +37,12 @@ int hll_count(robj *o, size_t *result);
 robj *hll_merge(robj **hlls, size_t hll_count);
 //! Get size (in bytes) of the HLL
 uint64_t get_size();
+//! Get the number of registers of the HLL
+uint64_t num_registers();
+//! Get the value of the register at the given index of a dense HLL
+uint8_t get_register(robj *o, uint64_t index);
+//! Set the value of the register at the given index of a dense HLL
+void set_register(robj *o, uint64_t index, uint8_t value);
 
 uint64_t MurmurHash64A(const void *key, int len, unsigned int seed);
 